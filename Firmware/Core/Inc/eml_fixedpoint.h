@@ -0,0 +1,142 @@
+
+#ifndef EML_FIXEDPOINT_H
+#define EML_FIXEDPOINT_H
+
+/** @file eml_fixedpoint.h
+* Fixed-point and bit helpers for the quantized and binarized EmlNet kernels.
+*
+* Wraps the Cortex-M4 DSP extension SIMD instructions used by the kernels.
+* When __ARM_FEATURE_DSP is available the ACLE intrinsics are used,
+* otherwise (or with EML_FIXEDPOINT_PORTABLE) a portable C reference
+* that gives bit-exact results, so the kernels can be tested on a host.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && !defined(EML_FIXEDPOINT_PORTABLE)
+#include <arm_acle.h>
+#define EML_FIXEDPOINT_DSP 1
+#else
+#define EML_FIXEDPOINT_DSP 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+* \internal
+* \brief Load 32 bits (two q15 or four q7 values) from possibly unaligned memory
+*
+* Compiles to a single LDR on Cortex-M4, which supports unaligned word loads.
+*/
+static inline uint32_t
+eml_read_u32(const void *ptr)
+{
+    uint32_t v;
+    memcpy(&v, ptr, sizeof(v));
+    return v;
+}
+
+/**
+* \brief Dual 16-bit multiply with 32-bit accumulate (SMLAD)
+*
+* acc + x[15:0]*y[15:0] + x[31:16]*y[31:16], wrapping on overflow.
+*/
+static inline int32_t
+eml_smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+#if EML_FIXEDPOINT_DSP
+    return __smlad(x, y, acc);
+#else
+    const int32_t lo = (int32_t)(int16_t)(x & 0xFFFFU) * (int32_t)(int16_t)(y & 0xFFFFU);
+    const int32_t hi = (int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16);
+    return (int32_t)((uint32_t)acc + (uint32_t)lo + (uint32_t)hi);
+#endif
+}
+
+/**
+* \brief Dual 16-bit multiply with 64-bit accumulate (SMLALD)
+*
+* acc + x[15:0]*y[15:0] + x[31:16]*y[31:16]. Same throughput as SMLAD on Cortex-M4,
+* but cannot overflow for any realistic vector length.
+*/
+static inline int64_t
+eml_smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+#if EML_FIXEDPOINT_DSP
+    return __smlald(x, y, acc);
+#else
+    const int32_t lo = (int32_t)(int16_t)(x & 0xFFFFU) * (int32_t)(int16_t)(y & 0xFFFFU);
+    const int32_t hi = (int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16);
+    return acc + (int64_t)lo + (int64_t)hi;
+#endif
+}
+
+/**
+* \brief Sign-extend bytes 0 and 2 into two 16-bit halves (SXTB16)
+*/
+static inline uint32_t
+eml_sxtb16(uint32_t x)
+{
+#if EML_FIXEDPOINT_DSP
+    return (uint32_t)__sxtb16(x);
+#else
+    const uint32_t lo = (uint32_t)(uint16_t)(int16_t)(int8_t)(x & 0xFFU);
+    const uint32_t hi = (uint32_t)(uint16_t)(int16_t)(int8_t)((x >> 16) & 0xFFU);
+    return lo | (hi << 16);
+#endif
+}
+
+/**
+* \brief Rotate right, n in 1..31 (ROR)
+*/
+static inline uint32_t
+eml_ror(uint32_t x, uint32_t n)
+{
+#if EML_FIXEDPOINT_DSP
+    return __ror(x, n);
+#else
+    return (x >> n) | (x << (32U - n));
+#endif
+}
+
+/**
+* \brief Four int8 multiply-accumulates using two SMLAD
+*
+* acc + sum(x[k]*y[k]) for the 4 signed bytes packed in x and y.
+*/
+static inline int32_t
+eml_dot4_q7(uint32_t x, uint32_t y, int32_t acc)
+{
+    acc = eml_smlad(eml_sxtb16(x), eml_sxtb16(y), acc);
+    acc = eml_smlad(eml_sxtb16(eml_ror(x, 8)), eml_sxtb16(eml_ror(y, 8)), acc);
+    return acc;
+}
+
+/**
+* \brief Number of set bits in x
+*
+* Cortex-M4 has no popcount instruction (GCC would call __popcountsi2),
+* so this is the branch-free SWAR sum, about 12 instructions.
+* Uses the POPCNT instruction when the compiler targets it (x86 -mpopcnt).
+*/
+static inline int32_t
+eml_popcount32(uint32_t x)
+{
+#if defined(__POPCNT__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555U);
+    x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+    x = (x + (x >> 4)) & 0x0F0F0F0FU;
+    return (int32_t)((x * 0x01010101U) >> 24);
+#endif
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_FIXEDPOINT_H
@@ -0,0 +1,80 @@
+
+#ifndef EML_FLOAT16_H
+#define EML_FLOAT16_H
+
+/** @file eml_float16.h
+* IEEE 754 half precision (binary16) storage, for weights kept at half the flash size.
+*
+* Values are stored as uint16_t bit patterns and converted to float for compute.
+* On Arm with __fp16 in IEEE format (GCC -mfp16-format=ieee) the conversion is a single VCVTB.
+* Otherwise a portable C reference is used, which gives identical results (the conversion is exact).
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_FP16_FORMAT_IEEE) && !defined(EML_FLOAT16_PORTABLE)
+#define EML_FLOAT16_NATIVE 1
+#else
+#define EML_FLOAT16_NATIVE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* \brief Convert a half precision bit pattern to float
+*
+* Exact for all values, including subnormals, infinities and NaN.
+*/
+static inline float
+eml_float16_to_float(uint16_t h)
+{
+#if EML_FLOAT16_NATIVE
+    __fp16 v;
+    memcpy(&v, &h, sizeof(v));
+    return (float)v;
+#else
+    // Exponent and mantissa moved into place keep the half exponent bias of 15. Multiplying by
+    // 2^(127-15) rebiases normals and turns subnormal halves (subnormal floats here) into normal floats,
+    // exactly and without branching on them. The sign rides along
+    const uint32_t magnitude = ((uint32_t)h & 0x7FFFU) << 13;
+    uint32_t bits = (((uint32_t)h & 0x8000U) << 16) | magnitude;
+    if (magnitude >= (0x1FU << 23)) {
+        // Inf or NaN: all exponent bits set
+        bits |= 0x7F800000U;
+        float special;
+        memcpy(&special, &bits, sizeof(special));
+        return special;
+    }
+    float out;
+    memcpy(&out, &bits, sizeof(out));
+    return out * ((float)(1ULL << 56) * (float)(1ULL << 56));
+#endif
+}
+
+/**
+* \brief Convert a half precision bit pattern of a finite value to float
+*
+* Exact for finite values, including subnormals. Inf and NaN come out as finite values.
+* Without branches, so a loop over weights can be vectorized. For weights, which are always finite
+*/
+static inline float
+eml_float16_finite_to_float(uint16_t h)
+{
+#if EML_FLOAT16_NATIVE
+    return eml_float16_to_float(h);
+#else
+    const uint32_t bits = (((uint32_t)h & 0x8000U) << 16) | (((uint32_t)h & 0x7FFFU) << 13);
+    float out;
+    memcpy(&out, &bits, sizeof(out));
+    return out * ((float)(1ULL << 56) * (float)(1ULL << 56));
+#endif
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_FLOAT16_H
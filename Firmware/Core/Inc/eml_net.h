@@ -4,10 +4,21 @@
 
 #include "eml_common.h"
 #include "eml_net_common.h"
+#include "eml_fixedpoint.h"
+#include "eml_float16.h"
+#include "eml_net_profile.h"
 
 #include <stdint.h>
 #include <math.h>
 
+// Host builds on x86-64 pick SSE or AVX2 dense kernels at runtime, see eml_net_x86.h
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(EML_NET_NO_X86)
+#define EML_NET_X86 1
+#include <immintrin.h>
+#else
+#define EML_NET_X86 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +28,133 @@ extern "C" {
 // TODO: implement HardSigmoid
 
 
+/** @struct EmlNetInt8Weights
+*  Weights of an EmlNetLayerDenseInt8 layer
+*
+* Symmetric quantization per output channel: w[o][i] = weights[o*n_inputs + i] * scales[o].
+* Inputs are quantized to int8 per inference, and accumulated in int32.
+* Outputs are dequantized to float, so these layers can be mixed with float layers.
+*/
+typedef struct _EmlNetInt8Weights {
+    const int8_t *weights;
+    const float *scales;
+} EmlNetInt8Weights;
+
+/** @struct EmlNetQ15Weights
+*  Weights of an EmlNetLayerDenseQ15 layer
+*
+* Same scheme as EmlNetInt8Weights, with 16-bit weights and inputs.
+* Pairs of weights and inputs are multiplied with dual 16-bit MACs (SMLALD) into 64-bit accumulators.
+*/
+typedef struct _EmlNetQ15Weights {
+    const int16_t *weights;
+    const float *scales;
+} EmlNetQ15Weights;
+
+/** @struct EmlNetFloat16Weights
+*  Weights and biases of an EmlNetLayerDenseFloat16 layer
+*
+* IEEE half precision bit patterns (see eml_float16.h), half the flash of float.
+* weights are in the layout of EmlNetLayerDenseBlocked8, padded up to a multiple of 8 outputs.
+* Expanded to float in the kernel, computed in float. Then EmlNetLayer weights and biases are NULL.
+* w = weights * scale. A power-of-two scale keeps small weights (like those with a folded scaler)
+* out of the half precision subnormal range, without adding rounding.
+* This saves flash, not time: expanding each weight costs more than the multiply-add. For the 600x32 layer 0
+* on the host (portable C, bench_dense.c) it takes about 9 us, against 4 us for blocked8 and 20 us for dense.
+*/
+typedef struct _EmlNetFloat16Weights {
+    const uint16_t *weights;
+    const uint16_t *biases;
+    float scale;
+} EmlNetFloat16Weights;
+
+/** @struct EmlNetCsrWeights
+*  Weights of an EmlNetLayerDenseCsr layer, pruned and stored as compressed sparse rows
+*
+* One row per output. The kept weights of output o are values[k], for inputs columns[k],
+* with k in [row_offsets[o], row_offsets[o+1]). row_offsets has n_outputs+1 entries, starting at 0,
+* non-decreasing and ending at n_values. Every column is below n_inputs.
+* Flash and multiply-adds scale with the number of kept weights, up to 65535 per layer.
+*/
+typedef struct _EmlNetCsrWeights {
+    const float *values;
+    const uint16_t *columns;
+    const uint16_t *row_offsets;
+    int32_t n_values;   // kept weights: the length of values and columns
+} EmlNetCsrWeights;
+
+/** @struct EmlNetCodebookWeights
+*  Weights of an EmlNetLayerDenseCodebook layer, shared through a 16 entry codebook
+*
+* w[o][i] = codebook[index], with 4-bit indices packed output-major, two per byte, low nibble first.
+* Each output row takes (n_inputs+1)/2 bytes. The codebook has 16 entries for the whole layer,
+* or 16 per output (at codebook + o*16) when per_output is non-zero. Computed in float.
+*/
+typedef struct _EmlNetCodebookWeights {
+    const uint8_t *indices;
+    const float *codebook;
+    int32_t per_output;
+} EmlNetCodebookWeights;
+
+/** @struct EmlNetBinaryWeights
+*  Weights of an EmlNetLayerDenseBinary layer: 1-bit or ternary weights, binarized inputs
+*
+* Inputs are binarized per inference to +1 (x >= thresholds[i], or x >= 0 when thresholds is NULL) or -1.
+* Weights are +1 (bit set in signs) or -1, output-major with (n_inputs+31)/32 words per output,
+* input i at bit i%32 of word i/32. For ternary weights masks has the same layout, and a clear bit is a 0 weight.
+* out[o] = scales[o] * dot(w[o], x) + biases[o], the dot product by XNOR and popcount over 32 inputs at a time.
+*/
+typedef struct _EmlNetBinaryWeights {
+    const uint32_t *signs;
+    const uint32_t *masks;
+    const float *scales;
+    const float *thresholds;
+} EmlNetBinaryWeights;
+
+/** @struct EmlNetConv1DParams
+*  Shape of an EmlNetLayerConv1D, EmlNetLayerConv1DDepthwise, EmlNetLayerMaxPool1D or EmlNetLayerAvgPool1D layer
+*
+* Inputs and outputs are channels-last time series: x[t*channels + c].
+* n_inputs = in_length*in_channels, n_outputs = out_length*out_channels,
+* with out_length = (in_length - dilation*(kernel_size-1) - 1) / stride + 1 (no padding).
+*
+* Conv1D weights are w[(k*in_channels + ci)*out_channels + co], in EmlNetLayer weights, biases per out channel.
+* Depthwise weights are w[k*channels + c], one filter per channel. Pooling has no weights or biases.
+* Depthwise and pooling layers have out_channels == in_channels.
+* A depthwise-separable convolution is a depthwise layer followed by a Conv1D with kernel_size 1.
+*/
+typedef struct _EmlNetConv1DParams {
+    int32_t in_channels;
+    int32_t out_channels;
+    int32_t kernel_size;
+    int32_t stride;
+    int32_t dilation;
+} EmlNetConv1DParams;
+
+/** @struct EmlNetGruParams
+*  Weights of an EmlNetLayerGru layer, a GRU over a channels-last sequence of n_features per step
+*
+* Gates in Keras order (update z, reset r, candidate n), reset after the recurrent projection:
+*   z = expit(x Wz + bz + h Uz + cz), r = expit(x Wr + br + h Ur + cr)
+*   n = tanh(x Wn + bn + r * (h Un + cn)), h = (1 - z) * n + z * h
+* input_weights is (n_features, 3*hidden) and recurrent_weights (hidden, 3*hidden), both input-major
+* like EmlNetLayerDense. hidden is the n_outputs of the layer, n_inputs is n_steps*n_features.
+* As a layer it runs the whole sequence from a zero state and outputs the last state.
+* For streaming, eml_net_gru_step() updates the state with one step at a time.
+*/
+typedef struct _EmlNetGruParams {
+    int32_t n_features;
+    const float *input_weights;
+    const float *recurrent_weights;
+    const float *input_biases;
+    const float *recurrent_biases;
+} EmlNetGruParams;
+
+// Most output channels of a Conv1D or pooling layer, one output step is accumulated on the stack
+#ifndef EML_NET_CONV_MAX_CHANNELS
+#define EML_NET_CONV_MAX_CHANNELS 64
+#endif
+
 /** @struct EmlNetLayer
 *  Layer of a Neural Network
 *
@@ -28,6 +166,10 @@ typedef struct _EmlNetLayer {
     const float *weights;
     const float *biases;
     EmlNetActivationFunction activation;
+    // Layout of weights. Zero (left out by older generated code) is EmlNetLayerDense
+    EmlNetLayerType type;
+    // Weights for non-float layer types, like EmlNetInt8Weights. Then weights is NULL
+    const void *params;
 } EmlNetLayer;
 
 /** @typedef EmlNet
@@ -44,8 +186,28 @@ typedef struct _EmlNet {
     float *activations1;
     float *activations2;
     int32_t activations_length;
+    // Scratch memory for quantized layers (quantized inputs). NULL when only float layers
+    void *scratch;
+    int32_t scratch_length; // in bytes
+    // Length of activations2 when it differs from activations_length (see eml_net_plan_buffers).
+    // Zero (left out by older generated code) means the same
+    int32_t activations2_length;
+    // Per-layer counts, recorded when built with EML_NET_PROFILE (see eml_net_profile.h). NULL records nothing
+    EmlNetProfile *profile;
 } EmlNet;
 
+/** @typedef EmlNetChecked
+* \brief Neural Network validated once by eml_net_check()
+*
+* Handle for the eml_net_*_unchecked functions, which skip all argument checks.
+* Only valid as long as the EmlNet it was made from is unchanged.
+*/
+typedef struct _EmlNetChecked {
+    EmlNet *model;
+    int32_t n_inputs;
+    int32_t n_outputs;
+} EmlNetChecked;
+
 
 static float
 eml_net_relu(float in) {
@@ -87,7 +249,7 @@ eml_net_softmax(float *input, size_t input_length)
     return EmlOk;
 }
 
-int32_t
+static inline int32_t
 eml_net_argmax(const float *values, int32_t values_length) {
 
     float vmax = -INFINITY;
@@ -103,19 +265,19 @@ eml_net_argmax(const float *values, int32_t values_length) {
 
 
 static bool
-eml_net_valid(EmlNet *model) {
+eml_net_valid(const EmlNet *model) {
     bool not_null = model->layers && model->activations1 && model->activations2;
     return not_null;
 }
 
 static inline int32_t
-eml_net_outputs(EmlNet *model) {
+eml_net_outputs(const EmlNet *model) {
     return model->layers[model->n_layers-1].n_outputs;
 }
 
 // For binary problem, one output, we need to report [ prob(class_0), prob(class_1)]
 static inline int32_t
-eml_net_outputs_proba(EmlNet *model) {
+eml_net_outputs_proba(const EmlNet *model) {
     int32_t n_outputs = eml_net_outputs(model);
     if (n_outputs == 1) {
         n_outputs = 2;
@@ -125,23 +287,182 @@ eml_net_outputs_proba(EmlNet *model) {
 
 /*
 * \internal
-* \brief Calculate size of activation value arrays
-* 
+* \brief Scratch memory in bytes needed by a layer
 */
 static int32_t
-eml_net_find_largest_layer(EmlNet *model) {
-    int32_t largest = -1;
-    for (int i=0; i<model->n_layers; i++) {
-        if (model->layers[i].n_inputs > largest) {
-            largest = model->layers[i].n_inputs;
+eml_net_layer_scratch_size(const EmlNetLayer *layer) {
+    if (layer->type == EmlNetLayerDenseInt8) {
+        return layer->n_inputs * (int32_t)sizeof(int8_t);
+    }
+    if (layer->type == EmlNetLayerDenseQ15) {
+        return layer->n_inputs * (int32_t)sizeof(int16_t);
+    }
+    if (layer->type == EmlNetLayerDenseSparseInput) {
+        return layer->n_inputs * (int32_t)sizeof(int16_t);
+    }
+    if (layer->type == EmlNetLayerDenseBinary) {
+        return ((layer->n_inputs + 31) / 32) * (int32_t)sizeof(uint32_t);
+    }
+    if (layer->type == EmlNetLayerGru) {
+        // Input and recurrent projections of the 3 gates
+        return 6 * layer->n_outputs * (int32_t)sizeof(float);
+    }
+    return 0;
+}
+
+static inline bool
+eml_net_layer_is_conv1d(const EmlNetLayer *layer) {
+    return layer->type == EmlNetLayerConv1D || layer->type == EmlNetLayerConv1DDepthwise
+        || layer->type == EmlNetLayerMaxPool1D || layer->type == EmlNetLayerAvgPool1D;
+}
+
+/*
+* \internal
+* \brief Whether a layer may write its outputs over its inputs
+*
+* Conv1D and pooling kernels store an output step only after reading all its inputs.
+* Inputs of later steps start at or after where this step is stored when out_channels <= stride*in_channels.
+*/
+static bool
+eml_net_layer_in_place(const EmlNetLayer *layer) {
+    if (!eml_net_layer_is_conv1d(layer) || !layer->params) {
+        return false;
+    }
+    const EmlNetConv1DParams *conv = (const EmlNetConv1DParams *)layer->params;
+    return conv->out_channels <= (conv->stride * conv->in_channels);
+}
+
+/*
+* \internal
+* \brief Activation buffer (1 or 2) that layer 0 writes to
+*
+* Layers alternate between the two buffers, except layers that run in place (eml_net_layer_in_place).
+* Layer 0 reads the features of the caller, so it never runs in place.
+* Starts such that the output layer ends up in activations2.
+*/
+static int
+eml_net_first_buffer(const EmlNet *model) {
+    int switches = 0;
+    for (int l=1; l<model->n_layers; l++) {
+        switches += eml_net_layer_in_place(&model->layers[l]) ? 0 : 1;
+    }
+    return ((switches % 2) == 0) ? 2 : 1;
+}
+
+// Activation buffer (1 or 2) that layer l > 0 writes to, given the buffer of layer l-1
+static inline int
+eml_net_next_buffer(const EmlNetLayer *layer, int previous) {
+    return eml_net_layer_in_place(layer) ? previous : (3 - previous);
+}
+
+/*
+* \internal
+* \brief In-place memory plan. Lengths (in floats) needed for activations1 and activations2
+*
+* Largest output of the layers written to each buffer. Without in-place layers,
+* the buffers hold every other layer, otherwise a chain of in-place layers shares one buffer.
+*/
+static void
+eml_net_plan_buffers(const EmlNet *model, int32_t *length1, int32_t *length2) {
+    int32_t lengths[2] = { 0, 0 };
+    int buffer = eml_net_first_buffer(model);
+    for (int l=0; l<model->n_layers; l++) {
+        const EmlNetLayer *layer = &model->layers[l];
+        if (l > 0) {
+            buffer = eml_net_next_buffer(layer, buffer);
         }
-        if (model->layers[i].n_outputs > largest) {
-            largest = model->layers[i].n_outputs;
+        if (layer->n_outputs > lengths[buffer-1]) {
+            lengths[buffer-1] = layer->n_outputs;
+        }
+    }
+    *length1 = lengths[0];
+    *length2 = lengths[1];
+}
+
+static inline int32_t
+eml_net_activations2_length(const EmlNet *model) {
+    return (model->activations2_length > 0) ? model->activations2_length : model->activations_length;
+}
+
+// Whether the activation buffers of model fit its memory plan
+static bool
+eml_net_buffers_fit(const EmlNet *model) {
+    int32_t length1;
+    int32_t length2;
+    eml_net_plan_buffers(model, &length1, &length2);
+    return (model->activations_length >= length1) && (eml_net_activations2_length(model) >= length2);
+}
+
+/*
+* \internal
+* \brief Calculate size of scratch memory
+*/
+static int32_t
+eml_net_find_scratch_size(const EmlNet *model) {
+    int32_t largest = 0;
+    for (int i=0; i<model->n_layers; i++) {
+        const int32_t size = eml_net_layer_scratch_size(&model->layers[i]);
+        if (size > largest) {
+            largest = size;
         }
     }
     return largest;
 }
 
+/**
+* \brief Size of the workspace for the eml_net_*_workspace functions, in bytes
+*
+* Holds the two activation buffers and the scratch memory of quantized layers.
+*/
+static int32_t
+eml_net_workspace_size(const EmlNet *model) {
+    int32_t length1;
+    int32_t length2;
+    eml_net_plan_buffers(model, &length1, &length2);
+    return ((length1 + length2) * (int32_t)sizeof(float)) + eml_net_find_scratch_size(model);
+}
+
+/**
+* \brief Make a handle that shares the layers of model, but uses workspace for all mutable state
+*
+* The returned handle can be used with eml_net_predict() etc.
+* Each thread (or ISR) using the same model needs its own workspace.
+*
+* \param model Model, for instance the one generated by emlearn. Only layers are used
+* \param workspace Memory of at least eml_net_workspace_size() bytes, aligned for float
+* \param workspace_length Length of workspace, in bytes
+* \param out Handle to initialize
+*
+* \return EmlOk on success, or error on failure
+*/
+static EmlError
+eml_net_bind_workspace(const EmlNet *model, void *workspace, int32_t workspace_length, EmlNet *out)
+{
+    EML_PRECONDITION(model->layers, EmlUninitialized);
+    EML_PRECONDITION(workspace, EmlUninitialized);
+    EML_PRECONDITION(((uintptr_t)workspace % sizeof(float)) == 0, EmlUnsupported);
+    EML_PRECONDITION(workspace_length >= eml_net_workspace_size(model), EmlSizeMismatch);
+
+    int32_t length1;
+    int32_t length2;
+    eml_net_plan_buffers(model, &length1, &length2);
+    float *activations = (float *)workspace;
+    const int32_t scratch_length = workspace_length - ((length1 + length2) * (int32_t)sizeof(float));
+
+    out->n_layers = model->n_layers;
+    out->layers = model->layers;
+    out->activations1 = activations;
+    out->activations2 = activations + length1;
+    out->activations_length = length1;
+    out->scratch = (scratch_length > 0) ? (void *)(activations + length1 + length2) : NULL;
+    out->scratch_length = scratch_length;
+    out->activations2_length = length2;
+    // Shared with the model, so concurrent inferences should not record into it
+    out->profile = model->profile;
+
+    return EmlOk;
+}
+
 
 // CMSIS-NN tricks
 // - fixed-point math
@@ -169,27 +490,13 @@ eml_net_find_largest_layer(EmlNet *model) {
 // reached state-of-art in MINST/CIFAR-10 with linear SVM classifier
 // scattering transform also did well
 
-// Inference for a single layer
-EmlError
-eml_net_forward(const float *in, int32_t in_length,
-                const float *weights,
-                const float *biases,
-                EmlNetActivationFunction activation,
-                float *out, int32_t out_length)
+/*
+* \internal
+* \brief Apply activation function in-place
+*/
+static EmlError
+eml_net_activate(float *out, int32_t out_length, EmlNetActivationFunction activation)
 {
-
-    // multiply inputs by weights
-    for (int o=0; o<out_length; o++) {
-        float sum = 0.0f;
-        for (int i=0; i<in_length; i++) {
-            const int w_idx = o+(i*out_length);
-            const float w = weights[w_idx];
-            sum += w * in[i];
-        }
-        out[o] = sum + biases[o];
-    }
-
-    // apply activation function
     if (activation == EmlNetActivationIdentity) {
         // no-op
     } else if (activation == EmlNetActivationRelu) {
@@ -216,152 +523,1204 @@ eml_net_forward(const float *in, int32_t in_length,
     return EmlOk;
 }
 
+// Multiply inputs by weights and add biases, no activation. Signature of the float dense kernels
+typedef void (*EmlNetDenseKernel)(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length);
+
+// Multiply inputs by weights in the emlearn input-major layout, and add biases
+static void
+eml_net_dense(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    for (int o=0; o<out_length; o++) {
+        float sum = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            const int w_idx = o+(i*out_length);
+            const float w = weights[w_idx];
+            sum += w * in[i];
+        }
+        out[o] = sum + biases[o];
+    }
+}
 
-EmlError
-eml_net_layer_forward(const EmlNetLayer *layer,
-                    const float *in, int32_t in_length,
-                    float *out, int32_t out_length)
+// Inference for a single layer
+static inline EmlError
+eml_net_forward(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                EmlNetActivationFunction activation,
+                float *out, int32_t out_length)
 {
-    EML_PRECONDITION(in_length >= layer->n_inputs, EmlSizeMismatch);
-    EML_PRECONDITION(out_length >= layer->n_outputs, EmlSizeMismatch);
-    EML_PRECONDITION(layer->weights, EmlUninitialized);
-    EML_PRECONDITION(layer->biases, EmlUninitialized);
 
-    const EmlError err = eml_net_forward(in, layer->n_inputs,
-            layer->weights,
-            layer->biases,
-            layer->activation,
-            out, layer->n_outputs
-    );
+    // multiply inputs by weights
+    eml_net_dense(in, in_length, weights, biases, out, out_length);
 
-    return err;
+    // apply activation function
+    return eml_net_activate(out, out_length, activation);
 }
 
-
 /*
 * \internal
-* \brief Run inference
-* 
-* Used internally by eml_net_predict et.c.
-* NOTE: Leaves results in activations2
+* \brief Multiply inputs by output-blocked weights, 4 outputs per pass
+*
+* Weights are stored in blocks of 4 outputs, padded with zeros up to a multiple of 4.
+* Within a block, the 4 weights of one input are adjacent:
+* weights[(b*in_length + i)*4 + k] connects input i to output b*4+k.
+* Weights are thus read strictly sequentially, and each input is loaded once per block.
 */
-EmlError
-eml_net_infer(EmlNet *model, const float *features, int32_t features_length)
+static void
+eml_net_dense_blocked4(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
 {
-    EML_PRECONDITION(eml_net_valid(model), EmlUninitialized);
-    EML_PRECONDITION(model->n_layers >= 2, EmlUnsupported);
-    EML_PRECONDITION(features_length == model->layers[0].n_inputs, EmlSizeMismatch);
-    EML_PRECONDITION(model->activations_length >= eml_net_find_largest_layer(model), EmlSizeMismatch);
-
-    const int32_t buffer_length = model->activations_length; 
-    float *buffer1 = model->activations1;
-    float *buffer2 = model->activations2;
+    const int32_t n_blocks = (out_length + 3) / 4;
+    const float *w = weights;
 
-    // Input layer
-    EML_CHECK_ERROR(eml_net_layer_forward(&model->layers[0], features,
-                        features_length, buffer1, buffer_length));
+    for (int b=0; b<n_blocks; b++) {
+        float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            const float x = in[i];
+            acc0 += w[0] * x;
+            acc1 += w[1] * x;
+            acc2 += w[2] * x;
+            acc3 += w[3] * x;
+            w += 4;
+        }
 
-    // Hidden layers
-    for (int l=1; l<model->n_layers-1; l++) {
-        const EmlNetLayer *layer = &model->layers[l];
-        // PERF: avoid copying, swap buffers instead
-        EML_CHECK_ERROR(eml_net_layer_forward(layer, buffer1, buffer_length, buffer2, buffer_length));
-        for (int i=0; i<buffer_length; i++) {
-            buffer1[i] = buffer2[i];
+        const float acc[4] = { acc0, acc1, acc2, acc3 };
+        const int o_start = b*4;
+        for (int k=0; k<4 && (o_start+k)<out_length; k++) {
+            out[o_start+k] = acc[k] + biases[o_start+k];
         }
     }
-
-    // Output layer
-    EML_CHECK_ERROR(eml_net_layer_forward(&model->layers[model->n_layers-1],
-                        buffer1, buffer_length, buffer2, buffer_length));
-
-    return EmlOk;
 }
 
-/**
-* \brief Run inference and return probabilities. Sum of outputs must be approx. 1.
-*
-* \param model EmlNet instance
-* \param features Input data values
-* \param features_length Length of input data
-* \param out Buffer to store output
-* \param out_length Length of output buffer
+/*
+* \internal
+* \brief Multiply inputs by output-blocked weights, 8 outputs per pass
 *
-* \return EmlOk on success, else an error
+* Same as eml_net_dense_blocked4, with blocks of 8 outputs.
 */
-EmlError
-eml_net_predict_proba(EmlNet *model, const float *features, int32_t features_length,
-                                  float *out, int32_t out_length)
+static void
+eml_net_dense_blocked8(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
 {
-    EML_PRECONDITION(eml_net_valid(model), EmlUninitialized);
-    EML_PRECONDITION(features, EmlUninitialized);
-    EML_PRECONDITION(out, EmlUninitialized);
-    const int32_t n_outputs = eml_net_outputs_proba(model);
-    EML_PRECONDITION(out_length == n_outputs, EmlSizeMismatch);
-
-    EML_CHECK_ERROR(eml_net_infer(model, features, features_length));
+    const int32_t n_blocks = (out_length + 7) / 8;
+    const float *w = weights;
 
-    float proba_sum = 0.0f;
+    for (int b=0; b<n_blocks; b++) {
+        float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float acc4 = 0.0f, acc5 = 0.0f, acc6 = 0.0f, acc7 = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            const float x = in[i];
+            acc0 += w[0] * x;
+            acc1 += w[1] * x;
+            acc2 += w[2] * x;
+            acc3 += w[3] * x;
+            acc4 += w[4] * x;
+            acc5 += w[5] * x;
+            acc6 += w[6] * x;
+            acc7 += w[7] * x;
+            w += 8;
+        }
 
-    if (n_outputs == 2) {
-        out[1] = model->activations2[0];
-        out[0] = 1.0f - out[1];
-        proba_sum = out[0] + out[1];
-    } else {
-        for (int i=0; i<n_outputs; i++) {
-            const float p = model->activations2[i];
-            out[i] = p;
-            proba_sum += p; 
+        const float acc[8] = { acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7 };
+        const int o_start = b*8;
+        for (int k=0; k<8 && (o_start+k)<out_length; k++) {
+            out[o_start+k] = acc[k] + biases[o_start+k];
         }
     }
-
-    EML_POSTCONDITION(fabsf(proba_sum - 1.0f) < 0.001f, EmlPostconditionFailed);
-
-    return EmlOk;
 }
 
-
-/**
-* \brief Run inference and return most probable class
-*
-* \param model EmlNet instance
-* \param features Input data values
-* \param features_length Length of input data
+/*
+* \internal
+* \brief Dense layer with int8 weights and per-output scales
 *
-* \return The class number, or -EmlError on failure
+* Inputs are quantized symmetrically into in_q, with a single scale for the input vector.
+* in_q must hold in_length values.
 */
-int32_t
-eml_net_predict(EmlNet *model, const float *features, int32_t features_length) {
-
-    const EmlError error = eml_net_infer(model, features, features_length);
-    if (error != EmlOk) {
-        return -error;
+static void
+eml_net_dense_int8(const float *in, int32_t in_length,
+                const EmlNetInt8Weights *params,
+                const float *biases,
+                int8_t *in_q,
+                float *out, int32_t out_length)
+{
+    float in_max = 0.0f;
+    for (int i=0; i<in_length; i++) {
+        in_max = eml_max(in_max, fabsf(in[i]));
     }
-
-    const int32_t n_outputs = eml_net_outputs(model);
-
-    int32_t _class = -EmlUnknownError;
-    if (n_outputs == 1) {
-        _class = (model->activations2[0] > 0.5f) ? 1 : 0;
-    } else if (n_outputs > 1) {
-        _class = eml_net_argmax(model->activations2, n_outputs);
+    const float in_scale = (in_max > 0.0f) ? (in_max / 127.0f) : 1.0f;
+    const float in_scale_inv = 1.0f / in_scale;
+    for (int i=0; i<in_length; i++) {
+        const float v = in[i] * in_scale_inv;
+        in_q[i] = (int8_t)((v >= 0.0f) ? (v + 0.5f) : (v - 0.5f));
     }
 
-    return _class;
+    // 2 outputs per pass, so each quantized input is loaded once per pair of rows.
+    // 4 MACs per word with SXTB16 + 2x SMLAD. Max |acc| is n_inputs*127*127, no overflow
+    const int8_t *w = params->weights;
+    const int32_t n_words = in_length / 4;
+    int o = 0;
+    for (; o+1<out_length; o+=2) {
+        const int8_t *w0 = w + (o*in_length);
+        const int8_t *w1 = w0 + in_length;
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        for (int k=0; k<n_words; k++) {
+            const uint32_t x = eml_read_u32(in_q + 4*k);
+            acc0 = eml_dot4_q7(eml_read_u32(w0 + 4*k), x, acc0);
+            acc1 = eml_dot4_q7(eml_read_u32(w1 + 4*k), x, acc1);
+        }
+        for (int i=4*n_words; i<in_length; i++) {
+            acc0 += (int32_t)w0[i] * (int32_t)in_q[i];
+            acc1 += (int32_t)w1[i] * (int32_t)in_q[i];
+        }
+        out[o] = ((float)acc0 * (params->scales[o] * in_scale)) + biases[o];
+        out[o+1] = ((float)acc1 * (params->scales[o+1] * in_scale)) + biases[o+1];
+    }
+    for (; o<out_length; o++) {
+        const int8_t *w0 = w + (o*in_length);
+        int32_t acc = 0;
+        for (int k=0; k<n_words; k++) {
+            acc = eml_dot4_q7(eml_read_u32(w0 + 4*k), eml_read_u32(in_q + 4*k), acc);
+        }
+        for (int i=4*n_words; i<in_length; i++) {
+            acc += (int32_t)w0[i] * (int32_t)in_q[i];
+        }
+        out[o] = ((float)acc * (params->scales[o] * in_scale)) + biases[o];
+    }
 }
 
-/**
-* \brief Run inference and return the predicted float array (last layer).
+/*
+* \internal
+* \brief Dense layer with q15 weights and per-output scales
 *
-* \param model EmlNet instance
-* \param features Input data values
-* \param features_length Length of input data
-* \param out Buffer to store output
+* Inputs are quantized symmetrically to q15 into in_q, with a single scale for the input vector.
+* in_q must hold in_length values. Two weights and two inputs are loaded per 32-bit word,
+* and multiplied with a dual 16-bit MAC.
+*/
+static void
+eml_net_dense_q15(const float *in, int32_t in_length,
+                const EmlNetQ15Weights *params,
+                const float *biases,
+                int16_t *in_q,
+                float *out, int32_t out_length)
+{
+    float in_max = 0.0f;
+    for (int i=0; i<in_length; i++) {
+        in_max = eml_max(in_max, fabsf(in[i]));
+    }
+    const float in_scale = (in_max > 0.0f) ? (in_max / 32767.0f) : 1.0f;
+    const float in_scale_inv = 1.0f / in_scale;
+    for (int i=0; i<in_length; i++) {
+        const float v = in[i] * in_scale_inv;
+        in_q[i] = (int16_t)((v >= 0.0f) ? (v + 0.5f) : (v - 0.5f));
+    }
+
+    // SMLALD instead of SMLAD: full-scale q15 products overflow a 32-bit sum within a few inputs
+    const int16_t *w = params->weights;
+    const int32_t n_pairs = in_length / 2;
+    int o = 0;
+    for (; o+1<out_length; o+=2) {
+        const int16_t *w0 = w + (o*in_length);
+        const int16_t *w1 = w0 + in_length;
+        int64_t acc0 = 0;
+        int64_t acc1 = 0;
+        for (int k=0; k<n_pairs; k++) {
+            const uint32_t x = eml_read_u32(in_q + 2*k);
+            acc0 = eml_smlald(eml_read_u32(w0 + 2*k), x, acc0);
+            acc1 = eml_smlald(eml_read_u32(w1 + 2*k), x, acc1);
+        }
+        if (in_length % 2) {
+            acc0 += (int32_t)w0[in_length-1] * (int32_t)in_q[in_length-1];
+            acc1 += (int32_t)w1[in_length-1] * (int32_t)in_q[in_length-1];
+        }
+        out[o] = ((float)acc0 * (params->scales[o] * in_scale)) + biases[o];
+        out[o+1] = ((float)acc1 * (params->scales[o+1] * in_scale)) + biases[o+1];
+    }
+    for (; o<out_length; o++) {
+        const int16_t *w0 = w + (o*in_length);
+        int64_t acc = 0;
+        for (int k=0; k<n_pairs; k++) {
+            acc = eml_smlald(eml_read_u32(w0 + 2*k), eml_read_u32(in_q + 2*k), acc);
+        }
+        if (in_length % 2) {
+            acc += (int32_t)w0[in_length-1] * (int32_t)in_q[in_length-1];
+        }
+        out[o] = ((float)acc * (params->scales[o] * in_scale)) + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief emlearn input-major layout, skipping inputs that are zero
+*
+* The indices of non-zero inputs are gathered into nonzero (in_length values, up to INT16_MAX inputs) first,
+* then only their weight rows weights[i*out_length ... i*out_length + out_length-1] are accumulated,
+* for 8 outputs at a time.
+* Zero inputs add nothing, so results equal eml_net_dense(). Pays off when most inputs
+* come out of a ReLU as exactly 0.
+*/
+static void
+eml_net_dense_sparse_input(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                int16_t *nonzero,
+                float *out, int32_t out_length)
+{
+    int32_t n_nonzero = 0;
+    for (int i=0; i<in_length; i++) {
+        if (in[i] != 0.0f) {
+            nonzero[n_nonzero++] = (int16_t)i;
+        }
+    }
+
+    // 8 outputs per pass, accumulated in registers over the non-zero inputs
+    int o = 0;
+    for (; o+8<=out_length; o+=8) {
+        float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float acc4 = 0.0f, acc5 = 0.0f, acc6 = 0.0f, acc7 = 0.0f;
+        for (int k=0; k<n_nonzero; k++) {
+            const int i = nonzero[k];
+            const float x = in[i];
+            const float *w = weights + (i*out_length) + o;
+            acc0 += w[0] * x;
+            acc1 += w[1] * x;
+            acc2 += w[2] * x;
+            acc3 += w[3] * x;
+            acc4 += w[4] * x;
+            acc5 += w[5] * x;
+            acc6 += w[6] * x;
+            acc7 += w[7] * x;
+        }
+        out[o+0] = acc0 + biases[o+0];
+        out[o+1] = acc1 + biases[o+1];
+        out[o+2] = acc2 + biases[o+2];
+        out[o+3] = acc3 + biases[o+3];
+        out[o+4] = acc4 + biases[o+4];
+        out[o+5] = acc5 + biases[o+5];
+        out[o+6] = acc6 + biases[o+6];
+        out[o+7] = acc7 + biases[o+7];
+    }
+    for (; o<out_length; o++) {
+        float sum = 0.0f;
+        for (int k=0; k<n_nonzero; k++) {
+            const int i = nonzero[k];
+            sum += weights[(i*out_length) + o] * in[i];
+        }
+        out[o] = sum + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief Output-blocked dense layer with half precision weights and biases
+*
+* Same layout and order of operations as eml_net_dense_blocked8,
+* with each weight expanded to float right after loading (without branches, so it vectorizes),
+* and the scale applied per output.
+*/
+static void
+eml_net_dense_float16(const float *in, int32_t in_length,
+                const EmlNetFloat16Weights *params,
+                float *out, int32_t out_length)
+{
+    const int32_t n_blocks = (out_length + 7) / 8;
+    const uint16_t *w = params->weights;
+
+    for (int b=0; b<n_blocks; b++) {
+        float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float acc4 = 0.0f, acc5 = 0.0f, acc6 = 0.0f, acc7 = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            const float x = in[i];
+            acc0 += eml_float16_finite_to_float(w[0]) * x;
+            acc1 += eml_float16_finite_to_float(w[1]) * x;
+            acc2 += eml_float16_finite_to_float(w[2]) * x;
+            acc3 += eml_float16_finite_to_float(w[3]) * x;
+            acc4 += eml_float16_finite_to_float(w[4]) * x;
+            acc5 += eml_float16_finite_to_float(w[5]) * x;
+            acc6 += eml_float16_finite_to_float(w[6]) * x;
+            acc7 += eml_float16_finite_to_float(w[7]) * x;
+            w += 8;
+        }
+
+        const float acc[8] = { acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7 };
+        const int o_start = b*8;
+        for (int k=0; k<8 && (o_start+k)<out_length; k++) {
+            out[o_start+k] = (acc[k] * params->scale) + eml_float16_to_float(params->biases[o_start+k]);
+        }
+    }
+}
+
+/*
+* \internal
+* \brief Dense layer with pruned weights in compressed sparse rows, see EmlNetCsrWeights
+*
+* Visits only the kept weights of each output. Two accumulators, even and odd entries,
+* to not stall on the multiply-add latency.
+*/
+static void
+eml_net_dense_csr(const float *in, int32_t in_length,
+                const EmlNetCsrWeights *params, const float *biases,
+                float *out, int32_t out_length)
+{
+    (void)in_length;
+    const float *values = params->values;
+    const uint16_t *columns = params->columns;
+
+    for (int o=0; o<out_length; o++) {
+        const int end = params->row_offsets[o+1];
+        int k = params->row_offsets[o];
+        float acc0 = 0.0f;
+        float acc1 = 0.0f;
+        for (; k+1<end; k+=2) {
+            acc0 += values[k] * in[columns[k]];
+            acc1 += values[k+1] * in[columns[k+1]];
+        }
+        if (k < end) {
+            acc0 += values[k] * in[columns[k]];
+        }
+        out[o] = (acc0 + acc1) + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief Dense layer with 4-bit codebook indices, see EmlNetCodebookWeights
+*
+* Decodes the two indices of each byte inside the multiply-add loop,
+* one accumulator for even and one for odd inputs.
+*/
+static void
+eml_net_dense_codebook(const float *in, int32_t in_length,
+                const EmlNetCodebookWeights *params, const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t n_pairs = in_length / 2;
+    const int32_t row_bytes = (in_length + 1) / 2;
+
+    for (int o=0; o<out_length; o++) {
+        const uint8_t *row = params->indices + (o * row_bytes);
+        const float *codebook = params->codebook + (params->per_output ? (o * 16) : 0);
+        float acc0 = 0.0f;
+        float acc1 = 0.0f;
+        for (int j=0; j<n_pairs; j++) {
+            const uint8_t b = row[j];
+            acc0 += codebook[b & 0x0F] * in[2*j];
+            acc1 += codebook[b >> 4] * in[(2*j)+1];
+        }
+        if (in_length % 2) {
+            acc0 += codebook[row[n_pairs] & 0x0F] * in[in_length-1];
+        }
+        out[o] = (acc0 + acc1) + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief Dense layer with binary or ternary weights and binarized inputs, see EmlNetBinaryWeights
+*
+* Packs the input signs into scratch, 32 per word, then for each output
+* dot = n - 2*popcount(w ^ x) for binary, or popcount(m) - 2*popcount(m & (w ^ x)) for ternary.
+* Padding bits past n_inputs are 0 in both weights and inputs, so they do not count.
+*/
+static void
+eml_net_dense_binary(const float *in, int32_t in_length,
+                const EmlNetBinaryWeights *params, const float *biases,
+                uint32_t *in_bits, float *out, int32_t out_length)
+{
+    const int32_t n_words = (in_length + 31) / 32;
+
+    for (int w=0; w<n_words; w++) {
+        uint32_t bits = 0;
+        const int i_start = w*32;
+        const int i_end = (i_start + 32 < in_length) ? (i_start + 32) : in_length;
+        for (int i=i_start; i<i_end; i++) {
+            const float threshold = params->thresholds ? params->thresholds[i] : 0.0f;
+            bits |= (uint32_t)(in[i] >= threshold) << (i - i_start);
+        }
+        in_bits[w] = bits;
+    }
+
+    const uint32_t *signs = params->signs;
+    const uint32_t *masks = params->masks;
+    for (int o=0; o<out_length; o++) {
+        int32_t dot;
+        if (masks) {
+            int32_t kept = 0;
+            int32_t differ = 0;
+            for (int w=0; w<n_words; w++) {
+                kept += eml_popcount32(masks[w]);
+                differ += eml_popcount32(masks[w] & (signs[w] ^ in_bits[w]));
+            }
+            dot = kept - (2 * differ);
+            masks += n_words;
+        } else {
+            int32_t differ = 0;
+            for (int w=0; w<n_words; w++) {
+                differ += eml_popcount32(signs[w] ^ in_bits[w]);
+            }
+            dot = in_length - (2 * differ);
+        }
+        signs += n_words;
+        out[o] = (params->scales[o] * (float)dot) + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief 1D convolution, channels-last, see EmlNetConv1DParams
+*
+* For each output step, accumulates all output channels on the stack, input-major like eml_net_dense,
+* then stores them. So in may equal out when eml_net_layer_in_place().
+*/
+static void
+eml_net_conv1d(const float *in, const EmlNetConv1DParams *params,
+                const float *weights, const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t in_channels = params->in_channels;
+    const int32_t out_channels = params->out_channels;
+    const int32_t n_steps = out_length / out_channels;
+    float acc[EML_NET_CONV_MAX_CHANNELS];
+
+    for (int t=0; t<n_steps; t++) {
+        for (int co=0; co<out_channels; co++) {
+            acc[co] = 0.0f;
+        }
+        for (int k=0; k<params->kernel_size; k++) {
+            const float *x = in + (((t * params->stride) + (k * params->dilation)) * in_channels);
+            const float *w = weights + (k * in_channels * out_channels);
+            for (int ci=0; ci<in_channels; ci++) {
+                const float v = x[ci];
+                for (int co=0; co<out_channels; co++) {
+                    acc[co] += w[(ci * out_channels) + co] * v;
+                }
+            }
+        }
+        float *o = out + (t * out_channels);
+        for (int co=0; co<out_channels; co++) {
+            o[co] = acc[co] + biases[co];
+        }
+    }
+}
+
+/*
+* \internal
+* \brief Depthwise 1D convolution, one filter per channel. Same order of stores as eml_net_conv1d
+*/
+static void
+eml_net_conv1d_depthwise(const float *in, const EmlNetConv1DParams *params,
+                const float *weights, const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t channels = params->out_channels;
+    const int32_t n_steps = out_length / channels;
+    float acc[EML_NET_CONV_MAX_CHANNELS];
+
+    for (int t=0; t<n_steps; t++) {
+        for (int c=0; c<channels; c++) {
+            acc[c] = 0.0f;
+        }
+        for (int k=0; k<params->kernel_size; k++) {
+            const float *x = in + (((t * params->stride) + (k * params->dilation)) * channels);
+            const float *w = weights + (k * channels);
+            for (int c=0; c<channels; c++) {
+                acc[c] += w[c] * x[c];
+            }
+        }
+        float *o = out + (t * channels);
+        for (int c=0; c<channels; c++) {
+            o[c] = acc[c] + biases[c];
+        }
+    }
+}
+
+/*
+* \internal
+* \brief Max or average pooling over time, per channel. Same order of stores as eml_net_conv1d
+*/
+static void
+eml_net_pool1d(const float *in, const EmlNetConv1DParams *params, bool average,
+                float *out, int32_t out_length)
+{
+    const int32_t channels = params->out_channels;
+    const int32_t n_steps = out_length / channels;
+    const float scale = 1.0f / (float)params->kernel_size;
+    float acc[EML_NET_CONV_MAX_CHANNELS];
+
+    for (int t=0; t<n_steps; t++) {
+        const float *first = in + (t * params->stride * channels);
+        for (int c=0; c<channels; c++) {
+            acc[c] = first[c];
+        }
+        for (int k=1; k<params->kernel_size; k++) {
+            const float *x = first + (k * params->dilation * channels);
+            for (int c=0; c<channels; c++) {
+                if (average) {
+                    acc[c] += x[c];
+                } else if (x[c] > acc[c]) {
+                    acc[c] = x[c];
+                }
+            }
+        }
+        float *o = out + (t * channels);
+        for (int c=0; c<channels; c++) {
+            o[c] = (average) ? (acc[c] * scale) : acc[c];
+        }
+    }
+}
+
+/*
+* \internal
+* \brief One step of a GRU, see EmlNetGruParams. Updates state (hidden long) in place
+*
+* gates must hold 6*hidden floats.
+*/
+static void
+eml_net_gru_update(const EmlNetGruParams *params, int32_t hidden,
+                const float *x, float *state, float *gates)
+{
+    float *gx = gates;
+    float *gh = gates + (3 * hidden);
+    eml_net_dense(x, params->n_features, params->input_weights, params->input_biases, gx, 3 * hidden);
+    eml_net_dense(state, hidden, params->recurrent_weights, params->recurrent_biases, gh, 3 * hidden);
+
+    for (int j=0; j<hidden; j++) {
+        const float z = eml_net_expit(gx[j] + gh[j]);
+        const float r = eml_net_expit(gx[hidden+j] + gh[hidden+j]);
+        const float n = eml_net_tanh(gx[(2*hidden)+j] + (r * gh[(2*hidden)+j]));
+        state[j] = ((1.0f - z) * n) + (z * state[j]);
+    }
+}
+
+/*
+* \internal
+* \brief GRU over a whole sequence from a zero state. out (hidden long) gets the last state
+*/
+static void
+eml_net_gru(const float *in, int32_t in_length, const EmlNetGruParams *params,
+                float *gates, float *out, int32_t out_length)
+{
+    const int32_t n_steps = in_length / params->n_features;
+    for (int j=0; j<out_length; j++) {
+        out[j] = 0.0f;
+    }
+    for (int t=0; t<n_steps; t++) {
+        eml_net_gru_update(params, out_length, in + (t * params->n_features), out, gates);
+    }
+}
+
+#if EML_NET_X86
+#include "eml_net_x86.h"
+#endif
+
+/*
+* \internal
+* \brief Check that a layer has the weights its type needs, and a known activation
+*
+* For csr layers also that every row offset and column is in range, in time linear in the kept weights.
+*/
+static EmlError
+eml_net_layer_check(const EmlNetLayer *layer)
+{
+    EML_PRECONDITION(layer->n_inputs > 0 && layer->n_outputs > 0, EmlSizeMismatch);
+    const bool pooling = layer->type == EmlNetLayerMaxPool1D || layer->type == EmlNetLayerAvgPool1D;
+    const bool own_biases = layer->type == EmlNetLayerDenseFloat16 || layer->type == EmlNetLayerGru;
+    EML_PRECONDITION(layer->biases || own_biases || pooling, EmlUninitialized);
+    EML_PRECONDITION((int)layer->activation >= 0 && layer->activation < EmlNetActivationFunctions, EmlUnsupported);
+
+    switch (layer->type) {
+    case EmlNetLayerDense:
+    case EmlNetLayerDenseBlocked4:
+    case EmlNetLayerDenseBlocked8:
+        EML_PRECONDITION(layer->weights, EmlUninitialized);
+        break;
+    case EmlNetLayerDenseSparseInput:
+        EML_PRECONDITION(layer->weights, EmlUninitialized);
+        // Indices of the non-zero inputs are gathered as int16
+        EML_PRECONDITION(layer->n_inputs <= INT16_MAX, EmlUnsupported);
+        break;
+    case EmlNetLayerDenseInt8: {
+        const EmlNetInt8Weights *int8 = (const EmlNetInt8Weights *)layer->params;
+        EML_PRECONDITION(int8 && int8->weights && int8->scales, EmlUninitialized);
+        break;
+    }
+    case EmlNetLayerDenseQ15: {
+        const EmlNetQ15Weights *q15 = (const EmlNetQ15Weights *)layer->params;
+        EML_PRECONDITION(q15 && q15->weights && q15->scales, EmlUninitialized);
+        break;
+    }
+    case EmlNetLayerDenseFloat16: {
+        const EmlNetFloat16Weights *float16 = (const EmlNetFloat16Weights *)layer->params;
+        EML_PRECONDITION(float16 && float16->weights && float16->biases, EmlUninitialized);
+        break;
+    }
+    case EmlNetLayerDenseCodebook: {
+        const EmlNetCodebookWeights *codebook = (const EmlNetCodebookWeights *)layer->params;
+        EML_PRECONDITION(codebook && codebook->indices && codebook->codebook, EmlUninitialized);
+        break;
+    }
+    case EmlNetLayerDenseBinary: {
+        const EmlNetBinaryWeights *binary = (const EmlNetBinaryWeights *)layer->params;
+        EML_PRECONDITION(binary && binary->signs && binary->scales, EmlUninitialized);
+        break;
+    }
+    case EmlNetLayerGru: {
+        const EmlNetGruParams *gru = (const EmlNetGruParams *)layer->params;
+        EML_PRECONDITION(gru && gru->input_weights && gru->recurrent_weights, EmlUninitialized);
+        EML_PRECONDITION(gru->input_biases && gru->recurrent_biases, EmlUninitialized);
+        EML_PRECONDITION(gru->n_features > 0 && (layer->n_inputs % gru->n_features) == 0, EmlSizeMismatch);
+        break;
+    }
+    case EmlNetLayerConv1D:
+    case EmlNetLayerConv1DDepthwise:
+    case EmlNetLayerMaxPool1D:
+    case EmlNetLayerAvgPool1D: {
+        const EmlNetConv1DParams *conv = (const EmlNetConv1DParams *)layer->params;
+        EML_PRECONDITION(conv, EmlUninitialized);
+        EML_PRECONDITION(pooling || layer->weights, EmlUninitialized);
+        EML_PRECONDITION(conv->in_channels > 0 && conv->out_channels > 0, EmlSizeMismatch);
+        EML_PRECONDITION(conv->out_channels <= EML_NET_CONV_MAX_CHANNELS, EmlUnsupported);
+        EML_PRECONDITION(conv->kernel_size > 0 && conv->stride > 0 && conv->dilation > 0, EmlUnsupported);
+        EML_PRECONDITION(layer->type == EmlNetLayerConv1D || conv->out_channels == conv->in_channels, EmlSizeMismatch);
+        EML_PRECONDITION((layer->n_inputs % conv->in_channels) == 0, EmlSizeMismatch);
+        const int32_t span = (conv->dilation * (conv->kernel_size - 1)) + 1;
+        const int32_t in_steps = layer->n_inputs / conv->in_channels;
+        EML_PRECONDITION(in_steps >= span, EmlSizeMismatch);
+        const int32_t out_steps = ((in_steps - span) / conv->stride) + 1;
+        EML_PRECONDITION(layer->n_outputs == out_steps * conv->out_channels, EmlSizeMismatch);
+        break;
+    }
+    case EmlNetLayerDenseCsr: {
+        const EmlNetCsrWeights *csr = (const EmlNetCsrWeights *)layer->params;
+        EML_PRECONDITION(csr && csr->row_offsets, EmlUninitialized);
+        EML_PRECONDITION(csr->n_values == 0 || (csr->values && csr->columns), EmlUninitialized);
+        // The kernel reads values and columns at every offset, and inputs at every column
+        EML_PRECONDITION(csr->row_offsets[0] == 0, EmlSizeMismatch);
+        EML_PRECONDITION(csr->row_offsets[layer->n_outputs] == csr->n_values, EmlSizeMismatch);
+        for (int32_t o = 0; o < layer->n_outputs; o++) {
+            EML_PRECONDITION(csr->row_offsets[o] <= csr->row_offsets[o+1], EmlSizeMismatch);
+        }
+        for (int32_t k = 0; k < csr->n_values; k++) {
+            EML_PRECONDITION(csr->columns[k] < layer->n_inputs, EmlSizeMismatch);
+        }
+        break;
+    }
+    default:
+        return EmlUnsupported;
+    }
+    return EmlOk;
+}
+
+/*
+* \internal
+* \brief Run a single layer up to (not including) the activation function, without checking arguments
+*
+* Used after the layer was validated by eml_net_layer_forward_scratch() or eml_net_check().
+* out must hold layer->n_outputs values, scratch eml_net_layer_scratch_size() bytes.
+*/
+static EmlError
+eml_net_layer_linear(const EmlNetLayer *layer, const float *in, float *out, void *scratch)
+{
+#if EML_NET_X86
+    const EmlNetX86Kernels *kernels = eml_net_x86_kernels();
+    const EmlNetDenseKernel dense = kernels->dense;
+    const EmlNetDenseKernel dense_blocked4 = kernels->dense_blocked4;
+    const EmlNetDenseKernel dense_blocked8 = kernels->dense_blocked8;
+#else
+    // Constant, so these become direct calls
+    const EmlNetDenseKernel dense = eml_net_dense;
+    const EmlNetDenseKernel dense_blocked4 = eml_net_dense_blocked4;
+    const EmlNetDenseKernel dense_blocked8 = eml_net_dense_blocked8;
+#endif
+
+    switch (layer->type) {
+    case EmlNetLayerDense:
+        dense(in, layer->n_inputs,
+            layer->weights, layer->biases, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseBlocked4:
+        dense_blocked4(in, layer->n_inputs,
+            layer->weights, layer->biases, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseBlocked8:
+        dense_blocked8(in, layer->n_inputs,
+            layer->weights, layer->biases, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseInt8:
+        eml_net_dense_int8(in, layer->n_inputs,
+            (const EmlNetInt8Weights *)layer->params, layer->biases,
+            (int8_t *)scratch, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseQ15:
+        eml_net_dense_q15(in, layer->n_inputs,
+            (const EmlNetQ15Weights *)layer->params, layer->biases,
+            (int16_t *)scratch, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseSparseInput:
+        eml_net_dense_sparse_input(in, layer->n_inputs,
+            layer->weights, layer->biases,
+            (int16_t *)scratch, out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseFloat16:
+        eml_net_dense_float16(in, layer->n_inputs,
+            (const EmlNetFloat16Weights *)layer->params,
+            out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseCsr:
+        eml_net_dense_csr(in, layer->n_inputs,
+            (const EmlNetCsrWeights *)layer->params, layer->biases,
+            out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseCodebook:
+        eml_net_dense_codebook(in, layer->n_inputs,
+            (const EmlNetCodebookWeights *)layer->params, layer->biases,
+            out, layer->n_outputs);
+        break;
+    case EmlNetLayerDenseBinary:
+        eml_net_dense_binary(in, layer->n_inputs,
+            (const EmlNetBinaryWeights *)layer->params, layer->biases,
+            (uint32_t *)scratch, out, layer->n_outputs);
+        break;
+    case EmlNetLayerConv1D:
+        eml_net_conv1d(in, (const EmlNetConv1DParams *)layer->params,
+            layer->weights, layer->biases, out, layer->n_outputs);
+        break;
+    case EmlNetLayerConv1DDepthwise:
+        eml_net_conv1d_depthwise(in, (const EmlNetConv1DParams *)layer->params,
+            layer->weights, layer->biases, out, layer->n_outputs);
+        break;
+    case EmlNetLayerMaxPool1D:
+    case EmlNetLayerAvgPool1D:
+        eml_net_pool1d(in, (const EmlNetConv1DParams *)layer->params,
+            layer->type == EmlNetLayerAvgPool1D, out, layer->n_outputs);
+        break;
+    case EmlNetLayerGru:
+        eml_net_gru(in, layer->n_inputs, (const EmlNetGruParams *)layer->params,
+            (float *)scratch, out, layer->n_outputs);
+        break;
+    default:
+        return EmlUnsupported;
+    }
+
+    return EmlOk;
+}
+
+/*
+* \internal
+* \brief Run a single layer, without checking arguments. See eml_net_layer_linear()
+*/
+static EmlError
+eml_net_layer_compute(const EmlNetLayer *layer, const float *in, float *out, void *scratch)
+{
+    EML_CHECK_ERROR(eml_net_layer_linear(layer, in, out, scratch));
+    return eml_net_activate(out, layer->n_outputs, layer->activation);
+}
+
+/**
+* \brief Multiply-adds of one call of a layer
+*
+* Weights times inputs for dense layers, kept weights for csr layers, 32-input words for binary layers.
+* Sparse input layers count as dense, the zero inputs they skip vary per call.
+* Pooling counts one operation per kernel tap. Activation functions are not counted.
+*/
+static inline int64_t
+eml_net_layer_macs(const EmlNetLayer *layer)
+{
+    const int64_t dense = (int64_t)layer->n_inputs * layer->n_outputs;
+    switch (layer->type) {
+    case EmlNetLayerDenseCsr: {
+        const EmlNetCsrWeights *csr = (const EmlNetCsrWeights *)layer->params;
+        return csr->row_offsets[layer->n_outputs];
+    }
+    case EmlNetLayerDenseBinary:
+        return (int64_t)((layer->n_inputs + 31) / 32) * layer->n_outputs;
+    case EmlNetLayerConv1D: {
+        const EmlNetConv1DParams *conv = (const EmlNetConv1DParams *)layer->params;
+        return (int64_t)layer->n_outputs * conv->kernel_size * conv->in_channels;
+    }
+    case EmlNetLayerConv1DDepthwise:
+    case EmlNetLayerMaxPool1D:
+    case EmlNetLayerAvgPool1D: {
+        const EmlNetConv1DParams *conv = (const EmlNetConv1DParams *)layer->params;
+        return (int64_t)layer->n_outputs * conv->kernel_size;
+    }
+    case EmlNetLayerGru: {
+        // Input and recurrent projections of the 3 gates, per step
+        const EmlNetGruParams *gru = (const EmlNetGruParams *)layer->params;
+        const int64_t steps = layer->n_inputs / gru->n_features;
+        return steps * 3 * layer->n_outputs * (gru->n_features + layer->n_outputs);
+    }
+    default:
+        return dense;
+    }
+}
+
+/*
+* \internal
+* \brief Counts of layer l of a model, or NULL when it records no profile
+*/
+static inline EmlNetLayerProfile *
+eml_net_profile_layer(const EmlNet *model, int32_t l)
+{
+#if EML_NET_PROFILE
+    EmlNetProfile *profile = model->profile;
+    if (!profile || l >= EML_NET_PROFILE_MAX_LAYERS) {
+        return NULL;
+    }
+    if (l >= profile->n_layers) {
+        profile->n_layers = l + 1;
+    }
+    return &profile->layers[l];
+#else
+    (void)model;
+    (void)l;
+    return NULL;
+#endif
+}
+
+/*
+* \internal
+* \brief eml_net_layer_compute(), or only eml_net_layer_linear() when activate is false.
+* Adds its cycles and multiply-adds to profile, when built with EML_NET_PROFILE and profile is not NULL
+*/
+static EmlError
+eml_net_layer_run(const EmlNetLayer *layer, const float *in, float *out, void *scratch,
+                    bool activate, EmlNetLayerProfile *profile)
+{
+#if EML_NET_PROFILE
+    if (profile) {
+        const uint32_t start = EML_NET_PROFILE_CYCLES();
+        EmlError err = eml_net_layer_linear(layer, in, out, scratch);
+        const uint32_t linear_end = EML_NET_PROFILE_CYCLES();
+        if (err == EmlOk && activate) {
+            err = eml_net_activate(out, layer->n_outputs, layer->activation);
+        }
+        const uint32_t end = EML_NET_PROFILE_CYCLES();
+
+        // Differences of the 32-bit counter are right across one wrap around
+        profile->calls += 1;
+        profile->linear_cycles += (uint32_t)(linear_end - start);
+        profile->activation_cycles += (uint32_t)(end - linear_end);
+        profile->macs += (uint64_t)eml_net_layer_macs(layer);
+        return err;
+    }
+#else
+    (void)profile;
+#endif
+    if (!activate) {
+        return eml_net_layer_linear(layer, in, out, scratch);
+    }
+    return eml_net_layer_compute(layer, in, out, scratch);
+}
+
+/*
+* \internal
+* \brief Add one inference, started at cycle count start, to the profile of a model
+*/
+static inline void
+eml_net_profile_inference(const EmlNet *model, uint32_t start)
+{
+#if EML_NET_PROFILE
+    if (model->profile) {
+        model->profile->inferences += 1;
+        model->profile->total_cycles += (uint32_t)(EML_NET_PROFILE_CYCLES() - start);
+    }
+#else
+    (void)model;
+    (void)start;
+#endif
+}
+
+#if EML_NET_PROFILE
+#define EML_NET_PROFILE_START() EML_NET_PROFILE_CYCLES()
+#else
+#define EML_NET_PROFILE_START() 0U
+#endif
+
+/**
+* \brief Like eml_net_layer_forward_scratch(), and add the cycles and multiply-adds of the call to profile
+*
+* profile may be NULL. Nothing is recorded unless built with EML_NET_PROFILE
+*/
+static inline EmlError
+eml_net_layer_forward_profile(const EmlNetLayer *layer,
+                    const float *in, int32_t in_length,
+                    float *out, int32_t out_length,
+                    void *scratch, int32_t scratch_length,
+                    EmlNetLayerProfile *profile)
+{
+    EML_PRECONDITION(in_length >= layer->n_inputs, EmlSizeMismatch);
+    EML_PRECONDITION(out_length >= layer->n_outputs, EmlSizeMismatch);
+    EML_PRECONDITION(scratch_length >= eml_net_layer_scratch_size(layer), EmlSizeMismatch);
+    EML_CHECK_ERROR(eml_net_layer_check(layer));
+
+    return eml_net_layer_run(layer, in, out, scratch, true, profile);
+}
+
+/**
+* \brief Run inference for a single layer, with scratch memory for quantized layers
+*
+* \param layer Layer to run
+* \param in Input values
+* \param in_length Length of input
+* \param out Buffer to store output
 * \param out_length Length of output buffer
+* \param scratch Scratch memory, at least eml_net_layer_scratch_size() bytes. May be NULL for float layers
+* \param scratch_length Length of scratch memory, in bytes
 *
 * \return EmlOk on success, or error on failure
 */
-EmlError
+static inline EmlError
+eml_net_layer_forward_scratch(const EmlNetLayer *layer,
+                    const float *in, int32_t in_length,
+                    float *out, int32_t out_length,
+                    void *scratch, int32_t scratch_length)
+{
+    return eml_net_layer_forward_profile(layer, in, in_length, out, out_length,
+                    scratch, scratch_length, NULL);
+}
+
+// Inference for a single layer, without scratch memory. Only for float layers
+static inline EmlError
+eml_net_layer_forward(const EmlNetLayer *layer,
+                    const float *in, int32_t in_length,
+                    float *out, int32_t out_length)
+{
+    return eml_net_layer_forward_scratch(layer, in, in_length, out, out_length, NULL, 0);
+}
+
+/**
+* \brief Streaming GRU. Update the state of an EmlNetLayerGru layer with one step of inputs
+*
+* Running every step of a sequence from a zero state gives the same state as the layer
+* does on the whole sequence. Then the remaining layers can run on the state,
+* see eml_net_predict_logits_from_unchecked().
+*
+* \param layer Layer of type EmlNetLayerGru
+* \param sample Inputs of one step, n_features long (see EmlNetGruParams)
+* \param state Hidden state, layer->n_outputs long. Set to zero at the start of a sequence
+* \param scratch Memory of eml_net_layer_scratch_size() bytes, aligned for float
+* \param scratch_length Length of scratch, in bytes
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
+eml_net_gru_step(const EmlNetLayer *layer, const float *sample, float *state,
+                    void *scratch, int32_t scratch_length)
+{
+    EML_PRECONDITION(layer->type == EmlNetLayerGru, EmlUnsupported);
+    EML_PRECONDITION(sample && state && scratch, EmlUninitialized);
+    EML_PRECONDITION(scratch_length >= eml_net_layer_scratch_size(layer), EmlSizeMismatch);
+    EML_CHECK_ERROR(eml_net_layer_check(layer));
+
+    eml_net_gru_update((const EmlNetGruParams *)layer->params, layer->n_outputs,
+        sample, state, (float *)scratch);
+    return EmlOk;
+}
+
+/**
+* \brief Add the contribution of some inputs to the outputs of a float dense layer, for inputs that arrive over time
+*
+* acc[o] += sum_k values[k] * w[offset+k][o], without biases or activation.
+* Start acc at the biases, add each block of inputs once it is final, then apply the activation
+* with eml_net_layer_activate() and run the remaining layers with eml_net_predict_logits_from_unchecked().
+* The sum of all blocks equals the layer on the whole input, up to float rounding.
+*
+* \param layer Layer of type EmlNetLayerDense, EmlNetLayerDenseSparseInput, EmlNetLayerDenseBlocked4 or EmlNetLayerDenseBlocked8
+* \param offset Index of the first input in values
+* \param values Inputs offset..offset+n_values-1
+* \param n_values Number of inputs
+* \param acc Outputs, layer->n_outputs long
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
+eml_net_dense_accumulate(const EmlNetLayer *layer, int32_t offset,
+                    const float *values, int32_t n_values, float *acc)
+{
+    EML_PRECONDITION(layer->weights && values && acc, EmlUninitialized);
+    EML_PRECONDITION(offset >= 0 && n_values >= 0 && offset + n_values <= layer->n_inputs, EmlSizeMismatch);
+
+    const int32_t n_outputs = layer->n_outputs;
+    switch (layer->type) {
+    case EmlNetLayerDense:
+    case EmlNetLayerDenseSparseInput:
+        for (int32_t k = 0; k < n_values; k++) {
+            const float x = values[k];
+            const float *w = layer->weights + ((offset + k) * n_outputs);
+            for (int32_t o = 0; o < n_outputs; o++) {
+                acc[o] += x * w[o];
+            }
+        }
+        break;
+    case EmlNetLayerDenseBlocked4:
+    case EmlNetLayerDenseBlocked8: {
+        // Block b holds w[i][b*block + j] at ((b*n_inputs) + i)*block + j, outputs padded to whole blocks
+        const int32_t block = (layer->type == EmlNetLayerDenseBlocked4) ? 4 : 8;
+        for (int32_t o_start = 0; o_start < n_outputs; o_start += block) {
+            const int32_t n = (n_outputs - o_start < block) ? (n_outputs - o_start) : block;
+            const float *w = layer->weights + (((o_start / block) * layer->n_inputs) + offset) * block;
+            for (int32_t k = 0; k < n_values; k++) {
+                const float x = values[k];
+                for (int32_t j = 0; j < n; j++) {
+                    acc[o_start + j] += x * w[(k * block) + j];
+                }
+            }
+        }
+        break;
+    }
+    default:
+        return EmlUnsupported;
+    }
+    return EmlOk;
+}
+
+/**
+* \brief Apply the activation function of layer to its n_outputs values, in place
+*/
+static inline EmlError
+eml_net_layer_activate(const EmlNetLayer *layer, float *values)
+{
+    return eml_net_activate(values, layer->n_outputs, layer->activation);
+}
+
+
+/*
+* \internal
+* \brief Run inference
+* 
+* Used internally by eml_net_predict et.c.
+* NOTE: Leaves results in activations2
+*/
+static inline EmlError
+eml_net_infer(EmlNet *model, const float *features, int32_t features_length)
+{
+    const uint32_t profile_start = EML_NET_PROFILE_START();
+    EML_PRECONDITION(eml_net_valid(model), EmlUninitialized);
+    EML_PRECONDITION(model->n_layers >= 2, EmlUnsupported);
+    EML_PRECONDITION(features_length == model->layers[0].n_inputs, EmlSizeMismatch);
+    EML_PRECONDITION(eml_net_buffers_fit(model), EmlSizeMismatch);
+    EML_PRECONDITION(model->scratch_length >= eml_net_find_scratch_size(model), EmlSizeMismatch);
+
+    const float *in = features;
+    int32_t in_length = features_length;
+    int buffer = eml_net_first_buffer(model);
+
+    for (int l=0; l<model->n_layers; l++) {
+        // Alternate between the two buffers instead of copying, or stay for in-place layers.
+        // The output layer ends up in activations2
+        if (l > 0) {
+            buffer = eml_net_next_buffer(&model->layers[l], buffer);
+        }
+        float *out = (buffer == 2) ? model->activations2 : model->activations1;
+        const int32_t out_length = (buffer == 2) ? eml_net_activations2_length(model) : model->activations_length;
+
+        EML_CHECK_ERROR(eml_net_layer_forward_profile(&model->layers[l],
+                        in, in_length, out, out_length,
+                        model->scratch, model->scratch_length,
+                        eml_net_profile_layer(model, l)));
+        in = out;
+        in_length = out_length;
+    }
+
+    eml_net_profile_inference(model, profile_start);
+    return EmlOk;
+}
+
+/**
+* \brief Run inference and return probabilities. Sum of outputs must be approx. 1.
+*
+* \param model EmlNet instance
+* \param features Input data values
+* \param features_length Length of input data
+* \param out Buffer to store output
+* \param out_length Length of output buffer
+*
+* \return EmlOk on success, else an error
+*/
+static inline EmlError
+eml_net_predict_proba(EmlNet *model, const float *features, int32_t features_length,
+                                  float *out, int32_t out_length)
+{
+    EML_PRECONDITION(eml_net_valid(model), EmlUninitialized);
+    EML_PRECONDITION(features, EmlUninitialized);
+    EML_PRECONDITION(out, EmlUninitialized);
+    const int32_t n_outputs = eml_net_outputs_proba(model);
+    EML_PRECONDITION(out_length == n_outputs, EmlSizeMismatch);
+
+    EML_CHECK_ERROR(eml_net_infer(model, features, features_length));
+
+    float proba_sum = 0.0f;
+
+    if (n_outputs == 2) {
+        out[1] = model->activations2[0];
+        out[0] = 1.0f - out[1];
+        proba_sum = out[0] + out[1];
+    } else {
+        for (int i=0; i<n_outputs; i++) {
+            const float p = model->activations2[i];
+            out[i] = p;
+            proba_sum += p; 
+        }
+    }
+
+    EML_POSTCONDITION(fabsf(proba_sum - 1.0f) < 0.001f, EmlPostconditionFailed);
+
+    return EmlOk;
+}
+
+
+/**
+* \brief Run inference and return most probable class
+*
+* \param model EmlNet instance
+* \param features Input data values
+* \param features_length Length of input data
+*
+* \return The class number, or -EmlError on failure
+*/
+static inline int32_t
+eml_net_predict(EmlNet *model, const float *features, int32_t features_length) {
+
+    const EmlError error = eml_net_infer(model, features, features_length);
+    if (error != EmlOk) {
+        return -error;
+    }
+
+    const int32_t n_outputs = eml_net_outputs(model);
+
+    int32_t _class = -EmlUnknownError;
+    if (n_outputs == 1) {
+        _class = (model->activations2[0] > 0.5f) ? 1 : 0;
+    } else if (n_outputs > 1) {
+        _class = eml_net_argmax(model->activations2, n_outputs);
+    }
+
+    return _class;
+}
+
+/**
+* \brief Run inference and return the predicted float array (last layer).
+*
+* \param model EmlNet instance
+* \param features Input data values
+* \param features_length Length of input data
+* \param out Buffer to store output
+* \param out_length Length of output buffer
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
 eml_net_regress(EmlNet *model, const float *features, int32_t features_length, float *out, int32_t out_length)
 {
     EML_PRECONDITION(out, EmlUninitialized);
@@ -387,7 +1746,7 @@ eml_net_regress(EmlNet *model, const float *features, int32_t features_length, f
  *
  * \return The output value on success, or NAN on failure
  */
-float
+static inline float
 eml_net_regress1(EmlNet *model, const float *features, int32_t features_length)
 {
     float out[1];
@@ -399,6 +1758,276 @@ eml_net_regress1(EmlNet *model, const float *features, int32_t features_length)
     return out[0];
 }
 
+/**
+* \brief Reentrant eml_net_predict(), with caller-owned workspace
+*
+* model is not modified, so several threads can run it at the same time with separate workspaces.
+* \param workspace Memory of at least eml_net_workspace_size() bytes, aligned for float
+* \param workspace_length Length of workspace, in bytes
+*
+* \return The class number, or -EmlError on failure
+*/
+static inline int32_t
+eml_net_predict_workspace(const EmlNet *model, const float *features, int32_t features_length,
+                        void *workspace, int32_t workspace_length)
+{
+    EmlNet handle;
+    const EmlError error = eml_net_bind_workspace(model, workspace, workspace_length, &handle);
+    if (error != EmlOk) {
+        return -error;
+    }
+    return eml_net_predict(&handle, features, features_length);
+}
+
+/**
+* \brief Reentrant eml_net_predict_proba(), with caller-owned workspace
+*
+* \return EmlOk on success, else an error
+*/
+static inline EmlError
+eml_net_predict_proba_workspace(const EmlNet *model, const float *features, int32_t features_length,
+                        float *out, int32_t out_length,
+                        void *workspace, int32_t workspace_length)
+{
+    EmlNet handle;
+    EML_CHECK_ERROR(eml_net_bind_workspace(model, workspace, workspace_length, &handle));
+    return eml_net_predict_proba(&handle, features, features_length, out, out_length);
+}
+
+/**
+* \brief Reentrant eml_net_regress(), with caller-owned workspace
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
+eml_net_regress_workspace(const EmlNet *model, const float *features, int32_t features_length,
+                        float *out, int32_t out_length,
+                        void *workspace, int32_t workspace_length)
+{
+    EmlNet handle;
+    EML_CHECK_ERROR(eml_net_bind_workspace(model, workspace, workspace_length, &handle));
+    return eml_net_regress(&handle, features, features_length, out, out_length);
+}
+
+/**
+* \brief Validate model once, for the unchecked inference functions
+*
+* Checks everything eml_net_infer() checks on each call, and also that
+* the number of inputs of each layer matches the outputs of the previous.
+*
+* \param model EmlNet instance. Must not change while out is in use
+* \param out Handle to initialize
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
+eml_net_check(EmlNet *model, EmlNetChecked *out)
+{
+    EML_PRECONDITION(out, EmlUninitialized);
+    EML_PRECONDITION(eml_net_valid(model), EmlUninitialized);
+    EML_PRECONDITION(model->n_layers >= 2, EmlUnsupported);
+    EML_PRECONDITION(eml_net_buffers_fit(model), EmlSizeMismatch);
+    EML_PRECONDITION(model->scratch_length >= eml_net_find_scratch_size(model), EmlSizeMismatch);
+    EML_PRECONDITION(model->scratch || eml_net_find_scratch_size(model) == 0, EmlUninitialized);
+
+    for (int l=0; l<model->n_layers; l++) {
+        const EmlNetLayer *layer = &model->layers[l];
+        EML_CHECK_ERROR(eml_net_layer_check(layer));
+        if (l > 0) {
+            EML_PRECONDITION(layer->n_inputs == model->layers[l-1].n_outputs, EmlSizeMismatch);
+        }
+    }
+
+    out->model = model;
+    out->n_inputs = model->layers[0].n_inputs;
+    out->n_outputs = eml_net_outputs(model);
+    return EmlOk;
+}
+
+/**
+* \brief Run inference on a model validated by eml_net_check(), without any checks
+*
+* \param checked Handle from a successful eml_net_check()
+* \param features Input data values, checked->n_inputs long
+*
+* \return Outputs of the last layer, checked->n_outputs long. Valid until the next inference
+*/
+static inline const float *
+eml_net_infer_unchecked(const EmlNetChecked *checked, const float *features)
+{
+    const uint32_t profile_start = EML_NET_PROFILE_START();
+    EmlNet *model = checked->model;
+    const float *in = features;
+    int buffer = eml_net_first_buffer(model);
+
+    for (int l=0; l<model->n_layers; l++) {
+        // Same buffer order as eml_net_infer
+        if (l > 0) {
+            buffer = eml_net_next_buffer(&model->layers[l], buffer);
+        }
+        float *out = (buffer == 2) ? model->activations2 : model->activations1;
+
+        eml_net_layer_run(&model->layers[l], in, out, model->scratch, true, eml_net_profile_layer(model, l));
+        in = out;
+    }
+
+    eml_net_profile_inference(model, profile_start);
+    return model->activations2;
+}
+
+/*
+* \internal
+* \brief Run layers first..n_layers-1 on in, the input of layer first. Stops before the last activation
+*/
+static const float *
+eml_net_infer_logits_from(const EmlNetChecked *checked, int32_t first, const float *in)
+{
+    const uint32_t profile_start = EML_NET_PROFILE_START();
+    EmlNet *model = checked->model;
+    const int32_t last = model->n_layers - 1;
+    int buffer = eml_net_first_buffer(model);
+
+    for (int l=0; l<last; l++) {
+        // Same buffer order as eml_net_infer
+        if (l > 0) {
+            buffer = eml_net_next_buffer(&model->layers[l], buffer);
+        }
+        if (l < first) {
+            continue;
+        }
+        float *out = (buffer == 2) ? model->activations2 : model->activations1;
+
+        eml_net_layer_run(&model->layers[l], in, out, model->scratch, true, eml_net_profile_layer(model, l));
+        in = out;
+    }
+    eml_net_layer_run(&model->layers[last], in, model->activations2, model->scratch,
+                    false, eml_net_profile_layer(model, last));
+
+    eml_net_profile_inference(model, profile_start);
+    return model->activations2;
+}
+
+/**
+* \brief Like eml_net_infer_unchecked(), but stops before the activation function of the last layer
+*
+* For softmax outputs the largest logit is the most probable class,
+* so no exp/log is needed to classify.
+*
+* \return Outputs of the last layer before activation, checked->n_outputs long. Valid until the next inference
+*/
+static inline const float *
+eml_net_infer_logits_unchecked(const EmlNetChecked *checked, const float *features)
+{
+    return eml_net_infer_logits_from(checked, 0, features);
+}
+
+/**
+* \brief Index of the largest value, and how far it is ahead of the second largest
+*
+* \param margin If not NULL, set to values[best] - values[second best]. 0 for a single value
+*
+* \return Index of the largest value
+*/
+static int32_t
+eml_net_argmax_margin(const float *values, int32_t values_length, float *margin)
+{
+    int32_t best = 0;
+    float best_value = values[0];
+    float second_value = -INFINITY;
+    for (int32_t i=1; i<values_length; i++) {
+        if (values[i] > best_value) {
+            second_value = best_value;
+            best_value = values[i];
+            best = i;
+        } else if (values[i] > second_value) {
+            second_value = values[i];
+        }
+    }
+    if (margin) {
+        *margin = (values_length > 1) ? (best_value - second_value) : 0.0f;
+    }
+    return best;
+}
+
+/**
+* \brief Like eml_net_predict_logits_unchecked(), starting at layer first_layer
+*
+* For models whose first layers were already run incrementally, like a streaming GRU (eml_net_gru_step()).
+*
+* \param checked Handle from a successful eml_net_check()
+* \param first_layer Layer to start at, less than the number of layers
+* \param layer_input Input of that layer, its n_inputs long
+* \param logits Optional, gets the checked->n_outputs outputs before the last activation
+* \param margin Optional, gets the logit margin of the class over the runner-up
+*
+* \return Class index
+*/
+static inline int32_t
+eml_net_predict_logits_from_unchecked(const EmlNetChecked *checked, int32_t first_layer,
+                        const float *layer_input, float *logits, float *margin)
+{
+    const float *outputs = eml_net_infer_logits_from(checked, first_layer, layer_input);
+    if (logits) {
+        for (int i=0; i<checked->n_outputs; i++) {
+            logits[i] = outputs[i];
+        }
+    }
+    if (checked->n_outputs == 1) {
+        if (margin) {
+            *margin = fabsf(outputs[0]);
+        }
+        return (outputs[0] > 0.0f) ? 1 : 0;
+    }
+    return eml_net_argmax_margin(outputs, checked->n_outputs, margin);
+}
+
+/**
+* \brief Classify from logits, without computing the output activation. See eml_net_infer_logits_unchecked()
+*
+* For models with softmax output, or a single logistic output (class 1 when the logit is above 0).
+*
+* \param logits If not NULL, checked->n_outputs values to store the logits in
+* \param margin If not NULL, set to the logit margin of the chosen class over the runner-up
+*               (for a single logistic output: the absolute logit)
+*
+* \return The class number
+*/
+static inline int32_t
+eml_net_predict_logits_unchecked(const EmlNetChecked *checked, const float *features,
+                        float *logits, float *margin)
+{
+    return eml_net_predict_logits_from_unchecked(checked, 0, features, logits, margin);
+}
+
+/**
+* \brief Unchecked eml_net_predict(), see eml_net_infer_unchecked()
+*
+* \return The class number
+*/
+static inline int32_t
+eml_net_predict_unchecked(const EmlNetChecked *checked, const float *features)
+{
+    const float *outputs = eml_net_infer_unchecked(checked, features);
+    if (checked->n_outputs == 1) {
+        return (outputs[0] > 0.5f) ? 1 : 0;
+    }
+    return eml_net_argmax(outputs, checked->n_outputs);
+}
+
+/**
+* \brief Unchecked eml_net_regress(), see eml_net_infer_unchecked()
+*
+* \param out Buffer to store output, checked->n_outputs long
+*/
+static inline void
+eml_net_regress_unchecked(const EmlNetChecked *checked, const float *features, float *out)
+{
+    const float *outputs = eml_net_infer_unchecked(checked, features);
+    for (int i=0; i<checked->n_outputs; i++) {
+        out[i] = outputs[i];
+    }
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
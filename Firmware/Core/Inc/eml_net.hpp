@@ -0,0 +1,239 @@
+
+#ifndef EML_NET_HPP
+#define EML_NET_HPP
+
+/** @file eml_net.hpp
+* C++17 header-only MLP inference with the layer sizes as template parameters.
+*
+* The same dense layers and activations as EmlNetLayerDense in eml_net.h, but every loop bound
+* is a compile-time constant, so the compiler can unroll and vectorize for the exact model shape.
+* Weights use the emlearn input-major layout, and can live in constexpr arrays:
+*
+*     constexpr float w0[600*32] = { ... };
+*     constexpr eml::Sequential<
+*         eml::Dense<600, 32, EmlNetActivationRelu>,
+*         eml::Dense<32, 6, EmlNetActivationSoftmax>
+*     > model { { w0, b0 }, { w1, b1 } };
+*     const int32_t cls = model.predict_logits(features, logits, &margin);
+*
+* Outputs are bit-identical to eml_net_infer() with the portable C kernels:
+* each output sums its inputs in the same order.
+* eml_export.py writes models in this form with export_mlp_cpp().
+*/
+
+#include "eml_net.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+
+namespace eml {
+
+/**
+* \brief Apply an activation function in place, chosen at compile time. Same functions as eml_net_activate()
+*/
+template <EmlNetActivationFunction Act, int32_t Length>
+inline void
+activate(float *values)
+{
+    static_assert(Act == EmlNetActivationIdentity || Act == EmlNetActivationRelu
+        || Act == EmlNetActivationLogistic || Act == EmlNetActivationTanh
+        || Act == EmlNetActivationSoftmax, "Unsupported activation function");
+
+    if constexpr (Act == EmlNetActivationRelu) {
+        for (int32_t i = 0; i < Length; i++) {
+            values[i] = eml_net_relu(values[i]);
+        }
+    } else if constexpr (Act == EmlNetActivationLogistic) {
+        for (int32_t i = 0; i < Length; i++) {
+            values[i] = eml_net_expit(values[i]);
+        }
+    } else if constexpr (Act == EmlNetActivationTanh) {
+        for (int32_t i = 0; i < Length; i++) {
+            values[i] = eml_net_tanh(values[i]);
+        }
+    } else if constexpr (Act == EmlNetActivationSoftmax) {
+        eml_net_softmax(values, Length);
+    }
+}
+
+/**
+* \brief Fully connected layer with In inputs and Out outputs
+*
+* weights are input-major like EmlNetLayerDense: weights[i*Out + o] connects input i to output o.
+*/
+template <int32_t In, int32_t Out, EmlNetActivationFunction Act>
+struct Dense {
+    static_assert(In > 0 && Out > 0, "Layer sizes must be positive");
+
+    static constexpr int32_t n_inputs = In;
+    static constexpr int32_t n_outputs = Out;
+    static constexpr EmlNetActivationFunction activation = Act;
+
+    const float *weights; // In*Out
+    const float *biases;  // Out
+
+    /**
+    * \brief Multiply inputs by weights and add biases, no activation
+    *
+    * Accumulates all outputs per input, so the inner loop runs over Out contiguous weights.
+    * Each output still sums its inputs in order 0..In-1, like eml_net_dense().
+    */
+    void
+    linear(const float *in, float *out) const
+    {
+        float sums[Out] = {};
+        for (int32_t i = 0; i < In; i++) {
+            const float x = in[i];
+            const float *w = weights + (size_t)i * Out;
+            for (int32_t o = 0; o < Out; o++) {
+                sums[o] += w[o] * x;
+            }
+        }
+        for (int32_t o = 0; o < Out; o++) {
+            out[o] = sums[o] + biases[o];
+        }
+    }
+
+    void
+    forward(const float *in, float *out) const
+    {
+        linear(in, out);
+        activate<Act, Out>(out);
+    }
+};
+
+namespace detail {
+
+template <typename... Layers>
+struct MaxOutputs;
+
+template <typename Layer>
+struct MaxOutputs<Layer> {
+    static constexpr int32_t value = Layer::n_outputs;
+};
+
+template <typename Layer, typename... Rest>
+struct MaxOutputs<Layer, Rest...> {
+    static constexpr int32_t value = (Layer::n_outputs > MaxOutputs<Rest...>::value)
+        ? Layer::n_outputs : MaxOutputs<Rest...>::value;
+};
+
+template <typename... Layers>
+struct Chained : std::true_type {};
+
+template <typename A, typename B, typename... Rest>
+struct Chained<A, B, Rest...> {
+    static constexpr bool value = (A::n_outputs == B::n_inputs) && Chained<B, Rest...>::value;
+};
+
+} // namespace detail
+
+/**
+* \brief Layers applied in order. Each layer must take the outputs of the previous one
+*
+* Activations between layers go in two arrays on the stack, each as long as the widest layer output.
+* The object only holds the weight pointers, so a constexpr model can go in flash.
+*/
+template <typename... Layers>
+struct Sequential {
+    static_assert(sizeof...(Layers) > 0, "Model needs at least one layer");
+    static_assert(detail::Chained<Layers...>::value, "Layer inputs must match the previous layer outputs");
+
+    using First = std::tuple_element_t<0, std::tuple<Layers...>>;
+    using Last = std::tuple_element_t<sizeof...(Layers) - 1, std::tuple<Layers...>>;
+
+    static constexpr size_t n_layers = sizeof...(Layers);
+    static constexpr int32_t n_inputs = First::n_inputs;
+    static constexpr int32_t n_outputs = Last::n_outputs;
+    static constexpr int32_t buffer_length = detail::MaxOutputs<Layers...>::value;
+
+    std::tuple<Layers...> layers;
+
+    constexpr Sequential(Layers... l) : layers(l...) {}
+
+    /**
+    * \brief Outputs of the last layer, with its activation. Same as eml_net_infer()
+    */
+    void
+    forward(const float *features, float *out) const
+    {
+        float buffer1[buffer_length];
+        float buffer2[buffer_length];
+        run<0, true>(features, out, buffer1, buffer2);
+    }
+
+    /**
+    * \brief Outputs of the last layer before its activation. Same as eml_net_infer_logits_unchecked()
+    */
+    void
+    logits(const float *features, float *out) const
+    {
+        float buffer1[buffer_length];
+        float buffer2[buffer_length];
+        run<0, false>(features, out, buffer1, buffer2);
+    }
+
+    /**
+    * \brief Class from the logits, like eml_net_predict_logits_unchecked()
+    *
+    * \param logits Optional, gets the n_outputs outputs before the last activation
+    * \param margin Optional, gets the logit margin of the class over the runner-up
+    *               (for a single logistic output: the absolute logit)
+    */
+    int32_t
+    predict_logits(const float *features, float *logits = nullptr, float *margin = nullptr) const
+    {
+        float outputs[n_outputs];
+        this->logits(features, outputs);
+        if (logits) {
+            for (int32_t i = 0; i < n_outputs; i++) {
+                logits[i] = outputs[i];
+            }
+        }
+        if constexpr (n_outputs == 1) {
+            if (margin) {
+                *margin = fabsf(outputs[0]);
+            }
+            return (outputs[0] > 0.0f) ? 1 : 0;
+        } else {
+            return eml_net_argmax_margin(outputs, n_outputs, margin);
+        }
+    }
+
+    /**
+    * \brief Class with the highest output, like eml_net_predict()
+    */
+    int32_t
+    predict(const float *features) const
+    {
+        float outputs[n_outputs];
+        forward(features, outputs);
+        if constexpr (n_outputs == 1) {
+            return (outputs[0] > 0.5f) ? 1 : 0;
+        } else {
+            return eml_net_argmax(outputs, n_outputs);
+        }
+    }
+
+private:
+    template <size_t I, bool LastActivation>
+    void
+    run(const float *in, float *out, float *buffer, float *other) const
+    {
+        const auto &layer = std::get<I>(layers);
+        if constexpr (I + 1 == n_layers) {
+            layer.linear(in, out);
+            if constexpr (LastActivation) {
+                activate<Last::activation, n_outputs>(out);
+            }
+        } else {
+            layer.forward(in, buffer);
+            run<I + 1, LastActivation>(buffer, out, other, buffer);
+        }
+    }
+};
+
+} // namespace eml
+
+#endif // EML_NET_HPP
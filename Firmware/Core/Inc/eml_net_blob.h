@@ -0,0 +1,410 @@
+
+#ifndef EML_NET_BLOB_H
+#define EML_NET_BLOB_H
+
+/** @file eml_net_blob.h
+* Serialized EmlNet models, used in place: from a reserved flash sector, or an mmap'd file on the host.
+*
+* A blob holds the layers, weights, an optional StandardScaler and optional class names.
+* eml_net_blob_load() validates it and builds an EmlNet whose weights point into the blob, nothing is copied.
+* Only the layer table and the small per-layer parameter structs live in the EmlNetBlobModel.
+* Activations and scratch come from a caller workspace, see eml_net_blob_bind().
+*
+* Layout (version 1), little-endian, every array at an offset that is a multiple of EML_NET_BLOB_ALIGN:
+*   EmlNetBlobHeader (64 bytes)
+*   EmlNetBlobLayer (64 bytes) per layer
+*   arrays referenced by offset from the start of the blob
+* Layer types and activations are stored as their EmlNetLayerType and EmlNetActivationFunction values,
+* so those enums may only be appended to. home-made/eml_export.py writes blobs with export_mlp_blob().
+*/
+
+#include "eml_net.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EML_NET_BLOB_MAGIC 0x4E4C4D45U // "EMLN"
+#define EML_NET_BLOB_VERSION 1
+#define EML_NET_BLOB_ALIGN 16
+
+// Most layers of a loaded model
+#ifndef EML_NET_BLOB_MAX_LAYERS
+#define EML_NET_BLOB_MAX_LAYERS 8
+#endif
+
+/** @typedef EmlNetBlobHeader
+* \brief Start of a blob. Offsets are from the start of the blob, 0 for a missing part
+*/
+typedef struct _EmlNetBlobHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;    // sizeof(EmlNetBlobHeader), so later versions can append fields
+    uint32_t total_size;     // bytes, header included
+    uint32_t crc32;          // of bytes header_size..total_size, see eml_net_blob_crc32()
+    int32_t n_layers;
+    int32_t n_inputs;
+    int32_t n_outputs;
+    uint32_t layers;         // n_layers EmlNetBlobLayer
+    uint32_t scaler_mean;    // n_inputs float. Model inputs are (x - mean) / scale
+    uint32_t scaler_scale;   // n_inputs float
+    uint32_t class_names;    // n_outputs uint32 offsets of NUL-terminated names
+    uint32_t reserved[5];
+} EmlNetBlobHeader;
+
+/** @typedef EmlNetBlobLayer
+* \brief One layer. arrays and values hold the fields of its params struct, in struct order:
+*
+* - EmlNetLayerDenseInt8, EmlNetLayerDenseQ15: arrays weights, scales
+* - EmlNetLayerDenseFloat16: arrays weights, biases. values[0] is the float bits of scale
+* - EmlNetLayerDenseCsr: arrays values, columns, row_offsets. values[0] is n_values
+* - EmlNetLayerDenseCodebook: arrays indices, codebook. values[0] is per_output
+* - EmlNetLayerDenseBinary: arrays signs, masks, scales, thresholds
+* - Conv1D and pooling layers: values in_channels, out_channels, kernel_size, stride, dilation
+* - EmlNetLayerGru: arrays input_weights, recurrent_weights, input_biases, recurrent_biases. values[0] is n_features
+*/
+typedef struct _EmlNetBlobLayer {
+    int32_t type;
+    int32_t activation;
+    int32_t n_inputs;
+    int32_t n_outputs;
+    uint32_t weights;
+    uint32_t biases;
+    uint32_t arrays[4];
+    int32_t values[6];
+} EmlNetBlobLayer;
+
+// Parameters of one layer, pointing into the blob
+typedef union _EmlNetBlobParams {
+    EmlNetInt8Weights int8;
+    EmlNetQ15Weights q15;
+    EmlNetFloat16Weights float16;
+    EmlNetCsrWeights csr;
+    EmlNetCodebookWeights codebook;
+    EmlNetBinaryWeights binary;
+    EmlNetConv1DParams conv;
+    EmlNetGruParams gru;
+} EmlNetBlobParams;
+
+/** @typedef EmlNetBlobModel
+* \brief A model loaded from a blob. Valid as long as the blob is
+*/
+typedef struct _EmlNetBlobModel {
+    EmlNet net;
+    EmlNetLayer layers[EML_NET_BLOB_MAX_LAYERS];
+    EmlNetBlobParams params[EML_NET_BLOB_MAX_LAYERS];
+    const uint8_t *blob;
+    const float *scaler_mean;   // NULL when the blob has no scaler
+    const float *scaler_scale;
+    const uint32_t *class_names;
+} EmlNetBlobModel;
+
+/**
+* \brief CRC-32 (IEEE 802.3, as zlib.crc32), bitwise without a table
+*/
+static inline uint32_t
+eml_net_blob_crc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+/*
+* \internal
+* \brief Pointer to bytes at offset, or an error when they are not inside the blob or misaligned.
+* With optional, offset 0 gives NULL
+*/
+static EmlError
+eml_net_blob_array(const uint8_t *blob, uint32_t total_size, uint32_t offset, int64_t bytes,
+                    bool optional, const void **out)
+{
+    *out = NULL;
+    if (offset == 0 && optional) {
+        return EmlOk;
+    }
+    EML_PRECONDITION(offset != 0 && (offset % EML_NET_BLOB_ALIGN) == 0, EmlUninitialized);
+    EML_PRECONDITION(bytes >= 0 && (int64_t)offset + bytes <= (int64_t)total_size, EmlSizeMismatch);
+    *out = blob + offset;
+    return EmlOk;
+}
+
+/*
+* \internal
+* \brief Fill layer and params from a blob layer record, checking that its arrays fit in the blob
+*/
+static EmlError
+eml_net_blob_load_layer(const uint8_t *blob, uint32_t total_size, const EmlNetBlobLayer *rec,
+                    EmlNetLayer *layer, EmlNetBlobParams *params)
+{
+    EML_PRECONDITION(rec->type >= 0 && rec->type < EmlNetLayerTypes, EmlUnsupported);
+    EML_PRECONDITION(rec->activation >= 0 && rec->activation < EmlNetActivationFunctions, EmlUnsupported);
+    EML_PRECONDITION(rec->n_inputs > 0 && rec->n_outputs > 0, EmlSizeMismatch);
+
+    const int64_t n_in = rec->n_inputs;
+    const int64_t n_out = rec->n_outputs;
+    const int64_t f = (int64_t)sizeof(float);
+    const void *p[4] = { NULL, NULL, NULL, NULL };
+    const void *weights = NULL;
+    const void *biases = NULL;
+
+    memset(layer, 0, sizeof(*layer));
+    memset(params, 0, sizeof(*params));
+    layer->n_inputs = rec->n_inputs;
+    layer->n_outputs = rec->n_outputs;
+    layer->activation = (EmlNetActivationFunction)rec->activation;
+    layer->type = (EmlNetLayerType)rec->type;
+
+    switch (layer->type) {
+    case EmlNetLayerDense:
+    case EmlNetLayerDenseSparseInput:
+    case EmlNetLayerDenseBlocked4:
+    case EmlNetLayerDenseBlocked8: {
+        const int64_t block = (layer->type == EmlNetLayerDenseBlocked4) ? 4
+            : (layer->type == EmlNetLayerDenseBlocked8) ? 8 : 1;
+        const int64_t padded = ((n_out + block - 1) / block) * block;
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->weights, n_in * padded * f, false, &weights));
+        break;
+    }
+    case EmlNetLayerDenseInt8:
+    case EmlNetLayerDenseQ15: {
+        const int64_t size = (layer->type == EmlNetLayerDenseInt8) ? 1 : 2;
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], n_in * n_out * size, false, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], n_out * f, false, &p[1]));
+        if (layer->type == EmlNetLayerDenseInt8) {
+            params->int8.weights = (const int8_t *)p[0];
+            params->int8.scales = (const float *)p[1];
+        } else {
+            params->q15.weights = (const int16_t *)p[0];
+            params->q15.scales = (const float *)p[1];
+        }
+        break;
+    }
+    case EmlNetLayerDenseFloat16: {
+        const int64_t padded = ((n_out + 7) / 8) * 8;
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], n_in * padded * 2, false, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], n_out * 2, false, &p[1]));
+        params->float16.weights = (const uint16_t *)p[0];
+        params->float16.biases = (const uint16_t *)p[1];
+        memcpy(&params->float16.scale, &rec->values[0], sizeof(float));
+        break;
+    }
+    case EmlNetLayerDenseCsr: {
+        const int64_t kept = rec->values[0];
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[2], (n_out + 1) * 2, false, &p[2]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], kept * f, kept == 0, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], kept * 2, kept == 0, &p[1]));
+        params->csr.values = (const float *)p[0];
+        params->csr.columns = (const uint16_t *)p[1];
+        params->csr.row_offsets = (const uint16_t *)p[2];
+        params->csr.n_values = rec->values[0];
+        break;
+    }
+    case EmlNetLayerDenseCodebook: {
+        const int64_t entries = rec->values[0] ? 16 * n_out : 16;
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], n_out * ((n_in + 1) / 2), false, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], entries * f, false, &p[1]));
+        params->codebook.indices = (const uint8_t *)p[0];
+        params->codebook.codebook = (const float *)p[1];
+        params->codebook.per_output = rec->values[0];
+        break;
+    }
+    case EmlNetLayerDenseBinary: {
+        const int64_t words = n_out * ((n_in + 31) / 32);
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], words * 4, false, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], words * 4, true, &p[1]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[2], n_out * f, false, &p[2]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[3], n_in * f, true, &p[3]));
+        params->binary.signs = (const uint32_t *)p[0];
+        params->binary.masks = (const uint32_t *)p[1];
+        params->binary.scales = (const float *)p[2];
+        params->binary.thresholds = (const float *)p[3];
+        break;
+    }
+    case EmlNetLayerConv1D:
+    case EmlNetLayerConv1DDepthwise:
+    case EmlNetLayerMaxPool1D:
+    case EmlNetLayerAvgPool1D: {
+        EmlNetConv1DParams *conv = &params->conv;
+        conv->in_channels = rec->values[0];
+        conv->out_channels = rec->values[1];
+        conv->kernel_size = rec->values[2];
+        conv->stride = rec->values[3];
+        conv->dilation = rec->values[4];
+        EML_PRECONDITION(conv->in_channels > 0 && conv->out_channels > 0 && conv->kernel_size > 0, EmlSizeMismatch);
+        if (layer->type == EmlNetLayerConv1D || layer->type == EmlNetLayerConv1DDepthwise) {
+            const int64_t n_weights = (int64_t)conv->kernel_size * conv->in_channels
+                * ((layer->type == EmlNetLayerConv1D) ? conv->out_channels : 1);
+            EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->weights, n_weights * f, false, &weights));
+            EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->biases, conv->out_channels * f, false, &biases));
+        }
+        break;
+    }
+    case EmlNetLayerGru: {
+        EmlNetGruParams *gru = &params->gru;
+        gru->n_features = rec->values[0];
+        EML_PRECONDITION(gru->n_features > 0, EmlSizeMismatch);
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[0], gru->n_features * 3 * n_out * f, false, &p[0]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[1], n_out * 3 * n_out * f, false, &p[1]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[2], 3 * n_out * f, false, &p[2]));
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->arrays[3], 3 * n_out * f, false, &p[3]));
+        gru->input_weights = (const float *)p[0];
+        gru->recurrent_weights = (const float *)p[1];
+        gru->input_biases = (const float *)p[2];
+        gru->recurrent_biases = (const float *)p[3];
+        break;
+    }
+    default:
+        return EmlUnsupported;
+    }
+
+    // Dense and Conv1D biases per output channel, read above. Quantized and sparse layers per output
+    const bool own_biases = layer->type == EmlNetLayerDenseFloat16 || layer->type == EmlNetLayerGru
+        || layer->type == EmlNetLayerMaxPool1D || layer->type == EmlNetLayerAvgPool1D;
+    if (!biases && !own_biases) {
+        EML_CHECK_ERROR(eml_net_blob_array(blob, total_size, rec->biases, n_out * f, false, &biases));
+    }
+
+    layer->weights = (const float *)weights;
+    layer->biases = (const float *)biases;
+    const bool has_params = !(layer->type == EmlNetLayerDense || layer->type == EmlNetLayerDenseSparseInput
+        || layer->type == EmlNetLayerDenseBlocked4 || layer->type == EmlNetLayerDenseBlocked8);
+    layer->params = has_params ? params : NULL;
+    // Indices inside the arrays, like the row offsets and columns of csr layers
+    return eml_net_layer_check(layer);
+}
+
+/**
+* \brief Validate a blob and build a model that uses it in place
+*
+* Checks the header, version, size and CRC, that every array is inside the blob,
+* and each layer with eml_net_layer_check(), so indices stored in the blob stay in bounds.
+* The model has no activation buffers yet, see eml_net_blob_bind().
+*
+* \param blob Start of the blob, aligned to 4 bytes (like a flash sector, or an mmap'd file)
+* \param blob_length Bytes available at blob. May be more than the blob, like a whole flash sector
+* \param out Model to initialize
+*
+* \return EmlOk on success, or error on failure
+*/
+static inline EmlError
+eml_net_blob_load(const void *blob, int32_t blob_length, EmlNetBlobModel *out)
+{
+    EML_PRECONDITION(blob && out, EmlUninitialized);
+    EML_PRECONDITION(((uintptr_t)blob % sizeof(float)) == 0, EmlUnsupported);
+    EML_PRECONDITION(blob_length >= (int32_t)sizeof(EmlNetBlobHeader), EmlSizeMismatch);
+
+    const uint8_t *bytes = (const uint8_t *)blob;
+    const EmlNetBlobHeader *header = (const EmlNetBlobHeader *)blob;
+    EML_PRECONDITION(header->magic == EML_NET_BLOB_MAGIC, EmlUninitialized);
+    EML_PRECONDITION(header->version == EML_NET_BLOB_VERSION, EmlUnsupported);
+    EML_PRECONDITION(header->header_size >= sizeof(EmlNetBlobHeader), EmlUnsupported);
+    EML_PRECONDITION(header->total_size >= header->header_size
+        && header->total_size <= (uint32_t)blob_length, EmlSizeMismatch);
+    EML_PRECONDITION(eml_net_blob_crc32(bytes + header->header_size, header->total_size - header->header_size)
+        == header->crc32, EmlPostconditionFailed);
+    EML_PRECONDITION(header->n_layers >= 1 && header->n_layers <= EML_NET_BLOB_MAX_LAYERS, EmlUnsupported);
+    EML_PRECONDITION(header->n_inputs > 0 && header->n_outputs > 0, EmlSizeMismatch);
+
+    const uint32_t total = header->total_size;
+    const void *p = NULL;
+    memset(out, 0, sizeof(*out));
+    out->blob = bytes;
+
+    EML_CHECK_ERROR(eml_net_blob_array(bytes, total, header->layers,
+        (int64_t)header->n_layers * (int64_t)sizeof(EmlNetBlobLayer), false, &p));
+    const EmlNetBlobLayer *records = (const EmlNetBlobLayer *)p;
+    for (int32_t l = 0; l < header->n_layers; l++) {
+        EML_CHECK_ERROR(eml_net_blob_load_layer(bytes, total, &records[l], &out->layers[l], &out->params[l]));
+    }
+    EML_PRECONDITION(out->layers[0].n_inputs == header->n_inputs, EmlSizeMismatch);
+    EML_PRECONDITION(out->layers[header->n_layers - 1].n_outputs == header->n_outputs, EmlSizeMismatch);
+
+    const int64_t scaler_bytes = (int64_t)header->n_inputs * (int64_t)sizeof(float);
+    EML_CHECK_ERROR(eml_net_blob_array(bytes, total, header->scaler_mean, scaler_bytes, true, &p));
+    out->scaler_mean = (const float *)p;
+    EML_CHECK_ERROR(eml_net_blob_array(bytes, total, header->scaler_scale, scaler_bytes, true, &p));
+    out->scaler_scale = (const float *)p;
+    EML_PRECONDITION((out->scaler_mean == NULL) == (out->scaler_scale == NULL), EmlUninitialized);
+
+    EML_CHECK_ERROR(eml_net_blob_array(bytes, total, header->class_names,
+        (int64_t)header->n_outputs * (int64_t)sizeof(uint32_t), true, &p));
+    out->class_names = (const uint32_t *)p;
+    if (out->class_names) {
+        for (int32_t c = 0; c < header->n_outputs; c++) {
+            const uint32_t offset = out->class_names[c];
+            EML_PRECONDITION(offset < total && memchr(bytes + offset, '\0', total - offset), EmlSizeMismatch);
+        }
+    }
+
+    out->net.n_layers = header->n_layers;
+    out->net.layers = out->layers;
+    return EmlOk;
+}
+
+/**
+* \brief Bytes of workspace for eml_net_blob_bind()
+*/
+static inline int32_t
+eml_net_blob_workspace_size(const EmlNetBlobModel *model)
+{
+    return eml_net_workspace_size(&model->net);
+}
+
+/**
+* \brief Give a loaded model its activation buffers and scratch, in a workspace of eml_net_blob_workspace_size() bytes
+*
+* Then model->net works with eml_net_predict(), eml_net_check() etc.
+*/
+static inline EmlError
+eml_net_blob_bind(EmlNetBlobModel *model, void *workspace, int32_t workspace_length)
+{
+    const EmlNet layers_only = model->net;
+    return eml_net_bind_workspace(&layers_only, workspace, workspace_length, &model->net);
+}
+
+/**
+* \brief Apply the scaler of the blob, if any: out = (in - mean) / scale, zero scale counting as 1.
+* in and out may be the same
+*/
+static inline void
+eml_net_blob_scale(const EmlNetBlobModel *model, const float *in, float *out)
+{
+    const int32_t n = model->layers[0].n_inputs;
+    for (int32_t i = 0; i < n; i++) {
+        if (!model->scaler_mean) {
+            out[i] = in[i];
+            continue;
+        }
+        const float centered = in[i] - model->scaler_mean[i];
+        const float scale = model->scaler_scale[i];
+        out[i] = (scale != 0.0f) ? (centered / scale) : centered;
+    }
+}
+
+/**
+* \brief Name of class index cls, or NULL when the blob has no names or cls is out of range
+*/
+static inline const char *
+eml_net_blob_class_name(const EmlNetBlobModel *model, int32_t cls)
+{
+    const int32_t n_outputs = model->layers[model->net.n_layers - 1].n_outputs;
+    if (!model->class_names || cls < 0 || cls >= n_outputs) {
+        return NULL;
+    }
+    return (const char *)(model->blob + model->class_names[cls]);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_NET_BLOB_H
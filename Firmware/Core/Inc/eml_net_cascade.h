@@ -0,0 +1,87 @@
+
+#ifndef EML_NET_CASCADE_H
+#define EML_NET_CASCADE_H
+
+/** @file eml_net_cascade.h
+* Confidence-gated cascade of classifiers: cheap models first, costlier ones only when unsure.
+*
+* Each stage is a predict_logits function, like the <name>_predict_logits() that eml_export.py generates.
+* A stage's answer is accepted when its logit margin (best minus second best logit) reaches the
+* threshold of that stage. Otherwise the next stage runs on the same features. The last stage always answers.
+* Thresholds can be picked on recorded data with home-made/bench/eval_cascade.c.
+*/
+
+#include "eml_common.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* \brief Classify features, and optionally give the logits and the margin of the best over the second class
+*
+* Same signature as the generated <name>_predict_logits(). logits and margin may be NULL
+*/
+typedef int32_t (*EmlNetPredictLogits)(const float *features, float *logits, float *margin);
+
+/** @typedef EmlNetCascade
+* \brief Stages of a cascade, cheapest first
+*
+* All stages take the same features and have the same classes.
+*/
+typedef struct _EmlNetCascade {
+    int32_t n_stages;
+    const EmlNetPredictLogits *stages;
+    const float *thresholds;  // n_stages-1. Stage s answers when its margin >= thresholds[s]
+} EmlNetCascade;
+
+static inline EmlError
+eml_net_cascade_check(const EmlNetCascade *cascade)
+{
+    EML_PRECONDITION(cascade, EmlUninitialized);
+    EML_PRECONDITION(cascade->n_stages >= 1, EmlSizeMismatch);
+    EML_PRECONDITION(cascade->stages, EmlUninitialized);
+    EML_PRECONDITION(cascade->n_stages == 1 || cascade->thresholds, EmlUninitialized);
+    for (int32_t s = 0; s < cascade->n_stages; s++) {
+        EML_PRECONDITION(cascade->stages[s], EmlUninitialized);
+    }
+    return EmlOk;
+}
+
+/**
+* \brief Run the stages in order until one is confident enough
+*
+* \param logits Optional, gets the logits of the answering stage
+* \param margin Optional, gets the margin of the answering stage
+* \param stage Optional, gets the index of the answering stage
+*
+* \return Class index of the answering stage
+*/
+static inline int32_t
+eml_net_cascade_predict(const EmlNetCascade *cascade, const float *features,
+                        float *logits, float *margin, int32_t *stage)
+{
+    const int32_t last = cascade->n_stages - 1;
+    int32_t s = 0;
+    float m = 0.0f;
+    int32_t cls = cascade->stages[0](features, logits, &m);
+    while (s < last && m < cascade->thresholds[s]) {
+        s += 1;
+        cls = cascade->stages[s](features, logits, &m);
+    }
+    if (margin) {
+        *margin = m;
+    }
+    if (stage) {
+        *stage = s;
+    }
+    return cls;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_NET_CASCADE_H
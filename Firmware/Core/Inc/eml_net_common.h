@@ -23,4 +23,62 @@ eml_net_activation_function_strs[EmlNetActivationFunctions] = {
     "tanh",
 };
 
+/**
+    Weight storage of a layer. Selects the kernel used for inference
+    Stored by value in model blobs (eml_net_blob.h), so new types go at the end
+*/
+typedef enum _EmlNetLayerType {
+    // emlearn default. weights[i*n_outputs + o], input-major
+    EmlNetLayerDense = 0,
+    // Output-blocked. Weights for 4 (or 8) consecutive outputs are interleaved per input
+    EmlNetLayerDenseBlocked4,
+    EmlNetLayerDenseBlocked8,
+    // int8 weights with float scale per output, see EmlNetInt8Weights. Needs scratch
+    EmlNetLayerDenseInt8,
+    // q15 weights with float scale per output, see EmlNetQ15Weights. Needs scratch
+    EmlNetLayerDenseQ15,
+    // Same weights as EmlNetLayerDense, skips zero inputs (for inputs from a ReLU layer). Needs scratch, up to INT16_MAX inputs
+    EmlNetLayerDenseSparseInput,
+    // Half precision weights and biases, blocked like EmlNetLayerDenseBlocked8. See EmlNetFloat16Weights
+    EmlNetLayerDenseFloat16,
+    // Pruned weights as compressed sparse rows, see EmlNetCsrWeights
+    EmlNetLayerDenseCsr,
+    // 4-bit indices into a 16 entry float codebook, see EmlNetCodebookWeights
+    EmlNetLayerDenseCodebook,
+    // 1-bit or ternary weights, binarized inputs, see EmlNetBinaryWeights. Needs scratch
+    EmlNetLayerDenseBinary,
+    // 1D convolution and pooling over channels-last time series, see EmlNetConv1DParams
+    EmlNetLayerConv1D,
+    EmlNetLayerConv1DDepthwise,
+    EmlNetLayerMaxPool1D,
+    EmlNetLayerAvgPool1D,
+    // GRU over a sequence, see EmlNetGruParams. Needs scratch
+    EmlNetLayerGru,
+    EmlNetLayerTypes,
+} EmlNetLayerType;
+
+// Name of a layer type, like "dense_blocked4"
+static inline const char *
+eml_net_layer_type_str(EmlNetLayerType type)
+{
+    static const char *const strs[EmlNetLayerTypes] = {
+        "dense",
+        "dense_blocked4",
+        "dense_blocked8",
+        "int8",
+        "q15",
+        "sparse_input",
+        "float16",
+        "csr",
+        "codebook",
+        "binary",
+        "conv1d",
+        "conv1d_depthwise",
+        "maxpool1d",
+        "avgpool1d",
+        "gru",
+    };
+    return (type >= EmlNetLayerDense && type < EmlNetLayerTypes) ? strs[type] : "invalid";
+}
+
 #endif // EML_NET_COMMON_H
@@ -0,0 +1,87 @@
+
+#ifndef EML_NET_PROFILE_H
+#define EML_NET_PROFILE_H
+
+/** @file eml_net_profile.h
+* Per-layer cycle and multiply-add counts of EmlNet inference.
+*
+* Off by default. Build everything that includes eml_net.h with -DEML_NET_PROFILE=1,
+* then point a model at an EmlNetProfile (EmlNet profile, or the generated <name>_set_profile()).
+* Each inference adds to the counts of its layers, so runs can be aggregated and averaged.
+*
+* Cycles come from EML_NET_PROFILE_CYCLES(), a free-running 32-bit counter:
+* DWT CYCCNT on Cortex-M3/M4/M7 (the application enables it, like main.c does),
+* the time stamp counter on x86, and nanoseconds from clock_gettime() elsewhere.
+* Define EML_NET_PROFILE_CYCLES() to use another counter.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef EML_NET_PROFILE
+#define EML_NET_PROFILE 0
+#endif
+
+// Layers beyond this are not recorded
+#ifndef EML_NET_PROFILE_MAX_LAYERS
+#define EML_NET_PROFILE_MAX_LAYERS 8
+#endif
+
+#if EML_NET_PROFILE && !defined(EML_NET_PROFILE_CYCLES)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+// DWT->CYCCNT, without depending on the CMSIS headers
+#define EML_NET_PROFILE_CYCLES() (*(volatile uint32_t *)0xE0001004UL)
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define EML_NET_PROFILE_CYCLES() ((uint32_t)__rdtsc())
+#else
+#include <time.h>
+static inline uint32_t
+eml_net_profile_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+#define EML_NET_PROFILE_CYCLES() eml_net_profile_ns()
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @typedef EmlNetLayerProfile
+* \brief Counts of one layer, summed over all recorded calls
+*/
+typedef struct _EmlNetLayerProfile {
+    uint32_t calls;
+    uint64_t linear_cycles;     // weights and biases (the layer kernel)
+    uint64_t activation_cycles; // activation function, like softmax
+    uint64_t macs;              // multiply-adds, see eml_net_layer_macs()
+} EmlNetLayerProfile;
+
+/** @typedef EmlNetProfile
+* \brief Counts of a model, per layer and for whole inferences
+*
+* total_cycles includes argument checks and buffer handling besides the layers,
+* so total_cycles minus the layer cycles is the overhead of the runtime.
+*/
+typedef struct _EmlNetProfile {
+    int32_t n_layers; // highest recorded layer + 1
+    uint32_t inferences;
+    uint64_t total_cycles;
+    EmlNetLayerProfile layers[EML_NET_PROFILE_MAX_LAYERS];
+} EmlNetProfile;
+
+static inline void
+eml_net_profile_reset(EmlNetProfile *profile)
+{
+    memset(profile, 0, sizeof(*profile));
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_NET_PROFILE_H
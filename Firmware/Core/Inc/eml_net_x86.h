@@ -0,0 +1,430 @@
+
+#ifndef EML_NET_X86_H
+#define EML_NET_X86_H
+
+/** @file eml_net_x86.h
+* SSE and AVX2/FMA dense kernels for evaluating EmlNet models on x86-64 hosts.
+*
+* Included by eml_net.h on x86-64 with GCC/Clang (define EML_NET_NO_X86 to disable),
+* after the scalar kernels. Not meant to be included directly.
+* The kernels read the same EmlNetLayer weights as the scalar ones.
+* The best kernel set the CPU supports is picked on first use via CPUID.
+* The SSE kernels add in the same order as the scalar code, so they give identical results.
+* The AVX2 kernels use fused multiply-add and may differ in the last bit.
+*/
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum _EmlNetX86Level {
+    EmlNetX86Scalar = 0,
+    EmlNetX86Sse,
+    EmlNetX86Avx2,
+    EmlNetX86Levels,
+} EmlNetX86Level;
+
+// Name of a kernel level, like "avx2"
+static inline const char *
+eml_net_x86_level_str(EmlNetX86Level level)
+{
+    static const char *const strs[EmlNetX86Levels] = {
+        "scalar",
+        "sse",
+        "avx2",
+    };
+    return (level >= EmlNetX86Scalar && level < EmlNetX86Levels) ? strs[level] : "invalid";
+}
+
+typedef struct _EmlNetX86Kernels {
+    EmlNetX86Level level;
+    EmlNetDenseKernel dense;
+    EmlNetDenseKernel dense_blocked4;
+    EmlNetDenseKernel dense_blocked8;
+} EmlNetX86Kernels;
+
+/*
+* \internal
+* \brief emlearn input-major layout (weights[i*out_length + o]), 4 outputs per SSE register
+*
+* Up to 16 outputs are accumulated in registers across all inputs.
+*/
+static void
+eml_net_x86_dense_sse(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    int o = 0;
+    for (; o+16<=out_length; o+=16) {
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        const float *w = weights + o;
+        for (int i=0; i<in_length; i++) {
+            const __m128 x = _mm_set1_ps(in[i]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(w + 0), x));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(w + 4), x));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(w + 8), x));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(w + 12), x));
+            w += out_length;
+        }
+        _mm_storeu_ps(out + o + 0, _mm_add_ps(acc0, _mm_loadu_ps(biases + o + 0)));
+        _mm_storeu_ps(out + o + 4, _mm_add_ps(acc1, _mm_loadu_ps(biases + o + 4)));
+        _mm_storeu_ps(out + o + 8, _mm_add_ps(acc2, _mm_loadu_ps(biases + o + 8)));
+        _mm_storeu_ps(out + o + 12, _mm_add_ps(acc3, _mm_loadu_ps(biases + o + 12)));
+    }
+    for (; o+4<=out_length; o+=4) {
+        __m128 acc = _mm_setzero_ps();
+        const float *w = weights + o;
+        for (int i=0; i<in_length; i++) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(w), _mm_set1_ps(in[i])));
+            w += out_length;
+        }
+        _mm_storeu_ps(out + o, _mm_add_ps(acc, _mm_loadu_ps(biases + o)));
+    }
+    for (; o<out_length; o++) {
+        float sum = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            sum += weights[o+(i*out_length)] * in[i];
+        }
+        out[o] = sum + biases[o];
+    }
+}
+
+// Store the first n (1..4) lanes of acc+biases
+static inline void
+eml_net_x86_store_partial(float *out, const float *biases, __m128 acc, int n)
+{
+    float tmp[4];
+    _mm_storeu_ps(tmp, acc);
+    for (int k=0; k<n; k++) {
+        out[k] = tmp[k] + biases[k];
+    }
+}
+
+/*
+* \internal
+* \brief Stores the outputs o..o+3 of one block of 4, or the ones below out_length
+*/
+static inline void
+eml_net_x86_store_block4(float *out, const float *biases, __m128 acc, int o, int32_t out_length)
+{
+    if (o+4 <= out_length) {
+        _mm_storeu_ps(out + o, _mm_add_ps(acc, _mm_loadu_ps(biases + o)));
+    } else {
+        eml_net_x86_store_partial(out + o, biases + o, acc, out_length - o);
+    }
+}
+
+/*
+* \internal
+* \brief Output-blocked layout of eml_net_dense_blocked4, one SSE register per block
+*
+* 4 blocks are accumulated together, so that their add chains overlap.
+*/
+static void
+eml_net_x86_dense_blocked4_sse(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t n_blocks = (out_length + 3) / 4;
+    const int32_t block_size = in_length*4;
+    int b = 0;
+    for (; b+4<=n_blocks; b+=4) {
+        const float *w = weights + (b*block_size);
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            const __m128 x = _mm_set1_ps(in[i]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(w + i*4), x));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(w + block_size + i*4), x));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(w + 2*block_size + i*4), x));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(w + 3*block_size + i*4), x));
+        }
+        const int o = b*4;
+        eml_net_x86_store_block4(out, biases, acc0, o, out_length);
+        eml_net_x86_store_block4(out, biases, acc1, o + 4, out_length);
+        eml_net_x86_store_block4(out, biases, acc2, o + 8, out_length);
+        eml_net_x86_store_block4(out, biases, acc3, o + 12, out_length);
+    }
+    for (; b<n_blocks; b++) {
+        const float *w = weights + (b*block_size);
+        __m128 acc = _mm_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(w + i*4), _mm_set1_ps(in[i])));
+        }
+        eml_net_x86_store_block4(out, biases, acc, b*4, out_length);
+    }
+}
+
+/*
+* \internal
+* \brief Output-blocked layout of eml_net_dense_blocked8, two SSE registers per block
+*/
+static void
+eml_net_x86_dense_blocked8_sse(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t n_blocks = (out_length + 7) / 8;
+    for (int b=0; b<n_blocks; b++) {
+        const float *w = weights + (b*in_length*8);
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            const __m128 x = _mm_set1_ps(in[i]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(w + i*8), x));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(w + i*8 + 4), x));
+        }
+        const int o = b*8;
+        const int n = out_length - o;
+        if (n >= 8) {
+            _mm_storeu_ps(out + o, _mm_add_ps(acc0, _mm_loadu_ps(biases + o)));
+            _mm_storeu_ps(out + o + 4, _mm_add_ps(acc1, _mm_loadu_ps(biases + o + 4)));
+        } else if (n > 4) {
+            _mm_storeu_ps(out + o, _mm_add_ps(acc0, _mm_loadu_ps(biases + o)));
+            eml_net_x86_store_partial(out + o + 4, biases + o + 4, acc1, n - 4);
+        } else {
+            eml_net_x86_store_partial(out + o, biases + o, acc0, n);
+        }
+    }
+}
+
+/*
+* \internal
+* \brief Tail outputs of the input-major AVX2 kernel
+*
+* Handles outputs o_start..out_length-1, 4 at a time with FMA, then one by one.
+*/
+__attribute__((target("avx2,fma"))) static void
+eml_net_x86_dense_tail_avx2(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length, int o_start)
+{
+    int o = o_start;
+    for (; o+4<=out_length; o+=4) {
+        __m128 acc = _mm_setzero_ps();
+        const float *w = weights + o;
+        for (int i=0; i<in_length; i++) {
+            acc = _mm_fmadd_ps(_mm_loadu_ps(w), _mm_broadcast_ss(in + i), acc);
+            w += out_length;
+        }
+        _mm_storeu_ps(out + o, _mm_add_ps(acc, _mm_loadu_ps(biases + o)));
+    }
+    for (; o<out_length; o++) {
+        float sum = 0.0f;
+        for (int i=0; i<in_length; i++) {
+            sum += weights[o+(i*out_length)] * in[i];
+        }
+        out[o] = sum + biases[o];
+    }
+}
+
+/*
+* \internal
+* \brief emlearn input-major layout, 8 outputs per AVX register
+*
+* Up to 32 outputs are accumulated in registers across all inputs.
+*/
+__attribute__((target("avx2,fma"))) static void
+eml_net_x86_dense_avx2(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    int o = 0;
+    for (; o+32<=out_length; o+=32) {
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        const float *w = weights + o;
+        for (int i=0; i<in_length; i++) {
+            const __m256 x = _mm256_broadcast_ss(in + i);
+            acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 0), x, acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 8), x, acc1);
+            acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 16), x, acc2);
+            acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 24), x, acc3);
+            w += out_length;
+        }
+        _mm256_storeu_ps(out + o + 0, _mm256_add_ps(acc0, _mm256_loadu_ps(biases + o + 0)));
+        _mm256_storeu_ps(out + o + 8, _mm256_add_ps(acc1, _mm256_loadu_ps(biases + o + 8)));
+        _mm256_storeu_ps(out + o + 16, _mm256_add_ps(acc2, _mm256_loadu_ps(biases + o + 16)));
+        _mm256_storeu_ps(out + o + 24, _mm256_add_ps(acc3, _mm256_loadu_ps(biases + o + 24)));
+    }
+    for (; o+8<=out_length; o+=8) {
+        __m256 acc = _mm256_setzero_ps();
+        const float *w = weights + o;
+        for (int i=0; i<in_length; i++) {
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(w), _mm256_broadcast_ss(in + i), acc);
+            w += out_length;
+        }
+        _mm256_storeu_ps(out + o, _mm256_add_ps(acc, _mm256_loadu_ps(biases + o)));
+    }
+    eml_net_x86_dense_tail_avx2(in, in_length, weights, biases, out, out_length, o);
+}
+
+/*
+* \internal
+* \brief Output-blocked layout of eml_net_dense_blocked8, one AVX register per block
+*
+* 4 blocks are accumulated together, to hide the latency of the FMA chains.
+*/
+__attribute__((target("avx2,fma"))) static void
+eml_net_x86_dense_blocked8_avx2(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t n_blocks = (out_length + 7) / 8;
+    const int32_t block_size = in_length*8;
+    int b = 0;
+    for (; (b+4)*8<=out_length; b+=4) {
+        const float *w = weights + (b*block_size);
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            const __m256 x = _mm256_broadcast_ss(in + i);
+            acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(w + i*8), x, acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(w + block_size + i*8), x, acc1);
+            acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 2*block_size + i*8), x, acc2);
+            acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(w + 3*block_size + i*8), x, acc3);
+        }
+        const int o = b*8;
+        _mm256_storeu_ps(out + o + 0, _mm256_add_ps(acc0, _mm256_loadu_ps(biases + o + 0)));
+        _mm256_storeu_ps(out + o + 8, _mm256_add_ps(acc1, _mm256_loadu_ps(biases + o + 8)));
+        _mm256_storeu_ps(out + o + 16, _mm256_add_ps(acc2, _mm256_loadu_ps(biases + o + 16)));
+        _mm256_storeu_ps(out + o + 24, _mm256_add_ps(acc3, _mm256_loadu_ps(biases + o + 24)));
+    }
+    for (; b<n_blocks; b++) {
+        const float *w = weights + (b*block_size);
+        __m256 acc = _mm256_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(w + i*8), _mm256_broadcast_ss(in + i), acc);
+        }
+        const int o = b*8;
+        const int n = out_length - o;
+        if (n >= 8) {
+            _mm256_storeu_ps(out + o, _mm256_add_ps(acc, _mm256_loadu_ps(biases + o)));
+        } else {
+            float tmp[8];
+            _mm256_storeu_ps(tmp, acc);
+            for (int k=0; k<n; k++) {
+                out[o+k] = tmp[k] + biases[o+k];
+            }
+        }
+    }
+}
+
+/*
+* \internal
+* \brief Output-blocked layout of eml_net_dense_blocked4, one SSE register per block, with FMA
+*
+* 8 blocks are accumulated together, to hide the latency of the FMA chains.
+* A block of 4 outputs is half an AVX register, so the weights are loaded 4 at a time like with SSE.
+*/
+__attribute__((target("avx2,fma"))) static void
+eml_net_x86_dense_blocked4_avx2(const float *in, int32_t in_length,
+                const float *weights,
+                const float *biases,
+                float *out, int32_t out_length)
+{
+    const int32_t n_blocks = (out_length + 3) / 4;
+    const int32_t block_size = in_length*4;
+    int b = 0;
+    for (; b+8<=n_blocks; b+=8) {
+        const float *w = weights + (b*block_size);
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        __m128 acc4 = _mm_setzero_ps(), acc5 = _mm_setzero_ps();
+        __m128 acc6 = _mm_setzero_ps(), acc7 = _mm_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            const __m128 x = _mm_broadcast_ss(in + i);
+            const float *wi = w + i*4;
+            acc0 = _mm_fmadd_ps(_mm_loadu_ps(wi), x, acc0);
+            acc1 = _mm_fmadd_ps(_mm_loadu_ps(wi + block_size), x, acc1);
+            acc2 = _mm_fmadd_ps(_mm_loadu_ps(wi + 2*block_size), x, acc2);
+            acc3 = _mm_fmadd_ps(_mm_loadu_ps(wi + 3*block_size), x, acc3);
+            acc4 = _mm_fmadd_ps(_mm_loadu_ps(wi + 4*block_size), x, acc4);
+            acc5 = _mm_fmadd_ps(_mm_loadu_ps(wi + 5*block_size), x, acc5);
+            acc6 = _mm_fmadd_ps(_mm_loadu_ps(wi + 6*block_size), x, acc6);
+            acc7 = _mm_fmadd_ps(_mm_loadu_ps(wi + 7*block_size), x, acc7);
+        }
+        const int o = b*4;
+        eml_net_x86_store_block4(out, biases, acc0, o, out_length);
+        eml_net_x86_store_block4(out, biases, acc1, o + 4, out_length);
+        eml_net_x86_store_block4(out, biases, acc2, o + 8, out_length);
+        eml_net_x86_store_block4(out, biases, acc3, o + 12, out_length);
+        eml_net_x86_store_block4(out, biases, acc4, o + 16, out_length);
+        eml_net_x86_store_block4(out, biases, acc5, o + 20, out_length);
+        eml_net_x86_store_block4(out, biases, acc6, o + 24, out_length);
+        eml_net_x86_store_block4(out, biases, acc7, o + 28, out_length);
+    }
+    for (; b<n_blocks; b++) {
+        const float *w = weights + (b*block_size);
+        __m128 acc = _mm_setzero_ps();
+        for (int i=0; i<in_length; i++) {
+            acc = _mm_fmadd_ps(_mm_loadu_ps(w + i*4), _mm_broadcast_ss(in + i), acc);
+        }
+        eml_net_x86_store_block4(out, biases, acc, b*4, out_length);
+    }
+}
+
+static const EmlNetX86Kernels
+eml_net_x86_kernel_table[EmlNetX86Levels] = {
+    { EmlNetX86Scalar, eml_net_dense, eml_net_dense_blocked4, eml_net_dense_blocked8 },
+    { EmlNetX86Sse, eml_net_x86_dense_sse, eml_net_x86_dense_blocked4_sse, eml_net_x86_dense_blocked8_sse },
+    { EmlNetX86Avx2, eml_net_x86_dense_avx2, eml_net_x86_dense_blocked4_avx2, eml_net_x86_dense_blocked8_avx2 },
+};
+
+// Currently selected kernels. NULL until first use
+static const EmlNetX86Kernels *eml_net_x86_selected = NULL;
+
+// Best level supported by this CPU (and OS, for the AVX register state)
+static EmlNetX86Level
+eml_net_x86_detect(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return EmlNetX86Avx2;
+    }
+    // SSE2 is part of x86-64
+    return EmlNetX86Sse;
+}
+
+/**
+* \brief Force a kernel level, for benchmarking and comparing against the scalar code
+*
+* \return EmlUnsupported if the CPU does not support the level
+*/
+static inline EmlError
+eml_net_x86_select(EmlNetX86Level level)
+{
+    EML_PRECONDITION(level >= EmlNetX86Scalar && level < EmlNetX86Levels, EmlUnsupported);
+    EML_PRECONDITION(level <= eml_net_x86_detect(), EmlUnsupported);
+    __atomic_store_n(&eml_net_x86_selected, &eml_net_x86_kernel_table[level], __ATOMIC_RELEASE);
+    return EmlOk;
+}
+
+// Kernels to use. Detects the CPU on first call
+static const EmlNetX86Kernels *
+eml_net_x86_kernels(void)
+{
+    const EmlNetX86Kernels *kernels = __atomic_load_n(&eml_net_x86_selected, __ATOMIC_ACQUIRE);
+    if (!kernels) {
+        // Concurrent first calls all store the same pointer
+        kernels = &eml_net_x86_kernel_table[eml_net_x86_detect()];
+        __atomic_store_n(&eml_net_x86_selected, kernels, __ATOMIC_RELEASE);
+    }
+    return kernels;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_NET_X86_H
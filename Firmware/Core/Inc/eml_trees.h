@@ -0,0 +1,151 @@
+
+#ifndef EML_TREES_H
+#define EML_TREES_H
+
+/** @file eml_trees.h
+* Table-driven decision tree ensembles (random forests) over int16 features.
+*
+* Instead of one nested if/else function per tree, as emlearn generates, all nodes of the forest
+* are in flat arrays (struct of arrays) that one iterative loop walks, so flash grows by
+* 8 bytes per decision node instead of the code of a compare and branch per node.
+*
+* A decision node n goes to left[n] when features[feature[n]] < threshold[n], else to right[n].
+* A child (or root) >= 0 is a decision node, and a negative one is a leaf: -1 - class.
+* Nodes are stored in depth-first order, so children always come after their parent.
+*
+* Written by eml_export.py export_trees(), from emlearn-generated C or fitted sklearn forests.
+*
+* This trades time for flash, it is not faster: on the host (home-made/bench/eval_trees.c, gcc -O2, x86)
+* the 25 tree rf_perf_25_6 takes 1.5-1.7x the time of the generated code per window, and the 2 tree
+* rf_wt_2_6 about the same. Cortex-M4 cycles are not measured yet (MLP_AB_MODELS=1 prints them on the board),
+* so the generated forests stay the default.
+*/
+
+#include "eml_common.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Largest number of classes, for the votes on the stack
+#ifndef EML_TREES_MAX_CLASSES
+#define EML_TREES_MAX_CLASSES 32
+#endif
+
+/** @typedef EmlTrees
+* \brief Forest of n_trees trees, with n_nodes decision nodes in total
+*/
+typedef struct _EmlTrees {
+    int32_t n_nodes;
+    int32_t n_trees;
+    int32_t n_classes;
+    int32_t n_features;         // features read: the largest feature index + 1
+    const uint16_t *feature;    // n_nodes. Feature index compared at each node
+    const int16_t *threshold;   // n_nodes
+    const int16_t *left;        // n_nodes. Child when the feature is below the threshold
+    const int16_t *right;       // n_nodes
+    const int16_t *roots;       // n_trees. First node of each tree, or its leaf
+} EmlTrees;
+
+/**
+* \brief Check that the forest is well formed, so that eml_trees_predict() terminates
+* and reads inside the arrays. Run once, the predict functions do not check the nodes
+*/
+static inline EmlError
+eml_trees_check(const EmlTrees *trees)
+{
+    EML_PRECONDITION(trees, EmlUninitialized);
+    EML_PRECONDITION(trees->n_trees >= 1, EmlSizeMismatch);
+    EML_PRECONDITION(trees->n_classes >= 1 && trees->n_classes <= EML_TREES_MAX_CLASSES, EmlUnsupported);
+    EML_PRECONDITION(trees->roots, EmlUninitialized);
+    EML_PRECONDITION(trees->n_nodes == 0
+        || (trees->feature && trees->threshold && trees->left && trees->right), EmlUninitialized);
+
+    for (int32_t t = 0; t < trees->n_trees; t++) {
+        const int32_t root = trees->roots[t];
+        EML_PRECONDITION(root < trees->n_nodes, EmlSizeMismatch);
+        EML_PRECONDITION(root >= 0 || -1 - root < trees->n_classes, EmlSizeMismatch);
+    }
+    for (int32_t n = 0; n < trees->n_nodes; n++) {
+        EML_PRECONDITION(trees->feature[n] < trees->n_features, EmlSizeMismatch);
+        const int32_t children[2] = { trees->left[n], trees->right[n] };
+        for (int c = 0; c < 2; c++) {
+            // Decision nodes only point forward, so no walk can loop
+            EML_PRECONDITION(children[c] < 0 || (children[c] > n && children[c] < trees->n_nodes), EmlSizeMismatch);
+            EML_PRECONDITION(children[c] >= 0 || -1 - children[c] < trees->n_classes, EmlSizeMismatch);
+        }
+    }
+    return EmlOk;
+}
+
+/**
+* \brief Class of one tree
+*/
+static inline int32_t
+eml_trees_predict_tree(const EmlTrees *trees, int32_t tree, const int16_t *features)
+{
+    int32_t node = trees->roots[tree];
+    while (node >= 0) {
+        node = (features[trees->feature[node]] < trees->threshold[node]) ? trees->left[node] : trees->right[node];
+    }
+    return -1 - node;
+}
+
+static inline void
+eml_trees_votes(const EmlTrees *trees, const int16_t *features, int32_t *votes)
+{
+    for (int32_t c = 0; c < trees->n_classes; c++) {
+        votes[c] = 0;
+    }
+    for (int32_t t = 0; t < trees->n_trees; t++) {
+        votes[eml_trees_predict_tree(trees, t, features)] += 1;
+    }
+}
+
+/**
+* \brief Majority vote of the trees. Ties go to the lowest class, like the emlearn-generated code
+*
+* \return Class index, or -EmlSizeMismatch when features_length is below n_features
+*/
+static inline int32_t
+eml_trees_predict(const EmlTrees *trees, const int16_t *features, int32_t features_length)
+{
+    EML_PRECONDITION(features_length >= trees->n_features, -EmlSizeMismatch);
+
+    int32_t votes[EML_TREES_MAX_CLASSES];
+    eml_trees_votes(trees, features, votes);
+    int32_t best = 0;
+    for (int32_t c = 1; c < trees->n_classes; c++) {
+        if (votes[c] > votes[best]) {
+            best = c;
+        }
+    }
+    return best;
+}
+
+/**
+* \brief Fraction of the trees voting for each class, in out[0..n_classes-1].
+* Further values up to out_length are zeroed
+*/
+static inline EmlError
+eml_trees_predict_proba(const EmlTrees *trees, const int16_t *features, int32_t features_length,
+                        float *out, int32_t out_length)
+{
+    EML_PRECONDITION(features_length >= trees->n_features, EmlSizeMismatch);
+    EML_PRECONDITION(out_length >= trees->n_classes, EmlSizeMismatch);
+
+    int32_t votes[EML_TREES_MAX_CLASSES];
+    eml_trees_votes(trees, features, votes);
+    for (int32_t c = 0; c < out_length; c++) {
+        out[c] = (c < trees->n_classes) ? (float)votes[c] / (float)trees->n_trees : 0.0f;
+    }
+    return EmlOk;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // EML_TREES_H
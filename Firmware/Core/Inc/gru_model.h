@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include "eml_net_profile.h"
+
+// Streaming gesture model: a GRU over the IMU samples (raw values, the per-axis scaler is folded in)
+// and a small dense head on its final state. Generated by home-made/train_gru.py, and trained on the
+// steps of the streaming front end in main.c: means of MLP_STREAM_DECIMATION (4) samples at the poll rate,
+// at most GRU_MAX_STEPS of them. Other decimations or longer sequences need retraining.
+#define GRU_STATE_DIM 32U
+#define GRU_MAX_STEPS 100U
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int32_t gru_predict(const float *features, int32_t n_features);
+int32_t gru_regress(const float *features, int32_t n_features, float *out, int32_t out_length);
+float gru_regress1(const float *features, int32_t n_features);
+
+// Reentrant variants, with caller-owned workspace of gru_workspace_size() bytes
+int32_t gru_workspace_size(void);
+int32_t gru_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length);
+int32_t gru_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length);
+
+// Fast path without per-call argument checks. gru_check() must have returned 0 first.
+// Features are GRU_MAX_STEPS steps * 6 axes, like a gesture of GRU_MAX_STEPS * MLP_STREAM_DECIMATION samples
+int32_t gru_check(void);
+int32_t gru_predict_unchecked(const float *features);
+void gru_regress_unchecked(const float *features, float *out);
+int32_t gru_predict_logits(const float *features, float *logits, float *margin);
+// Record per-layer cycles and multiply-adds into profile (NULL to stop). Needs EML_NET_PROFILE=1
+void gru_set_profile(EmlNetProfile *profile);
+
+// Streaming: gru_stream_reset() at the start of a gesture, gru_stream_push() once per sample
+// (6 values: Ax, Ay, Az, Gx, Gy, Gz), then gru_stream_predict_logits() runs only the head.
+// The state is a single static buffer, so one stream at a time. Needs gru_check() first
+void gru_stream_reset(void);
+int32_t gru_stream_push(const float *sample);
+int32_t gru_stream_predict_logits(float *logits, float *margin);
+
+#ifdef __cplusplus
+}
+#endif
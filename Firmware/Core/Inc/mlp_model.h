@@ -1,6 +1,20 @@
 #pragma once
 
 #include <stdint.h>
+#include "eml_net_profile.h"
+
+// The StandardScaler is folded into layer 0 of the model (eml_export.py --fold-scaler).
+// The model then takes resampled raw IMU values, and MLP_MEAN/MLP_SCALE are not needed.
+// Set to 0 when using a model exported without folding.
+#ifndef MLP_SCALER_FOLDED
+#define MLP_SCALER_FOLDED 1
+#endif
+
+// Fixed-rate capture in main.c that computes layer 0 while the gesture is recorded, see MLP_INCREMENTAL there.
+// It needs MLP_MEAN (the input at which standardized features are 0) also with a folded scaler
+#ifndef MLP_INCREMENTAL
+#define MLP_INCREMENTAL 0
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,6 +24,47 @@ int32_t mlp_perf__32_32__1e_05_predict(const float *features, int32_t n_features
 int32_t mlp_perf__32_32__1e_05_regress(const float *features, int32_t n_features, float *out, int32_t out_length);
 float mlp_perf__32_32__1e_05_regress1(const float *features, int32_t n_features);
 
+// Reentrant variants, with caller-owned workspace of mlp_perf__32_32__1e_05_workspace_size() bytes
+int32_t mlp_perf__32_32__1e_05_workspace_size(void);
+int32_t mlp_perf__32_32__1e_05_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length);
+int32_t mlp_perf__32_32__1e_05_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length);
+
+// Fast path without per-call argument checks. mlp_perf__32_32__1e_05_check() must have returned 0 first.
+// Features are 600 long (MLP_FEATURE_DIM), out holds the 6 class outputs
+int32_t mlp_perf__32_32__1e_05_check(void);
+int32_t mlp_perf__32_32__1e_05_predict_unchecked(const float *features);
+void mlp_perf__32_32__1e_05_regress_unchecked(const float *features, float *out);
+// Class from the logits (outputs before softmax), without exp/log. Also unchecked.
+// logits (6 values) and margin (best minus second best logit) may be NULL
+int32_t mlp_perf__32_32__1e_05_predict_logits(const float *features, float *logits, float *margin);
+// Record per-layer cycles and multiply-adds into profile (NULL to stop). Needs EML_NET_PROFILE=1
+void mlp_perf__32_32__1e_05_set_profile(EmlNetProfile *profile);
+
+// Layer 0 computed incrementally, as features arrive. acc holds the 32 outputs of layer 0:
+// mlp_perf__32_32__1e_05_accumulate_reset() sets it to the biases, each _accumulate() adds features
+// offset..offset+n_values-1, and _predict_logits_accumulated() runs the rest (acc is overwritten). Needs _check()
+void mlp_perf__32_32__1e_05_accumulate_reset(float *acc);
+int32_t mlp_perf__32_32__1e_05_accumulate(int32_t offset, const float *values, int32_t n_values, float *acc);
+int32_t mlp_perf__32_32__1e_05_predict_logits_accumulated(float *acc, float *logits, float *margin);
+
+// Small model (600-8-6, mlp_small_model.c), the first stage of the cascade in main.c.
+// Same features and classes as mlp_perf__32_32__1e_05, scaler also folded in
+int32_t mlp_wt__8___1e_05_check(void);
+int32_t mlp_wt__8___1e_05_workspace_size(void);
+int32_t mlp_wt__8___1e_05_predict_logits(const float *features, float *logits, float *margin);
+void mlp_wt__8___1e_05_set_profile(EmlNetProfile *profile);
+
+// Selected-input model (mlp_select_model.c): mlp_perf__32_32__1e_05 reduced to the 25 time steps with the largest
+// layer 0 weights, layer 0 refit on the recorded gestures (eml_export.py --select-features 25), scaler folded in.
+// Takes the MLP_SELECT_FEATURES raw window values listed in mlp_select__32_32__1e_05_feature_index,
+// as written by model_resample_selected() (model_registry.h). Same classes
+#define MLP_SELECT_FEATURES 150U
+extern const uint16_t mlp_select__32_32__1e_05_feature_index[MLP_SELECT_FEATURES];
+int32_t mlp_select__32_32__1e_05_check(void);
+int32_t mlp_select__32_32__1e_05_workspace_size(void);
+int32_t mlp_select__32_32__1e_05_predict_logits(const float *features, float *logits, float *margin);
+void mlp_select__32_32__1e_05_set_profile(EmlNetProfile *profile);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,93 @@
+#ifndef MODEL_REGISTRY_H
+#define MODEL_REGISTRY_H
+
+/*
+* Registry of the gesture classifiers linked into the firmware, behind one interface.
+*
+* Each model has a descriptor: how to build its features from a resampled window,
+* a predict function giving the class, scores and margin, and its memory and class names.
+* main.c (MLP_AB_MODELS) and home-made/bench/eval_registry.c run any of them by ModelId
+* on the same window, to compare latency and accuracy of the MLPs and random forests.
+*
+* All models take the same window: MODEL_WINDOW_SAMPLES samples of MODEL_AXES axes,
+* linearly resampled from the recording (model_resample_window), as raw IMU values.
+*/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MODEL_WINDOW_SAMPLES 100U
+#define MODEL_AXES 6U
+#define MODEL_WINDOW_LENGTH (MODEL_WINDOW_SAMPLES * MODEL_AXES)
+#define MODEL_N_CLASSES 6
+
+// Largest features of any model, in bytes: the float window
+#define MODEL_FEATURES_MAX_SIZE (MODEL_WINDOW_LENGTH * sizeof(float))
+
+typedef enum _ModelId {
+    ModelMlpPerf = 0,   // 600-32-32-6 MLP (mlp_model.c)
+    ModelMlpSmall,      // 600-8-6 MLP (mlp_small_model.c)
+    ModelMlpSelect,     // 150-32-32-6 MLP on 25 of the 100 time steps (mlp_select_model.c)
+    ModelGru,           // GRU over the window as 100 steps, like a 2.4 s streamed gesture (gru_model.c)
+    ModelRfPerf,        // 25 tree random forest (rf_model.c)
+    ModelRfSmall,       // 2 tree random forest (rf_small_model.c)
+    ModelRfPerfFlat,    // the 25 trees as node tables (rf_flat_model.c, eml_trees.h)
+    ModelRfSmallFlat,   // the 2 trees as node tables (rf_small_flat_model.c)
+    ModelIds,
+} ModelId;
+
+// Write the features of a model from a resampled window (MODEL_WINDOW_LENGTH raw values)
+typedef void (*ModelBuildFeatures)(const float *window, void *features);
+
+// Class of features, or negative on error. scores (MODEL_N_CLASSES values: logits, or vote
+// fractions of a forest) and margin (best minus second best score) may be NULL
+typedef int32_t (*ModelPredict)(const void *features, float *scores, float *margin);
+
+typedef struct _ModelDescriptor {
+    const char *name;
+    int32_t features_size;          // bytes written by build_features
+    ModelBuildFeatures build_features;
+    ModelPredict predict;
+    int32_t (*check)(void);         // validate once before predict, 0 when valid. NULL when not needed
+    int32_t (*workspace_size)(void); // bytes of activations and scratch the model uses. NULL for none
+    const char *const *class_names; // MODEL_N_CLASSES
+} ModelDescriptor;
+
+extern const ModelDescriptor model_registry[ModelIds];
+
+// Class names, shared by all models (sorted names of the recorded gesture files)
+extern const char *const model_class_names[MODEL_N_CLASSES];
+
+// Descriptor of id, or NULL when out of range
+const ModelDescriptor *model_get(int32_t id);
+
+// Id of the model with this name, or -1
+int32_t model_find(const char *name);
+
+// Run check() of every model. Returns the first failing ModelId, or -1 when all are valid
+int32_t model_check_all(void);
+
+// Linear interpolation of n_samples recorded samples (MODEL_AXES values each) to MODEL_WINDOW_SAMPLES
+void model_resample_window(const float *samples, uint16_t n_samples, float *window);
+
+// Only the window values index[0..n_index-1] of model_resample_window, in that order, for models that take
+// a selection of the window (eml_export.py --select-features). Interpolates just those values
+void model_resample_selected(const float *samples, uint16_t n_samples,
+                             const uint16_t *index, uint16_t n_index, float *features);
+
+// Build the features of model id from window, and predict. features holds MODEL_FEATURES_MAX_SIZE bytes
+int32_t model_classify(int32_t id, const float *window, void *features, float *scores, float *margin);
+
+// Feature builders used by the registry
+void model_build_float(const float *window, void *features);        // raw values
+void model_build_standardized(const float *window, void *features); // MLP_MEAN/MLP_SCALE applied, unless folded
+void model_build_int16(const float *window, void *features);        // rounded and saturated to int16
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_REGISTRY_H
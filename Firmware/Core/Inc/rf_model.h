@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+// Random forests generated by emlearn (home-made/random-forest.ipynb) into home-made/builds/rf_*.c,
+// which rf_model.c and rf_small_model.c include.
+// They take the resampled window of 100 samples * 6 axes as raw int16 IMU values, without a scaler,
+// and have 6 classes in the order of model_class_names (model_registry.h)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 25 trees of depth up to 6 (rf_model.c)
+int32_t rf_perf_25_6_predict(const int16_t *features, int32_t features_length);
+int rf_perf_25_6_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length);
+
+// 2 trees of depth up to 6 (rf_small_model.c)
+int32_t rf_wt_2_6_predict(const int16_t *features, int32_t features_length);
+int rf_wt_2_6_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length);
+
+// The same forests as node tables for the iterative traversal of eml_trees.h
+// (eml_export.py --trees: rf_flat_model.c and rf_small_flat_model.c). Same results and less flash,
+// but slower than the generated code on the host, see eml_trees.h. _check() validates the tables once, 0 when valid
+int32_t rf_perf_25_6_flat_check(void);
+int32_t rf_perf_25_6_flat_predict(const int16_t *features, int32_t features_length);
+int rf_perf_25_6_flat_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length);
+
+int32_t rf_wt_2_6_flat_check(void);
+int32_t rf_wt_2_6_flat_predict(const int16_t *features, int32_t features_length);
+int rf_wt_2_6_flat_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,123 @@
+#include "gru_model.h"
+#include <eml_net.h>
+static const float gru_layer_0_input_weights[576] = { -2.773465e-05f, -9.27676e-06f, -9.668036e-05f, -0.0001684021f, 0.00013274938f, 0.00014737023f, 7.595057e-05f, 3.0928604e-05f, 3.2537413e-05f, -6.323714e-05f, -1.1093825e-05f, -8.9407935e-05f, 7.073078e-05f, -0.00010641366f, 0.000102290505f, -5.699632e-05f, -1.4638942e-05f, -2.8671106e-05f, -0.00010584826f, -4.848369e-05f, -3.647869e-05f, -0.00014224928f, 8.155441e-07f, -4.6039717e-05f, 6.559709e-05f, -2.5797859e-05f, 0.000115435505f, -4.4614393e-05f, 5.7115514e-05f, 4.468034e-05f, 0.00015335027f, -0.00010220065f, 1.3526809e-05f, -1.4974083e-05f, 4.770295e-06f, 1.4035842e-05f, -4.6188117e-05f, 4.3748623e-05f, 5.9509515e-05f, -1.2564603e-05f, 3.1070686e-05f, -1.7901328e-05f, -1.6753458e-05f, -1.4692395e-05f, -4.4869857e-06f, 3.7375674e-05f, -5.506851e-06f, 3.5161473e-05f, -2.6635915e-05f, 1.1741835e-05f, -2.5576173e-05f, -4.7352707e-05f, 8.98845e-05f, -0.000104603205f, -1.2551704e-05f, -7.580434e-05f, 3.677859e-05f, 7.116425e-05f, -3.3517692e-05f, -0.00012099433f, -3.629992e-05f, -6.124029e-05f, 2.0865222e-05f, 5.266349e-05f, -6.164548e-05f, 1.9836867e-05f, -5.3587413e-05f, 7.7982724e-05f, -1.6865552e-05f, -7.9068166e-05f, 8.624644e-05f, 3.4488516e-05f, 1.7616168e-05f, 3.7939095e-05f, -1.9989377e-05f, 1.3381449e-05f, -5.0923645e-06f, 8.161601e-05f, 7.177101e-05f, -6.3559986e-05f, 4.7086913e-05f, 1.3140443e-05f, -1.5908441e-05f, 3.9132294e-05f, 1.7653643e-06f, 3.334286e-05f, 3.961687e-05f, 7.146933e-05f, -6.3965635e-05f, 1.3712289e-05f, 6.9888665e-05f, 7.351008e-05f, -4.7414065e-05f, 2.0465794e-05f, 8.764555e-05f, 5.0222025e-05f, -4.5445317e-06f, 6.106474e-05f, 2.364469e-06f, -2.5264214e-06f, -8.014761e-06f, -0.000100940735f, 0.00013633637f, 9.54951e-05f, -5.087267e-05f, -2.3487495e-05f, -6.476903e-05f, 0.00011876419f, -0.00012534497f, -2.8279637e-05f, -1.4531989e-05f, -5.9177397e-05f, 6.7419285e-05f, -4.784838e-05f, -5.549846e-06f, -1.6261694e-05f, 7.2150004e-05f, -8.361429e-05f, -1.2398126e-05f, -5.6427012e-05f, 7.263777e-05f, 9.732604e-05f, -4.8792797e-05f, 2.9956257e-06f, -4.9302547e-05f, -5.7236288e-05f, 0.00012572523f, 4.1790776e-05f, -0.00010847829f, -2.1809904e-06f, -2.0456602e-05f, 3.0032948e-06f, 1.0088962e-05f, -1.937995e-05f, -3.418804e-05f, 2.2096512e-05f, 3.1791304e-05f, 4.9799264e-06f, 7.225721e-05f, -6.1981984e-05f, -6.349863e-05f, 3.350201e-06f, 2.6005917e-05f, -0.00010660171f, -7.1132505e-05f, 0.000103602855f, -6.746455e-05f, 7.047943e-05f, 3.2924968e-06f, 8.4807776e-05f, -2.7560967e-05f, -3.135574e-06f, -5.7826313e-05f, 2.016338e-05f, -9.961156e-05f, 6.500233e-05f, 9.1803144e-05f, -3.9756353e-05f, 3.7801085e-05f, -7.20176e-05f, -3.396209e-05f, 2.1138896e-05f, -1.8427681e-05f, 4.795259e-05f, 2.7227736e-05f, 2.5555908e-06f, -5.8022873e-05f, 2.7896397e-06f, 4.9332804e-05f, -3.060704e-05f, 4.389069e-05f, 7.872171e-05f, -6.835615e-05f, -4.7033234e-05f, 9.8900135e-05f, 5.7890284e-05f, 2.4053954e-05f, 9.3838426e-05f, 9.491721e-05f, 6.581622e-05f, 2.1900532e-05f, -7.6763274e-05f, -2.404579e-05f, 5.9873782e-05f, 4.3777596e-05f, -4.0706735e-05f, 1.1019915e-05f, 1.0422805e-06f, 2.8145703e-05f, 3.564727e-05f, -5.4305925e-05f, -2.28446e-05f, 6.9367634e-05f, 2.0193933e-05f, 8.5353815e-05f, 8.250904e-05f, 6.917665e-05f, 3.2320717e-05f, 0.00023621322f, 9.583922e-05f, 5.2444946e-05f, 0.00010073748f, 1.8623372e-05f, 6.903621e-05f, 7.109871e-05f, 0.00019171847f, 0.00013737833f, -0.00010882908f, 0.00013182865f, 0.00014081334f, -9.267547e-06f, -1.0811464e-05f, 6.2695515e-05f, 0.00013400313f, -9.144035e-05f, 3.288161e-05f, 0.00023070167f, 9.643196e-05f, 0.00010631475f, -4.0935233e-06f, 0.00017410806f, -6.801621e-05f, 5.940284e-05f, 3.95909e-05f, -9.5650284e-05f, 5.9491675e-05f, 6.4976535e-05f, -0.00010254276f, 6.0656304e-05f, 1.6272059e-05f, 2.5847958e-05f, -3.0230382e-05f, -2.4005736e-05f, 9.343134e-06f, 1.1754125e-06f, -0.000107481355f, -0.00010467509f, 0.00010439554f, -6.642926e-05f, 9.9478966e-05f, -0.0001476351f, 0.000116867435f, 7.7321405e-05f, -1.13586175e-05f, -1.5850796e-05f, 0.00012535378f, 7.169805e-05f, 6.9459704e-05f, -0.00010054137f, -1.7169188e-05f, -2.1247379e-05f, 8.4680825e-05f, 0.00010974026f, 0.00022370643f, -2.291155e-05f, -1.9493784e-05f, 0.00010011298f, -0.0001415322f, 8.132252e-05f, 7.832723e-05f, 0.00013517684f, 7.8060775e-06f, 7.8972706e-05f, -2.1128151e-05f, -9.818837e-06f, -2.3084616e-05f, -3.3534267e-05f, -2.9879098e-05f, -3.966326e-06f, -0.00017051517f, 3.21022e-05f, 0.00011942996f, -5.374446e-05f, 2.6697191e-05f, 7.303553e-05f, 0.00011052711f, 4.3329106e-05f, -6.242556e-05f, 0.00015050099f, 0.00017050789f, -3.5831683e-05f, 9.702478e-05f, 6.395453e-05f, 4.066633e-05f, 0.00010054559f, 0.00013359258f, 0.00011950636f, 2.2435193e-05f, 5.119705e-05f, -5.3104908e-05f, -6.354563e-05f, -3.3228258e-05f, -2.9299903e-05f, -9.8530545e-06f, 4.287623e-05f, 1.0891993e-05f, -0.00011852017f, 7.053075e-05f, 6.221906e-06f, 7.2440176e-05f, 5.3409338e-05f, -6.77183e-05f, -9.6662174e-05f, 1.0357009e-05f, 5.958048e-05f, 1.2592459e-05f, -4.475146e-05f, 1.7892744e-05f, 0.00016113008f, -4.6069486e-05f, 9.3817954e-07f, -8.0295285e-05f, 5.4747936e-05f, 6.198613e-05f, -3.269927e-05f, -0.00014228631f, -5.4466516e-05f, -4.98974e-05f, -1.4144479e-05f, 0.00011887459f, -3.5405486e-05f, 1.224929e-05f, 4.3934997e-05f, -7.298969e-05f, 5.352438e-06f, -5.7092373e-05f, 1.7197404e-05f, 4.120409e-05f, -5.0918834e-07f, -8.69408e-05f, 1.03855255e-05f, -7.793914e-05f, -1.5267939e-05f, -3.937586e-05f, -6.7976434e-05f, 0.00011874659f, 1.4032773e-05f, -4.98882e-05f, -8.0080994e-05f, 1.149825e-05f, -9.053952e-05f, 1.6372926e-05f, 5.5663768e-05f, 4.1572708e-05f, -4.7762874e-06f, -8.6462765e-05f, -2.2673237e-05f, -5.0948158e-05f, -6.050588e-06f, -1.3249107e-06f, 2.8400604e-05f, -5.9120986e-05f, -3.6041958e-05f, 3.855942e-05f, 1.12964486e-07f, 3.272496e-05f, 3.7901067e-05f, 0.00013490653f, -6.951229e-05f, -9.681258e-05f, 0.00013758376f, -8.49173e-05f, 2.5219231e-05f, 1.9158264e-05f, -0.00010537906f, -0.00017525298f, 3.5139125e-05f, -0.000119022465f, 0.00012710236f, 3.8919512e-05f, -1.59378e-05f, 1.235963e-05f, -8.2778606e-05f, 6.053873e-06f, 4.097967e-05f, 2.8303778e-06f, -2.5379625e-06f, -6.421131e-05f, -1.7043645e-05f, 5.911484e-05f, -1.6829497e-05f, 4.1987678e-05f, -8.688109e-06f, -0.0001003021f, 4.531703e-05f, -3.7213738e-06f, -0.00010730299f, 2.3373896e-05f, 3.318755e-05f, -4.5937977e-05f, 2.5407368e-05f, 3.5689074e-05f, 1.575733e-05f, 4.810996e-05f, -2.9568906e-05f, -3.187342e-05f, 2.1291306e-05f, -0.00014137175f, -1.5617634e-05f, -6.224618e-05f, 3.5182393e-06f, 0.00010211713f, -1.941012e-05f, -7.731539e-05f, 1.753894e-05f, 6.436456e-05f, -3.3839628e-05f, 4.4039385e-05f, -4.7406615e-05f, 7.1451223e-06f, 2.563747e-05f, -7.819824e-05f, -1.0608096e-05f, -4.743997e-06f, 0.00012393676f, 6.88021e-05f, 6.33228e-05f, -8.098123e-06f, 2.5588115e-05f, 5.619685e-05f, 2.5719019e-05f, -3.1294043e-05f, 3.2374603e-05f, -8.2487495e-06f, 5.214904e-05f, 7.235104e-06f, 1.128408e-06f, 6.787758e-05f, -4.376168e-05f, -1.2877822e-05f, -6.235916e-06f, 4.8053415e-05f, 8.0401944e-05f, -2.9555382e-05f, 4.2188993e-05f, 2.626183e-05f, -3.7827747e-05f, -5.7698253e-05f, -9.4739426e-07f, 5.2535142e-05f, 8.803253e-05f, 3.4527566e-05f, 8.05415e-05f, -2.0276786e-05f, 2.1731454e-05f, -1.0114421e-06f, -2.1372502e-05f, -9.334177e-06f, -3.540886e-07f, -8.5357904e-05f, 6.744635e-05f, 4.337214e-05f, 6.3472755e-05f, -3.3686374e-05f, -3.1815183e-05f, 4.0898718e-05f, 5.4953045e-05f, -1.1528699e-05f, -8.5949956e-05f, 2.7843873e-05f, 0.00012090044f, -7.6991004e-05f, -0.00010793504f, 7.829395e-06f, 1.9254798e-05f, 3.2051445e-05f, -9.665912e-05f, -9.0974645e-05f, 1.8253864e-05f, 6.999864e-05f, -2.5746946e-05f, -9.310346e-05f, 4.3879398e-05f, -7.8224104e-05f, -0.00011328087f, 9.2020746e-05f, 5.4537308e-05f, 1.0989694e-05f, -4.2846266e-05f, -4.408474e-05f, -3.6866837e-05f, -7.612329e-05f, -4.255791e-05f, -7.980645e-05f, -0.00022233903f, 7.956108e-06f, 0.00025677696f, -0.00015272587f, -5.5702076e-05f, 0.00013468917f, -0.00010036355f, -1.78372e-05f, -0.00022051623f, 0.00018714802f, -0.0001291603f, -7.2145194e-05f, 4.872551e-05f, 0.00023790523f, 2.6272915e-05f, 8.453632e-05f, -0.00015963169f, 0.00023852478f, -9.840231e-06f, 6.591412e-06f, -0.00012166503f, -5.154963e-05f, -0.00044014247f, 0.00018822638f, 5.9201982e-05f, 9.861716e-05f, 8.3247236e-05f, 2.3527722e-05f, 8.205173e-05f, 0.00016334573f, -0.000112226175f, -5.5934884e-06f, 9.540399e-05f, -2.8938484e-05f, -0.00015455499f, -9.893503e-05f, -9.3974224e-05f, 0.0001688288f, -5.7319798e-05f, -0.00019686224f, -0.00019091326f, 0.00016640137f, -1.27592275e-05f, 4.1085896e-05f, -3.823074e-05f, 3.9462062e-05f, 0.00025365423f, 0.00014716465f, -1.0714523e-05f, 1.0941355e-05f, -7.581886e-05f, -8.121256e-05f, -0.00014216265f, -0.00011858901f, -0.00019542762f, 0.00018056591f, 0.00014825868f, -1.3792132e-05f, 0.00013699388f, 4.172299e-06f, 1.3463985e-05f, -8.0688515e-05f, -8.546817e-05f, -1.9163277e-05f, -0.00013080677f, 0.00016202035f, -5.763281e-05f, -3.0096955e-05f, -0.00010697025f, -0.00017295919f, 0.0001480306f, -3.9367835e-05f, 3.8784423e-05f, -8.14566e-05f, 8.343342e-05f, 5.9939568e-05f, 7.2620336e-05f, 7.806806e-05f, -7.356066e-05f, -0.00011500497f, -0.00024753876f, -0.00017774437f, 3.557967e-06f, -0.00012197063f, 0.00012357692f, -8.5173044e-05f, 6.4703694e-05f, -6.780502e-05f, -5.2827683e-05f, -4.4453165e-05f, -0.00017304254f, -3.6353427e-05f };
+static const float gru_layer_0_recurrent_weights[3072] = { 0.09913921f, 0.15743123f, 0.12016853f, 0.06495589f, 0.13578846f, 0.06623957f, -0.14742944f, -0.015861427f, 0.004293704f, 0.400084f, 0.2624984f, -0.10742444f, -0.13064355f, 0.31314835f, 0.10873009f, 0.29986438f, 0.1604099f, -0.022473997f, 0.35508803f, 0.04523183f, 0.09374639f, 0.13826287f, 0.20488442f, 0.07076719f, -0.13327439f, 0.11781995f, 0.1798835f, 0.46140718f, 0.2151623f, 0.06655113f, -0.4377784f, 0.07564405f, -0.28627083f, -0.06461903f, -0.06911268f, -0.05461918f, -0.16772278f, 0.13935529f, -0.09885624f, -0.38334718f, 0.054364022f, 0.14580794f, -0.10155202f, 0.06964415f, 0.09108407f, 0.09919635f, -0.27383497f, 0.14774896f, -0.016316367f, 0.035665106f, 0.2082092f, -0.15062849f, 0.13023427f, 0.41536307f, -0.25095397f, 0.11561558f, -0.35640058f, -0.3074592f, -0.08873768f, 0.3065415f, 0.16950089f, 0.1351805f, -0.23179029f, 0.12330211f, 0.03276838f, -0.20019722f, 0.02991417f, -0.10187076f, 0.16594076f, 0.0017261773f, 0.13024795f, -0.13344836f, -0.12849273f, 0.13343292f, 0.19749334f, -0.17081909f, 0.19375284f, -0.11851636f, 0.1466678f, 0.28536624f, -0.25553423f, -0.43177158f, -0.012795975f, 0.11845558f, 0.2503471f, -0.12670597f, -0.064173296f, 0.06298584f, -0.38476154f, 0.27210987f, -0.09232934f, -0.13416019f, -0.2248641f, -0.19880766f, 0.53606296f, -0.225464f, 0.109352976f, 0.34662828f, -0.18467548f, -0.3188392f, 0.24677287f, -0.22772485f, 0.15042014f, 0.18731906f, 0.19055945f, -0.3586499f, 0.04745061f, -0.099930055f, -0.29405886f, -0.40217108f, 0.2855177f, 0.21847762f, -0.05315851f, -0.13761503f, -0.4484831f, 6.703325e-05f, -0.26284721f, -0.1070146f, 0.18116868f, -0.13752921f, 0.12830627f, -0.13418221f, 0.1615196f, -0.13367526f, 0.27164894f, 0.003534045f, 0.2749513f, -0.19182818f, 0.043377466f, -0.090637416f, 0.18336923f, -0.2681131f, -0.13317649f, -0.010775607f, 0.23654313f, 0.18985099f, 0.059644874f, 0.007877804f, 0.23522785f, 0.12302744f, 0.30510372f, 0.13595608f, 0.25643283f, -0.3604092f, -0.10805361f, 0.20294902f, -0.095328525f, 0.036609717f, -0.002772929f, -0.08877212f, 0.26451433f, -0.14508305f, 0.08096284f, 0.10351768f, 0.009208622f, -0.13789824f, 0.09093124f, 0.020828381f, 0.33100304f, -0.18868938f, 0.10197388f, 0.12784222f, -0.2150864f, 0.24335359f, -0.21012059f, 0.018420065f, 0.19112688f, -0.31613958f, -0.1091224f, 0.12745498f, 0.21283051f, -0.04414217f, -0.03317567f, -0.046069186f, 0.08501999f, 0.007972122f, 0.18827078f, 0.24583618f, 0.007986766f, 0.181103f, 0.031329356f, -0.16546002f, 0.119646914f, 0.18699376f, -0.08683507f, -0.20758621f, 0.343164f, -0.11868784f, -0.054687005f, 0.08154954f, -0.34997496f, 0.43404475f, 0.26121485f, -0.17275779f, -0.082036264f, 0.24958998f, -0.30337757f, 0.103335746f, 0.19639842f, -0.058162417f, 0.06380141f, -0.0337303f, -0.08794721f, 0.014404f, 0.04836706f, -0.20819922f, 0.2584393f, -0.17799456f, 0.13214293f, 0.16122353f, 0.4225603f, -0.026201481f, 0.31831434f, 0.11531347f, 0.24978067f, 0.02590306f, 0.030331371f, 0.31897417f, -0.019354252f, 0.052571658f, -0.14888674f, -0.13427202f, 0.00020082324f, 0.44492498f, 0.01607234f, 0.11421819f, -0.179786f, 0.34602538f, 0.20659728f, -0.11810313f, -0.051452298f, -0.122364365f, 0.16508316f, -0.060181964f, -0.07619566f, 0.041263048f, 0.19736785f, -0.24246144f, -0.13685812f, -0.081745945f, 0.038396217f, 0.09716975f, 0.06918002f, 0.295938f, -0.06946413f, 0.04479055f, -0.13605443f, 0.34157276f, 0.02691959f, -0.22210585f, -0.047951087f, 0.06276233f, 0.24456412f, 0.013958195f, 0.038050395f, 0.23621677f, 0.0015153474f, -0.31828722f, -0.10630369f, 0.14888231f, -0.09803941f, 0.0030789583f, -0.3938906f, 0.12965688f, -0.052397925f, 0.055652328f, -0.087046415f, -0.08078203f, -0.085839614f, 0.08929018f, 0.0876243f, 0.28091994f, -0.046716027f, 0.16806611f, -0.2617712f, 0.014008395f, 0.10734109f, -0.009023664f, 0.21201606f, -0.26896042f, 0.14106062f, -0.09034528f, -0.057784654f, 0.03161629f, -0.1341527f, 0.16797851f, 0.056077454f, -0.324439f, 0.35151953f, 0.2934114f, -0.24697086f, 0.3053344f, 0.29846564f, 0.20027481f, 0.5365733f, 0.3034851f, 0.29434216f, -0.43663007f, -0.11531823f, 0.21617548f, 0.15920494f, -0.05441479f, 0.34036058f, -0.27105623f, 0.4692934f, 0.4916806f, 0.032485228f, 0.10612929f, 0.3284847f, -0.09979479f, -0.1144235f, 0.18822618f, 0.27885637f, 0.43313673f, -0.005122464f, -0.6914766f, 0.056783557f, -0.0396906f, 0.65440017f, 0.48819175f, -0.25853986f, -0.026690135f, 0.19061679f, 0.08147484f, 0.16656509f, -0.20920147f, 0.24957736f, 0.25977555f, 0.021858456f, -0.039979927f, 0.21206103f, -0.2614644f, -0.17041148f, -0.21238862f, 0.073105924f, -0.08151753f, 0.1018611f, -0.22182618f, -0.14656425f, 0.15541853f, -0.106571466f, -0.09955485f, 0.2811125f, -0.24530154f, 0.08142124f, -0.05102675f, -0.098972164f, 0.088548854f, -0.26802844f, 0.016105736f, 0.3925942f, 0.08101446f, -0.17571649f, 0.056445554f, 0.002057989f, 0.22209033f, 0.105997175f, 0.038469627f, 0.11932012f, -0.14606242f, -0.078421764f, -0.2678087f, -0.04792807f, 0.34775233f, 0.024958527f, 0.09449674f, -0.24804263f, -0.36269432f, 0.2894169f, 0.0845852f, 0.03692737f, 0.001463677f, -0.06637662f, -0.3562601f, 0.33758467f, -0.03274252f, 0.29643556f, -0.29104722f, 0.016857725f, 0.060142815f, 0.2063002f, 0.014971234f, 0.35499004f, 0.11600043f, 0.24921921f, -0.1625656f, 0.052118324f, 0.08712455f, -0.53303516f, -0.05823824f, 0.074333616f, 0.1682961f, -0.20930018f, 0.4007894f, 0.051163144f, -0.0102350665f, -0.070184484f, 0.2528683f, 0.005925131f, -0.15430275f, 0.27495718f, 0.31298277f, 0.16936734f, -0.22982998f, 0.44760406f, 0.2927994f, 0.028262442f, -0.12836783f, 0.17692925f, 0.33242f, -0.40924612f, -0.2650447f, -0.047167663f, -0.0134287225f, 0.09112064f, 0.10937932f, -0.016576199f, -0.11632514f, -0.147103f, 0.35209444f, -0.2731486f, -0.096140236f, -0.1864573f, -0.1940472f, -0.046425235f, 0.10183102f, -0.017453348f, -0.03985686f, -0.0503326f, -0.0098016625f, -0.1830491f, 0.15983121f, -0.18826635f, -0.1567351f, -0.2709378f, -0.2829544f, -0.16230623f, -0.028609533f, -0.21426311f, 0.16102155f, -0.23322035f, -0.18757372f, 0.13045336f, -0.018545391f, 0.16825694f, -0.10413901f, -0.29450333f, 0.16559325f, -0.03130295f, -0.13740197f, 0.008394194f, -0.24438699f, 0.11736174f, 0.13724692f, -0.25496417f, 0.053585567f, 0.17052966f, -0.022779234f, -0.14850326f, -0.12907301f, 0.044789568f, -0.1651421f, 0.028551472f, -0.036483567f, -0.21739504f, -0.04944361f, -0.28980145f, -0.073120244f, -0.0020572687f, 0.09168219f, 0.031725064f, -0.12853196f, -0.07493471f, -0.23100546f, -0.10146962f, 0.15941818f, 0.029024294f, 0.2582024f, 0.0835957f, -0.018090397f, 0.001194502f, 0.23145278f, -0.2023743f, 0.27855018f, -0.5399763f, -0.08169765f, 0.34552434f, 0.25554106f, 0.06938712f, 0.64359266f, 0.16633502f, 0.052866317f, 0.1466459f, -0.11858055f, -0.13012616f, 0.05934278f, 0.24508642f, -0.23927781f, 0.2586442f, 0.11573659f, 0.21555552f, 0.19854389f, -0.005793743f, 0.20258431f, 0.20699821f, -0.13003467f, -0.4536881f, 0.16162145f, -0.07205086f, -0.17242448f, -0.04946662f, 0.37780875f, -0.043401856f, 0.374682f, -0.16484332f, 0.09782271f, -0.050897382f, 0.02475795f, -0.2871882f, -0.23939274f, 0.15041228f, 0.008827007f, -0.09786526f, 0.09222484f, -0.1502395f, 0.07970194f, -0.2620674f, 0.019280711f, 0.1329846f, 0.006200292f, -0.1135055f, 0.13806666f, -0.31766912f, 0.031002015f, 0.30653286f, 0.17685273f, -0.035910428f, 0.06364894f, -0.24763583f, -0.11982818f, -0.0904998f, -0.09645249f, -0.17742507f, 0.18627328f, -0.21643397f, 0.11376267f, -0.031165978f, 0.15324049f, 0.05484458f, 0.33640805f, -0.16097863f, -0.24919581f, -0.054718524f, 0.012641921f, 0.033180065f, 0.14292598f, -0.029520992f, -0.0522553f, 0.23524196f, -0.17897712f, 0.18352616f, -0.019304756f, 0.1706705f, 0.26508722f, -0.38937542f, -0.082426436f, 0.029490246f, -0.08670339f, 0.30131212f, 0.020265874f, 0.14020546f, 0.121709965f, -0.2516654f, 0.257237f, -0.20333327f, 0.032004744f, -0.19343604f, 0.013544472f, 0.19929467f, -0.26109093f, 0.1581f, 0.3956352f, 0.11262917f, -0.03399571f, 0.16220626f, -0.05835737f, -0.07249096f, -0.085051484f, 0.49445626f, 0.18641633f, 0.058160663f, 0.016943509f, -0.21214992f, 0.1452749f, -0.0016073303f, 0.18251579f, 0.39463794f, 0.07460729f, 0.25029042f, -0.061422296f, 0.4240878f, -0.21988884f, 0.41103163f, 0.085160464f, 0.23048545f, -0.35377532f, 0.25536948f, -0.1816505f, 0.047247894f, -0.39645272f, 0.5390086f, -0.3150958f, 0.24370454f, 0.28937456f, -0.052149557f, 0.03743453f, -0.39262858f, -0.010845632f, 0.16651301f, -0.13863197f, 0.24397373f, 0.19676493f, -0.2353708f, -0.29000893f, -0.08772421f, -0.10498657f, 0.011463399f, -0.060524683f, 0.15672553f, -0.027432628f, 0.25543f, -0.23069808f, -0.12785102f, -0.20535776f, 0.29441297f, 0.2252714f, -0.06781288f, 0.22410727f, 0.22237737f, 0.30074912f, 0.08461278f, -0.22049867f, 0.15594472f, -0.057791565f, -0.22694515f, -0.19649535f, 0.48282167f, -0.12157638f, 0.0950726f, 0.19126518f, -0.13224064f, 0.14899999f, 0.06811676f, 0.22841461f, -0.13248193f, -0.10454966f, -0.05325371f, -0.14911343f, 0.17145832f, 0.11300432f, 0.12341136f, -0.24191184f, 0.107587405f, 0.053546406f, -0.13934155f, 0.2010142f, -0.0004382335f, 0.12485046f, -0.14397867f, -0.21953702f, -0.08307876f, 0.19779673f, -0.034509376f, -0.44164672f, -0.2829618f, -0.17450586f, -0.029221794f, -0.53903115f, -0.25823015f, -0.54373413f, -0.006681935f, -0.34203944f, -0.013916668f, 0.19665773f, -0.09372252f, -0.38624707f, -0.23959203f, 0.11486697f, 0.06284095f, 0.051871996f, -0.014721361f, 0.11755591f, -0.1979418f, -0.29938686f, 0.008967751f, -0.1714507f, -0.14191578f, -0.3089584f, -0.11028505f, -0.09986234f, -0.42120942f, -0.060203247f, -0.05131405f, 0.064645395f, 0.2365397f, -0.08586099f, -0.15145239f, 0.406463f, -0.025569282f, -0.047464207f, -0.18393725f, 0.22920729f, 0.14710271f, 0.15729819f, -0.05814056f, -0.14958104f, -0.09739498f, 0.09674839f, -0.20183423f, -0.1055901f, 0.099806435f, -0.10825256f, 0.14536479f, 0.049619928f, 0.127076f, -0.10318081f, -0.1880248f, 0.063107245f, -0.014686621f, -0.14024878f, -0.02157662f, -0.19857214f, -0.20174702f, -0.15401945f, -0.24224165f, 0.09723608f, -0.10277737f, -0.07310887f, 0.031900413f, -0.17551637f, -0.051538482f, -0.12710637f, -0.18485603f, 0.008005344f, -0.37959698f, -0.12784177f, -0.26445284f, -0.19053857f, -0.006110228f, -0.047126014f, -0.2780158f, -0.23609869f, -0.24618146f, 0.21306673f, -0.27811414f, -0.3212812f, 0.053567033f, 0.03003389f, -0.011978194f, 0.06331829f, 0.24162132f, -0.10609326f, -0.067725815f, -0.02618265f, 0.010600438f, -0.22380596f, -0.10371165f, 0.101676404f, -0.1927699f, -0.2593311f, -0.11535567f, 0.014199329f, -0.0056461454f, -0.2767174f, 0.35973743f, 0.08152773f, 0.12322443f, -0.10277802f, -0.11290417f, -0.08037273f, 0.062340923f, -0.16020735f, 0.23804557f, -0.10274831f, 0.10879938f, 0.20885313f, -0.34744388f, -0.124454625f, 0.40752935f, -0.058946036f, 0.23958454f, -0.07980056f, 0.18578288f, 0.26492834f, 0.029887835f, -0.16156018f, -0.34308338f, 0.11199405f, 0.26240298f, 0.22534423f, 0.015945408f, -0.07424341f, 0.33259445f, -0.18632999f, -0.42739105f, -0.047164112f, 0.114046074f, 0.3975553f, 0.20529306f, 0.033269472f, -0.032165214f, -0.17376742f, -0.08486239f, -0.0068285195f, 0.08142814f, -0.017275216f, 0.12167148f, -0.1276092f, -0.31889606f, 0.1522272f, -0.28813598f, 0.03396025f, 0.46820346f, 0.10166062f, 0.1825799f, -0.067396335f, -0.17951371f, -0.1555723f, 0.2909633f, -0.11408428f, 0.19559075f, -0.01349018f, -0.4050817f, 0.17661266f, 0.24469417f, 0.59968925f, 0.27890503f, 0.36272135f, -0.21291827f, 0.00045301422f, 0.42674035f, -0.03312573f, -0.07299624f, 0.23631386f, -0.03457478f, -0.33462155f, 0.279913f, -0.091770165f, 0.2218954f, 0.46737844f, 0.13322812f, -0.04852773f, 0.11113989f, -0.21202062f, 0.045623135f, -0.28605285f, 0.2546176f, -0.39099333f, -0.22632138f, 0.123822406f, 0.3313502f, 0.02047288f, 0.32975775f, -0.08454147f, 0.17699328f, -0.13962667f, 0.10681355f, 0.21947141f, 0.5151249f, 0.21458545f, -0.47560728f, -0.08296773f, 0.08445654f, 0.10320694f, 0.07928921f, -0.2900925f, 0.261881f, -0.19872938f, 0.44184503f, 0.08970986f, 0.060455516f, -0.29679725f, -0.23378588f, -0.16454622f, -0.10275839f, 0.051041532f, 0.39523438f, -0.32826817f, -0.33481115f, 0.0819605f, 0.59468f, 0.29234537f, 0.09391772f, -0.033308625f, -0.053385757f, -0.00021041138f, 0.17834675f, -0.1477048f, 0.14176778f, 0.35094437f, 0.08367015f, -0.00028257916f, 0.3605075f, -0.09995955f, 0.020640628f, 0.11118868f, -0.18379886f, 0.048393913f, 0.16846997f, 0.26865733f, 0.016090872f, -0.09332156f, 0.10668165f, 0.36253226f, -0.041200932f, -0.09600367f, 0.12051136f, 0.118962586f, -0.18312855f, 0.035361387f, 0.19938572f, 0.47196037f, 0.1425433f, -0.28478703f, -0.089794986f, 0.025486575f, -0.35431212f, 0.02204916f, -0.17118078f, -0.054987404f, 0.10935618f, -0.07374354f, -0.09647236f, -0.08163379f, 0.37704176f, -0.028319102f, -0.10027282f, 0.111313105f, 0.06341177f, 0.046758313f, 0.124881685f, 0.037470818f, -0.029492384f, 0.16396885f, 0.09783148f, -0.11825284f, -0.1924867f, -0.16899726f, 0.33550113f, 0.24424125f, -0.0775196f, -0.1409543f, -0.045046013f, 0.032594267f, 0.011539121f, -0.15240547f, -0.009991097f, -0.17692895f, -0.1616814f, 0.016514663f, -0.23999959f, 0.42699233f, 0.060171925f, -0.019185845f, -0.005024542f, 0.0034389077f, 0.43024373f, -0.24055827f, 0.2816924f, -0.2089236f, 0.120181516f, 0.10109632f, -0.34631878f, 0.0592518f, 0.039503384f, 0.1136398f, -0.2516754f, -0.17980437f, -0.047982763f, -0.20087677f, 0.16982062f, -0.32007045f, -0.2321007f, -0.013064402f, 0.188235f, -0.050117206f, -0.36623988f, -0.085847765f, -0.03548007f, 0.18727492f, 0.09266293f, -0.03256792f, 0.045604113f, 0.038693428f, 0.22890924f, -0.1699265f, -0.13255833f, -0.048644118f, -0.009840566f, -0.028284403f, -0.20149179f, 0.09411978f, 0.015940772f, -0.1564091f, -0.2454661f, 0.22284749f, 0.074121684f, -0.15835644f, 0.07983372f, 0.21252656f, 0.09740174f, -0.16454571f, -0.03574541f, -0.050092127f, 0.18290374f, 0.055514418f, -0.15035802f, 0.18723896f, -0.062379986f, -0.0675941f, 0.13738854f, 0.32247937f, 0.33224592f, -0.15735136f, 0.004086587f, 0.33507416f, -0.06845363f, 0.03670395f, -0.020646673f, 0.0018822275f, 0.18658158f, -0.3165952f, 0.22810708f, 0.13700283f, 0.28109294f, 0.2037375f, -0.21486475f, 0.15527456f, 0.20064777f, -0.22928658f, -0.17421459f, -0.102511026f, 0.34834337f, 0.1348702f, -0.19314179f, -0.35284027f, -0.04731746f, 0.03206234f, -0.018939504f, 0.0018730148f, 0.096341364f, -0.33057582f, -0.051695667f, -0.07445131f, 0.015273443f, -0.049511302f, 0.36851585f, 0.2129695f, -0.41829205f, -0.06209678f, -0.10268368f, -0.18717521f, 0.16143623f, 0.123236716f, 0.39810473f, -0.3300152f, -0.38051888f, 0.4353442f, -0.20733851f, -0.4029837f, 0.41661242f, -0.13941689f, 0.20435123f, 0.5207996f, -0.14430408f, 0.019008609f, 0.0381115f, -0.10087248f, -0.17869127f, 0.062855855f, 0.090448454f, 0.33204526f, 0.012485324f, -0.261058f, 0.2426184f, -0.003195474f, 0.28112864f, 0.4373112f, -0.06347509f, -0.19694386f, 0.09199313f, -0.14311835f, 0.30525985f, 0.027701937f, 0.13998091f, 0.57954514f, -0.078905836f, -0.37931326f, 0.2546188f, -0.0866847f, -0.28414884f, -0.20203462f, -0.11664477f, -0.3126603f, -0.06426719f, -0.2594293f, 0.03490996f, 0.049952056f, 0.06836639f, -0.24142484f, 0.011494936f, 0.14016064f, 0.20668803f, 0.11946102f, 0.12853347f, -0.089157805f, -0.30613533f, 0.16299997f, 0.23300777f, -0.091868065f, -0.012434085f, 0.019704828f, 0.22252157f, -0.023192313f, 0.07600319f, -0.09626066f, -0.20989329f, 0.13853168f, 0.04478313f, -0.1895901f, -0.28632545f, 0.14561695f, -0.16071986f, 0.22895911f, 0.040253937f, 0.10071244f, 0.13095129f, 0.006945797f, 0.0053220238f, 0.14818898f, -0.107296504f, -0.23707557f, 0.17985442f, 0.04573928f, 0.39201757f, -0.14635085f, 0.1933327f, -0.14485218f, 0.1984503f, 0.36987692f, -0.3399028f, 0.39630324f, -0.15561473f, -0.4951049f, 0.29134858f, -0.10859751f, -0.31452438f, 0.015205046f, -0.21462522f, -0.10672855f, -0.38400415f, 0.16337414f, 0.048037495f, -0.14840396f, -0.23580062f, 0.22688425f, -0.6461057f, -0.14776862f, 0.28153083f, 0.25891098f, 0.4095353f, -0.40138155f, -0.14384805f, 0.38969117f, -0.31630245f, 0.45284998f, -0.06764657f, 0.22835058f, 0.041688293f, 0.15971728f, -0.0099588055f, -0.0794842f, -0.438962f, -0.088053174f, 0.09299649f, -0.1354348f, 0.21242547f, 0.26585546f, 0.039176594f, 0.22450599f, -0.03140104f, -0.165882f, 0.008735923f, 0.35624796f, -0.13873821f, 0.097505845f, -0.23094991f, -0.20938043f, -0.017848572f, 0.24326491f, -0.1108965f, 0.02740845f, 0.09769361f, 0.09940534f, 0.20280182f, 0.16353552f, -0.34720457f, -0.15302888f, -0.06721802f, -0.059859533f, 0.046262126f, -0.141894f, -0.20284653f, 0.091035694f, -0.21830013f, 0.12870885f, 0.13791916f, -0.09879301f, -0.12915877f, -0.3910688f, 0.25692502f, -0.34327495f, -0.0049871616f, 0.29961464f, -0.4162646f, 0.1767187f, -0.39318195f, -0.26925406f, 0.27621576f, -0.19993144f, -0.46096292f, 0.099005416f, -0.3374744f, -0.016757524f, -0.2252603f, -0.32286072f, 0.3581455f, -0.058809843f, 0.08807818f, -0.17864117f, -0.17657027f, 0.033751242f, -0.38728485f, 0.3581806f, -0.011633796f, -0.27488902f, 0.41739133f, -0.46745944f, -0.2151425f, -0.045973584f, 0.08597596f, -0.14794731f, 0.6242023f, 0.31986985f, -0.3900055f, -0.08336041f, 0.064810656f, -0.3797446f, -0.21478897f, -0.31576642f, 0.2779196f, -0.0012479476f, 0.19905767f, -0.25630823f, -0.0626064f, -0.0021234069f, -0.30400848f, 0.17704786f, -0.27205315f, -0.10119409f, -0.05729942f, -0.20280029f, -0.02464089f, -0.39000052f, 0.70180243f, -0.1416775f, 0.17592326f, 0.17381854f, 0.072946385f, -0.308228f, 0.41414383f, -0.007653035f, 0.17181684f, -0.15517494f, -0.06363766f, 0.0750958f, -0.013421124f, -0.12509708f, -0.40087974f, 0.024288537f, -0.1038948f, 0.29069427f, 0.14741637f, 0.25624722f, -0.012661626f, -0.29777482f, 0.23685247f, 0.040273063f, 0.02069728f, -0.13323013f, 0.18911716f, -0.35617203f, 0.18135244f, -0.052215118f, -0.04468338f, 0.33863968f, 0.060581055f, -0.10506481f, -0.31656936f, 0.05651017f, 0.0048846807f, 0.12156569f, 0.19514054f, 0.07589157f, -0.2729979f, -0.09057144f, -0.2516839f, -0.24098529f, 0.17004912f, -0.1723619f, -0.3003893f, 0.21889926f, -0.056840148f, -0.1347081f, -0.14153059f, 0.11156274f, -0.08694274f, -0.12705739f, 0.034346517f, -0.27837032f, 0.1906158f, 0.08049045f, 0.30601606f, 0.12662512f, -0.12150759f, 0.3539498f, 0.020170225f, 0.12588312f, 0.04423054f, -0.38295195f, -0.2678297f, -0.1276343f, -0.29113284f, 0.37881252f, -0.26515904f, 0.4392671f, -0.14479554f, -0.08624098f, 0.24946952f, 0.24023351f, 0.31649235f, 0.17372963f, 0.51536775f, 0.09158633f, -0.33340487f, 0.13445778f, 0.28013387f, 0.1747911f, 0.5496037f, -0.18189515f, 0.06314944f, 0.24611394f, -0.21220808f, -0.11347982f, 0.22683491f, -0.3732819f, 0.25423828f, -0.12900183f, 0.3034932f, -0.13155209f, -0.1593741f, -0.037751507f, 0.12243206f, 0.25307018f, 0.37699723f, 0.107373334f, -0.21839385f, 0.1935135f, 0.008050299f, -0.099383555f, -0.2509438f, 0.079009496f, -0.11686428f, 0.04794139f, 0.056481812f, -0.017041355f, -0.09082614f, -0.08934853f, -0.20481429f, 0.1762852f, -0.19188677f, -0.12779906f, -0.17381658f, 0.1828151f, 0.1147491f, 0.12393857f, 0.06814177f, -0.16165635f, 0.4923241f, -0.016606014f, 0.10557361f, -0.05546196f, -0.36527115f, -0.0063761864f, 0.07703655f, 0.063397445f, 0.46797544f, 0.033342075f, -0.19153148f, 0.116461f, -0.056678243f, 0.29986387f, -0.19241995f, 0.32182452f, 0.24688035f, -0.47451347f, 0.40277532f, -0.2733349f, 0.023881454f, 0.012752771f, -0.10248339f, -0.021973275f, 0.047292113f, -0.13504207f, 0.42306817f, -0.01507584f, 0.3525829f, 0.09143598f, -0.31234205f, -0.20437452f, 0.3922757f, 0.17827493f, -0.04166752f, -0.17663574f, 0.10158128f, -0.2945289f, 0.032272715f, 0.044608876f, -0.07299068f, 0.28111035f, 0.19227405f, 0.2048352f, -0.009303051f, 0.18177389f, -0.044956166f, 0.04071244f, -0.020529436f, 0.15646724f, -0.20234357f, 0.3136211f, 0.23651835f, 0.20757209f, -0.11789393f, 0.5209539f, -0.0784024f, 0.10428506f, -0.04088423f, 0.025328707f, 0.44421726f, 0.067827f, -0.20323564f, 0.2717312f, -0.10540698f, 0.12896615f, -0.04185218f, 0.0107357595f, -0.20421022f, 0.4330477f, 0.11900815f, -0.19299136f, -0.2603061f, 0.21467677f, -0.20703292f, 0.22367746f, -0.29709783f, 0.11198786f, 0.17720228f, 0.38434073f, -0.22136135f, -0.1718587f, -0.059882198f, 0.1255513f, 0.16755605f, -0.08310375f, -0.2299565f, -0.05814567f, -0.11052322f, -0.01883407f, -0.123757884f, 0.3290299f, 0.021139493f, 0.031507246f, -0.21354038f, 0.29755157f, 0.028721312f, -0.031016048f, -0.1285697f, 0.09965922f, 0.08590852f, 0.25075758f, -0.0034570545f, 0.05798721f, -0.1246611f, 0.048858266f, 0.28898296f, -0.08470223f, -0.31136775f, 0.023619786f, -0.06862655f, -0.023254186f, -0.21647088f, -0.11774535f, 0.1557617f, 0.024083879f, 0.14133683f, -0.38488412f, -0.065324806f, 0.12877682f, -0.19402923f, 0.09804788f, -0.14706063f, -0.23132323f, 0.20278761f, 0.013059653f, -0.10940337f, -0.035763733f, -0.016406354f, -0.06890186f, -0.2132969f, 0.21601541f, -0.10098881f, -0.07857919f, -0.118516706f, 0.09155745f, 0.45865723f, -0.17301762f, 0.42316747f, 0.28995076f, -0.42181867f, 0.24796858f, 0.07410257f, 0.12004516f, 0.18189418f, 0.18617003f, 0.23453923f, -0.21027182f, -0.29415402f, 0.44809976f, -0.19519521f, -0.30209154f, 0.109216504f, -0.32547504f, 0.42568168f, 0.237425f, -0.27731746f, 0.042671107f, 0.40248692f, -0.30939138f, -0.052101653f, -0.08211062f, 0.25643724f, 0.23776306f, -0.03446874f, -0.30625233f, 0.16553253f, 0.05648413f, 0.46820483f, 0.34159356f, 0.14346062f, -0.19851623f, -0.10530333f, 0.16811535f, 0.092999265f, -0.42365703f, 0.20563377f, 0.22832009f, -0.1290484f, -0.26495567f, 0.13584338f, 0.07040558f, 0.17395765f, -0.14533053f, 0.23485494f, -0.28838482f, 0.11736942f, -0.2876655f, 0.043779932f, 0.19735144f, -0.20982297f, -0.3611774f, 0.15591994f, -0.06618721f, 0.18877435f, 0.15131702f, 0.118169755f, 0.06445015f, -0.3412883f, -0.08723038f, 0.39103875f, 0.1323665f, 0.032272782f, -0.045161355f, 0.18073766f, 0.3291791f, -0.21434075f, 0.2869984f, -0.035974428f, 0.1313367f, -0.011034007f, -0.03714406f, 0.047853056f, 0.28346157f, -0.29041782f, -0.11261032f, 0.08910425f, -0.18836482f, 0.31864047f, 0.24807674f, -0.1619884f, 0.16879082f, -0.21128085f, -0.2979872f, 0.27254584f, 0.14125507f, 0.20228176f, -0.26177558f, 0.25076425f, -0.023807045f, 0.1706777f, 0.2666298f, -0.09937907f, 0.18662494f, -0.14933693f, 0.21454476f, -0.29079312f, 0.122135684f, -0.065592684f, -0.5312207f, 0.5006579f, 0.36437172f, 0.31056684f, -0.3249507f, -0.32355857f, -0.028205225f, -0.14395829f, -0.2939726f, 0.07866391f, -0.029111622f, 0.111178055f, 0.27197552f, -0.32661825f, -0.11739839f, -0.27090567f, -0.08030163f, -0.088719316f, 0.06190172f, 0.35933f, 0.13227975f, -0.3863233f, -0.4061696f, 0.10173214f, 0.29212233f, 0.08642025f, 0.12372304f, -0.26194665f, 0.07379697f, 0.066254206f, 0.2276687f, -0.27482903f, -0.29443172f, -0.16995244f, 0.1820105f, -0.040843826f, 0.028319066f, -0.08573937f, -0.2551392f, -0.07548875f, -0.48163825f, -0.01077789f, 0.06341383f, -0.16690205f, 0.00471685f, -0.16902941f, -0.04924308f, 0.09173039f, -0.023412667f, 0.13348912f, 0.06597686f, -0.04518571f, 0.012720981f, -0.12987064f, -0.25559324f, 0.095047f, 0.049332812f, 0.0060375747f, -0.160103f, -0.27297983f, 0.21490516f, -0.015579748f, -0.06511816f, 0.16017321f, -0.15584257f, -0.060366124f, -0.18945296f, 0.08663128f, 0.015631216f, 0.040251564f, 0.37699452f, 0.0204019f, -0.04436034f, -0.05651878f, -0.0152868815f, 0.123942226f, 0.082958564f, 0.27835035f, 0.18305454f, -0.10022733f, -0.25529075f, 0.38236082f, -0.01675022f, 0.14282024f, -0.35583544f, 0.015165245f, -0.1276545f, 0.25676537f, 0.27802438f, 0.0007190643f, 0.0021948912f, -0.15969633f, 0.44334072f, -0.06294046f, -0.114252426f, 0.15966354f, 0.08072316f, 0.11280687f, 0.12450516f, 0.3471954f, -0.31239933f, 0.047863398f, -0.13239458f, -0.22413771f, 0.06112006f, -0.1409566f, -0.31110415f, -0.12288695f, -0.13893238f, -0.30692932f, 0.17961964f, 0.001847594f, -0.13172612f, -0.26453203f, 0.42805123f, 0.54521185f, 0.088278085f, -0.26294816f, -0.33240247f, -0.017345723f, 0.22627653f, 0.1388187f, 0.03969016f, -0.21706869f, -0.012142569f, -0.112338714f, -0.2217591f, -0.108752765f, -0.27250323f, -0.20572129f, 0.17018896f, -0.35127655f, -0.072811484f, 0.36161828f, -0.10225532f, 0.047137957f, 0.19124182f, -0.13929501f, -0.14177512f, -0.31448644f, 0.1775484f, -0.12672952f, 0.24987803f, 0.29152212f, 0.13190667f, 0.116514094f, -0.17892699f, 0.12364204f, 0.08034667f, 0.047406577f, 0.2209115f, -0.14936993f, 0.12680493f, 0.37067348f, -0.28704542f, -0.06760254f, 0.29030347f, -0.17383067f, 0.15599866f, -0.21876287f, -0.03257326f, 0.0019135436f, 0.09078794f, 0.25908196f, 0.010745132f, 0.3153606f, 0.06446908f, 0.08536715f, 0.21860121f, 0.24951285f, -0.3110051f, 0.16762269f, 0.122267485f, 0.1305067f, 0.16424927f, -0.22609098f, -0.27950555f, -0.022871519f, 0.1681037f, 0.03222133f, 0.2565155f, 0.061109867f, -0.390766f, 0.28239772f, -0.24549751f, 0.13558851f, 0.14267825f, -0.16000919f, 0.07248203f, 0.0837322f, 0.06427948f, 0.078445725f, 0.48224127f, 0.34646028f, 0.36331245f, 0.25245205f, -0.247415f, -0.15860143f, -0.24351777f, -0.055591363f, 0.15601961f, 0.20497152f, 0.073561005f, -0.12693092f, 0.00024429362f, -0.3188752f, 0.14012758f, 0.17078146f, -0.07132458f, 0.020523867f, -0.08707922f, 0.16892439f, 0.27427197f, 0.1271558f, -0.052008446f, 0.2661967f, -0.13995023f, 0.2672214f, 0.115031354f, 0.024103235f, 0.28825945f, 0.18721606f, -0.32692197f, -0.06614417f, 0.14685437f, -0.058110762f, 0.11669139f, -0.15391785f, -0.1841135f, 0.24895771f, -0.031038845f, -0.020534448f, 0.14422457f, -0.15853918f, -0.054803893f, 0.0912321f, 0.24097992f, -0.019194938f, 0.16189477f, 0.020214103f, -0.02663869f, 0.0036338384f, -0.07353512f, 0.09742808f, -0.047036592f, 0.10661169f, 0.18021564f, 0.12025012f, 0.101459034f, 0.46366704f, 0.10294689f, 0.16412629f, -0.14479825f, 0.13940454f, 0.12900199f, -0.112138845f, -0.1967874f, 0.30392238f, -0.34756008f, 0.32123262f, -0.14398368f, 0.19724871f, 0.05051373f, -0.062506996f, -0.046513684f, 0.05483383f, -0.0040449114f, 0.1821137f, -0.10995985f, -0.07450201f, 0.021129522f, -0.19738984f, -0.22392328f, 0.26679474f, 0.36141637f, -0.0013946635f, 0.20215684f, -0.054383766f, -0.22377126f, 0.009333726f, 0.13340952f, 0.0023661011f, 0.16541174f, 0.07520672f, -0.16539386f, 0.14291613f, -0.11720028f, -0.08580009f, -0.122837454f, 0.14381416f, 0.06849147f, -0.23193313f, -0.2426068f, 0.07369084f, 0.25395274f, -0.03790969f, -0.06533943f, -0.46879753f, 0.021753857f, 0.20439976f, 0.0054823193f, 0.3034717f, 0.19604285f, -0.045246586f, -0.010347177f, 0.096268505f, 0.23778796f, 0.27410865f, 0.46178824f, 0.407061f, 0.37615448f, -0.11651479f, -0.19062869f, -0.44446304f, -0.14303973f, 0.02400212f, -0.09511651f, -0.0036116885f, 0.076652884f, -0.014631882f, 0.35563302f, -0.13228224f, -0.3195695f, 0.35660464f, 0.17310333f, -0.099184416f, 0.043687936f, -0.10567683f, -0.20700635f, -0.19944535f, 0.004716078f, 0.07390243f, -0.20979908f, -0.1056855f, -0.02891694f, 0.26590624f, 0.19989598f, -0.21357757f, -0.23166113f, -0.1890255f, -0.06931126f, 0.13019821f, 0.16512859f, -0.07114521f, -0.035066195f, -0.19824362f, 0.14631046f, 0.31125438f, -0.21504192f, 0.06190236f, 0.079080105f, 0.11116589f, -0.26084206f, 0.08828784f, -0.18133816f, 0.06609554f, 0.16296387f, -0.03850226f, -0.40604135f, 0.15436795f, -0.16311632f, -0.035578117f, 0.014251334f, 0.10126106f, -0.07786226f, -0.29306772f, 0.012603579f, 0.32036117f, -0.022051876f, -0.0058389665f, 0.25557953f, -0.23678523f, 0.057507906f, -0.24951635f, 0.20607722f, 0.02237553f, 0.07369822f, 0.22505745f, -0.51675665f, 0.016749464f, -0.19743802f, 0.22529207f, 0.2408762f, -0.1633463f, 0.104863465f, -0.16569604f, 0.0594249f, -0.045002073f, 0.3486232f, -0.2554168f, -0.040360842f, 0.46904933f, 2.251071e-05f, 0.005207561f, 0.13362628f, 0.079185024f, 0.013512455f, 0.0633827f, 0.07410449f, 0.075154f, 0.3275721f, 0.12049629f, -0.27155268f, -0.40376472f, -0.34770018f, 0.37257937f, 0.13903916f, -0.11122532f, -0.016832072f, 0.14249212f, 0.116916075f, 0.5009038f, -0.071381666f, -0.050772455f, 0.16218475f, 0.10684744f, -0.057692453f, 0.22975877f, -0.08605281f, -0.03687911f, 0.13469581f, -0.22952092f, 0.43871075f, 0.3439259f, -0.034586977f, 0.22893693f, 0.51257616f, 0.49038577f, -0.059407458f, 0.2219698f, -0.14212483f, -0.14878184f, -0.29238153f, -0.3527902f, 0.26475486f, 0.18090512f, 0.070813216f, 0.09017201f, -0.36406824f, 0.006080785f, -0.20954224f, -0.19688502f, 0.14471538f, 0.17957386f, -0.104284205f, -0.02471446f, -0.13386333f, 0.1363244f, 0.1597941f, -0.2309903f, -0.042960066f, -0.09084043f, 0.1757709f, -0.09483353f, -0.09128962f, -0.038918655f, 0.053408124f, 0.0862598f, -0.071326874f, 0.039791923f, -0.19552049f, 0.045085695f, -0.08857381f, 0.17338593f, 0.101982996f, 0.004440459f, -0.30415964f, 0.17812845f, -0.09714078f, -0.04808956f, 0.1562435f, -0.20540686f, -0.24971494f, -0.39285076f, -0.29664797f, -0.092137806f, 0.15170363f, -0.15274273f, 0.25313684f, 0.23040706f, 0.19363907f, 0.20675537f, 0.13612674f, 0.32877123f, 0.052191425f, -0.117332235f, 0.13449396f, 0.1672606f, 0.09740163f, 0.34994176f, -0.1218972f, 0.11635641f, 0.17471135f, -0.13705246f, 0.054187182f, 0.19585775f, 0.10956028f, -0.091083385f, -0.21702018f, 0.391032f, 0.04862188f, 0.25353715f, -0.03569329f, 0.164037f, 0.27377558f, 0.46857715f, 0.2881568f, -0.083226606f, 0.17160939f, 0.12730901f, 0.037922747f, 0.10290763f, 0.009266573f, 0.16012485f, -0.12644538f, -0.20905377f, 0.05299365f, -0.029290287f, -0.11755781f, -0.028572034f, 0.17613298f, -0.19537781f, -0.14034224f, -0.034644943f, 0.24751958f, -0.22813877f, 0.0652658f, 0.06493194f, -0.065245196f, 0.28742498f, -0.025504883f, 0.1635956f, 0.020395521f, -0.092675336f, 0.12466202f, -0.1529759f, 0.13534066f, 0.27391258f, 0.108908884f, 0.022378854f, 0.10643411f, -0.107555576f, 0.12511925f, 0.20392966f, -0.110615835f, 0.2073456f, -0.2054199f, 0.06451102f, -0.25221828f, -0.17044711f, 0.25640357f, -0.24290943f, 0.14324996f, -0.028303001f, 0.007728297f, 0.002569083f, 0.17129779f, -0.126371f, 0.12464056f, -0.019261084f, -0.15474342f, 0.16495194f, 0.20210847f, 0.15721637f, -0.17943157f, -0.25253284f, 0.035265025f, -0.12968731f, -0.024512922f, 0.075651094f, -0.13911705f, 0.007122852f, 0.24194694f, -0.0043650093f, -0.13683508f, 0.41314375f, 0.3088692f, 0.507482f, 0.19293047f, 0.02746402f, -0.29773214f, -0.14085622f, -0.19980666f, 0.16311654f, 0.2542557f, 0.36083826f, -0.14302407f, -0.17223069f, -0.13221449f, -0.23339532f, 0.03279993f, 0.41914827f, -0.43478322f, -0.11304279f, 0.14773352f, 0.5405859f, 0.004039635f, 0.22594343f, -0.08397918f, 0.23025542f, 0.19285037f, 0.40460095f, -0.23723719f, -0.21735752f, 0.21297917f, 0.07939052f, 0.026940776f, -0.11657256f, -0.10781818f, -0.07305472f, -0.117302984f, 0.05223094f, 0.016832229f, 0.17963552f, -0.06553025f, 0.17119148f, -0.18994012f, 0.07143422f, -0.034784816f, -0.118210755f, -0.06283051f, -0.16603078f, -0.2055415f, 0.24069364f, 0.18309785f, 0.33206636f, -0.19545849f, 0.07178046f, -0.06867494f, -0.14487857f, -0.075395286f, 0.0986071f, 0.0652932f, 0.3373841f, 0.14112075f, 0.110781685f, 0.119177416f, 0.0059478893f, 0.25151289f, -0.10494861f, -0.057437867f, 0.46327478f, -0.30174127f, 0.25541997f, 0.036512457f, 0.23097533f, 0.030381653f, -0.08571669f, 0.23052457f, -0.07976211f, 0.0056528365f, 0.1913953f, 0.102162875f, 0.13751243f, 0.3432426f, -0.07827415f, -0.19188356f, 0.0011616293f, 0.20883103f, -0.015458638f, -0.0016516006f, 0.03053641f, -0.24006847f, 0.111008555f, -0.19183776f, 0.2676483f, 0.21991828f, 0.12313556f, -0.13987364f, 0.029997768f, 0.063760005f, -0.20099689f, -0.19907339f, 0.1827994f, -0.07805797f, 0.27029216f, 0.029427232f, -0.25205365f, 0.1982857f, -0.31162268f, -0.040747877f, 0.19565438f, -0.09700878f, 0.36607757f, 0.05422488f, 0.27377963f, 0.22399794f, -0.30937085f, 0.17243041f, 0.11290757f, 0.089132845f, -0.1503281f, 0.12099944f, -0.1639546f, -0.11925249f, 0.033367362f, 0.21971405f, -0.1255317f, 0.27989623f, 0.0716335f, 0.17815131f, -0.25108075f, -0.014644384f, -0.08318907f, 0.05503865f, -0.22184855f, 0.27949885f, 0.15338796f, -0.08114242f, 0.119474046f, 0.19751881f, -0.015754499f, -0.30498055f, 0.23901667f, -0.27173182f, -0.02417308f, -0.102229685f, 0.50913113f, 0.26065943f, -0.17786092f, 0.2324407f, -0.17512311f, 0.17590961f, 0.06469704f, 0.38339466f, -0.15573683f, 0.19815439f, 0.08114639f, 0.06663335f, -0.05427625f, -0.14845762f, 0.15575321f, 0.18061085f, -0.076216005f, -0.18024242f, 0.025438767f, -0.21912676f, -0.37414548f, 0.17830388f, -0.2398711f, -0.21484263f, 0.14037581f, 0.047362268f, -0.060174238f, 0.12232799f, -0.10609008f, 0.116236396f, -0.016369047f, 0.029466549f, 0.118467376f, -0.15501231f, -0.012955407f, 0.09490428f, -0.20904553f, 0.10735044f, -0.08180022f, 0.032947578f, -0.10430165f, -0.1562187f, 0.2450088f, 0.21841441f, -0.07863545f, -0.011537236f, -0.060250062f, -0.21571362f, 0.24870071f, -0.12183006f, -0.004599803f, 0.23497522f, -0.19850358f, -0.22953129f, -0.19953837f, 0.26255727f, 0.097003356f, -0.23330215f, 0.37143773f, 0.5227271f, -0.18258475f, -0.043623094f, -0.1276911f, -0.17575672f, 0.1919969f, -0.14133617f, 0.12651818f, -0.29664886f, -0.19680779f, -0.083278246f, -0.19715199f, 0.11999301f, 0.1742786f, 0.23948614f, 0.092567384f, -0.002283194f, -0.14679816f, -0.38916782f, -0.27154943f, 0.028385973f, 0.06686484f, -0.3640771f, 0.006749684f, 0.33283296f, 0.07965316f, -0.27073875f, -0.1561997f, 0.16293979f, -0.19947822f, -0.059605636f, 0.05989649f, 0.34354383f, -0.077256195f, -0.06692527f, -0.23971438f, 0.19696787f, -0.21083848f, -0.22010508f, 0.017520802f, 0.31595328f, -0.108419396f, -0.3053652f, 0.03260791f, -0.283363f, -0.19688988f, 0.27089232f, 0.14244175f, 0.32553998f, -0.14274628f, 0.059022073f, 0.000649405f, -0.09816936f, -0.24558379f, 0.087132335f, -0.13012469f, 0.20274213f, 0.2663373f, 0.021717211f, 0.14450218f, 0.19228303f, 0.188922f, -0.21617961f, 0.049716644f, 0.121223934f, -0.114653684f, 0.14705804f, -0.07483636f, -0.13454416f, 0.21508951f, 0.1282572f, 0.2189902f, -0.07446814f, -0.11480652f, 0.31310552f, -0.16717784f, 0.16732311f, -0.1548117f, 0.039196126f, -0.24008726f, -0.2694565f, 0.35122687f, -0.23551422f, -0.012295711f, 0.17752278f, -0.08783398f, 0.17213412f, 0.47119337f, 0.2663842f, -0.3126935f, -0.03777335f, 0.5018263f, -0.15567458f, 0.027981726f, -0.11480712f, 0.14560767f, -0.19404778f, 0.32485443f, 0.06701223f, -0.2601221f, -0.087898016f, -0.27943465f, 0.015263749f, -0.10907452f, -0.17217058f, 0.19439396f, -0.15398535f, -0.15287693f, -0.25186282f, -0.0019029463f, -0.07613665f, -0.08260377f, 0.08080339f, 0.16985582f, -0.17460476f, -0.07967743f, 0.005951152f, 0.41109523f, -0.119763084f, -0.21117412f, 0.029553542f, 0.14022098f, -0.0011877574f, -0.26456338f, -0.18101546f, 0.18230405f, 0.12828264f, 0.1663675f, 0.049134586f, 0.1277664f, -0.13287935f, -0.08200682f, 0.0632439f, -0.20268188f, 0.20974103f, 0.21267512f, -0.2706176f, 0.15357895f, -0.21454208f, -0.092733465f, -0.030109232f, -0.011068996f, -0.13055602f, 0.07191385f, 0.19537464f, 0.28190607f, 0.24787521f, -0.38373256f, -0.0030020026f, -0.13493508f, 0.15804769f, -0.23048344f, 0.11263555f, 0.017139157f, 0.08591748f, 0.05982644f, -0.050743647f, 0.10970216f, 0.27532452f, -0.28930718f, 0.15351453f, 0.038715627f, 0.13056798f, 0.23912786f, -0.048908364f, -0.022821879f, -0.19572712f, -0.2751846f, 0.01648428f, -0.021758482f, 0.16068026f, 0.13899651f, -0.14769216f, 0.33772495f, -0.2970503f, 0.17937955f, 0.05591565f, 0.14944977f, 0.19242619f, 0.042287137f, -0.36448875f, -0.001723849f, 0.2623237f, -0.3675785f, 0.046268072f, -0.09247684f, -0.061086353f, -0.32758483f, -0.09545238f, -0.3275533f, 0.30350995f, 0.2603021f, -0.07020352f, 0.010385651f, 0.09906074f, 0.13873485f, 0.054541677f, -0.115440145f, -0.091606006f, 0.40432426f, 0.24590741f, 0.011543478f, -0.11467501f, -0.04939465f, -0.11652218f, 0.011513462f, 0.150705f, -0.3121115f, -0.21389917f, 0.13833827f, 0.08964672f, 0.21119535f, 0.06349419f, 0.075958684f, 0.48069876f, -0.054025818f, 0.045476735f, -0.2061133f, 0.11086452f, 0.39950645f, -0.08912591f, -0.31553665f, 0.11765334f, -0.08466235f, -0.1841319f, -0.05453289f, 0.31904837f, 0.0934837f, 0.11634147f, -0.20513001f, -0.21626636f, -0.23358852f, 0.12247305f, 0.110658646f, 0.10685503f, 0.118272915f, 0.085172966f, 0.11880466f, -0.17647026f, -0.03559849f, -0.13655728f, -0.03256907f, 0.3383655f, 0.1314176f, -0.27845392f, 0.33514896f, -0.022413945f, 0.035634913f, 0.22784725f, -0.26826864f, -0.024379816f, 0.12587725f, -0.01764792f, -0.3766154f, -0.09055739f, 0.18230978f, -0.3109332f, 0.05288857f, -0.008786393f, 0.072387345f, 0.10969216f, -0.20213126f, -0.039554514f, 0.12015441f, -0.14575763f, 0.33968922f, -0.23269005f, 0.10103119f, -0.0395359f, 0.016989293f, 0.33335117f, 0.07989946f, 0.3149696f, 0.089205846f, -0.292179f, 0.18281674f, 0.03095587f, -0.3975912f, 0.05017131f, -0.2586997f, -0.319587f, 0.11123725f, 0.26360956f, 0.11359291f, 0.14431037f, -0.29094443f, 0.26170823f, -0.3972241f, -0.26364666f, 0.08413059f, -0.2720956f, 0.04404272f, 0.29814187f, -0.10310275f, 0.061115976f, -0.06490047f, 0.21593043f, -0.032176685f, 0.30988094f, 0.5288265f, 0.1844682f, -0.28549135f, -0.4903877f, 0.076246284f, -0.024511008f, 0.15363523f, 0.46213216f, -0.38718635f, -0.1308168f, -0.09562598f, 0.17330995f, 0.021940853f, 0.124752216f, -0.31564242f, 0.033408858f, -0.24742846f, 0.1168521f, 0.22964185f, -0.23035829f, -0.22498156f, -0.47095096f, 0.14299962f, 0.027019285f, -0.14025831f, -0.030873267f, 0.0059478194f, 0.10884647f, -0.14390157f, 0.0004091649f, 0.102423035f, -0.18803339f, -0.13478215f, -0.0599199f, -0.20951153f, 0.017897401f, -0.18530814f, 0.00037615214f, 0.11304218f, -0.4774621f, 0.075450025f, -0.053736024f, 0.11711517f, 0.06630253f, -0.08251743f, -0.106364034f, -0.16773659f, 0.26386538f, -0.13718964f, 0.11687985f, 0.06141102f, -0.11483353f, 0.16829187f, 0.15527783f, 0.14996223f, 0.21178491f, 0.070197314f, 0.28795096f, -0.19689213f, 0.010612597f, -0.16642825f, -0.24447766f, -0.1888538f, 0.27004412f, 0.12026106f, -0.08480247f, -0.25775915f, -0.0032200464f, 0.14218186f, 0.05261384f, 0.000982929f, -0.017791994f, -0.08377089f, -0.008542643f, -0.17966428f, 0.1610907f, -0.16727479f, -0.15066494f, 0.24890044f, 0.23747766f, 0.16798791f, 0.220691f, 0.01972895f, 0.32328743f, -0.27294245f, -0.04928577f, 0.40159264f, 0.10429287f, 0.2939025f, 0.0055334587f, -0.047470935f, 0.047046036f, -0.1557508f, -0.1877371f, -0.051896315f, 0.19470738f, 0.48545757f, -0.020760562f, -0.5517076f, -0.12730542f, -0.02548892f, 0.09886162f, 0.34257177f, 0.29593238f, -0.16561171f, -0.05648616f, -0.05877249f, 0.12604932f, -0.22467136f, -0.1430877f, -0.043696724f, 0.17000908f, 0.22096902f, -0.15916516f, 0.14000796f, -0.09830353f, 0.0007532007f, -0.04593814f, -0.10757384f, -0.23829472f, -0.17015634f, -0.08095127f, -0.07924221f, 0.14004925f, -0.38372886f, 0.16098507f, 0.038758934f, 0.0499142f, 0.15937726f, -0.12700646f, 0.05205976f, -0.15557493f, 0.21396172f, 0.17266987f, -0.16471161f, -0.2035405f, 0.12979808f, 0.11689602f, -0.08820297f, -0.018811502f, 0.17386292f, 0.114973515f, -0.18045898f, 0.17519969f, 0.23882096f, 0.0410169f, -0.011809744f, 0.28298196f, -0.15103133f, -0.16132016f, -0.11347706f, 0.13294618f, -0.067042895f, 0.10783593f, 0.14031126f, -0.21795917f, -0.12653741f, -0.32321462f, -0.077374965f, 0.109325245f, 0.054595783f, -0.21092159f, -0.07891633f, -0.0041680103f, 0.058256406f, 0.006172499f, 0.4527885f, 0.06986857f, -0.23562583f, -0.2416853f, -0.33171594f, 0.30421308f, 0.14017385f, 0.16982396f, 0.020920778f, 0.37987402f, -0.2466323f, 0.006562208f, -0.083276324f, 0.051079057f, 0.39381567f, 0.0746938f, 0.03394262f, -0.09601587f, -0.0576958f, -0.12730187f, -0.10165103f, 0.048927307f, 0.2453798f, -0.35737526f, 0.047393426f, -0.077948645f, 0.09219112f, 0.10008964f, 0.5186322f, -0.33947548f, -0.043138977f, 0.11848972f, 0.29198462f, 0.086478785f, 0.27817023f, -0.11237802f, 0.5128907f, -0.14486748f, -0.29714563f, 0.11918999f, 0.2651123f, 0.042391147f, 0.042711858f, -0.1873131f, -0.07685378f, -0.20939735f, -0.124403186f, 0.23326519f, -0.5194796f, 0.3352149f, -0.12067198f, -0.073021255f, -0.6431021f, -0.4525976f, -0.105799876f, -0.28580272f, 0.25160304f, -0.43172207f, 0.035282526f, -0.06685458f, -0.29050788f, -0.25020325f, -0.22357608f, 0.03849352f, 0.089258686f, 0.38473478f, -0.292491f, -0.09279689f, -0.019781271f, 0.29733005f, 0.029826824f, -0.0024957054f, 0.22974747f, 0.1936995f, 0.06234264f, -0.0799533f, -0.23584509f, 0.17338532f, 0.10296683f, 0.05436868f, -0.1334225f, -0.48376408f, 0.1865963f, 0.16807783f, -0.36427328f, 0.048196763f, 0.11093142f, -0.16280489f, -0.013596064f, 0.023791576f, -0.28564745f, -0.24359933f, -0.093913004f, 0.08235316f, 0.14177993f, 0.1427578f, 0.27828228f, 0.06074398f, 0.28856507f, 0.059707f, 0.05939818f, 0.27246395f, 0.33174852f, 0.14593525f, -0.037074074f, 0.09390327f, 0.2945241f, -0.07636306f, -0.2968695f, 0.11418318f, 0.10290444f, -0.27150992f, 0.41389364f, -0.32964098f, 0.047346268f, 0.61900955f, -0.06747831f, 0.25501898f, -0.24691045f, 0.1759491f, 0.05444543f, -0.090845436f, -0.09541403f, -0.23683655f, 0.34168622f, -0.37855056f, 0.25858483f, 0.13164173f, 0.5030209f, 0.24445418f, 0.053390834f, -0.27067932f, 0.26496926f, 0.058887735f, 0.0031807162f, -0.24337916f, 0.23408331f, 0.41696137f, -0.40540776f, -0.21910232f, 0.4204644f, -0.03027308f, 0.13637878f, 0.0795772f, -0.021799643f, -0.32914007f, -0.20927869f, -0.18312553f, -0.018412223f, -0.14639832f, -0.08566685f, -0.17130168f, -0.19000658f, -0.13594894f, -0.09114665f, 0.13934109f, -0.10184156f, -0.0720081f, -0.35955685f, 0.38951206f, 0.017700467f, 0.22301474f, -0.011156212f, -0.18495263f, -0.20201872f, 0.2809015f, 0.030521747f, -0.21055596f, 0.29287028f, 0.16707818f, -0.043921765f, 0.10899859f, -0.35195053f, 0.16555466f, -0.20880973f, 0.370177f, 0.06370649f, -0.2776332f, -0.018005315f, -0.15051264f, -0.1166253f, -0.2983634f, -0.15482919f, 0.10835846f, -0.06046478f, -0.22733583f, 0.18016513f, -0.22378792f, 0.24194072f, 0.030576859f, 0.16760309f, -0.13344808f, -0.04434459f, 0.03585327f };
+static const float gru_layer_0_input_biases[96] = { 0.20939672f, 0.004104896f, 0.34731954f, 0.29371682f, 0.18863866f, 0.65967757f, 0.71141416f, 0.15336752f, 0.553846f, 0.36844248f, 0.1390778f, 0.06625824f, 0.78692746f, 0.8309958f, 0.9273346f, -0.24079181f, 0.507021f, 0.6876702f, 0.20946594f, -0.12988272f, 0.37197483f, 0.7014044f, -0.2352181f, 0.048506394f, 0.5542474f, 0.196507f, 0.6585624f, 0.13042596f, 0.6493082f, -0.068528555f, 0.21266745f, 0.22455227f, -0.095341355f, 0.28301647f, 0.14668389f, -0.26832023f, 0.15409964f, 0.2022277f, 0.36452785f, -0.16910939f, -0.09937829f, -0.120122485f, -0.05660696f, -0.067925744f, -0.2551777f, 0.32005045f, -0.34079134f, 0.5015539f, -0.2796899f, 0.29899228f, 0.449627f, -0.18115246f, 0.0729242f, 0.16603327f, 0.19855024f, 0.1697188f, -0.13875736f, 0.18153605f, 0.11981322f, 0.25995442f, 0.15546818f, 0.72483176f, 0.14743264f, 0.31433117f, 0.41697696f, -0.5065306f, 0.24697098f, 0.15887715f, 0.39044678f, 0.19109322f, 0.2648998f, -0.2257661f, -0.25213617f, 0.04754254f, -0.15248947f, -0.19824924f, 0.15337686f, -0.38811937f, 0.0029177098f, 0.42759132f, -0.14752392f, -0.1927874f, 0.037361573f, 0.22210467f, -0.021760859f, 0.017451748f, 0.5658667f, 0.4207376f, -0.22887559f, 0.43368703f, 0.18382494f, 0.1401918f, 0.10052363f, 0.2490842f, 0.48734087f, -0.005673275f };
+static const float gru_layer_0_recurrent_biases[96] = { 0.06894787f, 0.08330797f, 0.09182427f, 0.13193668f, 0.045365233f, 0.32664546f, 0.3157961f, 0.15103784f, 0.31855232f, 0.076025784f, -0.023225151f, 0.13581048f, 0.42386308f, 0.16560633f, 0.5402919f, -0.08231701f, 0.30255398f, 0.23237613f, 0.21482678f, -0.18715523f, 0.43490708f, 0.18157235f, -0.040810864f, -0.13005556f, 0.109843746f, 0.17167349f, 0.39444765f, 0.0407992f, 0.067375556f, -0.049700256f, 0.32624152f, 0.27093843f, -0.058339987f, 0.08382734f, -0.0111770015f, 0.018511936f, 0.015709992f, 0.09719971f, 0.28173882f, -0.018524088f, 0.07208232f, -0.18488795f, 0.10222038f, 0.16336511f, -0.08746784f, -0.0031101021f, -0.12915142f, 0.065078475f, 0.018471906f, 0.16735008f, 0.06722634f, -0.028117253f, 0.07406555f, -0.0032883699f, -0.009640814f, 0.053281926f, 0.08288019f, 0.28970283f, 0.07408668f, 0.12420968f, 0.03276265f, 0.08564547f, 0.23467031f, 0.19898014f, 0.10788965f, -0.10334224f, 0.06532046f, 0.0741418f, 0.17840809f, 0.12793277f, -0.02540186f, -0.076253496f, -0.015040106f, 0.07131694f, -0.023064686f, -0.014109435f, 0.072137274f, -0.08987446f, 0.007452745f, 0.13301466f, 0.032816608f, -0.08520395f, -0.027103303f, 0.05963634f, 0.009507008f, 0.06064123f, 0.1231375f, 0.024057778f, 0.0024029515f, 0.09281494f, -0.081263706f, 0.06958037f, -0.026828885f, -0.016802808f, 0.0803767f, -0.10772869f };
+static const EmlNetGruParams gru_layer_0_params = { 6, gru_layer_0_input_weights, gru_layer_0_recurrent_weights, gru_layer_0_input_biases, gru_layer_0_recurrent_biases };
+static const float gru_layer_1_biases[32] = { -0.07175014f, 0.07164808f, 0.17160746f, 0.058896583f, 0.13853368f, 0.0262202f, 0.10895733f, 0.15075766f, 0.073785156f, 0.04151933f, 0.18617211f, 0.045125786f, 0.06887567f, 0.16129373f, 0.07923243f, 0.23388362f, 0.15013142f, 0.20956784f, -0.07050348f, 0.013342372f, 0.18371046f, 0.11864677f, 0.12241068f, 0.055962622f, 0.19062759f, 0.11586423f, -0.007069865f, 0.024189185f, 0.1250528f, 0.106813215f, -0.059675943f, 0.16958779f };
+static const float gru_layer_1_weights[1024] = { 0.034813344f, 0.0723636f, -0.46992895f, 0.26186445f, 0.3885118f, 0.40126446f, -0.057161093f, 0.22870748f, 0.37714303f, 0.16210625f, 0.1247144f, 0.1296959f, -0.60871303f, 0.29862225f, 0.25959855f, -0.459025f, -0.031225162f, -0.026940875f, -0.10011172f, -0.21550018f, -0.35256457f, 0.07586407f, 0.34915864f, -0.2855251f, 0.07439214f, -0.35010558f, -0.05078355f, -0.10470237f, 0.061656296f, -0.10301609f, 0.06465281f, -0.20472062f, -0.10140319f, -0.086010695f, -0.2860988f, -0.09502256f, -0.07330128f, 0.20436774f, 0.13017121f, 0.022255914f, -0.20863236f, -0.07190788f, -0.21419337f, -0.1253663f, -0.015307907f, -0.26709428f, 0.045950163f, -0.15818186f, -0.43136424f, -0.54486495f, -0.06499463f, 0.24483076f, 0.024133714f, -0.18963967f, -0.044753086f, 0.29245773f, 0.037990935f, -0.41436955f, -0.2310417f, 0.23304524f, -0.097709686f, -0.36066592f, 0.48100072f, -0.3130009f, 0.03495079f, -0.061076358f, -0.24961402f, 0.022451527f, 0.15516217f, 0.22461107f, -0.008179835f, -0.072219744f, -0.02295762f, 0.040658094f, 0.15887527f, -0.34833845f, -0.32677776f, 0.20289212f, 0.26046866f, -0.21266742f, 0.3162346f, 0.28371865f, 0.26468113f, -0.1643354f, 0.27733305f, 0.08099289f, 0.025693942f, -0.27444595f, 0.4746178f, 0.14116208f, -0.25315252f, -0.10603524f, 0.16404593f, 0.3610389f, -0.41215268f, 0.002560325f, -0.33238465f, -0.22464769f, 0.15781829f, -0.103391975f, -0.2971089f, 0.10883998f, 0.21732357f, -0.03643137f, 0.003407855f, 0.034439553f, -0.4493388f, 0.083104245f, 0.27194256f, 0.15772979f, -0.11100153f, 0.26360518f, 0.34360787f, 0.07450241f, -0.32344756f, 0.17396559f, 0.094676435f, -0.27410594f, 0.09291956f, 0.26833665f, -0.11087198f, 0.08946478f, -0.5434552f, 0.31380162f, 0.2658919f, -0.26131436f, 0.052602623f, 0.5473176f, -0.48959315f, -0.072643384f, -0.050655045f, -0.0561784f, -0.14896119f, -0.2690458f, -0.067893796f, 0.13788755f, 0.18851545f, 0.0013176058f, -0.009288709f, -0.35698062f, -0.15433232f, 0.37333348f, -0.3389682f, -0.3055896f, 0.24696591f, 0.40721685f, 0.21504363f, 0.17570415f, 0.4422038f, -0.14460191f, 0.19965027f, -0.012148874f, 0.38239515f, 0.4130625f, 0.1548084f, 0.0647122f, 0.3589016f, -0.05456612f, -0.021421768f, 0.33028316f, 0.19229983f, -0.12167348f, -0.26802865f, -0.42935267f, -0.3760007f, 0.3063656f, -0.03521078f, 0.44768262f, -0.35914406f, 0.14433411f, 0.18142653f, 0.314433f, -0.24341911f, 0.36018676f, -0.09173237f, 0.21246043f, -0.037054278f, 0.14262429f, 0.3076723f, 0.15452789f, 0.13951586f, 0.26845214f, 0.17770334f, 0.1871967f, 0.26838663f, 0.40461537f, 0.31174293f, -0.33335522f, -0.053930517f, 0.3164559f, 0.11476547f, -0.1844839f, -0.028755773f, 0.3995397f, 0.42986253f, 0.45775315f, 0.0063334997f, 0.0074354773f, -0.28817734f, -0.5978517f, -0.07416939f, 0.4793315f, -0.16124336f, 0.45740607f, 0.42709565f, -0.25791037f, 0.31085575f, -0.13457255f, -0.17482406f, -0.21058474f, -0.19401586f, -0.6708234f, 0.22026819f, 0.2731971f, 0.43988457f, -0.14684524f, -0.2924878f, -0.36626276f, -0.20791572f, -0.49645296f, 0.36142164f, -0.0019461206f, -0.5612259f, 0.22024016f, -0.08158315f, 0.013575049f, -0.15544221f, 0.08172382f, 0.047616914f, -0.087832496f, -0.10604282f, 0.35069382f, 0.061074458f, -0.056771945f, -0.5530889f, -0.16769321f, -0.0070928447f, 0.050095607f, -0.3639415f, -0.11852166f, -0.07027133f, 0.5478991f, -0.13463762f, -0.24821582f, -0.3178822f, -0.007578908f, 0.0440038f, -0.3478702f, -0.47025102f, 0.36659342f, -0.20255695f, -0.24133025f, 0.05104157f, -0.4701415f, -0.12160478f, -0.13194704f, -0.00090442074f, -0.2669234f, 0.19790205f, -0.09384148f, -0.47495133f, -0.16121104f, 0.47800925f, -0.3425936f, 0.019510794f, 0.31944433f, -0.07279458f, -0.34719634f, 0.020727502f, -0.12130121f, -0.02076882f, -0.30793405f, 0.18296732f, -0.29863027f, -0.15352848f, 0.25536203f, 0.38129807f, -0.40382975f, -0.17951791f, 0.2507437f, 0.45311892f, -0.31217182f, 0.0069979643f, -0.13692209f, 0.1038479f, 0.4297895f, 0.095159896f, -0.06663522f, 0.0935304f, 0.103634335f, 0.408136f, 0.21000747f, 0.28337094f, -0.15277052f, -0.04404394f, -0.008952238f, 0.0668968f, -0.14681475f, 0.038928054f, -0.15076502f, 0.25478038f, 0.104109526f, 0.27812475f, -0.08977889f, -0.09211456f, 0.10881953f, -0.04098816f, -0.1701992f, 0.22169036f, 0.4185871f, 0.04907922f, 0.039416075f, 0.012826838f, 0.13793062f, 0.36707863f, -0.07838104f, 0.019585824f, -0.2961312f, -0.0074573616f, 0.12059721f, 0.03469954f, 0.38822645f, -0.45881876f, 0.062215813f, 0.17621465f, 0.52287716f, 0.24183978f, -0.18850327f, 0.11689728f, -0.040366646f, 0.3222908f, 0.4021816f, -0.18296327f, -0.45917583f, -0.07806896f, -0.42354992f, 0.13395143f, -0.38487932f, 0.092940316f, 0.2180801f, -0.3096591f, 0.26270998f, -0.2977453f, 0.28458735f, -0.31849337f, -0.6561361f, -0.07284814f, 0.23194015f, 0.15367378f, 0.16893339f, 0.0120843705f, -0.51399994f, 0.014892009f, -0.06699465f, -0.042563017f, 0.11008802f, 0.08757054f, -0.01512141f, -0.009816125f, -0.09546911f, -0.3327258f, 0.15536554f, -0.5328689f, 0.12887813f, 0.002996708f, 0.35542563f, -0.5515821f, 0.41349033f, 0.08782109f, 0.66522676f, -0.07791079f, 0.26462856f, 0.15739135f, -0.32942188f, -0.14246663f, 0.15817621f, -0.1398871f, -0.06800974f, -0.107674114f, 0.28216925f, -0.13494647f, -0.27961695f, 0.29321206f, 0.11831382f, -0.3647722f, 0.1785383f, 0.007778f, 0.22232187f, -0.07674336f, 0.03435636f, 0.13584659f, 0.32241067f, -0.085685864f, -0.25961167f, -0.27220133f, -0.23200603f, -0.29083407f, 0.3689292f, 0.2810006f, 0.027733408f, 0.19967198f, 0.1630852f, -0.13311543f, -0.24729562f, -0.28777245f, 0.31815195f, 0.29645735f, -0.17420559f, 0.06790765f, -0.12117342f, 0.32158095f, -0.08960156f, 0.1693078f, -0.03584498f, -0.47742462f, 0.36632854f, 0.14535363f, 0.35644922f, 0.55778927f, 0.07090269f, 0.15312685f, 0.28316972f, -0.43916863f, -0.22027092f, 0.18804719f, -0.19360985f, -0.28813964f, -0.1015061f, 0.47521296f, -0.48085403f, -0.105497815f, 0.53387296f, -0.38135764f, -0.38288882f, 0.053161383f, 0.05858117f, -0.20343933f, -0.024968443f, -0.22140364f, 0.16596213f, -0.3750589f, -0.05124069f, -0.042909466f, -0.2585913f, 0.2279592f, -0.399828f, 0.074822955f, -0.14168403f, -0.12665354f, -0.05220978f, -0.044741202f, 0.050527077f, 0.08339646f, 0.23787883f, -0.08867548f, -0.3998288f, -0.31898937f, -0.19839808f, 0.19324794f, -0.042982385f, 0.09573449f, 0.065815516f, -0.12753749f, 0.4351019f, 0.039183866f, -0.39027599f, -0.17066555f, 0.13352275f, -0.025124976f, 0.008463282f, -0.16495807f, 0.376594f, 0.25996876f, 0.16102135f, 0.04139626f, 0.40215886f, -0.10833529f, 0.08014662f, 0.3874892f, 0.08623962f, 0.13257597f, 0.34982035f, -0.17124161f, 0.21480985f, 0.1268162f, 0.31642002f, -0.17942117f, 0.2340803f, 0.37699023f, -0.37917796f, -0.058476053f, -0.4357607f, -0.2726798f, 0.0052848607f, 0.38584608f, 0.1614384f, 0.20640418f, 0.22467253f, 0.22987777f, 0.26058728f, -0.3567863f, -0.02065543f, 0.016552271f, 0.26839375f, 0.3866024f, 0.18487741f, 0.28453892f, -0.115383014f, 0.24298136f, 0.10239725f, 0.018080857f, 0.24260516f, -0.29056317f, -0.2669519f, 0.15187421f, -0.24841608f, -0.41002473f, 0.07519828f, 0.13780823f, -0.1733411f, -0.47304857f, 0.45124805f, -0.060201306f, 0.27934775f, 0.47387424f, -0.06906545f, -0.5126517f, 0.6104354f, 0.24494663f, -0.03352111f, -0.076124825f, 0.06760374f, 0.37512806f, -0.56953186f, -0.30772746f, -0.12290176f, 0.23873389f, -0.046803728f, -0.13291629f, 0.24336584f, -0.2950453f, -0.07532605f, -0.1809186f, 0.054272287f, -0.15626945f, -0.27483207f, 0.06110502f, -0.28735566f, -0.040345456f, 0.01029068f, 0.4298028f, 0.13178085f, -0.14209253f, -0.24859889f, -0.15772606f, -0.5026874f, -0.06889438f, 0.05439531f, -0.5877786f, -0.13323921f, 0.2828738f, -0.08784024f, -0.2299116f, 0.052400764f, -0.039527126f, -0.4847555f, 0.16816778f, 0.2846347f, -0.08676026f, 0.013691451f, -0.5604264f, 0.31104663f, -0.13665396f, 0.026108604f, 0.31839547f, 0.3692941f, 0.13445671f, 0.3024236f, -0.354115f, -0.06519674f, 0.36619535f, 0.3345992f, 0.26513356f, -0.5035889f, -0.18251963f, 0.20672618f, 0.24920024f, 0.107722245f, 0.21025914f, -0.23148178f, -0.2108962f, 0.0710251f, -0.11938775f, 0.013316475f, -0.5171862f, 0.20875672f, 0.1847191f, 0.097504534f, 0.20070615f, 0.040061682f, 0.062045008f, -0.61203504f, -0.36263645f, 0.36447954f, 0.26255563f, 0.054431744f, 0.5162753f, -0.37486705f, 0.26802891f, 0.28610447f, -0.2024863f, 0.116294935f, 0.009828104f, -0.07838658f, 0.42998797f, -0.10198019f, -0.26387352f, 0.12801103f, 0.24120773f, 0.37635562f, -0.1065581f, 0.275555f, -0.00035715767f, -0.23684762f, -0.18953998f, -0.5170884f, -0.17216547f, 0.38115865f, 0.405738f, 0.27879703f, 0.363776f, 0.36479765f, 0.29045734f, -0.23676333f, 0.052293234f, 0.3965431f, 0.28605318f, -0.24507536f, 0.1573183f, 0.17246851f, -0.365847f, -0.300846f, 0.20869637f, -0.14667904f, -0.1446715f, -0.17548746f, 0.13845024f, 0.30958024f, 0.3084925f, -0.23428671f, 0.15907311f, 0.0044017658f, -0.0058471044f, 0.4054062f, 0.3891768f, -0.5518025f, 0.14202708f, -0.15212558f, 0.11118563f, -0.06402573f, 0.16725829f, 0.38728565f, 0.49581206f, -0.37131152f, -0.0661172f, -0.054959096f, 0.2656304f, -0.564734f, 0.4356411f, 0.24476162f, -0.03467623f, -0.031768188f, -0.4800645f, -0.3242643f, 0.1618613f, -0.31469318f, -0.1514665f, -0.39003575f, -0.2858976f, 0.49885026f, 0.34533045f, -0.38077953f, -0.24943021f, -0.18734156f, -0.04647594f, -0.22030586f, 0.48139003f, 0.32745096f, -0.4432657f, 0.22751658f, 0.45602733f, -0.26488382f, -0.055423137f, 0.07433037f, -0.29929498f, 0.017031614f, 0.122149035f, 0.57450765f, 0.18728842f, -0.22899829f, -0.2695473f, -0.12907098f, -0.039741676f, 0.081800796f, 0.0486665f, 0.20430991f, 0.20529136f, 0.4035508f, 0.28561765f, -0.07413376f, 0.002431365f, -0.13131605f, 0.2347505f, 0.07635633f, 0.50569725f, 0.000782615f, 0.16315165f, 0.34407678f, -0.24032871f, 0.5115928f, 0.39366135f, 0.14624183f, -0.14472878f, 0.09860405f, 0.2210309f, -0.16325893f, 0.5044789f, 0.11473506f, -0.012995971f, -0.18302104f, 0.071837164f, -0.16744016f, -0.04344147f, 0.061365295f, -0.29195413f, 0.40309408f, 0.23180734f, -0.03827329f, 0.20122717f, 0.40202242f, 0.3595241f, 0.23714459f, 0.1656084f, -0.51744145f, 0.32603887f, 0.36330917f, -0.21449202f, 0.2694946f, -0.23103642f, 0.15305828f, -0.23351467f, -0.23599282f, 0.2614493f, -0.5163638f, -0.31889948f, -0.08261822f, 0.04708922f, -0.12171653f, 0.08216568f, 0.17134337f, 0.23711398f, -0.07625401f, -0.14038359f, 0.21317896f, 0.34060195f, -0.3610752f, 0.21994528f, 0.08799673f, 0.0946561f, -0.32059592f, 0.060174856f, -0.42106992f, -0.30936342f, -0.09396567f, 0.17767282f, 0.2477287f, -0.38469413f, -0.353051f, -0.21516183f, -0.035035536f, 0.14376214f, 0.27563053f, -0.35470095f, 0.07872585f, -0.12188822f, 0.5071148f, 0.3440029f, 0.43211776f, 0.013719825f, 0.033147316f, -0.03707572f, -0.011401145f, 0.21388116f, 0.16846965f, -0.122303374f, 0.30965954f, -0.1789719f, -0.38598162f, 0.23338231f, 0.004687072f, 0.21148403f, 0.43428597f, 0.23834983f, 0.07607243f, 0.21450476f, -0.025936265f, -0.11687215f, -0.24446964f, 0.25197324f, 0.42894736f, 0.08986139f, 0.5151808f, -0.2233148f, 0.09747375f, 0.25843322f, -0.33217916f, -0.39512646f, -0.27884683f, 0.11220897f, -0.20617214f, -0.4453225f, 0.056037918f, 0.49031696f, 0.013422944f, 0.17571273f, -0.51745397f, -0.01670174f, -0.20846932f, 0.13010444f, 0.24269593f, 0.10574872f, -0.18557799f, 0.15680015f, 0.3037924f, 0.23864679f, -0.23277564f, 0.018556127f, 0.044418596f, -0.23023187f, -0.15184957f, 0.10729938f, 0.12036418f, -0.2422673f, 0.29480895f, 0.30419335f, -0.19982061f, -0.23293655f, 0.47557047f, -0.36768466f, -0.29343987f, -0.003199367f, 0.17980333f, -0.29303497f, 0.22033827f, 0.026613427f, 0.3143092f, -0.097498596f, -0.11731613f, 0.20505778f, 0.19673067f, 0.07033366f, -0.079056814f, -0.21422899f, -0.25154543f, -0.34426346f, -0.28617507f, 0.3040128f, -0.3024392f, -0.70053524f, -0.5054141f, 0.0010861161f, 0.3001408f, -0.08178907f, 0.26858723f, 0.23597836f, -0.52563846f, 0.01179229f, 0.43599305f, -0.11991456f, 0.33246797f, -0.06243163f, 0.052674696f, 0.24783953f, -0.3988678f, 0.62055665f, 0.22398941f, 0.32753912f, -0.021749733f, 0.55700517f, 0.34573886f, 0.11236804f, -0.49752697f, -0.17947993f, 0.42710215f, -0.21665682f, 0.5514551f, 0.080295786f, -0.18953523f, -0.1496908f, 0.17956401f, -0.09160762f, -0.20179248f, 0.045007095f, -0.046922874f, -0.08098291f, 0.22506839f, -0.12962791f, -0.27310857f, -0.20063952f, 0.2855076f, -0.415924f, 0.17719038f, 0.33330357f, 0.10011816f, 0.098921984f, 0.29669315f, 0.34567878f, 0.13247818f, 0.08403592f, 0.26532266f, -0.12636611f, 0.05673412f, -0.15812297f, -0.074239515f, 0.36400127f, -0.35726482f, 0.2566006f, -0.07026693f, -0.006827695f, -0.3841318f, 0.078086354f, -0.31873357f, -0.38922024f, -0.098275915f, 0.0018299756f, -0.25797987f, -0.2210697f, -0.24301873f, 0.27763525f, 0.12982565f, -0.11826635f, 0.20482829f, -0.37995172f, 0.20869243f, 0.31839284f, 0.3638094f, 0.21381436f, -0.114781216f, 0.33830178f, 0.30864272f, -0.044404317f, -0.124293305f, 0.35724574f, 0.2473642f, -0.41549715f, -0.00889095f, 0.12349158f, 0.3061146f, 0.35248166f, 0.20451458f, -0.29599202f, -0.15547988f, 0.7690016f, 0.39310786f, -0.04450297f, -0.19655769f, -0.21241002f, -0.22686368f, 0.23169403f, 0.08027142f, -0.13409613f, -0.049469553f, -0.051513385f, 0.04697965f, -0.17747965f, 0.42761567f, 0.3335364f, -0.42969427f, 0.06318872f, -0.44351313f, 0.27569127f, 0.12043858f, 0.45120102f, -0.10166791f, -0.2124916f, -0.39103216f, 0.2400677f, -0.2624117f, 0.3412984f, 0.2152466f, -0.3420165f, 0.14864872f, 0.03741759f, 0.19894686f, 0.40883407f, 0.223181f, 0.29919934f, -0.07029543f, -0.42971987f, 0.030014383f, -0.28113678f, 0.092648596f, -0.28352842f, -0.026485795f, 0.46485096f, -0.021770965f, -0.38436905f, 0.782214f, -0.038276486f, 0.024473313f, -0.054501113f, -0.4616425f, 0.043850627f, -0.38064477f, -0.59937716f, 0.2601986f, -0.12773451f, 0.33711052f, -0.48062894f, -0.28034836f, -0.23208517f, -0.4440015f, -0.35435796f, 0.09993326f };
+static const float gru_layer_2_biases[6] = { 0.023252228f, -0.02020756f, -0.104371324f, 0.19332027f, -0.064849086f, -0.09058111f };
+static const float gru_layer_2_weights[192] = { -0.20375688f, -0.45080897f, 0.5311253f, -0.5241118f, 0.012277897f, 0.001953821f, -0.33730152f, 0.36566696f, 0.50555575f, -0.23715572f, -0.56337416f, -0.4468276f, -0.33654308f, 0.41551253f, -0.37844017f, 0.46470895f, -0.66680604f, -0.7204205f, 0.12997784f, 0.3533215f, 0.27357295f, -0.07051154f, -0.7394308f, -0.36784756f, -0.14322974f, 0.60810715f, 0.4298511f, -0.5903376f, -0.23474264f, -0.07258357f, -0.4152219f, -0.11498052f, 0.6128077f, -0.5280823f, 0.2841409f, 0.24679235f, 0.14041744f, -0.28168008f, -0.68020946f, -0.47239497f, -0.39439365f, 0.24863152f, -0.334069f, -0.03698992f, -0.13894168f, 0.485261f, 0.30589384f, 0.13097207f, 0.073631905f, 0.6178415f, 0.09827124f, -0.60462373f, 0.11063573f, -0.42297482f, 0.36795473f, -0.53218967f, 0.21199591f, 0.09955728f, -0.39997283f, -0.1001652f, 0.2098399f, -0.18147999f, 0.038564265f, -0.690537f, 0.6861439f, 0.22463611f, 0.13780522f, -0.46986514f, 0.48424867f, -0.23810251f, -0.10958475f, -0.5470185f, -0.17669551f, 0.08848648f, 0.31444386f, 0.39705327f, 0.03076146f, -0.40761882f, 0.50418514f, -0.5231112f, -0.52572376f, 0.37142378f, 0.18112616f, 0.17693925f, -0.3365565f, 0.51792485f, -0.15896733f, -0.40531242f, 0.59436226f, -0.27106392f, -0.59771425f, -0.42936915f, 0.20648202f, 0.47552782f, -0.48029602f, -0.42339262f, 0.46517885f, -0.42986882f, -0.197044f, 0.052431047f, -0.519255f, 0.20108739f, -0.008393319f, -0.4700372f, -0.13558121f, 0.62029195f, 0.12495602f, -0.106141046f, -0.38281673f, 0.024024474f, 0.20803471f, 0.24914509f, 0.30976403f, -0.009655311f, -0.45589855f, -0.44200382f, -0.41089362f, -0.3963504f, -0.38718012f, 0.46595052f, 0.4288358f, -0.47866338f, -0.69187164f, 0.26073405f, -0.09445105f, 0.04172083f, -0.1646953f, 0.44927898f, 0.20041876f, -0.3233793f, 0.43529463f, -0.23684011f, 0.52720726f, 0.28168002f, -0.24156801f, -0.77251023f, -0.13203059f, -0.50957924f, -0.10292226f, -0.5531238f, 0.21537673f, 0.18626104f, -0.21606502f, 0.43235078f, 0.2721796f, -0.72406185f, -0.592652f, 0.18015648f, 0.1309919f, 0.22926293f, -0.7052823f, -0.22546816f, 0.13045433f, 0.34927437f, 0.14736356f, -0.09012315f, -0.50001913f, 0.14302015f, -0.7282316f, -0.21315618f, 0.357722f, -0.42406183f, -0.48953193f, -0.08581283f, 0.08948082f, 0.07626988f, -0.2995947f, 0.48936304f, 0.27223894f, 0.25708473f, -0.2176944f, -0.5188669f, -0.49569204f, 0.10592301f, 0.505568f, -0.6350802f, 0.020133f, 0.012997721f, 0.5164479f, -0.11978593f, -0.5066746f, 0.23050836f, 0.111009374f, -0.12327549f, 0.16627558f, 0.5853727f, 0.23565787f, -0.060695473f, -0.3347838f, 0.17759563f, -0.20064731f, -0.3916179f };
+static float gru_buf1[32];
+static float gru_buf2[32];
+static int32_t gru_scratch[192];
+static const EmlNetLayer gru_layers[3] = { 
+{ 32, 600, NULL, NULL, EmlNetActivationIdentity, EmlNetLayerGru, &gru_layer_0_params }, 
+{ 32, 32, gru_layer_1_weights, gru_layer_1_biases, EmlNetActivationRelu, EmlNetLayerDense }, 
+{ 6, 32, gru_layer_2_weights, gru_layer_2_biases, EmlNetActivationSoftmax, EmlNetLayerDense } };
+static EmlNet gru = { 3, gru_layers, gru_buf1, gru_buf2, 32, gru_scratch, 768 };
+
+    int32_t
+    gru_predict(const float *features, int32_t n_features)
+    {
+        return eml_net_predict(&gru, features, n_features);
+    }
+
+
+    int32_t
+    gru_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+    {
+        return eml_net_regress(&gru, features, n_features, out, out_length);
+    }
+
+
+    float
+    gru_regress1(const float *features, int32_t n_features)
+    {
+        return eml_net_regress1(&gru, features, n_features);
+    }
+
+
+    int32_t
+    gru_workspace_size(void)
+    {
+        return eml_net_workspace_size(&gru);
+    }
+
+
+    int32_t
+    gru_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_predict_workspace(&gru, features, n_features, workspace, workspace_length);
+    }
+
+
+    int32_t
+    gru_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_regress_workspace(&gru, features, n_features, out, out_length, workspace, workspace_length);
+    }
+
+
+    static EmlNetChecked gru_checked;
+
+    int32_t
+    gru_check(void)
+    {
+        return eml_net_check(&gru, &gru_checked);
+    }
+
+
+    int32_t
+    gru_predict_unchecked(const float *features)
+    {
+        return eml_net_predict_unchecked(&gru_checked, features);
+    }
+
+
+    void
+    gru_regress_unchecked(const float *features, float *out)
+    {
+        eml_net_regress_unchecked(&gru_checked, features, out);
+    }
+
+
+    int32_t
+    gru_predict_logits(const float *features, float *logits, float *margin)
+    {
+        return eml_net_predict_logits_unchecked(&gru_checked, features, logits, margin);
+    }
+
+
+    void
+    gru_set_profile(EmlNetProfile *profile)
+    {
+        gru.profile = profile;
+    }
+    
+
+    static float gru_state[32];
+
+    void
+    gru_stream_reset(void)
+    {
+        for (int i=0; i<32; i++) {
+            gru_state[i] = 0.0f;
+        }
+    }
+
+
+    int32_t
+    gru_stream_push(const float *sample)
+    {
+        return eml_net_gru_step(&gru_layers[0], sample, gru_state, gru_scratch, sizeof(gru_scratch));
+    }
+
+
+    int32_t
+    gru_stream_predict_logits(float *logits, float *margin)
+    {
+        return eml_net_predict_logits_from_unchecked(&gru_checked, 1, gru_state, logits, margin);
+    }
+    
\ No newline at end of file
@@ -23,7 +23,12 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "mlp_model.h"
+#include "gru_model.h"
 #include "mlp_scaler.h"
+#include "eml_fastmath.h"
+#include "eml_net_cascade.h"
+#include "eml_net_blob.h"
+#include "model_registry.h"
 #include "driver_mpu9250.h"
 #include "driver_mpu9250_interface.h"
 /* USER CODE END Includes */
@@ -40,6 +45,92 @@ float Ax, Ay, Az, Gx, Gy, Gz;
 // MLP model feature dimension: 100 samples * 6 axes
 #define MLP_FEATURE_DIM 600U
 
+// Report the class probability over UART (softmax of the logits, after the timed inference).
+// With 0 the logit margin over the runner-up class is reported instead, and no exp is computed
+#ifndef MLP_REPORT_PROB
+#define MLP_REPORT_PROB 1
+#endif
+
+// Run the small 600-8-6 model first, and the 600-32-32-6 model only when the small one's
+// logit margin is below MLP_CASCADE_THRESHOLD (eml_net_cascade.h). Off by default, as most gestures
+// are then classified by the small model. To opt in, run home-made/bench/eval_cascade.c, which prints
+// the MLP_CASCADE_THRESHOLD for the recordings, and build with -DMLP_CASCADE=1
+#ifndef MLP_CASCADE
+#define MLP_CASCADE 0
+#endif
+
+// Picked with home-made/bench/eval_cascade.c. On the recorded gestures 0.32 keeps the balanced
+// accuracy of the large model and escalates 0.7% of them. 1.0 leaves some slack, at 3.5%
+#ifndef MLP_CASCADE_THRESHOLD
+#define MLP_CASCADE_THRESHOLD 1.0f
+#endif
+
+// Classify with the streaming GRU model (gru_model.h) instead of the MLP.
+// The GRU state is updated during capture, so at release only its small dense head runs
+#ifndef MLP_STREAMING
+#define MLP_STREAMING 0
+#endif
+
+// Streaming front end: average this many IMU samples into one GRU step (boxcar decimation).
+// The poll loop runs at about 166 Hz, so 4 gives about 40 steps per second. After GRU_MAX_STEPS steps
+// (about 2.4 s) the rest of the gesture is ignored. The model is trained for this decimation and cap,
+// see home-made/train_gru.py --decimation and --max-steps
+#ifndef MLP_STREAM_DECIMATION
+#define MLP_STREAM_DECIMATION 4U
+#endif
+
+// MLP_INCREMENTAL (mlp_model.h): fixed-rate windows, with layer 0 of the 600-32-32-6 model computed during capture.
+// Every MLP_INCREMENTAL_DECIMATION samples are averaged into the next of the 100 window slots, which is
+// standardized and multiplied into the 32 layer 0 accumulators right away. At release only the ReLU and
+// layers 1 and 2 remain. The window covers 100 * MLP_INCREMENTAL_DECIMATION samples from the press:
+// slots after a shorter gesture stay at the training mean (standardized 0), a longer gesture is cut.
+// The model was trained on recordings resampled to 100 samples, so it fits gestures of about the window length.
+// Always the compiled model, without the cascade or a blob
+#ifndef MLP_INCREMENTAL_DECIMATION
+#define MLP_INCREMENTAL_DECIMATION 4U
+#endif
+
+// Classify with the selected-input model (mlp_select_model.c, see mlp_model.h): at release only the 150 window values
+// it takes are interpolated from the recording (model_resample_selected), and its layer 0 is a quarter of the size.
+// Always the compiled model, without the cascade or a blob
+#ifndef MLP_FEATURE_SELECT
+#define MLP_FEATURE_SELECT 0
+#endif
+
+#if MLP_INCREMENTAL && MLP_STREAMING
+#error "MLP_INCREMENTAL and MLP_STREAMING are separate capture modes, enable one"
+#endif
+
+// Use a model blob (eml_net_blob.h) from flash instead of the compiled 600-32-32-6 model, when a valid
+// one is there. Written with eml_export.py --blob and flashed separately, see the README.
+// Erased flash or a bad blob (CRC, shape) falls back to the compiled model
+#ifndef MLP_BLOB
+#define MLP_BLOB 1
+#endif
+
+// Flash sector 7 of the STM32F411RE, kept out of the firmware image by STM32F411RETX_FLASH.ld
+#ifndef MLP_BLOB_ADDRESS
+#define MLP_BLOB_ADDRESS 0x08060000UL
+#endif
+#ifndef MLP_BLOB_LENGTH
+#define MLP_BLOB_LENGTH 0x20000L
+#endif
+
+// Activations and scratch of the blob model. 600-32-32-6 needs 320 bytes
+#ifndef MLP_BLOB_WORKSPACE_SIZE
+#define MLP_BLOB_WORKSPACE_SIZE 2048U
+#endif
+
+// After each classification, run every model of the registry (model_registry.h) on the same
+// window and print class, margin and time of each, to compare the MLPs and random forests
+#ifndef MLP_AB_MODELS
+#define MLP_AB_MODELS 0
+#endif
+
+#if MLP_BLOB && !MLP_SCALER_FOLDED
+#error "MLP_BLOB needs MLP_SCALER_FOLDED: blobs take raw features, with the scaler folded in or stored in the blob"
+#endif
+
 /* USER CODE END PD */
 
 /* Private define ------------------------------------------------------------*/
@@ -68,15 +159,59 @@ uint16_t raw_count = 0;
 // Feature buffer for the MLP model
 float mlp_features[MLP_FEATURE_DIM];
 
-// Class label mapping for model outputs [0..5]
-static const char *mlp_class_names[6] = {
-    "circle",
-    "downup",
-    "leftright",
-    "lightning",
-    "rightleft",
-    "updown",
+// Resampled window of the latest recording, the input of every model in the registry
+static float mlp_window[MODEL_WINDOW_LENGTH];
+
+#if MLP_AB_MODELS
+// Features of the model being compared, float or int16
+static uint32_t ab_features[MODEL_FEATURES_MAX_SIZE / sizeof(uint32_t)];
+#endif
+
+#if MLP_STREAMING
+// Decimator state: sum of the samples of the current step, and how many there are
+static float stream_sum[AXIS_NUMBER];
+static uint16_t stream_sum_count = 0;
+// GRU steps pushed since the start of the gesture
+static uint16_t stream_steps = 0;
+#endif
+
+#if MLP_INCREMENTAL
+// Layer 0 outputs for a window at the training mean, and for the current gesture
+static float mlp_acc_base[32];
+static float mlp_acc[32];
+// Decimator state, as for streaming, and window slots filled since the start of the gesture
+static float incremental_sum[AXIS_NUMBER];
+static uint16_t incremental_sum_count = 0;
+static uint16_t incremental_slots = 0;
+#endif
+
+#if MLP_BLOB
+static EmlNetBlobModel mlp_blob;
+static EmlNetChecked mlp_blob_checked;
+static uint32_t mlp_blob_workspace[MLP_BLOB_WORKSPACE_SIZE / sizeof(uint32_t)];
+// Standardized features, for blobs that store their scaler
+static float mlp_blob_features[MLP_FEATURE_DIM];
+#endif
+
+// The 600-32-32-6 model: the compiled one, or the blob in flash (see load_mlp_blob)
+static EmlNetPredictLogits mlp_large_predict_logits = mlp_perf__32_32__1e_05_predict_logits;
+
+#if MLP_CASCADE
+static EmlNetPredictLogits mlp_cascade_stages[2] = {
+    mlp_wt__8___1e_05_predict_logits,
+    mlp_perf__32_32__1e_05_predict_logits,
 };
+static const float mlp_cascade_thresholds[1] = { MLP_CASCADE_THRESHOLD };
+static const EmlNetCascade mlp_cascade = { 2, mlp_cascade_stages, mlp_cascade_thresholds };
+#endif
+
+#if EML_NET_PROFILE
+// Per-layer cycles and multiply-adds of each model, printed and cleared after every classification
+static EmlNetProfile mlp_profile_large;
+static EmlNetProfile mlp_profile_small;
+static EmlNetProfile gru_profile;
+#endif
+
 
 /* USER CODE END PV */
 
@@ -86,7 +221,6 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_I2C1_Init(void);
 /* USER CODE BEGIN PFP */
-static void normalize_buffer(float *source, uint16_t source_len, float *dest, uint16_t dest_len);
 static void MPU9250_Init(void);
 static void MPU9250_Print_WhoAmI(void);
 static uint8_t MPU9250_ReadRaw(void);
@@ -97,39 +231,53 @@ static void build_mlp_features(const float *source, uint16_t source_len,
 
 // Run the MLP classifier on the latest recording and print result over UART
 static void classify_with_mlp(void);
+
+#if MLP_BLOB
+// Use the model blob at MLP_BLOB_ADDRESS when it is valid. Returns 0 when it is used
+static int load_mlp_blob(void);
+// predict_logits of the blob model, like the generated <name>_predict_logits()
+static int32_t mlp_blob_predict_logits(const float *features, float *logits, float *margin);
+#endif
+
+#if MLP_AB_MODELS
+// Run every registered model on the window of the latest recording and print the results over UART
+static void compare_models(void);
+#endif
+
+#if MLP_INCREMENTAL
+// Layer 0 of the model for a window at the training mean, once at startup
+static void incremental_init(void);
+// Start a new gesture: accumulators to the baseline, empty window
+static void incremental_reset(void);
+// Add one IMU sample. Every MLP_INCREMENTAL_DECIMATION samples, their mean fills the next slot
+static void incremental_add_sample(const float *sample);
+// Finish the model on the accumulators and print result over UART
+static void classify_with_incremental(void);
+#endif
+
+#if MLP_STREAMING
+// Start a new gesture: zero the GRU state and the decimator
+static void stream_reset(void);
+// Add one IMU sample. Every MLP_STREAM_DECIMATION samples, their mean is pushed to the GRU
+static void stream_add_sample(const float *sample);
+// Run the head of the streaming model on the GRU state and print result over UART
+static void classify_with_stream(void);
+#endif
+
+#if EML_NET_PROFILE
+// Print the mean counts per call of each layer over UART, then clear them
+static void print_profile(const char *name, EmlNetProfile *profile);
+#endif
+
+// Print the class from the logits and the inference time over UART
+static void report_classification(int32_t cls, float *logits, int n_classes, float margin,
+                                  float inference_time_us);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 static mpu9250_handle_t s_mpu9250_handle;
 
-static void normalize_buffer(float *source, uint16_t source_len, float *dest, uint16_t dest_len)
-{
-  if (source_len == 0 || dest_len == 0)
-    return;
-
-  for (int i = 0; i < dest_len; i++)
-  {
-    // Calculate the floating point index in the source array
-    float pos = (float)i * (source_len - 1) / (dest_len - 1);
-    int idx = (int)pos;
-    float frac = pos - idx;
-
-    // Interpolate for all axes
-    for (int axis = 0; axis < AXIS_NUMBER; axis++)
-    {
-      float val0 = source[idx * AXIS_NUMBER + axis];
-      float val1 = val0;
-      if ((idx + 1) < source_len)
-      {
-        val1 = source[(idx + 1) * AXIS_NUMBER + axis];
-      }
-
-      dest[i * AXIS_NUMBER + axis] = val0 + frac * (val1 - val0);
-    }
-  }
-}
-
 static void MPU9250_Print_WhoAmI(void)
 {
   uint8_t who_am_i = 0U;
@@ -229,11 +377,7 @@ static void build_mlp_features(const float *source, uint16_t source_len,
                                float *dest, uint16_t dest_len)
 {
   // The training data uses 100 samples * 6 axes flattened to float (600 columns).
-  const uint16_t target_samples = 100U;
-  float resampled[target_samples * AXIS_NUMBER];
-
-  // Clamp source_len to available buffer and avoid div-by-zero
-  if (source_len == 0)
+  if (source_len == 0 || dest_len < MODEL_WINDOW_LENGTH)
   {
     memset(dest, 0, dest_len * sizeof(float));
     return;
@@ -244,31 +388,21 @@ static void build_mlp_features(const float *source, uint16_t source_len,
     used_samples = MAX_RAW_SAMPLES;
   }
 
-  normalize_buffer((float *)source, used_samples, resampled, target_samples);
-
-  uint32_t total_feats = target_samples * AXIS_NUMBER;
-  if (total_feats > dest_len)
-  {
-    total_feats = dest_len; // truncate extra features
-  }
-
-  // Copy and scale to match Python StandardScaler used in training
-  for (uint32_t i = 0; i < total_feats; i++)
-  {
-    float centered = resampled[i] - MLP_MEAN[i];
-    float scale = MLP_SCALE[i];
-    if (scale != 0.0f)
-    {
-      dest[i] = centered / scale;
-    }
-    else
-    {
-      dest[i] = centered;
-    }
-  }
+#if MLP_FEATURE_SELECT
+  model_resample_selected(source, used_samples, mlp_select__32_32__1e_05_feature_index, MLP_SELECT_FEATURES, dest);
+#if MLP_AB_MODELS
+  // The registry models take the whole window
+  model_resample_window(source, used_samples, mlp_window);
+#endif
+  const uint32_t n_features = MLP_SELECT_FEATURES;
+#else
+  model_resample_window(source, used_samples, mlp_window);
+  model_build_standardized(mlp_window, dest);
+  const uint32_t n_features = MODEL_WINDOW_LENGTH;
+#endif
 
   // Zero any unused tail
-  for (uint32_t i = total_feats; i < dest_len; i++)
+  for (uint32_t i = n_features; i < dest_len; i++)
   {
     dest[i] = 0.0f;
   }
@@ -293,38 +427,293 @@ static void classify_with_mlp(void)
   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
   DWT->CYCCNT = 0; // Reset cycle counter to 0
 
-  // Run the MLP model (6-class classifier)
-  float probs[6] = {0};
-  const int n_classes = (int)(sizeof(probs) / sizeof(probs[0]));
-  int32_t err = mlp_perf__32_32__1e_05_regress(mlp_features, MLP_FEATURE_DIM, probs, n_classes);
+  // Run the MLP model (6-class classifier). Class from the logits, no softmax
+  float logits[6] = {0};
+  const int n_classes = (int)(sizeof(logits) / sizeof(logits[0]));
+  float margin = 0.0f;
+#if MLP_FEATURE_SELECT
+  const int32_t cls = mlp_select__32_32__1e_05_predict_logits(mlp_features, logits, &margin);
+#elif MLP_CASCADE
+  const int32_t cls = eml_net_cascade_predict(&mlp_cascade, mlp_features, logits, &margin, NULL);
+#else
+  const int32_t cls = mlp_large_predict_logits(mlp_features, logits, &margin);
+#endif
 
   uint32_t cycle_count = DWT->CYCCNT; // Read cycle counter
   float inference_time_us = (float)cycle_count * 1000000.0f / HAL_RCC_GetHCLKFreq();
 
-  int32_t cls = -1;
-  float prob = 0.0f;
-  if (err == 0)
+  report_classification(cls, logits, n_classes, margin, inference_time_us);
+#if EML_NET_PROFILE
+  print_profile("small", &mlp_profile_small);
+  print_profile("large", &mlp_profile_large);
+#endif
+}
+
+#if MLP_BLOB
+static int load_mlp_blob(void)
+{
+  if (eml_net_blob_load((const void *)MLP_BLOB_ADDRESS, MLP_BLOB_LENGTH, &mlp_blob) != EmlOk)
+  {
+    return -1;
+  }
+  if (eml_net_blob_workspace_size(&mlp_blob) > (int32_t)sizeof(mlp_blob_workspace)
+      || eml_net_blob_bind(&mlp_blob, mlp_blob_workspace, (int32_t)sizeof(mlp_blob_workspace)) != EmlOk
+      || eml_net_check(&mlp_blob.net, &mlp_blob_checked) != EmlOk
+      || mlp_blob_checked.n_inputs != (int32_t)MLP_FEATURE_DIM
+      || mlp_blob_checked.n_outputs != (int32_t)(sizeof(model_class_names) / sizeof(model_class_names[0])))
+  {
+    return -2;
+  }
+#if EML_NET_PROFILE
+  mlp_blob.net.profile = &mlp_profile_large;
+#endif
+  mlp_large_predict_logits = mlp_blob_predict_logits;
+  return 0;
+}
+
+static int32_t mlp_blob_predict_logits(const float *features, float *logits, float *margin)
+{
+  if (mlp_blob.scaler_mean)
+  {
+    eml_net_blob_scale(&mlp_blob, features, mlp_blob_features);
+    features = mlp_blob_features;
+  }
+  return eml_net_predict_logits_unchecked(&mlp_blob_checked, features, logits, margin);
+}
+#endif
+
+#if MLP_AB_MODELS
+static void compare_models(void)
+{
+  const float cycles_per_us = (float)HAL_RCC_GetHCLKFreq() / 1000000.0f;
+  for (int32_t id = 0; id < ModelIds; id++)
+  {
+    const ModelDescriptor *model = model_get(id);
+    float margin = 0.0f;
+
+    DWT->CYCCNT = 0;
+    model->build_features(mlp_window, ab_features);
+    const uint32_t features_cycles = DWT->CYCCNT;
+    DWT->CYCCNT = 0;
+    const int32_t cls = model->predict(ab_features, NULL, &margin);
+    const uint32_t predict_cycles = DWT->CYCCNT;
+
+    const char *label = (cls >= 0 && cls < MODEL_N_CLASSES) ? model->class_names[cls] : "out_of_range";
+    char buffer[128];
+    int len = snprintf(buffer, sizeof(buffer),
+                       "A/B %-22s %-10s margin %6.2f | predict %8.2f us, features %6.2f us\r\n",
+                       model->name, label, margin,
+                       (float)predict_cycles / cycles_per_us, (float)features_cycles / cycles_per_us);
+    HAL_UART_Transmit(&huart2, (uint8_t *)buffer, len, HAL_MAX_DELAY);
+  }
+}
+#endif
+
+#if MLP_INCREMENTAL
+static void incremental_init(void)
+{
+  mlp_perf__32_32__1e_05_accumulate_reset(mlp_acc_base);
+#if MLP_SCALER_FOLDED
+  // The folded layer 0 takes raw values, so a window at the mean is MLP_MEAN itself
+  (void)mlp_perf__32_32__1e_05_accumulate(0, MLP_MEAN, MLP_FEATURE_DIM, mlp_acc_base);
+#endif
+  // Without folding, standardized features at the mean are 0, which leaves the biases
+}
+
+static void incremental_reset(void)
+{
+  memcpy(mlp_acc, mlp_acc_base, sizeof(mlp_acc));
+  memset(incremental_sum, 0, sizeof(incremental_sum));
+  incremental_sum_count = 0;
+  incremental_slots = 0;
+}
+
+static void incremental_add_sample(const float *sample)
+{
+  if (incremental_slots >= MODEL_WINDOW_SAMPLES)
+  {
+    return; // Window full, the rest of the gesture is cut
+  }
+  for (int axis = 0; axis < AXIS_NUMBER; axis++)
+  {
+    incremental_sum[axis] += sample[axis];
+  }
+  incremental_sum_count++;
+  if (incremental_sum_count < MLP_INCREMENTAL_DECIMATION)
+  {
+    return;
+  }
+
+  // Slot values relative to the mean, scaled when the model takes standardized features
+  const uint32_t offset = (uint32_t)incremental_slots * AXIS_NUMBER;
+  float delta[AXIS_NUMBER];
+  for (int axis = 0; axis < AXIS_NUMBER; axis++)
   {
-    for (int i = 0; i < n_classes; i++)
+    delta[axis] = (incremental_sum[axis] / (float)incremental_sum_count) - MLP_MEAN[offset + axis];
+#if !MLP_SCALER_FOLDED
+    if (MLP_SCALE[offset + axis] != 0.0f)
     {
-      if (probs[i] > prob)
-      {
-        prob = probs[i];
-        cls = i;
-      }
+      delta[axis] /= MLP_SCALE[offset + axis];
+    }
+#endif
+    incremental_sum[axis] = 0.0f;
+  }
+  incremental_sum_count = 0;
+  (void)mlp_perf__32_32__1e_05_accumulate((int32_t)offset, delta, AXIS_NUMBER, mlp_acc);
+  incremental_slots++;
+}
+
+static void classify_with_incremental(void)
+{
+  if (incremental_slots == 0)
+  {
+    const char *msg = "MLP: gesture too short, skipping classification\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    return;
+  }
+  // A partial last slot is dropped, it is less than MLP_INCREMENTAL_DECIMATION samples
+
+  // --- Measure Inference Time START ---
+  // Layer 0 already ran during capture, only its ReLU and layers 1 and 2 run here
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  DWT->CYCCNT = 0;
+
+  float logits[6] = {0};
+  const int n_classes = (int)(sizeof(logits) / sizeof(logits[0]));
+  float margin = 0.0f;
+  const int32_t cls = mlp_perf__32_32__1e_05_predict_logits_accumulated(mlp_acc, logits, &margin);
+
+  uint32_t cycle_count = DWT->CYCCNT;
+  float inference_time_us = (float)cycle_count * 1000000.0f / HAL_RCC_GetHCLKFreq();
+
+  report_classification(cls, logits, n_classes, margin, inference_time_us);
+}
+#endif
+
+#if MLP_STREAMING
+static void stream_reset(void)
+{
+  gru_stream_reset();
+  memset(stream_sum, 0, sizeof(stream_sum));
+  stream_sum_count = 0;
+  stream_steps = 0;
+}
+
+static void stream_add_sample(const float *sample)
+{
+  if (stream_steps >= GRU_MAX_STEPS)
+  {
+    return;
+  }
+  for (int axis = 0; axis < AXIS_NUMBER; axis++)
+  {
+    stream_sum[axis] += sample[axis];
+  }
+  stream_sum_count++;
+  if (stream_sum_count < MLP_STREAM_DECIMATION)
+  {
+    return;
+  }
+
+  float step[AXIS_NUMBER];
+  for (int axis = 0; axis < AXIS_NUMBER; axis++)
+  {
+    step[axis] = stream_sum[axis] / (float)stream_sum_count;
+    stream_sum[axis] = 0.0f;
+  }
+  stream_sum_count = 0;
+  if (gru_stream_push(step) == 0)
+  {
+    stream_steps++;
+  }
+}
+
+static void classify_with_stream(void)
+{
+  if (stream_steps == 0)
+  {
+    const char *msg = "GRU: gesture too short, skipping classification\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    return;
+  }
+  // A partial last step is dropped, it is less than MLP_STREAM_DECIMATION samples
+
+  // --- Measure Inference Time START ---
+  // Only the dense head runs here, the GRU steps already ran during capture
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  DWT->CYCCNT = 0;
+
+  float logits[6] = {0};
+  const int n_classes = (int)(sizeof(logits) / sizeof(logits[0]));
+  float margin = 0.0f;
+  const int32_t cls = gru_stream_predict_logits(logits, &margin);
+
+  uint32_t cycle_count = DWT->CYCCNT;
+  float inference_time_us = (float)cycle_count * 1000000.0f / HAL_RCC_GetHCLKFreq();
+
+  report_classification(cls, logits, n_classes, margin, inference_time_us);
+#if EML_NET_PROFILE
+  print_profile("gru head", &gru_profile);
+#endif
+}
+#endif
+
+#if EML_NET_PROFILE
+static void print_profile(const char *name, EmlNetProfile *profile)
+{
+  if (profile->inferences == 0)
+  {
+    return;
+  }
+
+  char buffer[128];
+  int len = snprintf(buffer, sizeof(buffer), "Profile %s: %lu cycles per inference\r\n",
+                     name, (unsigned long)(profile->total_cycles / profile->inferences));
+  HAL_UART_Transmit(&huart2, (uint8_t *)buffer, len, HAL_MAX_DELAY);
+
+  for (int32_t l = 0; l < profile->n_layers; l++)
+  {
+    const EmlNetLayerProfile *layer = &profile->layers[l];
+    if (layer->calls == 0)
+    {
+      continue; // Layers before the first one run, like the GRU when streaming
     }
+    len = snprintf(buffer, sizeof(buffer),
+                   "  layer %ld: %lu cycles + %lu activation, %lu MACs\r\n",
+                   (long)l,
+                   (unsigned long)(layer->linear_cycles / layer->calls),
+                   (unsigned long)(layer->activation_cycles / layer->calls),
+                   (unsigned long)(layer->macs / layer->calls));
+    HAL_UART_Transmit(&huart2, (uint8_t *)buffer, len, HAL_MAX_DELAY);
   }
+  eml_net_profile_reset(profile);
+}
+#endif
 
+static void report_classification(int32_t cls, float *logits, int n_classes, float margin,
+                                  float inference_time_us)
+{
   const char *label = "out_of_range";
   if (cls >= 0 && cls < n_classes)
   {
-    label = mlp_class_names[cls];
+    label = model_class_names[cls];
   }
 
   char buffer[128];
+#if MLP_REPORT_PROB
+  // Probabilities only for the report, outside the timed path
+  eml_softmax_fast(logits, n_classes);
+  const float prob = (cls >= 0 && cls < n_classes) ? logits[cls] : 0.0f;
   int len = snprintf(buffer, sizeof(buffer),
                      "Inference: %.2f us | Class: %s (Prob: %.2f)\r\n",
                      inference_time_us, label, prob);
+#else
+  int len = snprintf(buffer, sizeof(buffer),
+                     "Inference: %.2f us | Class: %s (Margin: %.2f)\r\n",
+                     inference_time_us, label, margin);
+#endif
   HAL_UART_Transmit(&huart2, (uint8_t *)buffer, len, HAL_MAX_DELAY);
 }
 
@@ -364,6 +753,75 @@ int main(void)
   /* USER CODE BEGIN 2 */
   MPU9250_Print_WhoAmI();
   MPU9250_Init();
+
+  // Validate the model once, so classify_with_mlp can use the unchecked fast path
+  if (mlp_perf__32_32__1e_05_check() != 0)
+  {
+    const char *msg = "MLP: model failed validation\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    Error_Handler();
+  }
+#if MLP_FEATURE_SELECT
+  if (mlp_select__32_32__1e_05_check() != 0)
+  {
+    const char *msg = "MLP: selected-input model failed validation\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    Error_Handler();
+  }
+#endif
+#if EML_NET_PROFILE
+  mlp_perf__32_32__1e_05_set_profile(&mlp_profile_large);
+#if MLP_FEATURE_SELECT
+  mlp_select__32_32__1e_05_set_profile(&mlp_profile_large);
+#endif
+  mlp_wt__8___1e_05_set_profile(&mlp_profile_small);
+  gru_set_profile(&gru_profile);
+#endif
+#if MLP_BLOB
+  {
+    const int blob_status = load_mlp_blob();
+    char msg[96];
+    if (blob_status == 0)
+    {
+      snprintf(msg, sizeof(msg), "MLP: using model blob at 0x%08lX, %lu bytes, %ld layers\r\n",
+               (unsigned long)MLP_BLOB_ADDRESS, (unsigned long)((const EmlNetBlobHeader *)MLP_BLOB_ADDRESS)->total_size,
+               (long)mlp_blob.net.n_layers);
+    }
+    else
+    {
+      snprintf(msg, sizeof(msg), "MLP: no usable model blob (%d), using the compiled model\r\n", blob_status);
+    }
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+  }
+#endif
+#if MLP_CASCADE
+  mlp_cascade_stages[1] = mlp_large_predict_logits;
+  if (mlp_wt__8___1e_05_check() != 0 || eml_net_cascade_check(&mlp_cascade) != EmlOk)
+  {
+    const char *msg = "MLP: cascade failed validation\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    Error_Handler();
+  }
+#endif
+#if MLP_INCREMENTAL
+  incremental_init();
+#endif
+#if MLP_AB_MODELS
+  if (model_check_all() >= 0)
+  {
+    const char *msg = "Registry: model failed validation\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    Error_Handler();
+  }
+#endif
+#if MLP_STREAMING
+  if (gru_check() != 0)
+  {
+    const char *msg = "GRU: model failed validation\r\n";
+    HAL_UART_Transmit(&huart2, (uint8_t *)msg, strlen(msg), HAL_MAX_DELAY);
+    Error_Handler();
+  }
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -385,6 +843,12 @@ int main(void)
       char *header = "Recording...\r\n";
       HAL_UART_Transmit(&huart2, (uint8_t *)header, strlen(header), HAL_MAX_DELAY);
       raw_count = 0; // Reset counter for new recording
+#if MLP_STREAMING
+      stream_reset();
+#endif
+#if MLP_INCREMENTAL
+      incremental_reset();
+#endif
     }
 
     // 2. Collect data while the button is held down
@@ -401,6 +865,12 @@ int main(void)
           raw_data[raw_count * AXIS_NUMBER + 3] = Gx;
           raw_data[raw_count * AXIS_NUMBER + 4] = Gy;
           raw_data[raw_count * AXIS_NUMBER + 5] = Gz;
+#if MLP_STREAMING
+          stream_add_sample(&raw_data[raw_count * AXIS_NUMBER]);
+#endif
+#if MLP_INCREMENTAL
+          incremental_add_sample(&raw_data[raw_count * AXIS_NUMBER]);
+#endif
           raw_count++;
         }
       }
@@ -411,8 +881,19 @@ int main(void)
     {
       if (raw_count > 0)
       {
+#if MLP_STREAMING
+        // The GRU already consumed the gesture, run only its head
+        classify_with_stream();
+#elif MLP_INCREMENTAL
+        // Layer 0 already consumed the gesture, run only the rest of the model
+        classify_with_incremental();
+#else
         // Run MLP classifier on the recorded gesture
         classify_with_mlp();
+#if MLP_AB_MODELS
+        compare_models();
+#endif
+#endif
 
         // Optionally clear raw_count so the next gesture starts fresh
         // raw_count = 0;
@@ -1,37 +1,119 @@
-
 #include "mlp_model.h"
 #include <eml_net.h>
-static const float mlp_perf__32_32__1e_05_layer_0_biases[32] = { -0.056104f, -0.077486f, -0.081478f, 0.078756f, -0.015881f, -0.065573f, -0.002713f, 0.028302f, 0.072239f, -0.042626f, -0.082569f, 0.090163f, 0.046730f, -0.105588f, 0.085866f, -0.099719f, 0.049660f, 0.024121f, -0.017419f, -0.048973f, -0.087346f, 0.032082f, -0.068866f, 0.089475f, -0.042400f, 0.059808f, -0.025868f, -0.054855f, 0.076428f, 0.051750f, 0.015291f, 0.020223f };
-static const float mlp_perf__32_32__1e_05_layer_0_weights[19200] = { 0.009608f, 0.033139f, 0.031436f, 0.018337f, -0.004274f, 0.015602f, -0.001902f, 0.089969f, 0.102373f, -0.013540f, 0.057626f, 0.005504f, -0.000805f, 0.095716f, -0.100792f, -0.097777f, -0.106161f, 0.052608f, 0.057563f, 0.070983f, 0.085353f, 0.076057f, 0.009595f, 0.045017f, -0.074149f, 0.044016f, -0.079899f, 0.104976f, -0.007506f, -0.026949f, -0.035841f, 0.066346f, -0.011704f, 0.023776f, -0.091698f, 0.029882f, 0.034980f, 0.038080f, 0.074877f, 0.052109f, -0.024379f, -0.008467f, 0.036557f, -0.096374f, 0.018540f, 0.028414f, -0.047812f, -0.064942f, -0.049078f, -0.010127f, 0.025227f, -0.026344f, 0.110330f, -0.089822f, -0.039437f, -0.076440f, 0.029886f, -0.035591f, -0.000609f, -0.052375f, -0.082927f, -0.062641f, 0.039208f, -0.081777f, -0.056908f, -0.009896f, 0.050999f, -0.082453f, 0.058076f, -0.068492f, 0.084265f, -0.018028f, 0.085928f, 0.003709f, 0.055763f, -0.071817f, -0.029428f, -0.084724f, -0.025289f, -0.068568f, -0.020024f, -0.007753f, -0.089956f, 0.028350f, 0.020045f, -0.063068f, 0.000172f, -0.065375f, 0.012918f, 0.068432f, -0.023870f, 0.020927f, -0.058817f, 0.047235f, -0.041183f, -0.075463f, 0.015714f, -0.080301f, 0.058943f, -0.083836f, 0.024813f, -0.032779f, 0.030910f, 0.107903f, -0.050923f, 0.001773f, 0.033133f, 0.008524f, -0.045752f, 0.085783f, -0.001999f, 0.079499f, 0.029478f, -0.024841f, 0.074402f, -0.034273f, 0.086292f, 0.007303f, 0.091354f, 0.027039f, 0.042886f, 0.011263f, 0.091164f, 0.036833f, -0.032364f, 0.028600f, -0.093985f, -0.047530f, 0.023592f, -0.057672f, 0.015773f, -0.025337f, -0.079388f, -0.025913f, 0.002689f, 0.006087f, 0.003670f, 0.046593f, 0.024335f, -0.028384f, 0.089807f, -0.028891f, -0.021624f, 0.091852f, 0.061521f, 0.053189f, -0.069443f, 0.090019f, 0.046357f, 0.112399f, -0.085674f, 0.060704f, -0.065594f, 0.028206f, -0.062401f, 0.049714f, 0.047363f, 0.020759f, -0.014108f, -0.092235f, 0.031936f, -0.026501f, 0.053362f, 0.054804f, 0.110041f, 0.082956f, -0.098664f, -0.039787f, 0.040457f, -0.048412f, -0.013672f, -0.101447f, -0.042893f, -0.095396f, 0.044354f, -0.063671f, -0.041853f, 0.092878f, 0.021822f, -0.091195f, -0.071393f, 0.018611f, -0.002043f, -0.039368f, 0.082481f, 0.032552f, 0.022202f, 0.000287f, 0.028093f, -0.021320f, -0.022239f, -0.062423f, -0.061466f, 0.081332f, 0.058215f, 0.007803f, -0.041100f, -0.060862f, -0.075788f, 0.000800f, -0.024718f, 0.044341f, -0.022169f, -0.059566f, -0.106378f, -0.071783f, 0.017530f, -0.026161f, -0.005372f, 0.064841f, 0.098785f, -0.057162f, 0.023758f, -0.028496f, -0.076253f, 0.043236f, -0.034816f, -0.005878f, 0.007057f, 0.082834f, 0.013772f, 0.062839f, -0.035134f, 0.070636f, -0.064096f, 0.098772f, 0.037822f, -0.048437f, 0.099798f, 0.060244f, -0.060318f, -0.038810f, 0.005991f, -0.088941f, -0.057908f, -0.025440f, -0.037554f, -0.011688f, -0.034850f, 0.025743f, 0.057815f, -0.057736f, 0.015029f, -0.086119f, 0.057463f, -0.032298f, 0.030070f, -0.072732f, -0.068762f, 0.010175f, -0.022404f, 0.083625f, 0.035141f, 0.061572f, 0.087248f, -0.092440f, 0.013251f, 0.032136f, 0.078180f, -0.045272f, -0.061913f, -0.067254f, -0.103011f, 0.071971f, 0.025154f, 0.039141f, -0.032585f, 0.034663f, -0.072423f, -0.013857f, 0.107776f, 0.084669f, -0.015957f, 0.099174f, -0.057313f, 0.080202f, 0.093653f, 0.040798f, 0.021051f, 0.086320f, -0.042404f, 0.052835f, 0.033944f, -0.107304f, -0.016774f, -0.066120f, 0.093527f, -0.017704f, -0.001774f, 0.040753f, -0.030641f, -0.057464f, 0.049405f, -0.049065f, -0.012640f, -0.035935f, -0.080597f, 0.056834f, 0.108406f, 0.087315f, 0.088248f, 0.051089f, -0.023845f, -0.069672f, -0.026596f, -0.038228f, -0.058053f, -0.101166f, 0.054285f, -0.103950f, 0.069484f, -0.078610f, -0.083089f, -0.069108f, 0.034091f, -0.038058f, -0.032966f, 0.018450f, 0.069081f, 0.036011f, -0.052713f, -0.088545f, -0.091500f, -0.050403f, -0.053898f, 0.004761f, 0.024649f, 0.027810f, -0.052702f, -0.006451f, -0.066288f, 0.040812f, -0.074178f, 0.037129f, 0.044691f, 0.069203f, -0.048157f, -0.011107f, 0.025502f, -0.035734f, -0.021867f, -0.042833f, -0.024764f, -0.099329f, 0.058606f, -0.075911f, 0.014645f, -0.055492f, 0.000803f, 0.096683f, 0.033663f, -0.097860f, -0.018458f, -0.015480f, 0.011205f, 0.019002f, -0.026272f, -0.058888f, -0.026412f, 0.076177f, -0.067132f, 0.094689f, -0.008977f, -0.023191f, 0.091089f, -0.009782f, 0.030985f, -0.024605f, 0.068918f, 0.047642f, 0.020625f, -0.030748f, 0.045535f, 0.026487f, -0.068107f, -0.060591f, 0.054230f, 0.098666f, 0.006217f, 0.000511f, 0.053021f, 0.005824f, 0.087266f, 0.008470f, 0.061898f, 0.079308f, 0.073090f, -0.056626f, 0.037731f, -0.032914f, -0.074813f, -0.001256f, -0.035141f, 0.070732f, -0.088266f, 0.094669f, -0.041714f, -0.015596f, -0.110223f, -0.078299f, -0.031559f, 0.070968f, -0.074811f, 0.084080f, 0.063912f, 0.008355f, -0.016584f, -0.055487f, 0.022583f, -0.074163f, -0.104361f, 0.004421f, -0.095099f, -0.057694f, -0.046394f, -0.035841f, -0.074498f, -0.084406f, -0.074089f, 0.030267f, 0.104553f, 0.110761f, -0.030619f, -0.048451f, 0.029063f, 0.000872f, 0.095613f, -0.095494f, 0.043162f, -0.045676f, -0.041658f, 0.041422f, -0.062557f, 0.049361f, 0.015114f, -0.029267f, 0.025863f, -0.053439f, 0.057602f, -0.027898f, -0.026426f, 0.076562f, 0.088304f, -0.090067f, -0.068770f, -0.016537f, 0.069673f, 0.083353f, 0.095433f, 0.094326f, -0.051707f, 0.090055f, -0.062010f, -0.065727f, 0.078997f, -0.063513f, 0.028241f, -0.101979f, 0.055121f, 0.091692f, -0.032068f, -0.034847f, -0.009424f, 0.064532f, -0.035386f, -0.054484f, -0.015298f, -0.039238f, 0.074068f, -0.068646f, -0.004042f, 0.099345f, 0.023898f, 0.056481f, 0.096571f, 0.035606f, 0.051817f, 0.091420f, 0.096577f, -0.022624f, -0.085047f, -0.026466f, -0.070196f, -0.002262f, -0.087825f, 0.030690f, -0.037447f, 0.094757f, 0.088661f, -0.005160f, -0.027036f, 0.021129f, 0.088798f, -0.020303f, 0.019201f, -0.032893f, -0.015937f, -0.006023f, -0.035242f, -0.013032f, -0.029720f, -0.033751f, 0.021220f, 0.039975f, -0.030578f, 0.093337f, 0.069032f, -0.073020f, -0.065052f, -0.003901f, -0.079175f, -0.036703f, 0.038534f, 0.018557f, 0.025218f, 0.029037f, -0.063945f, -0.017731f, 0.023163f, 0.065942f, -0.001512f, -0.025278f, -0.093829f, 0.025158f, -0.084548f, -0.023830f, -0.004117f, 0.096886f, -0.085206f, -0.004880f, -0.084197f, -0.021921f, 0.025067f, -0.026181f, -0.072848f, -0.082110f, 0.015038f, 0.045403f, 0.044553f, 0.070175f, -0.111873f, 0.035641f, 0.026062f, 0.011593f, 0.086721f, -0.111532f, 0.038983f, 0.045036f, 0.018147f, -0.019069f, 0.049875f, -0.091578f, -0.018700f, 0.020165f, 0.020511f, -0.094686f, -0.035651f, -0.019337f, 0.011564f, 0.082012f, 0.016336f, -0.059765f, 0.075121f, 0.077428f, -0.002477f, 0.089606f, -0.009688f, 0.080776f, 0.059457f, 0.098988f, 0.095381f, -0.107595f, -0.080077f, -0.008405f, 0.088884f, -0.045635f, -0.066929f, 0.080475f, 0.001137f, 0.089362f, -0.053608f, 0.018178f, -0.001213f, -0.068954f, 0.050090f, -0.049883f, -0.085599f, -0.078887f, -0.099091f, 0.091578f, 0.039650f, 0.060736f, 0.021500f, -0.007230f, -0.034471f, 0.093790f, -0.034807f, 0.011007f, -0.006524f, 0.094099f, -0.063140f, -0.016812f, 0.025260f, -0.066851f, 0.010398f, -0.013656f, -0.035264f, -0.038970f, 0.000037f, -0.014763f, -0.007068f, -0.023824f, 0.104014f, -0.056330f, -0.091398f, -0.013372f, 0.019740f, 0.031672f, -0.019118f, 0.086701f, -0.039695f, 0.038717f, 0.036858f, 0.070695f, 0.079707f, 0.093041f, 0.063401f, 0.024087f, -0.016949f, -0.080898f, -0.067856f, -0.061185f, -0.012103f, 0.016830f, 0.058676f, 0.088965f, -0.091401f, -0.063619f, 0.024921f, 0.036556f, 0.072863f, 0.099340f, 0.082073f, -0.026719f, -0.036974f, -0.057066f, 0.027113f, 0.019080f, 0.061202f, -0.093730f, 0.008828f, 0.028391f, -0.038158f, -0.075698f, 0.085495f, -0.068999f, 0.010125f, -0.065103f, -0.014809f, 0.094399f, -0.006604f, 0.052256f, -0.078970f, -0.031611f, -0.020980f, -0.034623f, 0.044390f, -0.044308f, 0.054329f, 0.026863f, -0.017892f, -0.026265f, 0.020560f, -0.069559f, 0.063238f, 0.044026f, 0.028148f, 0.015872f, -0.089889f, -0.001107f, -0.020914f, -0.049686f, -0.074706f, 0.058755f, -0.064443f, 0.018897f, 0.049313f, 0.035966f, 0.084003f, -0.065364f, 0.085328f, -0.106020f, 0.008168f, -0.028364f, 0.019993f, -0.033301f, -0.059307f, -0.083306f, 0.000029f, 0.084875f, -0.039223f, -0.048071f, -0.084964f, -0.085778f, -0.062847f, -0.094151f, -0.026871f, -0.096822f, -0.087917f, 0.081938f, -0.076916f, 0.005619f, 0.044452f, 0.008351f, -0.065939f, -0.074810f, -0.003816f, 0.009266f, -0.039599f, 0.068313f, 0.039959f, 0.096427f, -0.083301f, 0.085845f, -0.023477f, 0.090883f, 0.021785f, 0.095375f, 0.048237f, -0.018164f, 0.011575f, -0.039785f, -0.041070f, -0.038751f, 0.006480f, 0.033078f, -0.047020f, -0.012627f, -0.075867f, -0.082291f, -0.075134f, 0.104918f, -0.104272f, -0.075767f, 0.013869f, -0.065053f, 0.057349f, 0.027764f, 0.108517f, -0.000350f, -0.050976f, 0.021802f, 0.080169f, 0.016534f, -0.064001f, 0.080027f, -0.026697f, -0.086157f, -0.067116f, -0.040739f, 0.064942f, -0.001907f, 0.002233f, -0.049093f, 0.057369f, 0.100240f, 0.098067f, -0.031062f, 0.090051f, 0.065503f, 0.045751f, -0.039695f, -0.042830f, -0.078331f, 0.092807f, -0.026531f, 0.002592f, -0.004391f, 0.059368f, 0.074997f, -0.083791f, -0.002369f, 0.062440f, 0.045231f, -0.089451f, -0.079940f, -0.034182f, -0.086340f, -0.022541f, -0.060294f, 0.030574f, -0.046128f, 0.019039f, -0.058138f, 0.082880f, 0.102535f, -0.031175f, -0.059743f, -0.042577f, 0.008565f, -0.092563f, 0.038587f, -0.015772f, -0.014989f, 0.072714f, 0.055729f, 0.075944f, -0.012074f, 0.079497f, 0.050942f, -0.025478f, 0.013412f, -0.051181f, 0.068424f, -0.064622f, -0.046591f, -0.074921f, -0.001811f, 0.059847f, -0.009386f, 0.012586f, -0.109853f, 0.002878f, -0.095431f, -0.055520f, 0.096854f, -0.050229f, 0.070815f, 0.042098f, -0.053580f, 0.027018f, -0.086136f, 0.050468f, 0.037800f, 0.048597f, -0.012246f, 0.066569f, -0.075745f, -0.049405f, 0.030635f, -0.027730f, -0.077681f, -0.068478f, 0.069081f, 0.006840f, 0.063296f, 0.061368f, -0.000168f, -0.008694f, 0.013133f, 0.068573f, 0.048775f, -0.087942f, 0.020935f, 0.077489f, 0.053533f, -0.065230f, -0.018314f, -0.059102f, -0.042171f, 0.097516f, 0.081816f, -0.039360f, -0.043929f, 0.017489f, 0.104819f, -0.065408f, -0.033083f, 0.057174f, 0.004531f, 0.064429f, -0.047018f, 0.003562f, -0.049001f, -0.018886f, 0.007164f, -0.001313f, -0.029110f, 0.090932f, 0.048328f, 0.042443f, -0.030067f, 0.028799f, 0.040092f, 0.048320f, -0.040553f, 0.064301f, 0.040925f, -0.069885f, 0.081175f, -0.017042f, 0.016327f, -0.014227f, 0.018250f, 0.019419f, 0.001848f, 0.062775f, 0.013475f, -0.002285f, -0.027073f, 0.061775f, -0.018699f, -0.063087f, -0.087852f, 0.066764f, 0.097354f, -0.068811f, -0.048925f, -0.058408f, -0.067998f, 0.067685f, -0.076158f, 0.082498f, -0.065990f, 0.079805f, 0.021398f, -0.033066f, -0.013922f, 0.036025f, -0.028139f, 0.027994f, 0.012448f, 0.008552f, 0.073552f, -0.003128f, 0.072098f, 0.051029f, -0.084785f, 0.048223f, -0.072635f, 0.076540f, -0.105035f, -0.020057f, -0.065107f, -0.012606f, 0.049202f, -0.047856f, -0.051359f, -0.050065f, 0.046182f, -0.052423f, -0.055466f, -0.095294f, 0.053796f, -0.019578f, -0.024099f, 0.024141f, -0.024646f, 0.043392f, 0.071889f, -0.073031f, 0.086735f, -0.070357f, -0.036515f, -0.049595f, -0.047261f, -0.020920f, 0.019189f, 0.072079f, 0.068481f, -0.055010f, 0.037189f, -0.064311f, 0.002322f, -0.022831f, -0.049009f, 0.007069f, 0.058377f, -0.072274f, 0.069323f, 0.053009f, -0.054481f, 0.072194f, 0.012801f, 0.094180f, -0.075702f, -0.005147f, -0.053903f, -0.033442f, 0.013892f, 0.074499f, 0.075397f, 0.061124f, 0.015217f, 0.082505f, 0.014261f, 0.062897f, 0.083346f, -0.065427f, 0.042763f, -0.089768f, -0.022874f, -0.055781f, 0.013033f, 0.049121f, -0.068658f, 0.015362f, 0.100355f, -0.065303f, 0.050629f, 0.020321f, -0.099505f, -0.001012f, 0.030716f, -0.098278f, 0.069281f, 0.015409f, -0.082394f, -0.066920f, 0.105453f, 0.028345f, -0.091145f, -0.026497f, -0.021105f, -0.075885f, -0.027111f, -0.000535f, -0.037302f, 0.022002f, 0.052209f, -0.068501f, 0.036134f, 0.032666f, 0.076226f, 0.061209f, 0.072175f, -0.014174f, -0.070108f, 0.081569f, -0.059596f, -0.014979f, -0.094954f, 0.074524f, 0.078447f, 0.051078f, -0.026677f, -0.036365f, -0.056926f, -0.055918f, 0.022518f, -0.053700f, -0.025133f, 0.017150f, 0.048013f, -0.083562f, -0.029605f, 0.025808f, 0.079515f, -0.007169f, 0.076263f, -0.034772f, -0.110049f, 0.008869f, -0.048633f, 0.067101f, -0.064384f, -0.039148f, 0.071675f, 0.047104f, 0.025698f, 0.024886f, -0.013187f, -0.108983f, -0.084186f, -0.001192f, -0.096529f, -0.070638f, 0.107775f, 0.081911f, -0.068743f, -0.087182f, 0.077995f, -0.035208f, -0.051361f, 0.050845f, -0.090535f, -0.059520f, 0.081864f, 0.036106f, 0.000840f, -0.020801f, 0.062332f, -0.077752f, 0.110186f, 0.075554f, 0.026631f, -0.094252f, 0.050400f, 0.071718f, 0.005815f, -0.013044f, -0.071510f, 0.056623f, 0.079885f, -0.074730f, 0.049635f, -0.093685f, 0.100396f, 0.030894f, -0.006022f, -0.042972f, 0.094196f, -0.055127f, 0.059361f, 0.082212f, 0.066543f, 0.013190f, -0.076827f, -0.016808f, 0.003159f, -0.070273f, -0.002540f, -0.030045f, -0.055617f, -0.005330f, -0.039757f, -0.008017f, -0.082287f, 0.085361f, 0.077440f, 0.002738f, 0.050907f, 0.088812f, -0.092001f, 0.039201f, 0.109401f, 0.087134f, 0.006569f, -0.081179f, 0.032921f, -0.114088f, -0.073629f, 0.106269f, -0.035575f, 0.018697f, -0.030293f, 0.090554f, 0.057427f, -0.051120f, 0.064522f, -0.077255f, -0.017948f, -0.072490f, 0.039975f, -0.079893f, -0.017386f, -0.030453f, -0.016037f, -0.046641f, 0.056797f, -0.088309f, 0.018421f, -0.052656f, -0.030308f, 0.069765f, 0.099364f, -0.024538f, 0.050449f, -0.066676f, 0.039664f, 0.060528f, -0.072299f, -0.005789f, 0.085472f, -0.090534f, -0.082631f, 0.015122f, -0.029232f, 0.046262f, 0.069465f, -0.034128f, -0.025743f, -0.010282f, 0.033004f, 0.112042f, 0.042113f, -0.021333f, -0.031683f, 0.076616f, -0.052739f, 0.033632f, 0.072329f, 0.036837f, -0.003488f, -0.061876f, -0.013770f, 0.046324f, 0.039778f, 0.095712f, 0.086351f, 0.049398f, 0.095809f, -0.041134f, -0.031521f, -0.017971f, 0.002198f, 0.023395f, -0.046524f, -0.081772f, -0.010913f, -0.050594f, 0.103127f, 0.088341f, 0.055571f, 0.044625f, -0.043138f, 0.027078f, 0.051844f, -0.076638f, 0.071377f, -0.085310f, 0.066681f, 0.042880f, -0.075155f, 0.029244f, -0.010669f, -0.056767f, -0.070945f, 0.040774f, 0.004012f, 0.078548f, 0.107124f, 0.086188f, -0.084454f, 0.073331f, -0.056282f, 0.000807f, 0.048468f, -0.046942f, 0.001765f, -0.043463f, -0.059752f, -0.058554f, -0.016600f, -0.103806f, -0.010151f, 0.044160f, -0.031842f, -0.083999f, -0.078996f, -0.045733f, -0.079618f, 0.101243f, -0.083639f, 0.071359f, 0.014287f, 0.018159f, -0.009599f, 0.089462f, -0.011260f, 0.061849f, 0.025212f, -0.035041f, 0.087316f, 0.007231f, -0.069167f, -0.019956f, 0.039537f, 0.054425f, 0.097444f, -0.034760f, 0.050082f, 0.002218f, 0.003014f, 0.099047f, 0.102238f, 0.083353f, -0.041432f, 0.060439f, 0.015942f, -0.007834f, -0.091743f, 0.051304f, 0.006841f, 0.046208f, 0.067274f, 0.067098f, -0.036823f, 0.052672f, 0.023248f, -0.014141f, 0.045453f, -0.078805f, -0.071246f, -0.030184f, 0.085031f, -0.062324f, -0.032858f, -0.080291f, -0.035662f, -0.023558f, 0.080772f, 0.057397f, -0.005999f, -0.096385f, 0.050509f, 0.018678f, -0.059702f, 0.106580f, -0.073797f, 0.058345f, -0.027768f, -0.022824f, 0.071549f, 0.032783f, 0.096058f, 0.023437f, -0.065283f, 0.064515f, 0.059156f, 0.046394f, -0.071811f, -0.028815f, -0.082596f, 0.062312f, 0.022859f, 0.089283f, 0.102503f, 0.045562f, 0.082701f, 0.013548f, -0.073598f, -0.111600f, -0.045531f, 0.080014f, 0.068085f, 0.088343f, -0.076700f, -0.083410f, 0.093467f, -0.055031f, 0.019187f, 0.093078f, -0.023395f, 0.014047f, -0.004552f, 0.051777f, 0.006479f, -0.037973f, -0.061961f, -0.064680f, 0.023374f, 0.044869f, 0.079649f, 0.038153f, 0.069473f, -0.053403f, -0.013721f, -0.006231f, 0.023120f, -0.029250f, -0.024767f, -0.016571f, 0.055190f, 0.024826f, -0.073628f, -0.095369f, -0.014102f, 0.049818f, 0.020131f, 0.028565f, 0.039038f, -0.036448f, 0.005452f, 0.000921f, 0.062585f, 0.107094f, -0.039958f, 0.057389f, 0.041315f, 0.005531f, 0.071862f, 0.077494f, -0.101323f, -0.064418f, 0.061316f, -0.084359f, 0.015586f, -0.046598f, -0.032683f, 0.051366f, -0.076747f, 0.060897f, 0.004440f, 0.003193f, 0.000005f, 0.035945f, -0.039386f, -0.087353f, -0.040711f, -0.052618f, 0.019260f, -0.048814f, 0.106026f, 0.103895f, 0.008673f, 0.037607f, 0.081707f, 0.093110f, 0.042218f, -0.035470f, -0.013422f, -0.055003f, 0.004867f, 0.078505f, 0.092301f, -0.070965f, -0.103557f, 0.085709f, -0.001741f, -0.071066f, 0.024425f, 0.012294f, -0.060033f, -0.057018f, -0.094823f, -0.068498f, -0.075253f, -0.049509f, 0.031046f, -0.077799f, -0.088549f, -0.057988f, -0.018890f, -0.023127f, -0.036103f, 0.042558f, 0.102164f, 0.020304f, 0.080122f, -0.022390f, -0.083976f, -0.020424f, -0.054729f, 0.008997f, 0.014661f, 0.004238f, 0.080123f, 0.079948f, 0.027743f, -0.004596f, -0.056147f, -0.014569f, 0.054352f, -0.056195f, -0.083568f, 0.068562f, 0.038371f, 0.018803f, 0.041699f, 0.081776f, 0.012424f, 0.086782f, 0.081800f, -0.034794f, 0.008672f, 0.016585f, 0.015053f, 0.096668f, -0.051363f, 0.078615f, 0.067243f, -0.005871f, 0.062663f, 0.050667f, 0.035226f, -0.045927f, -0.040547f, 0.045573f, 0.066914f, -0.100819f, 0.041436f, -0.020072f, 0.091836f, -0.020934f, 0.002971f, 0.016216f, -0.084342f, 0.050566f, 0.065073f, -0.077060f, -0.052383f, -0.076447f, 0.091503f, 0.019868f, 0.109186f, 0.010973f, 0.042221f, -0.037000f, -0.030119f, -0.013365f, 0.030332f, -0.041108f, 0.086207f, 0.086178f, -0.077160f, -0.061384f, -0.064117f, -0.093737f, -0.037721f, -0.018508f, 0.070813f, -0.050168f, 0.013027f, 0.074690f, 0.014684f, 0.058591f, -0.006379f, 0.110780f, 0.027860f, -0.096673f, -0.072435f, -0.027197f, 0.035525f, 0.036180f, -0.031210f, 0.057276f, 0.052493f, -0.028100f, 0.093318f, 0.035843f, 0.087086f, -0.005172f, 0.054941f, 0.051559f, 0.071171f, -0.086390f, 0.026347f, -0.012815f, 0.082204f, -0.063641f, 0.076516f, 0.055859f, -0.066116f, 0.004464f, 0.034232f, 0.049279f, 0.090607f, 0.069464f, -0.025854f, 0.009914f, 0.026166f, -0.059900f, -0.046107f, 0.007737f, -0.044003f, 0.080442f, 0.025975f, -0.042552f, 0.078712f, 0.057521f, 0.080501f, 0.055673f, -0.029656f, -0.068112f, 0.062602f, -0.093283f, -0.013134f, 0.100141f, 0.092545f, 0.027686f, 0.044103f, -0.099292f, 0.021113f, 0.000199f, -0.042512f, -0.079966f, -0.041576f, -0.031017f, 0.000184f, 0.027887f, 0.055149f, -0.023800f, -0.018590f, -0.104822f, -0.076585f, -0.044118f, 0.035355f, 0.034898f, 0.043969f, 0.042498f, 0.063823f, 0.055128f, 0.101091f, 0.064293f, 0.033350f, 0.030782f, -0.105598f, 0.111726f, -0.084818f, 0.064570f, 0.053423f, -0.024724f, -0.046204f, -0.075853f, 0.058511f, -0.026302f, 0.053268f, 0.083209f, -0.079752f, 0.090108f, -0.027916f, -0.050727f, 0.076950f, 0.079722f, -0.044707f, 0.019992f, -0.084056f, 0.017734f, 0.063905f, 0.047784f, -0.023509f, -0.013487f, -0.031597f, 0.017413f, 0.090841f, 0.097388f, -0.074915f, -0.066428f, -0.069988f, -0.044874f, -0.029456f, 0.000666f, 0.011345f, 0.042304f, 0.061624f, 0.105079f, 0.015599f, 0.079360f, 0.046388f, -0.032109f, 0.061968f, -0.091878f, -0.081366f, -0.039092f, 0.007117f, 0.015179f, -0.090828f, 0.024280f, 0.051346f, -0.064332f, -0.031744f, 0.019849f, 0.005698f, 0.071301f, 0.093519f, 0.067626f, -0.094804f, 0.071431f, -0.078200f, -0.042789f, -0.079704f, -0.074662f, -0.005496f, 0.032095f, -0.002748f, 0.087607f, -0.058994f, 0.040130f, 0.090295f, 0.025380f, -0.010503f, 0.011640f, -0.000638f, 0.001863f, -0.000952f, -0.005990f, 0.047087f, -0.065832f, -0.079679f, 0.078036f, 0.054377f, -0.032706f, -0.038411f, 0.098026f, 0.069030f, 0.008223f, -0.036542f, -0.082077f, -0.030091f, 0.021300f, 0.053800f, 0.079606f, -0.095328f, -0.063566f, -0.028144f, -0.066460f, 0.073428f, 0.050605f, 0.015327f, 0.087770f, -0.053054f, 0.072462f, -0.070411f, -0.062577f, 0.051765f, -0.085265f, -0.005030f, -0.014475f, 0.028169f, 0.095465f, 0.062013f, 0.059852f, -0.104464f, -0.045188f, 0.014447f, -0.032896f, -0.065394f, -0.021672f, 0.081803f, -0.029576f, -0.032571f, -0.089114f, 0.079968f, -0.082396f, -0.050066f, -0.048913f, 0.064226f, -0.075048f, 0.072346f, 0.062249f, 0.081998f, -0.061438f, -0.072709f, 0.031097f, -0.042657f, -0.034786f, -0.073345f, -0.060493f, 0.006849f, -0.065066f, -0.023620f, -0.004120f, -0.105773f, -0.011165f, -0.065675f, 0.010124f, 0.059798f, 0.071280f, -0.072668f, 0.006813f, 0.075737f, -0.052821f, 0.034439f, 0.064084f, 0.046734f, -0.073284f, -0.099143f, -0.069597f, -0.028546f, 0.041186f, -0.020063f, 0.040031f, -0.024175f, -0.077444f, -0.018225f, 0.065976f, 0.077811f, -0.052945f, 0.067351f, -0.047581f, 0.088595f, -0.053198f, 0.044554f, -0.069453f, 0.107023f, 0.028746f, 0.079280f, 0.016570f, -0.017331f, 0.035521f, -0.002426f, -0.016350f, 0.044615f, -0.050498f, -0.057254f, -0.026808f, -0.018934f, -0.068940f, 0.052166f, 0.067320f, -0.004624f, 0.111180f, -0.091940f, 0.051443f, -0.032557f, -0.024271f, -0.042342f, 0.039305f, -0.058045f, 0.067316f, 0.020788f, -0.077153f, 0.049834f, 0.011969f, 0.069682f, 0.032532f, 0.026191f, 0.054631f, -0.048054f, -0.002203f, -0.035894f, 0.104468f, -0.062157f, -0.085809f, -0.044608f, -0.004408f, -0.075737f, 0.024576f, 0.085375f, 0.040317f, 0.029692f, 0.104969f, 0.093042f, 0.064387f, 0.005199f, -0.005687f, -0.107651f, 0.029755f, 0.079014f, 0.074367f, -0.043427f, -0.062049f, 0.044415f, 0.044558f, 0.107416f, 0.077624f, 0.025076f, -0.089457f, -0.018774f, -0.042930f, -0.008245f, -0.039189f, 0.055435f, 0.082148f, -0.021365f, 0.032526f, -0.008802f, 0.088758f, -0.073560f, 0.050877f, 0.096285f, -0.060632f, -0.064985f, 0.022020f, 0.043676f, -0.006253f, 0.026894f, -0.058054f, -0.017514f, -0.086332f, -0.017209f, -0.027993f, -0.015056f, 0.076133f, -0.049140f, -0.028080f, 0.038180f, 0.100119f, -0.061724f, 0.094723f, -0.096397f, 0.006096f, -0.006215f, -0.046241f, -0.045228f, 0.006724f, 0.080329f, 0.073861f, 0.019895f, 0.079558f, 0.004401f, -0.041613f, -0.073299f, -0.005667f, -0.001591f, -0.102115f, -0.067797f, 0.015705f, -0.039143f, 0.064487f, -0.021180f, -0.084192f, -0.064351f, 0.082099f, -0.070794f, -0.067800f, 0.083708f, -0.056970f, 0.015450f, 0.062983f, 0.004641f, 0.106625f, 0.048878f, -0.083872f, -0.001983f, 0.035054f, 0.056318f, -0.108561f, 0.032925f, 0.078770f, 0.042367f, 0.014229f, -0.014521f, 0.017851f, 0.052660f, 0.068091f, 0.029796f, 0.074494f, 0.027387f, -0.101536f, 0.014173f, -0.038824f, -0.043844f, -0.014447f, -0.053752f, 0.001376f, 0.052044f, -0.035926f, -0.080834f, -0.082467f, 0.023123f, -0.050172f, -0.084388f, 0.093722f, -0.005825f, -0.068780f, 0.080077f, 0.105469f, -0.012278f, -0.081501f, -0.065626f, -0.035867f, 0.085516f, -0.070256f, 0.046564f, -0.106636f, -0.021118f, 0.029358f, -0.088772f, 0.012787f, 0.102882f, -0.047490f, 0.046961f, 0.021762f, -0.059293f, -0.106298f, -0.077363f, -0.002718f, 0.074825f, 0.032452f, 0.052811f, -0.004625f, 0.029418f, -0.059470f, 0.086114f, 0.062251f, 0.111687f, -0.048827f, -0.040734f, -0.068956f, 0.076579f, 0.067961f, -0.072434f, -0.000729f, -0.023013f, -0.055774f, -0.060272f, 0.076721f, -0.022490f, 0.100468f, -0.097768f, 0.006545f, -0.085477f, -0.078704f, 0.002324f, -0.076820f, 0.056323f, 0.038725f, -0.048962f, 0.069318f, 0.054018f, -0.039575f, 0.030244f, 0.054177f, -0.041275f, -0.037326f, -0.036552f, 0.006691f, 0.092536f, -0.074993f, 0.071477f, -0.103060f, 0.039173f, -0.002235f, 0.047097f, 0.050888f, -0.014298f, 0.020689f, 0.016233f, 0.072415f, 0.008071f, 0.012020f, -0.042819f, 0.037438f, -0.032431f, 0.017894f, -0.081029f, -0.070085f, -0.023750f, -0.005966f, -0.061555f, -0.059063f, -0.103789f, -0.086599f, -0.055246f, -0.010379f, 0.060987f, -0.000835f, 0.092427f, -0.101995f, -0.078575f, -0.034610f, 0.002513f, 0.068049f, -0.044065f, -0.033210f, -0.071267f, 0.075977f, -0.017843f, 0.022517f, 0.081573f, -0.084545f, -0.066233f, 0.052579f, 0.058405f, 0.036803f, -0.002902f, 0.086479f, -0.012338f, 0.017661f, -0.098394f, -0.025251f, 0.060233f, -0.036535f, 0.079382f, 0.027941f, -0.028571f, 0.043642f, -0.065273f, 0.105421f, -0.077447f, 0.097483f, -0.062902f, 0.060211f, -0.093494f, -0.037203f, 0.032541f, 0.022331f, -0.064772f, -0.035854f, -0.009446f, 0.021091f, 0.016089f, 0.054368f, -0.015301f, -0.009442f, -0.076259f, 0.046472f, 0.041429f, -0.019700f, 0.018139f, 0.031144f, -0.052388f, -0.099814f, -0.018468f, 0.017571f, -0.000118f, 0.038913f, 0.074956f, -0.011307f, -0.084732f, 0.069399f, -0.001289f, 0.064010f, 0.046739f, 0.082700f, -0.052991f, 0.033427f, -0.036841f, -0.036183f, -0.054393f, -0.015525f, 0.080526f, -0.027968f, -0.056962f, 0.025005f, -0.034316f, -0.018630f, 0.071310f, -0.053294f, -0.026982f, 0.004623f, 0.022518f, 0.095634f, 0.030433f, 0.060468f, 0.073425f, -0.026754f, -0.012210f, -0.079694f, -0.070565f, -0.047521f, -0.056766f, 0.060650f, 0.018321f, 0.043161f, 0.049460f, -0.041781f, -0.020833f, 0.051775f, -0.021436f, -0.086900f, -0.004041f, 0.066928f, -0.007361f, -0.034428f, 0.078878f, 0.015952f, -0.038804f, -0.078901f, 0.053370f, 0.030951f, 0.098675f, -0.036250f, -0.072992f, 0.044251f, -0.057683f, -0.073137f, -0.016865f, 0.052615f, -0.003485f, -0.083788f, 0.003946f, 0.032386f, 0.021196f, 0.028243f, -0.040600f, 0.079227f, 0.026481f, 0.032987f, 0.105819f, -0.009370f, 0.059607f, -0.081750f, -0.097555f, 0.005703f, -0.043141f, -0.037007f, -0.039539f, -0.049049f, 0.059691f, 0.028265f, 0.041178f, 0.078277f, 0.053356f, 0.001138f, -0.022935f, 0.082569f, 0.044657f, -0.082650f, 0.023542f, -0.044314f, 0.105645f, -0.096073f, 0.011502f, 0.052836f, -0.051085f, 0.079057f, 0.061211f, 0.064764f, -0.078984f, 0.001958f, -0.038288f, 0.057265f, 0.036232f, 0.024845f, -0.085401f, 0.014770f, 0.015558f, 0.080130f, 0.032278f, 0.100806f, 0.102898f, 0.042249f, 0.006856f, 0.010735f, 0.083477f, -0.087874f, -0.092436f, -0.081568f, 0.048255f, -0.023665f, 0.010532f, 0.033358f, -0.037465f, 0.012012f, 0.017756f, 0.083076f, 0.032171f, 0.025668f, -0.071554f, 0.077804f, -0.011045f, 0.057562f, -0.101605f, -0.016500f, -0.061924f, -0.035092f, 0.070443f, 0.037575f, -0.005365f, -0.087361f, 0.077965f, 0.102813f, -0.054239f, -0.095111f, 0.010090f, 0.072398f, 0.070565f, 0.007718f, -0.027943f, -0.035353f, 0.064127f, -0.007936f, -0.055984f, -0.034399f, -0.053504f, -0.084442f, 0.005481f, 0.072356f, 0.049077f, -0.070553f, -0.085479f, -0.030719f, -0.041467f, 0.064004f, 0.096088f, -0.010991f, 0.020197f, 0.112704f, 0.058807f, 0.011657f, -0.068577f, -0.026399f, 0.063960f, -0.070120f, 0.051929f, 0.049989f, -0.033321f, -0.006630f, 0.007071f, 0.041761f, 0.017886f, -0.072305f, 0.066429f, -0.026304f, 0.107523f, -0.041902f, -0.044942f, -0.031577f, 0.026451f, 0.068074f, -0.072175f, -0.042546f, 0.000474f, 0.007967f, -0.004538f, 0.053774f, 0.069819f, -0.009538f, 0.023949f, 0.043325f, 0.010279f, -0.025463f, 0.019166f, 0.029434f, 0.070278f, -0.077896f, 0.092669f, -0.005956f, -0.088859f, -0.030683f, 0.030457f, -0.018798f, 0.106828f, -0.011726f, -0.039077f, 0.076214f, -0.007964f, 0.029752f, 0.075297f, 0.040348f, -0.024541f, -0.069270f, 0.016140f, 0.088463f, -0.004462f, 0.090838f, -0.012227f, 0.034262f, 0.077825f, 0.023627f, -0.078326f, 0.094156f, -0.041240f, 0.028583f, 0.011431f, -0.005977f, -0.066350f, 0.031032f, -0.088041f, 0.091125f, 0.064983f, -0.002891f, 0.001842f, -0.022681f, 0.002157f, 0.074609f, -0.045170f, -0.009845f, -0.033522f, -0.041045f, -0.071088f, 0.098860f, 0.024881f, 0.041875f, -0.064373f, -0.011566f, 0.089821f, -0.069314f, -0.050732f, 0.016492f, 0.034990f, 0.070991f, 0.069705f, -0.054849f, -0.052821f, -0.027310f, -0.103769f, -0.071876f, -0.051729f, -0.017427f, -0.033676f, 0.088487f, -0.049460f, 0.096471f, 0.078956f, 0.007870f, -0.060209f, -0.041668f, 0.067063f, -0.045759f, -0.007442f, -0.019558f, 0.025103f, 0.094550f, -0.062325f, -0.018958f, -0.054859f, -0.040461f, -0.086292f, -0.043591f, 0.090426f, -0.051250f, -0.020039f, 0.075962f, 0.056334f, 0.021120f, 0.043268f, -0.067416f, -0.016830f, -0.083977f, -0.036357f, -0.062436f, -0.013803f, -0.008993f, 0.092635f, -0.028420f, 0.002914f, 0.065716f, 0.043970f, 0.044544f, -0.039363f, 0.005939f, -0.077433f, -0.046976f, -0.029137f, 0.052171f, -0.005131f, 0.072696f, 0.081919f, -0.088960f, 0.020790f, 0.012166f, 0.073502f, -0.091261f, -0.008861f, -0.059083f, -0.101085f, 0.024705f, 0.066299f, 0.067093f, -0.084509f, -0.010897f, -0.101202f, -0.036222f, -0.061553f, -0.064086f, -0.023102f, -0.058784f, 0.081702f, -0.039029f, 0.089358f, -0.064395f, 0.037909f, -0.090302f, 0.007273f, -0.081616f, 0.048137f, 0.076209f, -0.078054f, 0.075861f, 0.069708f, -0.014848f, 0.090877f, -0.026924f, -0.032326f, -0.068429f, 0.036460f, -0.080588f, -0.019188f, 0.052022f, 0.073936f, -0.082622f, 0.062249f, 0.050885f, -0.004948f, 0.004743f, -0.094656f, 0.031016f, -0.030526f, 0.060172f, -0.038412f, 0.016695f, 0.000463f, 0.072806f, -0.034776f, -0.090333f, 0.065852f, -0.016131f, 0.018043f, -0.091728f, 0.100241f, 0.064870f, 0.018712f, -0.094651f, -0.038719f, 0.109766f, 0.040088f, -0.075022f, -0.020195f, 0.085246f, -0.006605f, -0.107723f, 0.035588f, -0.030165f, -0.086761f, -0.005776f, 0.003376f, -0.084293f, 0.024106f, -0.009846f, 0.062382f, -0.014977f, -0.003202f, 0.030928f, 0.090361f, -0.019864f, 0.013936f, 0.051128f, -0.105818f, 0.056126f, -0.008338f, 0.036462f, -0.015484f, 0.043410f, 0.040483f, -0.049132f, 0.042916f, 0.079376f, -0.064373f, 0.061071f, 0.038897f, 0.099586f, -0.043296f, -0.072350f, -0.028833f, -0.059462f, 0.060560f, 0.043103f, 0.016683f, -0.067585f, 0.058022f, 0.080003f, 0.004330f, 0.019497f, 0.016779f, -0.023200f, -0.040459f, -0.035671f, -0.062849f, 0.068374f, 0.088010f, -0.016996f, -0.036036f, 0.089176f, -0.043170f, 0.006923f, -0.072749f, -0.045459f, 0.033761f, 0.043585f, 0.030216f, 0.064573f, 0.106138f, 0.056909f, -0.022262f, 0.080354f, -0.079278f, 0.021322f, -0.002987f, -0.050876f, 0.091274f, -0.045314f, 0.036987f, 0.089124f, -0.013969f, -0.061404f, 0.048469f, -0.011160f, 0.087607f, 0.073484f, 0.082149f, -0.030142f, 0.066104f, 0.080601f, 0.015534f, -0.008391f, -0.104485f, 0.048956f, 0.063385f, -0.062758f, -0.044133f, -0.016139f, -0.068459f, -0.092297f, -0.005103f, -0.057017f, -0.005554f, 0.009379f, 0.081738f, 0.091453f, -0.080015f, 0.064338f, -0.066425f, 0.006226f, -0.052306f, -0.011708f, 0.052538f, 0.002922f, 0.068611f, 0.048396f, 0.068575f, 0.002315f, 0.063515f, -0.028316f, -0.046271f, -0.005054f, -0.035044f, -0.071951f, -0.006419f, -0.080806f, 0.084033f, -0.084634f, -0.007066f, -0.049882f, -0.083519f, 0.057977f, 0.026333f, -0.071222f, 0.012409f, 0.060725f, 0.065921f, -0.065728f, 0.043573f, 0.048225f, 0.058493f, 0.014604f, -0.012140f, 0.080146f, 0.068616f, -0.003705f, -0.039931f, 0.055801f, 0.005688f, -0.081666f, -0.022340f, 0.069176f, 0.002159f, -0.079886f, 0.008682f, 0.085406f, 0.074207f, 0.014142f, 0.097250f, 0.073697f, 0.011111f, 0.030507f, 0.030526f, 0.077715f, -0.079477f, 0.064676f, -0.026482f, 0.047585f, 0.063155f, -0.004176f, -0.054451f, -0.009364f, -0.098950f, 0.025233f, 0.073586f, 0.068536f, -0.028984f, 0.005637f, -0.040587f, 0.011373f, -0.023923f, 0.046108f, -0.033853f, 0.082082f, 0.049026f, -0.083128f, -0.095068f, 0.097371f, -0.042496f, -0.044984f, -0.059885f, 0.081736f, 0.015230f, 0.017037f, 0.015284f, -0.044690f, 0.009996f, -0.021439f, -0.072337f, 0.015490f, -0.011089f, 0.069959f, -0.025713f, 0.014958f, 0.048219f, 0.000072f, 0.103446f, 0.045586f, 0.068439f, 0.088856f, -0.035555f, -0.000384f, 0.050475f, 0.037432f, 0.081831f, -0.028360f, -0.056956f, 0.081479f, 0.073874f, -0.058134f, 0.003180f, 0.052035f, -0.034432f, -0.001897f, 0.025922f, 0.004515f, 0.036520f, -0.085462f, 0.000027f, -0.020895f, 0.026637f, 0.041955f, -0.075450f, -0.078863f, 0.042759f, 0.043387f, 0.000869f, 0.081718f, -0.012493f, -0.081166f, 0.035020f, 0.010374f, 0.034389f, 0.027900f, 0.086020f, -0.071593f, -0.086743f, -0.077374f, -0.031540f, 0.008359f, 0.012274f, -0.048201f, 0.008838f, -0.006970f, 0.005050f, 0.074032f, 0.008145f, 0.062661f, -0.050543f, -0.000860f, 0.072023f, -0.057078f, -0.022386f, 0.036729f, -0.066275f, 0.034829f, -0.088606f, 0.098749f, -0.009398f, -0.045852f, -0.060319f, 0.002448f, 0.015826f, -0.065505f, -0.051467f, 0.082746f, 0.022370f, -0.058473f, -0.052761f, 0.076336f, -0.025469f, -0.075417f, 0.107894f, -0.040125f, -0.082786f, 0.002760f, -0.013773f, 0.069484f, -0.079066f, -0.095948f, -0.064336f, 0.066113f, 0.003012f, -0.078493f, 0.031587f, 0.025820f, -0.070064f, 0.023868f, -0.040857f, -0.061669f, 0.017239f, -0.038171f, -0.041001f, 0.088398f, -0.062430f, -0.025095f, -0.013051f, -0.037723f, -0.074214f, 0.048522f, -0.026967f, -0.069966f, -0.008206f, -0.058177f, -0.045937f, 0.079596f, -0.035524f, 0.024797f, -0.001362f, -0.071661f, 0.026513f, 0.060369f, -0.095352f, 0.052543f, 0.021171f, 0.068442f, -0.089741f, -0.038964f, 0.049989f, -0.079234f, 0.053322f, 0.074134f, -0.020759f, 0.000361f, -0.050560f, -0.108233f, -0.048736f, 0.078655f, 0.066798f, -0.057964f, 0.106096f, -0.027953f, -0.053041f, -0.069264f, 0.084705f, 0.109608f, -0.048174f, 0.030167f, -0.019793f, -0.085711f, -0.004242f, 0.022593f, -0.061944f, 0.074783f, -0.014937f, -0.041524f, 0.025490f, 0.068279f, -0.049808f, 0.055482f, -0.002323f, 0.078672f, 0.064495f, -0.019699f, -0.110413f, 0.019125f, -0.073477f, -0.063335f, 0.076678f, 0.086897f, -0.047543f, -0.033638f, -0.050253f, -0.008483f, 0.083882f, 0.030887f, 0.085018f, -0.052280f, 0.044798f, 0.082273f, -0.030767f, 0.029103f, -0.021742f, -0.043796f, 0.077690f, -0.013517f, -0.072858f, -0.031025f, -0.022247f, 0.043197f, 0.073892f, 0.046586f, 0.097754f, 0.009630f, 0.033098f, -0.023704f, -0.091152f, -0.015600f, 0.051035f, -0.055235f, 0.075152f, 0.057536f, -0.073721f, -0.048849f, 0.076098f, -0.046061f, -0.039676f, -0.017989f, 0.042710f, -0.088821f, -0.067372f, 0.012351f, -0.030976f, 0.030265f, -0.053078f, 0.090603f, 0.061984f, -0.073493f, 0.042579f, 0.102408f, 0.098979f, 0.056557f, -0.066151f, 0.001169f, -0.035706f, 0.079365f, 0.053080f, 0.017189f, 0.021739f, -0.024525f, -0.037072f, 0.073906f, -0.033435f, -0.098705f, -0.002423f, 0.075490f, 0.028280f, 0.090706f, -0.081154f, 0.070146f, -0.007406f, -0.015047f, -0.023164f, -0.070701f, -0.038182f, 0.043747f, -0.078678f, -0.056402f, -0.078679f, 0.082305f, 0.037337f, -0.071202f, 0.060057f, 0.096891f, 0.069121f, 0.097711f, -0.100527f, 0.001551f, -0.054034f, 0.024217f, -0.040587f, -0.081473f, 0.003519f, 0.014784f, 0.080099f, -0.075711f, -0.052561f, 0.085569f, 0.025365f, 0.062390f, 0.044588f, 0.047775f, 0.014453f, -0.069198f, 0.070993f, 0.010217f, -0.079668f, 0.069992f, 0.091063f, -0.043769f, -0.047486f, -0.097699f, 0.047073f, 0.076319f, -0.056537f, -0.013281f, -0.064665f, -0.072200f, 0.020680f, 0.074378f, -0.041311f, 0.062230f, -0.059644f, -0.050931f, 0.091336f, 0.015953f, 0.025086f, -0.072466f, -0.062993f, -0.079556f, 0.061042f, -0.075499f, 0.075665f, -0.024076f, 0.042460f, -0.011162f, -0.063705f, -0.073903f, -0.052657f, -0.004262f, 0.052321f, -0.012577f, 0.085099f, -0.000614f, -0.108486f, -0.013317f, 0.020749f, -0.055411f, 0.027254f, -0.004797f, -0.080840f, 0.067618f, 0.019687f, -0.081893f, -0.015971f, -0.028170f, 0.064105f, -0.054603f, 0.099442f, -0.005580f, -0.036019f, 0.047778f, 0.055028f, -0.018754f, 0.011616f, 0.054195f, 0.070306f, 0.076312f, -0.078796f, 0.057752f, -0.073777f, -0.067248f, 0.040817f, -0.062603f, 0.031729f, -0.024613f, -0.028078f, -0.025734f, -0.075969f, 0.011241f, 0.074187f, 0.038097f, -0.027168f, 0.077181f, -0.010162f, 0.046818f, 0.009775f, 0.076810f, 0.066382f, -0.059546f, -0.088076f, 0.049929f, 0.075999f, 0.005043f, 0.052306f, -0.083938f, -0.042728f, -0.076734f, 0.037286f, -0.058731f, -0.086401f, -0.037583f, 0.046252f, 0.007840f, -0.035832f, 0.060639f, -0.056970f, -0.030879f, 0.015019f, -0.013607f, -0.022343f, -0.073384f, -0.012873f, -0.062241f, -0.007426f, 0.060179f, 0.074988f, 0.067016f, -0.024565f, 0.029104f, 0.060317f, -0.027977f, -0.022247f, -0.069575f, 0.031856f, 0.050092f, -0.023132f, 0.059314f, 0.014202f, 0.067530f, -0.033033f, 0.052560f, -0.001935f, -0.086590f, -0.001386f, -0.004278f, -0.057117f, 0.086986f, -0.011819f, -0.079533f, -0.035665f, -0.003692f, 0.083272f, 0.068896f, -0.049513f, 0.051882f, -0.043884f, -0.043214f, -0.071650f, -0.093064f, 0.018991f, 0.069962f, -0.013515f, 0.055818f, 0.057195f, 0.022896f, 0.110193f, 0.077728f, -0.045897f, 0.056895f, 0.032358f, -0.029755f, -0.064305f, -0.065913f, 0.048989f, -0.044828f, 0.108010f, 0.034391f, 0.009888f, 0.028688f, 0.035580f, 0.104328f, -0.051394f, -0.051121f, 0.047338f, -0.044461f, 0.056834f, -0.014359f, -0.066759f, -0.104163f, 0.011909f, 0.074801f, -0.050855f, 0.067334f, 0.064599f, -0.069647f, -0.001190f, 0.026564f, -0.071871f, -0.015449f, -0.013625f, -0.089452f, -0.054870f, -0.068443f, -0.008052f, 0.037720f, 0.075283f, -0.068626f, 0.039870f, 0.044174f, 0.081187f, 0.077470f, -0.079671f, -0.097839f, 0.073461f, -0.079397f, -0.044495f, 0.064030f, 0.099355f, -0.016809f, 0.055253f, 0.071761f, 0.010887f, 0.001648f, 0.029563f, -0.040488f, 0.036154f, -0.035770f, -0.059632f, 0.000474f, 0.049813f, 0.031152f, 0.072686f, 0.024150f, -0.061578f, -0.061694f, -0.095358f, -0.044807f, 0.000512f, 0.071481f, 0.066918f, -0.014063f, -0.000196f, 0.048451f, -0.045925f, 0.009799f, -0.079253f, -0.001543f, -0.079513f, -0.011459f, -0.030119f, -0.021761f, -0.038933f, -0.056458f, -0.035672f, -0.054676f, 0.035162f, 0.055696f, 0.004937f, -0.093019f, 0.026865f, -0.096296f, -0.087338f, -0.042651f, -0.033678f, 0.016364f, 0.069839f, 0.044149f, 0.049254f, 0.102442f, 0.013138f, 0.012328f, 0.032001f, 0.062380f, -0.004757f, 0.069988f, 0.041283f, -0.025209f, -0.109024f, -0.046187f, 0.046785f, 0.026572f, -0.060013f, 0.003626f, 0.043253f, -0.084336f, -0.001940f, -0.007895f, -0.007986f, -0.007041f, -0.040026f, 0.058049f, -0.091522f, -0.102734f, -0.018669f, 0.084852f, -0.028090f, -0.063801f, 0.094402f, -0.073060f, -0.006788f, 0.044275f, -0.047859f, -0.051405f, -0.008311f, 0.049603f, 0.075790f, -0.097104f, -0.078141f, 0.105003f, 0.021340f, 0.000690f, 0.049476f, -0.096346f, -0.108475f, 0.075724f, 0.077180f, 0.063062f, -0.077577f, 0.009230f, 0.080685f, 0.095813f, -0.083552f, 0.037855f, -0.090806f, 0.096491f, -0.030473f, 0.076206f, -0.013269f, -0.035843f, -0.043562f, 0.056693f, -0.074191f, 0.075757f, 0.033745f, 0.084202f, 0.083420f, -0.056423f, 0.078744f, -0.078152f, -0.081117f, 0.095809f, 0.077487f, -0.057603f, 0.001704f, 0.009369f, 0.080791f, 0.010391f, 0.057213f, -0.015518f, 0.039836f, 0.035587f, 0.030097f, -0.109734f, -0.090000f, -0.037637f, -0.084863f, -0.031742f, -0.004392f, 0.100656f, 0.009207f, 0.040676f, 0.069702f, -0.021716f, -0.078883f, -0.052387f, 0.052213f, 0.082513f, -0.017904f, -0.043471f, 0.097103f, -0.014109f, 0.043604f, -0.029657f, -0.063734f, -0.006429f, 0.088145f, 0.029690f, -0.072219f, 0.051041f, 0.047594f, -0.051149f, 0.004686f, 0.046687f, -0.074125f, 0.076381f, 0.004915f, 0.109351f, -0.075864f, 0.010235f, -0.079044f, -0.078817f, -0.056538f, -0.020636f, -0.000021f, 0.072172f, 0.041458f, -0.022188f, 0.105942f, 0.019479f, -0.043577f, 0.048366f, 0.008187f, 0.060321f, 0.071863f, -0.041933f, 0.027206f, -0.059618f, 0.040075f, 0.085505f, 0.078697f, -0.007493f, -0.090290f, 0.092183f, -0.031230f, -0.051656f, -0.021150f, -0.005333f, 0.101910f, 0.109056f, -0.037605f, -0.011659f, 0.012135f, -0.088010f, -0.081345f, 0.080537f, -0.082754f, -0.074162f, -0.031429f, 0.060647f, -0.063819f, -0.031864f, -0.047664f, 0.078804f, -0.065992f, -0.001625f, 0.086673f, 0.035427f, -0.047462f, 0.054756f, 0.073449f, -0.029130f, 0.032464f, -0.093520f, 0.087421f, -0.063933f, -0.016602f, 0.001631f, -0.055778f, 0.042637f, -0.003686f, 0.028383f, -0.014088f, -0.005097f, 0.072713f, 0.046210f, 0.058374f, 0.005511f, 0.020054f, -0.078096f, -0.012534f, 0.084651f, 0.008462f, 0.086057f, -0.034288f, -0.087576f, 0.041894f, -0.067298f, 0.066534f, -0.034410f, -0.006627f, 0.071073f, 0.063761f, 0.010228f, 0.076739f, 0.015930f, -0.031211f, -0.050193f, 0.058659f, -0.003867f, -0.032060f, -0.104698f, -0.052073f, 0.074053f, 0.052166f, 0.035876f, -0.096189f, -0.083607f, -0.021295f, -0.004743f, 0.089633f, -0.030838f, -0.023600f, 0.012826f, 0.079188f, 0.048020f, 0.081050f, -0.067114f, -0.078760f, 0.001573f, 0.026214f, 0.104012f, -0.021730f, -0.039172f, -0.008275f, 0.029042f, -0.000869f, 0.028227f, -0.010869f, 0.085625f, -0.072779f, -0.021987f, 0.051006f, -0.020404f, 0.044699f, -0.052727f, -0.055120f, -0.035946f, 0.061040f, -0.023750f, -0.041397f, -0.030155f, -0.105127f, 0.061040f, -0.069066f, 0.024609f, -0.076404f, 0.057277f, -0.072637f, -0.091217f, -0.049734f, 0.091652f, -0.035469f, 0.008280f, -0.030574f, -0.028856f, 0.096358f, 0.066740f, 0.062980f, -0.009828f, 0.065016f, -0.020908f, 0.004192f, -0.016656f, -0.067566f, 0.069835f, -0.058910f, -0.069499f, -0.048476f, 0.053229f, 0.069569f, 0.004504f, -0.100546f, 0.093072f, -0.077806f, 0.057705f, 0.073045f, 0.074498f, 0.044106f, -0.028528f, -0.041154f, -0.027052f, -0.043411f, 0.057513f, 0.077472f, 0.041775f, -0.046433f, -0.096732f, 0.020994f, -0.000435f, -0.073947f, -0.010124f, 0.003043f, 0.009531f, -0.011566f, 0.102787f, -0.096757f, 0.016774f, 0.094265f, -0.035471f, -0.071208f, 0.064528f, -0.016618f, 0.112366f, 0.011685f, 0.080108f, -0.081648f, -0.070678f, 0.050532f, -0.024667f, 0.076381f, -0.016376f, 0.032720f, 0.024030f, -0.062051f, 0.028513f, 0.035757f, -0.090962f, 0.027124f, -0.046380f, 0.007541f, -0.025509f, -0.063208f, -0.048160f, -0.091892f, -0.059226f, 0.058930f, -0.104150f, 0.001236f, 0.053918f, -0.065109f, -0.038720f, 0.045166f, 0.045959f, 0.022052f, -0.055928f, 0.039341f, -0.074132f, -0.061747f, 0.060327f, -0.041338f, -0.020880f, -0.061899f, -0.027860f, -0.040749f, 0.044614f, -0.063829f, -0.048633f, 0.042078f, 0.071085f, 0.006583f, -0.073844f, -0.005875f, 0.020085f, -0.041418f, 0.051628f, 0.064667f, 0.029663f, -0.060919f, 0.029834f, 0.068362f, -0.035020f, 0.074762f, 0.038471f, -0.024330f, 0.008923f, -0.022518f, -0.092688f, 0.075098f, 0.028707f, 0.008495f, -0.066486f, -0.034098f, 0.087408f, -0.077660f, -0.086057f, -0.048252f, -0.057571f, 0.072678f, 0.041267f, -0.082541f, -0.080941f, -0.001078f, 0.036430f, -0.065412f, 0.032525f, -0.066445f, -0.015538f, -0.005876f, -0.086480f, 0.101383f, 0.100745f, -0.026922f, -0.058536f, 0.075352f, 0.062477f, 0.036954f, -0.019587f, -0.020630f, 0.064037f, 0.019476f, 0.031627f, 0.021205f, 0.033026f, -0.061486f, -0.025612f, -0.066795f, -0.048500f, -0.046825f, -0.002784f, -0.100765f, 0.082499f, -0.007885f, -0.072346f, 0.038891f, -0.054293f, -0.087802f, 0.057037f, -0.072677f, -0.091920f, -0.074599f, 0.059755f, 0.019415f, -0.081876f, -0.053800f, 0.051738f, -0.055779f, 0.003614f, -0.049687f, -0.006149f, 0.057094f, -0.054491f, 0.047696f, -0.007234f, -0.087413f, -0.016503f, 0.050999f, 0.098519f, 0.083371f, -0.073926f, -0.042030f, 0.070143f, -0.001316f, 0.062795f, 0.064802f, -0.079108f, -0.043023f, 0.007221f, 0.099966f, 0.087943f, -0.002056f, -0.094077f, -0.019615f, -0.005982f, 0.089832f, -0.055736f, -0.053668f, 0.011993f, -0.010719f, -0.066971f, -0.066814f, -0.010257f, 0.071537f, 0.072965f, 0.085090f, -0.022562f, -0.027459f, -0.108372f, 0.082361f, 0.017380f, 0.043122f, -0.001300f, 0.093032f, -0.094896f, -0.060462f, -0.009625f, -0.067048f, -0.067014f, 0.027862f, -0.061806f, 0.029680f, 0.090752f, 0.047828f, -0.033191f, -0.085439f, 0.071249f, 0.089196f, -0.013994f, -0.016370f, -0.083155f, 0.055354f, 0.000604f, 0.043580f, 0.028574f, -0.103033f, -0.016174f, 0.054177f, 0.033617f, 0.039233f, 0.030115f, 0.034795f, 0.019903f, 0.034482f, 0.004371f, 0.041547f, -0.014293f, 0.008664f, -0.033050f, -0.060361f, -0.050697f, -0.071653f, -0.048696f, -0.006198f, -0.089739f, -0.040859f, -0.030402f, -0.064294f, -0.028881f, -0.078934f, 0.033586f, -0.016214f, -0.079358f, 0.030878f, -0.047919f, -0.086965f, -0.048475f, -0.006009f, 0.045542f, 0.009481f, -0.100438f, 0.066923f, -0.029817f, 0.019229f, -0.075416f, -0.039007f, -0.087050f, 0.052010f, -0.054798f, 0.020394f, -0.058256f, -0.083473f, 0.074067f, 0.003258f, 0.079336f, -0.048763f, 0.059055f, 0.086545f, -0.033776f, 0.087748f, -0.016912f, -0.025872f, 0.086959f, 0.080663f, -0.039104f, 0.050994f, -0.045479f, 0.108113f, 0.054511f, 0.094929f, -0.000553f, -0.029120f, -0.062668f, -0.008307f, 0.037352f, 0.034806f, -0.051427f, -0.004694f, -0.009017f, -0.045086f, 0.001481f, -0.026109f, 0.019203f, -0.046954f, 0.091137f, -0.045609f, 0.032020f, -0.065960f, 0.036323f, -0.060115f, 0.105136f, -0.008800f, 0.009263f, -0.044268f, 0.078856f, 0.043150f, -0.060832f, 0.066184f, -0.092514f, 0.042738f, -0.020273f, 0.062330f, 0.003813f, -0.068844f, -0.052896f, 0.102936f, -0.040622f, -0.048571f, 0.057022f, -0.090578f, -0.082453f, -0.028036f, -0.089953f, 0.089167f, 0.028770f, -0.006923f, 0.073222f, 0.035142f, -0.072858f, -0.065627f, 0.063955f, -0.045627f, -0.024582f, -0.009996f, -0.071991f, 0.030853f, 0.021789f, 0.037830f, -0.031166f, -0.006093f, -0.071155f, -0.009148f, 0.034408f, 0.072012f, 0.016203f, 0.015615f, -0.011524f, -0.086096f, 0.005681f, -0.082513f, 0.023183f, 0.060897f, 0.079054f, -0.051704f, -0.014216f, -0.074347f, 0.081639f, 0.073597f, 0.050801f, -0.098325f, 0.022433f, -0.038284f, -0.063827f, 0.068504f, -0.071904f, -0.003873f, -0.008113f, -0.044769f, -0.016784f, -0.103650f, -0.110200f, 0.062541f, -0.023003f, 0.082833f, -0.006561f, 0.003604f, -0.021251f, -0.090479f, -0.036792f, 0.014753f, 0.039295f, 0.025919f, 0.038780f, -0.076503f, 0.020857f, 0.085771f, -0.058018f, -0.038524f, 0.062764f, 0.074488f, -0.035826f, -0.017916f, 0.019205f, -0.014883f, 0.031364f, -0.015756f, 0.069365f, 0.061502f, 0.054314f, 0.014431f, 0.031739f, -0.018647f, -0.106071f, -0.024837f, -0.069203f, -0.027650f, 0.081739f, 0.004953f, 0.049666f, -0.067103f, -0.049995f, -0.052244f, 0.063100f, -0.028685f, 0.004894f, -0.058845f, -0.075186f, -0.038368f, -0.022060f, -0.018776f, 0.005986f, -0.038961f, 0.036464f, -0.064678f, -0.049132f, 0.047108f, 0.009538f, -0.060853f, 0.006551f, -0.048094f, 0.025805f, -0.081866f, 0.021719f, 0.007337f, -0.050468f, 0.060641f, -0.046059f, -0.070601f, -0.077272f, 0.079616f, 0.005897f, -0.014880f, -0.078874f, -0.066403f, -0.030792f, -0.012617f, 0.054748f, -0.017387f, 0.071425f, -0.033505f, -0.085968f, -0.028343f, -0.095664f, -0.047690f, 0.084542f, 0.054489f, -0.048030f, -0.034432f, -0.019069f, 0.057178f, -0.105218f, -0.081602f, -0.059168f, 0.033418f, -0.026742f, 0.061807f, -0.028216f, -0.016858f, 0.025208f, 0.023606f, -0.049200f, -0.051341f, -0.007328f, -0.059526f, 0.081105f, -0.005980f, -0.058811f, 0.029243f, -0.067070f, 0.041545f, -0.004119f, -0.060004f, -0.098890f, 0.113812f, -0.031626f, 0.099559f, 0.013630f, -0.013427f, -0.069106f, 0.095828f, 0.056348f, -0.011854f, -0.058131f, -0.051469f, -0.024878f, -0.015726f, 0.019716f, -0.098678f, -0.100810f, -0.011661f, -0.099424f, -0.092030f, -0.036056f, -0.088102f, -0.010863f, -0.034363f, -0.060412f, -0.016168f, -0.082378f, -0.011657f, -0.016164f, 0.062395f, 0.086676f, -0.025975f, -0.040669f, 0.006612f, -0.079560f, -0.039191f, -0.074840f, -0.020251f, -0.084294f, 0.001216f, 0.019568f, 0.081025f, -0.073096f, -0.045796f, 0.102499f, 0.068217f, 0.036596f, 0.072853f, -0.044364f, 0.084893f, 0.060444f, -0.042430f, 0.006924f, 0.068879f, 0.019858f, 0.041139f, 0.016269f, -0.054666f, 0.102960f, -0.025358f, -0.028846f, 0.060390f, 0.013078f, -0.043012f, -0.032033f, -0.068841f, -0.075471f, 0.034631f, -0.006844f, -0.063376f, -0.075263f, -0.080252f, 0.056775f, -0.044634f, -0.061598f, -0.101826f, -0.081587f, 0.084147f, -0.065050f, 0.071870f, -0.078058f, -0.059493f, 0.066299f, -0.009790f, -0.050792f, 0.054603f, -0.069032f, 0.066140f, 0.066866f, -0.086843f, 0.045626f, 0.107650f, -0.013472f, 0.003125f, 0.039874f, -0.034207f, 0.026212f, 0.009656f, -0.004197f, 0.092034f, 0.071271f, 0.099657f, 0.059121f, -0.084305f, 0.027978f, 0.023815f, 0.048288f, -0.050887f, -0.031041f, -0.097223f, -0.070276f, 0.003358f, 0.002086f, -0.044078f, 0.005652f, -0.021032f, -0.081451f, -0.083562f, 0.039335f, 0.089374f, 0.025126f, -0.060631f, 0.058839f, 0.000521f, -0.088498f, 0.030532f, -0.054767f, -0.024892f, -0.024677f, 0.042981f, -0.026903f, -0.079816f, -0.071204f, 0.015162f, 0.041102f, -0.083297f, 0.011298f, -0.062252f, 0.038571f, 0.055134f, -0.053143f, -0.010570f, 0.041952f, -0.048893f, -0.074986f, 0.091020f, 0.052959f, 0.040430f, 0.084270f, 0.016303f, 0.004240f, -0.007266f, 0.038767f, -0.011042f, -0.077855f, -0.086875f, 0.107843f, -0.102373f, 0.048290f, 0.076842f, -0.066449f, 0.029078f, -0.053162f, -0.064774f, 0.058573f, 0.064725f, -0.026334f, 0.016255f, -0.069186f, 0.066811f, 0.059199f, -0.027735f, 0.045472f, 0.081876f, -0.104722f, 0.064524f, 0.027978f, -0.031600f, -0.010947f, 0.077993f, 0.029932f, 0.016667f, -0.017958f, 0.087435f, -0.055126f, -0.092556f, 0.039871f, 0.024719f, 0.019729f, -0.057454f, -0.035145f, 0.034157f, -0.052689f, 0.017624f, -0.020422f, 0.013386f, -0.039406f, -0.072802f, 0.056253f, -0.013800f, -0.041174f, 0.054616f, -0.004095f, -0.063264f, 0.028885f, -0.031757f, 0.021027f, 0.008003f, 0.078873f, -0.073926f, -0.051606f, 0.078335f, 0.030719f, -0.012000f, 0.058139f, -0.000804f, -0.017064f, -0.067302f, -0.004052f, -0.028580f, 0.021617f, -0.021990f, 0.071587f, 0.064223f, -0.067950f, 0.012862f, 0.032420f, -0.006426f, -0.064604f, 0.003644f, -0.022085f, -0.044755f, 0.007731f, -0.048121f, -0.064700f, 0.057594f, -0.040533f, 0.060624f, 0.107378f, -0.002181f, 0.073241f, -0.052579f, 0.046866f, 0.096920f, 0.009296f, -0.062861f, -0.080615f, 0.090500f, -0.029779f, -0.010511f, -0.003507f, -0.027552f, 0.060208f, 0.100613f, 0.018764f, 0.076586f, -0.053769f, -0.001294f, 0.041031f, 0.051702f, 0.038892f, -0.043790f, 0.085924f, -0.058131f, -0.032794f, 0.010331f, 0.001442f, -0.052443f, 0.065519f, 0.001858f, -0.092325f, 0.045631f, 0.078189f, -0.041194f, 0.006636f, 0.021755f, 0.053669f, -0.050869f, 0.084795f, 0.032379f, -0.090330f, 0.007328f, -0.105237f, 0.016799f, 0.007133f, 0.015778f, 0.088126f, -0.028256f, 0.064355f, 0.005225f, 0.046684f, 0.073468f, 0.056856f, 0.072558f, 0.020062f, 0.063728f, 0.086870f, 0.064625f, -0.017239f, 0.084964f, -0.102567f, 0.015231f, 0.006600f, -0.060106f, -0.007071f, -0.070524f, 0.026095f, 0.053430f, -0.056066f, -0.047916f, 0.040327f, -0.034426f, -0.021213f, -0.018136f, -0.007152f, -0.011224f, -0.077311f, -0.047615f, -0.083691f, -0.014984f, 0.077614f, -0.064304f, 0.017762f, -0.018024f, 0.056868f, -0.011575f, 0.022460f, -0.012835f, -0.002512f, 0.065061f, 0.109397f, -0.081110f, 0.005035f, -0.081290f, -0.102769f, 0.062585f, 0.086391f, 0.030247f, -0.067997f, -0.095442f, -0.018817f, -0.015524f, -0.091507f, 0.048442f, -0.009278f, 0.106936f, 0.075367f, -0.015881f, 0.040132f, -0.047904f, -0.030830f, -0.081749f, 0.014514f, -0.095961f, -0.024866f, -0.048591f, 0.046414f, -0.038093f, 0.081834f, -0.069536f, 0.077534f, 0.030053f, -0.089657f, 0.007398f, -0.029358f, 0.057157f, 0.019202f, -0.088751f, -0.002104f, 0.060590f, -0.033545f, 0.062366f, -0.088591f, 0.087921f, -0.015275f, 0.096426f, 0.005472f, 0.038671f, 0.097564f, 0.029459f, 0.018014f, -0.037004f, -0.084325f, -0.002036f, -0.025090f, 0.080522f, -0.048296f, 0.058547f, -0.076746f, 0.061382f, 0.043455f, -0.006128f, -0.034771f, -0.076346f, 0.029922f, -0.006088f, 0.035694f, 0.090411f, -0.031638f, 0.013117f, -0.026410f, -0.102732f, 0.011492f, -0.032132f, -0.106455f, -0.006701f, -0.066369f, 0.041145f, 0.005660f, -0.001815f, 0.076726f, 0.091838f, 0.036282f, 0.010442f, -0.045248f, -0.084512f, -0.073181f, -0.037813f, -0.068612f, 0.004999f, 0.015251f, -0.018911f, 0.049639f, 0.034200f, 0.027940f, -0.013614f, -0.101563f, -0.001724f, 0.015152f, -0.006568f, -0.082507f, 0.042240f, -0.034795f, -0.078591f, -0.010260f, 0.088884f, -0.085088f, -0.110462f, 0.002963f, 0.017724f, -0.090160f, -0.087570f, 0.074848f, -0.023915f, -0.063988f, -0.051187f, 0.013726f, -0.046061f, -0.085572f, 0.012296f, -0.088598f, -0.066519f, -0.078962f, -0.080250f, 0.062385f, -0.065499f, -0.058064f, 0.006327f, -0.084873f, 0.032426f, -0.016711f, 0.085335f, -0.104186f, 0.053279f, -0.079840f, 0.071870f, -0.036687f, 0.008733f, -0.097544f, 0.061546f, -0.037626f, 0.069855f, 0.031832f, -0.047177f, -0.060537f, -0.047123f, 0.046323f, -0.022777f, -0.038513f, 0.099591f, 0.056368f, 0.031301f, 0.073012f, -0.060584f, 0.046763f, -0.019303f, 0.030198f, 0.095362f, 0.061655f, 0.001270f, 0.064136f, -0.013765f, -0.058947f, -0.096996f, 0.039851f, -0.076208f, -0.021798f, 0.046464f, 0.091712f, 0.005590f, -0.040985f, -0.018881f, 0.047206f, -0.066766f, 0.040147f, 0.064728f, 0.000713f, 0.082971f, -0.062543f, 0.018430f, 0.075098f, 0.031096f, 0.069437f, -0.038461f, 0.001389f, -0.036823f, 0.016067f, 0.019438f, 0.008922f, 0.025304f, 0.035378f, 0.067865f, -0.067208f, 0.078143f, -0.019285f, -0.073821f, 0.071292f, 0.069570f, -0.023710f, 0.030639f, -0.037706f, -0.029381f, -0.001881f, 0.055772f, -0.009788f, 0.031170f, 0.053807f, -0.011825f, -0.011693f, -0.012172f, -0.081520f, -0.065313f, 0.078283f, 0.041061f, -0.076851f, 0.011679f, -0.107734f, -0.007406f, -0.076091f, 0.053918f, 0.026096f, -0.093595f, 0.020894f, 0.089330f, 0.029391f, -0.068549f, 0.048259f, 0.030322f, 0.015480f, 0.054917f, -0.024117f, -0.042996f, -0.073903f, 0.006583f, -0.030750f, -0.064600f, -0.066081f, -0.065083f, 0.009897f, -0.074744f, -0.027972f, 0.046184f, 0.014247f, -0.007074f, 0.091519f, -0.001322f, 0.067368f, 0.032282f, -0.006228f, -0.018806f, 0.091978f, -0.001137f, -0.037584f, 0.013332f, -0.037853f, -0.064799f, -0.062035f, 0.048056f, 0.043068f, -0.023212f, -0.009695f, 0.041005f, -0.105688f, -0.046080f, -0.049581f, 0.003240f, 0.065435f, -0.089683f, 0.080796f, 0.027418f, 0.017581f, 0.086166f, -0.080937f, -0.025783f, -0.058979f, -0.011308f, 0.018954f, 0.055733f, -0.086576f, -0.014705f, 0.072990f, -0.015274f, 0.067648f, -0.073546f, -0.049840f, 0.034866f, 0.014583f, -0.025358f, 0.021057f, 0.065675f, 0.092711f, -0.006884f, 0.041864f, -0.010153f, 0.095744f, 0.006294f, -0.028216f, 0.092630f, -0.087738f, -0.048771f, 0.052052f, 0.000329f, -0.025429f, 0.006700f, -0.009428f, -0.047685f, -0.035787f, -0.020504f, 0.074678f, 0.076708f, -0.071064f, 0.031313f, 0.030552f, 0.034585f, -0.104442f, -0.054217f, 0.059323f, 0.013016f, -0.082375f, 0.021985f, 0.053091f, 0.056391f, 0.063217f, 0.016841f, -0.020442f, -0.061775f, 0.059110f, 0.047535f, 0.069153f, -0.045706f, -0.082837f, 0.055485f, 0.098554f, 0.069443f, 0.005895f, 0.023694f, -0.090213f, -0.027261f, -0.005377f, 0.063181f, 0.001909f, 0.029464f, -0.088817f, 0.104927f, 0.012483f, -0.052850f, -0.018120f, 0.017566f, -0.076908f, -0.053549f, 0.087812f, 0.062063f, -0.057566f, -0.051224f, 0.010761f, -0.054271f, -0.095211f, 0.033655f, -0.073648f, -0.020201f, -0.026831f, -0.083562f, -0.056794f, -0.082946f, 0.105472f, 0.036496f, 0.080309f, 0.027230f, -0.036316f, -0.053196f, -0.013434f, 0.009830f, 0.052417f, -0.003250f, -0.050650f, 0.076991f, -0.080854f, 0.002671f, -0.102911f, -0.010500f, 0.017850f, -0.072348f, -0.005877f, 0.014090f, 0.097863f, -0.014686f, -0.083715f, -0.078431f, -0.053932f, 0.072456f, -0.056280f, 0.031947f, -0.066129f, -0.071713f, 0.040738f, -0.074595f, 0.043354f, -0.028616f, -0.045162f, 0.083433f, 0.030924f, -0.101322f, 0.048215f, -0.060619f, 0.095118f, -0.077403f, 0.028154f, -0.064951f, 0.071949f, -0.048409f, 0.007423f, -0.087127f, -0.000254f, 0.012846f, 0.045865f, 0.024773f, 0.023080f, 0.075926f, -0.022959f, -0.022266f, -0.101597f, 0.008810f, 0.105917f, 0.031234f, 0.080026f, 0.006069f, 0.035131f, -0.049582f, -0.031253f, 0.036883f, -0.009403f, -0.105453f, -0.029361f, 0.018466f, -0.021930f, -0.020828f, 0.074468f, -0.034311f, 0.015966f, 0.081109f, 0.072029f, -0.039810f, -0.074095f, -0.057268f, -0.052189f, -0.082019f, -0.027228f, -0.009367f, 0.035556f, -0.012916f, -0.069373f, 0.024697f, 0.056872f, 0.021853f, 0.058058f, -0.059389f, -0.012396f, -0.007100f, -0.046075f, 0.037732f, -0.056553f, 0.075923f, -0.089822f, -0.025325f, 0.012320f, 0.003038f, 0.023046f, -0.095721f, 0.075407f, -0.070985f, -0.042127f, -0.037565f, -0.105010f, -0.086326f, 0.067355f, 0.055266f, 0.037576f, 0.025671f, -0.092394f, -0.053718f, -0.107002f, -0.072107f, -0.074861f, -0.053903f, -0.072375f, -0.081003f, -0.037158f, 0.068228f, -0.097025f, 0.101358f, 0.040916f, 0.055155f, 0.017756f, 0.064331f, -0.034837f, -0.057887f, 0.041002f, -0.001819f, 0.011523f, -0.046847f, -0.060863f, -0.003463f, -0.010197f, 0.075279f, 0.007470f, -0.004589f, 0.073771f, -0.088916f, -0.033183f, -0.016000f, 0.079179f, 0.068838f, -0.052403f, 0.054543f, -0.099742f, 0.010409f, 0.016251f, -0.043857f, -0.096050f, -0.058057f, -0.003857f, -0.026666f, -0.020718f, -0.062525f, -0.076707f, 0.061508f, -0.081898f, -0.042791f, 0.016773f, 0.082960f, -0.047758f, 0.018500f, -0.000361f, -0.076024f, -0.019682f, -0.077380f, 0.104343f, 0.064263f, -0.017943f, -0.036702f, -0.026059f, -0.030009f, -0.018700f, 0.072401f, -0.003045f, 0.038309f, -0.082135f, -0.000869f, -0.003456f, 0.013184f, 0.021240f, 0.084217f, -0.037578f, -0.038983f, -0.071872f, 0.010568f, 0.099051f, -0.028323f, 0.086307f, 0.032347f, -0.059394f, 0.016818f, 0.015845f, 0.043592f, 0.025490f, -0.069363f, -0.050974f, -0.034612f, 0.034003f, -0.003807f, 0.022041f, 0.073281f, -0.003256f, -0.010958f, -0.029705f, 0.008979f, -0.050248f, 0.049073f, 0.078417f, 0.051529f, 0.055900f, 0.078325f, -0.072094f, 0.106716f, 0.047090f, -0.031693f, 0.093214f, 0.013348f, 0.094980f, 0.030272f, -0.027648f, 0.057930f, 0.041260f, -0.052944f, 0.089723f, -0.068245f, -0.012057f, 0.016455f, 0.001189f, 0.019860f, 0.082786f, -0.096548f, 0.040502f, 0.046960f, -0.038647f, -0.055896f, -0.018581f, -0.006519f, -0.015373f, -0.050596f, 0.015212f, 0.069909f, 0.064859f, 0.031382f, -0.027237f, 0.057979f, -0.031434f, -0.037244f, -0.084249f, 0.106379f, -0.096365f, 0.014670f, -0.056923f, 0.057958f, -0.053061f, 0.030035f, -0.067758f, 0.074736f, 0.037017f, -0.006143f, 0.084456f, 0.016277f, -0.010494f, -0.054765f, 0.056449f, 0.005082f, -0.043069f, -0.038265f, -0.043599f, -0.013084f, -0.086286f, -0.030554f, 0.034373f, 0.034865f, 0.069369f, 0.031537f, -0.104828f, 0.000316f, -0.025814f, -0.031443f, 0.084810f, 0.035843f, -0.031198f, 0.023021f, -0.078391f, 0.043762f, -0.038397f, -0.046703f, -0.073921f, -0.100910f, 0.058610f, 0.055881f, -0.005494f, -0.033049f, -0.031166f, 0.068335f, -0.078031f, -0.090824f, -0.064111f, -0.007476f, -0.105828f, -0.091785f, 0.028529f, 0.003934f, 0.102548f, 0.085035f, -0.029441f, -0.010569f, 0.094088f, 0.025331f, -0.035817f, 0.065352f, 0.093873f, 0.017259f, -0.065707f, 0.073551f, -0.011575f, 0.027804f, 0.006174f, 0.072088f, -0.073253f, -0.050819f, -0.068133f, -0.067832f, -0.043943f, -0.082709f, 0.032221f, -0.046498f, -0.065893f, -0.067464f, -0.008561f, 0.103382f, -0.015772f, -0.022452f, -0.097900f, -0.047040f, -0.066701f, 0.063080f, -0.089427f, -0.071187f, -0.055240f, -0.051878f, 0.067879f, 0.066848f, 0.011399f, -0.024539f, -0.017442f, 0.005607f, 0.047017f, -0.021797f, -0.013819f, 0.090649f, 0.016124f, -0.004351f, -0.078604f, -0.051542f, -0.059745f, 0.038068f, -0.062423f, -0.078932f, -0.013645f, 0.057655f, 0.030867f, 0.063070f, 0.044420f, 0.014539f, 0.012207f, -0.066090f, -0.001582f, 0.019209f, -0.078911f, 0.008950f, -0.092186f, 0.022990f, -0.051682f, -0.090232f, -0.060760f, 0.066576f, 0.033210f, -0.057147f, -0.089156f, 0.020321f, -0.072015f, 0.063520f, -0.013153f, 0.055437f, -0.021372f, 0.030495f, 0.040903f, 0.027747f, 0.057159f, 0.011585f, 0.008695f, -0.022486f, 0.068282f, -0.004463f, -0.031664f, 0.004127f, -0.051150f, -0.050568f, -0.040204f, -0.006288f, 0.034050f, -0.027412f, -0.080210f, 0.021149f, 0.086053f, -0.032472f, 0.012997f, -0.050159f, 0.056263f, -0.092415f, -0.065641f, 0.108167f, 0.031851f, -0.007109f, 0.072184f, 0.101549f, -0.047009f, 0.046449f, -0.025666f, 0.030125f, 0.026489f, 0.082721f, -0.085454f, -0.111893f, 0.052214f, 0.005324f, 0.029902f, 0.063853f, -0.018391f, -0.022548f, 0.069173f, -0.014364f, 0.014216f, 0.075972f, -0.052509f, -0.110442f, -0.063551f, 0.073062f, -0.000018f, 0.103357f, -0.006724f, -0.036723f, 0.053628f, 0.016913f, 0.069056f, 0.016490f, -0.012425f, -0.053962f, -0.081339f, -0.027223f, -0.092975f, -0.004832f, -0.041428f, 0.050592f, -0.041207f, -0.095168f, 0.076999f, -0.074844f, 0.059779f, 0.072932f, -0.080755f, 0.021703f, -0.021137f, 0.069492f, 0.030835f, -0.059413f, -0.108632f, -0.016436f, 0.062359f, 0.075043f, -0.083988f, 0.077670f, -0.072998f, -0.062684f, 0.091355f, -0.026467f, -0.092480f, 0.012109f, -0.097354f, -0.101231f, 0.017249f, -0.044974f, 0.019149f, -0.023728f, -0.081778f, 0.088555f, -0.054980f, -0.085334f, -0.051671f, -0.060289f, -0.049308f, -0.042995f, 0.050187f, -0.071419f, -0.013247f, -0.072047f, 0.108120f, -0.056036f, 0.008577f, 0.005750f, 0.044442f, -0.037785f, 0.058710f, -0.108970f, 0.070539f, -0.065571f, 0.000104f, -0.074651f, -0.016933f, 0.014206f, -0.058399f, -0.024642f, 0.026464f, 0.053414f, 0.025931f, -0.010753f, -0.083583f, -0.060753f, 0.074856f, -0.104453f, 0.007987f, 0.064061f, -0.046383f, 0.009138f, -0.014540f, -0.065001f, 0.059226f, 0.094871f, 0.034994f, -0.093129f, 0.013032f, -0.062588f, -0.043934f, -0.050091f, 0.010697f, 0.006177f, -0.041925f, 0.071708f, -0.050591f, 0.060888f, -0.108681f, -0.047531f, 0.048982f, -0.004409f, 0.033228f, -0.002141f, -0.013683f, -0.059140f, -0.050110f, 0.094043f, 0.005420f, 0.009675f, 0.025356f, -0.088636f, 0.012091f, 0.069593f, -0.002069f, -0.026780f, -0.023776f, 0.061836f, 0.012172f, 0.045223f, 0.028752f, -0.073791f, 0.107406f, 0.024109f, 0.030467f, -0.102050f, 0.095511f, -0.014732f, 0.074461f, -0.002659f, 0.012536f, 0.083917f, -0.020973f, -0.050996f, -0.015238f, -0.032103f, 0.048866f, 0.082166f, -0.103763f, -0.006336f, -0.040861f, -0.050475f, 0.016470f, 0.055923f, -0.001683f, -0.070246f, 0.066870f, 0.001885f, 0.056324f, 0.081465f, -0.014953f, -0.021514f, -0.051961f, 0.046318f, 0.109433f, -0.058299f, 0.010446f, 0.000907f, 0.081915f, -0.062613f, 0.088671f, 0.015464f, 0.042772f, 0.038644f, -0.050878f, 0.099462f, 0.104529f, 0.060736f, 0.071831f, -0.048841f, 0.054783f, 0.061213f, -0.055248f, -0.079026f, 0.054150f, 0.006973f, -0.083840f, -0.004994f, -0.050076f, 0.036796f, 0.000991f, 0.037987f, 0.049039f, 0.039818f, 0.036970f, 0.064473f, -0.065344f, 0.016624f, 0.036821f, -0.037411f, -0.072255f, 0.044967f, 0.057049f, 0.061516f, -0.003414f, 0.025759f, -0.067418f, -0.046533f, 0.031021f, -0.058621f, 0.085448f, -0.067399f, 0.065844f, -0.024578f, 0.058640f, -0.032059f, 0.059280f, 0.089310f, 0.029607f, -0.074212f, 0.080197f, 0.015887f, -0.062501f, -0.006531f, 0.049178f, 0.068584f, 0.067771f, -0.083056f, 0.057614f, 0.014096f, -0.028425f, 0.002670f, 0.075438f, 0.084067f, 0.031277f, -0.090820f, 0.051119f, -0.074506f, -0.031460f, -0.018332f, 0.007275f, -0.036265f, -0.021994f, 0.065529f, -0.054809f, 0.055715f, -0.102361f, -0.070362f, 0.074492f, -0.018189f, -0.098142f, 0.006498f, -0.017450f, -0.065649f, -0.014538f, 0.027460f, 0.039053f, 0.088821f, 0.011252f, -0.067755f, -0.085645f, -0.009722f, -0.048354f, 0.065317f, -0.066324f, -0.010367f, 0.006199f, -0.044319f, 0.040554f, 0.007358f, 0.097194f, 0.081343f, 0.012091f, -0.024430f, 0.030367f, 0.008603f, -0.053790f, -0.054805f, -0.010824f, -0.043958f, -0.011525f, -0.082915f, 0.045491f, -0.069096f, 0.033608f, -0.075086f, -0.082016f, 0.031797f, 0.080712f, -0.009589f, 0.059830f, -0.095622f, 0.004109f, 0.050226f, -0.026902f, -0.055706f, -0.076687f, -0.034939f, 0.047465f, 0.108523f, -0.023497f, -0.026738f, -0.043075f, -0.091286f, -0.005121f, 0.036529f, 0.023219f, -0.081316f, 0.040211f, 0.044080f, 0.014240f, 0.101797f, -0.054589f, 0.074294f, -0.058167f, -0.049636f, -0.044403f, 0.064885f, 0.042604f, -0.016944f, -0.033787f, -0.097541f, 0.025629f, 0.104261f, 0.068548f, -0.068176f, -0.030766f, -0.028306f, -0.004296f, -0.061061f, 0.051156f, 0.068981f, 0.038090f, -0.091600f, 0.067278f, -0.020055f, -0.092076f, 0.017681f, 0.049287f, 0.049068f, -0.027161f, 0.064238f, -0.018793f, 0.022340f, 0.066351f, 0.033865f, -0.089011f, 0.037335f, 0.096069f, 0.064103f, -0.008147f, 0.054373f, -0.076880f, -0.035469f, 0.061824f, -0.080764f, -0.001869f, 0.053779f, 0.007271f, -0.097084f, -0.016726f, 0.035933f, -0.036814f, 0.090061f, 0.085855f, -0.080126f, -0.064956f, -0.030578f, 0.003974f, -0.077844f, -0.045663f, 0.069420f, 0.028213f, 0.004570f, 0.030768f, -0.111725f, -0.064859f, 0.029103f, 0.034443f, 0.083394f, -0.000787f, 0.016849f, -0.003490f, 0.070704f, 0.059552f, -0.009979f, -0.010179f, -0.102347f, 0.040722f, 0.048950f, -0.025010f, 0.017274f, 0.061069f, 0.082841f, -0.059721f, 0.054260f, 0.008618f, -0.093176f, -0.040001f, 0.026029f, 0.081985f, -0.066533f, 0.019157f, 0.035516f, -0.031796f, 0.060643f, -0.064159f, -0.064117f, -0.086257f, 0.012164f, -0.035219f, -0.088264f, 0.063323f, -0.049746f, 0.001421f, -0.033168f, 0.024176f, 0.013789f, 0.032501f, -0.052631f, -0.103153f, 0.066628f, 0.080690f, 0.087025f, -0.063125f, 0.072408f, -0.002242f, 0.020697f, 0.012634f, 0.024790f, 0.023931f, 0.014865f, 0.022072f, -0.058315f, 0.063568f, 0.059857f, 0.080129f, 0.052017f, 0.007910f, 0.079634f, 0.021867f, -0.049790f, -0.074203f, 0.005204f, 0.037532f, 0.077658f, -0.026705f, 0.083410f, 0.029348f, 0.057015f, 0.072795f, 0.092570f, -0.051243f, -0.014597f, 0.091161f, 0.048487f, -0.029058f, 0.008099f, 0.046029f, -0.097031f, -0.017582f, -0.070118f, 0.015517f, 0.069859f, -0.079435f, 0.080537f, 0.001760f, 0.037742f, -0.038567f, 0.005658f, 0.075931f, 0.032169f, -0.081854f, -0.037930f, -0.036922f, 0.106470f, 0.041334f, 0.016801f, -0.100680f, 0.071550f, -0.075460f, -0.060701f, 0.059672f, -0.106542f, -0.081642f, 0.098461f, -0.049909f, 0.069879f, 0.048320f, -0.088765f, 0.057553f, -0.043058f, 0.021558f, -0.010841f, -0.004491f, 0.074890f, -0.042605f, -0.027086f, -0.041160f, -0.011971f, 0.029355f, 0.069442f, 0.090706f, -0.070356f, 0.021423f, 0.023158f, 0.024533f, 0.056119f, 0.097143f, 0.037792f, -0.078573f, 0.081413f, 0.060832f, -0.041586f, -0.087291f, 0.073209f, 0.106842f, -0.088834f, 0.044924f, -0.108604f, -0.077579f, 0.046796f, 0.055928f, -0.016134f, -0.011806f, 0.057008f, 0.055073f, -0.031853f, 0.055436f, -0.067469f, -0.008048f, 0.058389f, 0.033885f, -0.006804f, 0.044668f, -0.072733f, -0.057024f, -0.066553f, -0.090980f, -0.075173f, 0.087804f, 0.081159f, 0.002316f, -0.011937f, 0.002178f, 0.096407f, 0.076106f, -0.047095f, -0.060436f, -0.103192f, -0.009967f, -0.032896f, -0.061280f, 0.077074f, 0.064914f, 0.058503f, -0.002211f, 0.061329f, 0.100834f, 0.085166f, -0.038037f, 0.059525f, -0.024697f, -0.088449f, 0.033981f, 0.045618f, 0.085089f, -0.018535f, -0.044091f, -0.093130f, -0.024306f, 0.029568f, -0.018202f, -0.059661f, -0.008648f, 0.090450f, -0.016663f, 0.001703f, 0.008594f, -0.037217f, -0.101791f, -0.037478f, -0.013245f, 0.032774f, -0.020480f, -0.017008f, 0.062413f, 0.024230f, 0.093581f, -0.108397f, 0.044546f, -0.095880f, -0.035433f, 0.090901f, 0.054425f, 0.028332f, -0.007797f, -0.077260f, -0.033702f, -0.017000f, -0.003913f, 0.003732f, -0.080634f, 0.023083f, -0.022901f, -0.085849f, 0.073910f, -0.047464f, -0.060452f, 0.033383f, -0.040966f, 0.009049f, -0.110820f, -0.015863f, -0.103351f, -0.042909f, -0.041171f, 0.108264f, -0.038023f, 0.060944f, -0.024707f, 0.088573f, 0.021012f, -0.104090f, -0.067469f, -0.080035f, -0.088352f, -0.043290f, 0.045158f, 0.041228f, -0.058221f, -0.023957f, 0.062043f, -0.096487f, 0.001240f, -0.090214f, 0.088012f, 0.003015f, 0.096074f, -0.062634f, 0.109681f, -0.072307f, -0.073181f, 0.070516f, 0.043594f, -0.042886f, -0.035962f, -0.021987f, 0.077816f, 0.039469f, 0.068475f, 0.059765f, -0.063126f, 0.002731f, 0.107077f, -0.061796f, -0.017701f, 0.037209f, 0.103765f, -0.089609f, -0.029196f, 0.057474f, 0.003502f, 0.070769f, -0.067287f, 0.022705f, 0.031110f, 0.078295f, 0.057828f, -0.022843f, 0.003460f, -0.083464f, 0.023452f, -0.085175f, 0.016397f, -0.008772f, 0.092981f, -0.048243f, -0.022584f, 0.085953f, 0.020409f, 0.047746f, 0.001456f, 0.049608f, 0.057595f, -0.075110f, 0.061019f, -0.075012f, 0.053723f, 0.024203f, -0.033441f, 0.102380f, 0.081281f, -0.032088f, -0.043574f, -0.012269f, -0.040865f, -0.062015f, 0.089673f, 0.076378f, 0.083193f, -0.019565f, 0.041955f, -0.034262f, 0.059860f, 0.076626f, -0.006186f, 0.008861f, 0.020117f, -0.067377f, -0.063814f, -0.034982f, 0.067168f, 0.026844f, 0.061057f, 0.003773f, -0.074406f, 0.004912f, -0.104814f, -0.001411f, -0.057776f, 0.057827f, -0.070795f, 0.010762f, -0.020551f, 0.059025f, 0.024951f, 0.009931f, 0.003111f, -0.064022f, -0.004588f, -0.047986f, -0.058791f, 0.063933f, -0.032003f, -0.051869f, -0.086253f, -0.097241f, -0.058249f, -0.025521f, 0.057584f, -0.041937f, 0.075408f, 0.000089f, -0.042162f, -0.067062f, -0.097717f, -0.011891f, -0.016686f, -0.038696f, 0.072828f, -0.068391f, -0.067821f, -0.063912f, 0.006819f, 0.028986f, 0.065317f, -0.060035f, -0.082338f, -0.013036f, -0.034433f, 0.085740f, -0.096905f, -0.046025f, 0.031906f, -0.015673f, 0.028397f, 0.070475f, 0.024148f, 0.019295f, 0.049505f, -0.099706f, -0.094491f, 0.036302f, -0.039077f, 0.112837f, 0.046158f, 0.092877f, -0.058657f, 0.010611f, -0.085200f, 0.029613f, -0.091801f, 0.023512f, -0.050738f, 0.027299f, -0.041956f, -0.099416f, 0.047820f, 0.000272f, 0.056490f, -0.099630f, 0.017054f, -0.074720f, -0.058492f, 0.055836f, -0.067688f, -0.071727f, -0.081538f, -0.058334f, 0.069148f, 0.001129f, 0.045398f, -0.059881f, 0.011043f, 0.075789f, -0.004109f, 0.087505f, -0.036537f, 0.104278f, -0.081445f, 0.045710f, -0.067546f, -0.056616f, 0.000371f, -0.043928f, -0.044678f, -0.000538f, 0.085879f, 0.037363f, -0.053780f, 0.090903f, -0.051878f, 0.039154f, -0.053930f, 0.039923f, 0.016187f, -0.001041f, -0.016118f, -0.035881f, 0.036488f, 0.077858f, -0.077214f, 0.058860f, 0.086848f, 0.029032f, -0.057402f, -0.022750f, 0.061804f, -0.042642f, -0.103928f, -0.061560f, -0.038228f, -0.032809f, -0.018489f, 0.047317f, -0.041744f, -0.000430f, 0.055081f, 0.042712f, -0.048908f, -0.041974f, -0.079943f, -0.071392f, -0.004432f, -0.036033f, 0.012517f, 0.031667f, 0.030268f, 0.102949f, -0.059038f, 0.059972f, -0.104225f, -0.079034f, -0.089602f, 0.038246f, -0.006436f, -0.075595f, -0.063156f, 0.023466f, 0.091339f, -0.045582f, -0.029282f, -0.087852f, 0.018340f, 0.097132f, -0.067990f, 0.005586f, 0.066289f, 0.027711f, 0.008995f, 0.037971f, 0.043876f, 0.057225f, 0.012212f, -0.034111f, -0.042618f, 0.096839f, -0.094574f, -0.028496f, 0.041214f, 0.021927f, -0.004876f, -0.088337f, -0.084468f, 0.031387f, -0.013599f, -0.034207f, -0.038037f, -0.000447f, 0.049168f, 0.003253f, -0.067698f, -0.079612f, -0.073657f, -0.098882f, 0.048700f, 0.081638f, -0.017005f, 0.090232f, 0.055417f, 0.082562f, -0.025051f, 0.079194f, 0.049423f, -0.012891f, 0.081268f, -0.105707f, 0.027704f, 0.018710f, -0.096868f, 0.058384f, -0.050250f, -0.043106f, 0.012163f, 0.075514f, 0.012966f, 0.003818f, -0.014934f, -0.053960f, -0.014258f, -0.040305f, -0.012782f, -0.027868f, 0.084332f, 0.067171f, 0.050693f, 0.008394f, 0.040914f, -0.021203f, -0.006061f, 0.075552f, -0.014564f, -0.052681f, 0.000945f, 0.017180f, -0.068951f, -0.088653f, -0.051470f, 0.064761f, 0.024109f, -0.069030f, 0.024991f, 0.022367f, -0.002458f, 0.064423f, -0.110049f, -0.053254f, 0.107076f, 0.008531f, -0.090428f, -0.038454f, -0.083013f, 0.000664f, 0.081291f, 0.032959f, 0.008025f, -0.017467f, -0.067632f, 0.011602f, 0.081814f, -0.109203f, 0.020357f, -0.029875f, 0.021804f, 0.055781f, -0.004634f, -0.045566f, -0.021514f, -0.076622f, -0.069314f, -0.014064f, 0.036931f, -0.059270f, 0.092196f, 0.049176f, 0.047262f, 0.040679f, -0.112925f, 0.067593f, 0.069488f, -0.082024f, 0.018653f, 0.017916f, -0.070835f, 0.053455f, 0.012192f, -0.054961f, 0.082429f, -0.038987f, 0.053254f, 0.005500f, 0.043942f, -0.083619f, 0.078594f, -0.039502f, -0.065953f, 0.001992f, -0.018710f, 0.000069f, -0.100101f, -0.040373f, 0.042521f, 0.075043f, -0.061058f, 0.048591f, -0.099396f, -0.102665f, -0.033132f, -0.083787f, -0.073164f, 0.038854f, 0.084965f, 0.059162f, -0.017763f, 0.086471f, 0.079370f, 0.009674f, -0.015038f, -0.079835f, -0.055030f, -0.097425f, -0.002429f, 0.050051f, 0.026732f, 0.060476f, 0.038774f, 0.052006f, -0.057280f, -0.046943f, 0.076158f, -0.042802f, -0.046455f, 0.064844f, 0.078306f, 0.035650f, -0.036923f, 0.038160f, -0.084962f, -0.054589f, -0.016383f, 0.081804f, -0.042801f, -0.103600f, -0.040265f, -0.037930f, -0.099872f, -0.008692f, -0.041342f, 0.036008f, -0.078812f, -0.005664f, -0.026979f, 0.044802f, 0.093264f, -0.083828f, 0.061437f, 0.035256f, -0.108866f, 0.062311f, -0.005738f, 0.045068f, -0.014819f, 0.042315f, -0.060132f, -0.047686f, -0.015543f, 0.010941f, 0.057064f, 0.047810f, 0.053775f, -0.012246f, 0.084381f, -0.072540f, -0.055052f, 0.024332f, -0.061754f, -0.072091f, 0.064886f, -0.087939f, 0.082137f, 0.083971f, 0.085027f, 0.008591f, -0.037341f, 0.045295f, -0.078968f, 0.008294f, -0.016726f, 0.062061f, -0.092875f, -0.024437f, -0.020225f, -0.055165f, -0.015177f, 0.070561f, -0.005619f, -0.032873f, 0.014348f, -0.095454f, -0.025842f, 0.069979f, 0.012637f, -0.105293f, 0.007536f, -0.074161f, 0.109154f, 0.074093f, -0.078876f, -0.030817f, 0.010332f, -0.074241f, 0.029672f, 0.073433f, -0.082011f, -0.087639f, -0.025087f, 0.077819f, -0.032462f, -0.058260f, -0.073992f, 0.089149f, 0.062651f, 0.014696f, 0.021243f, 0.065563f, -0.029558f, 0.014124f, 0.049759f, -0.000235f, -0.077729f, 0.080050f, 0.050486f, -0.016690f, 0.028519f, 0.041786f, -0.014730f, 0.058112f, 0.035857f, -0.000591f, -0.044673f, 0.027980f, 0.003249f, -0.001097f, -0.071929f, 0.039243f, -0.008435f, 0.001948f, 0.047832f, -0.043110f, -0.060855f, 0.037425f, -0.017326f, -0.052020f, -0.041090f, -0.018373f, 0.052909f, 0.048929f, 0.061927f, 0.084534f, -0.084397f, 0.083938f, -0.002874f, -0.049829f, 0.103434f, 0.050434f, 0.094941f, 0.017089f, 0.059293f, 0.009498f, -0.008845f, 0.093496f, 0.034431f, 0.024722f, -0.024973f, -0.082003f, -0.086547f, -0.051376f, 0.028465f, -0.060915f, -0.080340f, -0.065147f, 0.085906f, -0.043730f, -0.057892f, -0.026424f, 0.015466f, 0.034921f, 0.070827f, 0.026645f, 0.023771f, 0.052614f, 0.021415f, 0.062991f, 0.003131f, 0.057116f, 0.068364f, 0.032781f, -0.035154f, -0.057206f, 0.014091f, 0.010509f, -0.100849f, 0.062052f, -0.039049f, -0.082219f, -0.053487f, 0.043845f, 0.017386f, 0.071156f, -0.087096f, 0.070535f, 0.040310f, -0.072079f, 0.038705f, 0.062927f, -0.072880f, -0.057862f, 0.034786f, -0.035374f, 0.064730f, 0.023863f, 0.064919f, -0.090279f, 0.054399f, -0.022304f, -0.009966f, -0.032861f, -0.060350f, -0.056738f, -0.015694f, -0.036123f, -0.051740f, 0.107052f, -0.011412f, 0.017395f, -0.041011f, 0.026110f, -0.013524f, 0.033523f, 0.030991f, 0.022585f, 0.058139f, -0.050943f, -0.073592f, -0.015250f, 0.014156f, -0.068295f, 0.052954f, 0.056556f, 0.063291f, 0.054338f, -0.089568f, 0.018231f, -0.014666f, -0.037629f, 0.018178f, -0.026556f, 0.022016f, 0.020576f, 0.020717f, -0.080016f, -0.038600f, 0.057437f, -0.026049f, 0.006428f, -0.026519f, -0.070275f, -0.071562f, 0.041924f, 0.014477f, 0.079337f, -0.029030f, 0.039748f, 0.006859f, -0.021659f, 0.085509f, -0.021671f, 0.088805f, 0.016364f, -0.085461f, -0.070918f, 0.094530f, -0.022873f, 0.000907f, -0.000548f, -0.064448f, -0.082529f, -0.055844f, 0.035893f, 0.018788f, -0.044099f, -0.074216f, -0.019696f, -0.034294f, 0.037204f, 0.042449f, -0.073366f, -0.037481f, 0.044397f, 0.022471f, 0.003514f, -0.063128f, -0.054724f, -0.101549f, 0.057534f, 0.069363f, 0.065892f, -0.063570f, 0.062831f, 0.067445f, 0.104880f, 0.054195f, -0.035287f, -0.043418f, 0.029414f, 0.048337f, 0.043236f, -0.023148f, -0.009811f, -0.035246f, 0.003931f, 0.039862f, 0.024139f, -0.023620f, -0.010069f, 0.058561f, -0.061001f, -0.060714f, 0.008216f, -0.018350f, -0.085033f, 0.032125f, -0.007163f, 0.008197f, 0.079563f, -0.018422f, -0.091310f, -0.073103f, -0.022192f, 0.057177f, 0.025369f, 0.080148f, -0.031541f, -0.079840f, -0.052371f, 0.102618f, 0.032184f, 0.081309f, 0.007780f, -0.038529f, 0.097871f, -0.049105f, -0.031106f, -0.029004f, 0.037860f, -0.005248f, 0.076266f, 0.102276f, -0.065753f, 0.094520f, 0.065731f, 0.024410f, -0.022512f, 0.022869f, 0.072315f, 0.053136f, 0.042896f, -0.046755f, -0.073607f, 0.000778f, -0.048105f, 0.047099f, -0.071180f, 0.003881f, 0.056813f, -0.081372f, 0.031377f, -0.062401f, -0.054468f, -0.049371f, -0.102827f, 0.037971f, -0.021134f, 0.085119f, -0.068461f, 0.065712f, -0.002529f, -0.084676f, 0.063210f, -0.083081f, 0.013749f, -0.062524f, -0.024934f, 0.006264f, 0.095582f, -0.026839f, -0.017543f, -0.044448f, -0.017266f, -0.059986f, 0.011683f, 0.001156f, 0.030608f, -0.041806f, -0.029615f, -0.096834f, -0.073520f, -0.033746f, -0.014587f, 0.045212f, 0.038446f, -0.005845f, 0.065980f, 0.040186f, 0.011190f, -0.060775f, -0.056822f, -0.007531f, 0.070754f, -0.034364f, 0.096916f, 0.040708f, -0.021606f, 0.020158f, -0.007271f, 0.082897f, -0.105207f, -0.069147f, -0.066070f, 0.046182f, -0.048190f, 0.034905f, 0.002855f, 0.072067f, 0.114530f, -0.060358f, -0.052029f, 0.044286f, -0.105221f, 0.061477f, -0.010253f, -0.037115f, 0.023074f, -0.043703f, -0.053316f, -0.055523f, 0.050698f, 0.050315f, 0.032641f, -0.034969f, 0.041967f, -0.051402f, 0.089126f, -0.019605f, -0.005196f, -0.054059f, 0.028264f, 0.095003f, 0.005570f, 0.020041f, -0.047635f, -0.044469f, -0.065238f, -0.010747f, -0.055675f, 0.035752f, -0.023466f, 0.041018f, -0.096444f, 0.077144f, -0.029984f, -0.061681f, 0.013428f, 0.084982f, 0.033771f, -0.047678f, -0.025199f, 0.034163f, -0.089779f, -0.026314f, 0.011090f, 0.061577f, -0.045249f, 0.071801f, 0.069548f, -0.107329f, -0.073240f, 0.028652f, -0.019794f, -0.077474f, -0.007717f, 0.016548f, 0.087522f, -0.044539f, -0.081019f, -0.036899f, 0.016159f, 0.039413f, -0.042963f, -0.036659f, -0.112600f, -0.075892f, -0.068772f, -0.050084f, -0.023545f, -0.079530f, -0.024575f, -0.051668f, 0.028150f, -0.018729f, 0.012878f, 0.057138f, -0.095796f, -0.036196f, 0.078595f, -0.107756f, -0.022907f, -0.000190f, 0.054273f, -0.047060f, 0.064614f, -0.114089f, 0.006407f, -0.019044f, 0.068842f, -0.025048f, -0.085112f, 0.054711f, -0.109767f, -0.048117f, 0.015226f, 0.033353f, -0.020815f, -0.093457f, 0.073781f, -0.091247f, 0.059105f, -0.070213f, -0.087653f, -0.063251f, -0.079384f, 0.062543f, 0.069917f, -0.060289f, -0.087286f, 0.025162f, 0.048744f, 0.020536f, -0.104720f, 0.063039f, 0.054720f, 0.053406f, -0.047828f, -0.100821f, 0.099686f, -0.016578f, 0.055916f, -0.095142f, -0.015817f, -0.010935f, -0.085594f, -0.035400f, 0.076632f, 0.028770f, 0.062917f, 0.092118f, -0.037953f, 0.056824f, -0.083592f, 0.004856f, 0.024815f, -0.025502f, -0.066150f, -0.000688f, 0.078582f, 0.033307f, -0.006214f, 0.079630f, 0.053939f, -0.099655f, 0.041980f, 0.035439f, -0.102868f, 0.070086f, -0.021313f, -0.058549f, 0.003638f, 0.080174f, -0.044572f, 0.094792f, -0.071677f, -0.067081f, 0.020546f, -0.008474f, 0.040197f, -0.078453f, -0.063075f, 0.031509f, -0.014084f, -0.034835f, 0.049794f, 0.065190f, 0.035898f, 0.038428f, 0.103016f, -0.097456f, -0.082069f, 0.001456f, -0.058032f, -0.054660f, 0.103520f, -0.104422f, -0.084498f, 0.092771f, -0.051374f, -0.081368f, 0.009006f, 0.080581f, -0.054899f, 0.068081f, 0.083781f, -0.056165f, -0.000286f, 0.070140f, -0.082344f, -0.077126f, -0.042541f, -0.045255f, -0.046421f, -0.073448f, 0.027346f, -0.066327f, 0.005170f, -0.091388f, -0.017792f, -0.032826f, 0.065711f, 0.041490f, 0.083313f, -0.004592f, -0.053339f, -0.000766f, 0.020165f, 0.023513f, 0.092696f, 0.008992f, -0.049230f, 0.091777f, -0.056732f, -0.006987f, 0.063650f, 0.033578f, 0.000633f, 0.025964f, -0.019594f, -0.033659f, 0.037603f, 0.058540f, 0.068392f, 0.082609f, 0.076977f, -0.075894f, 0.090060f, -0.062757f, -0.068383f, 0.032509f, 0.028963f, 0.075445f, 0.066100f, -0.017548f, 0.009762f, 0.021013f, 0.066862f, 0.027289f, -0.033802f, 0.050396f, -0.036352f, -0.042104f, -0.096468f, 0.062716f, -0.102566f, -0.025962f, 0.102605f, 0.004964f, -0.063162f, 0.108685f, 0.060615f, -0.094794f, -0.046603f, 0.033212f, -0.074364f, 0.023022f, -0.081188f, 0.019368f, 0.016096f, 0.091753f, -0.060270f, 0.008617f, -0.042087f, 0.034865f, -0.045316f, 0.087678f, -0.027067f, -0.010088f, 0.040998f, 0.066004f, -0.015625f, 0.041810f, -0.084304f, -0.042000f, 0.028942f, 0.077234f, -0.064049f, -0.088181f, 0.101148f, -0.063491f, -0.080368f, 0.000492f, -0.054971f, -0.025334f, 0.008046f, -0.044775f, 0.112168f, -0.066834f, 0.086588f, 0.056840f, -0.001774f, 0.101280f, -0.055909f, -0.073388f, -0.001096f, -0.092769f, -0.016042f, 0.070518f, -0.006326f, -0.053129f, -0.059914f, 0.091393f, 0.041375f, -0.059542f, -0.019702f, 0.033496f, 0.014162f, 0.066645f, -0.085699f, -0.059670f, 0.015641f, -0.004812f, -0.065288f, -0.080440f, 0.032416f, -0.004987f, 0.015299f, 0.056429f, 0.017262f, -0.044443f, 0.022416f, -0.053647f, -0.048241f, 0.030503f, -0.094112f, -0.107811f, 0.093604f, 0.078270f, 0.069224f, -0.041369f, 0.061184f, -0.020833f, -0.080985f, 0.045792f, 0.058727f, 0.032046f, 0.089083f, 0.088939f, -0.077768f, 0.044467f, 0.016365f, 0.036629f, 0.109374f, 0.080695f, -0.017487f, 0.099348f, 0.084218f, 0.053125f, 0.085421f, -0.017707f, 0.048482f, -0.086342f, -0.003092f, 0.032708f, -0.006393f, 0.074848f, -0.015455f, -0.034970f, -0.002139f, 0.092821f, 0.046455f, 0.083323f, -0.024197f, 0.040348f, 0.009786f, -0.065449f, 0.057815f, -0.099848f, 0.024759f, -0.055288f, -0.045842f, 0.100632f, -0.005401f, 0.012674f, 0.015135f, -0.016302f, 0.056688f, -0.105751f, 0.046956f, -0.046657f, 0.065201f, -0.060807f, -0.073330f, -0.076447f, 0.020366f, -0.037592f, 0.034097f, -0.087101f, -0.037743f, 0.047022f, -0.080771f, 0.043272f, -0.090753f, 0.067780f, 0.057286f, -0.057793f, -0.008527f, 0.008891f, -0.021152f, -0.040659f, -0.037863f, 0.028823f, -0.070871f, -0.038759f, -0.077331f, -0.059942f, -0.102038f, 0.033164f, -0.024731f, -0.034537f, -0.011701f, -0.060025f, -0.014810f, 0.029802f, -0.070683f, 0.009753f, 0.001688f, -0.075000f, -0.041821f, 0.006179f, -0.005928f, 0.044745f, -0.057669f, -0.022944f, 0.076067f, -0.065788f, 0.067127f, -0.010940f, 0.011144f, 0.040397f, -0.003678f, 0.078135f, -0.046905f, -0.083868f, -0.059108f, 0.099871f, -0.097096f, 0.017728f, 0.072910f, 0.057734f, 0.081022f, 0.109144f, -0.003539f, -0.061305f, 0.009600f, 0.050047f, -0.020062f, -0.029170f, 0.046773f, 0.049781f, 0.020457f, 0.020133f, 0.013789f, 0.057735f, 0.070701f, -0.084288f, 0.104939f, -0.025817f, -0.035138f, -0.022611f, 0.052383f, 0.032588f, -0.076943f, -0.029249f, -0.111848f, 0.065698f, -0.059881f, -0.086954f, 0.041537f, -0.071478f, 0.018378f, -0.049855f, 0.065156f, 0.088718f, -0.077660f, 0.080631f, -0.016920f, -0.103133f, 0.019742f, -0.017520f, 0.091481f, -0.047316f, 0.060507f, -0.067221f, -0.035288f, 0.013742f, -0.075670f, -0.054254f, -0.060788f, 0.051946f, 0.095757f, -0.067713f, -0.003345f, -0.058335f, -0.077126f, -0.088938f, -0.026232f, -0.003421f, 0.045285f, -0.010350f, -0.041167f, -0.093497f, 0.013169f, -0.067638f, -0.012027f, -0.110921f, -0.065913f, 0.017647f, -0.085294f, 0.027267f, 0.071707f, 0.063933f, -0.048867f, 0.011987f, 0.070912f, 0.045038f, 0.067216f, -0.032865f, 0.017974f, 0.064685f, -0.023979f, 0.045715f, -0.003037f, 0.027594f, 0.022162f, -0.023238f, 0.008374f, 0.007535f, 0.063481f, 0.027804f, 0.026079f, 0.078477f, -0.098888f, -0.068345f, -0.021725f, 0.101977f, -0.049722f, 0.026782f, -0.063484f, -0.031779f, -0.043975f, 0.030298f, -0.069081f, 0.060119f, -0.054845f, 0.033649f, -0.009510f, -0.011190f, -0.085487f, -0.069317f, -0.003609f, 0.040696f, -0.073660f, -0.075345f, -0.104654f, -0.056127f, -0.069218f, 0.022446f, -0.074357f, 0.020839f, -0.006298f, -0.062570f, 0.108907f, 0.007394f, -0.022990f, -0.075935f, -0.053154f, 0.006122f, -0.036795f, 0.000096f, -0.030546f, -0.101207f, -0.025497f, -0.018922f, -0.031485f, 0.015481f, -0.005479f, 0.105673f, 0.008251f, -0.028150f, -0.041668f, 0.015025f, 0.089069f, 0.012063f, 0.048793f, 0.036413f, 0.088733f, -0.021541f, 0.063202f, 0.018953f, -0.090134f, -0.079092f, 0.000950f, 0.023818f, 0.066993f, -0.087123f, 0.094875f, 0.068072f, 0.060797f, 0.023163f, -0.012459f, 0.048442f, -0.067064f, -0.053937f, -0.051650f, 0.108882f, -0.077160f, 0.056361f, -0.020511f, -0.100729f, -0.084660f, 0.080144f, 0.061001f, 0.012311f, -0.062292f, -0.113749f, 0.066850f, -0.032670f, -0.065696f, -0.064771f, 0.075216f, 0.037679f, 0.015689f, 0.098109f, 0.090455f, 0.024439f, 0.076806f, -0.048705f, -0.112509f, 0.092681f, -0.026324f, 0.084699f, -0.061854f, -0.030530f, 0.065971f, 0.050035f, -0.072895f, 0.017853f, -0.082057f, -0.068845f, 0.005956f, -0.096571f, 0.005499f, 0.022701f, 0.096752f, 0.084911f, 0.018850f, 0.013162f, 0.042022f, 0.087191f, 0.079778f, -0.087814f, 0.076862f, 0.045358f, -0.097044f, 0.046852f, 0.016731f, 0.086019f, -0.016405f, -0.004851f, 0.075576f, -0.019658f, 0.014224f, -0.033674f, -0.024521f, -0.046133f, -0.089489f, 0.030274f, 0.051868f, 0.037050f, -0.033791f, 0.002705f, 0.013130f, 0.045594f, -0.018327f, -0.085825f, 0.061934f, 0.038941f, -0.074943f, -0.051272f, -0.031165f, -0.000247f, -0.023703f, 0.008344f, 0.063482f, 0.035369f, -0.015717f, 0.066082f, 0.025923f, 0.029349f, 0.016616f, -0.069230f, 0.030328f, -0.034449f, 0.007290f, -0.086033f, 0.067742f, -0.014152f, 0.047360f, -0.068933f, 0.073631f, 0.012093f, -0.080665f, -0.044198f, 0.111950f, 0.040423f, -0.023262f, 0.081207f, -0.030573f, 0.037031f, -0.050787f, 0.026030f, -0.012120f, -0.001887f, -0.040541f, 0.081631f, -0.075353f, -0.069747f, -0.025084f, -0.083675f, 0.073629f, 0.073665f, -0.027900f, -0.014627f, -0.099823f, 0.058554f, 0.068365f, -0.005796f, -0.001790f, 0.045142f, 0.004149f, -0.031319f, -0.040276f, -0.006939f, 0.103736f, 0.007781f, -0.103291f, 0.072498f, -0.021250f, -0.086373f, -0.095930f, -0.056856f, 0.014325f, -0.011608f, 0.083989f, 0.051312f, -0.047864f, 0.104588f, 0.017369f, -0.108799f, 0.003270f, 0.064286f, -0.026598f, 0.089717f, 0.037411f, 0.022116f, -0.009012f, 0.100896f, -0.030429f, 0.010561f, 0.039527f, 0.014546f, -0.025051f, 0.058623f, 0.009794f, -0.012438f, -0.016703f, -0.065077f, 0.037503f, 0.073138f, -0.030581f, 0.080440f, -0.058873f, -0.019288f, 0.034213f, 0.000918f, 0.060302f, 0.035900f, 0.064895f, 0.027882f, -0.020879f, -0.027136f, -0.032632f, -0.002028f, 0.079256f, 0.035567f, 0.059195f, 0.087108f, 0.071258f, 0.081681f, 0.075627f, -0.039368f, -0.026882f, 0.003556f, 0.024802f, -0.020290f, 0.067923f, 0.037328f, 0.001378f, -0.051930f, -0.077366f, -0.049198f, 0.088345f, -0.085696f, 0.103064f, -0.000376f, -0.018487f, 0.049769f, 0.078454f, -0.067504f, 0.050618f, 0.001025f, -0.019429f, -0.061980f, 0.006259f, 0.069861f, 0.089221f, 0.082081f, -0.086481f, -0.015148f, -0.106800f, 0.036256f, 0.095118f, 0.028589f, -0.029751f, 0.063282f, 0.082871f, -0.108140f, 0.069392f, -0.031165f, 0.032893f, -0.037111f, -0.074000f, 0.046063f, 0.063327f, 0.061033f, 0.061323f, -0.075942f, 0.073148f, -0.011277f, -0.041931f, 0.017401f, -0.046258f, 0.044146f, 0.023375f, 0.054299f, 0.082180f, 0.046445f, -0.084837f, 0.058411f, 0.005252f, 0.006967f, -0.022264f, -0.082350f, -0.054426f, -0.070095f, 0.067924f, 0.043049f, 0.068917f, 0.053866f, -0.079592f, 0.030441f, 0.026876f, -0.090499f, 0.093780f, 0.062484f, 0.034989f, -0.011158f, -0.064582f, -0.072987f, 0.047363f, 0.098399f, -0.106178f, 0.000029f, -0.067375f, -0.010208f, 0.002514f, -0.004257f, -0.084344f, 0.086527f, 0.070921f, 0.064102f, -0.005847f, 0.048001f, 0.053637f, -0.045454f, -0.093969f, 0.010880f, 0.099344f, 0.032186f, -0.070257f, -0.000935f, -0.033024f, 0.006872f, 0.046223f, -0.010285f, 0.098245f, 0.055771f, -0.037704f, 0.022060f, -0.011535f, 0.045446f, -0.077851f, 0.004235f, -0.103633f, 0.106021f, 0.013346f, -0.056635f, -0.080102f, -0.042889f, 0.024704f, 0.080298f, -0.091005f, -0.062314f, -0.059522f, 0.040643f, -0.096378f, 0.068982f, -0.041060f, 0.057439f, 0.053011f, 0.090650f, -0.046295f, 0.056351f, -0.029779f, -0.032088f, 0.009304f, -0.062780f, -0.044472f, 0.071915f, -0.045722f, -0.032407f, 0.047300f, -0.041563f, -0.077174f, -0.046130f, 0.094740f, -0.023771f, -0.032543f, 0.060114f, -0.100194f, -0.079152f, 0.053342f, -0.050762f, 0.054819f, -0.086871f, 0.032540f, 0.014081f, -0.052051f, -0.061579f, 0.066586f, -0.014521f, -0.074814f, -0.081888f, 0.046383f, -0.017027f, 0.010689f, 0.001403f, 0.100650f, 0.073509f, 0.109578f, 0.103750f, 0.029019f, -0.087807f, 0.111495f, -0.021854f, -0.079550f, 0.083186f, -0.002022f, -0.008437f, -0.091891f, -0.017937f, -0.053049f, 0.059838f, -0.100285f, 0.022437f, -0.073300f, 0.038418f, 0.082994f, -0.084431f, -0.066287f, -0.006698f, 0.081921f, -0.020950f, 0.016686f, 0.039624f, 0.070538f, -0.076302f, 0.091730f, 0.035903f, 0.042118f, -0.022839f, -0.013449f, -0.071400f, 0.069006f, -0.060186f, 0.022824f, -0.010987f, -0.094253f, -0.035236f, 0.069437f, 0.009573f, -0.048380f, -0.011791f, 0.068505f, 0.047159f, -0.087068f, 0.021320f, -0.044622f, 0.084236f, 0.033458f, -0.074203f, -0.067885f, -0.072495f, -0.005760f, 0.052539f, -0.092486f, -0.052609f, -0.059286f, 0.013230f, 0.097889f, 0.065522f, -0.073457f, 0.054739f, -0.004866f, -0.015703f, 0.090927f, 0.017528f, -0.059548f, -0.062510f, 0.081354f, -0.069272f, -0.057954f, 0.033988f, -0.070164f, 0.066862f, -0.030828f, -0.017540f, -0.086104f, -0.104130f, 0.035523f, -0.075579f, 0.019877f, 0.002073f, 0.012623f, -0.054994f, 0.059345f, -0.003267f, -0.059649f, -0.090668f, -0.030957f, 0.035129f, -0.069297f, 0.031746f, -0.060626f, -0.019826f, 0.021859f, 0.046823f, -0.064522f, -0.092563f, -0.006921f, -0.062992f, 0.002342f, -0.082299f, -0.013446f, -0.017491f, -0.057552f, -0.000265f, -0.017805f, -0.075210f, 0.044277f, 0.069348f, 0.010233f, 0.035751f, 0.062007f, 0.096050f, 0.107190f, -0.015329f, 0.080742f, -0.040557f, 0.056432f, 0.069342f, -0.111620f, 0.070133f, 0.063505f, -0.058670f, -0.014520f, -0.080964f, 0.066034f, 0.072391f, 0.064302f, -0.011280f, 0.023399f, 0.055176f, -0.061120f, -0.086693f, 0.050825f, 0.000695f, 0.071022f, -0.110883f, -0.081173f, -0.037738f, -0.021742f, 0.053196f, -0.010805f, 0.076098f, -0.030856f, -0.095614f, -0.022370f, -0.025720f, 0.023347f, 0.042157f, -0.084089f, 0.036905f, -0.061108f, -0.000480f, 0.074998f, -0.081719f, -0.048745f, -0.006696f, -0.102858f, -0.056362f, -0.067954f, -0.000519f, 0.001720f, 0.055669f, 0.070599f, 0.002041f, 0.023095f, -0.093535f, -0.016364f, 0.082284f, 0.003023f, -0.038957f, -0.069459f, -0.015758f, 0.097277f, -0.077205f, 0.020962f, -0.009301f, 0.067742f, -0.054669f, -0.080894f, 0.026699f, 0.048022f, -0.009967f, -0.083801f, 0.056753f, 0.086725f, 0.042341f, 0.101921f, 0.060071f, 0.051917f, -0.010719f, -0.097524f, -0.091785f, 0.004790f, -0.024213f, -0.016517f, -0.104132f, -0.074488f, -0.071773f, -0.092970f, 0.019082f, -0.070419f, -0.051412f, -0.083221f, 0.067670f, 0.090430f, -0.075447f, 0.016447f, 0.028143f, -0.030382f, 0.006650f, -0.025136f, -0.079555f, 0.083479f, 0.023162f, 0.075314f, -0.081310f, 0.068533f, -0.004537f, 0.066152f, 0.053217f, -0.082390f, -0.107039f, -0.071292f, 0.039203f, -0.081959f, 0.001555f, 0.003292f, 0.042593f, 0.003754f, -0.092176f, -0.065339f, -0.089343f, 0.108839f, 0.041378f, -0.107591f, -0.074721f, -0.039273f, 0.046076f, -0.032710f, 0.008736f, 0.053796f, 0.086426f, 0.005496f, 0.039873f, -0.059845f, -0.050725f, 0.078784f, 0.015950f, 0.035995f, 0.076581f, -0.107311f, -0.028198f, 0.026897f, -0.022637f, 0.097701f, -0.009342f, -0.061556f, 0.082007f, -0.096729f, 0.062944f, -0.083367f, -0.003145f, -0.073972f, 0.091396f, -0.034474f, -0.105718f, 0.040574f, -0.048189f, 0.012171f, -0.010906f, -0.019090f, -0.051203f, 0.064717f, -0.022644f, -0.080125f, 0.102733f, 0.007600f, -0.006502f, -0.029838f, 0.040389f, -0.033914f, 0.033256f, 0.089039f, -0.016486f, 0.044318f, -0.055312f, 0.034203f, 0.030989f, -0.011141f, -0.061638f, 0.032951f, -0.025049f, -0.033573f, 0.072090f, 0.044794f, -0.075063f, -0.000747f, -0.072128f, 0.038206f, -0.033370f, 0.049321f, 0.065483f, 0.111059f, -0.028075f, -0.049815f, -0.074591f, 0.011684f, -0.045533f, 0.091396f, -0.097480f, 0.034203f, -0.013842f, 0.015348f, 0.016669f, 0.009465f, 0.031340f, 0.026704f, 0.100654f, -0.000651f, 0.081872f, 0.058855f, 0.055574f, 0.095520f, -0.070470f, -0.042081f, 0.089012f, -0.056230f, -0.015185f, -0.085053f, -0.079811f, 0.014698f, -0.031873f, -0.028445f, -0.003312f, 0.015067f, -0.011387f, -0.044871f, -0.069118f, 0.006810f, -0.009366f, 0.063085f, -0.080507f, 0.024068f, 0.035874f, 0.093303f, 0.064644f, 0.011761f, -0.034272f, -0.112901f, -0.065824f, 0.082002f, 0.096541f, 0.026597f, 0.027397f, 0.008745f, 0.043388f, -0.099814f, -0.033956f, -0.044335f, 0.103461f, -0.112229f, 0.031698f, -0.007772f, -0.100136f, -0.011405f, -0.066866f, -0.075193f, 0.040736f, -0.075435f, -0.081397f, -0.031193f, -0.087315f, 0.002516f, -0.039535f, -0.064809f, 0.014596f, 0.021005f, 0.038055f, 0.088051f, -0.086864f, -0.075966f, 0.022874f, -0.022293f, 0.094963f, -0.013119f, -0.037585f, 0.070932f, 0.011530f, -0.099637f, -0.087604f, 0.008163f, -0.024468f, 0.052418f, 0.042007f, -0.102840f, -0.077938f, 0.082054f, -0.064131f, 0.006777f, 0.090770f, 0.104197f, 0.055945f, 0.063616f, 0.076476f, -0.088362f, 0.057717f, -0.029646f, -0.102350f, 0.017316f, -0.064201f, -0.099768f, 0.010237f, -0.049892f, 0.057373f, -0.032469f, 0.061174f, -0.083059f, 0.093893f, -0.094553f, -0.064546f, -0.078307f, 0.094144f, -0.098128f, -0.030555f, 0.047113f, -0.020320f, -0.105313f, -0.035387f, 0.056233f, -0.031321f, 0.049392f, 0.054220f, -0.002038f, -0.067945f, 0.113502f, -0.007139f, -0.054787f, 0.032437f, 0.026201f, -0.017349f, 0.032981f, -0.072739f, 0.057740f, 0.048555f, 0.037396f, -0.088739f, 0.015147f, 0.037746f, 0.015432f, -0.075682f, -0.085349f, 0.035126f, 0.070095f, 0.100651f, -0.003398f, -0.049252f, -0.032716f, -0.091149f, -0.029693f, 0.053597f, -0.036423f, -0.079710f, -0.071887f, 0.027932f, 0.045331f, -0.073900f, 0.070155f, -0.026716f, 0.018944f, -0.040908f, 0.038085f, -0.010194f, 0.036366f, -0.018490f, 0.043031f, 0.068424f, 0.001890f, -0.005306f, -0.051000f, 0.042337f, -0.069447f, 0.041197f, 0.072244f, 0.097329f, 0.046862f, 0.010981f, 0.075282f, -0.001736f, -0.037590f, 0.047126f, -0.047129f, -0.096739f, -0.037586f, -0.020257f, -0.060197f, 0.080146f, 0.046525f, -0.104957f, -0.003290f, -0.080902f, 0.014337f, 0.037576f, -0.034340f, 0.007021f, -0.002298f, 0.015417f, -0.000267f, -0.072015f, -0.032601f, 0.095106f, 0.035084f, 0.094162f, -0.086466f, -0.048250f, 0.107579f, -0.024349f, 0.008687f, 0.023827f, -0.057771f, 0.034257f, -0.095762f, -0.004673f, 0.006702f, -0.069189f, 0.034623f, 0.072790f, 0.077068f, -0.103425f, -0.050942f, 0.072403f, -0.073855f, -0.029525f, 0.007975f, 0.060692f, -0.042899f, -0.026135f, -0.061702f, -0.021710f, 0.009470f, 0.083104f, 0.035023f, 0.026133f, 0.028370f, -0.028667f, -0.096355f, -0.039640f, -0.071670f, -0.038886f, -0.056481f, -0.022779f, -0.033763f, -0.021223f, 0.059339f, -0.071903f, -0.054867f, -0.097672f, 0.098521f, -0.054013f, 0.029071f, -0.019654f, 0.027975f, 0.041611f, 0.049542f, -0.013863f, -0.020752f, -0.075579f, 0.033453f, -0.084403f, 0.061245f, -0.082047f, 0.081488f, -0.046302f, 0.013734f, 0.063389f, 0.039672f, -0.019773f, 0.014760f, -0.107314f, -0.025233f, -0.058861f, -0.037594f, -0.040683f, -0.063153f, 0.081623f, -0.008703f, 0.043870f, 0.077709f, 0.030478f, -0.056765f, 0.059852f, 0.046067f, -0.013695f, 0.021793f, -0.026169f, -0.066036f, 0.049228f, 0.041813f, 0.016469f, -0.021810f, -0.020035f, -0.028711f, -0.035766f, 0.050110f, 0.086232f, -0.108372f, 0.025210f, -0.027780f, 0.081076f, -0.036842f, -0.025300f, 0.039806f, -0.101399f, 0.054883f, 0.039211f, -0.049166f, 0.040483f, 0.093758f, 0.073553f, -0.003967f, -0.056511f, 0.091034f, -0.009084f, -0.030964f, 0.014751f, -0.074611f, -0.019820f, 0.065480f, 0.001006f, 0.043043f, 0.063533f, 0.035266f, -0.080414f, 0.034669f, 0.000757f, -0.100508f, 0.078503f, -0.070394f, -0.107960f, 0.039253f, -0.063756f, -0.074361f, 0.086708f, -0.067689f, 0.016424f, -0.013877f, -0.084971f, -0.052961f, -0.025616f, -0.015374f, 0.025632f, 0.084972f, -0.009257f, 0.071237f, 0.013013f, 0.011775f, -0.075456f, 0.021406f, -0.061160f, -0.034212f, 0.003007f, 0.037945f, 0.019873f, -0.036987f, -0.077824f, -0.064438f, -0.024365f, 0.095555f, 0.006799f, 0.087968f, 0.003433f, -0.001682f, -0.028767f, 0.078159f, -0.000499f, -0.036988f, 0.091790f, 0.048691f, 0.020450f, 0.022514f, 0.006169f, -0.092343f, 0.043554f, -0.014294f, -0.108440f, 0.032757f, -0.061524f, 0.071853f, -0.035808f, 0.032775f, 0.001915f, -0.075641f, -0.025409f, 0.074364f, 0.076893f, -0.111179f, -0.080744f, 0.011623f, -0.095977f, 0.054651f, 0.009251f, 0.051387f, 0.042521f, 0.007489f, -0.077435f, -0.050014f, -0.019858f, -0.014220f, 0.042604f, 0.022302f, -0.027480f, 0.100278f, 0.017830f, 0.056736f, 0.066833f, -0.063382f, -0.030391f, -0.099986f, -0.072631f, 0.000751f, -0.007886f, -0.025904f, 0.030937f, -0.031873f, -0.001743f, 0.086856f, 0.026874f, 0.045138f, 0.060611f, -0.012944f, -0.024265f, 0.003072f, 0.074061f, -0.044621f, 0.058859f, -0.075302f, -0.043046f, 0.064877f, 0.091953f, -0.069447f, -0.041016f, 0.045985f, -0.036763f, -0.067200f, -0.042350f, -0.053132f, 0.051513f, 0.002020f, -0.087336f, -0.009376f, -0.028946f, -0.067584f, 0.068130f, 0.062289f, 0.001266f, 0.022566f, -0.046718f, 0.095450f, -0.013281f, -0.063232f, -0.017615f, -0.035286f, -0.080782f, -0.016241f, 0.099770f, -0.030691f, 0.062187f, -0.083114f, -0.065044f, -0.024567f, -0.109956f, 0.001243f, 0.079188f, -0.058802f, 0.030621f, 0.072968f, 0.081096f, -0.089240f, 0.084281f, -0.087022f, -0.019822f, 0.063260f, -0.019853f, -0.094676f, 0.052286f, 0.025839f, -0.018807f, -0.029313f, 0.023295f, 0.075508f, -0.027943f, -0.033001f, -0.040161f, -0.048346f, 0.073971f, -0.070525f, 0.026264f, 0.040817f, -0.110362f, 0.008279f, -0.018412f, -0.069850f, 0.069311f, -0.028027f, -0.043163f, 0.048077f, -0.005175f, -0.036080f, 0.011441f, -0.011733f, 0.063665f, 0.045767f, 0.064739f, 0.071304f, 0.001754f, 0.049387f, -0.040164f, 0.061963f, -0.005789f, 0.025490f, -0.076482f, -0.098720f, -0.067111f, -0.111216f, 0.041597f, 0.056069f, -0.010179f, 0.005961f, -0.055055f, 0.051384f, 0.011120f, -0.017645f, 0.069483f, 0.052077f, -0.014125f, -0.025208f, -0.045618f, -0.051723f, -0.005840f, -0.042160f, -0.081912f, -0.050954f, -0.086175f, 0.046933f, -0.017281f, -0.076607f, -0.058321f, 0.055841f, 0.005953f, 0.007653f, -0.023916f, 0.057572f, 0.025531f, -0.066296f, -0.086419f, -0.044190f, 0.106214f, -0.095999f, -0.007674f, 0.097830f, -0.097270f, -0.046049f, 0.008946f, -0.085524f, 0.087654f, -0.089952f, -0.082368f, -0.068873f, 0.034794f, 0.073746f, -0.001142f, 0.016595f, -0.004234f, -0.006646f, -0.038621f, 0.048016f, 0.026278f, -0.007055f, 0.080685f, 0.045162f, 0.009756f, 0.082744f, 0.005986f, -0.096773f, 0.045365f, 0.079581f, -0.102971f, 0.035787f, 0.081789f, 0.045471f, -0.018323f, 0.047128f, -0.047238f, 0.048377f, 0.021729f, 0.019457f, -0.016774f, -0.064695f, -0.028503f, 0.013628f, 0.022092f, -0.054019f, 0.036934f, -0.039364f, 0.041775f, 0.031780f, -0.086481f, 0.012870f, -0.090171f, 0.076844f, -0.035000f, -0.109774f, -0.010588f, -0.087286f, 0.017379f, 0.058760f, 0.084956f, 0.077177f, -0.023410f, -0.018315f, 0.105250f, -0.015739f, -0.029489f, 0.092023f, -0.059011f, -0.023345f, -0.019401f, 0.061458f, -0.007093f, 0.058232f, 0.041021f, 0.071206f, -0.032299f, 0.056975f, -0.084881f, 0.049775f, 0.079075f, -0.033239f, 0.028216f, 0.101623f, -0.075617f, 0.038608f, -0.082702f, -0.016408f, -0.064495f, 0.024375f, 0.033821f, 0.078694f, 0.075710f, 0.084447f, -0.000271f, 0.087646f, -0.041166f, -0.066194f, 0.015091f, 0.017636f, 0.084991f, -0.080140f, 0.087924f, 0.005372f, 0.085123f, 0.063075f, -0.041179f, 0.027895f, -0.037746f, 0.065999f, -0.096764f, 0.017170f, -0.003239f, -0.059375f, 0.003075f, -0.044902f, 0.049962f, 0.065326f, 0.060537f, -0.029681f, -0.055270f, -0.024866f, -0.005735f, 0.009821f, 0.056336f, 0.037196f, -0.076079f, 0.036441f, -0.088077f, 0.091378f, 0.045213f, -0.093557f, 0.080471f, 0.020582f, 0.023081f, 0.007440f, 0.022345f, -0.000614f, 0.020778f, 0.046667f, -0.076744f, 0.087263f, -0.031072f, -0.079976f, 0.025814f, 0.020118f, -0.026477f, 0.023837f, 0.056714f, -0.029467f, -0.081165f, -0.010953f, -0.038000f, -0.052816f, 0.013153f, 0.064665f, -0.105940f, -0.012419f, -0.060979f, 0.054571f, -0.058012f, -0.013145f, -0.080622f, -0.083603f, -0.083973f, -0.043010f, 0.048709f, 0.025667f, 0.066170f, -0.052245f, 0.035932f, 0.050085f, -0.017802f, -0.063936f, 0.050678f, -0.012700f, -0.002311f, 0.051888f, -0.016329f, -0.051336f, 0.035212f, -0.059920f, -0.035973f, -0.062757f, -0.082413f, 0.065238f, 0.026205f, -0.012723f, 0.059393f, 0.097664f, -0.008578f, -0.000929f, 0.019630f, -0.059873f, -0.064077f, 0.013612f, -0.014765f, -0.026856f, 0.001756f, 0.061794f, 0.041449f, -0.082198f, 0.030580f, -0.104952f, -0.006788f, -0.019899f, 0.060297f, 0.083871f, 0.049552f, 0.039859f, 0.089737f, 0.007057f, -0.057757f, -0.036249f, -0.003369f, -0.021962f, -0.027257f, 0.110244f, 0.086887f, 0.012602f, 0.046664f, 0.055375f, 0.020717f, -0.083081f, -0.082732f, 0.064072f, -0.092592f, 0.040002f, 0.052784f, 0.060060f, -0.050977f, 0.014939f, -0.073383f, -0.003701f, 0.016793f, -0.006969f, -0.009215f, 0.074923f, -0.028840f, -0.050691f, 0.069944f, -0.015199f, -0.012745f, 0.082649f, -0.054660f, 0.043054f, 0.008303f, 0.020737f, -0.017070f, -0.036087f, -0.081873f, 0.108750f, 0.059180f, -0.007336f, 0.012293f, -0.088294f, -0.078871f, 0.056851f, -0.099474f, 0.062338f, 0.041994f, 0.016500f, -0.008113f, -0.015512f, 0.097979f, 0.067499f, 0.003079f, -0.076296f, -0.037672f, -0.099023f, 0.061835f, -0.035166f, 0.008634f, -0.009962f, 0.047156f, 0.032347f, -0.097542f, -0.008459f, -0.003106f, 0.057607f, 0.061076f, -0.079207f, 0.032751f, -0.108279f, 0.050213f, -0.041454f, -0.045915f, -0.039774f, 0.058645f, -0.046524f, 0.057201f, 0.032450f, 0.073543f, -0.042713f, 0.022111f, 0.049294f, 0.021063f, -0.079569f, -0.062827f, 0.037208f, 0.009369f, 0.061331f, 0.078903f, 0.065525f, -0.066638f, -0.026561f, 0.107728f, -0.008355f, -0.015373f, 0.106049f, 0.048347f, 0.028309f, -0.012155f, -0.063547f, 0.081203f, -0.093756f, 0.031452f, -0.093010f, -0.107402f, -0.106687f, 0.073198f, 0.002215f, 0.027167f, -0.087686f, 0.011209f, -0.010734f, -0.086045f, 0.003884f, 0.078612f, 0.028043f, -0.053127f, 0.078308f, 0.058508f, 0.095844f, 0.062462f, 0.000425f, 0.053705f, 0.038684f, -0.082275f, -0.070572f, -0.061273f, 0.025462f, 0.031949f, 0.072677f, 0.081698f, 0.000351f, 0.028912f, -0.064500f, 0.041445f, -0.053858f, 0.093771f, -0.068643f, 0.027006f, -0.069894f, 0.007797f, -0.083654f, 0.079856f, 0.006510f, 0.081894f, -0.059297f, 0.069188f, 0.056612f, -0.021111f, -0.090999f, 0.058656f, -0.067572f, 0.063618f, 0.041165f, -0.051784f, 0.077141f, 0.041981f, 0.009549f, 0.032397f, -0.021263f, -0.071765f, 0.020901f, -0.021471f, 0.099093f, -0.096946f, -0.056016f, 0.093376f, 0.005145f, -0.061203f, -0.034869f, -0.068620f, 0.011801f, 0.067010f, 0.029624f, 0.012670f, -0.026251f, 0.026704f, 0.089737f, -0.084010f, -0.068519f, 0.087423f, 0.052005f, -0.068917f, -0.064439f, -0.023797f, -0.025345f, -0.080248f, -0.078002f, -0.037381f, -0.057499f, 0.048868f, -0.006803f, -0.043817f, 0.081661f, 0.061764f, -0.005904f, 0.058484f, 0.010848f, 0.010232f, -0.064856f, -0.032573f, -0.096487f, -0.031270f, -0.096913f, -0.057447f, -0.003331f, 0.016509f, -0.044597f, -0.063068f, 0.060170f, -0.081209f, 0.019892f, 0.043149f, -0.046830f, 0.015934f, 0.032657f, 0.048218f, -0.074592f, 0.018327f, -0.079077f, -0.050704f, 0.077440f, -0.096359f, 0.055680f, 0.006763f, -0.107629f, 0.038076f, 0.056377f, -0.021161f, 0.070601f, 0.094859f, 0.014712f, 0.094829f, -0.007204f, 0.073569f, 0.051262f, 0.031538f, -0.007624f, -0.006978f, -0.075023f, -0.060114f, 0.049780f, -0.027862f, 0.031177f, 0.032541f, -0.041287f, -0.050714f, -0.039837f, -0.037483f, 0.020183f, -0.073774f, 0.056155f, 0.015466f, -0.077561f, -0.061323f, -0.052765f, 0.021267f, 0.028607f, -0.020258f, 0.067820f, -0.072010f, 0.047193f, 0.060632f, -0.052866f, 0.072447f, 0.057373f, 0.063565f, 0.049562f, -0.074173f, -0.039275f, 0.066683f, -0.071903f, 0.059573f, 0.019606f, -0.011386f, 0.030211f, -0.061156f, 0.018110f, 0.024251f, -0.037929f, -0.073451f, 0.094168f, 0.089984f, -0.088505f, -0.069278f, -0.032394f, 0.102816f, -0.007307f, -0.041871f, 0.081953f, -0.046866f, 0.051958f, -0.089192f, 0.012686f, -0.069793f, -0.048567f, -0.025211f, 0.038408f, -0.002187f, -0.053106f, 0.055878f, 0.009320f, -0.082141f, -0.099248f, -0.097918f, -0.034990f, -0.039143f, 0.047985f, 0.037928f, 0.061486f, 0.043566f, 0.065806f, 0.026172f, -0.088465f, 0.036938f, -0.023064f, 0.069153f, -0.019027f, -0.056566f, 0.035588f, 0.068736f, -0.076081f, -0.037208f, -0.064543f, 0.070530f, -0.048158f, -0.022975f, -0.032376f, 0.064739f, -0.026170f, -0.060197f, -0.075975f, 0.007580f, -0.064178f, 0.049182f, -0.066317f, -0.003135f, 0.037024f, 0.077701f, 0.089899f, 0.033160f, -0.052013f, -0.072944f, 0.059347f, -0.024041f, -0.091031f, 0.068991f, -0.006255f, 0.072247f, 0.005074f, 0.074343f, -0.005653f, -0.056458f, 0.084864f, -0.085079f, -0.056822f, 0.086057f, 0.064539f, 0.081560f, 0.002023f, -0.024511f, -0.042602f, -0.073007f, -0.102393f, -0.048237f, -0.037800f, 0.017436f, -0.050334f, 0.066180f, 0.099731f, -0.000788f, -0.100893f, -0.062345f, -0.052038f, 0.088659f, 0.063176f, 0.093087f, -0.036331f, -0.055828f, -0.009056f, -0.025848f, -0.009737f, -0.024267f, -0.096212f, -0.023784f, 0.061318f, 0.006787f, 0.068054f, 0.026583f, 0.069551f, 0.023162f, 0.023982f, -0.081404f, 0.070808f, 0.084820f, 0.055725f, -0.076543f, -0.070382f, -0.032721f, 0.055750f, 0.082016f, -0.075027f, 0.024360f, -0.059042f, -0.089373f, 0.012254f, 0.057775f, 0.012521f, 0.043001f, -0.007939f, -0.054559f, 0.071704f, -0.029491f, -0.003878f, -0.092255f, -0.098848f, 0.047167f, 0.067931f, 0.015132f, 0.064799f, 0.040172f, -0.058623f, -0.069615f, 0.087558f, -0.052353f, 0.034209f, -0.038709f, -0.000698f, -0.013588f, 0.052483f, 0.060758f, 0.079050f, -0.073727f, 0.001867f, -0.017804f, -0.103377f, -0.042826f, -0.004566f, 0.087527f, -0.041169f, 0.027380f, 0.077534f, -0.050602f, -0.091365f, 0.087053f, -0.078613f, -0.054611f, 0.087028f, -0.038761f, -0.047950f, 0.061741f, 0.061099f, -0.062996f, -0.016193f, 0.061693f, -0.007735f, -0.067491f, 0.049784f, -0.066187f, 0.073190f, -0.005671f, 0.009185f, 0.033849f, -0.011285f, 0.104771f, -0.060025f, 0.090311f, -0.006034f, 0.040452f, 0.059826f, 0.011217f, 0.045448f, 0.011827f, 0.027785f, -0.075886f, 0.067984f, -0.050031f, -0.005095f, -0.018041f, -0.025025f, -0.052222f, -0.002406f, 0.072297f, 0.015602f, -0.041612f, 0.069962f, -0.071770f, -0.009140f, 0.038112f, 0.064258f, 0.070528f, -0.066626f, 0.012769f, -0.073291f, -0.053995f, 0.056520f, -0.043974f, -0.061722f, -0.049835f, -0.009804f, 0.038541f, 0.012557f, 0.065122f, -0.031547f, -0.009949f, -0.054395f, -0.073955f, 0.105320f, -0.064952f, 0.003713f, 0.028169f, 0.054159f, -0.049895f, -0.009758f, -0.019672f, -0.097072f, -0.058112f, 0.000852f, -0.108017f, -0.100977f, -0.074899f, 0.037310f, 0.064617f, 0.084643f, -0.080703f, 0.014761f, -0.028666f, -0.099424f, -0.086770f, -0.074248f, 0.009212f, -0.026795f, -0.065291f, -0.064334f, 0.078967f, -0.083433f, 0.002088f, -0.100430f, -0.065283f, -0.020057f, -0.072524f, 0.016932f, -0.037396f, 0.040303f, 0.038079f, 0.087831f, -0.033005f, -0.006273f, 0.023673f, -0.004821f, -0.036061f, -0.088663f, -0.044048f, 0.073170f, 0.031381f, -0.110600f, 0.041538f, -0.078326f, 0.073184f, 0.016657f, 0.066377f, 0.083515f, 0.078879f, -0.037614f, -0.059912f, -0.034886f, -0.055411f, 0.052589f, 0.015328f, -0.039032f, 0.069832f, -0.021575f, -0.091306f, -0.057449f, -0.030245f, -0.092840f, 0.038273f, -0.045045f, 0.029273f, -0.079233f, -0.075337f, -0.050660f, -0.094337f, 0.106648f, -0.066745f, 0.067794f, 0.024320f, 0.078386f, 0.082861f, 0.079273f, 0.008843f, 0.108078f, -0.043879f, -0.021879f, 0.054728f, 0.004739f, 0.082444f, 0.063294f, -0.069808f, 0.048278f, 0.082981f, 0.020666f, 0.086571f, -0.005694f, 0.040880f, -0.041066f, -0.059570f, 0.040340f, -0.062902f, -0.058299f, -0.039291f, 0.011212f, -0.044244f, -0.021245f, 0.003688f, -0.008376f, -0.079783f, -0.026525f, 0.006858f, -0.055507f, -0.015660f, 0.023563f, 0.063716f, 0.035784f, -0.064329f, -0.058194f, -0.090629f, -0.032288f, 0.077832f, -0.079879f, -0.027511f, 0.003480f, 0.005816f, 0.000927f, -0.084772f, 0.038472f, 0.071550f, -0.039403f, -0.082043f, 0.067077f, 0.049528f, 0.072509f, 0.090640f, -0.071832f, 0.020812f, 0.039876f, -0.014541f, 0.015665f, -0.000317f, -0.083667f, 0.065540f, -0.060238f, -0.082082f, 0.036178f, 0.006212f, -0.056632f, 0.113147f, -0.036952f, -0.046029f, -0.061922f, -0.007093f, -0.067094f, -0.081271f, 0.029365f, -0.091493f, 0.049843f, -0.090498f, -0.032521f, -0.055672f, 0.087818f, -0.033872f, -0.010138f, -0.043082f, -0.003970f, 0.087530f, 0.013032f, 0.031541f, -0.041761f, -0.043099f, -0.083450f, 0.078729f, -0.036987f, 0.060111f, 0.032033f, 0.038078f, -0.024707f, -0.027784f, -0.020140f, 0.033466f, 0.096351f, 0.004786f, 0.019429f, 0.055353f, 0.077186f, 0.013438f, 0.067757f, -0.007319f, -0.074927f, 0.041138f, -0.034166f, 0.088712f, -0.071627f, 0.009657f, 0.002842f, 0.065584f, 0.078496f, 0.090162f, -0.105126f, 0.111703f, 0.052373f, -0.059499f, -0.032480f, 0.087787f, 0.066630f, -0.084942f, -0.063541f, -0.072041f, -0.035931f, -0.017383f, 0.018097f, -0.074747f, 0.067847f, 0.014812f, -0.065033f, 0.076464f, 0.073713f, 0.062437f, 0.004969f, 0.024284f, -0.076068f, 0.054394f, 0.024697f, 0.042667f, 0.076220f, 0.061748f, 0.061897f, -0.006504f, 0.051169f, 0.086344f, -0.042235f, 0.044136f, -0.039580f, -0.027477f, -0.006730f, -0.011023f, 0.041629f, -0.063097f, 0.052579f, -0.085328f, -0.076346f, -0.034050f, 0.067477f, -0.042216f, 0.076263f, 0.035335f, 0.027301f, 0.004066f, 0.012334f, -0.049289f, 0.062862f, -0.012775f, -0.001900f, 0.042391f, 0.061688f, 0.051152f, -0.001324f, -0.022357f, -0.053616f, -0.075774f, 0.099632f, -0.067101f, -0.028300f, 0.081879f, -0.001803f, 0.054756f, 0.050493f, -0.102856f, -0.077041f, -0.086571f, -0.014595f, 0.064675f, 0.048116f, -0.063317f, 0.001312f, 0.056979f, 0.063796f, 0.081023f, 0.009473f, -0.030346f, 0.047389f, 0.019083f, 0.079796f, 0.006929f, 0.020417f, -0.016872f, 0.029377f, -0.044558f, -0.097522f, 0.002589f, -0.057648f, 0.045259f, -0.080087f, 0.053472f, 0.037949f, -0.037837f, -0.050293f, 0.083935f, -0.029457f, -0.063583f, 0.011139f, -0.076828f, -0.070189f, -0.082843f, 0.010049f, -0.036558f, 0.026527f, -0.093238f, -0.023819f, -0.032400f, 0.035653f, 0.082701f, -0.015612f, 0.026014f, 0.052884f, 0.059424f, 0.042739f, -0.034463f, -0.089734f, -0.061188f, 0.031608f, 0.001127f, 0.015991f, -0.078813f, -0.001847f, -0.083001f, 0.046642f, -0.035807f, 0.024050f, -0.008136f, -0.083654f, -0.083513f, 0.091761f, 0.059921f, 0.066527f, 0.024528f, -0.019114f, 0.082987f, 0.095313f, -0.079465f, -0.089690f, 0.007999f, 0.052892f, -0.020214f, -0.065139f, -0.027536f, -0.071384f, 0.050914f, 0.016809f, -0.025364f, -0.087122f, 0.020218f, 0.006015f, 0.047511f, 0.056379f, -0.075326f, -0.037061f, -0.019636f, -0.047649f, -0.053055f, -0.102587f, -0.008647f, -0.002475f, -0.014962f, -0.083090f, -0.089362f, 0.058923f, 0.050220f, -0.054713f, 0.034568f, 0.070997f, 0.047702f, -0.022983f, -0.065150f, -0.074023f, 0.011315f, -0.021217f, 0.031927f, 0.046652f, -0.071404f, 0.079020f, -0.045407f, -0.009004f, 0.028121f, -0.078483f, 0.055622f, -0.044674f, 0.076692f, -0.062163f, -0.015523f, -0.071948f, 0.044705f, -0.004248f, -0.062052f, 0.058393f, 0.051449f, -0.019991f, -0.052988f, 0.078608f, 0.001765f, -0.021914f, -0.047432f, 0.049559f, 0.001612f, 0.040354f, -0.016861f, -0.082959f, -0.040379f, -0.086909f, -0.078588f, 0.102626f, -0.076516f, -0.026666f, 0.069832f, -0.028193f, -0.064701f, -0.025338f, 0.048881f, -0.103867f, 0.004773f, -0.064565f, -0.090877f, 0.058128f, -0.100664f, -0.005995f, 0.022795f, -0.056496f, 0.078650f, -0.014982f, -0.048025f, 0.007736f, 0.012903f, -0.005566f, -0.106542f, 0.045286f, -0.063245f, -0.060541f, 0.065823f, -0.012580f, -0.009856f, 0.045295f, 0.010776f, 0.009077f, -0.016849f, 0.085558f, 0.020510f, 0.064412f, 0.080913f, 0.060507f, -0.005695f, 0.019717f, -0.043925f, 0.095642f, 0.081010f, 0.072421f, -0.096867f, -0.076635f, 0.067077f, 0.072743f, 0.053042f, -0.026443f, -0.059563f, 0.065212f, -0.021577f, -0.033514f, -0.044988f, 0.092037f, -0.044600f, 0.051730f, -0.004451f, -0.037427f, 0.002289f, -0.025274f, -0.009695f, 0.009680f, 0.023317f, 0.074807f, 0.014226f, -0.067527f, -0.052513f, -0.026248f, 0.046558f, 0.063679f, -0.095758f, 0.080117f, -0.015649f, -0.084461f, -0.001203f, 0.005416f, -0.073196f, 0.016429f, 0.097657f, 0.004568f, -0.040047f, 0.029140f, -0.056486f, 0.091306f, -0.008166f, 0.038732f, -0.104725f, 0.059204f, -0.061530f, -0.067544f, 0.079153f, -0.087723f, -0.026033f, -0.030479f, 0.066521f, -0.078659f, 0.035634f, -0.051067f, -0.043924f, -0.002747f, 0.003737f, -0.049041f, 0.022542f, 0.036490f, -0.010571f, -0.041938f, -0.018219f, -0.094372f, 0.033725f, -0.094082f, -0.045858f, 0.093964f, -0.074225f, 0.015881f, -0.057373f, 0.092889f, 0.055652f, -0.021534f, 0.060576f, -0.002849f, -0.054530f, -0.055575f, -0.061639f, 0.020051f, 0.077087f, 0.041963f, 0.069067f, -0.050792f, 0.071483f, -0.099959f, 0.103915f, -0.077519f, -0.009167f, -0.013735f, -0.018530f, 0.032334f, 0.071609f, 0.030384f, -0.009795f, -0.060522f, 0.076889f, 0.007391f, -0.030194f, -0.001654f, -0.089508f, -0.067674f, 0.083357f, -0.067748f, -0.048453f, -0.003511f, -0.020916f, 0.028420f, -0.019281f, -0.005007f, -0.053358f, -0.014183f, -0.031783f, 0.078175f, -0.059181f, 0.009510f, 0.093205f, -0.062799f, 0.056093f, 0.083330f, -0.018777f, 0.028883f, -0.084095f, -0.044504f, -0.047850f, 0.018040f, -0.070235f, 0.016420f, -0.000739f, 0.075273f, 0.093843f, -0.110630f, 0.004483f, -0.013346f, 0.024814f, 0.014105f, -0.031584f, 0.035409f, 0.074531f, 0.085360f, 0.048498f, 0.015399f, -0.005016f, 0.055161f, 0.066262f, -0.087861f, -0.088035f, -0.021331f, 0.075283f, -0.068234f, -0.085351f, 0.076449f, 0.061797f, -0.060290f, 0.073104f, 0.045516f, 0.091344f, -0.063978f, 0.072962f, -0.075668f, 0.047115f, 0.040101f, 0.082241f, -0.049882f, -0.050071f, -0.011232f, 0.074075f, -0.026939f, 0.042517f, -0.021370f, -0.059312f, 0.043199f, 0.055952f, -0.108293f, 0.016107f, 0.002358f, -0.004951f, 0.042810f, -0.026969f, 0.018656f, -0.006205f, -0.024161f, -0.000006f, -0.056858f, 0.044061f, -0.051076f, 0.013358f, -0.030238f, 0.080920f, 0.081141f, 0.084384f, -0.043676f, 0.061180f, 0.082496f, 0.000007f, -0.075695f, 0.027641f, 0.075772f, 0.065568f, -0.076778f, -0.099174f, 0.009829f, 0.098862f, 0.030094f, 0.097229f, 0.034417f, 0.060260f, 0.078588f, -0.005075f, -0.092325f, -0.064966f, 0.074749f, -0.034268f, 0.006734f, -0.053199f, 0.069055f, 0.075564f, 0.073581f, 0.080419f, -0.003493f, 0.005703f, 0.077670f, -0.038930f, 0.038878f, 0.002770f, -0.029003f, 0.097270f, 0.023912f, 0.005903f, -0.091230f, -0.078333f, 0.018463f, 0.092300f, -0.023999f, 0.007498f, 0.082208f, 0.088768f, -0.038619f, -0.056767f, 0.077153f, 0.019294f, 0.069840f, -0.052998f, -0.089779f, 0.086868f, -0.003729f, -0.011597f, 0.102070f, -0.019440f, 0.028353f, 0.049551f, -0.038080f, -0.038252f, 0.062275f, 0.074740f, -0.074014f, -0.050752f, -0.097839f, -0.035366f, 0.089176f, -0.032552f, 0.062373f, -0.074891f, 0.018509f, 0.081499f, 0.108628f, 0.020308f, -0.110912f, 0.067168f, 0.061241f, -0.104769f, 0.042793f, 0.032107f, -0.085934f, -0.003547f, 0.018336f, 0.065102f, -0.030240f, 0.028798f, 0.001313f, 0.021708f, 0.085262f, 0.102348f, 0.066771f, -0.053471f, 0.088411f, -0.054484f, -0.109225f, 0.004304f, -0.084533f, -0.013116f, 0.033753f, 0.055069f, -0.026960f, 0.064535f, -0.092752f, 0.016522f, -0.043160f, -0.008912f, -0.041928f, -0.044796f, 0.079080f, 0.069675f, 0.054754f, -0.020777f, 0.022710f, 0.004877f, -0.061870f, -0.093437f, 0.097375f, 0.051164f, 0.067323f, -0.069313f, 0.089999f, -0.072509f, 0.054174f, 0.052555f, 0.028560f, 0.052933f, -0.038254f, 0.019510f, -0.085226f, 0.081764f, -0.072882f, -0.023120f, 0.085456f, 0.075383f, -0.104881f, 0.009928f, -0.010565f, 0.058614f, 0.028320f, -0.086077f, -0.005073f, 0.028476f, 0.103477f, -0.009367f, 0.100701f, 0.011004f, -0.023680f, -0.012507f, 0.002987f, -0.029977f, -0.029978f, 0.078591f, -0.016320f, 0.061201f, -0.003036f, -0.057430f, 0.088122f, 0.071485f, -0.059033f, 0.087535f, -0.052028f, 0.014948f, 0.087495f, 0.026477f, -0.069995f, -0.059753f, 0.050974f, 0.032790f, 0.031542f, -0.053607f, -0.054114f, 0.032921f, -0.066141f, -0.066401f, -0.074849f, 0.063371f, 0.028417f, 0.084051f, -0.036327f, 0.025411f, 0.067734f, -0.051424f, 0.001202f, 0.075698f, 0.078421f, 0.012390f, 0.003999f, 0.097603f, 0.035916f, -0.051791f, -0.013938f, -0.000180f, 0.022799f, -0.032725f, -0.075235f, 0.059524f, -0.086435f, -0.066750f, -0.062582f, -0.095842f, 0.087202f, 0.094735f, -0.086857f, -0.007584f, -0.010739f, -0.087156f, 0.088791f, 0.058349f, 0.034368f, -0.058154f, -0.032706f, -0.068568f, 0.051328f, -0.018938f, -0.075360f, -0.100427f, -0.058595f, 0.089290f, -0.107198f, 0.065951f, -0.098129f, 0.019152f, -0.016052f, 0.005721f, -0.053027f, -0.017829f, -0.026611f, 0.053395f, 0.067715f, -0.028882f, 0.072267f, -0.099501f, 0.040650f, -0.011905f, 0.078396f, -0.046423f, -0.036552f, 0.047379f, 0.052960f, 0.009653f, 0.061989f, -0.004594f, 0.085366f, 0.092284f, -0.008377f, 0.091465f, 0.059832f, 0.010023f, 0.109450f, 0.040320f, -0.044809f, -0.069762f, -0.031829f, 0.061532f, -0.005230f, -0.032848f, 0.046100f, -0.105524f, 0.071359f, 0.035092f, -0.050643f, -0.009769f, -0.092706f, -0.102349f, 0.109717f, -0.004970f, -0.041625f, -0.053799f, 0.075158f, 0.028401f, -0.106532f, 0.046002f, -0.075550f, 0.075775f, -0.024072f, -0.019516f, -0.115339f, 0.080398f, -0.048871f, 0.029046f, 0.099603f, -0.051082f, 0.057277f, 0.005905f, 0.099442f, 0.043742f, -0.025713f, -0.082462f, -0.097248f, 0.059913f, -0.017544f, 0.019768f, 0.081369f, -0.041063f, 0.076464f, -0.099922f, -0.054900f, 0.042267f, 0.087269f, 0.094718f, -0.024820f, 0.066750f, 0.079628f, -0.010747f, -0.058024f, -0.079064f, 0.037896f, -0.067090f, -0.006448f, -0.024665f, -0.003652f, 0.092518f, 0.000877f, 0.077242f, 0.046919f, -0.040300f, -0.053335f, -0.008821f, 0.040346f, 0.022691f, 0.082893f, 0.094724f, 0.007305f, -0.099786f, 0.015297f, -0.001005f, -0.005964f, -0.077685f, 0.081163f, -0.092333f, -0.035003f, -0.085110f, 0.019746f, -0.032193f, -0.014998f, 0.069654f, 0.083917f, -0.064168f, -0.057913f, -0.001256f, -0.087673f, -0.038303f, -0.045020f, 0.067476f, -0.074033f, 0.049489f, -0.059249f, 0.019277f, 0.015755f, -0.009136f, 0.072587f, -0.042763f, 0.002461f, 0.095918f, -0.057819f, 0.022753f, -0.054047f, -0.087073f, 0.084713f, -0.000272f, 0.028977f, -0.001454f, -0.055005f, 0.015830f, -0.093016f, 0.034387f, -0.089604f, -0.043621f, -0.053074f, -0.042727f, 0.070957f, -0.033262f, -0.097046f, -0.082002f, -0.058115f, -0.035692f, -0.069281f, -0.041550f, -0.047572f, -0.028290f, 0.017497f, 0.090363f, 0.039531f, -0.078197f, 0.071666f, 0.026626f, 0.073242f, -0.024983f, 0.060661f, 0.042254f, -0.038462f, -0.027538f, 0.083439f, 0.078392f, -0.062957f, 0.065428f, 0.097369f, 0.059262f, -0.005347f, -0.004569f, 0.054815f, 0.048848f, 0.054183f, -0.050351f, 0.007935f, -0.099373f, -0.046827f, -0.062196f, -0.037611f, 0.043328f, -0.062624f, -0.076822f, 0.055170f, 0.066323f, 0.002602f, -0.035498f, -0.046898f, -0.002625f, 0.070072f, 0.024656f, 0.010127f, 0.081921f, -0.071539f, -0.009279f, -0.018902f, -0.006628f, -0.051712f, -0.056968f, -0.029027f, 0.029653f, -0.053598f, 0.013349f, 0.089368f, -0.105596f, -0.017896f, 0.008560f, 0.051733f, -0.040272f, 0.067068f, -0.009837f, -0.065411f, 0.026284f, -0.083568f, 0.045907f, -0.082719f, 0.035120f, 0.058230f, 0.026688f, 0.018379f, -0.025686f, -0.023434f, -0.038480f, -0.012998f, 0.018257f, -0.075047f, 0.066941f, 0.035477f, -0.032477f, 0.077017f, 0.076393f, 0.035860f, -0.036293f, -0.036967f, -0.087198f, -0.027287f, -0.062156f, 0.029171f, 0.037340f, -0.058918f, 0.026075f, 0.043660f, 0.045802f, 0.063855f, -0.038453f, 0.011875f, -0.037767f, -0.035727f, -0.063811f, -0.040963f, -0.007735f, -0.058688f, -0.042245f, 0.065353f, -0.083050f, -0.049137f, -0.089965f, 0.044916f, -0.003661f, -0.014689f, -0.109345f, 0.108348f, 0.075303f, 0.076096f, 0.085749f, 0.038407f, -0.085050f, 0.081353f, 0.094829f, 0.026125f, -0.036696f, -0.081616f, 0.009468f, 0.031181f, 0.109346f, -0.056406f, -0.082790f, -0.026859f, 0.049956f, -0.048983f, 0.048257f, 0.095671f, 0.045888f, -0.086962f, 0.001001f, -0.104514f, -0.075887f, 0.059352f, -0.045782f, -0.003016f, 0.034063f, -0.082361f, 0.075598f, -0.076846f, 0.079722f, -0.064941f, 0.074245f, -0.015529f, 0.069865f, -0.016684f, 0.045977f, 0.056399f, 0.009092f, -0.031053f, -0.036843f, -0.092014f, -0.109454f, 0.032145f, -0.010342f, -0.071432f, 0.067160f, 0.025587f, -0.004428f, -0.016944f, -0.020334f, -0.018283f, 0.077581f, -0.019324f, -0.079782f, -0.082838f, -0.043537f, -0.048802f, 0.047480f, 0.110761f, -0.041886f, 0.003152f, -0.086035f, -0.072923f, -0.054526f, -0.023319f, 0.080679f, -0.032709f, 0.046963f, 0.015742f, 0.040106f, -0.072998f, -0.087935f, -0.039122f, -0.092793f, 0.029314f, 0.023536f, 0.071251f, -0.008042f, -0.030119f, 0.069966f, -0.004634f, -0.019716f, 0.088950f, -0.043947f, -0.023195f, -0.059593f, -0.082439f, 0.017615f, 0.087819f, 0.022959f, 0.049395f, 0.088305f, 0.025575f, -0.024287f, 0.070052f, -0.087663f, 0.090194f, -0.010801f, -0.003721f, 0.088895f, 0.049111f, -0.090747f, -0.062036f, 0.028714f, -0.086627f, -0.049931f, -0.061752f, 0.037398f, -0.103437f, -0.044378f, -0.025337f, -0.098010f, 0.004799f, 0.020351f, 0.093124f, 0.086588f, 0.097263f, -0.032019f, -0.073421f, 0.015631f, -0.047310f, 0.012542f, -0.073874f, -0.102085f, 0.002721f, 0.034536f, -0.091657f, 0.018749f, -0.027680f, -0.033900f, -0.069210f, -0.065782f, 0.065319f, -0.077465f, -0.054190f, 0.011684f, 0.044457f, -0.004891f, -0.037438f, -0.044584f, 0.022205f, 0.043444f, 0.099882f, 0.056347f, -0.027662f, -0.060338f, -0.000184f, 0.032494f, -0.072982f, -0.098879f, -0.042608f, -0.002874f, 0.025195f, -0.103040f, 0.014510f, -0.051803f, -0.045498f, -0.010169f, 0.007010f, -0.029616f, -0.093157f, -0.063259f, 0.004208f, -0.035569f, 0.104111f, 0.049509f, -0.001851f, 0.026249f, -0.100576f, 0.052688f, 0.028819f, 0.020147f, 0.037407f, 0.061836f, -0.038490f, -0.080694f, 0.015764f, -0.034718f, -0.015085f, -0.101798f, -0.026146f, 0.074644f, 0.041915f, 0.056835f, 0.032687f, 0.006001f, 0.087097f, -0.020736f, 0.074731f, -0.043984f, -0.063813f, -0.049170f, -0.046879f, -0.020204f, 0.064868f, 0.027631f, 0.017089f, -0.018107f, 0.048679f, -0.006774f, 0.033906f, 0.019705f, -0.022603f, -0.081318f, -0.085938f, 0.015825f, -0.100927f, 0.007547f, 0.097556f, 0.004866f, 0.083364f, -0.029960f, 0.014776f, 0.073481f, -0.022616f, 0.024212f, 0.053379f, -0.021499f, -0.111147f, 0.091060f, -0.009208f, -0.078320f, 0.056152f, -0.038484f, -0.053538f, -0.060885f, 0.041014f, 0.096254f, -0.032928f, 0.055596f, 0.018321f, -0.031810f, -0.092723f, -0.032685f, -0.107080f, 0.094055f, -0.020656f, 0.010175f, 0.083613f, 0.016742f, -0.052843f, 0.094715f, -0.054150f, -0.069809f, -0.022048f, 0.001183f, 0.079457f, -0.002836f, 0.075828f, 0.036916f, -0.005525f, -0.091744f, -0.068481f, 0.097827f, 0.056765f, -0.032283f, 0.064207f, 0.095076f, 0.069344f, 0.072637f, -0.050943f, 0.065507f, -0.100554f, 0.061453f, 0.025274f, 0.030666f, -0.000481f, 0.029011f, -0.076190f, -0.080358f, 0.077372f, -0.039922f, 0.042454f, 0.025178f, 0.025379f, -0.091260f, -0.089710f, -0.034992f, 0.072012f, -0.049389f, -0.009504f, 0.021584f, 0.016808f, -0.074056f, 0.024568f, 0.081412f, 0.030808f, 0.001244f, 0.083167f, 0.052289f, -0.073752f, -0.008762f, 0.075800f, 0.037268f, 0.053070f, -0.084404f, -0.019093f, 0.038094f, 0.029056f, -0.086493f, 0.025093f, 0.010555f, -0.037855f, -0.053238f, -0.079063f, -0.006884f, -0.036182f, 0.000547f, 0.054148f, -0.056446f, -0.009508f, 0.045589f, -0.038056f, 0.066779f, 0.070121f, -0.093018f, -0.062494f, 0.036677f, -0.009219f, 0.087798f, 0.043295f, 0.014120f, -0.089198f, -0.092031f, -0.022495f, -0.024452f, 0.100946f, 0.043303f, -0.035746f, -0.013525f, -0.068808f, -0.050580f, -0.047655f, 0.027471f, -0.061134f, 0.051486f, -0.084315f, 0.067608f, 0.016844f, 0.005128f, -0.063130f, 0.033934f, -0.040413f, 0.071204f, 0.045327f, 0.078643f, 0.055149f, -0.039231f, -0.002569f, 0.027224f, -0.030741f, 0.049184f, -0.046731f, -0.064170f, -0.078577f, 0.017023f, -0.039442f, 0.067155f, 0.035561f, -0.058253f, -0.002817f, 0.109414f, 0.079599f, 0.090089f, -0.060709f, 0.050734f, -0.014513f, 0.044588f, -0.093228f, 0.034285f, 0.021701f, -0.059523f, 0.015512f, 0.069106f, 0.026717f, -0.067832f, -0.027572f, -0.040268f, -0.038593f, 0.017090f, 0.105284f, 0.008663f, 0.069901f, 0.099684f, -0.041063f, -0.097243f, 0.037996f, 0.054426f, -0.046909f, -0.040188f, 0.055267f, -0.055385f, 0.079891f, 0.082639f, 0.027414f, -0.054450f, 0.075233f, -0.050046f, -0.054879f, 0.005413f, 0.023829f, -0.019862f, -0.107115f, 0.081848f, -0.107186f, 0.063231f, 0.069713f, 0.102702f, -0.050328f, -0.051338f, -0.102328f, 0.032923f, -0.057902f, -0.067207f, -0.042556f, -0.048011f, -0.043965f, 0.034463f, 0.003159f, 0.029127f, 0.016195f, 0.073487f, -0.101770f, -0.005244f, -0.026237f, 0.041220f, -0.068267f, 0.026921f, -0.047459f, -0.057021f, -0.036873f, -0.081912f, 0.059105f, 0.079900f, -0.087565f, 0.032855f, 0.017414f, 0.092869f, 0.022625f, -0.029044f, 0.031466f, -0.088179f, -0.052340f, -0.061805f, 0.001917f, -0.043974f, -0.091219f, 0.000914f, 0.038654f, -0.061429f, 0.031373f, -0.093652f, 0.048988f, 0.096701f, -0.022335f, -0.083061f, -0.032002f, -0.083835f, -0.009984f, -0.052230f, 0.110774f, -0.004718f, -0.005425f, -0.082876f, 0.001793f, -0.089719f, -0.033677f, -0.053413f, -0.083223f, 0.051883f, -0.086749f, 0.000800f, -0.035517f, -0.057356f, -0.036476f, 0.051620f, 0.043700f, -0.017893f, -0.023574f, 0.030566f, -0.027130f, 0.059636f, -0.052943f, -0.081211f, 0.007875f, -0.047319f, -0.020790f, -0.052586f, 0.087625f, 0.090383f, 0.006946f, 0.076187f, -0.052875f, 0.042140f, 0.043881f, -0.043415f, 0.055677f, -0.065070f, -0.050568f, -0.042536f, 0.038015f, -0.045512f, -0.048087f, -0.055972f, 0.097390f, 0.083626f, 0.050690f, -0.027265f, 0.010188f, -0.015535f, -0.020215f, -0.060657f, -0.060331f, -0.047654f, 0.069030f, 0.023620f, -0.084287f, -0.000678f, -0.019283f, -0.081588f, 0.055661f, 0.003507f, -0.014336f, -0.064756f, -0.016314f, -0.047288f, -0.000343f, -0.031567f, -0.045475f, -0.021839f, 0.013070f, 0.061868f, -0.049019f, -0.046472f, 0.039142f, 0.109810f, -0.064831f, -0.061014f, 0.054712f, 0.043991f, -0.027844f, -0.092210f, 0.000541f, 0.000719f, 0.036523f, 0.041955f, 0.042384f, 0.044278f, 0.059027f, -0.005460f, -0.094076f, 0.077824f, 0.005515f, -0.072538f, 0.070738f, -0.002866f, -0.050664f, 0.009451f, 0.050093f, 0.063394f, -0.108614f, -0.041758f, -0.096057f, 0.053836f, 0.030582f, -0.055113f, 0.055534f, 0.018990f, 0.042808f, 0.036945f, -0.065474f, 0.000658f, 0.017814f, -0.024052f, 0.056182f, 0.002258f, -0.024831f, -0.060557f, 0.034839f, -0.087835f, -0.006094f, 0.012598f, -0.029636f, -0.053381f, -0.016618f, -0.064831f, 0.057028f, 0.016733f, -0.101394f, 0.090415f, 0.035371f, 0.109232f, 0.047604f, 0.075018f, 0.049170f, -0.026098f, 0.035226f, -0.084722f, 0.008079f, 0.097187f, -0.009053f, 0.097826f, -0.038544f, 0.001912f, 0.022538f, 0.086987f, 0.050278f, 0.013156f, -0.072069f, -0.040384f, -0.073940f, 0.001534f, 0.084631f, 0.070147f, -0.013396f, -0.013766f, -0.092468f, 0.050080f, -0.038421f, -0.086595f, 0.080482f, -0.017093f, 0.029628f, 0.012038f, 0.067613f, 0.094897f, 0.030038f, -0.070914f, 0.022683f, -0.077396f, -0.043662f, -0.096004f, -0.025537f, 0.062128f, -0.042655f, 0.047988f, -0.015363f, -0.024403f, 0.053732f, -0.020147f, 0.094821f, -0.041412f, 0.060622f, -0.045808f, 0.021017f, -0.065594f, -0.102142f, -0.023367f, -0.052065f, -0.017464f, -0.060262f, -0.079923f, 0.056592f, -0.021423f, -0.047350f, 0.090697f, -0.019641f, -0.004295f, 0.102856f, -0.088675f, -0.066673f, 0.028497f, 0.000999f, -0.012254f, -0.070080f, 0.010353f, 0.006033f, 0.051881f, -0.052506f, -0.019156f, -0.025280f, -0.072748f, 0.019443f, 0.051604f, -0.103566f, 0.003228f, 0.062852f, 0.018087f, 0.081809f, -0.098253f, -0.073255f, -0.036837f, -0.112316f, 0.000788f, 0.010750f, -0.029727f, -0.023222f, 0.058143f, 0.034111f, -0.032011f, -0.033444f, -0.044206f, -0.032347f, 0.045728f, 0.020677f, -0.058202f, 0.018829f, 0.067093f, -0.058677f, -0.110695f, -0.031794f, 0.095250f, -0.106034f, -0.064521f, -0.079433f, 0.053846f, 0.088044f, 0.004461f, -0.093288f, 0.003143f, 0.070008f, -0.048603f, -0.030971f, 0.048041f, -0.023334f, 0.040956f, 0.042728f, 0.058732f, 0.005521f, -0.006474f, 0.027794f, -0.066318f, -0.066779f, 0.071048f, 0.053285f, -0.030704f, 0.004564f, -0.000007f, -0.022550f, -0.059534f, -0.069959f, 0.049955f, 0.042984f, 0.095093f, -0.052174f, 0.076518f, 0.036896f, 0.017278f, 0.040203f, 0.050210f, 0.010076f, 0.029003f, 0.076245f, 0.059316f, -0.097200f, 0.060801f, 0.105383f, -0.003076f, -0.103426f, 0.049778f, -0.020572f, 0.061939f, -0.078545f, -0.027399f, -0.098856f, -0.025017f, -0.068132f, 0.009202f, 0.049873f, -0.050681f, -0.058848f, -0.086309f, -0.045080f, 0.045036f, -0.000196f, -0.053435f, -0.036348f, -0.014231f, -0.077078f, 0.009911f, 0.001561f, 0.061009f, 0.035964f, -0.043796f, -0.051087f, 0.089508f, 0.076509f, -0.084451f, -0.079712f, -0.000682f, 0.054023f, 0.085436f, -0.077178f, 0.077081f, 0.003393f, 0.018601f, -0.046031f, -0.061734f, 0.026251f, -0.048213f, -0.084794f, 0.108427f, -0.027517f, -0.067649f, 0.045338f, 0.067951f, -0.029677f, 0.032566f, -0.064445f, -0.027724f, -0.041124f, -0.035967f, 0.088617f, -0.091796f, -0.000682f, 0.031046f, -0.043301f, -0.066730f, 0.055626f, -0.079480f, 0.013922f, 0.102605f, 0.063932f, -0.020303f, 0.029910f, 0.022479f, 0.040904f, -0.032472f, 0.007341f, -0.077900f, -0.046464f, -0.005692f, -0.080233f, -0.079142f, -0.046460f, -0.005597f, 0.004223f, 0.017760f, 0.098198f, 0.021626f, -0.066925f, -0.049270f, -0.057445f, 0.071283f, -0.014036f, -0.076848f, 0.083088f, -0.011759f, 0.007606f, 0.093837f, 0.026833f, -0.013619f, 0.069285f, 0.086976f, 0.005454f, 0.046541f, 0.051146f, -0.034920f, -0.083011f, -0.003168f, -0.077599f, 0.048666f, 0.046119f, 0.028198f, 0.072598f, 0.093636f, -0.001002f, 0.028059f, 0.109917f, 0.087453f, 0.016368f, -0.011960f, 0.059696f, -0.100514f, -0.074997f, 0.036908f, -0.085092f, 0.066682f, -0.006779f, 0.080304f, -0.099339f, -0.011381f, -0.052355f, -0.079375f, -0.008185f, -0.099229f, -0.073368f, -0.023276f, -0.036483f, 0.055260f, -0.029674f, -0.020592f, 0.081885f, -0.049828f, 0.037809f, -0.007750f, -0.091211f, 0.045947f, 0.108448f, -0.017637f, 0.006251f, 0.047296f, 0.067192f, 0.010706f, -0.054670f, -0.039138f, 0.055957f, -0.068871f, 0.012389f, -0.013956f, -0.014830f, 0.068335f, -0.052910f, 0.109619f, -0.027682f, 0.078936f, -0.053303f, 0.046467f, 0.019066f, 0.049444f, 0.091134f, 0.052942f, 0.015415f, 0.035691f, 0.040628f, 0.007558f, -0.062947f, -0.067088f, -0.082283f, 0.064061f, -0.043150f, 0.044054f, -0.089239f, 0.018107f, -0.076560f, 0.020699f, -0.078695f, 0.034359f, 0.040887f, -0.004609f, -0.016521f, -0.068515f, 0.072839f, -0.005595f, 0.033638f, 0.039402f, -0.084375f, -0.045842f, -0.039056f, 0.088164f, -0.048776f, 0.081144f, 0.041864f, 0.021070f, -0.059932f, -0.091363f, -0.014270f, 0.014274f, -0.038085f, 0.079337f, 0.027667f, 0.087709f, 0.071685f, -0.010499f, -0.061065f, 0.010234f, -0.056261f, -0.012700f, -0.003115f, 0.013804f, -0.068794f, -0.087026f, -0.001835f, -0.003891f, -0.084084f, 0.009593f, -0.059382f, 0.106298f, 0.059803f, -0.015449f, 0.078416f, -0.075415f, 0.061931f, 0.034148f, -0.099027f, 0.004591f, 0.038605f, 0.013197f, 0.035934f, 0.042130f, 0.013917f, 0.051811f, -0.086643f, 0.106963f, -0.027011f, -0.031991f, -0.017618f, 0.086509f, 0.090765f, 0.058546f, -0.044628f, -0.047783f, 0.077758f, 0.043294f, -0.052714f, 0.070425f, 0.068689f, 0.030842f, 0.083845f, -0.006684f, 0.068644f, -0.053829f, 0.072661f, -0.021884f, -0.079668f, -0.072708f, 0.019390f, 0.056305f, -0.075390f, -0.002176f, 0.061665f, 0.010984f, -0.009870f, -0.049124f, -0.088539f, -0.045097f, -0.025665f, -0.041483f, -0.069119f, -0.058332f, 0.007105f, 0.096241f, -0.029812f, -0.020957f, -0.039820f, 0.028641f, 0.056628f, 0.031103f, 0.107461f, 0.095408f, 0.053264f, -0.087975f, 0.060304f, 0.007353f, 0.037684f, 0.102920f, -0.040411f, -0.016059f, 0.026727f, -0.025722f, 0.053715f, -0.008301f, -0.083578f, 0.065843f, -0.000375f, 0.023729f, -0.009135f, 0.026750f, 0.098958f, -0.017362f, 0.056004f, 0.088652f, -0.090796f, 0.015673f, 0.004650f, 0.081441f, 0.103122f, -0.073640f, -0.091370f, -0.003296f, -0.079857f, -0.007995f, 0.032040f, 0.062720f, 0.082668f, 0.079526f, 0.064386f, -0.035235f, -0.039225f, 0.047358f, -0.012389f, -0.083697f, 0.002879f, -0.011317f, -0.078864f, -0.014860f, 0.103011f, 0.095624f, 0.084695f, 0.001927f, -0.065120f, -0.054979f, -0.073322f, -0.079251f, 0.086848f, -0.047707f, -0.036213f, -0.070108f, -0.106440f, 0.100891f, 0.046158f, -0.023592f, -0.077894f, 0.099809f, 0.002199f, 0.023351f, -0.075047f, -0.027589f, -0.035166f, -0.074816f, 0.061492f, -0.069201f, -0.098644f, 0.112012f, 0.101532f, 0.042642f, 0.056375f, -0.052036f, -0.092798f, 0.059413f, -0.016699f, -0.021643f, 0.022860f, 0.043419f, 0.004218f, -0.094807f, -0.012855f, -0.092343f, -0.065022f, 0.042483f, -0.061424f, -0.053625f, 0.106150f, 0.045312f, 0.038442f, -0.032738f, -0.080684f, 0.077038f, 0.068062f, 0.088538f, -0.044771f, -0.061677f, -0.013814f, 0.055221f, 0.110367f, 0.061579f, -0.108856f, -0.096710f, 0.021418f, -0.085721f, 0.018660f, -0.103383f, 0.046512f, -0.033175f, 0.063417f, 0.024804f, 0.001330f, -0.017320f, -0.069077f, 0.034517f, 0.021696f, 0.076136f, -0.107637f, -0.052141f, 0.019297f, 0.014771f, -0.013499f, -0.085706f, 0.080717f, -0.030743f, -0.013394f, 0.001964f, 0.019946f, -0.047799f, -0.011674f, 0.088733f, -0.075567f, 0.026621f, 0.111916f, -0.014711f, 0.068565f, -0.078958f, -0.009290f, -0.107336f, -0.037985f, 0.098470f, -0.029676f, 0.002352f, -0.034527f, 0.048030f, -0.010566f, -0.001572f, -0.076079f, 0.035181f, 0.020763f, 0.105910f, 0.068112f, -0.031914f, -0.034395f, 0.035859f, -0.018356f, -0.006150f, 0.091589f, -0.095361f, 0.003021f, 0.039352f, -0.056085f, 0.011207f, 0.045941f, -0.034880f, 0.104457f, -0.068649f, 0.001110f, 0.053097f, -0.005627f, 0.016641f, -0.018075f, -0.099333f, -0.018540f, -0.097049f, 0.064181f, -0.008185f, -0.014299f, 0.051042f, 0.017213f, -0.021331f, -0.068430f, 0.014056f, -0.073519f, -0.017918f, 0.084483f, -0.034981f, -0.026469f, -0.089922f, 0.087564f, -0.097208f, 0.015943f, 0.101724f, 0.094555f, -0.080485f, -0.028334f, -0.068919f, -0.035667f, -0.025797f, -0.051995f, 0.039253f, -0.034271f, -0.032192f, -0.050350f, -0.036981f, -0.010551f, -0.023547f, 0.020377f, 0.059351f, -0.089432f, -0.079483f, -0.054152f, -0.093142f, -0.047729f, -0.103822f, 0.050722f, 0.064279f, -0.078898f, -0.041230f, 0.010160f, -0.079576f, -0.071839f, -0.086083f, -0.083064f, 0.025606f, 0.007947f, -0.059309f, -0.052798f, -0.032137f, 0.007391f, 0.095382f, 0.036686f, -0.020678f, 0.065295f, 0.001340f, 0.010559f, 0.018266f, -0.022058f, -0.000600f, -0.089352f, 0.048889f, 0.098999f, 0.088579f, -0.101358f, 0.077964f, 0.050374f, -0.058326f, 0.038534f, -0.096992f, 0.047160f, 0.058119f, 0.106286f, 0.001987f, 0.006109f, 0.001962f, 0.012650f, 0.056785f, 0.056441f, -0.104830f, 0.024633f, 0.041550f, 0.039014f, 0.049860f, 0.034862f, -0.061964f, 0.029568f, 0.053559f, -0.084199f, -0.024978f, -0.072419f, -0.100775f, 0.053749f, -0.009044f, 0.060013f, -0.052471f, -0.060073f, -0.066791f, 0.050028f, -0.034233f, 0.036264f, -0.046088f, -0.009709f, 0.071128f, 0.030056f, -0.017375f, 0.062833f, -0.020061f, 0.047861f, 0.074815f, -0.042074f, 0.003524f, 0.008468f, 0.004947f, 0.026627f, 0.076681f, 0.013365f, 0.065180f, 0.095118f, 0.002771f, -0.049989f, 0.015639f, 0.057767f, 0.015930f, -0.079946f, -0.079689f, -0.040912f, -0.044406f, 0.077408f, 0.046872f, -0.072039f, -0.054453f, -0.100683f, -0.038593f, -0.027317f, -0.035906f, 0.058443f, 0.022930f, -0.064446f, 0.039293f, -0.026926f, 0.050287f, -0.013273f, -0.063373f, -0.079154f, 0.026772f, -0.022319f, -0.033641f, 0.045166f, 0.021935f, 0.059694f, 0.026345f, -0.060992f, -0.060849f, 0.014971f, 0.015961f, 0.029984f, 0.012578f, 0.104501f, 0.089799f, -0.035716f, 0.050219f, 0.066302f, 0.079947f, -0.020550f, 0.081216f, -0.032922f, 0.046269f, 0.010033f, -0.043358f, -0.052434f, 0.020435f, 0.062942f, -0.015253f, -0.079848f, -0.048359f, -0.027855f, -0.010626f, 0.038438f, -0.071815f, -0.069389f, -0.054584f, -0.059137f, -0.049385f, -0.109507f, -0.056152f, 0.029047f, 0.080090f, -0.003901f, 0.064669f, -0.053102f, 0.085629f, -0.107530f, -0.096933f, -0.023364f, 0.090634f, -0.000608f, -0.093113f, 0.076601f, -0.057105f, -0.037619f, -0.079260f, 0.094913f, -0.111514f, 0.063438f, -0.054785f, -0.043990f, -0.043549f, -0.053288f, -0.060959f, 0.055283f, -0.032742f, -0.013881f, -0.063852f, 0.073775f, 0.003996f, -0.040999f, -0.054231f, 0.085287f, -0.063633f, -0.067293f, 0.044108f, -0.057245f, -0.062936f, 0.033719f, -0.022907f, -0.048773f, 0.002051f, 0.019552f, 0.043221f, -0.034375f, -0.003090f, -0.046170f, 0.071080f, -0.011749f, 0.011787f, -0.010237f, 0.093982f, 0.059623f, 0.080985f, -0.055842f, -0.019142f, 0.002072f, 0.053219f, 0.045665f, -0.001387f, 0.018773f, 0.005825f, 0.044791f, -0.013418f, 0.047035f, 0.063398f, 0.023902f, -0.045333f, 0.006251f, 0.003955f, 0.076838f, -0.003318f, 0.064185f, 0.093541f, 0.043870f, -0.067340f, -0.028424f, 0.024361f, -0.032084f, -0.051124f, 0.002035f, 0.034882f, 0.038666f, 0.014842f, -0.055972f, -0.040557f, -0.031864f, -0.040254f, -0.039391f, -0.004796f, -0.083333f, -0.061786f, -0.010716f, -0.097258f, -0.008192f, 0.054637f, 0.078575f, -0.007522f, -0.065369f, 0.008233f, -0.055089f, 0.086414f, 0.062503f, -0.065644f, -0.095833f, 0.096016f, 0.102787f, -0.066538f, -0.063053f, 0.039799f, 0.080932f, -0.033662f, -0.040607f, -0.013466f, -0.011256f, -0.028074f, -0.003835f, 0.061539f, -0.003199f, -0.061880f, 0.066019f, 0.005837f, -0.053420f, -0.043044f, 0.000252f, -0.084004f, -0.093542f, 0.027851f, 0.060139f, -0.018955f, 0.078548f, -0.001763f, 0.059414f, 0.089976f, 0.047202f, -0.023426f, -0.094191f, -0.077420f, -0.034079f, -0.093493f, 0.053820f, -0.002155f, 0.060838f, 0.009153f, -0.081783f, 0.082294f, 0.088555f, 0.023505f, 0.028082f, -0.078201f, 0.020851f, -0.064357f, -0.015275f, -0.049773f, 0.055984f, 0.003682f, -0.098919f, -0.060383f, -0.004601f, 0.104258f, -0.063129f, 0.062145f, -0.079000f, 0.030445f, -0.043799f, 0.048549f, 0.016674f, 0.069603f, -0.061822f, -0.046962f, 0.046165f, -0.034344f, -0.091963f, 0.044343f, -0.080538f, -0.091106f, 0.001884f, -0.032923f, -0.078998f, 0.037566f, -0.017507f, 0.030464f, -0.032048f, 0.071485f, 0.026142f, 0.063809f, 0.030577f, -0.017491f, -0.015977f, 0.073688f, -0.104740f, -0.075649f, 0.041493f, 0.031567f, 0.082062f, 0.051103f, 0.097059f, 0.081532f, -0.028823f, 0.051111f, -0.035687f, 0.101094f, 0.083178f, 0.042905f, -0.021985f, 0.098977f, -0.102801f, -0.015806f, 0.012940f, -0.012472f, -0.063982f, -0.009223f, 0.055152f, 0.064912f, 0.058909f, -0.084551f, 0.017255f, -0.067043f, 0.041292f, -0.037625f, 0.008777f, -0.066235f, 0.023725f, 0.083216f, -0.027675f, -0.091213f, 0.103024f, 0.028257f, 0.050818f, 0.086796f, 0.086491f, -0.010383f, 0.111106f, -0.024572f, -0.061832f, 0.077022f, 0.088386f, -0.092194f, 0.031658f, -0.044304f, 0.061833f, -0.052404f, -0.000729f, -0.075021f, 0.056940f, -0.084951f, 0.024835f, -0.069203f, 0.061002f, -0.047620f, 0.052902f, 0.015823f, 0.054296f, 0.016559f, 0.003749f, 0.007881f, -0.040289f, 0.016276f, -0.055873f, -0.058059f, 0.009892f, -0.042285f, 0.010524f, -0.029855f, -0.077669f, 0.091588f, -0.016306f, 0.078168f, -0.030653f, -0.101933f, -0.043179f, 0.080607f, -0.022808f, 0.082988f, -0.012648f, -0.046488f, 0.043262f, -0.094722f, 0.063478f, 0.001639f, -0.015463f, -0.046854f, 0.007205f, 0.101301f, -0.040799f, -0.059768f, -0.038394f, -0.076940f, -0.065048f, 0.020209f, 0.023712f, -0.033212f, 0.100752f, -0.062438f, 0.054551f, -0.014052f, -0.068159f, -0.046478f, -0.050425f, 0.074919f, -0.021494f, 0.024691f, -0.028122f, 0.072510f, 0.038050f, -0.076666f, 0.020334f, 0.109508f, 0.052631f, -0.043927f, 0.037652f, -0.028380f, -0.002498f, 0.008044f, 0.048334f, -0.048163f, -0.012385f, 0.014277f, -0.099615f, -0.058517f, 0.010238f, -0.075645f, 0.050917f, -0.095904f, 0.052063f, 0.067400f, 0.025968f, 0.093856f, 0.021330f, -0.040882f, 0.049980f, -0.048439f, 0.072727f, 0.026948f, 0.018026f, 0.024788f, -0.008139f, -0.035258f, -0.002507f, -0.066175f, 0.012970f, 0.017250f, 0.016543f, 0.043604f, 0.102218f, -0.007037f, -0.105635f, 0.084922f, -0.087465f, 0.034638f, -0.052945f, -0.056508f, 0.076169f, -0.082611f, -0.107185f, -0.006755f, 0.026629f, -0.067877f, 0.051866f, 0.078516f, 0.014810f, -0.060143f, 0.060632f, 0.083788f, 0.057662f, 0.017435f, 0.057057f, -0.040941f, 0.001953f, -0.097450f, -0.049743f, 0.085139f, 0.067991f, 0.012731f, 0.069156f, -0.005828f, 0.097078f, 0.089890f, 0.019564f, -0.077860f, 0.080698f, 0.093916f, 0.073438f, -0.017194f, -0.024404f, -0.096302f, 0.087290f, 0.042798f, 0.061751f, 0.051872f, 0.048427f, -0.081218f, -0.026947f, 0.078803f, 0.031903f, 0.048877f, 0.060815f, -0.075627f, 0.050339f, -0.078671f, 0.073916f, -0.050989f, -0.066548f, -0.049445f, -0.068414f, 0.010426f, 0.071765f, 0.039888f, 0.079175f, 0.036197f, 0.057398f, -0.031546f, -0.080025f, -0.036062f, 0.059238f, -0.027174f, -0.069315f, -0.000169f, 0.038322f, -0.055649f, 0.038038f, 0.001401f, 0.030572f, -0.104236f, -0.037253f, -0.024019f, -0.090223f, 0.049893f, -0.041245f, -0.033012f, -0.105387f, -0.060416f, 0.059432f, 0.003831f, 0.028819f, -0.059876f, -0.077161f, 0.002290f, -0.062164f, -0.074624f, -0.067378f, 0.064470f, -0.077316f, 0.090566f, 0.085924f, -0.053443f, 0.083466f, -0.043592f, 0.088736f, -0.080807f, -0.078459f, -0.030469f, -0.078380f, -0.034255f, 0.006607f, -0.062583f, -0.089720f, -0.005161f, -0.080914f, 0.022856f, 0.042394f, -0.013502f, -0.069168f, 0.037319f, -0.047104f, -0.007791f, -0.051745f, 0.020568f, 0.046795f, 0.058367f, 0.042599f, 0.026558f, 0.028790f, -0.047429f, -0.105902f, 0.025450f, 0.026242f, -0.025617f, 0.038595f, -0.035744f, -0.042536f, -0.031790f, 0.049728f, -0.074930f, 0.105612f, -0.044319f, 0.010461f, -0.041248f, -0.021733f, -0.006505f, -0.009671f, -0.056959f, -0.093412f, 0.064383f, -0.024145f, -0.037135f, -0.071010f, -0.059646f, 0.078657f, 0.036885f, -0.062238f, -0.051545f, 0.112050f, 0.010121f, -0.084161f, 0.053607f, -0.008823f, 0.019685f, 0.018429f, -0.067584f, -0.078127f, 0.035200f, -0.037748f, 0.027895f, -0.084102f, 0.073787f, 0.007921f, -0.009829f, 0.046845f, -0.006531f, 0.016716f, -0.078190f, 0.068640f, 0.010088f, 0.053199f, 0.096263f, -0.000004f, -0.067864f, -0.078461f, 0.004083f, 0.018565f, -0.024088f, -0.012277f, -0.064087f, -0.082912f, 0.095204f, -0.043381f, -0.003049f, -0.044125f, 0.098245f, -0.091960f, -0.062495f, -0.033196f, -0.010332f, -0.090797f, -0.060144f, 0.055666f, 0.000193f, -0.056089f, 0.076071f, 0.051397f, -0.055150f, 0.088736f, 0.059871f, 0.089717f, -0.084589f, 0.016938f, -0.041863f, -0.076399f, -0.057942f, 0.046967f, 0.009129f, -0.051789f, -0.073081f, -0.074049f, 0.015870f, -0.015267f, -0.016329f, -0.066686f, 0.001713f, -0.040018f, 0.082853f, 0.043395f, -0.002370f, 0.068955f, -0.000010f, 0.080452f, 0.002205f, 0.099712f, -0.079603f, 0.056757f, -0.090237f, -0.089950f, 0.054331f, 0.049191f, 0.036081f, 0.067341f, -0.023861f, -0.086176f, -0.074690f, 0.030625f, -0.044494f, 0.027820f, -0.027123f, -0.062752f, 0.057239f, -0.077563f, 0.047075f, 0.064786f, -0.069702f, -0.059341f, 0.065992f, 0.005808f, 0.001941f, 0.046517f, 0.056577f, -0.088220f, 0.011238f, -0.053293f, 0.031374f, 0.103949f, -0.069546f, 0.014508f, 0.027496f, -0.002935f, 0.010578f, -0.003297f, 0.082523f, -0.016993f, 0.068202f, 0.097687f, 0.041300f, 0.019731f, 0.027298f, -0.081007f, -0.047563f, -0.024755f, -0.017609f, -0.083850f, -0.048598f, 0.040734f, -0.102548f, 0.036355f, -0.012311f, 0.088268f, -0.026146f, 0.105134f, 0.081331f, -0.064576f, 0.064683f, -0.023753f, -0.008099f, -0.021292f, -0.084732f, 0.011635f, -0.076895f, 0.078779f, -0.006038f, 0.048551f, -0.023068f, -0.044865f, 0.014226f, 0.038662f, -0.042879f, 0.061665f, -0.061255f, -0.080540f, -0.064266f, -0.035444f, -0.002658f, -0.054335f, -0.050388f, -0.010376f, -0.071519f, 0.082487f, 0.025711f, -0.086043f, 0.106876f, -0.053782f, -0.055598f, 0.082323f, 0.045331f, -0.015144f, 0.065040f, -0.024820f, -0.109608f, 0.057691f, -0.043739f, -0.022550f, 0.091548f, 0.006530f, 0.064617f, 0.021472f, 0.000592f, 0.051675f, 0.092072f, 0.026626f, -0.084777f, -0.035671f, 0.057082f, -0.100780f, 0.089967f, 0.017403f, -0.059231f, 0.003336f, -0.108756f, -0.096844f, 0.005288f, -0.049435f, -0.075750f, 0.089018f, 0.035502f, -0.094504f, -0.054714f, -0.048713f, 0.075540f, -0.028424f, 0.002323f, 0.010742f, 0.083012f, -0.107475f, -0.026307f, -0.082953f, 0.070132f, -0.034329f, 0.065612f, 0.014501f, 0.098518f, 0.004301f, -0.020032f, 0.058309f, -0.052533f, 0.030121f, -0.080689f, 0.034463f, 0.062467f, -0.088572f, 0.091206f, -0.060200f, 0.037573f, 0.070193f, 0.038875f, -0.000377f, 0.032996f, -0.048418f, -0.022108f, 0.053155f, -0.073378f, 0.001524f, 0.079752f, -0.071015f, -0.069960f, -0.069703f, -0.084021f, 0.074490f, 0.037943f, -0.060936f, -0.015933f, 0.009280f, 0.043540f, -0.035790f, -0.044422f, -0.017711f, -0.081805f, -0.104759f, 0.027238f, -0.008382f, -0.047877f, -0.020935f, -0.069755f, -0.010215f, 0.026081f, 0.089751f, 0.009935f, -0.044179f, 0.002930f, -0.068248f, 0.068217f, 0.100312f, -0.103285f, 0.061514f, -0.010167f, 0.065693f, 0.018439f, -0.049967f, -0.098475f, 0.079716f, 0.036082f, -0.053223f, -0.078909f, 0.020878f, 0.048004f, 0.010785f, -0.091376f, 0.087422f, -0.028028f, -0.094033f, 0.050941f, 0.008522f, -0.011668f, 0.026277f, -0.021504f, -0.066876f, 0.062844f, 0.072286f, -0.046861f, -0.048624f, 0.037150f, 0.042184f, -0.091351f, 0.071976f, -0.016823f, -0.061201f, 0.042321f, -0.048827f, 0.083525f, 0.072929f, -0.078808f, 0.071512f, -0.060421f, -0.054462f, 0.098988f, -0.061086f, 0.042198f, 0.033416f, -0.069209f, 0.065632f, -0.083739f, 0.025768f, -0.099998f, 0.022792f, 0.009038f, -0.024360f, 0.013713f, 0.042520f, 0.035792f, -0.054340f, -0.022586f, 0.086735f, 0.078009f, -0.040692f, 0.082406f, 0.100415f, 0.045205f, -0.065125f, -0.071576f, 0.004810f, -0.072871f, 0.064924f, -0.008634f, -0.044305f, 0.005649f, 0.079153f, 0.074831f, -0.061960f, -0.000479f, 0.002472f, -0.072802f, 0.005947f, 0.067923f, 0.058879f, 0.038655f, -0.073128f, -0.094629f, -0.076004f, -0.078437f, 0.067556f, -0.044244f, -0.024278f, -0.065659f, -0.005206f, -0.017486f, -0.033533f, 0.083556f, -0.050923f, 0.023846f, 0.072821f, 0.021122f, 0.051030f, 0.057489f, 0.040045f, -0.008067f, -0.069093f, 0.102234f, 0.043454f, -0.112127f, -0.024381f, -0.083957f, 0.055686f, -0.049849f, 0.002454f, -0.058194f, 0.016439f, 0.045432f, 0.035178f, -0.003652f, 0.080389f, 0.036635f, -0.006891f, 0.063771f, -0.069576f, -0.083244f, 0.098162f, -0.061893f, 0.018324f, 0.011648f, -0.008677f, -0.026534f, 0.012932f, -0.023304f, 0.031320f, -0.081664f, -0.063901f, 0.014497f, -0.007023f, -0.034594f, -0.091970f, -0.057264f, 0.014975f, -0.011802f, -0.024302f, -0.078948f, -0.075089f, 0.069942f, 0.011394f, 0.089953f, -0.058491f, -0.061012f, -0.108342f, 0.034606f, 0.037749f, -0.065712f, -0.028476f, -0.063699f, -0.082100f, 0.015797f, -0.030164f, -0.022290f, 0.007987f, -0.043653f, -0.109683f, -0.032566f, 0.083551f, 0.067064f, 0.088854f, -0.067272f, 0.048807f, 0.011885f, -0.053685f, 0.025625f, 0.016353f, -0.064379f, 0.043112f, 0.062896f, -0.033449f, -0.094251f, -0.042116f, 0.071675f, -0.007777f, 0.045893f, 0.005312f, 0.102228f, 0.023227f, 0.058254f, -0.016837f, 0.000530f, -0.039548f, -0.034340f, -0.002299f, 0.022290f, -0.074017f, -0.105902f, -0.078751f, 0.009318f, 0.018132f, 0.010192f, -0.016550f, 0.005541f, -0.032700f, 0.098418f, 0.054461f, -0.003973f, 0.031865f, 0.030157f, -0.063075f, -0.063010f, 0.087450f, -0.036565f, 0.068860f, 0.047476f, 0.059013f, -0.051219f, 0.091585f, 0.070166f, -0.101242f, 0.061357f, 0.021793f, 0.023961f, 0.054396f, -0.065300f, -0.041438f, 0.064704f, -0.021945f, 0.023385f, 0.079518f, 0.072386f, 0.006492f, 0.082644f, -0.025622f, -0.027897f, 0.071363f, 0.038727f, 0.018035f, -0.068480f, 0.029235f, 0.085467f, -0.060247f, -0.096805f, -0.103530f, 0.013742f, -0.103770f, 0.080320f, 0.056449f, 0.064154f, 0.027863f, -0.106757f, 0.021895f, -0.068376f, -0.077245f, -0.071754f, -0.059977f, 0.018303f, 0.003628f, 0.041123f, 0.068703f, -0.034971f, -0.018312f, -0.017623f, -0.087475f, 0.083013f, -0.013038f, 0.024648f, -0.068654f, 0.068838f, -0.029966f, 0.031476f, -0.011553f, 0.056690f, 0.021686f, 0.082729f, -0.033488f, -0.013335f, 0.045109f, 0.030240f, -0.091102f, -0.048657f, -0.084412f, -0.045372f, -0.007306f, 0.107588f, -0.036849f, 0.003374f, -0.095441f, -0.023211f, -0.027803f, -0.030970f, -0.088401f, 0.020800f, -0.099778f, 0.020660f, -0.036888f, 0.040573f, -0.001328f, 0.100869f, -0.038656f, 0.075191f, 0.100791f, -0.105071f, 0.019044f, -0.041071f, -0.065337f, 0.004660f, 0.083244f, -0.088706f, 0.078410f, 0.075379f, 0.061730f, -0.096634f, -0.023408f, -0.083194f, -0.025465f, -0.068889f, -0.080079f, 0.015512f, 0.009477f, 0.087766f, -0.076276f, -0.045166f, 0.029720f, -0.095943f, 0.086288f, 0.072163f, 0.012442f, 0.066926f, -0.012892f, -0.082449f, -0.037894f, 0.021165f, 0.032649f, -0.072365f, -0.002292f, 0.049416f, 0.041362f, -0.072156f, -0.019897f, -0.079274f, -0.067477f, -0.050839f, -0.024797f, 0.009822f, 0.046261f, 0.070413f, 0.019485f, -0.047370f, -0.082160f, 0.084845f, -0.021874f, 0.013413f, 0.043829f, 0.063714f, 0.051841f, 0.003139f, -0.028216f, 0.055337f, -0.016115f, -0.093512f, 0.068570f, 0.022196f, 0.007847f, 0.106929f, 0.026320f, -0.073583f, -0.033563f, 0.011623f, 0.049740f, 0.051498f, 0.021899f, -0.098601f, -0.039899f, -0.028090f, 0.073878f, -0.072982f, -0.057793f, -0.078421f, 0.005553f, -0.062751f, 0.098391f, -0.002759f, 0.084124f, -0.044315f, 0.001393f, 0.036129f, 0.073985f, 0.016137f, 0.110467f, 0.046121f, 0.023355f, 0.071508f, 0.029091f, -0.078481f, 0.058900f, -0.050389f, -0.082453f, -0.045282f, 0.058131f, 0.025161f, -0.042279f, 0.062583f, -0.067547f, -0.054882f, 0.056923f, -0.017023f, -0.020029f, 0.017422f, 0.095518f, 0.103372f, -0.096283f, 0.072967f, 0.102752f, -0.043744f, -0.108346f, -0.041487f, 0.041779f, -0.068615f, -0.047034f, -0.080873f, -0.073373f, 0.084663f, 0.004963f, 0.073403f, -0.059575f, 0.021239f, 0.032876f, 0.053551f, -0.016866f, -0.037182f, 0.015527f, -0.009649f, 0.022164f, 0.073484f, -0.034908f, 0.006350f, -0.044701f, 0.008837f, 0.061915f, -0.047192f, 0.082326f, 0.037304f, 0.053819f, 0.073569f, 0.012940f, -0.042569f, 0.109259f, -0.029492f, -0.052188f, -0.007450f, -0.003619f, -0.075673f, -0.013296f, -0.050479f, 0.089281f, 0.085659f, 0.007964f, 0.050581f, 0.000889f, -0.037040f, 0.047194f, -0.048332f, -0.040847f, 0.056336f, -0.010918f, -0.072270f, -0.094567f, 0.060987f, -0.085418f, 0.089469f, 0.080724f, -0.026887f, -0.061839f, 0.057545f, 0.062454f, 0.100308f, -0.066870f, 0.100913f, 0.006128f, 0.012990f, 0.034847f, -0.049962f, -0.039645f, 0.064637f, 0.013449f, 0.053308f, -0.026857f, -0.081024f, -0.064709f, -0.034897f, -0.018193f, -0.046831f, 0.050134f, 0.040532f, 0.040898f, 0.050216f, 0.000510f, 0.048257f, 0.075357f, 0.020686f, 0.074687f, 0.027477f, 0.018611f, -0.013833f, 0.025267f, 0.046268f, 0.093895f, -0.093898f, 0.012678f, -0.030785f, 0.087104f, -0.053647f, 0.051707f, -0.087673f, 0.067077f, 0.061871f, 0.058163f, 0.069066f, 0.023592f, -0.040266f, 0.060181f, 0.041699f, 0.047713f, 0.022212f, 0.054026f, -0.076610f, 0.091157f, -0.041881f, 0.071114f, -0.088583f, 0.095650f, 0.096662f, 0.084946f, 0.015613f, -0.070366f, -0.072796f, 0.007390f, 0.022733f, 0.014021f, -0.087864f, 0.062463f, 0.054158f, 0.059600f, -0.031019f, 0.028245f, 0.011723f, 0.083288f, -0.017212f, 0.046467f, 0.024275f, -0.025072f, -0.024531f, -0.021991f, 0.043802f, 0.048385f, -0.061530f, 0.044519f, -0.009782f, -0.037766f, -0.019848f, -0.078820f, -0.053775f, -0.059191f, -0.024575f, -0.010116f, 0.098899f, 0.052421f, 0.000237f, -0.036569f, -0.056425f, -0.011234f, 0.012104f, -0.057351f, 0.088677f, 0.032028f, -0.004881f, 0.044861f, -0.081862f, 0.082470f, -0.109910f, -0.007262f, 0.016643f, -0.063378f, 0.031312f, 0.076413f, -0.088281f, -0.088763f, 0.058262f, 0.043088f, -0.021021f, -0.020000f, -0.020247f, 0.054036f, -0.081634f, 0.069372f, -0.085129f, 0.051409f, 0.017885f, 0.079219f, -0.058466f, -0.053514f, -0.041816f, -0.009668f, -0.025418f, -0.033489f, -0.057322f, 0.036417f, -0.095128f, 0.066644f, -0.015668f, 0.051626f, -0.074220f, 0.073715f, -0.028982f, -0.110838f, 0.054047f, 0.031427f, 0.019716f, 0.037498f, -0.064399f, -0.046271f, -0.092073f, 0.094217f, -0.017030f, -0.078643f, -0.110718f, 0.047118f, -0.039039f, -0.058436f, 0.003674f, -0.020020f, 0.009299f, -0.098938f, -0.040807f, 0.101961f, -0.043041f, -0.028827f, -0.060546f, 0.014175f, -0.006572f, -0.029029f, -0.028056f, 0.053293f, -0.004809f, -0.051370f, -0.020401f, 0.094728f, 0.001983f, -0.082950f, 0.071944f, 0.065204f, -0.015328f, -0.096104f, 0.056127f, -0.048507f, -0.001297f, 0.070697f, 0.011240f, -0.043944f, 0.085435f, 0.084311f, 0.035088f, -0.110354f, -0.100014f, 0.001961f, 0.045118f, -0.052324f, 0.093273f, 0.069483f, 0.070570f, 0.015707f, -0.022365f, -0.068764f, 0.079808f, -0.056870f, -0.072431f, 0.069973f, 0.001169f, 0.103368f, 0.066232f, -0.036842f, 0.045506f, 0.003984f, -0.006776f, 0.023589f, -0.007262f, -0.085819f, -0.056554f, -0.003842f, -0.089731f, 0.063370f, -0.029854f, -0.095054f, 0.082489f, -0.097750f, -0.073791f, 0.067115f, 0.086671f, -0.091255f, -0.091823f, -0.000222f, -0.028712f, 0.094139f, 0.003383f, 0.027780f, -0.044650f, -0.047368f, 0.021937f, 0.001635f, -0.004852f, 0.062532f, -0.026659f, -0.013046f, -0.007600f, -0.101519f, 0.053341f, -0.023668f, 0.017372f, 0.084800f, -0.034651f, 0.049343f, 0.019560f, 0.019863f, 0.093492f, -0.028237f, -0.077798f, -0.037164f, -0.085909f, 0.046713f, 0.111434f, 0.080297f, 0.046743f, 0.017891f, 0.023954f, -0.000174f, -0.028019f, -0.058306f, 0.045258f, -0.103052f, -0.048789f, -0.111419f, 0.007385f, -0.016832f, -0.022292f, 0.020795f, -0.090638f, -0.030182f, -0.039426f, 0.065342f, 0.042779f, -0.064669f, 0.070570f, -0.007636f, 0.043658f, 0.049905f, -0.043358f, 0.004247f, 0.022744f, 0.082113f, -0.084028f, 0.053758f, -0.010550f, -0.057658f, -0.037854f, -0.058127f, -0.069186f, -0.041657f, 0.002845f, 0.029121f, 0.077822f, -0.044020f, -0.095970f, -0.007150f, 0.052399f, 0.064532f, -0.060031f, -0.046125f, -0.086844f, -0.018395f, -0.016446f, -0.003390f, 0.034353f, -0.000114f, -0.088596f, 0.034905f, -0.052979f, 0.041206f, 0.060947f, -0.029003f, -0.081595f, 0.097918f, -0.029959f, 0.058031f, -0.016613f, 0.056890f, 0.015432f, -0.027361f, -0.085356f, -0.081606f, 0.041184f, -0.088674f, -0.064164f, 0.019675f, -0.080091f, -0.069572f, -0.040716f, -0.054456f, -0.019123f, 0.051719f, 0.036762f, 0.043074f, -0.008126f, -0.097726f, -0.005080f, -0.062857f, 0.059578f, -0.054216f, -0.032441f, -0.093987f, -0.024985f, 0.011857f, -0.003099f, 0.044418f, -0.033766f, 0.084688f, 0.050324f, 0.065339f, -0.053486f, -0.045762f, -0.014790f, -0.047851f, -0.070035f, -0.103177f, -0.029689f, -0.076006f, -0.059112f, 0.077892f, -0.019027f, -0.070167f, 0.081548f, -0.073840f, 0.007665f, 0.050832f, 0.111139f, -0.076007f, 0.035343f, -0.096528f, 0.004923f, 0.067951f, -0.015889f, 0.015639f, -0.018433f, -0.036109f, -0.039912f, 0.013735f, 0.012301f, 0.066894f, 0.050808f, 0.033304f, 0.037485f, -0.001593f, 0.048229f, -0.028039f, 0.094704f, -0.084388f, -0.073533f, -0.076292f, -0.079472f, 0.000488f, -0.111579f, -0.062796f, -0.070472f, 0.059580f, 0.080785f, 0.014379f, -0.007777f, 0.062564f, 0.058326f, -0.026651f, 0.039775f, 0.025515f, -0.025317f, -0.085515f, -0.014036f, -0.035933f, 0.096004f, -0.096635f, 0.087433f, 0.051924f, 0.085953f, -0.054270f, 0.024618f, -0.057410f, 0.037455f, -0.087759f, -0.001929f, -0.054543f, 0.038140f, 0.095829f, -0.108226f, 0.076642f, -0.085554f, 0.033460f, 0.031888f, 0.022338f, 0.027904f, 0.066108f, -0.019635f, -0.024993f, 0.019349f, 0.009025f, -0.000692f, 0.092420f, 0.066985f, 0.013669f, -0.027755f, 0.044681f, 0.074189f, -0.042431f, 0.093492f, -0.030617f, -0.018749f, 0.041450f, -0.080636f, 0.071801f, 0.065322f, -0.087244f, 0.071698f, 0.078555f, 0.040303f, 0.074487f, 0.056149f, 0.022413f, 0.082757f, -0.028735f, -0.050746f, -0.075387f, 0.044191f, 0.091314f, 0.050964f, 0.059475f, 0.067464f, -0.011931f, 0.047000f, -0.029665f, -0.059368f, 0.095083f, -0.031672f, 0.054335f, 0.023278f, -0.029231f, -0.028994f, 0.053673f, -0.048296f, 0.004173f, -0.080190f, -0.041904f, -0.059918f, -0.025976f, 0.055618f, -0.036298f, -0.018194f, 0.011707f, 0.004148f, -0.052719f, -0.073888f, 0.088008f, -0.043293f, 0.037511f, -0.000250f, 0.043500f, -0.070820f, 0.021012f, 0.061725f, 0.061189f, 0.017608f, -0.101087f, 0.004586f, -0.032789f, -0.002943f, 0.003823f, -0.010455f, 0.062901f, -0.019091f, -0.039516f, 0.039219f, -0.087353f, -0.050698f, -0.006378f, -0.097300f, -0.095931f, -0.004269f, 0.030353f, 0.082784f, 0.077235f, -0.030449f, 0.040406f, -0.056633f, -0.093888f, -0.046410f, 0.046406f, -0.087709f, -0.015379f, 0.084517f, -0.061768f, 0.053659f, -0.071990f, 0.036150f, -0.029512f, 0.016790f, -0.100692f, 0.040784f, -0.081719f, -0.051133f, 0.023337f, 0.007259f, -0.052011f, 0.054654f, -0.076984f, -0.042983f, -0.057709f, -0.074645f, 0.033859f, 0.105738f, 0.065462f, 0.018966f, -0.036332f, 0.054048f, 0.079337f, 0.015416f, 0.056186f, 0.061957f, 0.012791f, 0.002858f, -0.011207f, 0.099729f, 0.089758f, 0.062962f, -0.041711f, -0.001882f, -0.069008f, -0.035371f, 0.062474f, -0.071866f, 0.022292f, 0.007822f, -0.107736f, -0.081144f, 0.003688f, -0.005627f, -0.073919f, 0.018077f, -0.105025f, -0.027128f, -0.063016f, -0.078109f, 0.044498f, -0.019898f, -0.064691f, -0.055795f, 0.062654f, -0.008031f, -0.033195f, 0.004418f, -0.025030f, 0.091784f, -0.070131f, -0.052119f, 0.092797f, -0.066098f, -0.099564f, 0.005524f, 0.066103f, -0.065526f, 0.072091f, 0.076490f, 0.056571f, 0.070203f, -0.053908f, -0.037805f, -0.052187f, 0.009944f, 0.067165f, -0.007473f, 0.065356f, -0.016942f, -0.027819f, -0.059049f, -0.110746f, -0.043326f, 0.077363f, -0.045508f, 0.072684f, 0.019084f, -0.010129f, -0.087942f, 0.028982f, 0.003053f, -0.021067f, 0.109953f, 0.035661f, -0.033170f, -0.021620f, 0.034414f, -0.051660f, 0.015390f, 0.023221f, 0.038468f, 0.067129f, 0.037595f, 0.075484f, -0.082227f, 0.005737f, -0.075255f, 0.085571f, -0.083606f, -0.009830f, -0.068958f, 0.014494f, -0.000049f, -0.084624f, 0.063894f, -0.003588f, -0.006926f, 0.062567f, 0.065452f, 0.083193f, -0.069579f, 0.004058f, -0.034025f, -0.019068f, -0.025577f, -0.055394f, 0.016380f, 0.006792f, -0.081056f, -0.041867f, -0.046268f, -0.070197f, -0.005366f, 0.026276f, -0.067817f, -0.049229f, -0.007597f, -0.076226f, 0.086337f, -0.026842f, 0.055997f, 0.008709f, 0.030330f, 0.044462f, -0.048723f, -0.006089f, -0.058148f, -0.059218f, 0.051956f, -0.020128f, 0.060678f, 0.044236f, 0.016623f, 0.008172f, -0.003849f, -0.011204f, -0.075264f, 0.003988f, 0.003567f, 0.052771f, -0.041403f, -0.018606f, 0.051382f, 0.080213f, -0.010004f, 0.010312f, -0.033399f, 0.004417f, 0.009524f, -0.056879f, -0.069222f, -0.068093f, 0.051211f, 0.009024f, -0.088999f, 0.072602f, -0.083916f, 0.004684f, 0.012340f, -0.055563f, -0.080990f, 0.099505f, -0.054492f, -0.053822f, 0.010987f, 0.052880f, -0.054694f, -0.071870f, 0.012255f, -0.004159f, -0.083286f, 0.024435f, -0.039332f, 0.047044f, -0.042444f, 0.005433f, -0.007580f, 0.069882f, 0.015598f, 0.011391f, -0.028048f, -0.076743f, -0.016584f, 0.053108f, 0.015820f, 0.025225f, 0.072053f, -0.080975f, 0.023309f, 0.031251f, 0.079410f, 0.081539f, 0.057444f, -0.036874f, -0.019313f, 0.032716f, 0.091329f, 0.083693f, 0.064777f, 0.005042f, 0.113107f, 0.061920f, -0.001313f, -0.007645f, -0.046045f, -0.017529f, 0.073459f, -0.069165f, 0.015223f, 0.031161f, 0.063707f, 0.021247f, -0.063240f, -0.042056f, -0.065592f, 0.010001f, -0.075630f, -0.021216f, -0.062695f, 0.007239f, 0.066673f, 0.081581f, 0.078774f, 0.076892f, -0.099095f, 0.061089f, -0.009798f, 0.075502f, -0.012441f, -0.077468f, 0.017725f, -0.012250f, 0.000547f, -0.058477f, -0.099377f, -0.094048f, -0.069853f, -0.103031f, 0.032678f, 0.093738f, -0.069130f, 0.059731f, 0.020690f, -0.095179f, 0.065773f, 0.008996f, 0.098188f, -0.091247f, -0.038402f, -0.055420f, -0.106986f, -0.029728f, 0.012951f, -0.011059f, 0.040486f, -0.020097f, -0.103571f, 0.037370f, 0.061825f, 0.018084f, -0.050484f, -0.057597f, -0.037903f, 0.060226f, 0.081243f, -0.093987f, -0.072739f, 0.046512f, 0.045785f, 0.089727f, -0.000939f, 0.024963f, 0.079538f, -0.043441f, 0.054129f, -0.050820f, -0.072083f, -0.023186f, -0.077607f, 0.064973f, -0.060273f, 0.069240f, -0.086052f, -0.035319f, -0.026772f, 0.100169f, -0.005247f, 0.027439f, -0.092736f, -0.006083f, -0.004992f, -0.038952f, -0.014404f, 0.080640f, 0.064507f, 0.049661f, -0.015811f, 0.039072f, 0.048317f, 0.073444f, 0.083461f, -0.042403f, -0.008961f, 0.020186f, -0.074943f, 0.071421f, 0.041355f, 0.052225f, -0.012041f, 0.058132f, 0.081750f, -0.071391f, 0.073826f, 0.073407f, 0.074462f, -0.017162f, 0.029653f, -0.001535f, 0.039043f, 0.111030f, -0.101654f, 0.069386f, -0.006625f, -0.023678f, 0.016387f, -0.070787f, 0.064988f, -0.079127f, -0.059699f, 0.046692f, 0.031201f, 0.054901f, -0.015266f, 0.032310f, -0.030390f, 0.066891f, -0.085194f, 0.071297f, 0.080157f, -0.083954f, -0.011749f, -0.031866f, 0.068952f, -0.067563f, -0.057058f, -0.071577f, -0.061275f, -0.076555f, 0.070624f, 0.048717f, 0.090126f, -0.045185f, -0.066241f, 0.031127f, 0.045478f, 0.071076f, 0.024022f, -0.035943f, -0.020136f, -0.004701f, -0.088494f, -0.041774f, 0.015089f, 0.010477f, -0.072521f, -0.068283f, 0.071872f, -0.066030f, -0.006378f, 0.075059f, 0.048467f, 0.031796f, 0.031216f, 0.078731f, 0.071546f, -0.001918f, -0.047804f, -0.049606f, 0.097205f, 0.110753f, 0.107576f, -0.050945f, -0.099140f, 0.031406f, 0.077863f, 0.039873f, -0.009166f, -0.040755f, -0.092685f, 0.017845f, 0.048693f, -0.071101f, 0.069701f, -0.023604f, 0.070903f, 0.036902f, -0.089673f, 0.025453f, -0.049918f, 0.000770f, 0.029933f, -0.040647f, 0.011730f, -0.087773f, 0.052237f, 0.042816f, 0.017771f, -0.053421f, 0.046273f, -0.036214f, 0.021915f, -0.029345f, 0.051657f, -0.078945f, -0.071685f, -0.028631f, 0.009546f, -0.110579f, 0.034993f, -0.042807f, -0.080992f, 0.035757f, -0.049161f, -0.101247f, -0.072573f, 0.026649f, -0.005228f, -0.001187f, 0.022934f, 0.029833f, -0.025066f, -0.008984f, -0.024116f, 0.059241f, 0.070614f, 0.038110f, -0.055266f, -0.073423f, -0.083801f, 0.039172f, 0.088559f, 0.049935f, -0.042374f, -0.081957f, 0.008877f, 0.012172f, -0.021124f, 0.075518f, -0.076154f, 0.086060f, 0.017969f, 0.093430f, -0.037382f, 0.043213f, -0.043518f, -0.005270f, -0.024154f, -0.090233f, -0.077467f, -0.016444f, -0.082465f, 0.100835f, 0.010345f, -0.011051f, 0.091217f, 0.044251f, -0.030230f, 0.022734f, 0.022346f, -0.028606f, -0.080011f, 0.089253f, -0.000254f, -0.084032f, -0.047506f, -0.045831f, -0.043937f, -0.044536f, -0.082467f, -0.094830f, 0.015516f, -0.001270f, 0.053662f, 0.029251f, -0.074737f, 0.012934f, 0.041825f, -0.077346f, 0.026939f, 0.018464f, -0.089621f, -0.038712f, -0.058479f, 0.009874f, 0.046036f, 0.070825f, -0.082517f, 0.021096f, 0.028248f, -0.051142f, -0.055784f, 0.005221f, -0.068045f, -0.028956f, 0.042232f, -0.078490f, 0.103979f, 0.050200f, 0.032810f, -0.003853f, 0.016717f, 0.073534f, -0.088794f, 0.015334f, -0.074880f, 0.044974f, 0.015105f, 0.016896f, 0.079433f, -0.001698f, -0.017593f, -0.037927f, 0.072880f, 0.024606f, 0.101579f, 0.080599f, 0.027172f, -0.014639f, 0.065450f, -0.022659f, 0.052213f, 0.007723f, -0.069713f, 0.090409f, -0.067966f, -0.002303f, 0.011350f, 0.101988f, -0.079345f, -0.057085f, -0.019980f, 0.058290f, -0.090999f, 0.052694f, 0.002900f, 0.090988f, -0.049880f, 0.055415f, 0.058766f, 0.067746f, 0.074999f, 0.013014f, -0.035016f, 0.014223f, -0.074769f, 0.048125f, -0.037913f, -0.028523f, -0.069444f, 0.068896f, -0.088687f, -0.111512f, 0.088543f, -0.026674f, 0.007730f, 0.076466f, -0.011567f, 0.035179f, 0.074480f, 0.090379f, 0.062818f, -0.062386f, -0.022022f, -0.060235f, -0.102856f, 0.082568f, -0.079136f, -0.074497f, 0.064925f, -0.002689f, 0.069759f, 0.065361f, -0.072545f, -0.054611f, 0.073598f, -0.063794f, -0.020618f, 0.083109f, -0.028379f, 0.000807f, -0.001845f, 0.060260f, 0.022901f, 0.061695f, 0.073479f, -0.040851f, -0.036365f, -0.095387f, -0.033226f, 0.108645f, -0.017793f, -0.047057f, 0.001016f, 0.061805f, 0.010188f, -0.000691f, -0.098306f, -0.061809f, 0.002957f, -0.063876f, -0.104979f, -0.061609f, -0.026392f, 0.026762f, 0.108733f, 0.056174f, 0.070673f, -0.077336f, -0.084834f, 0.031497f, 0.010371f, 0.039305f, -0.051375f, 0.009681f, -0.058810f, -0.058872f, 0.056722f, -0.068886f, -0.077689f, -0.068616f, 0.084761f, 0.075271f, 0.059601f, 0.007718f, -0.099134f, -0.041811f, -0.056119f, -0.079346f, 0.074311f, 0.072419f, -0.041363f, -0.047344f, 0.065589f, 0.021052f, 0.081061f, 0.029353f, -0.071276f, -0.052683f, -0.019771f, -0.024593f, -0.065730f, -0.053575f, -0.071777f, -0.042699f, -0.020490f, 0.059711f, 0.025362f, -0.019695f, 0.047481f, -0.045051f, -0.019561f, 0.003164f, 0.014999f, 0.073500f, -0.064590f, 0.062445f, 0.063895f, -0.032734f, 0.063121f, 0.030136f, 0.024536f, 0.008602f, 0.004959f, 0.018956f, 0.001056f, -0.002310f, -0.067571f, 0.007235f, -0.047765f, -0.011201f, -0.066780f, -0.003241f, 0.087780f, -0.047422f, 0.079285f, -0.097396f, -0.030011f, 0.074846f, -0.055259f, -0.080103f, 0.033284f, 0.089304f, 0.019989f, -0.093418f, 0.059058f, -0.083436f, 0.018687f, 0.073158f, -0.002636f, -0.050274f, 0.087015f, -0.079378f, -0.029238f, 0.009376f, -0.107289f, 0.017833f, 0.031038f, -0.016033f, -0.092285f, -0.089472f, -0.028010f, -0.006398f, 0.098127f, -0.039534f, 0.037125f, 0.032195f, -0.082382f, -0.014370f, 0.042386f, -0.025227f, 0.037265f, 0.072206f, -0.034677f, 0.029978f, -0.084583f, 0.035710f, 0.016894f, -0.025126f, 0.065388f, 0.099017f, -0.046571f, -0.010373f, -0.093333f, -0.004960f, 0.077861f, -0.059034f, -0.098407f, -0.003420f, -0.039769f, -0.054426f, 0.083524f, 0.085952f, -0.044923f, 0.096499f, 0.054402f, 0.082364f, 0.006745f, 0.017844f, 0.079701f, 0.061237f, 0.074484f, -0.033308f, -0.024430f, 0.041421f, 0.023220f, -0.096238f, 0.062227f, -0.006844f, -0.025332f, 0.060518f, -0.064981f, 0.000827f, 0.025914f, -0.025234f, 0.068085f, 0.073787f, 0.014376f, 0.043466f, 0.088949f, 0.000059f, -0.088920f, 0.071288f, 0.087177f, -0.064634f, -0.050330f, -0.007922f, -0.022124f, 0.063068f, -0.015573f, -0.064173f, -0.108509f, -0.063151f, -0.012116f, 0.060949f, -0.009144f, -0.070795f, 0.077747f, 0.021402f, -0.024577f, 0.023716f, 0.062945f, -0.044948f, 0.025542f, 0.034920f, 0.106923f, -0.070109f, -0.001942f, -0.060007f, 0.007976f, -0.011106f, 0.026549f, -0.013955f, -0.071256f, 0.003847f, -0.062250f, -0.058918f, -0.016214f, 0.051179f, 0.010210f, -0.079458f, 0.080474f, -0.081945f, 0.080455f, 0.001973f, 0.011610f, 0.045197f, -0.033882f, -0.041192f, -0.074824f, 0.079696f, 0.081111f, 0.006089f, 0.012093f, -0.023994f, -0.067477f, -0.079048f, 0.074709f, -0.089508f, 0.015831f, 0.020722f, 0.068908f, 0.055630f, -0.037100f, -0.077804f, -0.104334f, 0.050654f, 0.085095f, 0.045403f, -0.020992f, -0.036523f, -0.043631f, -0.004917f, -0.018983f, 0.045659f, 0.076109f, -0.064086f, -0.046969f, -0.063788f, -0.054675f, -0.059155f, -0.079654f, -0.073689f, -0.059708f, -0.002462f, -0.025184f, 0.090103f, -0.100201f, -0.033173f, -0.002316f, 0.044933f, 0.074750f, 0.086251f, 0.082877f, 0.025099f, -0.027006f, -0.054442f, 0.084319f, 0.013591f, -0.053696f, 0.042472f, 0.062279f, 0.002268f, 0.105784f, -0.006846f, 0.070624f, -0.005194f, -0.026980f, -0.069427f, -0.041899f, 0.012049f, 0.042858f, -0.092623f, 0.027843f, 0.057034f, 0.021106f, 0.024823f, 0.068910f, 0.086860f, -0.072141f, 0.028785f, -0.059106f, -0.050806f, -0.074192f, -0.101496f, -0.097269f, -0.004011f, -0.099154f, 0.075410f, 0.090585f, -0.038460f, -0.035666f, -0.034635f, -0.017791f, 0.098522f, -0.029820f, -0.086077f, -0.099959f, -0.079682f, 0.073370f, -0.041207f, 0.006341f, 0.010968f, -0.021403f, -0.080859f, 0.045627f, 0.014050f, -0.053466f, 0.057296f, 0.071914f, -0.053702f, -0.092997f, 0.074864f, -0.012698f, -0.062562f, -0.072513f, -0.098280f, -0.032327f, -0.048874f, -0.075558f, 0.006699f, 0.032790f, -0.098382f, 0.026214f, 0.089939f, -0.046412f, -0.032187f, -0.088635f, -0.035361f, 0.035502f, -0.061440f, 0.047908f, 0.021478f, -0.036403f, -0.066035f, -0.029481f, -0.017646f, -0.071038f, -0.043254f, -0.109057f, -0.109073f, 0.033033f, 0.025392f, 0.057617f, -0.032868f, 0.032372f, 0.057464f, -0.064739f, 0.031978f, -0.000858f, -0.051898f, -0.012279f, -0.092305f, -0.065085f, 0.085026f, 0.081034f, 0.045467f, -0.086532f, 0.041575f, -0.029471f, -0.018787f, 0.015510f, -0.022097f, -0.100619f, 0.096672f, -0.075582f, -0.066007f, -0.006742f, 0.086910f, -0.012863f, -0.069493f, 0.048088f, 0.005100f, 0.043580f, -0.041777f, -0.019200f, -0.013239f, 0.018983f, -0.061304f, 0.051731f, -0.078098f, 0.044651f, -0.010138f, 0.070146f, -0.031016f, -0.110674f, 0.043676f, -0.080979f, -0.074993f, 0.115093f, 0.017487f, 0.044326f, -0.017346f, 0.000260f, -0.032700f, -0.005400f, -0.061369f, -0.015111f, -0.080632f, 0.028158f, 0.025902f, 0.075521f, -0.094107f, 0.000724f, -0.029306f, -0.053421f, -0.039290f, -0.028527f, -0.033603f, -0.038087f, -0.071547f, 0.102928f, 0.004713f, -0.105702f, 0.088331f, -0.073241f, -0.055586f, -0.017380f, -0.098726f, 0.063633f, -0.092659f, -0.063555f, -0.035173f, -0.013974f, 0.029866f, -0.075716f, 0.086853f, -0.055414f, 0.050810f, 0.093909f, 0.059516f, 0.045576f, -0.033474f, 0.024439f, -0.079065f, 0.044033f, 0.024745f, 0.039317f, 0.078374f, -0.012998f, 0.076632f, -0.000757f, -0.055209f, -0.101090f, 0.054568f, -0.058394f, 0.047567f, 0.025811f, -0.010143f, 0.011585f, -0.085336f, -0.068805f, 0.032532f, 0.062066f, -0.033879f, -0.071583f, -0.085948f, -0.054988f, -0.094183f, -0.044077f, -0.040490f, 0.011067f, 0.062528f, -0.025127f, -0.048223f, -0.019074f, 0.024461f, -0.100485f, -0.051912f, 0.020569f, 0.080950f, -0.071247f, 0.090731f, -0.035209f, 0.000440f, -0.062648f, 0.043822f, 0.046161f, 0.099415f, 0.006009f, 0.096246f, 0.075514f, -0.016275f, 0.079311f, -0.054189f, -0.017567f, 0.071668f, 0.039923f, -0.047757f, 0.069807f, -0.086374f, 0.075440f, -0.050766f, 0.104159f, -0.077842f, -0.067210f, -0.057718f, -0.061633f, -0.026348f, 0.026381f, -0.065844f, 0.054132f, -0.009933f, 0.019985f, -0.006274f, -0.007493f, -0.080795f, 0.048743f, 0.031913f, -0.050748f, -0.053907f, -0.063843f, -0.050588f, 0.028715f, -0.071683f, -0.010411f, -0.054859f, 0.003608f, -0.066875f, 0.050861f, -0.040091f, -0.077927f, 0.013086f, 0.070374f, -0.008539f, 0.008465f, 0.044892f, -0.101950f, 0.046200f, -0.087810f, -0.074993f, -0.090992f, 0.076430f, 0.003372f, -0.086576f, 0.092470f, 0.093706f, 0.104020f, -0.006058f, -0.022102f, 0.020616f, -0.045963f, 0.024421f, -0.070766f, -0.044712f, 0.064805f, -0.089822f, -0.000674f, -0.075224f, 0.074120f, -0.008124f, 0.107479f, -0.003511f, -0.049342f, -0.084365f, -0.105958f, 0.008576f, 0.032159f, -0.080139f, -0.015531f, -0.020870f, -0.038292f, 0.004146f, -0.003147f, -0.015851f, -0.061363f, 0.077092f, 0.105704f, 0.039762f, -0.065332f, 0.080007f, 0.040562f, -0.070411f, 0.086437f, 0.012399f, -0.098691f, -0.071125f, -0.014468f, 0.101316f, -0.085921f, -0.009467f, -0.060873f, -0.034383f, -0.057694f, 0.078215f, -0.044921f, 0.040786f, -0.070279f, 0.081984f, -0.004063f, -0.041287f, 0.043296f, -0.000022f, -0.034114f, 0.024049f, 0.019136f, 0.102750f, 0.054408f, 0.041038f, -0.042833f, 0.055652f, -0.089569f, -0.069663f, -0.048850f, 0.006764f, -0.068190f, -0.081800f, 0.000993f, -0.031827f, 0.009920f, -0.006390f, 0.069159f, -0.104997f, 0.001625f, -0.006013f, 0.051382f, 0.000010f, 0.083224f, -0.038773f, 0.045534f, 0.073669f, 0.002533f, -0.029629f, -0.038781f, -0.007366f, -0.070346f, -0.018839f, -0.071134f, 0.000766f, -0.034147f, 0.020361f, 0.059199f, -0.067981f, -0.033360f, -0.083382f, -0.012473f, -0.008212f, 0.010311f, 0.088702f, -0.089106f, -0.030450f, 0.046241f, -0.070662f, 0.027850f, -0.067923f, -0.021000f, 0.050485f, -0.066000f, 0.064101f, -0.034915f, 0.070353f, 0.048352f, -0.066940f, 0.065697f, -0.033336f, -0.018741f, 0.026952f, 0.085071f, -0.033186f, 0.068181f, -0.082880f, 0.085032f, 0.071848f, -0.021465f, -0.036056f, 0.059972f, -0.029816f, 0.061509f, 0.018861f, 0.009941f, -0.025306f, 0.011925f, 0.016731f, -0.077825f, 0.080504f, -0.003288f, 0.060013f, -0.101096f, 0.064157f, 0.106042f, -0.046574f, 0.013107f, -0.087502f, -0.019673f, -0.023982f, 0.090306f, -0.020429f, 0.058934f, 0.061452f, 0.086840f, -0.000781f, 0.100452f, 0.096812f, 0.077004f, 0.080042f, -0.093774f, -0.000290f, -0.038338f, -0.074947f, -0.047596f, -0.058599f, 0.029353f, -0.038869f, -0.050803f, -0.046536f, -0.033167f, 0.008778f, 0.026966f, -0.003008f, 0.027424f, -0.047174f, -0.001233f, 0.024467f, 0.025365f, 0.018212f, -0.081601f, -0.096792f, -0.047937f, -0.015518f, -0.068981f, -0.065426f, -0.097514f, -0.059838f, -0.100929f, -0.014582f, 0.040052f, 0.069573f, 0.039634f, -0.041463f, -0.009703f, 0.013803f, -0.027411f, 0.005114f, -0.011498f, 0.068416f, 0.086120f, -0.024836f, 0.058582f, 0.010183f, -0.048540f, 0.061168f, 0.088520f, 0.066715f, 0.007044f, -0.000830f, -0.074781f, 0.074945f, -0.101165f, 0.076859f, -0.042888f, -0.050107f, 0.057764f, -0.080827f, 0.043578f, -0.101423f, 0.056348f, -0.015536f, 0.065947f, 0.029535f, -0.042437f, -0.064105f, 0.007214f, 0.083175f, -0.018653f, 0.071495f, 0.010433f, 0.076794f, 0.044091f, -0.111400f, -0.096749f, -0.049664f, -0.000702f, 0.062730f, 0.089968f, -0.012925f, 0.035379f, -0.038865f, -0.089615f, -0.095855f, -0.071808f, -0.044021f, -0.043032f, 0.080872f, 0.068370f, -0.082210f, 0.058316f, 0.007424f, 0.005659f, 0.018166f, -0.067824f, -0.056288f, -0.036951f, -0.015695f, -0.102417f, -0.084379f, -0.065843f, -0.098560f, 0.077748f, -0.039012f, 0.074727f, -0.072890f, 0.047392f, 0.014383f, -0.021422f, -0.010015f, 0.084568f, -0.068010f, 0.007638f, 0.081875f, 0.021330f, 0.105207f, -0.063688f, -0.051078f, -0.046525f, 0.038975f, -0.049928f, 0.027880f, -0.081703f, -0.036990f, 0.001639f, 0.008844f, 0.008269f, 0.005974f, -0.028236f, 0.069010f, 0.048410f, -0.024653f, 0.052853f, 0.053459f, 0.021557f, 0.007411f, 0.000410f, 0.013099f, 0.018517f, -0.057433f, -0.045286f, 0.096918f, 0.080208f, -0.065005f, 0.074504f, 0.049874f, 0.024149f, 0.076311f, 0.088998f, -0.031208f, 0.067072f, -0.020136f, -0.032511f, -0.007307f, 0.079514f, -0.032499f, 0.027066f, -0.033107f, 0.041544f, 0.078090f, -0.020848f, -0.046067f, 0.084919f, -0.015400f, 0.052021f, 0.006642f, 0.051731f, -0.070379f, -0.089907f, 0.003920f, -0.045674f, 0.000677f, -0.035337f, 0.029125f, 0.049202f, 0.046602f, -0.031506f, -0.053621f, -0.096124f, 0.070858f, 0.007419f, -0.034113f, 0.044999f, 0.100849f, -0.071791f, 0.034878f, -0.002343f, -0.023714f, -0.002439f, -0.056317f, -0.046914f, -0.030341f, 0.064816f, -0.073566f, -0.053977f, -0.065409f, 0.006010f, -0.068666f, -0.093836f, -0.070155f, -0.038908f, 0.076531f, 0.083439f, 0.021301f, -0.015662f, 0.041104f, -0.070257f, 0.074679f, -0.022539f, 0.084118f, -0.049233f, 0.040305f, 0.060694f, -0.061665f, -0.107754f, -0.011188f, -0.008820f, -0.071243f, 0.059134f, 0.052317f, 0.000490f, 0.080949f, 0.014127f, -0.005934f, -0.057084f, 0.095169f, 0.001764f, -0.017685f, 0.065311f, 0.047000f, -0.089540f, -0.069251f, -0.071611f, -0.091941f, -0.000394f, -0.060002f, 0.025808f, 0.055393f, 0.009819f, 0.053322f, -0.008130f, 0.047477f, 0.057942f, -0.060987f, 0.085146f, 0.057270f, -0.073459f, -0.078923f, 0.081444f, 0.026790f, -0.021766f, -0.006376f, -0.049608f, -0.000916f, -0.106983f, 0.108652f, 0.109554f, -0.065883f, -0.014389f, -0.045606f, -0.040809f, -0.065285f, 0.033513f, -0.037115f, -0.062699f, -0.011234f, -0.042894f, -0.062072f, -0.020750f, 0.041879f, 0.034058f, -0.025028f, 0.099682f, 0.060412f, 0.078726f, 0.046387f, -0.062561f, -0.063883f, -0.101433f, -0.010480f, -0.017082f, 0.080170f, 0.094917f, -0.059450f, -0.026641f, 0.014558f, 0.027042f, -0.041463f, -0.046905f, 0.024201f, -0.040737f, 0.049527f, -0.025996f, -0.070126f, 0.001991f, -0.061002f, 0.069774f, -0.043749f, -0.024078f, 0.038245f, 0.018081f, -0.052876f, 0.073393f, -0.006646f, 0.052620f, -0.082869f, -0.053641f, -0.055969f, 0.033640f, -0.065158f, -0.023635f, -0.004268f, -0.077009f, -0.058248f, -0.027628f, 0.020562f, 0.034969f, 0.055616f, 0.077606f, -0.023717f, -0.029400f, 0.001151f, 0.046521f, 0.008190f, -0.077106f, -0.071608f, -0.068145f, -0.101732f, 0.053821f, -0.060249f, -0.070617f, 0.024627f, -0.031664f, 0.057915f, 0.018028f, 0.004151f, 0.101897f, -0.095943f, -0.094677f, -0.037398f, 0.093790f, -0.098627f, -0.103034f, 0.078993f, 0.059073f, 0.048458f, 0.037275f, 0.086259f, 0.024292f, -0.047124f, 0.093041f, -0.057690f, 0.068665f, -0.089837f, -0.014763f, 0.098003f, -0.061465f, 0.014044f, 0.067891f, -0.031785f, -0.074639f, 0.068762f, -0.047602f, 0.072511f, 0.027406f, 0.058440f, 0.087053f, 0.041889f, 0.094057f, 0.021701f, -0.094938f, -0.075797f, -0.053555f, 0.025583f, 0.006285f, 0.042827f, -0.025884f, -0.103392f, -0.010619f, -0.038856f, -0.019288f, 0.085933f, 0.097666f, -0.030797f, -0.054035f, -0.048606f, 0.074491f, -0.068427f, -0.029412f, 0.026575f, 0.047445f, 0.092918f, -0.083298f, -0.002089f, 0.028225f, 0.058692f, -0.028711f, 0.089697f, 0.077302f, 0.111105f, -0.083313f, -0.070228f, -0.038459f, -0.002625f, 0.088779f, 0.041206f, 0.014158f, 0.045668f, -0.040292f, 0.011789f, -0.090017f, -0.034620f, 0.082269f, -0.003239f, 0.054385f, 0.034377f, 0.059350f, 0.003186f, 0.108183f, 0.097100f, 0.081393f, -0.095230f, -0.104872f, -0.014649f, 0.018362f, -0.035082f, 0.024189f, -0.057525f, -0.025295f, 0.030878f, -0.021884f, 0.086000f, 0.020656f, 0.048662f, 0.006090f, 0.025626f, 0.017794f, -0.074655f, 0.065430f, -0.065218f, -0.022055f, -0.066533f, -0.013762f, -0.024539f, -0.047178f, 0.082800f, 0.069602f, -0.058976f, 0.058085f, -0.044581f, 0.043930f, 0.061821f, 0.052872f, -0.082724f, 0.073245f, 0.016206f, 0.067729f, 0.069517f, 0.034040f, 0.014581f, -0.066978f, 0.056613f, 0.019470f, 0.063536f, 0.098420f, -0.067719f, 0.027589f, 0.014311f, 0.005396f, -0.057521f, -0.055583f, 0.030037f, 0.068258f, 0.072007f, 0.054081f, -0.098764f, -0.068963f, -0.081548f, -0.062687f, -0.019818f, -0.054874f, 0.043403f, -0.092395f, 0.079253f, -0.055366f, -0.021141f, 0.090372f, -0.075440f, 0.064863f, 0.089390f, 0.002410f, 0.056174f, -0.055529f, -0.018552f, 0.074171f, 0.011281f, 0.112690f, 0.000352f, -0.049577f, 0.015424f, -0.023127f, -0.024155f, 0.017578f, 0.097276f, -0.065120f, -0.019525f, -0.055610f, -0.058907f, -0.009311f, 0.097053f, 0.012595f, -0.017200f, 0.075824f, 0.080364f, -0.008939f, 0.038720f, 0.015758f, -0.027490f, 0.086176f, 0.000049f, 0.035638f, -0.004891f, -0.072201f, -0.047430f, -0.052979f, -0.068225f, -0.083232f, 0.095487f, 0.039224f, -0.029183f, 0.054370f, -0.039322f, -0.035948f, 0.068529f, -0.022603f, -0.076854f, -0.111871f, 0.030784f, 0.032196f, 0.058500f, -0.101306f, -0.056195f, 0.042978f, 0.049256f, 0.011810f, -0.074128f, -0.004912f, 0.016905f, 0.108813f, -0.025478f, 0.021084f, 0.085125f, -0.027748f, -0.053548f, 0.073823f, 0.086703f, 0.035143f, 0.007599f, 0.067678f, 0.091777f, -0.026547f, 0.048272f, -0.062889f, -0.044082f, -0.014924f, -0.039617f, 0.067701f, 0.024077f, 0.103741f, -0.042829f, 0.059673f, 0.084667f, 0.034922f, 0.029994f, -0.005447f, 0.004265f, 0.003272f, -0.042079f, -0.085955f, -0.098815f, 0.072499f, 0.006978f, -0.096400f, -0.077651f, 0.043818f, -0.017190f, 0.057459f, 0.051065f, 0.044687f, -0.084552f, -0.055775f, -0.021667f, -0.087448f, -0.013568f, 0.077659f, -0.066390f, -0.066183f, -0.020846f, -0.033139f, 0.039630f, -0.070490f, -0.035715f, 0.061278f, 0.032303f, -0.017781f, -0.000433f, 0.010998f, 0.023032f, -0.082781f, 0.096998f, -0.073933f, -0.019646f, 0.103740f, -0.000981f, -0.017319f, 0.048468f, -0.072078f, 0.067072f, 0.003737f, 0.082616f, 0.086273f, 0.071451f, 0.100072f, -0.033576f, 0.034531f, 0.073682f, -0.063992f, -0.092704f, -0.019528f, 0.080252f, -0.067126f, -0.088539f, -0.027882f, 0.058492f, 0.044258f, -0.044083f, 0.028975f, -0.064501f, -0.064354f, 0.011158f, 0.008026f, -0.007001f, -0.076883f, -0.026127f, 0.058967f, -0.034265f, -0.083430f, -0.025630f, 0.013939f, 0.051202f, -0.032729f, -0.058578f, 0.003828f, -0.026793f, 0.078788f, -0.015705f, -0.047391f, -0.080081f, -0.076219f, 0.031650f, 0.099164f, 0.037583f, 0.018690f, -0.050006f, -0.056864f, -0.104275f, 0.021291f, -0.041802f, 0.012811f, 0.011862f, -0.001109f, -0.044731f, 0.001236f, 0.051283f, 0.034509f, 0.079134f, -0.066716f, -0.037031f, 0.068351f, 0.009870f, -0.095158f, -0.027344f, -0.053292f, -0.022092f, 0.024956f, -0.086342f, -0.007928f, -0.073226f, -0.043506f, -0.042166f, 0.002748f, 0.010237f, 0.003413f, 0.003282f, -0.041611f, -0.071611f, 0.002481f, 0.005672f, 0.003625f, 0.061461f, 0.042198f, 0.020761f, -0.077859f, 0.078478f, 0.008768f, -0.099279f, -0.074145f, -0.007159f, 0.054218f, -0.082867f, 0.000365f, -0.039591f, 0.035090f, 0.085908f, 0.030333f, 0.014716f, -0.021926f, 0.087150f, 0.011162f, -0.074062f, -0.059078f, 0.046369f, -0.086969f, 0.043081f, -0.078635f, 0.009923f, -0.082296f, 0.095690f, 0.036758f, 0.004655f, 0.058133f, -0.043135f, 0.054481f, -0.085961f, 0.063407f, 0.077690f, -0.041191f, 0.097698f, -0.056681f, 0.043919f, 0.053588f, 0.082732f, -0.080143f, 0.050727f, -0.046017f, -0.034124f, 0.102187f, -0.092687f, 0.076756f, -0.044043f, -0.004537f, -0.008548f, 0.080571f, -0.012170f, -0.084397f, -0.073369f, 0.063313f, -0.013948f, -0.009446f, 0.106266f, -0.049625f, -0.096894f, -0.009070f, 0.079353f, -0.067424f, 0.012182f, -0.067567f, 0.009464f, -0.075650f, -0.067222f, -0.004248f, -0.007827f, 0.048953f, 0.002970f, 0.016055f, -0.039177f, -0.052750f, -0.023251f, -0.074105f, -0.030837f, 0.058632f, 0.064840f, 0.037608f, 0.045454f, 0.062785f, 0.069797f, -0.026934f, 0.045060f, 0.068040f, 0.035808f, 0.067862f, 0.098450f, -0.010745f, 0.003037f, -0.008806f, -0.002607f, -0.091042f, -0.039696f, -0.004431f, 0.029836f, -0.062360f, 0.097808f, -0.015095f, -0.033724f, -0.004899f, -0.015764f, -0.039818f, 0.064756f, 0.098286f, -0.052126f, -0.097618f, 0.009557f, 0.017932f, 0.057101f, 0.081211f, -0.103160f, -0.044260f, -0.044374f, -0.042089f, -0.008462f, -0.079667f, 0.080600f, 0.008522f, 0.081625f, 0.039505f, -0.009294f, -0.043560f, 0.057713f, 0.065071f, -0.061479f, 0.000360f, 0.002349f, 0.081865f, -0.066012f, -0.054298f, -0.015692f, 0.001107f, -0.028259f, 0.061586f, 0.062213f, 0.038913f, 0.070438f, -0.098511f, 0.100527f, -0.066423f, 0.045255f, 0.004753f, -0.013030f, -0.009815f, -0.017893f, 0.010877f, 0.005638f, 0.045965f, 0.036218f, -0.108948f, 0.017084f, 0.016154f, 0.039078f, 0.091199f, -0.033150f, -0.027089f, -0.068965f, 0.002643f, 0.091551f, -0.044530f, -0.049084f, -0.076231f, 0.023748f, 0.017850f, -0.023666f, -0.048766f, 0.109019f, -0.081524f, -0.033304f, -0.051592f, -0.020127f, -0.064728f, -0.079866f, -0.061470f, 0.009271f, 0.068884f, -0.057439f, 0.047447f, -0.074742f, -0.040806f, 0.001848f, -0.042141f, -0.029348f, -0.042106f, 0.069837f, -0.055282f, 0.004754f, 0.039980f, -0.000477f, 0.095974f, -0.089188f, -0.029978f, 0.078361f, -0.019132f, 0.071858f, -0.094262f, 0.043253f, -0.028991f, -0.084579f, 0.031787f, 0.071291f, -0.054221f, -0.100707f, 0.071670f, -0.014891f, -0.070690f, 0.108447f, 0.090345f, -0.061779f, -0.067164f, -0.079024f, -0.014633f, 0.048424f, -0.046957f, -0.051054f, 0.037977f, -0.038609f, -0.085605f, -0.007353f, 0.065497f, 0.080808f, 0.024470f, -0.006982f, 0.025706f, -0.017066f, -0.030509f, 0.050310f, -0.043148f, -0.086686f, 0.052883f, -0.069959f, -0.096802f, 0.001987f, 0.114930f, -0.074737f, -0.023182f, -0.092002f, -0.017254f, -0.021869f, 0.042528f, 0.073688f, -0.065826f, 0.044415f, 0.092528f, 0.075692f, 0.082971f, -0.004812f, 0.105809f, -0.066320f, -0.051997f, 0.093840f, -0.021409f, -0.006846f, 0.054073f, 0.105756f, -0.077466f, 0.067401f, -0.041037f, -0.040778f, -0.004297f, -0.090054f, 0.076826f, -0.009215f, -0.019103f, 0.009007f, -0.067134f, -0.049791f, -0.041188f, 0.023983f, 0.086904f, -0.008147f, 0.057253f, -0.094938f, 0.048613f, 0.005273f, 0.026159f, -0.021897f, -0.041308f, 0.083702f, 0.004631f, -0.092273f, -0.087364f, -0.064433f, -0.071132f, -0.071778f, 0.095784f, -0.060952f, 0.050198f, 0.081200f, -0.000559f, 0.064323f, 0.073569f, -0.020995f, 0.042492f, -0.079683f, -0.055814f, 0.028305f, -0.046962f, -0.046111f, -0.030888f, -0.042604f, -0.040656f, -0.020674f, 0.011264f, 0.017240f, 0.011148f, -0.071835f, 0.046123f, 0.104761f, -0.037390f, 0.062511f, 0.042413f, -0.014584f, 0.059260f, 0.058072f, -0.012080f, 0.045656f, 0.021997f, -0.056473f, 0.024369f, -0.033482f, 0.041264f, 0.069596f, 0.048503f, -0.025505f, -0.086433f, -0.027479f, -0.059096f, 0.029917f, -0.114367f, 0.027298f, -0.083132f, -0.052963f, -0.007458f, -0.023716f, -0.077540f, -0.077295f, 0.036583f, -0.054540f, 0.010771f, -0.007323f, -0.022323f, 0.055036f, -0.004507f, -0.013738f, -0.053344f, -0.059268f, 0.075372f, -0.042627f, -0.043283f, -0.050558f, -0.002515f, 0.060142f, 0.034748f, -0.063017f, -0.061216f, 0.030179f, 0.011024f, -0.072605f, 0.037347f, 0.015580f, -0.051186f, -0.065024f, 0.068298f, 0.042996f, -0.006198f, -0.033256f, -0.050303f, -0.095911f, 0.037655f, -0.040722f, -0.012925f, -0.060736f, 0.071736f, 0.058868f, 0.057116f, -0.082362f, -0.075442f, -0.027975f, -0.085287f, -0.046415f, -0.021398f, -0.070831f, 0.012406f, -0.032820f, -0.065342f, 0.011333f, -0.054739f, 0.015257f, 0.010808f, -0.081932f, -0.012948f, -0.059064f, -0.019981f, -0.006630f, 0.007924f, 0.048663f, 0.016008f, 0.008376f, 0.054989f, -0.109088f, 0.080075f, -0.057183f, 0.040880f, -0.044813f, 0.019951f, -0.009453f, -0.065050f, 0.064883f, -0.052743f, -0.077865f, -0.091858f, -0.050157f, -0.061353f, -0.033829f, 0.109983f, 0.002395f, 0.038077f, 0.087248f, -0.078719f, -0.022022f, 0.050409f, 0.091719f, 0.051568f, -0.010976f, -0.037239f, 0.056452f, -0.045823f, -0.075708f, -0.087082f, 0.010283f, 0.099986f, -0.055145f, 0.045542f, -0.070211f, -0.059475f, -0.019614f, -0.031368f, 0.018494f, -0.070727f, 0.048864f, 0.003651f, 0.023023f, -0.020036f, -0.088006f, -0.044618f, -0.046089f, -0.055189f, 0.097606f, -0.041370f, -0.031514f, -0.004975f, -0.088344f, -0.060249f, 0.001379f, -0.097314f, -0.071548f, -0.007665f, 0.013092f, -0.065400f, 0.064476f, 0.017657f, 0.083686f, -0.032601f, 0.064241f, -0.096437f, -0.079661f, -0.086277f, -0.017053f, -0.004885f, 0.085440f, 0.051246f, -0.025430f, 0.013958f, -0.018042f, -0.003753f, -0.096011f, 0.010559f, -0.029360f, -0.041646f, -0.028138f, -0.012843f, 0.040053f, 0.076715f, -0.073012f, -0.064058f, 0.035025f, 0.054149f, -0.005625f, 0.033591f, -0.015351f, 0.066391f, 0.033178f, -0.003945f, -0.031559f, -0.001151f, 0.047662f, -0.041892f, -0.074225f, -0.099737f, -0.041570f, 0.066806f, 0.083241f, -0.049135f, 0.044763f, -0.074888f, -0.047982f, 0.021351f, -0.029424f, 0.036372f, -0.042476f, 0.077333f, -0.006334f, 0.004136f, 0.099062f, -0.017527f, 0.078964f, -0.080084f, 0.001563f, 0.080832f, 0.076394f, 0.036192f, -0.053766f, 0.028640f, -0.022790f, -0.032641f, -0.112393f, 0.062234f, 0.019616f, -0.102701f, -0.009894f, 0.041945f, 0.027585f, 0.000874f, -0.070045f, -0.071883f, 0.062002f, -0.075886f, 0.062498f, -0.041367f, -0.025284f, 0.020444f, 0.025295f, -0.022196f, 0.020151f, 0.084196f, -0.019514f, 0.021192f, -0.026890f, 0.037145f, -0.026464f, 0.040913f, 0.064768f, 0.059618f, -0.011197f, -0.081360f, 0.027349f, 0.085857f, 0.074396f, -0.043549f, -0.035904f, 0.074869f, -0.023004f, -0.009861f, 0.083994f, -0.079535f, -0.023650f, -0.096600f, -0.021709f, -0.088699f, 0.015232f, 0.102793f, 0.104484f, 0.011519f, 0.028214f, -0.029392f, 0.033492f, -0.089062f, -0.048207f, -0.076800f, -0.011442f, 0.080415f, -0.094445f, 0.063744f, -0.055186f, 0.088472f, 0.042835f, 0.085713f, 0.035465f, -0.075131f, -0.009370f, -0.019843f, -0.012649f, -0.006836f, 0.058232f, -0.012121f, 0.071754f, 0.029808f, -0.037125f, -0.015758f, 0.073319f, 0.050707f, -0.015907f, -0.022155f, 0.031018f, -0.036123f, -0.057002f, 0.004011f, -0.056447f, -0.031162f, 0.008304f, 0.068314f, -0.053528f, -0.038552f, 0.018200f, 0.059902f, 0.032716f, 0.057281f, 0.048803f, -0.057801f, -0.072057f, -0.090462f, 0.061059f, 0.088080f, -0.046307f, -0.042125f, -0.046683f, -0.053604f, 0.085526f, 0.023168f, -0.040860f, 0.072128f, 0.064852f, -0.026425f, 0.058377f, 0.090706f, 0.049531f, -0.072015f, -0.036523f, 0.068655f, -0.060628f, 0.089540f, -0.012926f, 0.062301f, -0.073211f, 0.075122f, -0.099831f, -0.089644f, 0.056423f, 0.099018f, -0.039792f, 0.052938f, -0.060462f, -0.036975f, -0.020063f, 0.062899f, 0.055728f, -0.025234f, -0.067779f, 0.089886f, 0.071540f, -0.040496f, 0.031439f, -0.088498f, -0.015011f, -0.034831f, 0.043819f, -0.039528f, -0.103138f, -0.029635f, -0.064757f, 0.101598f, 0.062664f, 0.102545f, 0.007623f, 0.005912f, -0.057783f, -0.072051f, -0.048570f, -0.005991f, 0.049573f, 0.033031f, 0.057929f, 0.052194f, -0.072092f, 0.091786f, 0.014063f, 0.077232f, -0.042950f, -0.041582f, -0.086105f, -0.018245f, 0.078401f, 0.030401f, 0.081763f, 0.099332f, -0.005523f, -0.024688f, 0.029851f, -0.076748f, 0.065494f, 0.098045f, 0.036650f, -0.066179f, -0.058037f, -0.010511f, 0.081871f, -0.014236f, 0.039590f, 0.084297f, 0.039981f, -0.060557f, 0.016912f, -0.046466f, -0.032910f, 0.076011f, -0.093685f, 0.050083f, 0.013063f, 0.044050f, -0.003809f, 0.068180f, -0.033272f, -0.092311f, -0.009236f, 0.024282f, 0.037726f, -0.015705f, 0.054973f, 0.081873f, 0.063451f, -0.016740f, 0.031717f, 0.073267f, -0.072754f, -0.082058f, -0.004341f, -0.103868f, -0.002551f, -0.041224f, 0.025194f, 0.007929f, 0.050574f, -0.038647f, -0.033262f, -0.058907f, -0.020307f, -0.025928f, 0.035151f, -0.070603f, -0.023551f, -0.075976f, 0.009256f, 0.078005f, 0.063796f, 0.098691f, 0.030964f, -0.105755f, -0.061292f, -0.060158f, -0.071320f, -0.009570f, 0.010301f, -0.047392f, 0.011959f, -0.015172f, 0.080292f, 0.081415f, 0.050445f, 0.001567f, 0.082839f, 0.054902f, 0.076857f, -0.074783f, 0.041829f, -0.054949f, 0.082460f, 0.046624f, -0.054212f, -0.077752f, 0.025113f, -0.106605f, 0.074764f, -0.031619f, 0.035821f, -0.088251f, 0.090530f, 0.044504f, 0.051774f, 0.056025f, -0.013784f, -0.052939f, -0.003236f, -0.074091f, 0.074226f, -0.091920f, -0.107824f, 0.028036f, 0.021591f, 0.110441f, 0.071286f, 0.018340f, 0.078978f, -0.073875f, -0.004175f, -0.029475f, -0.071787f, -0.085935f, -0.078686f, 0.022194f, -0.084798f, -0.010208f, 0.011187f, 0.084267f, -0.078348f, 0.008916f, 0.052012f, 0.090435f, -0.072707f, -0.076171f, 0.103704f, 0.106482f, -0.049577f, -0.068921f, -0.064318f, -0.000163f, 0.049335f, 0.049218f, 0.018658f, 0.096192f, -0.079470f, 0.008364f, -0.053662f, 0.069684f, 0.053827f, 0.011030f, -0.090793f, -0.070264f, -0.007593f, 0.067765f, -0.051416f, 0.088931f, 0.110387f, -0.091053f, -0.065803f, -0.057655f, -0.040999f, 0.030276f, 0.014492f, -0.069695f, 0.009350f, -0.008886f, -0.097498f, 0.029402f, -0.067555f, -0.082992f, -0.027715f, 0.024724f, 0.058860f, 0.087183f, -0.016523f, 0.102364f, 0.028829f, 0.042942f, -0.023301f, -0.020191f, 0.036570f, 0.080428f, 0.064760f, 0.010365f, -0.013048f, -0.028617f, -0.081049f, 0.088662f, -0.005634f, -0.010238f, -0.000474f, -0.063623f, -0.068286f, -0.067596f, -0.021448f, -0.045393f, 0.083337f, -0.086291f, -0.068336f, -0.093257f, 0.068671f, -0.058290f, -0.035441f, -0.054519f, 0.083568f, -0.098432f, 0.007257f, -0.081526f, 0.046984f, 0.000544f, -0.046021f, -0.051484f, 0.009775f, -0.077015f, 0.087456f, 0.053218f, 0.053531f, 0.025376f, 0.062507f, 0.072751f, 0.049255f, 0.055926f, 0.098842f, -0.076290f, 0.048577f, -0.016273f, 0.078755f, 0.025836f, -0.059811f, -0.033960f, 0.023363f, 0.009408f, -0.084877f, 0.004179f, 0.017834f, -0.055449f, 0.080246f, -0.056672f, 0.056548f, -0.081663f, -0.008097f, -0.061332f, -0.052120f, -0.034679f, -0.086071f, 0.006722f, 0.026853f, 0.027085f, 0.090773f, -0.094300f, 0.013723f, -0.023234f, 0.063968f, 0.053797f, 0.018491f, 0.050105f, 0.088955f, -0.005266f, -0.109579f, 0.056020f, -0.022989f, 0.085069f, 0.057706f, -0.003731f, 0.015047f, 0.077594f, -0.050755f, -0.016635f, 0.010804f, 0.000152f, 0.080679f, 0.076107f, 0.068251f, -0.068736f, 0.014947f, -0.008713f, 0.018278f, -0.023418f, 0.017718f, 0.039407f, -0.019256f, 0.007707f, -0.016700f, -0.036457f, 0.029681f, 0.039265f, 0.003865f, 0.045067f, -0.021933f, 0.013251f, 0.009265f, -0.102087f, -0.068216f, 0.068996f, 0.030679f, 0.059867f, -0.032663f, 0.053695f, -0.069566f, 0.008459f, 0.049105f, 0.081105f, 0.060145f, 0.101513f, 0.092228f, 0.035029f, -0.007224f, -0.079396f, -0.030970f, -0.033875f, -0.035151f, -0.044690f, 0.108991f, -0.089369f, 0.058927f, 0.002332f, 0.001214f, -0.074811f, -0.017910f, -0.029612f, 0.077031f, -0.067642f, -0.086433f, -0.034031f, 0.041012f, -0.005242f, -0.065523f, -0.021022f, 0.008195f, -0.007930f, 0.039520f, -0.051816f, 0.087674f, 0.002030f, -0.052420f, -0.010196f, 0.023749f, -0.102618f, 0.093083f, -0.082278f, 0.057753f, -0.058459f, -0.100829f, 0.017366f, 0.060572f, 0.069747f, 0.072179f, -0.074413f, -0.024193f, 0.063072f, 0.062614f, -0.059543f, 0.058192f, 0.071521f, -0.041867f, -0.078168f, -0.067844f, 0.028433f, 0.013583f, -0.006751f, 0.005212f, 0.042146f, -0.070532f, -0.076206f, 0.056156f, 0.017718f, 0.028957f, 0.001056f, 0.018592f, -0.071742f, -0.046391f, 0.049339f, -0.081691f, 0.092891f, 0.054177f, 0.033628f, 0.022401f, -0.028862f, 0.094173f, -0.042806f, -0.031292f, 0.015088f, -0.038905f, 0.005244f, 0.064351f, 0.022236f, -0.028458f, 0.013477f, -0.040337f, 0.085459f, -0.068416f, -0.001112f, 0.057659f, -0.041424f, 0.054163f, 0.085244f, -0.087306f, -0.031480f, -0.042270f, 0.002606f, -0.088398f, 0.003870f, 0.022892f, 0.009905f, -0.012149f, 0.026929f, -0.083583f, -0.012640f, 0.085051f, -0.079886f, -0.015297f, -0.017188f, -0.056181f, -0.077449f, -0.013369f, 0.020279f, -0.022658f, -0.072950f, 0.061756f, 0.071809f, 0.059988f, 0.006573f, 0.073841f, 0.026780f, -0.005687f, 0.080892f, -0.097777f, 0.018038f, -0.069810f, -0.083065f, -0.058265f, 0.025891f, -0.067352f, -0.078226f, 0.070670f, -0.027461f, 0.007911f, -0.036117f, -0.035774f, 0.086126f, 0.093788f, 0.035618f, -0.084162f, -0.005093f, 0.058156f, 0.095696f, 0.037905f, 0.039284f, -0.083790f, 0.102438f, -0.073391f, -0.034422f, 0.078205f, 0.048302f, 0.068330f, 0.009392f, -0.036968f, 0.067787f, -0.050064f, -0.081172f, -0.078380f, -0.058087f, 0.061026f, -0.069338f, -0.099076f, -0.073652f, 0.026754f, 0.062903f, 0.098787f, 0.032770f, 0.079474f, 0.023956f, 0.010227f, 0.057964f, -0.025234f, 0.004885f, -0.001681f, -0.095885f, 0.004030f, -0.052036f, -0.063363f, -0.046595f, 0.078207f, 0.037311f, 0.032343f, -0.014959f, 0.045859f, 0.048858f, -0.088362f, -0.045434f, 0.061191f, -0.017492f, 0.004705f, -0.068898f, -0.094638f, 0.093236f, -0.043045f, -0.056507f, 0.062754f, -0.068915f, -0.065346f, 0.082969f, 0.063893f, 0.019024f, 0.050097f, -0.081871f, -0.078388f, 0.045879f, 0.078253f, -0.075599f, -0.090622f, -0.073236f, 0.060591f, 0.076553f, 0.081624f, 0.027791f, 0.040368f, 0.084108f, -0.009518f, 0.066555f, -0.024926f, -0.004713f, 0.056574f, -0.055697f, 0.096161f, 0.009041f, 0.007030f, 0.041075f, -0.011913f, 0.056118f, 0.030923f, 0.092865f, 0.070859f, 0.025359f, 0.030713f, -0.012765f, -0.055014f, 0.018741f, -0.014615f, 0.044150f, 0.004216f, -0.039627f, 0.025679f, -0.088812f, 0.063922f, 0.062836f, -0.054837f, -0.054506f, -0.002474f, -0.029009f, 0.071677f, -0.044680f, 0.099624f, 0.015894f, -0.038556f, -0.087689f, -0.023589f, -0.091762f, -0.074377f, -0.067307f, 0.049695f, -0.016988f, 0.085044f, -0.022582f, -0.014176f, -0.033894f, 0.077869f, -0.077878f, -0.045087f, 0.027650f, 0.087310f, -0.019899f, 0.067641f, 0.075693f, 0.041710f, 0.006681f, 0.057349f, 0.098740f, 0.080943f, -0.069362f, 0.035064f, -0.057571f, 0.023882f, -0.088316f, -0.083804f, -0.077693f, -0.017832f, -0.019700f, 0.037219f, 0.068584f, 0.026202f, -0.023698f, -0.014711f, -0.020341f, 0.004571f, 0.039558f, 0.073224f, -0.045002f, -0.051309f, 0.013335f, -0.077101f, -0.031967f, 0.075193f, 0.040710f, -0.046666f, -0.074172f, 0.033399f, -0.046800f, -0.059237f, 0.027035f, 0.004223f, -0.106631f, 0.020058f, 0.092971f, 0.008745f, -0.064727f, -0.005922f, -0.051170f, -0.055907f, 0.057889f, 0.049346f, -0.069988f, 0.036589f, 0.067844f, -0.031686f, 0.092782f, 0.040875f, 0.005020f, 0.075162f, 0.057244f, 0.006009f, 0.027351f, 0.034556f, 0.054243f, -0.069566f, -0.094730f, -0.041877f, -0.001529f, 0.058719f, 0.014680f, 0.002071f, -0.053976f, -0.005762f, -0.079645f, -0.015128f, -0.006684f, -0.045454f, 0.076197f, -0.014484f, -0.037203f, 0.053477f, 0.019285f, -0.029235f, 0.002023f, -0.029928f, -0.001083f, -0.096272f, 0.068165f, 0.071800f, -0.070560f, 0.092837f, -0.009257f, -0.095814f, -0.044944f, 0.021957f, 0.001519f, -0.001654f, -0.023577f, 0.063396f, -0.044659f, -0.066073f, 0.011248f, 0.029798f, 0.064526f, 0.067741f, 0.079527f, 0.031929f, -0.074452f, -0.098183f, -0.042234f, 0.053790f, 0.029689f, -0.042357f, 0.074051f, -0.082847f, -0.058984f, -0.011871f, -0.060306f, 0.008869f, 0.079763f, -0.062837f, 0.076183f, 0.071551f, 0.046723f, -0.095703f, -0.092207f, -0.009546f, -0.031355f, -0.048921f, 0.039159f, -0.025181f, 0.037250f, -0.050564f, -0.000726f, -0.067666f, 0.095912f, -0.058867f, 0.057763f, -0.077347f, 0.072067f, -0.072626f, 0.084929f, -0.052549f, 0.016130f, -0.101603f, -0.058171f, -0.041586f, -0.048903f, -0.024581f, 0.071159f, -0.058778f, 0.011058f, -0.000601f, -0.075418f, 0.050178f, 0.029930f, 0.015979f, -0.061892f, -0.078070f, 0.063639f, 0.082083f, -0.045785f, -0.015185f, -0.043308f, 0.034031f, -0.052877f, -0.014496f, -0.014000f, -0.027727f, 0.039686f, -0.022265f, 0.029096f, 0.055148f, 0.057935f, 0.047262f, -0.087074f, -0.065474f, 0.032763f, 0.008084f, 0.013626f, -0.081748f, -0.056089f, 0.029019f, -0.058082f, 0.022560f, -0.024463f, 0.085570f, 0.003652f, 0.054795f, 0.085141f, -0.067399f, -0.063906f, -0.033809f, -0.079612f, -0.058736f, 0.061022f, 0.046473f, -0.061030f, -0.062713f, -0.014738f, 0.020318f, 0.039008f, 0.096550f, -0.020628f, 0.091602f, -0.084960f, -0.104870f, 0.055474f, 0.036787f, -0.094766f, -0.033346f, 0.049053f, -0.034312f, 0.102700f, 0.030562f, 0.053304f, 0.081658f, 0.060730f, 0.051328f, 0.039939f, 0.081071f, 0.039775f, -0.092091f, 0.044641f, -0.022728f, 0.000515f, 0.007062f, -0.092240f, 0.077445f, 0.091036f, -0.025283f, 0.086959f, 0.078665f, 0.046014f, 0.082048f, -0.062999f, -0.019907f, -0.035411f, 0.083569f, -0.079487f, 0.037357f, -0.054297f, 0.048767f, 0.038193f, 0.012635f, -0.036402f, 0.066099f, 0.071126f, -0.089023f, 0.047159f, -0.008473f, 0.014890f, -0.103718f, -0.085681f, -0.022579f, -0.004347f, 0.082056f, 0.057374f, 0.088882f, -0.094218f, -0.029849f, 0.085893f, 0.012084f, -0.020154f, 0.047339f, -0.012469f, 0.000563f, 0.047230f, -0.060083f, -0.028390f, 0.031300f, 0.020264f, -0.084952f, -0.072867f, -0.032909f, 0.004715f, 0.021200f, -0.003273f, -0.100447f, -0.009343f, -0.100108f, -0.046180f, 0.028649f, -0.048137f, -0.084299f, 0.020989f, -0.068660f, 0.079812f, -0.025028f, 0.002832f, 0.004275f, 0.007128f, 0.105622f, -0.108943f, -0.002303f, -0.067878f, 0.067784f, 0.083304f, -0.035843f, 0.025989f, -0.079643f, 0.057824f, -0.023078f, -0.012560f, -0.084885f, 0.066174f, 0.011135f, 0.042398f, -0.027798f, 0.009951f, -0.066985f, 0.025582f, -0.016947f, 0.090313f, 0.024869f, -0.030358f, -0.080055f, 0.025128f, 0.068292f, -0.055026f, 0.052756f, 0.112933f, 0.000858f, -0.050644f, -0.052570f, -0.089144f, 0.083001f, -0.015486f, 0.041209f, 0.059408f, 0.073312f, -0.046402f, -0.074035f, 0.091926f, -0.017430f, 0.073922f, 0.081298f, -0.070452f, 0.053894f, -0.000604f, -0.090829f, 0.059071f, 0.083807f, -0.103054f, 0.088008f, -0.008122f, -0.049437f, -0.106904f, -0.062933f, 0.010941f, -0.097545f, -0.007860f, -0.018874f, -0.054329f, -0.020703f, 0.039125f, -0.068443f, -0.098268f, 0.015403f, -0.023681f, -0.042601f, 0.023159f, -0.060573f, -0.088642f, 0.066787f, -0.092408f, -0.066085f, -0.104498f, 0.073850f, 0.006968f, -0.024335f, -0.055980f, 0.014773f, 0.015589f, -0.019129f, -0.064079f, -0.059843f, 0.012283f, 0.043102f, 0.096944f, -0.025468f, -0.096340f, -0.052725f, -0.015720f, -0.043991f, -0.028284f, -0.009850f, 0.050452f, -0.109146f, 0.025766f, -0.001419f, -0.057865f, -0.061224f, 0.039596f, 0.079508f, 0.069639f, -0.021294f, 0.009864f, -0.029939f, -0.022083f, -0.050686f, -0.000629f, -0.059277f, 0.032222f, 0.096610f, -0.030945f, -0.001125f, 0.052081f, 0.029926f, 0.032049f, -0.029690f, 0.023286f, 0.053626f, 0.008779f, 0.083894f, 0.057708f, 0.066042f, -0.006112f, -0.075427f, 0.075988f, 0.073222f, -0.046963f, -0.071425f, 0.022680f, -0.087396f, -0.088121f, -0.042780f, 0.008609f, 0.079023f, 0.002012f, -0.079104f, 0.002147f, 0.004225f, 0.087869f, -0.047444f, -0.000058f, -0.044116f, -0.051677f, 0.054812f, 0.045539f, 0.066723f, -0.062886f, 0.011835f, 0.003477f, 0.056637f, 0.014651f, -0.014043f, 0.070152f, 0.017459f, 0.051216f, -0.069181f, -0.028110f, 0.032723f, 0.003367f, 0.096603f, -0.066336f, -0.109926f, 0.078483f, -0.025075f, -0.070836f, -0.057235f, 0.064477f, 0.001691f, -0.057267f, -0.023660f, 0.076900f, 0.003742f, -0.000080f, -0.074636f, -0.024722f, -0.054428f, 0.015336f, 0.068500f, 0.031747f, 0.053719f, -0.027127f, -0.052717f, -0.031237f, -0.039593f, 0.048653f, -0.004202f, 0.029985f, 0.059971f, -0.051745f, 0.099122f, 0.077206f, 0.003844f, -0.076604f, -0.016456f, -0.020711f, -0.015061f, -0.076046f, 0.045615f, 0.032660f, -0.033684f, -0.104939f, -0.021306f, -0.099644f, -0.052659f, 0.040904f, -0.011908f, 0.083511f, -0.047874f, 0.015354f, 0.077216f, 0.097452f, -0.083254f, 0.078462f, 0.012879f, -0.048264f, -0.073773f, 0.000942f, -0.064331f, 0.048348f, 0.082299f, 0.098709f, -0.091130f, -0.038690f, 0.077240f, 0.086848f, -0.054350f, 0.058053f, 0.033950f, -0.019814f, -0.025514f, -0.042201f, 0.027403f, -0.037660f, -0.006836f, -0.080536f, 0.084631f, -0.086264f, -0.095225f, 0.099069f, 0.081067f, -0.005495f, 0.038090f, 0.091865f, 0.048142f, 0.008343f, -0.088267f, 0.086340f, -0.078585f, -0.081784f, -0.029614f, -0.086936f, 0.045279f, -0.062328f, 0.026248f, -0.000646f, -0.030879f, -0.077871f, 0.060581f, -0.030645f, -0.038758f, 0.028278f, 0.004624f, -0.036440f, 0.081755f, 0.025779f, -0.054774f, -0.064623f, 0.026179f, -0.023463f, 0.065954f, 0.058713f, 0.107234f, 0.025138f, -0.062864f, 0.047507f, -0.007840f, 0.028999f, 0.003846f, -0.077070f, 0.060969f, 0.079515f, 0.098064f, -0.028047f, 0.009823f, -0.022476f, 0.069798f, 0.060533f, 0.010425f, 0.037397f, -0.067940f, -0.012387f, -0.002392f, -0.073890f, -0.066666f, -0.015640f, 0.079376f, -0.038867f, 0.107350f, 0.014129f, -0.004320f, 0.056093f, 0.018115f, -0.080799f, 0.012149f, -0.059036f, -0.085166f, 0.026981f, -0.049927f, -0.053293f, 0.024200f, -0.042656f, -0.080641f, 0.088983f, -0.007930f, -0.056917f, -0.086343f, 0.065064f, 0.075594f, 0.034945f, -0.044116f, 0.020383f, -0.071116f, -0.008987f, -0.087402f, -0.093668f, 0.005727f, -0.025169f, -0.055985f, 0.061912f, -0.019831f, 0.045290f, -0.092021f, -0.044656f, -0.086785f, -0.028705f, 0.026671f, 0.002595f, 0.087170f, 0.070171f, -0.053436f, -0.002793f, 0.064747f, 0.073382f, 0.022818f, 0.073035f, 0.003079f, 0.075842f, 0.076842f, -0.040085f, -0.097490f, -0.069173f, -0.015565f, -0.004974f, 0.019353f, -0.029362f, -0.026365f, -0.059696f, 0.095950f, -0.030097f, -0.049918f, -0.009672f, -0.047887f, 0.097508f, -0.060720f, 0.009440f, 0.030313f, -0.028179f, 0.029684f, 0.069890f, -0.061103f, 0.002809f, 0.019230f, 0.009744f, 0.035952f, -0.081962f, -0.062677f, -0.007484f, -0.030961f, 0.062805f, -0.088285f, -0.010181f, 0.033758f, -0.071818f, 0.076849f, 0.087851f, 0.033741f, -0.014435f, 0.024765f, 0.064765f, -0.065547f, 0.032046f, -0.036231f, -0.053582f, 0.002427f, 0.060689f, -0.044861f, -0.038487f, 0.055539f, -0.083280f, -0.015220f, 0.107891f, -0.027444f, -0.037745f, 0.088758f, -0.036330f, -0.049397f, 0.020639f, -0.055548f, -0.018606f, -0.051453f, 0.040256f, 0.058068f, 0.001332f, 0.054349f, -0.036261f, 0.022978f, 0.003050f, -0.051430f, -0.027316f, -0.032335f, -0.059434f, 0.104820f, -0.018503f, 0.101903f, 0.037280f, -0.072306f, -0.073916f, 0.030215f, 0.054535f, -0.035992f, 0.031262f, 0.082313f, 0.062504f, -0.041202f, -0.041097f, 0.003116f, 0.028773f, -0.070532f, -0.093027f, -0.058989f, 0.071349f, -0.011380f, 0.092093f, 0.104104f, 0.030949f, -0.079756f, -0.080290f, -0.008224f, 0.047077f, -0.010606f, -0.096144f, 0.017236f, -0.097547f, 0.074586f, 0.017166f, 0.098497f, -0.005267f, -0.037646f, 0.060760f, -0.002643f, 0.076296f, 0.032070f, -0.071117f, 0.065145f, 0.069297f, -0.085088f, -0.075268f, -0.057545f, 0.064714f, 0.082655f, 0.053864f, 0.050093f, -0.001047f, 0.038484f, -0.024498f, -0.012455f, -0.032802f, -0.038092f, -0.081224f, 0.000483f, -0.039410f, 0.000392f, -0.036699f, -0.058241f, 0.050714f, 0.037531f, 0.064890f, 0.010597f, -0.075076f, 0.000924f, 0.052896f, 0.080896f, 0.030545f, -0.061308f, 0.049753f, 0.086675f, 0.044982f, 0.016494f, 0.077639f, 0.074090f, 0.065883f, 0.073788f, -0.071699f, 0.042349f, 0.078303f, 0.045398f, -0.088036f, -0.030755f, 0.002579f, -0.042633f, -0.040695f, 0.040743f, 0.069303f, 0.077209f, -0.002765f, -0.013163f, 0.072956f, 0.059432f, -0.046263f, 0.008667f, 0.068555f, -0.101062f, -0.083141f, -0.086047f, -0.047893f, 0.061174f, 0.001079f, -0.030984f, 0.056692f, 0.037441f, -0.102734f, -0.071810f, -0.030292f, 0.052492f, 0.079246f, 0.019496f, -0.075974f, 0.023231f, -0.104619f, 0.018289f, -0.028824f, -0.007185f, 0.039005f, -0.055477f, 0.101278f, -0.057517f, 0.010852f, 0.023889f, -0.032954f, -0.066544f, 0.026174f, 0.093275f, -0.045556f, 0.020555f, -0.045313f, 0.029033f, -0.036697f, 0.106202f, -0.061710f, -0.043137f, -0.061370f, -0.035985f, -0.008307f, -0.016602f, 0.018159f, 0.054066f, -0.049326f, -0.093803f, 0.081564f, -0.014545f, 0.034634f, -0.083005f, 0.042991f, -0.002605f, 0.020499f, 0.032015f, 0.060041f, -0.089212f, 0.014067f, 0.081335f, -0.062886f, 0.004969f, 0.073190f, -0.087359f, -0.105230f, -0.075947f, -0.098153f, 0.016118f, 0.032331f, -0.111266f, -0.011015f, -0.011361f, 0.066772f, 0.062703f, 0.058391f, -0.097055f, -0.046971f, -0.107085f, 0.083436f, 0.101745f, -0.011161f, -0.035333f, 0.036461f, -0.042138f, -0.012492f, 0.053727f, 0.000940f, 0.076175f, 0.081685f, -0.003028f, 0.073131f, -0.003060f, 0.075423f, -0.051398f, -0.008470f, 0.092432f, -0.045116f, 0.034084f, -0.010060f, 0.045793f, -0.026277f, -0.018059f, -0.066693f, 0.019310f, -0.065612f, -0.048358f, -0.041638f, 0.033631f, -0.015459f, -0.082154f, 0.001255f, 0.080431f, 0.062179f, -0.071114f, 0.006039f, 0.015064f, 0.054888f, 0.012963f, -0.086755f, 0.108669f, 0.077566f, 0.007884f, -0.044573f, -0.017068f, 0.034039f, -0.090130f, -0.097855f, 0.086426f, -0.024858f, -0.065910f, 0.014743f, -0.078116f, 0.012199f, 0.008593f, 0.095274f, -0.013811f, 0.051481f, -0.089581f, -0.057657f, 0.065732f, 0.077256f, 0.053056f, 0.048269f, 0.054764f, -0.078823f, -0.062343f, -0.002484f, 0.023697f, 0.060115f, 0.029287f, -0.075709f, 0.098200f, -0.041259f, 0.020909f, -0.085943f, -0.009031f, 0.037045f, -0.079379f, 0.073695f, -0.047819f, -0.067043f, -0.066702f, 0.011471f, -0.086439f, 0.058150f, 0.052598f, -0.070128f, 0.087883f, 0.093755f, 0.083230f, -0.081174f, -0.038868f, 0.012465f, 0.027271f, -0.052781f, 0.092718f, 0.101933f, -0.075910f, -0.022517f, -0.041268f, 0.006354f, -0.006797f, 0.005241f, 0.054105f, 0.105846f, -0.084428f, -0.105830f, 0.019173f, -0.061336f, -0.106613f, 0.025217f, 0.053462f, 0.001225f, -0.017294f, -0.080773f, -0.001065f, 0.019590f, 0.071073f, -0.003555f, -0.040895f, -0.080279f, 0.039540f, 0.057770f, -0.032434f, 0.036046f, 0.018747f, -0.102082f, -0.032207f, 0.022332f, 0.108707f, -0.052152f, 0.085556f, -0.002581f, -0.088318f, -0.008929f, -0.032894f, 0.051955f, -0.107870f, 0.034485f, 0.066799f, -0.008915f, 0.064701f, 0.066180f, -0.003492f, 0.014381f, 0.021375f, 0.062735f, -0.074860f, 0.046916f, -0.029831f, 0.035608f, 0.050367f, -0.007564f, 0.017691f, 0.046919f, -0.093787f, -0.005775f, -0.016010f, 0.066422f, 0.091667f, -0.019147f, -0.033612f, 0.040150f, -0.010355f, -0.017993f, -0.073860f, -0.032489f, 0.030526f, -0.054572f, 0.016386f, -0.008243f, -0.039473f, 0.095564f, -0.025717f, 0.002359f, 0.063936f, 0.005191f, 0.010764f, -0.015966f, -0.080121f, -0.042440f, -0.020099f, -0.015319f, 0.059809f, -0.009918f, 0.073443f, -0.018833f, 0.064287f, 0.032964f, 0.055106f, 0.067481f, 0.105092f, 0.040105f, 0.069829f, -0.059754f, 0.050404f, 0.026361f, -0.023894f, 0.011050f, 0.059104f, -0.020615f, 0.042497f, -0.066184f, 0.086294f, -0.049222f, 0.022939f, -0.003750f, -0.072286f, 0.078494f, -0.087942f, 0.011988f, -0.072588f, 0.102213f, 0.012402f, -0.034737f, 0.074691f, -0.104679f, -0.026869f, 0.025576f, -0.066856f, 0.044084f, 0.061922f, 0.014417f, 0.052710f, 0.058084f, -0.089167f, 0.013092f, 0.099157f, -0.081509f, 0.065781f, -0.096700f, 0.035256f, 0.095383f, -0.018669f, 0.050500f, 0.027113f, 0.015681f, 0.016088f, 0.013949f, -0.076450f, -0.012161f, 0.057781f, -0.048807f, -0.069523f, -0.021054f, -0.007013f, -0.009305f, 0.054017f, -0.084914f, -0.015640f, -0.053753f, -0.068295f, -0.076570f, -0.065586f, -0.025390f, 0.080669f, -0.063277f, 0.078401f, 0.025429f, 0.016961f, 0.068809f, -0.028989f, -0.028012f, 0.088175f, 0.048146f, 0.033140f, -0.033109f, 0.044154f, -0.081161f, -0.056197f, 0.037392f, 0.030082f, -0.036046f, 0.082135f, -0.054334f, 0.082689f, -0.089512f, 0.086568f, -0.023923f, -0.086743f, 0.101566f, -0.057706f, 0.078800f, 0.076118f, 0.032213f, 0.027993f, -0.047112f, 0.074593f, 0.080785f, -0.073752f, -0.016760f, -0.016068f, -0.072490f, -0.036350f, -0.070430f, -0.019733f, -0.000582f, 0.085532f, -0.037891f, 0.000022f, 0.076144f, 0.060785f, -0.068213f, 0.003253f, 0.037396f, -0.040860f, 0.060052f, -0.021494f, 0.005462f, 0.023221f, -0.033548f, 0.025129f, -0.074533f, -0.045876f, 0.076343f, -0.007715f, 0.101910f, -0.078750f, -0.011681f, 0.026769f, -0.059215f, 0.088898f, 0.059831f, -0.004908f, -0.067060f, -0.003057f, 0.014994f, -0.027089f, 0.002200f, 0.000304f, 0.033402f, -0.074905f, -0.083800f, -0.023942f, 0.007719f, -0.082937f, 0.058962f, 0.019772f, 0.105759f, 0.092652f, 0.024398f, 0.014535f, -0.045801f, 0.051667f, -0.099814f, 0.041070f, 0.050457f, 0.058732f, -0.016542f, -0.080416f, -0.072074f, 0.093013f, 0.029473f, 0.081371f, 0.080899f, -0.060655f, 0.078695f, -0.020174f, -0.078017f, 0.003818f, 0.097436f, -0.036960f, -0.002647f, 0.004880f, -0.051249f, 0.013320f, -0.026384f, -0.019488f, 0.070262f, 0.051740f, 0.068252f, 0.070516f, -0.002286f, 0.008703f, -0.095842f, -0.062326f, 0.078035f, -0.088087f, -0.072107f, -0.087623f, -0.049118f, 0.051527f, 0.021340f, -0.013991f, -0.004261f, 0.112882f, -0.054039f, -0.082803f, 0.071794f, -0.030917f, -0.090443f, 0.040780f, 0.030663f, 0.022619f, 0.043407f, -0.065588f, 0.029119f, 0.006669f, -0.015553f, 0.017604f, 0.082924f, -0.066204f, -0.079210f, -0.048909f, 0.060037f, -0.036205f, 0.038637f, -0.006636f, 0.058625f, 0.018251f, -0.018117f, 0.068919f, 0.047616f, 0.059636f, -0.006396f, -0.042462f, -0.021593f, 0.077678f, -0.079629f, 0.034453f, -0.023902f, -0.036738f, 0.013417f, -0.001763f, -0.035278f, 0.078237f, 0.034287f, 0.001103f, -0.095873f, -0.003694f, 0.056894f, 0.040446f, 0.022813f, -0.107328f, -0.050477f, 0.096050f, 0.065746f, 0.027540f, -0.025229f, -0.075661f, 0.054402f, -0.079801f, 0.101518f, 0.033348f, 0.030312f, 0.045710f, -0.028763f, -0.018317f, -0.081561f, 0.102384f, -0.008023f, 0.050452f, -0.061547f, 0.080969f, 0.004040f, 0.018956f, -0.034326f, -0.045636f, -0.090883f, -0.071580f, -0.102924f, -0.077747f, 0.082028f, 0.015227f, 0.057014f, -0.078952f, -0.075100f, -0.036628f, -0.106380f, 0.025826f, -0.070256f, 0.035722f, 0.008848f, -0.001371f, 0.049682f, 0.011667f, 0.062988f, -0.076717f, 0.055579f, -0.091315f, 0.015078f, -0.011609f, -0.111283f, -0.068723f, 0.012912f, 0.017621f, -0.025913f, -0.025790f, -0.072978f, 0.039115f, 0.056590f, -0.072130f, -0.041404f, -0.096605f, -0.088349f, -0.027037f, 0.042771f, -0.019574f, -0.055029f, 0.066599f, 0.015780f, -0.090164f, 0.046878f, 0.089024f, -0.032031f, -0.033545f, -0.045364f, 0.053775f, 0.094751f, -0.102085f, -0.086662f, -0.050981f, -0.041875f, -0.030232f, -0.004828f, -0.073585f, 0.067504f, 0.015374f, 0.087005f, 0.064058f, -0.059349f, -0.030645f, -0.037224f, -0.035457f, -0.077345f, -0.076700f, -0.016908f, -0.046507f, 0.018032f, 0.021437f, 0.038799f, -0.051946f, 0.021658f, -0.054060f, -0.016635f, -0.093519f, 0.005168f, 0.034748f, 0.082681f, -0.087176f, 0.043668f, 0.021164f, -0.074446f, -0.053597f, -0.026242f, -0.065503f, 0.072664f, 0.004901f, 0.017976f, 0.078014f, -0.038682f, -0.082401f, 0.026186f, 0.065924f, 0.045841f, 0.021151f, -0.038922f, -0.052996f, 0.035161f, 0.003272f, -0.091885f, 0.008123f, -0.014770f, 0.055170f, -0.039748f, -0.013010f, 0.079462f, 0.028748f, 0.091538f, 0.011325f, 0.056155f, 0.095381f, -0.030253f, -0.055557f, 0.035682f, 0.029390f, -0.002294f, -0.071915f, 0.046528f, -0.035399f, 0.021370f, -0.089091f, -0.076576f, 0.019446f, -0.037847f, 0.010450f, -0.027827f, 0.045263f, 0.009215f, 0.035521f, -0.036914f, 0.062064f, -0.048095f, 0.039264f, 0.054183f, -0.102095f, 0.075184f, -0.069419f, 0.048457f, -0.048308f, -0.014505f, -0.059589f, -0.053609f, 0.076634f, 0.058454f, 0.040853f, 0.065430f, 0.041221f, -0.102313f, 0.033342f, 0.063650f, 0.010785f, 0.074048f, 0.033750f, 0.037655f, 0.021180f, 0.087433f, 0.022997f, 0.038839f, -0.037008f, 0.034235f, 0.039611f, -0.081539f, -0.063428f, -0.072670f, 0.021863f, -0.043210f, -0.026987f, 0.046522f, 0.044840f, 0.074094f, 0.071076f, -0.067474f, 0.069666f, -0.056677f, -0.036117f, 0.070606f, -0.044878f, 0.049853f, 0.024588f, 0.014927f, 0.017943f, 0.053631f, 0.081571f, 0.085105f, -0.079342f, 0.041496f, 0.082464f, 0.102273f, 0.077587f, 0.055455f, -0.007310f, 0.034054f, 0.036914f, -0.038972f, 0.020608f, 0.027802f, -0.044436f, -0.001276f, 0.056183f, 0.021164f, 0.064613f, 0.090607f, -0.106004f, -0.042653f, -0.066416f, 0.042733f, 0.078401f, 0.023076f, -0.054804f, -0.029910f, -0.011413f, 0.084517f, 0.007650f, 0.002666f, -0.073419f, 0.092829f, -0.039131f, 0.065889f, -0.063643f, 0.068385f, 0.020636f, -0.059028f, 0.062728f, 0.016033f, 0.028490f, -0.026244f, 0.086735f, 0.021871f, -0.053351f, -0.057914f, -0.097544f, -0.085649f, -0.088104f, -0.049936f, 0.086844f, 0.034508f, -0.066698f, -0.028234f, -0.070650f, 0.015564f, -0.071538f, 0.082044f, 0.016637f, -0.055735f, 0.058841f, -0.086359f, 0.064006f, -0.048807f, -0.082992f, -0.067733f, 0.018432f, 0.091407f, -0.022117f, -0.012497f, -0.033255f, -0.028504f, 0.112936f, -0.038386f, 0.096467f, -0.047543f, 0.048337f, -0.038058f, -0.026824f, 0.094142f, 0.073704f, 0.088989f, 0.012554f, -0.031904f, 0.051303f, -0.099064f, -0.101135f, 0.025088f, -0.074437f, -0.077988f, 0.064726f, -0.053513f, 0.032985f, 0.102345f, -0.061520f, 0.068121f, -0.003199f, 0.040176f, 0.092312f, -0.065155f, 0.062299f, -0.023976f, 0.067703f, -0.023783f, 0.060068f, 0.021700f, 0.061768f, -0.081007f, 0.075655f, -0.063437f, -0.050172f, -0.056269f, -0.024639f, 0.070955f, -0.015687f, -0.049074f, -0.080328f, 0.088901f, 0.064146f, -0.049504f, 0.026763f, -0.073783f, -0.053509f, 0.061687f, 0.045461f, 0.103740f, -0.059183f, 0.084289f, 0.058326f, -0.036371f, 0.041368f, 0.036611f, 0.052697f, 0.102562f, -0.020428f, 0.060686f, 0.032061f, 0.080185f, 0.003517f, -0.024800f, 0.074051f, -0.056237f, -0.104638f, 0.085517f, -0.093796f, 0.067595f, -0.048349f, -0.009938f, -0.020998f, -0.069521f, 0.055150f, -0.052389f, -0.000752f, -0.011201f, -0.037034f, -0.070171f, -0.080441f, -0.075588f, 0.096864f, -0.035869f, -0.071014f, -0.104788f, -0.037886f, 0.054070f, -0.027863f, 0.077377f, 0.012232f, 0.047048f, 0.076969f, -0.112056f, -0.044413f, 0.026361f, 0.062643f, -0.075829f, -0.036331f, 0.048624f, -0.024547f, -0.072506f, -0.008118f, 0.009602f, 0.017234f, -0.012153f, -0.006601f, 0.063830f, -0.093510f, 0.081077f, 0.086117f, -0.053422f, 0.017353f, 0.017222f, -0.070199f, -0.053275f, -0.029949f, 0.009682f, 0.041364f, 0.057180f, -0.101094f, -0.046003f, -0.031739f, 0.016705f, -0.056774f, -0.101232f, 0.050704f, 0.056372f, -0.051687f, -0.069820f, -0.100757f, 0.038315f, -0.010475f, 0.030409f, -0.007425f, 0.048069f, 0.052525f, 0.068603f, -0.063647f, 0.079727f, 0.063519f, 0.082359f, 0.087494f, 0.104142f, -0.091833f, -0.045236f, 0.029691f, -0.045280f, 0.078741f, -0.032266f, -0.068358f, 0.096763f, -0.046794f, -0.052584f, -0.042929f, 0.094194f, -0.081971f, -0.019681f, -0.046230f, -0.086476f, -0.033730f, 0.032688f, -0.010562f, -0.042629f, 0.067710f, -0.032243f, -0.082409f, 0.026463f, -0.074330f, 0.061284f, -0.006261f, -0.069302f, -0.017497f, -0.024284f, 0.000862f, 0.016576f, 0.091658f, 0.023651f, -0.048488f, -0.062598f, -0.071586f, -0.002052f, -0.013467f, -0.052428f, -0.020500f, -0.103044f, 0.034024f, -0.002400f, 0.111087f, -0.059677f, -0.000615f, -0.103004f, -0.059537f, 0.100047f, 0.110416f, -0.082981f, 0.075578f, 0.002436f, 0.048113f, -0.018879f, 0.070607f, -0.079705f, -0.061294f, -0.056163f, 0.085905f, -0.020245f, 0.087193f, 0.019002f, 0.081124f, 0.068287f, -0.084028f, -0.060376f, 0.100204f, -0.085959f, 0.058753f, 0.080951f, -0.011124f, -0.034196f, -0.019743f, -0.044798f, 0.078632f, -0.029469f, -0.102977f, -0.086582f, -0.086356f, -0.060236f, -0.061105f, -0.027460f, -0.066016f, 0.044230f, 0.090960f, -0.043543f, 0.039975f, 0.030442f, 0.020632f, -0.076534f, -0.066435f, -0.053307f, -0.063687f, 0.076297f, 0.064111f, -0.049263f, -0.063565f, 0.060921f, -0.010118f, -0.080020f, -0.037123f, -0.081357f, 0.008452f, 0.021219f, 0.102876f, -0.082520f, 0.104000f, 0.031708f, -0.058724f, 0.010172f, -0.087481f, 0.079578f, 0.022795f, 0.091442f, 0.070216f, -0.057180f, 0.064959f, -0.060692f, 0.102959f, -0.045910f, -0.042544f, -0.053394f, 0.041419f, -0.027000f, -0.057198f, -0.087712f, -0.078558f, 0.093071f, 0.094166f, 0.048046f, 0.079053f, 0.085168f, -0.010786f, 0.063286f, 0.009775f, -0.087356f, -0.023316f, -0.101397f, 0.096404f, -0.043880f, 0.048835f, 0.074281f, 0.079446f, 0.005170f, -0.082177f, 0.089816f, -0.103582f, 0.064443f, -0.082542f, 0.062270f, -0.026421f, 0.011900f, -0.079227f, -0.069284f, -0.061283f, -0.006318f, 0.070102f, -0.080039f, 0.082774f, -0.049695f, -0.034618f, 0.034395f, 0.070563f, -0.057291f, -0.010317f, -0.026306f, 0.017338f, 0.060541f, 0.019778f, -0.053749f, -0.075713f, -0.086384f, 0.051867f, -0.097759f, 0.094212f, -0.042332f, 0.011581f, 0.034219f, 0.043285f, -0.035731f, 0.045435f, -0.032933f, -0.063736f, -0.037881f, 0.041679f, 0.035332f, 0.096458f, -0.049094f, 0.060881f, -0.065576f, 0.007359f, 0.071118f, 0.084681f, -0.072146f, -0.090136f, 0.003936f, -0.042268f, 0.029438f, 0.090890f, -0.073767f, -0.077144f, 0.021202f, 0.020198f, -0.045216f, 0.014322f, 0.054713f, 0.023645f, -0.091155f, -0.027060f, -0.101371f, -0.079525f, 0.020858f, 0.020454f, -0.065504f, -0.084504f, -0.001522f, -0.057561f, 0.089655f, -0.086836f, -0.082348f, -0.066988f, -0.039987f, 0.100673f, -0.011893f, -0.033562f, -0.035103f, 0.042053f, -0.101630f, -0.028049f, 0.002389f, 0.032529f, 0.054798f, 0.030942f, 0.014105f, 0.101103f, -0.008053f, 0.104735f, 0.039802f, -0.079953f, -0.016735f, 0.076946f, -0.000419f, 0.109876f, -0.038005f, 0.077446f, 0.012973f, 0.065203f, -0.064181f, 0.028222f, 0.014813f, -0.020693f, -0.017042f, -0.089923f, -0.061877f, 0.088351f, -0.031487f, 0.013205f, -0.028399f, 0.034737f, 0.070315f, 0.031462f, 0.062516f, -0.102569f, -0.045404f, 0.095826f, 0.021994f, -0.051970f, 0.038544f, 0.031597f, 0.070200f, 0.073396f, 0.041826f, -0.087069f, -0.095507f, 0.051740f, 0.052683f, 0.110907f, 0.022805f, -0.064095f, -0.076347f, 0.006926f, -0.065841f, 0.071587f, -0.072173f, 0.062991f, 0.034495f, -0.050010f, 0.052344f, -0.039673f, -0.011290f, 0.013272f, 0.072024f, -0.077149f, -0.103625f, -0.022793f, 0.060748f, -0.045072f, 0.001767f, -0.068329f, 0.070474f, 0.042801f, 0.091252f, 0.061493f, 0.055363f, -0.014084f, 0.107425f, 0.071958f, 0.000008f, -0.066544f, -0.015935f, 0.022287f, 0.107077f, 0.044279f, -0.079223f, 0.092098f, -0.026282f, 0.079575f, -0.001015f, 0.012967f, 0.072982f, 0.072803f, 0.066786f, 0.053683f, 0.001395f, -0.080820f, 0.034401f, 0.045625f, -0.088683f, 0.082643f, -0.104916f, -0.025638f, -0.014535f, 0.063892f, -0.056887f, -0.082411f, -0.077275f, 0.016981f, -0.082084f, -0.010586f, 0.090122f, -0.031798f, 0.016299f, -0.090209f, 0.074365f, 0.085558f, 0.069573f, 0.069077f, -0.021196f, -0.035647f, -0.085372f, -0.058740f, 0.032823f, 0.065490f, 0.042965f, -0.057901f, -0.057144f, -0.049310f, 0.013822f, 0.068898f, -0.049836f, -0.039217f, -0.097092f, -0.048544f, 0.078515f, -0.042090f, -0.101057f, -0.000100f, 0.059022f, -0.095990f, -0.009233f, 0.093407f, -0.040716f, -0.045166f, 0.016945f, -0.039147f, -0.078145f, -0.010161f, -0.030728f, 0.028475f, -0.039289f, 0.018149f, -0.082903f, 0.025382f, -0.076069f, -0.037501f, -0.012569f, 0.057975f, 0.084950f, 0.048802f, -0.027863f, 0.054800f, 0.019142f, 0.058353f, -0.061010f, 0.083503f, -0.088058f, 0.017210f, -0.109956f, 0.064954f, -0.047626f, 0.060847f, 0.054712f, -0.029464f, 0.019605f, -0.015952f, 0.075092f, -0.029077f, 0.032388f, 0.019936f, 0.055854f, -0.099383f, 0.046693f, -0.038599f, 0.010755f, -0.030844f, -0.104270f, 0.051676f, -0.082111f, 0.002449f, -0.001796f, -0.083677f, 0.076797f, 0.041550f, -0.022977f, 0.002280f, -0.074908f, 0.002617f, -0.000667f, 0.051029f, 0.085270f, 0.070172f, -0.021288f, 0.063915f, 0.079606f, -0.068056f, -0.028631f, 0.022181f, 0.068118f, 0.037875f, -0.067461f, -0.044070f, -0.038206f, 0.001568f, -0.001699f, -0.031002f, 0.007141f, 0.103602f, 0.025493f, -0.034830f, 0.031753f, 0.029622f, 0.070536f, 0.079640f, -0.051281f, -0.022897f, -0.026918f, -0.005853f, -0.086885f, -0.029455f, -0.093779f, 0.043869f, 0.066142f, 0.029093f, 0.021170f, 0.063383f, -0.003698f, -0.043408f, -0.085440f, 0.070869f, 0.075390f, -0.008889f, -0.025873f, -0.035856f, -0.059032f, -0.048450f, 0.083494f, -0.058474f, 0.060802f, -0.084682f, 0.063219f, -0.003424f, -0.058657f, -0.072109f, 0.054724f, -0.034250f, 0.037711f, 0.070006f, -0.044921f, 0.034645f, 0.097968f, -0.069657f, 0.014522f, 0.085487f, 0.041173f, -0.060542f, -0.039009f, -0.054970f, -0.078759f, -0.096421f, 0.102125f, 0.017742f, -0.099395f, 0.003440f, -0.027630f, 0.041451f, -0.107450f, -0.015436f, 0.041145f, -0.020282f, 0.019382f, 0.005551f, 0.010805f, -0.050880f, -0.013298f, 0.056963f, -0.092546f, 0.076239f, -0.038280f, -0.032762f, -0.020021f, -0.044844f, 0.072266f, 0.046771f, -0.111384f, 0.070838f, -0.075389f, -0.032307f, 0.078539f, 0.083769f, 0.084655f, 0.003656f, -0.026979f, 0.079953f, 0.006016f, 0.090560f, 0.022073f, -0.049711f, 0.035773f, -0.006379f, 0.038375f, -0.014447f, 0.095900f, -0.034427f, -0.078492f, 0.062904f, -0.007507f, 0.033885f, -0.062508f, -0.018156f, -0.060673f, -0.018034f, -0.087283f, 0.036194f, 0.013078f, -0.000560f, -0.019786f, 0.035998f, -0.038634f, 0.053032f, -0.086114f, -0.089674f, -0.034501f, -0.014757f, 0.103170f, 0.060810f, -0.047410f, 0.072436f, 0.024421f, 0.035312f, 0.056831f, -0.082618f, 0.046046f, 0.068663f, -0.081780f, -0.001266f, 0.051762f, 0.070143f, -0.063279f, -0.061180f, -0.041288f, 0.040322f, 0.055676f, -0.009902f, 0.015637f, -0.100838f, 0.071553f, 0.039746f, -0.103242f, -0.051301f, -0.048697f, 0.056120f, 0.040460f, 0.066688f, -0.072598f, 0.011354f, -0.035387f, -0.029911f, 0.102641f, 0.006232f, -0.091812f, -0.092561f, 0.004454f, 0.055394f, -0.091792f, 0.062141f, -0.059127f, -0.005579f, 0.059133f, -0.029994f, 0.058174f, 0.049382f, 0.029182f, 0.079784f, 0.051387f, 0.047382f, -0.070493f, 0.054794f, 0.032528f, -0.080301f, 0.105900f, -0.019569f, -0.080650f, -0.060477f, -0.039010f, -0.024170f, 0.052242f, 0.069549f, 0.109372f, -0.072936f, -0.057011f, 0.062308f, 0.039028f, 0.069052f, 0.061239f, -0.016404f, 0.101115f, 0.060486f, 0.070949f, 0.020459f, 0.032147f, 0.066953f, -0.000038f, -0.057564f, 0.046126f, 0.014184f, -0.087547f, 0.077042f, -0.080674f, 0.090018f, 0.077792f, -0.007299f, -0.109177f, -0.090065f, -0.050199f, -0.019905f, 0.067624f, -0.018785f, 0.055536f, -0.107878f, -0.005169f, -0.062256f, 0.091671f, 0.024020f, -0.042424f, 0.007678f, 0.047696f, -0.052452f, -0.025856f, -0.069615f, 0.037462f, 0.024957f, 0.113515f, 0.095315f, 0.039545f, 0.016747f, -0.002940f, -0.041884f, -0.015871f, -0.058444f, 0.089919f, 0.058173f, 0.049602f, 0.029932f, -0.030577f, 0.089478f, 0.105226f, -0.088271f, -0.032338f, 0.022533f, 0.050353f, -0.020795f, -0.016138f, 0.061127f, -0.024158f, 0.016139f, 0.042083f, -0.004760f, -0.032585f, 0.006815f, -0.023889f, 0.013670f, -0.072644f, 0.081071f, -0.023462f, -0.062420f, 0.055877f, -0.086863f, -0.090903f, 0.016052f, 0.013546f, -0.058097f, 0.077299f, -0.067638f, 0.021330f, 0.031693f, 0.083469f, 0.051473f, -0.050039f, -0.110864f, -0.006621f, 0.085309f, 0.035800f, -0.052469f, -0.084730f, -0.080799f, 0.050747f, 0.051022f, -0.048405f, -0.055299f, -0.055459f, 0.072369f, 0.038707f, 0.046402f, 0.079188f, 0.090814f, 0.042796f, 0.023074f, 0.008848f, -0.078569f, 0.077629f, -0.034808f, 0.041876f, 0.048916f, 0.017087f, 0.041208f };
-static const float mlp_perf__32_32__1e_05_layer_1_biases[32] = { 0.142593f, -0.048404f, 0.149518f, 0.217482f, 0.050105f, -0.236349f, 0.059351f, -0.181293f, -0.070347f, -0.014309f, 0.117896f, -0.057916f, 0.003164f, -0.233241f, 0.093942f, -0.271074f, -0.118808f, 0.118650f, -0.102150f, -0.302834f, -0.051373f, 0.085573f, 0.230264f, 0.235355f, -0.139103f, 0.261120f, -0.086464f, -0.292799f, -0.109623f, -0.211728f, -0.129011f, 0.053159f };
-static const float mlp_perf__32_32__1e_05_layer_1_weights[1024] = { 0.129172f, 0.229553f, 0.004580f, 0.008782f, -0.071500f, -0.137871f, -0.040739f, -0.140197f, 0.225911f, -0.282815f, -0.311771f, 0.002811f, 0.037837f, 0.273044f, -0.042018f, -0.034928f, 0.167252f, 0.144118f, 0.171648f, -0.140654f, 0.022147f, 0.011363f, 0.052384f, 0.195172f, -0.068745f, -0.172605f, -0.025148f, -0.208314f, -0.316183f, -0.315679f, -0.037041f, -0.024692f, -0.154473f, 0.077816f, -0.018552f, -0.036552f, 0.305347f, 0.292058f, 0.131239f, -0.163087f, 0.192511f, 0.088458f, 0.187821f, 0.043745f, -0.053224f, -0.058957f, 0.302807f, 0.250256f, 0.303429f, 0.135829f, 0.141896f, 0.288721f, -0.165554f, -0.028086f, -0.210638f, -0.293751f, -0.209620f, 0.042875f, 0.257027f, -0.275729f, 0.213718f, -0.234959f, -0.155345f, -0.110426f, 0.099807f, -0.027783f, -0.043129f, 0.176317f, 0.213566f, 0.253590f, 0.207320f, 0.278519f, -0.237947f, 0.315146f, 0.234882f, 0.105615f, 0.151848f, -0.133530f, 0.022636f, -0.183835f, 0.132982f, 0.201748f, -0.204489f, -0.225596f, 0.005625f, 0.108203f, 0.219621f, 0.051082f, 0.178593f, -0.153011f, -0.097312f, 0.185992f, 0.118311f, -0.199751f, 0.256956f, 0.307215f, 0.032635f, 0.165442f, 0.293469f, 0.158865f, 0.058070f, -0.153513f, 0.186917f, -0.151197f, -0.005035f, 0.012244f, 0.034825f, 0.192096f, -0.128712f, 0.232270f, 0.167007f, -0.149907f, 0.182515f, -0.152852f, 0.181524f, -0.150958f, -0.203230f, -0.061868f, 0.312588f, -0.139282f, -0.077022f, -0.277501f, 0.023490f, 0.133354f, -0.294994f, -0.170418f, -0.141524f, -0.183767f, -0.278773f, 0.062984f, -0.214583f, 0.074444f, -0.016321f, 0.306926f, 0.267059f, 0.044572f, -0.298156f, 0.251755f, 0.055373f, -0.182994f, -0.206966f, 0.029272f, 0.055830f, -0.227632f, -0.046235f, -0.154363f, -0.272219f, 0.129336f, 0.220714f, 0.163326f, 0.004711f, -0.057747f, 0.116004f, -0.237629f, -0.023613f, 0.272741f, -0.143329f, -0.312205f, -0.193744f, -0.015216f, -0.005600f, 0.127787f, -0.055740f, -0.036617f, 0.056760f, 0.082402f, 0.246091f, 0.249159f, 0.154150f, -0.138786f, -0.252969f, -0.141276f, 0.024429f, 0.221957f, -0.197024f, -0.305717f, 0.089586f, 0.003264f, 0.002863f, -0.189149f, -0.207526f, -0.011318f, -0.285644f, -0.069139f, -0.103389f, 0.001169f, 0.213724f, -0.269737f, 0.196431f, -0.052403f, 0.273246f, 0.033233f, 0.102918f, 0.107965f, 0.066925f, 0.167092f, 0.146335f, 0.092065f, -0.092152f, -0.275455f, 0.117223f, 0.037253f, -0.294550f, 0.301099f, -0.170645f, 0.263661f, 0.215763f, -0.079927f, 0.096896f, 0.012089f, -0.046831f, -0.204522f, -0.231419f, 0.137551f, -0.245230f, 0.064293f, 0.008349f, -0.182106f, 0.098231f, 0.161644f, 0.026572f, -0.124466f, -0.068155f, 0.131064f, -0.117541f, 0.104094f, -0.108997f, 0.182387f, -0.298377f, -0.175107f, -0.221994f, 0.194131f, -0.069023f, 0.065756f, 0.111214f, -0.321108f, 0.041075f, 0.115493f, 0.125813f, 0.166666f, -0.202873f, -0.107087f, -0.130234f, 0.170748f, 0.122507f, -0.220077f, 0.161132f, 0.247949f, 0.255522f, -0.289981f, 0.257286f, 0.230853f, 0.292301f, 0.028541f, -0.196994f, -0.214710f, -0.016516f, 0.035793f, -0.227346f, -0.312560f, -0.215280f, -0.026393f, -0.045295f, -0.221451f, -0.139862f, 0.095621f, -0.107160f, -0.283287f, -0.008934f, -0.057468f, 0.153716f, -0.293963f, -0.073510f, 0.271483f, -0.123187f, 0.135836f, 0.290165f, 0.308406f, 0.080451f, 0.132922f, 0.309226f, 0.271448f, 0.008025f, -0.174487f, 0.109252f, 0.222976f, 0.205328f, 0.135184f, -0.292840f, -0.021769f, -0.187255f, -0.036963f, -0.097020f, 0.198222f, 0.029138f, 0.232285f, -0.212429f, 0.252991f, -0.088401f, 0.249707f, 0.008375f, 0.227109f, -0.086960f, -0.197819f, 0.139703f, 0.196183f, -0.149270f, -0.025785f, -0.115684f, 0.065050f, 0.196127f, -0.107764f, -0.056197f, 0.175255f, -0.310083f, 0.067883f, 0.148323f, -0.219312f, -0.037665f, 0.193162f, -0.090796f, -0.256963f, -0.239555f, -0.156752f, 0.230994f, -0.275050f, -0.183628f, -0.044457f, -0.149410f, -0.000314f, 0.325670f, -0.003880f, -0.159973f, 0.264150f, -0.096074f, 0.151780f, 0.112829f, 0.069757f, 0.133336f, -0.304471f, 0.003629f, -0.165672f, -0.128387f, -0.219582f, -0.164686f, -0.128049f, -0.197999f, 0.079291f, -0.235631f, 0.013275f, -0.019349f, 0.075558f, -0.110116f, 0.207544f, -0.263157f, 0.241139f, 0.246202f, -0.043995f, -0.040024f, -0.182259f, 0.095136f, 0.227099f, -0.171583f, 0.272891f, -0.304568f, -0.133966f, 0.107142f, 0.292375f, -0.083492f, 0.272253f, 0.227578f, 0.249003f, -0.189286f, 0.142205f, -0.270659f, -0.064482f, 0.075820f, -0.269318f, 0.287282f, -0.297795f, -0.269015f, -0.233389f, 0.141521f, -0.069211f, 0.033698f, 0.056510f, 0.137272f, 0.216780f, -0.184757f, 0.051613f, -0.002950f, -0.125078f, 0.053092f, -0.014366f, 0.040608f, -0.024137f, -0.001998f, -0.249613f, 0.194896f, -0.271393f, 0.056642f, -0.048308f, -0.168523f, -0.029107f, -0.054892f, 0.022634f, -0.156102f, 0.127615f, 0.226763f, 0.102525f, 0.220760f, -0.013384f, -0.307156f, 0.040639f, 0.307507f, -0.089307f, 0.293610f, -0.198887f, -0.265227f, -0.087031f, -0.090536f, -0.059068f, 0.007961f, -0.102173f, 0.204820f, -0.136729f, 0.038026f, 0.101018f, -0.057272f, -0.160548f, 0.167068f, -0.104184f, -0.166091f, 0.176337f, -0.024124f, 0.170349f, 0.127858f, -0.283964f, 0.157640f, -0.194274f, 0.108621f, -0.107597f, 0.021049f, 0.010181f, 0.229695f, -0.043698f, -0.303408f, 0.167613f, 0.050517f, 0.179884f, -0.054885f, 0.206904f, 0.299580f, -0.219252f, 0.282648f, -0.034390f, 0.140367f, -0.285063f, 0.155716f, -0.130014f, 0.115599f, -0.225038f, 0.184878f, -0.166837f, -0.019582f, -0.286024f, 0.130808f, -0.248106f, 0.112639f, -0.055965f, -0.037273f, -0.191085f, 0.122598f, -0.279941f, 0.291179f, 0.045058f, -0.216914f, 0.066938f, -0.016170f, 0.166372f, 0.083545f, -0.286186f, 0.243419f, 0.299503f, 0.141669f, -0.298367f, -0.055081f, 0.137152f, 0.251039f, 0.123639f, -0.087259f, -0.114684f, -0.294177f, 0.076689f, -0.067076f, 0.071901f, 0.264234f, -0.098969f, -0.085778f, -0.199018f, -0.278695f, -0.092355f, 0.202456f, 0.276745f, -0.053655f, 0.184576f, 0.279852f, 0.182203f, 0.288769f, -0.306141f, -0.238409f, 0.127049f, -0.037269f, -0.016477f, 0.012438f, 0.311375f, -0.011539f, 0.269675f, -0.255314f, 0.236198f, -0.087652f, 0.173267f, -0.107019f, 0.062939f, -0.243888f, -0.229652f, -0.234447f, 0.088698f, 0.062844f, -0.226004f, 0.061677f, -0.082081f, 0.051983f, 0.147593f, 0.219066f, -0.105865f, 0.002050f, -0.073437f, 0.282029f, 0.026362f, -0.238376f, 0.154946f, 0.119247f, -0.137849f, -0.188671f, 0.157236f, 0.263382f, 0.093344f, 0.176218f, 0.107387f, 0.287804f, -0.212008f, -0.131669f, -0.151950f, 0.285687f, 0.218777f, 0.161483f, -0.040678f, -0.138120f, 0.101817f, 0.290881f, 0.153536f, -0.050669f, 0.059477f, -0.295678f, 0.166303f, -0.205467f, -0.145426f, 0.090843f, -0.068791f, 0.123047f, -0.175602f, -0.227720f, -0.039042f, -0.178574f, -0.205423f, 0.230234f, 0.108729f, 0.172553f, 0.256737f, -0.299784f, -0.159726f, 0.272547f, -0.046657f, 0.255724f, 0.130773f, 0.115136f, -0.086206f, -0.048780f, 0.111863f, 0.152937f, -0.216281f, 0.233828f, 0.130015f, 0.246066f, -0.068279f, -0.237001f, -0.070252f, -0.228103f, -0.003946f, -0.255297f, 0.150429f, -0.099403f, -0.182798f, 0.154885f, -0.298248f, -0.278022f, 0.027589f, -0.267976f, 0.007088f, 0.305887f, -0.051284f, 0.109064f, -0.095868f, 0.200492f, 0.313525f, 0.162047f, 0.052721f, 0.280387f, 0.256751f, 0.174420f, 0.124757f, -0.275722f, 0.246114f, -0.286086f, 0.272222f, -0.002983f, 0.303536f, -0.271551f, -0.046402f, 0.233947f, -0.073478f, 0.272606f, -0.302506f, -0.096256f, -0.298998f, 0.106279f, -0.075176f, -0.234498f, -0.005387f, 0.042588f, 0.179350f, -0.072784f, 0.194843f, 0.170639f, 0.242530f, 0.114905f, -0.147760f, 0.282714f, 0.271060f, -0.265696f, -0.001059f, -0.274766f, 0.116409f, 0.085611f, -0.293388f, 0.205963f, -0.191952f, -0.251915f, -0.169658f, 0.190717f, -0.131229f, 0.243589f, -0.098578f, 0.087669f, 0.125726f, 0.286785f, 0.195673f, 0.214713f, -0.206828f, -0.253542f, -0.042230f, 0.028484f, -0.134934f, 0.052566f, 0.063444f, -0.086017f, 0.076209f, -0.071815f, -0.112480f, -0.165228f, -0.171105f, -0.295390f, -0.162764f, 0.118768f, 0.290421f, 0.212627f, -0.121510f, 0.232145f, 0.151130f, 0.003079f, -0.049839f, -0.289760f, 0.195441f, 0.290942f, 0.059471f, 0.085621f, -0.227241f, -0.071346f, -0.029469f, -0.216783f, 0.114375f, 0.270517f, 0.024722f, 0.241525f, 0.097153f, -0.021883f, 0.009018f, 0.125561f, -0.291186f, -0.119414f, 0.086094f, 0.096219f, -0.151410f, -0.165815f, 0.180730f, 0.078485f, -0.043409f, -0.246449f, 0.013890f, 0.157073f, -0.103805f, 0.231508f, -0.207817f, -0.227029f, -0.277404f, 0.214043f, -0.144683f, 0.145591f, -0.013927f, 0.180398f, 0.003433f, -0.253846f, -0.079969f, -0.046966f, -0.117092f, 0.022421f, -0.255627f, -0.087967f, 0.278963f, 0.292485f, -0.034172f, -0.047662f, -0.006778f, -0.010179f, -0.024762f, 0.122491f, 0.152680f, -0.249838f, -0.206939f, 0.029543f, 0.089131f, -0.103073f, 0.254959f, -0.250287f, 0.116086f, -0.217581f, 0.221605f, 0.031580f, 0.038770f, 0.046300f, 0.122585f, 0.259729f, 0.145029f, -0.137359f, -0.033222f, -0.066295f, 0.096239f, -0.068837f, -0.264204f, 0.270698f, -0.046180f, 0.260193f, 0.128253f, 0.246393f, 0.184971f, 0.091944f, -0.246167f, 0.196235f, 0.119972f, 0.297918f, -0.200632f, -0.270798f, 0.003353f, -0.097914f, 0.295373f, 0.144380f, -0.017547f, -0.206124f, -0.026367f, -0.005815f, -0.316528f, -0.133826f, -0.156120f, -0.082671f, -0.061399f, -0.127270f, -0.244682f, -0.216222f, 0.130616f, 0.267072f, -0.083530f, -0.203910f, -0.159933f, -0.225267f, -0.171556f, 0.112921f, -0.067631f, -0.170382f, 0.063796f, 0.240550f, -0.309905f, 0.063882f, 0.117773f, -0.058229f, 0.261454f, -0.188267f, -0.296779f, 0.228896f, -0.075339f, 0.186207f, 0.299878f, -0.216423f, 0.194683f, 0.178084f, 0.153027f, -0.048516f, 0.054271f, -0.135394f, -0.298562f, 0.129787f, -0.236469f, -0.132858f, -0.286888f, 0.059662f, 0.209405f, -0.268204f, -0.049174f, 0.220005f, 0.161960f, -0.189921f, -0.141947f, 0.064344f, -0.171685f, -0.110529f, 0.158158f, 0.052750f, -0.231017f, -0.068027f, -0.196323f, 0.045625f, 0.265820f, -0.009243f, 0.191134f, 0.101101f, -0.030611f, 0.272047f, 0.268939f, 0.281306f, 0.220052f, 0.164424f, 0.241012f, -0.194293f, 0.230502f, -0.008794f, -0.215895f, 0.008269f, -0.270221f, 0.233939f, -0.145627f, -0.138689f, -0.048475f, -0.202411f, 0.262036f, 0.112615f, 0.089601f, 0.264350f, -0.224500f, -0.163580f, 0.111037f, 0.110790f, 0.198841f, 0.160845f, -0.280488f, 0.055788f, 0.168732f, 0.246575f, 0.209893f, -0.171199f, -0.164086f, 0.081228f, -0.037295f, -0.068533f, 0.274465f, -0.175669f, 0.225915f, 0.068581f, 0.139412f, 0.174850f, -0.003768f, 0.279516f, -0.020373f, -0.148366f, 0.245712f, -0.017006f, 0.276312f, 0.009118f, -0.167850f, -0.090444f, 0.301664f, -0.174929f, -0.084943f, -0.127127f, 0.153493f, -0.143138f, 0.215314f, 0.267497f, -0.050540f, 0.006868f, 0.175793f, -0.034601f, -0.269776f, 0.012761f, 0.002226f, -0.049792f, -0.143369f, -0.145541f, 0.041697f, -0.222312f, -0.235243f, 0.011786f, -0.071746f, 0.162848f, -0.057363f, 0.252484f, -0.222402f, 0.237415f, -0.201671f, -0.181405f, -0.174279f, 0.159698f, -0.060671f, 0.198255f, 0.085547f, -0.240623f, -0.276432f, 0.072712f, 0.246239f, -0.181802f, -0.050677f, -0.269512f, -0.000005f, 0.202190f, -0.032251f, -0.038034f, -0.167082f, 0.024076f, 0.193464f, 0.040597f, -0.111132f, 0.169679f, -0.250168f, -0.267497f, -0.171472f, 0.009812f, -0.132043f, 0.116459f, 0.194765f, -0.125015f, 0.146258f, -0.170813f, 0.194187f, 0.249607f, -0.074978f, -0.263292f, -0.063866f, -0.093565f, 0.001121f, 0.016699f, 0.248881f, 0.056503f, -0.270408f, 0.110854f, 0.172369f, -0.196054f, -0.185561f, 0.255032f, 0.268082f, -0.247123f, 0.249400f, 0.322164f, -0.004345f, 0.194523f, -0.190406f, 0.007461f, -0.219235f, 0.106865f, -0.060610f, -0.221395f, -0.158934f, -0.245908f, -0.088984f, 0.194224f, -0.008717f, 0.090257f, 0.294524f, 0.104408f, -0.169532f, -0.273348f, 0.212281f, -0.118392f, 0.077096f, 0.238495f, 0.008547f, 0.027849f, -0.059238f, -0.004760f, 0.107100f, 0.056019f, 0.211511f, 0.315467f, -0.056609f, 0.308111f, 0.117597f };
+static const float mlp_perf__32_32__1e_05_layer_0_biases[32] = { 0.18757635f, 0.6970474f, -0.20847116f, -0.3941014f, -1.2997252f, 0.40812585f, -1.9916517f, -1.684615f, -0.36485597f, -1.661048f, 0.7255197f, 2.733672f, 0.0864227f, -0.36783096f, 0.52769727f, -0.20481506f, -0.61007524f, 1.5594505f, 0.04994081f, -0.71618146f, 0.6780388f, -0.4990525f, 1.303413f, -1.2761514f, -0.37292093f, 1.1544601f, -0.10153516f, -0.6548104f, 1.6710496f, 0.24932949f, 0.9166713f, -0.39620858f };
+static const float mlp_perf__32_32__1e_05_layer_0_weights[19200] = { 2.683583e-06f, 9.255959e-06f, 8.780299e-06f, 5.1216552e-06f, -1.1937587e-06f, 4.35775e-06f, -5.3124216e-07f, 2.5128984e-05f, -3.226818e-06f, 6.555095e-06f, -2.5281337e-05f, 8.238532e-06f, 9.644062e-06f, 1.0498738e-05f, 2.064375e-05f, 1.4366564e-05f, -7.2193594e-05f, -1.2554084e-05f, 6.469742e-05f, -0.000104600025f, 7.367532e-05f, -8.688908e-05f, 0.00010689873f, -2.2870354e-05f, 1.0302203e-05f, -5.264587e-05f, 3.8643426e-05f, -5.4963442e-05f, 1.6267568e-05f, -2.1490132e-05f, 2.0264803e-05f, 7.0741924e-05f, 1.6828631e-05f, -4.1138555e-05f, 1.1251186e-05f, -1.8073373e-05f, -5.6629e-05f, -1.8484245e-05f, 1.918116e-06f, 4.341975e-06f, 3.9378676e-05f, -3.267705e-05f, 6.5798e-05f, 6.757606e-05f, 0.00013568603f, 0.000102288875f, -0.00012165762f, -4.905935e-05f, -1.6540293e-05f, 2.1886166e-05f, 1.566546e-05f, 2.0997609e-06f, -1.1059871e-05f, -1.6377759e-05f, -2.0394295e-05f, 2.152773e-07f, -1.7030898e-05f, 2.624463e-05f, 1.0049654e-05f, -1.2870157e-05f, 2.6517248e-05f, 1.6007385e-05f, -1.6027048e-05f, -1.0312175e-05f, 1.7382958e-05f, 4.215672e-05f, 0.00010255827f, -5.9388818e-05f, -8.121885e-05f, -8.822529e-05f, -0.00013513213f, 9.441316e-05f, -1.2045522e-06f, 2.7671429e-05f, -2.0805346e-05f, -3.9018254e-05f, 3.3546166e-05f, -3.3315304e-05f, -8.582604e-06f, -2.439999e-05f, -3.9672366e-05f, -6.6639914e-05f, -6.8863876e-05f, -3.7933834e-05f, -4.056421e-05f, 3.5831795e-06f, 1.85511e-05f, 2.0930103e-05f, -2.2646402e-05f, -1.8992649e-05f, 1.3747585e-05f, 2.3313843e-05f, -3.2233518e-05f, -7.225059e-05f, -3.2405285e-05f, 9.3462724e-05f, 1.5901784e-05f, 2.0374466e-05f, 1.8777042e-05f, -1.4547391e-05f, 9.693208e-06f, -8.455707e-06f, -1.9219688e-05f, -3.2267022e-07f, -1.8906057e-05f, -2.1420505e-05f, -1.8802262e-05f, 7.681141e-06f, 2.6533398e-05f, 2.8108861e-05f, -7.770472e-06f, -1.2295866e-05f, 0.00012807266f, 0.00012658705f, -6.9391645e-05f, 0.00012085529f, -8.3218445e-05f, -8.820672e-05f, 0.00010601528f, -8.523549e-05f, -5.924881e-05f, -1.8437793e-05f, -4.890272e-05f, -1.5758441e-06f, -6.118413e-05f, 2.1380483e-05f, -2.6087811e-05f, 6.6013374e-05f, 3.0426258e-05f, 1.4652516e-05f, 1.991201e-05f, 2.2927472e-05f, -5.0490657e-05f, -1.400031e-05f, 1.8289391e-05f, 5.206748e-05f, 0.00010321885f, -0.00013274992f, 4.639915e-05f, 5.3603675e-05f, 2.1599297e-05f, -2.2696699e-05f, 5.936325e-05f, -0.000108999855f, -1.6436754e-05f, 1.9763447e-05f, 2.7923008e-07f, 2.1945962e-05f, -1.3165318e-05f, 4.464243e-06f, -2.9789453e-07f, -1.6934064e-05f, 9.142582e-09f, -3.64789e-06f, -1.7464802e-06f, -5.886834e-06f, 2.5701527e-05f, -1.3918962e-05f, -2.2584154e-05f, -3.3041783e-06f, 9.928379e-05f, 0.00013536158f, 0.00011183342f, -3.6407553e-05f, -5.038111e-05f, -7.7758654e-05f, 3.694442e-05f, 2.599858e-05f, 1.4640419e-05f, -4.9531758e-05f, 4.5030683e-05f, 3.135015e-05f, 2.0043703e-05f, 1.1302176e-05f, -6.4008396e-05f, -7.882755e-07f, -5.2172432e-05f, -7.815945e-05f, -2.2306958e-05f, -8.0376776e-05f, -7.2984294e-05f, 6.8020825e-05f, -6.385181e-05f, 4.6646123e-06f, -5.407448e-05f, -1.4521447e-05f, -8.7249435e-05f, -9.463724e-05f, -8.6406464e-05f, 0.000120659f, -0.00011991608f, -8.713443e-05f, 2.1214271e-05f, 1.5431238e-05f, 1.077805e-05f, -9.351374e-06f, -1.0089919e-05f, -1.8453267e-05f, 2.1863532e-05f, -6.25019e-06f, -2.2174743e-05f, 9.244048e-06f, -3.7784e-06f, -3.5908217e-06f, 1.7419641e-05f, 1.335065e-05f, 1.8193432e-05f, -2.8924933e-06f, 6.90974e-05f, 5.175322e-05f, 6.653575e-05f, -1.67664e-05f, 9.11418e-05f, -0.000103704966f, -6.764201e-05f, 4.1943385e-05f, 1.2588863e-05f, 7.54504e-05f, -4.708173e-05f, -2.3813674e-05f, 4.1154763e-05f, 3.2614864e-06f, 4.6377027e-05f, -3.384431e-05f, 5.368448e-05f, 1.1523669e-05f, -1.9541064e-06f, -2.3152526e-05f, 5.2829288e-05f, -1.5991176e-05f, -5.3951295e-05f, -7.513005e-05f, 5.404742e-05f, -8.140793e-05f, 8.578458e-05f, -0.00011772123f, -2.2479504e-05f, -7.297069e-05f, -1.4128565e-05f, 5.514467e-05f, -1.262367e-05f, 8.534114e-06f, -1.4758059e-05f, 5.328515e-07f, -5.2392475e-06f, -1.1246563e-05f, 1.6221909e-06f, 1.3396328e-05f, -1.3078383e-05f, 3.05571e-06f, 1.1516882e-05f, -1.6097516e-05f, 3.6017661e-06f, 2.3529177e-05f, -1.5310905e-05f, 1.1870447e-05f, 8.364072e-05f, 9.862552e-05f, -1.9368452e-05f, -9.5801006e-05f, 0.00011146221f, -8.143659e-05f, -2.0468467e-05f, -0.0001297525f, -2.8466953e-05f, 5.2119365e-05f, 3.4252258e-05f, 1.868662e-05f, 1.8096163e-05f, -9.589091e-06f, -7.924834e-05f, -6.1216895e-05f, 6.180265e-05f, 5.0110493e-06f, -1.1240607e-05f, -6.162341e-05f, 4.879461e-05f, 6.884053e-05f, -6.4398235e-05f, 4.2772732e-05f, 3.0424878e-06f, 5.656827e-05f, 9.8688615e-05f, -0.000102232254f, 4.356047e-05f, 0.00012156728f, 9.6824006e-05f, 7.2995263e-06f, -1.1833236e-05f, -6.8110326e-06f, 1.5678093e-05f, 2.2329796e-05f, -5.5143564e-06f, 1.13372635e-05f, -1.4983912e-05f, 8.91358e-06f, -1.4156454e-05f, -3.1504037e-06f, 1.0598352e-05f, 9.100709e-06f, 2.1897707e-05f, 1.9756028e-05f, 1.1301644e-05f, 2.1919901e-05f, -7.641265e-05f, -9.549731e-05f, 5.4884873e-05f, 5.400454e-06f, 0.00010573152f, 0.00014419697f, 0.00011601554f, -0.00011368144f, 6.562192e-05f, -8.259404e-06f, 4.5367306e-05f, 1.8493436e-05f, -2.5703177e-05f, 6.404779e-05f, 5.304063e-06f, -5.0735187e-05f, -1.1857285e-05f, 3.8112525e-05f, -6.607831e-05f, -5.9740058e-05f, -2.5309406e-05f, 7.129883e-05f, -5.2258925e-05f, -2.7551565e-05f, -3.1856318e-05f, -9.131371e-05f, 6.88888e-05f, 2.5271685e-05f, 9.87065e-05f, 0.00011332182f, 5.0370905e-05f, 9.142979e-05f, 8.460593e-06f, 1.5405938e-05f, -1.1842346e-05f, -3.042691e-06f, -1.3817512e-06f, 5.12696e-06f, -6.486314e-06f, -5.4921893e-06f, -1.8979179e-05f, 3.5065552e-06f, -1.0483668e-05f, -7.353057e-06f, 1.1556378e-05f, -1.7266622e-05f, 1.3700673e-05f, 9.98916e-07f, 0.0001117109f, -2.2691745e-06f, -9.262559e-05f, 3.1834916e-05f, 1.6023681e-05f, -7.824546e-05f, -7.431579e-05f, -0.00012358985f, -3.3928084e-06f, -4.144822e-05f, -1.0754967e-05f, 4.0123134e-05f, -4.1483654e-05f, -6.169065e-05f, 5.0613082e-05f, 2.8325816e-05f, -1.5793632e-05f, 7.226106e-05f, -1.6471895e-05f, 2.3377281e-06f, 1.2759542e-05f, -6.636441e-05f, 3.9787803e-05f, 5.120262e-05f, 8.2447856e-05f, 1.620919e-05f, 6.467669e-05f, -7.0415704e-06f, 0.00012228644f, 3.0753745e-05f, -0.00010671417f, -7.9958634e-05f, 1.0824477e-05f, 1.990246e-05f, 1.52582525e-05f, -5.679012e-06f, 2.1776793e-06f, 5.7475445e-06f, -1.3157453e-05f, -1.0127725e-05f, -6.8656627e-06f, 4.0728693e-08f, 6.172832e-06f, 1.220732e-05f, -5.268168e-06f, -4.1149265e-06f, -2.3202518e-05f, -1.6952212e-05f, 0.00011156828f, -3.4564524e-05f, -6.2808234e-05f, 9.5276555e-05f, 9.870873e-05f, -5.53545e-05f, 2.4753332e-05f, -0.00010407493f, -6.7628425e-05f, -5.9890885e-05f, -2.8774359e-05f, 5.238594e-06f, 1.1172771e-05f, -6.685556e-05f, 1.7871724e-05f, 3.7794132e-05f, 1.3414389e-06f, -6.854803e-07f, -4.3130535e-06f, 3.3904635e-05f, -4.7401827e-05f, -5.7372254e-05f, 5.6189223e-05f, 3.9153743e-05f, -9.423355e-05f, -5.5590776e-06f, -1.5997544e-05f, 3.1131938e-05f, 0.00010550643f, 6.85358e-05f, 6.61475e-05f, -0.000115451985f, -1.32275845e-05f, 1.4976233e-06f, -1.4227531e-05f, -5.1648217e-06f, -9.0089185e-07f, -2.3128649e-05f, -2.4413732e-06f, -1.4360697e-05f, -1.03891125e-05f, 1.9344348e-05f, -1.1615562e-05f, 9.72818e-06f, -1.5164773e-05f, 2.3368026e-05f, 6.2765694e-06f, 1.7310458e-05f, -8.935724e-05f, 5.771686e-05f, 1.3862285e-05f, 8.070446e-05f, 3.767799e-05f, 3.0333955e-05f, 6.3272666e-05f, -5.56553e-05f, 3.257473e-05f, 7.8527926e-05f, 5.674808e-05f, 1.833215e-05f, -6.539875e-05f, -1.3724987e-05f, -3.138456e-05f, -6.0276193e-06f, -1.8338515e-05f, 2.4934634e-05f, 6.5385815e-05f, -4.0310773e-05f, 6.186179e-05f, -6.295505e-05f, 3.9811816e-06f, -4.0588984e-06f, -6.359808e-05f, 1.7247507e-05f, 7.0310656e-05f, 5.1809498e-06f, 0.00011903012f, 5.4564633e-05f, -9.3629955e-05f, -2.213709e-06f, -1.8007862e-05f, 5.0492417e-06f, -1.0955782e-05f, -1.8427341e-05f, 2.0465555e-05f, -1.271973e-06f, -1.5019108e-05f, 1.748597e-05f, -9.993619e-07f, 6.35659e-06f, -1.2850173e-05f, 1.8607363e-05f, 1.34510865e-05f, 2.413313e-05f, -1.0550452e-05f, -8.801731e-06f, 5.8175447e-05f, -4.4321234e-05f, -4.0080784e-05f, -3.9249662e-05f, 7.1848185e-06f, 9.936547e-05f, -8.052774e-05f, 7.675224e-05f, -7.4918357e-06f, 4.4022025e-05f, -6.0272504e-07f, 6.6716246e-05f, -7.362268e-05f, -5.6717505e-05f, -2.498241e-05f, 1.8139497e-06f, 2.5790941e-05f, -3.857413e-05f, 6.2300234e-05f, -4.576855e-05f, 5.7609144e-05f, -3.7172947e-05f, 3.558266e-05f, -5.525178e-05f, -1.271759e-05f, -9.5302625e-05f, 7.805678e-05f, -1.4498074e-06f, 7.1995484e-05f, 5.256986e-05f, 9.301713e-05f, -5.960182e-05f, -1.0412384e-05f, -1.2438067e-05f, 1.3289095e-05f, 4.0143364e-06f, 9.457059e-06f, 1.0837241e-05f, -9.154685e-06f, -4.564744e-06f, 6.941826e-06f, 4.5432885e-06f, 6.053788e-06f, -8.702468e-06f, 1.698203e-05f, 5.6761096e-06f, 7.0706483e-06f, 2.2681932e-05f, 5.261561e-05f, -5.0871913e-05f, 7.872724e-05f, 6.0955677e-05f, 6.4493855e-05f, -7.865454e-05f, 1.9498327e-06f, -3.8128295e-05f, 5.894452e-05f, 2.2826136e-05f, 1.8212093e-05f, -5.076937e-05f, 5.5203902e-05f, -7.836707e-06f, 4.0841693e-05f, -7.209131e-05f, 3.890502e-05f, 2.638816e-05f, -3.7935566e-05f, -4.596111e-05f, -1.6517266e-05f, -2.2296346e-05f, 3.4414243e-05f, 5.1665455e-05f, 7.707492e-05f, -8.1718164e-05f, -4.817154e-05f, 5.366735e-07f, 9.020418e-06f, -5.138026e-06f, 6.0884136e-05f, 7.9050646e-05f, -1.5219421e-05f, 3.5461446e-06f, 1.9436344e-05f, -9.80353e-07f, 1.995816e-05f, -2.6864134e-06f, 7.5277576e-06f, 1.7099053e-05f, 8.927505e-06f, -1.3723948e-05f, -2.4658036e-06f, 1.9149313e-05f, -1.4777341e-05f, -1.08157665e-05f, 3.5159983e-06f, 7.4596637e-06f, -1.7613585e-05f, -5.0968647e-05f, -3.759169e-05f, -8.017256e-05f, -4.0499723e-05f, 8.4013394e-05f, -4.7615584e-05f, -1.8617924e-05f, 5.040346e-05f, 5.6798188e-05f, -6.168004e-05f, 1.4414658e-05f, 8.435244e-06f, 5.09623e-05f, -6.327542e-05f, -6.1437363e-06f, 3.7450623e-05f, 3.4413046e-05f, -7.3300753e-06f, 4.4863635e-05f, -1.3291686e-05f, -1.5958514e-05f, -3.3781635e-05f, 1.7999364e-05f, 7.355552e-05f, 2.1217373e-05f, -0.00010732394f, -4.3903136e-05f, 0.0001244627f, 4.5455432e-05f, -8.506679e-05f, -2.2898934e-05f, 9.571453e-06f, 8.926079e-06f, -1.0833094e-05f, 9.462531e-06f, 1.7501581e-05f, -1.4193576e-05f, 1.3465519e-05f, 8.576383e-06f, 1.4705147e-06f, -1.5452619e-05f, -9.655948e-06f, 7.171175e-06f, 9.257891e-06f, 6.418182e-06f, 1.3715953e-05f, 2.2544777e-05f, 4.2505984e-05f, 5.5033946e-05f, -5.4489556e-05f, -3.8318423e-05f, -1.4012667e-05f, -5.943944e-05f, -8.013676e-05f, -4.4306735e-06f, -5.4394615e-05f, 5.6566874e-05f, -5.6971436e-05f, -4.7564827e-06f, -3.3578104e-05f, -5.6220873e-05f, 3.9027258e-05f, 1.7726077e-05f, 6.4555124e-06f, 4.439249e-05f, 3.3641063e-05f, 5.0719277e-06f, 1.3925775e-05f, 1.3934448e-05f, 3.547519e-05f, -3.6279504e-05f, -5.0925293e-05f, -6.779435e-05f, 9.2531336e-05f, 1.7241513e-05f, 1.9287174e-05f, 1.7302644e-05f, -5.059246e-05f, 1.1316229e-05f, 1.1515039e-05f, -7.619599e-06f, -4.1979493e-07f, 5.736386e-06f, 9.991429e-07f, 8.081661e-06f, -1.8912237e-05f, 5.974941e-09f, -1.4812352e-06f, 1.0732049e-06f, 1.573297e-05f, 1.7309413e-06f, 1.3316453e-05f, -1.0741187e-05f, -1.827636e-07f, 1.5306026e-05f, 2.244928e-06f, -1.1202679e-05f, 5.6516878e-05f, -6.431068e-05f, -7.804216e-05f, -5.2329597e-05f, 5.3774973e-05f, 2.4498997e-06f, 1.6084785e-05f, -8.834729e-07f, -4.6483518e-05f, 1.7197883e-05f, 3.9158866e-05f, -6.1850886e-05f, 3.4082466e-05f, 1.373275e-05f, -3.6441772e-05f, -1.8035724e-06f, 9.605873e-06f, -2.633675e-05f, 3.179551e-05f, -6.3507687e-06f, -1.7654771e-05f, 1.0837591e-05f, 3.277001e-05f, -2.4481516e-05f, -4.9314345e-05f, 8.747903e-05f, -1.5220157e-05f, -8.203819e-05f, -3.4934186e-05f, -2.5050147e-05f, 6.722385e-06f, -1.1789551e-05f, 2.012451e-05f, 1.3767729e-05f, -1.6324078e-05f, 9.45754e-06f, 2.2746606e-05f, 2.1984964e-05f, 9.317373e-06f, -1.6757087e-05f, -1.2012675e-05f, -1.67573e-05f, 1.7529577e-05f, 7.9521515e-06f, -1.51648255e-05f, 1.2791128e-05f, 5.3639375e-05f, 6.9787435e-05f, -3.3543e-05f, -3.639158e-05f, -7.487303e-05f, 3.607507e-05f, 5.848816e-05f, -4.3327942e-05f, -2.654015e-06f, 3.2581116e-05f, -7.831897e-06f, 5.2992495e-05f, -3.823475e-07f, -6.755595e-05f, -8.292706e-06f, 1.292073e-05f, -2.6805223e-05f, 1.626976e-05f, -2.4953713e-05f, 1.264726e-05f, -9.810804e-06f, -1.1191962e-05f, -1.0257638e-05f, -3.0281435e-05f, 8.791574e-06f, -4.018108e-05f, 6.799901e-05f, -6.388469e-05f, -3.4626915e-05f, 1.684192e-05f, -1.5258539e-05f, -2.5054864e-05f, -9.544196e-07f, -1.2742775e-05f, 1.9406534e-05f, -2.636813e-06f, -1.7743772e-05f, -7.956844e-06f, -8.2368337e-07f, 1.8577943e-05f, 7.3356896e-06f, 2.1091362e-06f, 6.119225e-06f, 7.5893063e-06f, 2.2253433e-05f, -1.0962473e-05f, -1.0904242e-05f, 1.0097318e-05f, 3.2004464e-05f, 5.882072e-05f, 5.612772e-05f, -5.772236e-05f, -7.0885246e-05f, 5.322316e-05f, -5.752385e-05f, -3.2237032e-05f, -8.3921395e-06f, -1.1696362e-07f, 2.8913288e-05f, -2.740589e-05f, 5.8475844e-06f, -4.7294478e-05f, -9.207901e-07f, -4.7449634e-05f, 2.343e-05f, -1.7867346e-06f, 2.6287573e-05f, 1.5505942e-05f, -9.468529e-06f, -4.094954e-05f, -1.7347891e-05f, 1.75725e-05f, 5.5222918e-05f, 8.437685e-05f, -0.00010810568f, -8.6994216e-05f, 0.000116899624f, 2.3757779e-05f, 7.681756e-07f, 5.5081528e-05f, -1.2652163e-05f, 1.7657372e-05f, -1.7524622e-05f, -1.8189487e-05f, 2.1483987e-05f, 1.7375505e-05f, -1.2916763e-05f, 3.82101e-07f, -9.294997e-06f, 2.0762624e-05f, -3.0167953e-06f, 9.323435e-06f, -6.341278e-06f, -1.3627644e-05f, -1.3746528e-06f, 1.8847219e-05f, 3.334338e-05f, 5.6440945e-06f, 4.1585125e-05f, 4.9542145e-05f, -2.890849e-05f, 1.8755738e-05f, -4.1100477e-05f, 2.762759e-05f, 4.489119e-05f, -3.7592752e-05f, -9.256913e-07f, 4.937381e-05f, 2.018121e-05f, -2.7037022e-05f, 3.1192096e-05f, 4.1840678e-05f, -3.1184605e-05f, 1.4917875e-05f, -2.3963888e-05f, 2.3691839e-05f, -1.2252925e-05f, -2.3597831e-06f, 2.5308114e-05f, 2.2704411e-05f, -7.410066e-05f, -8.695902e-05f, 1.7367514e-06f, 2.8942912e-05f, 0.000114839786f, -2.3992121e-05f, -4.3249856e-05f, -9.136438e-06f, -2.0542262e-05f, -1.1200203e-05f, 2.0640226e-05f, -7.9876945e-06f, 1.8646735e-06f, -6.8853296e-06f, -6.4984324e-06f, 2.1700027e-05f, -5.802502e-06f, -9.311416e-06f, 1.2336215e-05f, 1.6617309e-05f, 8.960503e-06f, -9.959618e-06f, -2.074847e-05f, 4.503095e-06f, 1.5862697e-05f, -4.0961142e-05f, 1.8822018e-05f, 2.3603932e-05f, -6.0045888e-05f, 1.7905111e-05f, -3.0616393e-05f, 4.9779696e-06f, 2.4136967e-05f, -3.4532623e-05f, -2.6311318e-05f, 2.2764947e-05f, 3.845825e-05f, 3.56152e-06f, -3.995092e-05f, -3.1784796e-06f, -1.954811e-05f, 2.4677658e-05f, 1.4012121e-05f, -2.802662e-05f, -2.7483342e-05f, -3.6603257e-07f, 1.2369728e-05f, -2.2210503e-05f, -3.042762e-06f, -0.00011013071f, 9.016696e-05f, -8.617881e-06f, -7.907028e-05f, 4.250577e-05f, -5.9339323e-05f, -9.596286e-05f, 1.5879494e-05f, -2.9792588e-07f, 1.4215999e-05f, 1.4670359e-05f, -1.7909057e-05f, -9.739867e-06f, 1.6347437e-06f, 2.2631046e-05f, -2.0406555e-05f, -1.3001824e-05f, -2.069772e-06f, -1.4418086e-05f, -1.4410774e-05f, 5.991479e-06f, -1.329084e-05f, 6.382424e-06f, -9.123791e-06f, 5.5305763e-06f, -2.1097132e-05f, -3.853083e-05f, -3.2361913e-05f, -4.5738965e-05f, -3.1084597e-05f, -3.95643e-06f, -2.8047645e-05f, 1.0438404e-05f, -2.9817578e-05f, -4.2724572e-05f, 3.791023e-05f, 1.667565e-06f, 4.06071e-05f, -2.4958708e-05f, 4.8210313e-07f, -8.4991425e-06f, 6.2510644e-06f, -1.528472e-05f, 2.9667408e-05f, -1.4846888e-05f, 1.0423323e-05f, -2.1471655e-05f, -9.71298e-05f, 9.628109e-05f, 3.106538e-05f, -7.4753434e-06f, 7.906393e-05f, 3.7945763e-05f, -7.867089e-05f, -7.0862974e-05f, -3.2265077e-06f, -1.6874028e-05f, 1.8529043e-05f, 1.6703805e-05f, 1.1529954e-05f, -2.231615e-05f, 5.0914637e-06f, -8.689056e-06f, -1.250517e-05f, -8.303443e-06f, 1.3528121e-05f, 1.6055106e-05f, -7.721917e-06f, -3.8616054e-06f, 4.139436e-06f, -3.2078742e-06f, -1.37267125e-05f, -1.16832625e-05f, 3.7247553e-06f, -2.4243267e-05f, 2.2689523e-05f, -4.0245526e-05f, -3.0572115e-05f, 2.9312692e-05f, -4.155382e-05f, -1.369998e-05f, -4.6240515e-05f, -2.305162e-05f, 4.0864543e-05f, 2.633801e-05f, -2.3215964e-05f, -1.6643182e-05f, -3.1004125e-05f, 3.5682493e-05f, -9.915426e-06f, 3.1213873e-05f, 4.273296e-06f, -4.2096513e-06f, -2.1666207e-05f, 3.0044124e-05f, -4.3467393e-05f, 7.066965e-06f, -8.5034444e-05f, -4.188769e-05f, -7.9989666e-05f, -2.164445e-05f, -9.009418e-05f, 1.2996717e-06f, -7.270671e-06f, -1.5625146e-05f, -1.7129985e-05f, 7.860351e-06f, -1.5534129e-06f, -1.438473e-05f, -1.7082775e-05f, -1.821515e-05f, 5.6677186e-06f, 2.0878792e-06f, -9.07501e-07f, 1.9900153e-05f, 1.5410651e-05f, 2.1548445e-05f, 1.2783504e-05f, -1.8228942e-05f, -1.508009e-05f, 2.6265645e-05f, -1.6440395e-05f, -4.8775477e-05f, -4.3512693e-05f, 9.265483e-06f, 2.511739e-05f, -5.0902712e-05f, -3.0346979e-05f, 1.32798e-05f, -2.4278863e-05f, -2.9582014e-05f, 2.6750044e-05f, 2.9559636e-05f, -1.2026628e-05f, 7.4235904e-06f, -1.598138e-05f, 5.3456292e-06f, -6.1943056e-06f, 4.060179e-06f, -1.1952444e-05f, -2.2081962e-05f, 1.7062397e-05f, -4.1857515e-06f, -7.154995e-05f, 1.3543421e-05f, 3.4137593e-05f, -6.7664455e-06f, -6.802668e-05f, 3.8370567e-06f, -2.325505e-05f, -4.7126094e-05f, -1.21745925e-05f, -2.9299267e-07f, 9.290404e-06f, 1.1706575e-05f, 8.806082e-06f, -9.9151075e-06f, 1.9455258e-05f, -1.3162255e-05f, 1.3967995e-05f, 1.1340653e-06f, 1.0132576e-05f, 1.5945936e-05f, 1.2340368e-05f, 1.5748425e-05f, 4.354377e-06f, 1.3831907e-05f, 4.681567e-05f, -3.8787264e-05f, 1.0713788e-05f, -1.0871822e-05f, 3.4301975e-05f, -6.9818766e-06f, 1.3547555e-05f, -7.741891e-06f, 6.266918e-06f, -4.1434458e-05f, -1.073675e-05f, -2.0980833e-05f, 2.0040838e-05f, -1.644796e-05f, 3.533464e-05f, -3.0024556e-05f, -7.390145e-06f, 2.3717388e-05f, -1.4225367e-05f, 1.7244753e-05f, -2.2605183e-05f, 1.8079789e-05f, 1.2799472e-05f, -1.8049744e-06f, -7.581722e-05f, -3.9175146e-05f, -7.1083625e-05f, 5.1790803e-06f, 1.580039e-05f, -1.9592235e-05f, 5.1427156e-05f, 3.5431993e-05f, -1.9319834e-05f, 2.776103e-06f, -2.0003023e-05f, -1.5018184e-05f, -1.7827477e-05f, -1.8118271e-05f, 1.408484e-05f, -1.4787896e-05f, 1.2282763e-05f, 6.8205854e-06f, 1.5909543e-05f, -1.3201443e-05f, 1.0189804e-05f, -4.206184e-06f, 6.5802387e-06f, 2.0779678e-05f, 4.1426436e-05f, -2.2946011e-05f, 8.286839e-07f, -2.1968774e-05f, 9.585647e-06f, 1.1596801e-05f, 5.322907e-06f, 1.5096484e-05f, -3.1371426e-05f, 4.7674966e-06f, -4.397821e-05f, -3.0232109e-06f, -3.1061187e-05f, 2.2009923e-05f, 1.0652675e-05f, -3.820651e-05f, 1.9342713e-05f, 9.268814e-06f, -1.7881846e-06f, -5.3995827e-06f, 2.6408741e-05f, -3.2645568e-07f, -1.07911255e-05f, 3.8278868e-06f, -8.807943e-05f, -1.4960358e-05f, 7.425751e-05f, -1.5539239e-05f, 6.882274e-05f, -7.482316e-05f, -5.0705494e-05f, 3.5471465e-05f, -1.5903282e-05f, 7.007479e-06f, 6.837176e-06f, 7.7397135e-06f, -2.3372882e-05f, -1.2133123e-05f, 1.3275785e-05f, 2.9128266e-06f, -1.9478879e-05f, 2.3012039e-05f, 2.7377062e-06f, -1.1590785e-05f, -3.9739834e-06f, 3.852483e-06f, -1.686706e-05f, -1.1744086e-05f, -2.9968198e-05f, 4.5553435e-05f, -4.7839065e-05f, 1.5803565e-06f, -6.088958e-05f, -6.212558e-06f, 1.0561349e-05f, -4.2806303e-05f, 1.0888604e-05f, -2.5119902e-05f, 2.782639e-05f, -1.8722258e-05f, 2.870857e-06f, -3.3696506e-05f, -9.8234906e-08f, 4.9682108e-06f, 4.485455e-06f, 2.2786595e-05f, 2.0235677e-05f, -1.1184139e-05f, -2.0816095e-05f, -1.6088752e-05f, -1.46618695e-05f, -2.3042248e-05f, -4.2148848e-05f, -3.7584483e-05f, -0.000105064464f, -8.6370776e-05f, 6.7389934e-05f, 5.5294662e-05f, 3.7595488e-05f, 2.5684314e-05f, -2.2561853e-06f, 1.665621e-05f, 1.65281e-06f, -1.0153608e-06f, 1.632255e-05f, -1.967353e-05f, -7.342061e-06f, -3.5401554e-06f, -4.351112e-06f, -1.7106444e-05f, 2.306717e-05f, 1.4206661e-05f, -3.96667e-06f, -8.113733e-06f, -5.760879e-06f, -6.634108e-06f, -2.9817873e-05f, -2.0246718e-05f, 1.9890476e-05f, -2.226952e-06f, 1.2893156e-05f, 4.2866628e-05f, -1.9046375e-06f, -6.410018e-06f, 4.3672773e-07f, 7.294712e-06f, 3.0407857e-05f, -3.546273e-05f, 1.4876658e-05f, 1.7248725e-05f, -1.4195304e-05f, -2.0530977e-05f, 2.3280005e-05f, 4.486699e-06f, -2.892635e-06f, -1.5095783e-05f, 1.5559972e-05f, 1.4008358e-06f, -1.1871821e-05f, -1.0547615e-05f, -5.383262e-06f, -3.2382857e-05f, -3.0537813e-05f, 6.6957626e-05f, -7.645819e-05f, -8.8993336e-05f, -6.281877e-05f, -7.3253127e-06f, -9.610363e-06f, -1.8088513e-05f, 7.046754e-06f, -1.0169144e-05f, -1.4410843e-05f, -1.47544215e-05f, -1.8722964e-06f, 2.2609713e-05f, -1.3303485e-05f, 8.476643e-06f, -1.38997975e-05f, -1.7575874e-05f, -3.0383471e-06f, 1.2838102e-05f, 6.8731883e-06f, 1.4043866e-05f, 2.3530712e-05f, 1.5962318e-05f, 3.288248e-05f, 6.6646285e-06f, 5.002067e-06f, -1.2935765e-05f, 3.9281327e-05f, -2.5674783e-06f, -8.977951e-06f, 1.0537707e-05f, 9.2658365e-06f, 2.8935756e-05f, -2.9891758e-05f, -3.9140104e-05f, 1.8264425e-05f, 1.862332e-06f, -2.5194553e-05f, -1.3093851e-06f, -1.1226243e-05f, 1.3709522e-05f, -1.1166357e-05f, -2.5788817e-05f, 2.0865346e-05f, -2.0281379e-05f, 1.8325136e-05f, -2.2707129e-05f, -7.8259596e-05f, 8.474502e-05f, -5.261455e-05f, -8.16626e-05f, -4.9447914e-05f, -5.7695135e-05f, 5.606783e-06f, -2.3250063e-06f, -1.8072258e-05f, -1.3135972e-05f, 1.6185313e-05f, -2.2584756e-05f, 1.7269437e-06f, 1.3851226e-05f, -3.0753213e-06f, -1.3292005e-05f, -1.1262468e-05f, 2.1136626e-05f, 1.2181715e-06f, 2.1745036e-06f, 5.698885e-06f, -1.9921375e-05f, 2.7503105e-05f, 4.6245244e-05f, -5.8400623e-05f, -3.566072e-06f, -2.2997676e-05f, -2.8408695e-05f, 9.269761e-06f, 3.1474978e-05f, 2.4000556e-05f, -1.6319014e-05f, 1.8304387e-05f, 2.0452813e-05f, -1.8459756e-05f, -2.6404587e-05f, 1.8092886e-05f, 2.3298558e-06f, 2.279076e-05f, -1.7976716e-05f, 1.7561964e-05f, -6.555464e-06f, 1.5640508e-05f, -8.550803e-06f, 1.5811209e-05f, 2.3820836e-05f, -2.0463174e-05f, 6.096805e-05f, -5.0994182e-05f, 5.1837123e-05f, -9.523647e-05f, -6.5464665e-05f, 6.930721e-05f, -1.692301e-05f, 6.483662e-06f, 1.8368277e-06f, -1.148471e-05f, -1.1701422e-05f, -2.3110335e-06f, -9.385478e-06f, -2.4607043e-06f, -1.7703192e-05f, 5.2669757e-06f, -1.8445644e-05f, 9.121425e-06f, 9.999065e-06f, 3.230188e-06f, 2.3091534e-05f, -1.2382917e-05f, 1.685278e-05f, 2.6908257e-05f, 2.6788694e-05f, -1.4828559e-05f, 3.5070763e-05f, -1.0260046e-05f, 1.2196532e-05f, 3.6224355e-05f, 1.848861e-05f, -1.4610599e-05f, 2.2212025e-05f, 9.027195e-06f, 1.4622437e-06f, 9.844708e-06f, -3.574818e-05f, -2.0752661e-05f, 9.311964e-06f, 5.0309086e-06f, 9.327022e-06f, -8.350095e-06f, 1.592574e-05f, -1.6849093e-05f, -1.6838063e-05f, -2.265235e-05f, 3.1944444e-06f, 5.7526526e-05f, 5.4168217e-05f, 7.2513576e-05f, 4.7073325e-05f, 7.158237e-06f, 7.206562e-05f, 1.978877e-05f, -4.505798e-05f, 3.711188e-07f, 7.95839e-06f, -8.1323515e-06f, 1.1930626e-06f, 1.6011036e-05f, 6.7832507e-06f, -1.7259978e-05f, -7.998032e-06f, -9.4542775e-06f, -2.7496878e-06f, 6.742719e-06f, 1.5950533e-05f, 2.0834783e-05f, -1.6160475e-05f, 4.920772e-06f, 5.3192944e-06f, -4.2189995e-06f, 3.060924e-05f, 1.776352e-05f, -3.566858e-06f, 2.3416287e-05f, -3.812879e-05f, -2.9893667e-05f, -3.488905e-05f, -7.5840553e-06f, -2.7161279e-05f, 1.0435024e-05f, 1.4008561e-05f, 2.6129477e-05f, -5.6918034e-06f, -1.3539644e-05f, -2.8598739e-05f, 1.4075864e-05f, 7.327467e-06f, -2.0165276e-06f, -1.998165e-05f, -8.716303e-06f, -4.396687e-06f, -1.0120139e-06f, 9.65202e-07f, -7.7554054e-05f, -3.799931e-05f, 3.9639013e-05f, 3.6189318e-05f, -5.110552e-05f, -2.1029095e-05f, 5.446041e-05f, -8.469484e-05f, 2.1591077e-05f, -1.8645544e-05f, -6.075007e-06f, 1.19589995e-05f, 7.2868454e-07f, 1.47253795e-05f, -1.4000856e-05f, 4.724381e-06f, -7.798381e-06f, 2.387483e-05f, 1.8954583e-05f, -7.4828636e-06f, -1.0161379e-05f, -2.8611087e-06f, -9.529645e-06f, -1.4461786e-05f, -3.5414487e-05f, 5.3835824e-06f, -1.02804315e-05f, 2.9526664e-05f, 1.2481488e-05f, 4.9678833e-06f, 1.5562465e-06f, -3.2026364e-05f, 2.020454e-06f, 8.588486e-06f, 1.9353278e-05f, -1.7788234e-05f, -2.439656e-05f, -3.862537e-06f, -1.020242e-05f, 2.5404566e-05f, -1.0690869e-05f, -2.5332334e-05f, 1.21850835e-05f, 6.930871e-08f, 1.4394299e-05f, -2.5386864e-05f, 4.3455543e-06f, -1.9039511e-05f, 7.3291194e-05f, 3.188648e-05f, -4.589714e-05f, 7.75788e-05f, -4.427393e-05f, 3.3414963e-05f, -4.6025154e-05f, 3.4071243e-05f, -1.0028734e-05f, -8.606897e-06f, -1.6392556e-05f, -1.4639148e-05f, -9.0879513e-07f, -7.3886767e-06f, 2.566649e-06f, 6.493415e-06f, 1.0398502e-05f, 1.3562181e-05f, 2.8942134e-06f, -8.084221e-06f, -1.0100359e-05f, 2.29506e-05f, -2.24138e-05f, -6.7534806e-06f, 2.3462859e-05f, -6.119817e-06f, 3.8580816e-05f, -5.018288e-05f, 1.3152076e-05f, 8.8823035e-06f, -4.598669e-05f, 2.7716966e-05f, -1.9758916e-05f, -2.5404812e-05f, -1.474948e-05f, 1.855821e-05f, 6.908786e-06f, -1.9781555e-05f, 7.161536e-06f, 6.4095907e-06f, -5.399509e-06f, -1.9230325e-05f, -1.7396187e-05f, -3.529734e-06f, 9.268814e-06f, -1.487538e-05f, 2.3139033e-05f, 1.2342022e-05f, -8.2791754e-05f, -3.339179e-05f, 3.5168363e-05f, 6.206673e-05f, -5.0499984e-05f, 4.018875e-05f, -8.220866e-05f, -8.491239e-05f, -9.4053585e-06f, 1.3128427e-05f, 1.5853966e-05f, 7.21776e-06f, -7.4754935e-06f, 7.725938e-06f, -1.7201552e-05f, -1.1052182e-05f, -1.4542355e-05f, -1.1532407e-05f, -3.7589273e-06f, 2.6459772e-06f, 1.3800388e-05f, 1.1562396e-05f, 1.3004975e-05f, -2.9615792e-06f, -2.5256331e-06f, -1.47757855e-05f, 6.449152e-06f, -4.290475e-05f, -1.1615485e-05f, 3.1454223e-05f, 5.68009e-06f, -4.732719e-05f, 1.38101295e-05f, -6.5221975e-08f, -2.1572932e-05f, 2.2217104e-05f, 1.4011901e-05f, -4.632148e-06f, 7.915172e-06f, 1.15973e-05f, -2.0847512e-05f, 2.073413e-05f, -7.0992746e-07f, -1.2308621e-05f, 2.5549978e-05f, 1.24580665e-05f, 2.3452061e-05f, 4.2212773e-06f, 1.7231521e-05f, 5.068554e-05f, 2.5193508e-06f, 4.5958237e-05f, 5.500891e-05f, 2.6377144e-05f, -2.8286571e-05f, -4.6030655e-05f, 1.0870279e-05f, -4.4568965e-06f, -1.9914557e-06f, -6.5664485e-06f, -1.2059438e-05f, -1.133767e-05f, -3.1360532e-06f, -7.218278e-06f, 4.4783405e-06f, -6.5423487e-06f, 5.423872e-06f, 5.0691133e-06f, 5.10385e-06f, -1.971278e-05f, -9.509515e-06f, 1.4150207e-05f, -2.3698072e-05f, 1.5231625e-05f, 7.972913e-06f, -1.871394e-05f, -3.1494452e-05f, -8.358234e-06f, -1.455307e-05f, 1.5787964e-05f, -9.488421e-06f, 1.0582472e-06f, 1.0731074e-05f, 6.498354e-06f, -6.3586367e-06f, -2.7106314e-06f, 1.576495e-05f, -1.642181e-05f, -1.19269225e-05f, -7.5552152e-06f, -7.0446686e-06f, 9.195668e-06f, -1.2746663e-06f, 1.8523951e-05f, 2.484142e-05f, -1.597049e-05f, 6.6571665e-05f, -5.3543423e-05f, 5.139343e-05f, -1.9779336e-06f, -6.622519e-05f, 4.943661e-05f, -6.497774e-05f, 1.0753109e-05f, -1.2061916e-05f, -1.12773705e-05f, -1.4946654e-06f, 1.4042432e-05f, -6.8201675e-06f, 1.9234762e-05f, 8.079251e-06f, -4.288108e-06f, 1.2706267e-05f, 8.242974e-06f, -8.830874e-06f, 1.059811e-05f, -1.2980771e-05f, 2.2507378e-05f, -4.9509363e-06f, -1.3121686e-06f, -1.0580075e-05f, 4.4589583e-06f, 2.4758274e-05f, -1.8193274e-05f, 2.886904e-05f, 2.7963177e-05f, -4.315379e-05f, -2.944762e-05f, 1.4942449e-05f, -2.5052099e-05f, -9.4658e-06f, 2.0553778e-05f, -2.8179818e-05f, -5.990526e-06f, -4.9687863e-08f, 1.4193208e-05f, -1.4405253e-05f, -2.0855827e-05f, 6.0121242e-06f, 1.1646729e-05f, 4.9068035e-06f, -2.5021447e-05f, 1.5062328e-05f, 1.3074615e-05f, 2.5464988e-05f, -4.750936e-06f, 6.0881404e-05f, 4.123926e-05f, -7.619159e-05f, 3.209596e-05f, 2.7095015e-05f, -7.86481e-05f, 2.8770546e-07f, -1.1467118e-05f, -1.0800812e-05f, 2.0455544e-05f, -2.0633779e-05f, -1.6696798e-05f, 1.8331542e-05f, -1.0151498e-05f, -1.1869125e-06f, -1.3786744e-05f, -1.9799107e-07f, 5.2121277e-06f, 6.0774987e-06f, 2.3959503e-05f, 2.324198e-06f, -1.2724674e-05f, 8.019255e-06f, 2.5516749e-05f, 1.0414385e-05f, -1.289996e-05f, 1.9232779e-05f, -1.3873125e-05f, -1.6068278e-05f, -3.6815378e-05f, -2.56672e-06f, 1.0431244e-05f, 1.6793596e-05f, -3.9755155e-06f, 1.0637844e-05f, -2.144972e-05f, -1.0686186e-05f, 7.3638e-06f, -1.2475474e-05f, -1.4068692e-05f, 2.1460426e-05f, 9.715461e-06f, -1.3981341e-05f, -4.6263203e-06f, 7.865356e-06f, 3.3254466e-06f, -1.555513e-05f, -6.046811e-05f, 3.419097e-05f, 4.3848995e-05f, 2.3927407e-05f, 6.651455e-05f, 6.640703e-05f, -5.806611e-05f, 7.977376e-06f, 1.934832e-06f, -1.2940202e-05f, 1.1430851e-05f, -1.9741376e-05f, 4.895208e-06f, -1.0931228e-05f, -9.063619e-06f, -1.5322792e-05f, -2.2607833e-06f, 2.3572914e-06f, -5.6080785e-06f, -1.0780014e-05f, -1.0038704e-05f, 7.641908e-06f, -1.8790191e-05f, -3.9834867e-06f, 4.0577675e-06f, 1.4709407e-05f, -1.3392381e-06f, 2.8450617e-05f, -1.7079108e-05f, -3.053812e-05f, -2.152248e-05f, -5.608052e-06f, 1.2992198e-05f, 8.082579e-06f, -1.9083647e-05f, -7.25443e-06f, -2.7740896e-05f, 1.6294627e-05f, -1.4851876e-05f, -1.561279e-05f, -7.712667e-07f, -1.3450475e-05f, -1.7783173e-05f, -2.05067e-05f, -6.048391e-06f, -7.887902e-07f, 1.0441498e-05f, 2.0155043e-05f, 1.6187434e-05f, -1.6973361e-05f, 6.116487e-06f, 5.5036694e-06f, 4.636741e-05f, 2.0308431e-05f, 1.9048466e-05f, -1.1173397e-05f, -1.3779468e-05f, 4.4684034e-06f, -1.48025065e-05f, 4.1484923e-06f, -1.2537647e-06f, -1.2456027e-05f, 2.1680495e-05f, -5.8544465e-06f, 1.7177137e-05f, 5.1510756e-06f, -2.4496758e-05f, -2.1495745e-05f, 2.5819247e-07f, 6.473293e-06f, 1.8207462e-05f, -2.2662705e-05f, 2.6317302e-05f, 1.3183493e-05f, 5.4894194e-06f, 3.4327328e-05f, 3.164927e-05f, 8.550954e-06f, 2.6873628e-05f, -2.1255564e-05f, 1.860461e-05f, 1.0979e-05f, -2.3489705e-05f, 1.1340626e-05f, 4.049774e-06f, 2.082108e-05f, -3.9708652e-06f, 1.8877527e-06f, 1.4362214e-05f, 8.001908e-06f, -3.5558255e-06f, 1.495044e-05f, 5.8648384e-06f, 6.6399393e-06f, 3.759216e-06f, 5.8178633e-05f, -5.3704287e-05f, -4.9708873e-05f, -1.7877433e-05f, -5.9635397e-05f, 5.2475585e-05f, 5.2501244e-05f, -1.9884405e-05f, 2.1142638e-05f, 3.511172e-06f, -2.1993897e-05f, 6.610359e-07f, 1.29955215e-05f, -5.37683e-06f, 1.813644e-05f, 7.562696e-06f, 7.747895e-06f, -5.8018904e-06f, -7.5405956e-06f, -9.067833e-06f, -5.6354395e-07f, 2.2023785e-05f, 9.883415e-06f, 1.6449203e-05f, 3.4740208e-07f, -6.5850486e-06f, -2.100681e-05f, 2.1213557e-06f, 2.3677909e-05f, 3.0239571e-05f, 2.781962e-05f, -2.9310906e-05f, 1.0443047e-05f, 5.529521e-06f, 1.2844811e-05f, 1.9440258e-05f, 1.0986892e-05f, -2.006879e-05f, 1.3817534e-05f, 1.2423976e-06f, -2.2650167e-06f, 5.578225e-07f, -9.4457056e-07f, -1.8714789e-05f, 1.9199168e-05f, 1.5736408e-05f, 1.4223364e-05f, -1.29737e-06f, -3.9350034e-05f, -5.565492e-05f, -2.9799305e-05f, 1.7164355e-05f, 5.57911e-05f, -6.323033e-05f, -4.3295804e-05f, -4.135592e-05f, 1.2450566e-05f, -2.0751771e-05f, -1.6393638e-05f, 1.1047977e-05f, -1.0513618e-05f, 1.1353887e-05f, -1.7992366e-05f, 6.7395517e-06f, -5.0777544e-06f, -1.501755e-05f, 1.6939437e-05f, -2.8389508e-05f, 6.351652e-06f, -2.075037e-05f, 1.0875686e-05f, 2.349463e-05f, -3.8950716e-06f, 2.263013e-05f, 1.5578635e-05f, -2.8762284e-05f, 7.042908e-06f, -1.4740555e-05f, 2.7826754e-05f, 1.1052608e-05f, 1.546715e-05f, -7.131425e-06f, -4.057519e-06f, -1.9918392e-05f, -2.4088338e-05f, 8.217517e-06f, -1.748365e-05f, 4.598136e-06f, -5.76157e-08f, -3.8711228e-06f, -1.6351987e-05f, 9.626605e-06f, 1.5077485e-05f, 2.2248357e-06f, 7.772902e-06f, 1.3481422e-05f, -7.4929514e-05f, -5.485289e-05f, -2.5501564e-05f, -1.469222e-05f, 3.5947352e-05f, -7.3015103e-06f, 5.1423445e-05f, -2.0851032e-05f, 1.762669e-05f, 6.475801e-07f, -8.345279e-06f, -1.4879347e-05f, -3.3756426e-06f, 2.0838455e-05f, -1.6538677e-05f, 4.4904314e-06f, 5.49596e-06f, -2.0281943e-05f, -1.4807583e-05f, -2.3969149e-05f, 1.949018e-05f, 2.604547e-05f, -2.1730097e-05f, 4.7370327e-06f, -2.9020111e-05f, 3.5352743e-05f, 1.3440272e-05f, -3.494737e-05f, -2.4270641e-05f, -1.2756533e-05f, 1.4966261e-05f, -1.0624759e-05f, 2.073161e-05f, -7.819834e-06f, -2.398031e-05f, 9.203514e-06f, -1.0930846e-05f, 2.760782e-06f, -2.4738385e-06f, -4.330238e-06f, -1.5995438e-05f, -1.5918086e-07f, -1.537001e-05f, 8.141451e-06f, -7.1109307e-06f, 1.0509985e-05f, 1.39540025e-05f, 2.3665953e-05f, -9.98884e-06f, -5.594869e-05f, -5.250045e-05f, 9.668487e-06f, -2.0966369e-05f, -1.8711398e-05f, -2.178666e-06f, 9.911219e-06f, 2.3102622e-05f, -2.5060499e-05f, 7.0780966e-06f, -1.7354712e-06f, -2.2360158e-05f, -2.5467125e-06f, -1.4931036e-05f, -1.6790438e-05f, -7.1590866e-06f, 1.5336971e-05f, 1.2290819e-05f, -3.0089934e-05f, -2.2803863e-05f, 2.4008163e-05f, -1.8764074e-05f, 1.982881e-06f, -9.822711e-06f, 1.5145718e-05f, -6.5324e-06f, -3.3855646e-05f, -1.1376085e-05f, 1.8077582e-05f, -1.0068962e-05f, 1.5878362e-05f, -1.09659595e-05f, -7.2842186e-06f, -2.0294328e-05f, -6.6111475e-06f, 1.1933374e-05f, -8.109582e-06f, -1.7747434e-05f, -1.6005642e-05f, -3.624478e-07f, -7.8481635e-06f, 9.839121e-06f, -9.839748e-06f, -2.0197485e-05f, -7.847329e-06f, -4.229323e-06f, -1.2568127e-05f, 2.1912843e-05f, -6.125515e-05f, -2.9891326e-06f, 4.2870033e-06f, -4.4257456e-05f, 2.2146958e-05f, 4.6560872e-05f, 4.9297338e-05f, -4.9830087e-06f, 1.3932374e-05f, -1.6882312e-05f, -1.2882379e-05f, -2.2932689e-05f, 2.3132026e-05f, -1.2681867e-05f, 6.825663e-06f, 2.4392853e-05f, -2.6008724e-06f, 1.31104525e-05f, 2.3223163e-05f, 9.108283e-06f, -1.6964095e-05f, 1.7886638e-05f, 1.3767021e-05f, 1.2949554e-05f, 2.9990964e-05f, 2.3527864e-05f, -1.2689494e-06f, -1.8076531e-05f, 2.9119623e-05f, -2.9057567e-06f, -9.904651e-06f, -5.601802e-06f, -3.3620436e-06f, 5.605301e-06f, 1.8581994e-05f, -2.0243551e-06f, 1.5578373e-05f, 2.8457312e-06f, 2.5750007e-06f, 1.2625128e-06f, -1.8898398e-05f, 8.913516e-06f, -2.9253295e-06f, -2.2192718e-05f, 6.7038627e-06f, -1.2591155e-05f, 1.470503e-05f, 1.1121869e-05f, 3.5390374e-05f, 4.1688607e-05f, -3.9535968e-05f, -1.8957078e-05f, -6.236855e-05f, -4.530524e-05f, 4.6845335e-07f, -1.05525805e-05f, -1.3239191e-05f, 1.2835775e-05f, 5.0333443e-07f, -2.1761987e-05f, -2.336269e-06f, -7.2126327e-06f, -1.6840275e-05f, 2.4728231e-05f, -2.7211545e-05f, 2.5699419e-05f, -2.6535221e-05f, -6.0442317e-06f, 1.9289582e-05f, -6.0536845e-06f, -2.8869119e-05f, 3.652276e-06f, -3.7454904e-06f, 2.0323587e-05f, 1.4610062e-05f, 2.0666437e-05f, 2.2762162e-05f, 5.5992416e-07f, 1.5765663e-05f, -1.7608283e-05f, -1.095337e-05f, -1.8524683e-05f, 1.0088992e-05f, -3.714825e-06f, -1.646789e-05f, -1.2537023e-05f, 1.20039085e-05f, -8.492991e-07f, -1.3331228e-06f, -7.746996e-06f, 9.631542e-06f, 5.2711107e-06f, -1.4151642e-06f, 1.6184624e-05f, 9.0590565e-06f, 2.5416393e-05f, 1.9335319e-05f, -5.261604e-05f, 7.830256e-06f, -5.4861077e-05f, 4.675278e-05f, -2.1294405e-05f, -6.678777e-05f, 2.1013548e-05f, -8.832998e-06f, 7.498176e-06f, 2.7005499e-05f, -2.0094612e-05f, 1.0259767e-05f, -2.1977394e-05f, -4.3602945e-06f, -1.0054025e-06f, -1.843031e-05f, 9.54496e-07f, -1.3937814e-05f, 1.5508465e-05f, 2.027753e-05f, 1.8791001e-05f, -9.213137e-06f, 8.248232e-06f, 6.4282144e-06f, -8.460077e-06f, 7.6165297e-06f, 1.812157e-05f, -9.415458e-06f, -2.5934289e-05f, -3.499763e-06f, -4.891875e-07f, 1.0983541e-05f, -3.4564878e-06f, -1.08666945e-05f, 7.453601e-06f, -1.2683738e-05f, -7.6146875e-06f, -1.3284268e-05f, 9.75417e-06f, 7.846131e-06f, 1.7664473e-05f, 1.3891504e-06f, -1.13693e-05f, -7.1355125e-06f, -6.6317807e-07f, -4.323157e-06f, 4.153228e-05f, -9.025064e-06f, -7.5678954e-06f, 4.907642e-05f, -3.245674e-05f, 2.5565176e-05f, 4.9302657e-06f, 1.2313491e-05f, 2.4533533e-06f, -2.830705e-06f, 1.339939e-05f, 9.191408e-06f, -2.7716585e-05f, -2.4036271e-06f, -8.825707e-07f, 1.6369044e-05f, -2.1044505e-05f, -8.388053e-06f, 3.4020864e-05f, -2.6385371e-06f, -4.854845e-06f, 3.3490633e-05f, 1.5268146e-05f, 8.940077e-06f, 1.718611e-05f, 1.2379247e-05f, -2.632878e-05f, -2.258371e-05f, -1.9607942e-05f, 8.148081e-06f, 1.0223983e-05f, 2.325733e-05f, -1.0802275e-05f, 1.609181e-05f, 8.757344e-06f, 1.991946e-06f, 6.7580972e-06f, -4.4355165e-06f, -1.4970363e-05f, 4.360002e-06f, -1.552284e-05f, -1.5088384e-05f, -7.230826e-06f, -1.1122369e-05f, 9.452824e-06f, -1.3159442e-06f, -8.475779e-06f, 1.5796166e-05f, 1.0622713e-05f, -4.5834684e-05f, -2.9389099e-05f, 4.4885845e-05f, -5.585169e-05f, 3.2273292e-05f, 3.9199763e-06f, -6.238402e-05f, -2.252044e-05f, 1.714202e-05f, 4.721191e-06f, -2.367647e-05f, -1.8719616e-05f, -1.610718e-05f, 6.492019e-06f, 8.732646e-06f, 2.8949178e-05f, -2.8473361e-05f, -2.2287753e-05f, -1.0421627e-05f, 3.307742e-05f, -2.3507696e-06f, -1.3470517e-05f, 2.6365487e-05f, 1.1866519e-05f, -7.4094264e-06f, 2.221575e-05f, -6.1125197e-06f, -1.8172113e-05f, 1.1432825e-05f, 2.2081787e-05f, -2.4441406e-05f, 1.4220286e-05f, -1.289268e-06f, 1.4891406e-05f, 1.0458426e-06f, 1.5323429e-05f, -1.1651849e-06f, -1.1637009e-05f, 1.7491997e-05f, -1.0635267e-05f, -1.7251734e-06f, -4.9240593e-06f, -1.8549043e-06f, -4.622878e-06f, -1.8328443e-05f, -4.530866e-06f, 1.1681115e-05f, -3.0961328e-05f, 4.0690833e-05f, -1.6735654e-05f, -2.200701e-06f, -5.2353185e-05f, -5.6094603e-05f, 2.6766491e-05f, 3.854972e-05f, -1.6535589e-05f, -2.9856015e-05f, 2.8446952e-05f, -2.568895e-05f, -1.784564e-05f, 2.8438782e-05f, -1.2666218e-05f, -1.5668975e-05f, -2.4789695e-05f, 2.2208347e-05f, -1.6343636e-05f, -1.6643846e-06f, -5.893457e-06f, -8.174921e-06f, -1.705937e-05f, -7.859685e-07f, -2.3834995e-05f, 3.3943637e-05f, -2.0933414e-05f, 1.1966647e-06f, 9.078602e-06f, 1.7454931e-05f, -1.6080685e-05f, -3.1449108e-06f, -1.33039985e-05f, -4.087409e-06f, -1.4779639e-05f, 3.450566e-06f, -7.620917e-06f, 8.213334e-06f, 7.760105e-06f, 1.7899047e-05f, 1.3116216e-05f, -4.052331e-06f, -1.7149576e-05f, -1.0790375e-05f, -5.680776e-06f, -1.74377e-05f, 7.1886375e-06f, -8.460591e-06f, 4.8067544e-05f, -3.1615275e-06f, 2.2698146e-05f, -2.280142e-05f, -3.307555e-05f, 2.2398317e-05f, -3.4925604e-05f, -3.2369844e-05f, -2.9659448e-05f, 1.3460321e-05f, 2.5033425e-05f, -1.37860525e-05f, -2.8704644e-05f, 2.3468443e-05f, 1.7328519e-05f, 2.5368954e-05f, -2.99864e-05f, -1.0775793e-05f, -1.8446848e-05f, 2.9098386e-05f, -1.1223446e-05f, -3.359214e-06f, -1.4275168e-05f, -1.3154546e-06f, 1.33240155e-05f, -1.1065884e-05f, 2.873256e-05f, -2.319897e-05f, 3.1277655e-06f, 9.2048356e-07f, 2.1241729e-05f, 2.5423742e-05f, 1.0977516e-05f, 4.9842206e-06f, 8.610833e-06f, 1.5382326e-05f, 1.2461662e-05f, 1.2491732e-05f, -1.3126037e-06f, 1.0326663e-05f, 7.867595e-06f, 1.1449038e-05f, 9.4935995e-06f, -2.4572893e-07f, -4.1493668e-06f, -9.950908e-06f, -1.4063341e-05f, 1.8491288e-05f, -9.192943e-06f, 1.6006466e-05f, -2.4278044e-05f, -5.3136213e-05f, 1.4106525e-06f, -3.1410313e-05f, 2.4659994e-05f, -4.363651e-05f, -1.2815072e-05f, -3.3367603e-05f, -2.2752767e-05f, 1.175344e-05f, 4.1907515e-07f, 5.946256e-06f, -2.9306628e-05f, -6.8680725e-07f, -8.4702015e-06f, -2.9094028e-05f, 6.7517167e-06f, 2.008684e-06f, 1.58661e-05f, 1.8827532e-05f, -2.5154803e-05f, -1.2376366e-05f, -1.476221e-05f, -2.9272787e-06f, 9.142382e-06f, -2.5515505e-05f, 1.8083196e-05f, -1.45239055e-05f, 2.4933235e-05f, -2.020973e-05f, 1.3964212e-05f, -5.6377166e-06f, -1.2938172e-05f, -5.066806e-06f, 9.774668e-06f, -2.0770145e-05f, 9.544505e-07f, -1.2910977e-05f, 3.7670468e-06f, 1.1830473e-05f, 1.48611925e-05f, 1.1113247e-05f, -1.0459937e-06f, 3.6213974e-06f, -8.067651e-06f, 1.756645e-05f, 7.6023484e-06f, -3.6086305e-05f, -2.8062852e-05f, -1.4026884e-05f, 2.488051e-05f, 3.402994e-05f, -5.11729e-05f, 4.281438e-05f, 1.4044675e-05f, -2.0127389e-05f, -1.731207e-05f, -1.0826941e-06f, 1.4728896e-06f, -1.9328869e-05f, 8.884635e-06f, 1.4382056e-05f, 2.4071689e-05f, -3.3660897e-05f, 3.4993067e-05f, -2.6104293e-05f, -3.08696e-06f, -4.6252203e-06f, -6.2399226e-06f, 1.0888379e-05f, 3.0472487e-05f, -2.0531535e-05f, 1.8339071e-05f, 2.724395e-05f, -6.1389615e-06f, 9.443022e-06f, -2.749406e-05f, -1.4550159e-05f, 1.4935306e-05f, -1.3536864e-05f, -1.6932685e-05f, 1.5166628e-05f, 1.2259835e-05f, -1.1960863e-05f, 1.4503017e-05f, 9.029866e-06f, -1.1301909e-06f, -4.400732e-06f, -1.0928518e-09f, -1.0356228e-05f, 8.025357e-06f, -9.303083e-06f, 2.4330523e-06f, -5.507609e-06f, -1.8017334e-05f, 3.5405837e-06f, -2.7970822e-05f, 3.6307545e-05f, 3.9729828e-05f, 3.8687213e-05f, 4.2282478e-05f, -1.8365398e-06f, 3.6074583e-05f, -1.5485808e-06f, -4.8160077e-06f, 4.2387677e-05f, -8.073052e-06f, 1.1774448e-05f, 2.0577563e-05f, -1.5813881e-05f, 2.2082007e-05f, -1.0257134e-05f, 9.76802e-06f, 4.453577e-07f, 7.363157e-06f, 2.8920098e-05f, 3.4715515e-05f, 2.2648117e-05f, -3.0777184e-05f, 3.207432e-05f, 1.6852893e-05f, 2.21755e-05f, -2.2830985e-05f, 2.9644742e-05f, -2.3883716e-05f, 1.7844355e-05f, -2.4646522e-06f, 5.8862366e-07f, -5.9073222e-06f, -5.907519e-06f, 1.5487285e-05f, -3.216049e-06f, 1.2060381e-05f, -5.982797e-07f, 4.599853e-06f, 1.2261086e-05f, -9.308679e-06f, 2.1758386e-07f, 1.3702715e-05f, 1.4195627e-05f, 2.2428153e-06f, 7.2389173e-07f, -3.554966e-05f, 2.6611437e-05f, -9.8185665e-06f, -3.907103e-05f, -5.206723e-05f, -3.0379073e-05f, 4.6293157e-05f, -5.557771e-05f, 3.9656912e-05f, -3.5998216e-06f, 3.9304963e-05f, 2.5711415e-05f, 4.307152e-06f, 4.70336e-05f, 1.7326585e-05f, -1.9255629e-05f, -6.636282e-06f, -3.9220235e-05f, 2.7338787e-05f, -1.6618247e-05f, 9.876892e-06f, 3.3869317e-05f, -1.7370083e-05f, 1.947665e-05f, -2.2247332e-05f, -2.1381843e-06f, -8.1790195e-06f, -1.2110188e-06f, 3.0679366e-05f, 2.9081696e-07f, 2.5613777e-05f, 1.555854e-05f, -2.4593646e-07f, -1.7167187e-05f, -7.500083e-06f, -8.815334e-06f, 1.3212428e-05f, -1.4496349e-05f, 9.690406e-06f, -1.1601504e-05f, -5.9949934e-06f, -1.7491135e-05f, -1.4779672e-05f, -1.0474386e-05f, -6.4329656e-06f, -1.2486896e-05f, -7.488785e-06f, -8.574163e-06f, -2.5745128e-05f, 4.05727e-06f, -5.0810722e-05f, -2.3943261e-05f, -3.1801632e-05f, -1.9231e-05f, 2.2154176e-05f, -3.2020474e-05f, 3.772283e-06f, 2.2798074e-05f, -1.7747358e-05f, 2.9556013e-05f, -4.3350406e-06f, -2.8825794e-05f, 1.15830235e-05f, -3.6827354e-05f, 1.2731433e-05f, -2.008866e-05f, 8.890523e-06f, 1.4886298e-05f, 1.5616633e-05f, 2.1771979e-05f, -1.3110922e-05f, 4.048896e-06f, -1.2280297e-05f, -2.7312752e-05f, 3.1684613e-06f, 1.04347055e-05f, 3.659258e-05f, -1.8876239e-05f, -2.770563e-05f, -8.98835e-06f, 1.7714037e-06f, -6.050088e-06f, -7.1781596e-06f, -1.7927183e-05f, -2.1325035e-05f, 6.2628433e-06f, -2.0149425e-06f, -1.391717e-05f, 7.215345e-06f, -1.3132842e-05f, -1.5820111e-05f, -7.0383167e-06f, -1.6694099e-05f, 5.27379e-06f, 4.234288e-06f, 1.2818545e-05f, -4.589838e-05f, -3.1376818e-05f, 1.4523082e-05f, -4.381455e-05f, -2.5254301e-05f, -3.1233176e-05f, 1.891531e-05f, -5.231678e-05f, -3.425643e-05f, -2.3963803e-05f, 5.166877e-06f, 1.9659694e-05f, -2.1628891e-06f, -1.6555765e-05f, -1.9715855e-05f, 9.819455e-06f, 1.677605e-05f, -6.272086e-07f, 8.894434e-06f, -3.4080025e-05f, 1.785325e-05f, 9.765275e-06f, 6.8267805e-06f, 1.2675306e-05f, -6.106898e-06f, 1.6417833e-05f, -2.2846484e-06f, 1.1435383e-05f, 6.6458515e-06f, -7.623252e-06f, -2.7425898e-05f, -2.8984074e-05f, 1.0778053e-05f, 3.5517792e-06f, -6.1668084e-06f, -1.7975635e-05f, -6.336439e-06f, -2.0758938e-05f, 1.8233863e-05f, -4.004451e-06f, 1.1780293e-05f, -1.8082885e-05f, 1.1051252e-05f, 4.545089e-06f, 5.514746e-06f, -8.649947e-08f, 5.217123e-06f, -1.3701444e-05f, 1.8654604e-05f, 2.6564341e-05f, -4.2248663e-05f, -9.557056e-06f, 1.906806e-05f, 1.45440645e-05f, -4.329432e-05f, 1.2560373e-05f, -1.0817357e-05f, 4.4657656e-05f, 1.915688e-05f, -1.5813728e-05f, -5.9833455e-06f, -3.0440076e-05f, -2.2376164e-05f, -2.1082169e-05f, 2.2574577e-05f, 1.1954055e-05f, -1.9582114e-05f, -9.4695235e-07f, 3.6780206e-05f, 2.6757707e-05f, 3.0283985e-05f, -2.0407713e-05f, -1.3688602e-05f, 1.8824723e-05f, -1.8864916e-05f, 2.7212005e-05f, 2.8148013e-05f, 9.337597e-06f, -1.8546441e-05f, 2.5625424e-05f, 1.41990495e-05f, -1.9663848e-05f, -1.0132379e-06f, -5.0694744e-06f, 7.964468e-06f, -1.3190449e-05f, 5.2016358e-06f, -9.169958e-06f, 1.742051e-05f, -4.02361e-06f, -1.4963289e-05f, -5.7651023e-06f, -1.5102723e-05f, -1.7985996e-06f, -9.40914e-06f, 1.9955736e-05f, -2.352102e-05f, -1.0334157e-05f, -2.6139105e-05f, 4.355606e-05f, 4.492699e-05f, 3.4526722e-06f, 3.7870534e-05f, -2.6282758e-05f, -2.9628004e-07f, -8.426501e-06f, -3.565324e-05f, 2.4323368e-05f, 1.5325281e-06f, -6.264706e-06f, -2.8297804e-05f, -7.1290747e-06f, -1.8117892e-06f, -3.1217194e-05f, 2.58243e-05f, 1.8300398e-06f, -2.407025e-05f, 2.3472956e-05f, -9.5102337e-07f, -1.6811811e-05f, 4.335473e-06f, -1.0198926e-05f, -1.8370525e-05f, -5.718915e-06f, -2.2310925e-05f, 1.9625604e-05f, 5.758491e-06f, -3.489371e-05f, 1.3514833e-05f, -2.580933e-06f, -2.6522187e-06f, -1.7815295e-05f, 9.648636e-06f, -7.4023606e-06f, -1.6683778e-05f, 1.5506019e-05f, -1.1858887e-05f, -1.8466482e-05f, -4.2245724e-06f, -9.412948e-06f, -3.1573559e-06f, -1.08949025e-05f, -1.4449459e-05f, 1.0231395e-05f, 8.929481e-06f, 4.0388783e-05f, -4.850712e-05f, -3.6165708e-05f, -1.8186283e-05f, -5.5449967e-05f, 3.8903252e-07f, 5.3072326e-06f, 1.3528085e-06f, 3.0132807e-05f, -2.0919679e-05f, -1.3330522e-05f, 2.0677782e-05f, -1.0043408e-05f, 1.7628261e-05f, 1.8390965e-05f, 9.487384e-06f, 2.494106e-05f, 1.9403291e-05f, -3.1795804e-05f, 1.9889061e-05f, 3.4472607e-05f, -1.0062129e-06f, -3.3832435e-05f, -1.5252901e-05f, -1.7792148e-05f, 3.117309e-05f, 2.6645908e-05f, -2.941188e-05f, -2.7761422e-05f, -2.3752119e-07f, 1.8814673e-05f, 5.973479e-06f, -8.331431e-06f, -1.2839343e-05f, 1.0702852e-05f, -1.5292537e-05f, 2.6786952e-06f, 1.9741958e-05f, 1.2300988e-05f, -2.137284e-06f, 1.3824459e-06f, 1.705556e-05f, 4.8770935e-06f, -2.4753526e-06f, 1.2593054e-05f, 1.5808522e-05f, 9.913043e-07f, 3.9510196e-05f, -4.8875565e-05f, -5.599541e-06f, -2.575907e-05f, -3.905312e-05f, -4.027084e-06f, -4.8821443e-05f, -3.609763e-05f, 2.8628192e-05f, -2.216606e-05f, 4.592367e-05f, -1.1597068e-05f, 3.3069366e-05f, -2.2330702e-05f, 1.9466836e-05f, 7.98749e-06f, -1.7946629e-06f, 1.0789789e-05f, 1.263866e-05f, -2.7064285e-05f, -1.47043675e-05f, -1.2527677e-05f, 2.8279652e-05f, -1.5645483e-05f, 3.3841031e-06f, -2.0948068e-05f, 3.7498532e-05f, 2.1096583e-05f, -5.4499124e-06f, 2.7662654e-05f, -2.6603997e-05f, 2.1847274e-05f, 5.9313434e-06f, 1.6124553e-05f, -1.2854257e-06f, 1.3201191e-05f, -1.03520615e-05f, 1.3973716e-05f, -4.2085962e-06f, -1.5321259e-05f, 1.7458966e-05f, 9.746922e-06f, -1.6098782e-05f, 1.1035191e-05f, 1.3455452e-06f, 6.895896e-06f, 1.8833607e-05f, -7.3949172e-06f, -3.9187744e-06f, 1.5704507e-05f, 3.0742405e-05f, 4.051998e-05f, 3.8979917e-05f, 3.1559e-05f, -1.7270546e-05f, -1.9226256e-05f, 4.0409963e-05f, 8.9031556e-07f, 9.454187e-06f, -3.0384499e-05f, -1.1170039e-05f, -1.4237761e-05f, -3.0290972e-05f, 2.4896446e-05f, -1.0309024e-05f, -2.540697e-05f, 2.4258861e-05f, 2.1432366e-05f, 2.788015e-05f, -1.4098153e-05f, -1.9421765e-05f, -4.3499563e-06f, -3.0664483e-05f, 2.8879484e-05f, -1.0999442e-05f, -4.792197e-06f, 7.026934e-07f, 7.136417e-06f, -1.7101855e-05f, -4.176804e-06f, 6.900711e-06f, -3.5324313e-06f, -1.1835068e-06f, 1.76254e-05f, -1.8351284e-05f, 5.8136163e-07f, 7.5729045e-06f, -1.07930055e-05f, -6.45879e-06f, -4.8871593e-06f, -1.6602937e-05f, 1.6167562e-05f, -1.7948201e-05f, 2.9436692e-06f, 1.8782022e-05f, 1.745836e-05f, -2.0170217e-05f, 4.9703954e-06f, -3.8929546e-05f, -3.5144512e-05f, -4.211285e-05f, -4.0635918e-05f, 1.2526766e-05f, 3.887769e-06f, 2.25004e-05f, 4.1147945e-05f, 7.6925437e-07f, 2.3650603e-06f, 7.5957576e-07f, 4.8973666e-06f, 2.198395e-05f, 2.1850772e-05f, 2.182097e-05f, 9.220716e-06f, -5.330381e-06f, 1.9276193e-05f, -6.1544047e-06f, 1.4683014e-05f, 2.2952085e-05f, -1.29076525e-05f, -1.30058415e-05f, 2.1169175e-05f, 8.305686e-06f, -2.3343577e-05f, 1.4232677e-05f, -9.753113e-06f, 1.8214914e-05f, -4.807735e-06f, 8.912893e-06f, 1.9326774e-06f, -8.352141e-06f, -1.0100469e-05f, 3.936436e-06f, 1.2124647e-05f, -2.9382168e-06f, -1.5381283e-05f, -1.064987e-05f, -7.0158035e-06f, -1.4781695e-05f, 1.7700922e-05f, -2.0796946e-05f, 1.1830951e-05f, -1.0217199e-05f, -8.203971e-06f, -1.5051952e-06f, -2.2490247e-05f, 3.462436e-05f, -5.7231514e-06f, 5.741662e-06f, -4.986629e-06f, 4.578034e-05f, 2.9043447e-05f, 9.001032e-06f, -1.1854567e-05f, -1.8889566e-05f, 7.5190263e-07f, 1.2888387e-05f, 1.4286519e-05f, 5.483901e-06f, -2.0680833e-05f, 1.1935434e-05f, 2.4270923e-05f, -1.0094991e-05f, -1.2177747e-05f, -4.0383566e-06f, -3.3755932e-06f, -8.419191e-06f, -1.1500889e-06f, -7.910738e-07f, 2.2332875e-05f, 3.3599529e-06f, -3.0021525e-05f, 3.0209107e-05f, 3.2507443e-05f, 8.628394e-06f, 1.0308554e-05f, 8.562644e-06f, -1.5551908e-05f, -1.759259e-05f, 3.6380086e-07f, -6.3574394e-06f, -1.52545335e-05f, 7.254004e-06f, -3.380606e-06f, 1.867673e-05f, -1.939831e-05f, -2.9825555e-06f, 2.441748e-06f, -2.3534374e-06f, -1.2073255e-05f, -1.7403587e-06f, 1.0407054e-05f, -4.4882596e-05f, 1.5411992e-05f, -2.1568416e-05f, 3.0102017e-05f, -2.551172e-05f, -3.548974e-07f, -3.6522302e-05f, 2.771997e-05f, -3.557924e-05f, -1.5071429e-05f, 2.8135499e-05f, -7.961026e-06f, 2.8966575e-05f, -4.4147255e-06f, -1.622642e-05f, 1.51004e-05f, 7.246769e-06f, -8.253763e-06f, 2.128157e-05f, 1.11676145e-05f, -2.250135e-05f, 5.967997e-06f, 3.2140426e-05f, 1.5447114e-05f, 1.0015048e-05f, 6.6992448e-06f, 9.212298e-06f, -3.0248061e-06f, -1.3103405e-05f, -9.3171013e-07f, -2.4593506e-05f, 4.8202155e-06f, 3.3770548e-06f, 1.1051598e-05f, -7.930026e-06f, 3.7828437e-07f, -1.887548e-05f, -9.63492e-06f, 1.6490912e-05f, 1.3169449e-05f, -1.44541e-05f, 9.620968e-06f, -1.503588e-05f, 1.41270875e-05f, -9.745198e-06f, -1.271889e-05f, -9.450104e-06f, -1.3075526e-05f, -1.6029831e-05f, -5.1173385e-05f, -2.9336552e-05f, 2.8858745e-05f, 1.8602411e-06f, 1.3993811e-05f, -2.9074341e-05f, -3.7467522e-05f, -4.4392978e-06f, -2.2741619e-05f, 1.2270045e-05f, -1.5487238e-05f, -2.5615884e-06f, -1.7013142e-05f, 6.7625147e-06f, 1.5385642e-05f, 1.868658e-05f, -7.0078663e-06f, -1.0778095e-05f, -2.0610005e-05f, -1.7311708e-05f, 2.2829478e-05f, 1.0705535e-05f, -1.8064013e-05f, 3.6295252e-05f, -1.5081704e-09f, -2.5587618e-05f, -2.958314e-05f, 1.539465e-06f, 6.999796e-06f, -9.082202e-06f, -4.628952e-06f, -8.142249e-06f, -1.4859414e-05f, -1.1269573e-05f, 9.134963e-06f, 1.7755675e-06f, -1.007283e-05f, -1.4214071e-05f, -1.4402344e-05f, -1.449089e-05f, 5.9416725e-06f, -8.63245e-06f, 5.3974636e-06f, -5.262236e-06f, -1.21747535e-05f, 1.1105155e-05f, -1.5048292e-05f, 2.0120913e-05f, 9.61273e-06f, 1.3299291e-05f, -3.9465736e-05f, -2.3172179e-05f, -1.2060368e-05f, -8.578914e-06f, -4.0850813e-05f, -1.3210185e-05f, 1.8997785e-05f, -1.8871473e-05f, -2.4812805e-05f, -1.9799103e-05f, -1.0919606e-05f, -8.1887805e-07f, -1.6739556e-05f, 2.6231051e-05f, 7.5856715e-06f, -2.4152727e-05f, -1.01625665e-05f, 1.62625e-05f, -2.8711935e-05f, 2.5631341e-05f, 4.9580653e-06f, 3.763885e-05f, 1.643199e-06f, -7.653235e-06f, 2.227698e-05f, -2.0070256e-05f, 1.1507742e-05f, -3.082727e-05f, 1.3166605e-05f, 8.506481e-06f, -6.992351e-06f, -8.678799e-06f, -3.460227e-06f, -1.5982376e-05f, -2.0466938e-05f, 5.3215326e-06f, -1.637605e-06f, 9.461749e-06f, 2.1257595e-06f, -1.8010514e-05f, 1.7231168e-05f, -5.5244122e-06f, -1.8534218e-05f, 1.0040641e-05f, 1.6797146e-06f, 2.0548154e-05f, 1.6271793e-05f, -3.3701057e-05f, 3.195925e-05f, -4.0776384e-05f, 1.2547628e-05f, -4.869364e-05f, 1.10984765e-05f, -1.3843956e-07f, 7.144522e-07f, -2.104108e-05f, 1.7187893e-06f, 1.9630961e-05f, 1.7017084e-05f, 1.1171986e-05f, -2.11353e-05f, -2.3730076e-05f, 1.5739402e-05f, -1.40896e-05f, 6.9361226e-07f, -1.6448277e-05f, 4.6464106e-06f, 1.2841154e-05f, 9.942906e-06f, -4.5793377e-06f, -9.429509e-06f, -3.0632906e-05f, -2.913556e-05f, 2.7138454e-05f, 4.4210283e-06f, 3.4902998e-05f, -2.269531e-05f, -1.2642147e-05f, 8.465932e-06f, 1.2350929e-05f, -6.5684026e-06f, -1.8508132e-05f, -8.270347e-06f, 1.4074867e-05f, -1.5271746e-06f, 6.0531797e-06f, -1.2660553e-05f, -1.2647506e-05f, 1.7553157e-05f, -7.3394076e-06f, 1.3821731e-05f, 9.529487e-06f, 1.184522e-05f, 4.1871735e-05f, -2.9516028e-05f, -4.7426412e-05f, -5.0721104e-05f, 6.732439e-06f, -5.0838684e-05f, 3.9350132e-05f, 2.7655324e-05f, 1.5314687e-05f, 5.8584283e-06f, 2.234907e-05f, -9.046715e-06f, -3.6024228e-06f, 1.2186103e-05f, 8.169273e-06f, -2.4611018e-05f, -1.1409461e-05f, -1.8150518e-05f, 1.2945409e-06f, 2.3125056e-05f, -2.4642392e-05f, 2.1782178e-05f, 2.0940171e-05f, 1.7148499e-05f, 1.9442825e-05f, 1.6273962e-05f, -2.8389923e-05f, -7.828515e-06f, -3.1190513e-05f, -2.6548962e-05f, -2.0002706e-05f, -9.75643e-06f, 2.2936097e-06f, 9.815379e-06f, 1.0162292e-05f, 4.321411e-06f, -1.9457302e-05f, -7.873417e-06f, -5.543104e-06f, 1.457862e-05f, 5.144028e-06f, -8.643709e-06f, 1.2794751e-05f, -1.3809613e-05f, -1.1220323e-05f, 1.1637594e-05f, -3.4802588e-06f, -4.094819e-06f, -4.7352364e-06f, 1.0876959e-05f, 3.6062193e-05f, -1.7131064e-05f, 3.1162556e-06f, -2.1936967e-05f, 4.336748e-06f, 3.038472e-05f, 1.43751995e-05f, -2.7859348e-06f, -1.8441062e-05f, -2.4130564e-05f, 1.556199e-05f, -2.1796022e-05f, 2.2829712e-05f, 2.059826e-05f, 1.3740624e-05f, 1.395515e-07f, 1.3204582e-05f, 2.0619966e-05f, 5.6603185e-06f, 2.0436633e-05f, 7.518542e-06f, 5.092535e-06f, -1.6821767e-05f, 2.8563383e-05f, -3.5579917e-05f, 3.841842e-05f, 3.8824895e-05f, 3.4119093e-05f, 6.271059e-06f, -2.8262944e-05f, -3.9450224e-06f, -1.5666397e-05f, -1.0688411e-05f, -1.1764904e-05f, -4.884569e-06f, -2.0106734e-06f, 1.9657335e-05f, 1.0419288e-05f, -4.227409e-06f, 1.1282277e-05f, -1.7044515e-05f, 1.448431e-05f, -1.7774242e-05f, 1.0733781e-05f, 3.7342425e-06f, 1.6540283e-05f, -8.492203e-06f, -3.9216226e-05f, -5.521079e-05f, 2.3495926e-05f, -1.9467241e-05f, -2.9139776e-05f, 1.8320818e-06f, -9.9832005e-06f, -3.1318453e-07f, 1.7071092e-05f, 2.714105e-06f, -1.0611088e-05f, 2.0629854e-05f, 2.0358444e-05f, 8.4726435e-06f, -2.6647005e-05f, -1.5126036e-05f, -1.0275883e-06f, -2.3999617e-05f, 1.6949056e-05f, -7.984805e-06f, -2.5423316e-05f, 2.2062659e-05f, -2.6144393e-05f, -1.4179192e-05f, 2.0191159e-05f, 8.003954e-06f, 8.12794e-06f, 3.825693e-05f, -1.1554582e-05f, -3.1834945e-05f, -1.5207511e-05f, 1.4131725e-05f, -1.5291179e-06f, 8.742565e-06f, 9.993534e-06f, -8.68249e-06f, 8.5046673e-07f, 4.5545125e-06f, 1.6443224e-05f, -1.8885448e-05f, 7.4404775e-06f, -1.12931975e-05f, 8.7836215e-06f, 1.2991686e-05f, -6.1823857e-06f, -1.739309e-05f, 2.087256e-05f, 3.0030846e-05f, -2.732808e-05f, -1.6352189e-05f, -4.7375022e-05f, -1.2593922e-05f, 5.976631e-06f, -1.5620799e-06f, 2.2389308e-05f, 1.1363599e-06f, 1.5684906e-05f, -3.6676054e-06f, 3.6098986e-06f, -4.2548286e-06f, -8.334921e-06f, -9.212755e-06f, 3.1704046e-06f, 1.0427001e-05f, 6.688748e-06f, -6.636842e-06f, -2.2417726e-05f, -3.679532e-06f, -9.419822e-06f, 2.5167412e-05f, -2.5332829e-05f, -2.890957e-07f, 3.861015e-05f, 2.7984213e-05f, 5.7104758e-06f, -1.1595161e-05f, 1.8666307e-05f, 3.0993815e-05f, -1.7726328e-05f, 9.49738e-06f, -5.9944637e-06f, -1.1996606e-05f, 1.9213605e-05f, -6.400022e-06f, 1.0979577e-05f, 4.70383e-06f, -5.9067643e-06f, 3.834266e-06f, -2.2012407e-05f, 9.986338e-07f, -7.140036e-06f, -6.40859e-07f, 8.3248517e-07f, -2.2766499e-06f, 1.3697136e-05f, 1.8544235e-05f, -1.5139073e-05f, 8.6129385e-06f, -5.1653005e-05f, 2.0921387e-05f, -4.1920233e-05f, -2.6230218e-05f, 1.197142e-05f, -4.1768234e-07f, -1.5315314e-05f, -7.850075e-06f, 1.3865189e-05f, -1.5949607e-05f, 4.947383e-06f, 1.7359783e-06f, -2.3910427e-05f, 1.41538e-06f, 1.693716e-05f, -1.6789318e-05f, 1.8471426e-05f, 1.9598556e-05f, 1.44948335e-05f, 1.7987677e-05f, -1.381251e-05f, 1.4661741e-05f, -2.2009228e-05f, 6.556756e-06f, 9.893075e-06f, 1.6388907e-05f, 2.8599641e-05f, 1.6016975e-05f, 3.2159205e-05f, -1.6550985e-05f, -8.548905e-06f, -9.447554e-06f, -1.4333663e-05f, -1.0956941e-06f, 5.365348e-06f, -1.3847686e-05f, -1.00521665e-05f, -9.194264e-06f, -4.1317894e-06f, 1.1410277e-05f, 1.7812707e-05f, -2.221564e-06f, 2.289961e-06f, -7.416835e-06f, 9.808725e-07f, -2.0444593e-05f, 2.4453255e-05f, -2.2062197e-05f, 2.8240484e-06f, -3.9400493e-06f, 3.632434e-05f, 8.107769e-06f, 5.920989e-06f, -9.887744e-06f, -3.764193e-06f, 1.577465e-05f, -1.4852553e-05f, 3.2690004e-06f, 6.691541e-06f, 1.3680497e-05f, 4.5625998e-06f, -1.7570408e-05f, -2.5915804e-05f, 8.219629e-06f, 2.3578297e-05f, -1.7388547e-05f, 1.50243795e-05f, 5.204239e-06f, -2.3940758e-05f, 1.9906138e-05f, 3.9010985e-05f, -4.08253e-07f, 1.0853269e-05f, 3.4581073e-05f, -1.8887027e-05f, 2.3533894e-05f, -2.2095226e-05f, 1.723615e-05f, -8.756958e-06f, -1.8506026e-06f, 4.168761e-06f, -1.5477035e-05f, 1.474968e-05f, 8.540528e-06f, 1.0785372e-05f, -3.458869e-06f, 7.3205856e-06f, -6.8855647e-06f, 1.515572e-05f, -1.9302692e-05f, 1.6154001e-05f, 1.8161441e-05f, -1.9021742e-05f, -3.837967e-05f, -3.6136826e-05f, 3.8036203e-05f, -3.494449e-05f, -3.3753743e-06f, 3.9722832e-05f, 2.5649775e-05f, 1.6827124e-05f, -1.8757002e-05f, 5.3240324e-06f, -1.0441404e-05f, 1.6106176e-07f, 6.2611193e-06f, -8.502178e-06f, 2.4535773e-06f, -1.8359577e-05f, 5.6511562e-06f, 7.351136e-06f, -6.1765018e-06f, -2.2137433e-06f, -5.9424124e-06f, 1.4597547e-05f, 1.7399963e-05f, 9.390667e-06f, -3.6476365e-05f, 4.4601886e-05f, 4.5758566e-06f, -4.8881384e-06f, 4.03476e-05f, 1.9573343e-05f, -1.3371498e-05f, 1.0055826e-05f, -1.2231531e-05f, 2.0652567e-06f, 9.62894e-06f, 1.4813834e-05f, -1.7259346e-05f, 4.412462e-06f, 5.9083823e-06f, -1.0696916e-05f, 2.3443486e-05f, 1.8601499e-05f, 6.2710446e-06f, -3.3785448e-06f, 1.510525e-05f, -5.229486e-06f, 1.2050274e-05f, 1.7823965e-06f, -2.033161e-05f, -1.5296033e-05f, -3.7240745e-05f, 3.6946865e-05f, -4.756019e-05f, -5.9800554e-05f, 4.7482965e-05f, -1.430447e-05f, -5.858861e-06f, 1.6660562e-07f, -3.8090133e-07f, 1.24407115e-05f, 4.7279245e-06f, 1.27369685e-05f, 1.5169782e-05f, -8.4337125e-06f, 2.505084e-06f, 9.494005e-06f, -1.2409478e-05f, 2.3384166e-06f, -1.420538e-05f, -1.4220355e-05f, 1.3701029e-05f, -1.6639207e-05f, -3.223545e-05f, -1.917636e-05f, -9.202174e-06f, 2.6816544e-05f, 1.1390216e-05f, -8.845134e-06f, 2.1323982e-05f, -2.0232656e-05f, 1.6822874e-05f, -2.0665708e-05f, -6.3678035e-06f, 1.5880998e-05f, -1.1724982e-05f, -1.699644e-05f, 7.062276e-06f, 1.894873e-05f, -1.930607e-05f, -3.367583e-06f, 9.933081e-06f, -5.9119006e-06f, 8.732984e-06f, 1.6921344e-05f, -8.126491e-06f, 7.025289e-06f, 4.3543503e-05f, 3.345596e-05f, 4.0693267e-05f, -1.819735e-05f, -1.3346981e-05f, 2.262977e-05f, 1.2685915e-05f, -5.2578256e-05f, -2.2296166e-05f, -1.2976115e-05f, -2.4895664e-06f, 1.2523653e-05f, -1.878887e-06f, -1.4546786e-05f, 1.5975265e-05f, 4.397631e-06f, 1.9019863e-05f, 4.6642458e-07f, 2.7446474e-06f, 1.068474e-05f, -8.009832e-06f, -9.7379425e-06f, -1.7688673e-05f, 1.8840432e-05f, 3.4474757e-05f, -2.9028752e-05f, -2.127534e-05f, -2.8893768e-05f, -2.4765892e-05f, -2.6795178e-05f, -3.608052e-05f, -3.337858e-05f, -5.8177006e-06f, -1.4970552e-05f, -9.034686e-06f, 2.5981271e-06f, 9.241476e-06f, -1.9972307e-05f, 6.003789e-06f, 1.2298248e-05f, 1.739945e-05f, -9.772103e-06f, 1.5037471e-06f, 2.6010246e-06f, -5.0756503e-06f, -1.9175443e-05f, 1.0820291e-05f, 3.3319106e-06f, 2.6519003e-05f, 1.1888936e-05f, -2.0150523e-05f, -3.6553025e-05f, -1.6318918e-05f, -9.76777e-06f, -3.932239e-05f, -2.3942826e-05f, -2.0737189e-05f, 1.9923727e-05f, -1.557716e-05f, -1.3603789e-05f, -1.3895003e-06f, 1.7911818e-05f, -2.651015e-06f, -1.43222405e-05f, -1.25018e-06f, -1.4207833e-05f, -3.4984205e-06f, -1.8667502e-05f, 6.5189943e-06f, 5.996697e-06f, 1.7484232e-05f, -2.1787166e-05f, -2.5299098e-05f, 2.3197155e-05f, 4.2873875e-05f, 2.7171855e-05f, 2.0807589e-05f, -1.5282456e-05f, 1.1157554e-05f, -3.609689e-05f, -9.674555e-06f, -8.8872375e-06f, 2.4291196e-06f, 1.3724405e-05f, -5.515179e-06f, -1.058457e-05f, -4.1865933e-06f, 5.3689973e-06f, 1.80923e-05f, -1.217489e-05f, 2.4979796e-05f, -1.8668356e-05f, -1.611855e-05f, -1.3842144e-05f, -1.4781054e-05f, -6.3188745e-06f, 3.9772407e-05f, -4.8258817e-06f, 4.78406e-06f, 2.537106e-05f, -5.7617828e-05f, 2.6110287e-05f, -4.96265e-05f, -4.238287e-05f, -2.2013455e-05f, 1.7817191e-06f, 6.681239e-06f, -1.6649392e-05f, -3.226665e-06f, -4.3358764e-06f, -7.955409e-06f, 8.6135816e-07f, -1.5964892e-05f, 1.8623852e-05f, -9.229692e-07f, -9.3789395e-06f, 9.835313e-06f, -4.9976183e-09f, -7.749489e-06f, 5.463078e-06f, 2.0869826e-05f, 3.376508e-05f, 1.1609626e-06f, -1.3580008e-05f, -1.777469e-05f, -3.3760957e-06f, -3.2242035e-05f, -8.6345735e-06f, 1.0815895e-05f, -1.4973858e-05f, 1.469581e-05f, -7.4569543e-06f, -4.192188e-06f, 6.0289126e-06f, 1.9029594e-05f, -7.423401e-06f, -4.7572767e-06f, -5.7992684e-06f, 2.1837575e-05f, -4.9400905e-06f, 1.4251275e-05f, 1.4860172e-05f, 2.0999436e-05f, -1.888595e-07f, -4.7016427e-05f, -5.57691e-05f, -2.7620084e-05f, -8.941079e-06f, -3.9745104e-05f, -3.7696802e-05f, -5.6185094e-05f, -3.447714e-05f, -2.1240186e-05f, 1.6136999e-05f, -9.004588e-06f, -1.052026e-05f, 1.2127892e-05f, -1.6970103e-05f, 9.149458e-06f, -2.1294356e-05f, -1.606863e-05f, -9.850673e-06f, -9.629363e-06f, 1.8096902e-05f, 1.5299302e-05f, -1.8396307e-05f, 1.3049496e-05f, 1.6612844e-06f, -2.9268636e-05f, -2.347355e-05f, -2.138116e-05f, 1.7911461e-05f, -2.2945052e-05f, 1.2812611e-05f, -3.7547663e-05f, -1.6999229e-05f, 2.0325186e-05f, -7.1272207e-06f, 1.531777e-05f, -4.5986194e-06f, -7.4247973e-06f, -1.668758e-06f, 1.8159248e-05f, -7.4220566e-06f, 1.8053676e-06f, -8.301186e-06f, 1.0950227e-05f, 2.4540977e-05f, -1.7469894e-05f, 8.4873445e-06f, -5.701545e-07f, -5.7706543e-06f, 3.5840858e-05f, -3.641425e-05f, -6.36306e-05f, -6.6067078e-06f, -5.208363e-06f, -4.2070224e-05f, 3.491965e-05f, 3.0894094e-05f, 1.8131122e-05f, 1.2195163e-05f, -1.5642474e-05f, -1.6805987e-05f, 1.7342812e-05f, 5.7047046e-06f, -4.634886e-06f, -1.3577154e-06f, -1.379732e-05f, -1.4088877e-05f, -2.2370225e-05f, -2.3112789e-06f, -3.7672964e-06f, 1.7680843e-05f, 2.0933174e-05f, -1.3111215e-05f, 1.5517115e-05f, -3.0055417e-05f, -1.0902111e-05f, -1.9686995e-06f, -3.5521924e-05f, -2.6868041e-05f, -1.2743962e-05f, 9.484629e-06f, 2.1903714e-05f, -2.3033348e-05f, -2.4062558e-05f, 1.8448023e-05f, 1.3795907e-05f, 1.131688e-05f, 8.705203e-06f, 2.0144926e-05f, -1.310691e-05f, 6.261116e-06f, 1.5381744e-06f, 1.0481368e-05f, -6.334782e-06f, -2.5303887e-05f, -2.598866e-06f, -9.509516e-06f, 5.3482672e-05f, 2.4823516e-05f, 8.52913e-06f, 2.7511536e-05f, -2.42729e-05f, 7.101986e-06f, -5.4228472e-05f, -2.0855947e-05f, 3.845885e-06f, -1.6135471e-05f, 1.4141637e-05f, -1.4095816e-05f, -4.766832e-06f, -1.4380033e-05f, -2.9744338e-06f, -5.3037083e-06f, 1.17388e-06f, -1.2513483e-05f, -1.20918785e-05f, 6.5344393e-06f, 1.4849278e-05f, 1.566486e-05f, 1.1765123e-05f, -2.1485746e-05f, -1.07055885e-05f, -1.1181454e-05f, 8.136933e-06f, 4.502948e-05f, -3.0144329e-05f, -9.038207e-06f, -2.5742109e-05f, -2.7268305e-05f, -8.604115e-06f, 1.6402342e-05f, -5.4100033e-06f, -1.8394921e-05f, -2.6776203e-05f, 7.3681167e-06f, 7.706078e-06f, 1.4001911e-05f, -3.6696163e-06f, -9.741302e-06f, 1.664679e-05f, 5.9202193e-06f, 2.5508554e-05f, -1.0531091e-05f, 1.467281e-05f, 2.0818508e-05f, -4.076754e-05f, -1.2840762e-05f, -2.0413028e-05f, 2.4411369e-05f, -4.3420576e-05f, -2.1999798e-05f, 3.7746147e-05f, 1.9898067e-05f, -4.2744387e-06f, 1.7566173e-05f, -1.4693054e-05f, -1.9380095e-05f, -6.103026e-06f, 1.2803178e-05f, 9.687531e-06f, -9.649225e-06f, 2.1301998e-05f, 8.0734235e-06f, 4.014908e-06f, -1.0742081e-05f, -1.2215288e-05f, -2.2399921e-05f, 4.573644e-06f, -8.979732e-06f, 1.5925984e-06f, 1.5314703e-06f, -1.9416822e-05f, -3.3415636e-05f, 1.157702e-06f, 2.6467092e-06f, 1.6915234e-06f, 2.867937e-05f, -1.9336532e-05f, 2.4400892e-06f, -2.0236781e-05f, 2.3530398e-05f, 9.038879e-06f, 1.1446755e-06f, 1.4295042e-05f, -1.0606998e-05f, 1.5655678e-05f, -3.448982e-06f, -2.3357532e-06f, 2.627685e-05f, -1.2270987e-05f, -2.3959396e-05f, -2.242778e-06f, 1.9621957e-05f, 4.2848325e-05f, 2.2550159e-05f, 4.273623e-05f, 6.199908e-05f, -6.766685e-06f, 1.9125569e-06f, -5.545596e-06f, -1.6417634e-06f, -1.7627306e-05f, 1.7833745e-05f, 1.8855976e-06f, 1.8060538e-05f, 8.740969e-06f, -2.056412e-06f, -9.638187e-06f, 1.2769713e-05f, 9.761567e-06f, 7.6916e-06f, -2.3137238e-05f, 3.6281212e-06f, 3.4306177e-06f, 8.298977e-06f, 1.936789e-05f, -7.0400506e-06f, -1.9194074e-05f, 8.692508e-07f, -1.9822024e-05f, -1.3804531e-05f, -1.980556e-05f, 3.2849497e-05f, -2.6003207e-05f, 2.2361571e-06f, -3.7030202e-06f, 1.2254155e-05f, -1.1882917e-05f, -1.29197015e-05f, 9.610442e-06f, -9.770375e-06f, -2.1663162e-05f, -1.8607467e-06f, 2.3035616e-05f, 1.8844154e-05f, 2.0656322e-05f, -1.1979874e-06f, 2.6342032e-05f, -1.6510916e-05f, -1.2945086e-05f, 2.336225e-05f, 1.687225e-05f, -1.412331e-05f, -2.664318e-05f, 5.3986816e-05f, 2.9869411e-06f, -5.9515012e-05f, -5.6348763e-05f, -4.1558535e-05f, 1.0337003e-05f, 2.3478844e-05f, -8.379779e-06f, 1.4009851e-05f, 9.505524e-06f, -3.2685396e-06f, 1.3281243e-05f, 1.3014991e-05f, 2.2691484e-06f, -1.5427513e-06f, -4.7028316e-06f, 1.1594546e-05f, -9.494988e-07f, -2.8942125e-06f, -1.12380885e-05f, -1.248611e-05f, -6.141427e-06f, -2.8859244e-05f, 3.4085988e-05f, 2.7971646e-05f, 2.713917e-05f, -3.9135026e-05f, -3.5846926e-05f, -1.3292566e-05f, 1.0661285e-05f, -1.1686991e-05f, 5.203114e-06f, -2.4652918e-06f, -1.6964692e-05f, 1.692114e-05f, -1.3755092e-05f, -2.0306776e-05f, -1.4948422e-05f, -4.9297746e-06f, -7.88402e-06f, 4.648274e-06f, -1.7776496e-05f, 1.2281458e-05f, 9.176408e-07f, 5.7865914e-06f, -5.6937624e-05f, -1.1253953e-05f, -3.2238058e-06f, 5.6385255e-05f, 3.3819273e-05f, -1.6782269e-05f, 9.21144e-06f, -1.19066335e-05f, -2.2589407e-05f, -9.415178e-06f, 1.5130873e-05f, 1.8853232e-05f, -1.11285735e-05f, 1.013836e-05f, -1.6961363e-05f, -1.086743e-05f, 8.816675e-06f, 5.7982593e-06f, 1.8371139e-07f, -1.4723186e-05f, -1.5109526e-05f, 1.3032578e-05f, -1.5950942e-05f, 1.3136836e-05f, -4.7543176e-06f, 4.0496314e-05f, -3.8346483e-05f, -1.1402456e-05f, -4.657409e-05f, -1.0466635e-05f, -4.2764754e-05f, 7.3438564e-06f, -3.263601e-06f, 1.9319894e-05f, 8.025858e-06f, -9.995973e-06f, -4.2428696e-06f, 1.9741272e-05f, 1.3652951e-05f, -4.2829884e-06f, -1.3627632e-05f, 2.1743095e-05f, 5.889952e-06f, -1.0387752e-05f, 1.833695e-05f, 1.6487187e-05f, -6.717972e-06f, 1.4841062e-05f, 6.0702016e-05f, 4.8312555e-05f, -2.7347849e-05f, 2.1231455e-05f, -5.976467e-05f, -1.01372625e-05f, -2.3522149e-05f, 2.9591945e-05f, -4.1599947e-06f, 1.7876006e-05f, 6.931652e-06f, 1.8642568e-05f, 2.2648428e-05f, -1.2592848e-06f, -5.629046e-06f, 6.806248e-06f, -1.9392593e-05f, -1.9402887e-06f, 5.101136e-06f, 7.925437e-06f, -3.2992891e-06f, 1.1548667e-05f, 1.719979e-05f, 1.3329716e-05f, 4.873853e-05f, 1.5291565e-05f, -5.2227086e-05f, -3.0269042e-05f, -2.9709016e-05f, -3.522137e-05f, -4.7261424e-06f, 5.0871467e-06f, 1.2389792e-05f, 1.441374e-05f, 1.5597207e-05f, -3.837428e-06f, -1.4738073e-05f, -9.0089355e-07f, -2.0626732e-05f, 2.0664316e-05f, -1.9661444e-05f, 2.6768328e-05f, 2.7485392e-05f, -1.2796935e-05f, -1.7790055e-05f, -1.6601918e-05f, -4.2073953e-08f, 1.2734469e-05f, -6.1625888e-06f, -6.7616485e-05f, 2.0390777e-05f, -4.6850517e-05f, -5.755633e-05f, -1.9220814e-05f, 1.7146505e-05f, 4.082039e-05f, -1.9742873e-05f, -1.5634874e-05f, -2.1336653e-05f, 1.5711521e-05f, -1.3336409e-05f, -8.108692e-06f, -1.2473626e-05f, 1.9119867e-05f, -7.1298796e-06f, 4.9050464e-06f, 1.9752033e-06f, -1.781987e-05f, 8.773783e-07f, 3.7442367e-06f, -1.1641481e-05f, 1.6847594e-05f, 4.307679e-05f, 2.9220859e-05f, -1.889284e-06f, 7.61942e-06f, 3.9291637e-05f, -2.5701049e-05f, -8.4235435e-06f, 5.470872e-06f, 1.9894964e-05f, 8.846275e-06f, 1.726262e-05f, -9.418361e-06f, 1.5482927e-05f, -2.0059322e-05f, 2.4391486e-06f, 1.4159403e-05f, -1.3761816e-06f, -1.7201744e-05f, -5.518903e-06f, 2.1514322e-06f, -2.0818618e-06f, 1.0375181e-05f, -1.3603248e-05f, 2.3017044e-05f, 2.0319203e-05f, 9.7068805e-06f, -4.824498e-06f, 3.724675e-06f, 3.0118987e-05f, -5.0404604e-05f, -5.4459437e-05f, 4.0131017e-05f, 1.9641986e-05f, -1.5724805e-05f, -2.5558325e-07f, 1.3252405e-05f, -9.520935e-06f, 1.2448881e-05f, 1.959257e-05f, -2.0066502e-05f, 1.3831144e-06f, 1.553789e-05f, 5.635144e-06f, -1.196679e-06f, 1.7021586e-05f, -2.057459e-05f, 3.795621e-06f, -1.4689672e-05f, 2.518838e-05f, 3.5632518e-05f, 4.8977113e-06f, -1.9277959e-05f, 3.5349356e-05f, -2.6107222e-05f, -4.2329328e-05f, -4.087336e-05f, -4.476539e-06f, 1.3723484e-05f, 1.4620946e-05f, -2.644267e-05f, -1.3596301e-05f, 1.8311644e-05f, -5.234549e-06f, 1.4079895e-06f, 2.2553588e-05f, -2.5522547e-06f, 1.7846745e-05f, -6.6839148e-06f, -1.2637925e-06f, 1.5170336e-05f, -1.4935168e-05f, 2.5785603e-05f, -2.15288e-05f, 5.3194522e-05f, -3.315891e-05f, 7.393517e-05f, 1.1795607e-05f, -2.8614031e-05f, -6.50777e-05f, -1.750639e-05f, -1.32947835e-05f, 5.515034e-06f, -2.039468e-05f, -1.935273e-05f, -1.7941526e-05f, -4.1179164e-06f, -4.549291e-06f, 8.594927e-06f, 1.9616687e-05f, 1.8451768e-06f, -1.3657263e-05f, -1.2495296e-06f, -1.07967635e-05f, -1.1796261e-05f, 1.2214458e-05f, 1.04119035e-05f, -3.5888675e-06f, -2.4405803e-05f, 4.0912768e-05f, -7.776954e-06f, -1.997556e-05f, 2.8713624e-05f, 1.0354774e-05f, -1.569727e-05f, -2.317358e-05f, -3.055998e-05f, -1.3145556e-05f, 1.6742422e-05f, 9.240858e-06f, -1.3183841e-05f, 2.3048766e-05f, -2.5786569e-05f, 1.9800853e-05f, -1.9954441e-05f, 2.3334767e-05f, -1.4438162e-05f, 4.431817e-06f, -2.791605e-05f, -1.5982841e-05f, -1.142601e-05f, 2.2332519e-05f, 4.232863e-05f, 4.446778e-05f, 3.627576e-05f, -6.68333e-05f, -5.0254308e-05f, 2.514711e-05f, 6.204842e-06f, -4.8005813e-06f, 2.1317766e-05f, -1.977203e-05f, -2.4405515e-05f, 1.2909999e-05f, 8.56113e-06f, -2.2054097e-05f, -7.760335e-06f, -1.3352551e-05f, -4.219261e-06f, -7.5053126e-06f, 1.7712335e-05f, -1.684716e-05f, 7.917764e-06f, -1.1508174e-05f, 1.0336098e-05f, 2.6091737e-05f, -3.3192246e-05f, -1.5683769e-05f, 1.729137e-05f, 1.1194642e-05f, -4.6930876e-05f, -4.025464e-05f, -1.8180244e-05f, 8.42554e-06f, -2.581997e-05f, 1.874633e-05f, -7.481804e-06f, -4.0719065e-06f, -2.7519409e-05f, 2.145337e-05f, 3.6099266e-06f, -1.3098138e-05f, -2.0898251e-05f, 2.5948439e-05f, -4.9200585e-06f, 2.0866355e-05f, 2.2948418e-05f, -1.9886858e-05f, 1.5212945e-05f, -7.037925e-05f, 5.3026994e-05f, -7.3369345e-05f, -5.2469626e-05f, -8.2968465e-05f, 5.8634818e-05f, 5.5323953e-06f, -1.9321304e-05f, 1.6297145e-05f, -4.983291e-06f, 2.3084053e-06f, -7.006422e-06f, -5.1679353e-06f, -1.1861703e-05f, -1.4720062e-07f, -1.3872196e-05f, 1.8312338e-06f, 1.6809105e-05f, 4.2797566e-07f, -1.6826336e-05f, 4.566917e-07f, 8.9870633e-07f, 1.8690753e-05f, -1.0091887e-05f, -4.0338313e-05f, -3.2593078e-05f, 3.6717112e-05f, 9.629579e-07f, -3.26113e-05f, -1.3473438e-05f, 4.379152e-05f, 2.1309215e-06f, -2.5689755e-05f, 1.5409596e-05f, 1.1033156e-05f, -1.1379082e-05f, -3.5450346e-05f, -7.1975633e-06f, -3.36616e-05f, -1.778919e-05f, -5.7568623e-06f, -7.41297e-06f, -1.2261297e-05f, 7.961809e-06f, -1.0941932e-05f, -1.9861668e-06f, -2.3399347e-05f, 2.458913e-05f, 2.3035616e-05f, 3.766769e-06f, -2.9684486e-05f, 6.659866e-05f, 2.09999e-05f, -4.4619595e-05f, -5.2642714e-05f, 2.1325744e-05f, -1.7374578e-05f, -1.5675918e-05f, -3.6776073e-06f, 1.8664561e-05f, -9.13923e-06f, 2.52424e-05f, 3.3223089e-06f, -1.0158096e-06f, -2.0079842e-05f, 1.2277112e-06f, -5.395541e-06f, -1.2001644e-05f, 1.327223e-05f, -4.2512206e-06f, 9.70893e-06f, -1.9726771e-05f, -3.523911e-05f, 5.6640187e-05f, -1.7766542e-05f, -2.9467064e-05f, -5.7094726e-06f, -2.8268147e-05f, 5.755989e-05f, -3.5843586e-05f, 2.2823913e-05f, -2.30995e-05f, 1.129337e-05f, -1.27682115e-05f, -1.8882898e-05f, 8.5530206e-07f, 2.1387485e-05f, -1.580952e-05f, -1.7808046e-05f, 3.140693e-05f, -5.544003e-06f, 3.0532916e-05f, 1.1170104e-05f, -2.1664848e-05f, -2.2147247e-05f, 9.053238e-06f, -8.216309e-05f, 6.2823216e-05f, 1.445879e-05f, 8.296326e-05f, -4.4363537e-06f, -3.1708936e-05f, 5.117768e-05f, -2.2261786e-06f, 1.1919353e-05f, 8.820942e-06f, 1.5251149e-05f, 2.4906215e-06f, -1.7645174e-05f, 2.1716846e-07f, 1.243219e-05f, 1.9013052e-05f, 1.5781085e-05f, 1.2855714e-05f, -1.0007132e-05f, 1.8747555e-06f, 1.48291065e-05f, -2.1860684e-05f, -1.7984199e-05f, -1.8612795e-05f, -2.0274994e-05f, -4.094129e-05f, 1.610359e-05f, 5.7387573e-05f, -2.8028393e-05f, 1.2646492e-05f, -2.7878887e-05f, 1.7862594e-05f, -2.3114186e-05f, 1.8263904e-06f, 2.6901493e-05f, -3.2109405e-05f, -3.8678016e-05f, -2.7914846e-05f, -3.6076817e-05f, 5.9242825e-06f, 2.3337538e-05f, -1.5903674e-05f, -2.6208045e-06f, 2.8600496e-05f, -1.3959884e-05f, 1.05463405e-05f, -3.1127856e-06f, 1.4169363e-05f, 2.9433224e-05f, -7.7934616e-05f, -8.461436e-05f, 7.4731804e-05f, -2.1494494e-05f, -5.6991797e-05f, 1.2748143e-05f, -6.754622e-05f, 8.685113e-06f, -1.861022e-05f, 1.727762e-05f, -1.1211053e-05f, -1.5718075e-05f, -1.5638128e-05f, 2.6893492e-06f, -2.0265421e-05f, -1.3402804e-05f, -2.3296485e-05f, 5.5102796e-06f, 1.1682221e-05f, 2.6768024e-07f, -3.7789894e-06f, -1.765007e-05f, -2.3271792e-07f, -5.7115326e-06f, 4.1451694e-05f, 4.239924e-05f, -2.2372037e-06f, 9.21341e-06f, 1.3694224e-05f, 4.0192146e-05f, -4.7960217e-05f, 3.6642276e-05f, -9.860715e-06f, 9.0451556e-07f, 2.4515093e-05f, 1.9903944e-06f, 4.1272597e-06f, -6.1218716e-06f, -3.0720938e-05f, -1.57318e-05f, 7.331514e-06f, -1.1985343e-06f, -2.3103266e-05f, 2.50874e-05f, -2.8107068e-05f, 3.8314743e-06f, -2.319979e-05f, 1.4057034e-05f, 1.4421884e-05f, 1.2504404e-05f, -6.853263e-05f, -1.0901575e-05f, 5.1797044e-05f, -4.3752418e-05f, -6.2323015e-05f, -1.8938981e-05f, -1.3113613e-05f, 8.725452e-06f, 7.0196575e-06f, -8.411362e-06f, 1.9166264e-05f, -1.267888e-05f, 1.9295541e-05f, 1.6771828e-05f, 1.3388783e-05f, -1.5024909e-05f, 7.1652073e-07f, 8.237015e-06f, -9.000011e-06f, 1.322733e-05f, -4.7343674e-06f, -5.5642264e-05f, -1.5897222e-05f, 5.12533e-06f, -5.5069242e-05f, 3.915011e-05f, 1.3128388e-05f, 7.02228e-05f, 6.1519895e-05f, -2.0494246e-05f, 5.3266085e-06f, -1.0550844e-05f, -7.7931645e-06f, 2.809746e-05f, 2.0690595e-05f, 2.729367e-05f, 2.8199034e-05f, 9.614338e-06f, 2.2019306e-06f, -5.1351967e-06f, 5.8123837e-06f, 2.737935e-05f, -2.1858841e-05f, -2.6153084e-05f, -1.6148482e-05f, -8.8338034e-05f, -3.4036766e-06f, 5.2422518e-05f, 3.726722e-05f, 2.1020052e-05f, -9.889275e-05f, -4.650985e-05f, 8.850112e-05f, -2.3842456e-05f, -1.8010178e-05f, 1.9001876e-05f, 3.5273513e-06f, 1.3207356e-05f, -1.8289316e-05f, -1.7396997e-05f, -8.484916e-06f, -9.189412e-06f, -2.1441e-05f, -1.960862e-05f, -6.000728e-06f, 9.492811e-06f, -4.344352e-06f, -1.2213412e-05f, 1.4781317e-05f, -5.3079602e-05f, -5.263696e-05f, -1.16034635e-05f, -3.191639e-05f, 1.2374832e-05f, 1.4711583e-05f, 2.6626614e-05f, -3.5649013e-05f, -1.6251908e-05f, -2.2128517e-05f, 1.46815e-05f, 1.3662259e-06f, -3.836665e-05f, 3.3917645e-06f, -6.167224e-06f, 2.3036273e-05f, 3.1456475e-06f, 1.2125507e-05f, -1.2601024e-05f, 2.118627e-05f, -1.6417789e-05f, 1.3403223e-05f, 1.8495997e-05f, -3.4851317e-05f, 3.2534786e-05f, 3.76438e-05f, -7.748953e-05f, -6.0277976e-05f, -6.906099e-05f, 2.0777217e-05f, -4.106406e-05f, -2.5646745e-05f, 7.825759e-06f, 8.482999e-06f, -8.955937e-06f, 4.735809e-06f, 6.3890216e-06f, -1.0211588e-05f, -2.932304e-07f, 1.29111e-05f, 3.5903822e-06f, 6.3799653e-06f, -5.877003e-06f, 1.9423176e-05f, 4.8977263e-06f, -1.1947263e-05f, -1.2969088e-05f, -2.1843713e-05f, -2.0244208e-05f, 8.020979e-05f, -2.7262635e-05f, 6.851312e-05f, -3.376615e-05f, 3.4330067e-05f, -2.7029682e-05f, -1.9051033e-05f, -1.0384202e-05f, 2.6227064e-05f, 9.4747165e-06f, 2.6969323e-05f, -3.536951e-05f, 3.3032706e-05f, -2.7698046e-05f, -2.1906244e-05f, 2.1438167e-05f, 1.132599e-05f, 2.8326458e-05f, 1.2424288e-06f, -8.760942e-06f, 2.6159538e-05f, -1.9866497e-05f, -3.6964815e-05f, 4.5860645e-05f, 7.5026524e-05f, -0.000109228036f, -4.3292144e-05f, 2.5695725e-05f, 6.106208e-05f, -7.39153e-05f, -3.5414112e-05f, 3.811971e-06f, -1.2955454e-05f, -2.3100476e-05f, 1.157032e-05f, 1.2863719e-05f, -1.1794634e-05f, -1.5932465e-05f, -2.2992084e-05f, 2.1361931e-05f, -1.8589919e-05f, -4.4633857e-06f, -1.0484341e-05f, -1.9611593e-05f, -7.64951e-06f, 7.413198e-06f, -2.3953194e-06f, -1.7600838e-06f, 8.146768e-05f, -4.376522e-05f, -4.510215e-07f, -7.5539865e-05f, -4.366255e-05f, 7.3371295e-05f, 8.0975595e-05f, -2.0491732e-05f, 3.5968256e-05f, -1.3479862e-05f, -4.7104273e-05f, -3.9604787e-05f, -3.9501407e-05f, -2.7553462e-05f, -2.7950964e-05f, -3.02017e-05f, 3.806322e-05f, 1.160489e-05f, -2.1492542e-05f, 3.7228754e-06f, -3.201739e-05f, 2.9124949e-05f, 8.3427985e-06f, -0.00010296616f, 9.789589e-05f, -4.455906e-05f, 4.959074e-05f, 7.543053e-05f, 8.067546e-05f, 5.2500077e-06f, -8.344872e-05f, -1.2151197e-05f, -1.7116663e-05f, -1.9529089e-05f, 1.1725727e-05f, -2.2100669e-05f, 2.1298787e-05f, -9.570122e-06f, 2.618151e-06f, 4.8527927e-06f, 4.6229934e-06f, -1.0349206e-05f, 3.2780727e-06f, 1.2522914e-05f, 5.4119555e-06f, -2.0863896e-05f, -6.1935934e-06f, 1.0641207e-05f, 7.627493e-05f, -6.0754087e-06f, 7.9015015e-05f, 3.0027742e-05f, -6.031878e-05f, -1.2625353e-05f, 5.8050216e-05f, 1.0517642e-05f, -2.4852317e-05f, 1.8431936e-05f, 1.5109846e-05f, 3.3569995e-05f, 3.509834e-05f, 2.0001406e-05f, -4.163684e-05f, 6.696987e-07f, -2.589691e-05f, 2.6709873e-05f, 1.6221717e-05f, 3.4584802e-05f, 2.3306045e-05f, 2.0982754e-05f, -5.3378812e-06f, -0.000109230496f, -2.669232e-05f, -1.5132728e-05f, 6.651945e-05f, -5.9226382e-05f, -8.580001e-05f, -8.04528e-05f, 1.7679315e-05f, -2.1753052e-05f, -1.0876078e-05f, 1.7590954e-05f, -9.430087e-06f, -2.2641394e-05f, -2.2404578e-08f, 1.3223629e-05f, -2.1506154e-05f, -1.4091496e-05f, 1.928671e-05f, -2.033878e-05f, 3.9749984e-06f, -2.5396566e-05f, 1.50024425e-05f, -1.100019e-05f, 1.4053848e-05f, -5.806716e-05f, 2.0286452e-06f, -5.1704484e-07f, 3.9556646e-05f, 6.609957e-05f, 5.439591e-05f, -1.6502025e-05f, 4.954561e-05f, -4.3391705e-05f, -1.471028e-05f, -4.6834673e-05f, 2.1908852e-05f, 3.303233e-05f, 1.4529492e-05f, 1.0572624e-05f, 3.1654447e-05f, 3.8524646e-05f, -2.739171e-05f, 5.710588e-06f, 3.3616652e-05f, 1.6190748e-05f, -2.3807355e-05f, -1.5339783e-05f, -2.1616239e-05f, 7.6544675e-05f, 4.9540184e-05f, -0.00011797874f, 7.503213e-05f, -7.985258e-05f, -3.421981e-05f, 8.318908e-05f, 8.872873e-05f, 2.8937677e-06f, -1.2391114e-07f, -4.378046e-06f, 7.965274e-06f, -8.548541e-06f, 1.1734385e-05f, -1.9054436e-05f, -1.9842157e-05f, 1.6591026e-05f, 9.215923e-06f, -2.3938768e-05f, -1.1895186e-05f, -1.1291395e-05f, 1.3012569e-05f, 9.381478e-06f, 1.5462976e-05f, 2.5734951e-05f, -6.353118e-05f, 8.3784165e-05f, -1.548227e-05f, -6.38073e-05f, -4.7847167e-05f, -3.086327e-05f, -1.9122412e-05f, 4.038115e-05f, -3.7888472e-06f, -5.6672827e-05f, -4.6751957e-05f, -2.6057864e-05f, -1.0332512e-05f, 3.510303e-05f, -9.751129e-06f, 2.0175676e-05f, 1.2174878e-05f, -1.2437233e-05f, 3.639529e-05f, 4.2800806e-05f, -3.590434e-05f, -1.3153522e-05f, 9.1653255e-06f, 2.2360919e-05f, 3.322478e-05f, 8.750321e-05f, 5.3960786e-05f, -5.2457475e-05f, -0.00011622226f, -6.9410053e-06f, 8.943214e-05f, 2.859351e-05f, -3.7818188e-06f, 1.6095353e-05f, 1.5373065e-06f, -2.2484225e-07f, 2.6734162e-05f, -2.8151926e-05f, -2.7309814e-05f, -6.721343e-06f, -2.3343703e-06f, 1.0078844e-05f, -2.657052e-05f, 5.111518e-06f, 7.833802e-06f, -1.31818715e-05f, -1.790465e-05f, 0.00010900842f, 4.705244e-06f, 7.074104e-05f, -9.110718e-05f, -3.7332415e-05f, -0.00010748102f, -3.2081673e-05f, -8.698549e-05f, -3.338546e-05f, 1.1623906e-06f, 2.1722217e-05f, 5.588391e-06f, -2.9995317e-05f, 5.6239907e-05f, -1.3105578e-06f, 5.2120075e-05f, 2.617882e-06f, 3.323569e-05f, 1.7358627e-05f, -2.0246858e-05f, 6.4061074e-05f, -2.060851e-05f, -1.542482e-05f, 6.551981e-05f, 4.9885493e-05f, -5.9694405e-05f, -1.6858256e-05f, -0.0001250892f, -5.28892e-05f, -0.00011762801f, 5.469069e-05f, -7.850951e-05f, -6.6515304e-06f, 1.1932013e-05f, -5.965603e-06f, -1.602901e-05f, -2.862596e-05f, -1.9316563e-05f, 4.717264e-06f, -7.0398364e-06f, 1.5918638e-06f, -2.3632443e-05f, -1.538669e-05f, -6.759642e-06f, -9.978444e-06f, -3.1056093e-06f, -9.259966e-06f, 6.840152e-06f, 3.2997577e-05f, 5.1346036e-05f, -4.2745727e-05f, 4.5471694e-05f, -9.500611e-05f, -1.8177921e-05f, 0.00014138296f, 0.00011107068f, -5.4725642e-05f, 3.8590482e-05f, 7.360805e-05f, 5.9287187e-05f, 5.9920698e-05f, 3.468961e-05f, -1.6190837e-05f, -4.730753e-05f, -3.9664086e-05f, -4.8550914e-06f, -4.9889055e-05f, 3.0715546e-05f, -5.5827153e-05f, 2.794368e-05f, 3.3634922e-05f, 5.2082916e-05f, -8.236528e-05f, 0.00011617538f, -1.1014018e-05f, -2.8453393e-05f, 0.00011175848f, -1.2001686e-05f, 3.801597e-05f, -3.018825e-05f, -9.02783e-06f, 1.8171266e-05f, -2.2675804e-05f, 2.4320754e-05f, -1.0716453e-05f, -4.0066598e-06f, -2.8316623e-05f, -2.011525e-05f, 7.375591e-06f, 2.2129564e-07f, 2.4264611e-05f, -2.423441e-05f, 1.0953627e-05f, -1.1591628e-05f, -1.0571943e-05f, 1.0512051e-05f, 3.789989e-05f, -0.0001368575f, 7.397329e-05f, 0.00012305217f, -4.3035787e-05f, -4.676525e-05f, -1.2647163e-05f, 8.660301e-05f, 6.1766536e-05f, -3.5947635e-06f, -1.883489e-05f, 1.4719721e-05f, 6.186198e-05f, -1.414428e-05f, 1.3376561e-05f, -2.2915225e-05f, -1.1938678e-06f, -1.9959385e-05f, -7.4086915e-05f, 1.9864634e-05f, -6.675869e-05f, -1.881605e-05f, -3.250763e-06f, 7.650071e-05f, -2.22575e-05f, 2.4001201e-05f, 2.4413024e-05f, -0.00011269912f, -4.243327e-05f, -2.3015682e-05f, 1.3763943e-05f, 9.7614015e-05f, 1.230135e-05f, -1.22505135e-05f, -2.1021826e-05f, -1.937346e-05f, -2.4335257e-05f, 2.2490178e-05f, 9.737443e-06f, 1.4915847e-05f, 4.877691e-06f, 7.82605e-06f, -4.7239964e-06f, 2.142354e-05f, -9.8085075e-06f, 9.5668465e-06f, 9.1074935e-06f, 1.7468508e-05f, 8.33944e-05f, -0.00012771734f, 1.2029113e-05f, 3.8685834e-05f, -5.1994437e-05f, -0.000103146784f, 0.00011649627f, -9.4018666e-05f, -1.4892496e-05f, -3.5380537e-05f, -5.3196847e-05f, 4.1838415e-05f, -4.588874e-05f, 1.3456226e-05f, 3.5114932e-05f, 2.5610765e-05f, 3.6901823e-05f, 6.932582e-06f, -5.4739256e-05f, -6.2103514e-05f, -3.1678521e-06f, 7.69217e-06f, -3.2873108e-05f, 5.6710032e-05f, 1.5949787e-05f, -7.4813e-05f, 6.595315e-05f, 3.1929474e-05f, 0.00012479797f, -4.02511e-07f, -5.8624002e-05f, 2.5072986e-05f, 6.10625e-07f, -1.0344346e-06f, 1.3985951e-05f, 1.766784e-05f, -1.9739537e-05f, -5.580905e-07f, 1.4709655e-05f, 1.0655548e-05f, 1.9044603e-05f, 1.2203858e-05f, -6.103606e-06f, 3.2130295e-06f, -1.22611145e-05f, 1.6391912e-05f, -1.5481091e-05f, -1.1161516e-05f, -3.7966052e-05f, -0.00010635561f, -9.375548e-05f, 9.458107e-05f, 9.364869e-06f, 8.6660635e-05f, 8.402095e-05f, -2.3001432e-07f, 2.5639847e-06f, -3.5271707e-05f, -1.3594446e-05f, 5.156762e-06f, -9.451185e-07f, -2.0953845e-05f, 6.545431e-05f, 3.478727e-05f, 5.7095825e-05f, 8.325605e-05f, -5.8846395e-05f, -4.184011e-05f, -4.9949867e-05f, -5.8151127e-05f, 5.7883455e-05f, -6.512947e-05f, -5.3636097e-05f, -5.7562193e-05f, -5.61119e-05f, 5.1759907e-05f, -5.8754704e-05f, -6.2165236e-05f, -0.00010680371f, 6.0293536e-05f, -1.6585405e-05f, 1.590821e-05f, 1.2164481e-05f, -1.2502275e-05f, 1.6567046e-05f, 2.9375676e-06f, 2.1612383e-05f, -1.737206e-05f, 4.7644503e-06f, -2.3329887e-05f, -2.3727296e-07f, 7.2016564e-06f, -2.3042207e-05f, 1.6243584e-05f, 3.6127856e-06f, -1.9318051e-05f, 0.00010183537f, 0.000107196065f, 6.979694e-05f, -3.645352e-05f, -4.9691957e-05f, -7.77881e-05f, -7.641069e-05f, 3.077034e-05f, -8.667776e-07f, -7.019226e-05f, -5.13653e-05f, 7.836993e-05f, 5.95626e-05f, -4.9987324e-05f, -6.339547e-05f, 5.671503e-05f, -8.0732614e-05f, 8.651579e-05f, 2.6622762e-05f, -5.189431e-06f, -3.7030924e-05f, 8.117297e-05f, -4.7505437e-05f, 5.1154067e-05f, -9.020676e-05f, 3.658208e-05f, -0.00012677551f, -8.181714e-05f, 0.00011808697f, -3.9531227e-05f, 2.0776259e-05f, -3.366183e-05f, 1.3602289e-05f, -1.6247554e-05f, -1.3009459e-06f, 1.9207884e-05f, -2.0345453e-05f, -1.8569433e-05f, 3.398325e-06f, -6.569226e-06f, -9.410945e-06f, -7.2116104e-06f, -4.11154e-06f, 5.028749e-07f, 5.352483e-06f, -1.0644109e-05f, -1.870841e-05f, -2.4967578e-06f, 9.8709046e-05f, -7.575981e-05f, 1.0862827e-06f, 6.524158e-05f, -6.3187465e-05f, 2.3758228e-06f, -5.850447e-05f, -8.043069e-05f, -1.463807e-05f, 2.900107e-05f, 3.9921673e-05f, 7.1476854e-05f, -2.5497058e-05f, 3.6736008e-05f, 1.6269412e-06f, 2.2108209e-06f, -6.732433e-05f, -2.990273e-05f, -1.9753477e-05f, 6.772765e-05f, 4.8127615e-05f, -5.0301855e-06f, -8.081921e-05f, 4.2352e-05f, 1.4977943e-05f, -8.1366e-05f, -0.00012337898f, -5.0336632e-05f, 8.845919e-05f, 7.527113e-05f, 9.766728e-05f, -8.479541e-05f, -3.674691e-06f, 1.2238621e-05f, 5.505273e-06f, -1.6327327e-05f, -2.1148488e-05f, -3.1271795e-06f, 1.10473575e-05f, 4.4641365e-06f, 7.183646e-07f, 1.1249054e-09f, 8.086945e-06f, -8.861105e-06f, -1.9652773e-05f, -9.159205e-06f, -1.1838055e-05f, 4.3331356e-06f, -8.9278525e-05f, -9.808282e-05f, -6.452875e-05f, 4.0464554e-05f, -0.00010140121f, -0.00011541248f, -7.5580065e-05f, -2.4620738e-05f, 1.38805435e-05f, 3.0782576e-05f, 6.0367776e-05f, 9.171508e-06f, 6.406325e-05f, 6.0385493e-05f, -2.5685244e-05f, 6.401748e-06f, -6.063458e-05f, -4.1217507e-05f, -6.015224e-05f, 7.1999035e-05f, 1.5633115e-05f, 8.5912885e-05f, 8.634093e-06f, 3.322155e-05f, -3.0021882e-05f, 3.921489e-05f, 3.9937924e-05f, -3.4451703e-05f, 6.322511e-05f, 5.794531e-05f, -3.1018673e-05f, 0.0001030107f, 1.6994861e-06f, -9.665566e-06f, 1.7669647e-05f, 5.70559e-06f, -9.346844e-06f, 1.728964e-05f, 1.263489e-05f, 1.7682607e-05f, -9.76559e-06f, 7.825886e-06f, 7.724728e-06f, 9.732608e-06f, 9.407e-06f, 1.4127323e-05f, 1.2202671e-05f, 2.2376655e-05f, 2.1957561e-05f, 7.912473e-05f, 5.9164326e-05f, -2.9107947e-05f, -1.6699089e-05f, -3.91222e-05f, 2.1560112e-05f, 0.00011247586f, -4.7352707e-05f, -2.3365734e-05f, 1.46102075e-05f, 4.194114e-06f, 5.2482363e-05f, 6.8836314e-05f, 4.9777314e-05f, -6.978216e-05f, -2.3549705e-05f, -2.7657547e-05f, 7.058287e-05f, 4.9704522e-05f, 5.9209083e-06f, -2.6311787e-05f, -5.9098915e-05f, -2.1666794e-05f, -4.9941074e-05f, 1.59666e-05f, -3.635615e-05f, -7.227243e-05f, -2.3951558e-05f, 9.0407404e-05f, -3.2686934e-05f, -3.599696e-05f, 2.213745e-06f, 1.3075614e-05f, 1.5586304e-05f, -1.5889807e-05f, 1.4897514e-06f, 1.6560885e-05f, -1.1550002e-05f, 7.5305375e-06f, 3.6179904e-06f, -3.7841514e-06f, 7.7558625e-06f, -5.29707e-07f, -3.5699543e-06f, 9.7414995e-06f, -1.1026028e-05f, -1.2501172e-05f, -2.5514757e-06f, -4.15718e-05f, 0.000120993f, -7.198915e-05f, -9.938247e-05f, -5.16642e-05f, -5.105268e-06f, -8.771726e-05f, -2.864965e-05f, 4.052651e-05f, 6.005541e-05f, -1.5619173e-05f, 2.3778573e-05f, -6.4348214e-06f, 6.488774e-05f, -5.3777036e-05f, -3.0199119e-05f, -2.9537548e-05f, 4.391317e-06f, 5.2461346e-05f, 4.8237216e-05f, 1.2993047e-05f, 5.195782e-05f, 2.8742095e-06f, 3.91323e-05f, 6.2870226e-05f, -0.00012119136f, 3.6755606e-05f, 8.793437e-05f, 4.7296122e-05f, 1.588445e-05f, -1.6210422e-05f, 2.3030681e-05f, -2.681079e-06f, -1.7796923e-05f, -1.4330387e-05f, -7.832078e-06f, 1.8673656e-05f, -1.5341415e-05f, 1.0167923e-05f, -1.48998915e-05f, 1.6547056e-05f, 1.4684893e-05f, -1.5651412e-05f, -1.5752104e-07f, -4.9726086e-06f, -1.2051548e-05f, -1.30234685e-05f, -0.00011066618f, 4.20641e-05f, -2.3999505e-06f, 5.057292e-05f, 5.4643708e-05f, -1.535324e-05f, 2.2215918e-05f, 1.743105e-05f, 4.911956e-05f, -3.1807278e-05f, -2.3971854e-05f, -5.14424e-05f, 5.4842203e-05f, -1.2879548e-05f, 1.6253363e-05f, 5.8881542e-05f, -2.198571e-05f, 1.9230627e-05f, 1.3196864e-05f, -3.8278053e-05f, -2.1188498e-05f, -5.5822657e-06f, 1.2464066e-05f, 9.508053e-06f, 3.759714e-05f, -4.1437048e-05f, -4.0696963e-05f, -6.1178725e-05f, -1.74618e-05f, 9.057191e-05f, -3.145711e-05f, -6.406822e-05f, 1.1344483e-05f, -4.696868e-06f, -1.9040765e-05f, -8.854284e-07f, 1.4664675e-05f, -1.6128777e-06f, -7.5435605e-06f, 1.7283053e-05f, -2.0084267e-06f, 1.27765525e-05f, -1.7522827e-05f, -2.0910573e-05f, 1.2224182e-06f, -9.247123e-06f, -7.932321e-06f, -8.475046e-06f, 5.7026136e-05f, 3.608087e-05f, 2.4741366e-05f, -8.5044776e-05f, 1.4708392e-05f, 1.5493104e-05f, 7.979576e-05f, 3.214336e-05f, -1.1707167e-05f, -4.393664e-05f, -2.489866e-05f, 4.9981085e-05f, 2.6660411e-05f, -3.806603e-06f, -6.1984836e-05f, 5.5318134e-05f, -5.909739e-06f, 1.0859703e-05f, 6.059969e-05f, 3.161987e-05f, 6.2678396e-06f, -3.6873094e-05f, -1.419445e-05f, 3.4390585e-05f, -1.0799139e-05f, 2.7115599e-05f, 4.9053542e-05f, 1.1638116e-05f, -2.8829783e-05f, 2.1700178e-05f, 3.332584e-05f, 7.957034e-05f, 5.191125e-06f, -1.7209128e-05f, 2.0687163e-05f, -9.060905e-06f, 6.280016e-06f, 2.511523e-06f, -1.313216e-06f, -1.4577862e-05f, 1.5134867e-05f, 1.48607e-05f, -1.1693487e-05f, -1.1261129e-05f, -5.8223327e-06f, -2.2122946e-05f, -1.5323543e-05f, -1.1028321e-05f, 7.057512e-05f, 5.2339048e-05f, 1.9622265e-05f, 4.019963e-05f, -6.263516e-05f, -1.5636493e-05f, -7.802173e-05f, -3.3778728e-05f, -4.0964944e-05f, -7.0086855e-05f, 1.7129107e-05f, 4.596813e-05f, 4.6518646e-05f, -5.8593952e-05f, -7.5553885e-06f, -7.0167975e-05f, -3.978422e-05f, -9.472621e-06f, 2.5681922e-05f, 3.65003e-05f, -4.0788353e-05f, 3.0730727e-05f, 2.5120615e-05f, -2.4427002e-06f, 9.665969e-05f, -7.489352e-06f, -0.00012214617f, 4.0352923e-05f, -3.420383e-05f, -9.837754e-05f, -6.549356e-06f, 3.828017e-06f, 2.1957676e-05f, -9.5463165e-06f, -1.595242e-05f, -6.357376e-06f, -1.3110752e-05f, 1.3352849e-05f, 9.503762e-06f, 3.6784277e-06f, 1.2088043e-05f, -4.728672e-06f, 1.7067996e-05f, -1.6839444e-05f, 4.5290067e-06f, -6.344688e-07f, -1.0806573e-05f, 1.9387515e-05f, -4.950494e-05f, -4.8222537e-06f, 8.143305e-06f, 7.096892e-05f, 7.940395e-05f, -6.9472924e-05f, 5.5861386e-05f, -5.7673424e-05f, -4.794314e-05f, 8.353127e-06f, 4.0877076e-05f, 4.4374767e-05f, -4.424485e-05f, 2.9331195e-05f, 3.2462693e-05f, 3.9374605e-05f, 2.9523173e-05f, -1.20884515e-05f, 2.1721507e-05f, 2.882887e-05f, -1.9062522e-06f, -2.4855686e-05f, -4.2744605e-06f, -4.51685e-05f, -2.427057e-05f, -8.1890954e-05f, 1.7535853e-05f, -1.2553587e-05f, 7.919888e-05f, -2.9109062e-05f, 1.6933587e-05f, 5.4587555e-05f, -4.62394e-06f, 5.894611e-06f, 9.284394e-06f, -1.669664e-05f, -1.7451917e-05f, 9.462315e-06f, 9.601287e-06f, 1.9230458e-07f, -1.2129977e-05f, -4.757379e-06f, 7.805494e-06f, -1.4084485e-05f, 7.401713e-06f, -1.8830176e-05f, 2.0985724e-05f, -1.9972235e-06f, -6.3844614e-05f, 2.5692225e-05f, 2.1001464e-05f, -5.6988636e-05f, 1.9413746e-05f, -3.3232256e-05f, -5.0160314e-05f, 1.40218535e-05f, 4.4395485e-05f, -5.8211266e-05f, -2.527433e-05f, 3.2425793e-05f, -5.139581e-05f, 3.458777e-05f, 4.808765e-05f, -1.3465502e-05f, 2.9030203e-05f, -2.1176882e-05f, 2.3589299e-05f, -9.876707e-07f, 3.3449e-05f, 2.7421358e-05f, -8.375429e-06f, -4.694433e-05f, 4.863987e-05f, 8.3202474e-05f, 5.245589e-05f, 0.000110071116f, 1.08433915e-05f, 3.7268386e-05f, -2.6690732e-05f, -0.000102637256f, 1.2562297e-05f, -1.46932925e-05f, 2.596553e-07f, -7.930927e-06f, 1.7628352e-05f, 1.1789995e-05f, 3.817977e-06f, 4.8286115e-06f, 2.063615e-05f, 1.4721608e-05f, 2.0810796e-05f, -2.1410557e-05f, 3.3033686e-07f, -1.1508331e-05f, 5.1578127e-06f, -8.644347e-06f, -1.0178085e-05f, -4.955695e-05f, -5.5331508e-05f, 1.5848414e-05f, 5.700065e-05f, -3.1659278e-05f, 4.7690854e-05f, -4.5709035e-05f, -3.4505305e-05f, 1.6971497e-05f, -2.9871678e-06f, -5.0340346e-05f, 4.21068e-05f, 1.22594065e-05f, -5.0996066e-05f, -9.945395e-06f, 4.480691e-06f, 2.9571125e-05f, 1.518556e-05f, -1.0829233e-05f, 3.0764542e-05f, -4.050599e-06f, 1.8661773e-05f, 3.89634e-06f, -8.229092e-05f, -1.443545e-05f, -6.979545e-05f, -8.327324e-06f, 6.7483175e-05f, 8.408961e-05f, 7.515001e-05f, -2.7546557e-05f, 1.5370664e-05f, -1.1046326e-05f, 1.1574848e-05f, -9.790499e-06f, -9.641022e-06f, -1.5985079e-05f, -2.0762533e-05f, 4.236883e-06f, -9.483647e-06f, 1.21228395e-05f, -3.062812e-06f, -1.42398685e-05f, -2.2218239e-05f, 2.5402207e-06f, 1.5955247e-05f, -1.0847503e-05f, 4.6390316e-05f, 7.19836e-05f, -1.2178273e-05f, 4.00313e-05f, 5.1991497e-05f, 7.88773e-06f, 1.193991e-06f, 2.1418662e-05f, -6.8381946e-06f, -1.7973609e-05f, -1.2985945e-05f, -2.3233391e-05f, -3.369149e-05f, -2.1287378e-05f, -3.2628075e-05f, 2.0983034e-05f, 9.980474e-06f, -2.2540951e-05f, 1.3619298e-06f, 1.6245876e-05f, -3.16767e-05f, -7.2866624e-07f, -2.965371e-06f, -2.9995508e-06f, -0.0001072618f, -0.00012076499f, 8.430337e-05f, 8.592434e-05f, 7.020679e-05f, -8.6366315e-05f, 1.027574e-05f, 8.982645e-05f, 2.1008827e-06f, 1.8116385e-05f, 2.3300536e-06f, 1.282931e-05f, -3.4797201e-06f, 8.932732e-06f, 7.9799465e-06f, 6.7488813e-06f, 6.3483344e-06f, -1.5441912e-05f, 1.0913618e-05f, 1.0176579e-05f, -1.0936711e-05f, 1.0019635e-06f, 9.982644e-06f, -1.5849453e-05f, 5.8946902e-05f, 5.4253487e-05f, -5.1656525e-06f, -6.2245665e-05f, 6.3550695e-05f, -2.1529873e-05f, -3.5611498e-05f, -1.4580749e-05f, -1.6594086e-05f, 1.849332e-05f, -5.327425e-05f, 4.9799914e-05f, -3.641983e-05f, -9.4574325e-06f, 9.2910926e-07f, -3.1774285e-05f, 3.6420495e-06f, 2.7325697e-05f, 5.672453e-06f, -1.1113806e-05f, -1.7873033e-05f, 2.0887659e-05f, -1.3769853e-06f, -1.1416123e-05f, 3.2065313e-05f, -9.59464e-07f, 3.116547e-05f, -1.2000477e-05f, 9.453868e-05f, -8.035539e-05f, -2.4275876e-05f, 5.6315792e-05f, 1.502999e-05f, 1.418323e-05f, -2.2132865e-06f, 1.46417415e-05f, -4.708526e-06f, 9.440473e-07f, -3.7509667e-06f, -1.5216006e-05f, -9.3305054e-08f, -1.5861217e-05f, -2.1715412e-06f, 6.5270643e-07f, 2.044346e-06f, -2.480842e-06f, 2.2047234e-05f, -2.0753832e-05f, -1.6839016e-05f, -4.1724903e-05f, -3.179141e-05f, -6.06598e-05f, -3.9096303e-05f, 3.8900907e-05f, -6.875156e-05f, 8.1590906e-07f, 1.0866343e-05f, -2.2407874e-05f, 2.7931666e-05f, 3.4986e-05f, 1.604821e-05f, -3.295826e-05f, 1.6140724e-05f, 3.6985057e-05f, 1.1043794e-05f, -2.2561257e-05f, -5.275894e-06f, -1.995183e-06f, -2.9364097e-05f, 3.4424378e-05f, 3.4207747e-05f, -9.141307e-06f, 6.233837e-05f, -7.9432044e-05f, -0.00010046361f, -8.1532686e-05f, 6.5308996e-05f, 2.121955e-05f, -8.948606e-05f, -5.8800502e-05f, 1.990919e-05f, -4.654526e-07f, -2.129785e-05f, -4.4405897e-06f, -1.3542497e-06f, 2.0336836e-05f, -1.261793e-05f, -1.21497615e-05f, 1.9515424e-05f, 1.0284993e-05f, -7.1374343e-06f, -1.837291e-05f, 1.5321473e-05f, 1.918082e-05f, -3.0092872e-06f, -3.5202252e-06f, -5.7283978e-05f, -2.6081927e-05f, -1.9406807e-05f, -4.104142e-05f, -1.8435892e-05f, -5.0386716e-05f, 2.1439282e-05f, -1.03500415e-05f, 3.0226536e-05f, 4.4296936e-05f, -1.7287808e-05f, 4.4912675e-05f, -8.656188e-06f, -1.3242247e-05f, 4.4508837e-05f, 4.128631e-05f, 1.182406e-05f, -1.9568959e-05f, 3.422444e-05f, -2.8646236e-06f, 3.0153417e-06f, -1.4410359e-05f, 2.5669631e-05f, 1.4046421e-05f, 6.9057576e-05f, -4.92673e-05f, -2.6543246e-05f, -1.0793519e-05f, -7.7734716e-05f, 3.3314573e-05f, 2.3527411e-05f, 4.0848223e-05f, -1.4486375e-05f, 1.5547881e-05f, -1.6319556e-05f, -8.7902816e-07f, -1.8413518e-06f, -1.0160912e-05f, -3.809349e-06f, -2.3524728e-05f, 6.7601804e-06f, -3.3960403e-06f, 1.4950897e-05f, 1.325611e-05f, 1.1706812e-05f, 3.1104503e-06f, 6.8410077e-06f, -4.019165e-06f, 5.9349677e-06f, -3.7865444e-05f, 4.0763234e-06f, -2.9926225e-05f, 1.6057018e-05f, -5.0940664e-05f, 1.3514527e-05f, 4.565408e-06f, -9.217264e-06f, 2.7637774e-05f, -5.0858573e-05f, -3.9443454e-05f, -2.8599668e-05f, 1.6153052e-05f, -1.2926114e-05f, 2.9875266e-05f, 1.7666302e-05f, -3.716482e-06f, -1.822531e-05f, -1.613663e-05f, -7.799784e-06f, -4.9304367e-06f, 6.181387e-06f, -3.093766e-05f, 2.0914455e-05f, 8.6600245e-05f, -7.812566e-05f, -4.8947175e-05f, 0.00010955185f, 7.291094e-05f, 3.9114133e-05f, 7.786594e-05f, 1.2886472e-05f, -1.0130776e-05f, -1.398117e-05f, -2.3111896e-05f, -1.8518162e-05f, 1.9099216e-05f, -1.4764685e-05f, 1.6312651e-05f, 6.049574e-06f, 5.149425e-06f, 1.04411265e-05f, -1.1003098e-05f, -6.7118744e-06f, -2.1022151e-05f, -1.51955055e-05f, 7.2608725e-07f, 6.904196e-06f, -3.8042133e-05f, 2.35707e-05f, 3.369233e-05f, -3.2475633e-05f, -6.459316e-06f, 2.5636824e-05f, -2.9878462e-05f, -3.1596956e-05f, 3.0512303e-05f, 2.7035934e-05f, -1.2666458e-05f, 2.076687e-05f, 3.7392427e-05f, -4.78261e-05f, 2.946784e-05f, -1.2488706e-05f, 1.656587e-05f, -1.2420762e-06f, -1.9188941e-05f, 8.761263e-06f, -9.632385e-06f, 6.3778116e-06f, 2.4274325e-06f, 8.140583e-06f, -5.067042e-05f, -6.812777e-05f, 6.0645296e-05f, -4.2680414e-05f, 6.3835825e-05f, 0.00011306682f, -2.296548e-06f, -7.425349e-06f, 2.3391865e-06f, 3.2650343e-07f, -1.1874355e-05f, 1.4835075e-05f, 4.206958e-07f, -2.0904597e-05f, 1.0331954e-05f, 1.8854786e-05f, 1.40265975e-05f, -3.741656e-06f, 1.8441096e-05f, -2.2261756e-05f, 3.3058277e-06f, 1.4325036e-06f, -1.30457665e-05f, -1.5152029e-06f, 3.9243878e-05f, 6.598673e-05f, -4.892441e-05f, 3.0370409e-06f, -4.903298e-05f, -6.198881e-05f, 3.775039e-05f, 3.3477965e-05f, 1.2976415e-05f, -3.871249e-05f, 3.1943405e-06f, -1.2676324e-05f, 2.4679497e-05f, 8.291123e-06f, -3.832129e-05f, -1.024164e-05f, -2.2487366e-05f, 8.813388e-06f, -1.7931926e-06f, 1.0513505e-05f, 2.6630147e-05f, -9.318828e-06f, 3.8635526e-06f, 2.8946488e-05f, -1.410442e-05f, -0.000105221625f, -1.786104e-06f, 1.5697824e-05f, -6.8046006e-06f, -8.5479165e-05f, 4.376162e-05f, -1.3109275e-05f, 1.4284649e-06f, -1.916202e-05f, 7.3209108e-06f, -3.77289e-06f, 1.9266326e-05f, -2.352237e-05f, 1.20289515e-05f, 1.3434817e-05f, 2.7673696e-07f, 1.3975435e-05f, -2.9994364e-06f, -1.28447355e-05f, -2.1135731e-05f, 8.683657e-06f, -1.6605962e-05f, 2.110668e-05f, 4.0488576e-05f, -4.0096606e-05f, 4.6620476e-05f, -1.1505521e-05f, -4.4041954e-05f, 4.253314e-05f, 4.1505788e-05f, 8.529161e-06f, 3.646549e-05f, 1.199773e-05f, -2.7982458e-05f, 1.9699857e-05f, 1.2377775e-05f, 6.319107e-06f, 2.2417726e-05f, -1.0868361e-05f, -1.8605102e-05f, -1.7811502e-05f, 1.3797849e-05f, 1.2365693e-05f, -6.6646344e-06f, -2.7836304e-06f, 1.1773364e-05f, 1.4836241e-05f, -2.5798352e-05f, 2.1422664e-05f, 6.6815475e-05f, 9.432097e-05f, -7.0035435e-06f, 4.2590986e-05f, -1.0329311e-05f, -1.843455e-05f, 4.9199825e-06f, 1.1881138e-05f, 1.2619638e-05f, 1.41472165e-05f, 3.7688164e-06f, -4.5746774e-06f, -1.3824514e-05f, 1.9258467e-05f, 1.3611331e-05f, -1.2625073e-05f, -1.1234179e-05f, 2.360046e-06f, -1.1902431e-05f, -2.0881176e-05f, 7.381038e-06f, -3.4772577e-06f, 8.336661e-06f, 5.7902816e-05f, -8.689298e-06f, -4.9531838e-05f, -4.6405443e-05f, -3.1910065e-05f, 4.28702e-05f, 1.773836e-05f, 9.580997e-06f, 8.926227e-06f, 2.93645e-05f, -8.8794295e-06f, -8.6114105e-06f, -3.92928e-05f, 3.4072814e-06f, -7.649378e-06f, -2.6315456e-06f, 9.9890285e-06f, -3.6285942e-06f, -1.9489507e-05f, 6.938324e-06f, 1.59775e-05f, 6.1393366e-06f, -9.244192e-05f, -5.374586e-05f, -0.000107057494f, -7.21444e-05f, -7.489983e-05f, -5.3930955e-05f, -7.2412535e-05f, -8.1045015e-05f, 1.7519124e-05f, 1.5231077e-05f, -1.1594673e-05f, 1.2068169e-05f, -2.2068887e-05f, 2.3030923e-06f, 3.5956916e-06f, -9.703787e-06f, -4.1340204e-06f, 1.6005733e-05f, -6.7316e-07f, 8.468994e-06f, -1.8157634e-05f, -1.9211036e-07f, -7.6402006e-07f, 2.914595e-06f, -1.7376307e-05f, 5.2523774e-06f, -2.9393192e-05f, 2.870586e-05f, 4.5871e-05f, 3.0142528e-05f, 3.2699398e-05f, 4.581718e-05f, -6.8249265e-06f, -2.3944726e-06f, -5.6466065e-06f, -1.8584253e-05f, 5.5874702e-06f, 2.5678048e-05f, 2.3823148e-05f, 1.152682e-05f, -1.2017914e-05f, -3.6065594e-06f, -2.3784438e-05f, -8.422105e-06f, 9.474798e-06f, 9.610417e-06f, 1.9121326e-05f, 8.693065e-06f, -0.00010369491f, -8.993497e-05f, 2.7953965e-05f, 3.8547055e-06f, 0.000100481026f, 8.332102e-05f, -2.8847582e-05f, -1.035597e-05f, -3.4493469e-06f, -4.9102673e-06f, -2.1410795e-05f, -1.0287679e-05f, -1.4587553e-05f, 1.3795638e-05f, -1.9557745e-05f, -1.5568645e-05f, 9.89105e-06f, 3.237415e-06f, 2.718146e-06f, -1.4716333e-05f, -3.5226566e-07f, 4.277289e-06f, -1.75712e-05f, 1.9929062e-06f, -1.8215693e-05f, 2.374184e-06f, -2.9425615e-05f, -2.9090801e-05f, -2.312859e-05f, -3.617366e-06f, 1.9588313e-05f, -1.5769598e-05f, 1.0459702e-05f, 2.2335742e-05f, -6.4331607e-06f, -7.887277e-06f, 2.4196674e-05f, -5.0245185e-06f, 4.9727482e-06f, 2.657496e-05f, 1.6199034e-05f, 1.9763262e-05f, -2.1883154e-05f, 5.881123e-06f, -5.727747e-06f, 1.8831082e-05f, 8.355731e-06f, -1.6099855e-05f, -4.718658e-05f, -4.1145187e-05f, 4.802776e-05f, -6.834628e-05f, -1.2677063e-05f, -6.894726e-05f, 0.00010346826f, -5.3625114e-05f, -1.0028901e-05f, 1.9758122e-06f, -3.1438287e-06f, -1.4054472e-05f, 1.2805805e-05f, 2.0512942e-05f, 7.566379e-06f, -2.013629e-05f, 2.7175115e-06f, 1.5641368e-05f, -4.6501788e-07f, -6.0189363e-06f, -5.3437725e-06f, 1.3897944e-05f, 2.7357166e-06f, 1.0164091e-05f, -9.472379e-07f, -3.953635e-05f, 3.7636244e-05f, 1.060929e-06f, 3.170067e-05f, 4.5850706e-05f, -8.415953e-06f, -1.21086605e-05f, -2.8013066e-05f, -1.6686218e-06f, -1.673166e-05f, 1.2294475e-05f, 3.3111817e-07f, 1.2692418e-05f, 1.6385171e-05f, 1.3304201e-05f, 7.896803e-06f, -1.9793884e-05f, 2.139021e-05f, 4.2373936e-06f, -1.6670318e-05f, -1.7419536e-06f, 1.3116796e-05f, 1.829278e-05f, -9.131112e-05f, 6.045726e-06f, -1.6235444e-05f, -6.10797e-05f, -1.3526126e-05f, 2.5548728e-05f, 3.6334834e-05f, 8.263888e-05f, 9.7127895e-06f, -1.4752696e-05f, 7.1756485e-06f, -1.6031621e-05f, -1.7511247e-05f, 6.7889814e-06f, 1.723283e-05f, -2.0473485e-06f, -1.3194547e-05f, -1.12593825e-05f, -1.0072335e-05f, 1.4718452e-05f, 9.664251e-06f, -3.843561e-06f, -7.664211e-06f, -2.2126107e-05f, -4.859559e-05f, 2.0383059e-05f, 5.2448908e-05f, 3.4997058e-05f, -4.447858e-06f, 2.9684961e-05f, -4.1972668e-05f, -1.9364315e-05f, 1.1020582e-05f, 2.6683228e-05f, -2.5181308e-07f, 5.391104e-06f, -1.1166807e-06f, 2.2622862e-05f, 1.9054603e-05f, -3.1929387e-06f, -9.2490245e-06f, -2.3179418e-05f, 1.6629547e-05f, -1.3064027e-05f, 3.731754e-07f, -8.710403e-06f, 6.3489715e-06f, 3.6211932e-06f, -6.715078e-05f, 4.709414e-06f, 3.3964974e-05f, 7.027742e-05f, -2.4166968e-05f, 7.548275e-05f, 2.6558779e-05f, 5.159632e-05f, -7.785482e-06f, 2.245058e-05f, 8.71581e-06f, 3.5427086e-06f, -2.1229684e-05f, 1.5087245e-05f, -1.5911719e-05f, -1.2799593e-05f, 5.635126e-06f, 1.2890296e-05f, 2.2313334e-05f, 8.680662e-06f, -1.8047884e-05f, 1.870022e-05f, 1.3972852e-05f, -9.552127e-06f, -4.7694408e-05f, -3.940791e-05f, 4.6029454e-05f, 4.2545948e-05f, 1.2141157e-06f, -6.2577283e-06f, 1.141772e-06f, 5.0539402e-05f, -7.4639856e-06f, 9.079862e-06f, -5.5895443e-06f, -1.8320943e-05f, -2.6556631e-06f, 2.7775754e-05f, -5.116942e-06f, 5.2296417e-07f, -2.0854262e-05f, 5.969925e-06f, -5.9228546e-06f, -2.220301e-05f, 1.9115243e-05f, -1.227555e-05f, -1.5634618e-05f, 8.6338e-06f, 1.0884534e-06f, -7.9188496e-05f, 7.725561e-05f, 2.6465216e-06f, 8.4332314e-05f, -5.4979184e-05f, 9.627633e-05f, -6.347e-05f, 6.473266e-06f, 1.6291364e-05f, 1.2032659e-05f, -4.7530957e-06f, 7.199453e-07f, -1.7366912e-05f, 4.8798147e-06f, -1.7722932e-05f, 2.0911582e-05f, 1.7811211e-05f, 1.9400457e-05f, -4.562523e-06f, 9.78383e-06f, -7.989836e-06f, 1.3959244e-05f, 1.7869044e-05f, -2.295101e-06f, -2.4004516e-05f, -2.9409608e-05f, 3.1981843e-05f, -1.600918e-05f, -2.5946947e-05f, -4.3147196e-05f, -4.8643833e-05f, -2.871273e-05f, -1.3637103e-05f, 9.453675e-06f, -4.643874e-06f, 8.4139665e-06f, 2.0881582e-05f, 7.154997e-06f, 5.7170646e-06f, -1.4904431e-05f, 1.4227652e-05f, -1.7247678e-05f, -1.827686e-05f, -2.0776815e-05f, -1.4864171e-05f, 1.7619703e-05f, 2.8768213e-07f, 1.3814373e-05f, -8.884143e-07f, -1.3755487e-05f, -3.0621704e-05f, 3.1139734e-05f, 6.6445886e-05f, -6.5896274e-05f, 5.0232535e-05f, 6.2065455e-06f, 2.1110007e-05f, -1.2105922e-05f, 1.2297442e-05f, -2.1371654e-05f, -1.6206162e-05f, -1.8373163e-05f, 7.842459e-06f, 9.767615e-06f, 5.196644e-06f, -1.1555998e-06f, -2.0935648e-05f, -2.0018704e-05f, 7.4386403e-06f, -3.2229289e-06f, -8.106973e-06f, -2.3855466e-05f, -2.0463955e-05f, 5.7742095e-06f, 3.5849185e-05f, 6.1554224e-06f, 1.8125406e-06f, -7.0897017e-06f, -2.5616735e-05f, -7.043758e-07f, 1.8461351e-05f, -3.1536147e-05f, -1.5260712e-05f, 3.068419e-05f, 2.4446827e-06f, -2.5913465e-05f, -1.1019555e-05f, 1.1861654e-05f, 1.0209475e-05f, -2.8341525e-05f, 1.6964257e-05f, 1.7439857e-05f, -2.05861e-05f, 4.6814653e-06f, 4.496496e-06f, -2.7402886e-05f, -6.929874e-05f, -6.051264e-05f, 3.213545e-05f, 7.027304e-05f, 4.8931837e-05f, -1.4691461e-05f, 7.1518625e-05f, -3.3169301e-06f, 1.6562177e-05f, -8.665564e-06f, -2.0975032e-05f, -8.15212e-06f, -7.679372e-06f, -2.0220255e-05f, -1.7597971e-06f, 2.0406746e-05f, -1.7543112e-05f, -1.3313805e-05f, 5.884464e-06f, -1.4934621e-05f, -1.7434526e-05f, 1.5692065e-05f, -2.1267215e-05f, 3.387288e-06f, -3.3333952e-05f, 4.9062637e-05f, 3.3303386e-05f, -3.5453253e-05f, -1.38516525e-05f, 4.6440364e-06f, -3.336991e-05f, -4.088169e-06f, 1.6128424e-05f, 9.951764e-06f, -1.6402633e-07f, -1.2398559e-05f, 7.765579e-06f, 9.017285e-07f, -3.0446174e-07f, 1.4646392e-05f, 2.3461696e-06f, -2.1848673e-06f, 2.3095121e-05f, 8.50505e-06f, 6.10676e-06f, -6.168761e-06f, -2.0256153e-05f, 1.1338285e-05f, 8.456039e-06f, -8.1147875e-05f, 4.9929975e-05f, -3.1420674e-05f, -6.61573e-05f, -4.303817e-05f, 3.527976e-05f, -1.0338945e-05f, 2.1391665e-05f, -2.2804027e-06f, 3.4759555e-06f, -8.195022e-06f, 5.21743e-06f, -2.702433e-06f, 6.6987327e-06f, -6.417444e-06f, 1.5836051e-06f, -6.5332333e-06f, -1.7312983e-05f, -1.763005e-05f, 1.03284165e-05f, 3.5665607e-06f, 1.9545501e-05f, 1.8013743e-05f, -3.1133743e-05f, -1.5905513e-05f, 1.88404e-05f, 9.535838e-06f, 1.4912081e-06f, -2.6789125e-05f, -2.3222787e-05f, -1.634455e-05f, 2.2117933e-06f, -4.939923e-06f, -2.2891361e-05f, 8.6482305e-06f, -1.9283198e-06f, 2.2066783e-06f, 2.1418806e-05f, 2.2957594e-05f, 1.5965146e-05f, 5.92885e-06f, -5.467852e-06f, 5.5545624e-06f, 1.7564309e-05f, 1.2905996e-05f, 1.0418842e-05f, -4.890009e-05f, -1.9500909e-05f, 4.8990814e-06f, 7.475479e-05f, -2.0990812e-05f, -1.37204e-05f, -3.476283e-05f, -1.3503758e-05f, 4.0007258e-06f, -1.4430636e-06f, 1.6452434e-05f, -2.0880263e-05f, -1.3723493e-05f, -1.3112805e-05f, 9.165667e-06f, -9.564191e-06f, -1.3651756e-05f, 7.137631e-06f, 2.3991523e-05f, 1.4066164e-06f, 5.061041e-06f, -1.2029474e-05f, -1.122995e-05f, -1.6474836e-05f, 1.1520115e-05f, -7.958577e-06f, -3.1149983e-05f, -3.1027755e-06f, 6.653457e-06f, 3.5189983e-05f, -1.7907803e-05f, -3.2575324e-05f, -1.2306899e-05f, 1.6897535e-05f, -2.9835994e-05f, 1.6755271e-06f, -4.980293e-06f, 1.800322e-05f, -6.5504296e-06f, -2.2258071e-05f, 1.2760652e-05f, -1.1427863e-05f, -2.4089833e-05f, 2.381864e-05f, -3.9610923e-06f, 1.3360383e-05f, -2.2732913e-05f, -3.7792613e-06f, 5.3584503e-05f, -1.629493e-05f, -4.476385e-05f, 2.781446e-06f, 6.129732e-05f, -3.4077682e-05f, 7.2473566e-05f, -5.480091e-05f, -1.607831e-05f, 1.7795849e-06f, 1.5922798e-05f, -1.0848038e-05f, 1.34528e-05f, 1.655512e-05f, -1.1098199e-05f, -5.6513574e-08f, 2.3721966e-05f, -1.4663746e-05f, -1.8059577e-06f, 1.6451868e-05f, 8.679039e-06f, 1.6361402e-07f, 6.711018e-06f, -5.064539e-06f, 2.3934499e-05f, -3.9142575e-05f, -9.907957e-06f, 3.9157458e-05f, 1.8944264e-06f, -2.4104707e-05f, 4.147779e-05f, 2.3132687e-05f, 1.9650879e-05f, -1.6296179e-05f, -2.2436157e-05f, 2.573539e-05f, -1.6154207e-05f, -2.0448271e-05f, 1.2518103e-07f, -1.3986437e-05f, 1.564923e-05f, -2.012339e-05f, -1.4011397e-05f, 3.6727379e-06f, -1.1299287e-06f, -1.5330586e-05f, -1.88885e-05f, 7.6117553e-06f, 3.320165e-05f, 1.221906e-05f, 2.7349342e-05f, 8.166499e-05f, 6.025158e-05f, -1.3056811e-05f, 7.417899e-05f, 6.2882056e-05f, 1.9896384e-05f, -1.0678549e-06f, 2.505831e-06f, 2.9924056e-06f, -3.2231383e-06f, 1.1208027e-05f, -2.0908483e-05f, 9.283872e-06f, -1.0276263e-05f, -2.0502946e-05f, -1.5892561e-05f, -2.7053571e-05f, 8.792847e-06f, -6.556987e-06f, -9.1568745e-06f, -3.102313e-06f, 3.6365156e-05f, -3.535472e-05f, 6.455142e-06f, 2.6548083e-05f, 2.1022179e-05f, 2.9501834e-05f, 3.974165e-05f, -1.2886252e-06f, -2.1566608e-05f, 1.0302138e-05f, -1.77282e-05f, 4.55817e-06f, -1.2365195e-05f, 1.6160198e-05f, 2.200412e-05f, -1.9261479e-05f, -2.3864304e-06f, -9.491999e-06f, -2.1557884e-05f, 3.0364158e-06f, -1.5595497e-05f, -2.7731014e-06f, -2.5575388e-05f, -1.5197757e-05f, 5.73207e-05f, -7.222918e-05f, -4.9920145e-05f, -1.5868243e-05f, 7.4485426e-05f, -3.6317644e-05f, 1.9561947e-05f, -4.63696e-05f, 1.4719493e-06f, -4.576699e-06f, -1.5116644e-05f, -1.0581552e-05f, 1.2187278e-06f, -7.3249084e-06f, 1.9111054e-08f, -6.0808984e-06f, -2.3678424e-05f, 2.5785275e-05f, 1.8500714e-05f, 1.6523503e-05f, 6.295276e-06f, -3.3861263e-06f, 1.3165642e-05f, -1.8226758e-05f, -1.7041377e-05f, -3.936574e-05f, 3.2428125e-05f, -9.2104965e-06f, 2.9635306e-05f, -2.1642076e-05f, -1.0682132e-05f, 2.3082572e-05f, -1.1741948e-06f, 1.829333e-05f, -4.7582607e-06f, 3.4429493e-06f, -8.150863e-06f, -5.93536e-06f, -1.116659e-05f, -2.1661002e-05f, -1.5662647e-05f, 6.861429e-06f, -7.793767e-06f, 1.649295e-06f, -1.9464169e-05f, 1.5325999e-05f, -3.2017588e-06f, 1.0714761e-05f, -1.0424702e-05f, -7.114412e-05f, 4.1731593e-05f, 4.872392e-05f, -4.130825e-06f, -1.2757378e-06f, 3.2172826e-05f, 2.9570035e-06f, 4.470786e-06f, -1.8217908e-06f, 2.0396294e-05f, -6.151273e-06f, 2.1349238e-06f, 7.9904485e-06f, 2.940498e-06f, -5.064101e-06f, 2.4205712e-05f, 1.9801288e-05f, 2.2697648e-05f, 2.1015354e-05f, -1.0939643e-05f, -7.4700138e-06f, 9.88147e-07f, 6.89202e-06f, -5.1340944e-06f, -3.61976e-05f, 1.2288205e-05f, 3.2238237e-05f, 9.689637e-06f, -1.0083472e-05f, 2.1448095e-05f, 2.8087374e-05f, 1.648093e-06f, -5.266706e-06f, -1.9480472e-05f, -1.2874854e-05f, -1.6581467e-05f, 1.6067901e-05f, 1.0183544e-05f, 1.6302802e-05f, 1.06507705e-05f, 1.1901323e-05f, -1.0085626e-05f, -2.0850446e-05f, 2.4141243e-06f, 2.2043087e-05f, 7.1416366e-06f, -1.5589076e-05f, 2.8238781e-05f, -6.69635e-05f, 4.7928737e-05f, -2.8528513e-05f, 3.9908653e-05f, 3.6832076e-05f, 6.298368e-05f, -3.2165794e-05f, 2.9163991e-06f, -1.078059e-05f, -1.2753991e-05f, 1.379102e-05f, -3.00753e-06f, -1.549517e-05f, -1.6960308e-05f, 9.606657e-06f, -2.3901426e-05f, -1.8765073e-05f, -1.8961254e-06f, 2.3190876e-05f, -5.9306994e-06f, 4.7236113e-06f, 1.121709e-05f, 1.9968482e-05f, -2.4512425e-05f, -2.2425318e-05f, -2.39482e-05f, -1.9027743e-06f, 1.7355878e-05f, -3.055208e-05f, -1.7379003e-05f, -1.95847e-05f, 4.79546e-07f, 2.920072e-06f, -1.2721733e-05f, 1.3728248e-05f, -7.557534e-07f, -1.3798572e-05f, -2.0974181e-05f, -7.1612667e-06f, 2.0882973e-05f, 2.3305007e-05f, -3.3327965e-06f, 1.7554743e-05f, -8.817811e-06f, 1.2269318e-05f, 1.5076181e-05f, -2.4268167e-05f, -6.461144e-05f, -1.5116593e-05f, -1.7380366e-05f, 1.5776803e-05f, 2.8487715e-05f, -5.6823388e-05f, 2.4938661e-05f, -4.1293908e-05f, -1.9924387e-06f, 1.45115355e-05f, -1.1711068e-05f, -1.7328926e-05f, 5.7193984e-06f, 1.0287162e-05f, -2.1351077e-06f, -1.7951657e-05f, 8.105691e-06f, -8.750564e-06f, 1.91532e-06f, -7.2396215e-06f, -2.2913275e-05f, 2.4043458e-05f, 6.6710736e-06f, 2.169179e-05f, 2.8376e-06f, 1.7473847e-05f, 2.8072622e-05f, 1.7851934e-06f, 1.2951423e-05f, -1.9438665e-05f, -1.6476335e-05f, 2.559037e-05f, -1.161452e-05f, 1.4679938e-05f, -5.136402e-06f, -1.8174978e-05f, 2.3303213e-05f, 1.7239292e-06f, -1.4748668e-06f, -6.768237e-06f, -5.9826e-06f, -1.0615254e-05f, -1.5894859e-05f, 2.4897847e-06f, -9.702787e-06f, 1.9475894e-05f, -2.0772355e-05f, 7.2884372e-06f, -7.490479e-06f, -2.951658e-05f, -4.546649e-05f, 4.4796843e-06f, -6.161046e-06f, 4.1497926e-05f, -5.2958287e-05f, 1.5832164e-05f, 9.096263e-06f, -1.6844477e-05f, -1.8175779e-05f, -6.965331e-06f, -1.9497254e-05f, 5.618175e-07f, -8.828082e-06f, -1.4471713e-05f, 2.6558375e-05f, 3.0486977e-05f, 1.6368935e-05f, 1.8613391e-05f, 2.2376096e-05f, -2.5853818e-05f, 1.6887405e-05f, -8.6741165e-06f, 1.743045e-05f, -6.551689e-07f, -2.1842714e-05f, 3.6488214e-05f, -2.29502e-06f, -1.7612727e-05f, 1.042773e-05f, 8.423003e-06f, 6.2190607e-06f, 1.0092948e-05f, -1.6453838e-05f, 1.5620013e-05f, -5.948318e-06f, 4.217882e-06f, -9.108167e-06f, 8.479627e-06f, 1.6733145e-05f, 9.713643e-06f, -2.1913267e-05f, -6.86897e-07f, -1.6890985e-05f, 2.993326e-06f, 7.84524e-06f, -7.169618e-06f, -6.615686e-05f, -3.2585576e-05f, 4.6313326e-05f, -4.7242112e-05f, -1.888597e-05f, 5.1012908e-06f, 3.882226e-05f, -2.7440787e-05f, -4.614619e-06f, 6.5683303e-06f, 9.769966e-06f, 1.1632108e-05f, -3.2549333e-06f, -4.8724214e-06f, -1.774541e-05f, 7.854525e-06f, -4.0927207e-06f, 6.51279e-06f, -7.820548e-06f, -1.9734713e-05f, 1.4711679e-05f, 1.2495723e-05f, 4.921724e-06f, -6.5178706e-06f, 4.718496e-06f, -2.3866292e-05f, -6.339949e-06f, 2.0945503e-05f, 3.217956e-07f, 1.3768437e-05f, 2.0322703e-05f, 1.1280758e-05f, -1.6500999e-05f, 4.6811438e-06f, -1.3374696e-05f, -7.4816076e-06f, 6.5758195e-07f, 8.297954e-06f, 4.3459017e-06f, -8.088455e-06f, -7.328263e-06f, 6.7075466e-06f, 3.919131e-07f, -1.548026e-05f, -5.200063e-06f, 1.5218917e-05f, 1.5736488e-05f, -2.2753267e-05f, -4.919072e-06f, -1.615821e-05f, 1.9297659e-05f, -1.988151e-05f, -1.087236e-06f, 5.417841e-05f, 1.676327e-05f, 2.8155857e-05f, 1.6976324e-05f, 1.5520889e-05f, 3.1545613e-07f, 5.6228932e-06f, -1.1640979e-05f, 2.3783798e-05f, -3.3092992e-06f, -1.5755862e-05f, 1.5943331e-05f, 7.878968e-06f, -5.7347324e-06f, -8.938279e-06f, 7.1032377e-06f, 2.302431e-05f, -8.520531e-06f, -1.0062844e-05f, -1.2821433e-05f, 1.9780262e-05f, -1.8480051e-06f, 8.137096e-06f, -2.441512e-05f, -3.151409e-05f, -2.1423642e-05f, -3.550315e-05f, 1.2796917e-06f, 1.6451337e-06f, -5.1411234e-06f, 1.2376014e-05f, 5.488293e-06f, -1.4251376e-05f, -1.8577133e-05f, -9.499341e-06f, 1.9569584e-06f, 1.659764e-05f, 1.2007332e-06f, -1.941172e-05f, 9.099776e-06f, 1.5963173e-05f, -2.0654978e-05f, 7.178523e-06f, -6.4418614e-06f, -5.310581e-05f, 1.0573584e-05f, 3.575026e-05f, 5.168821e-05f, 4.6955378e-05f, -1.4242914e-05f, -1.1143057e-05f, -1.713903e-05f, 6.477461e-06f, 8.98766e-06f, 2.09123e-05f, 2.0119325e-05f, 2.2441114e-05f, -7.201608e-08f, 2.3291223e-05f, -1.7156095e-05f, -7.718536e-06f, -1.7801739e-06f, 3.0484896e-06f, 1.7486987e-05f, 1.1545832e-05f, -2.3615317e-05f, 1.1311477e-05f, -1.214197e-05f, -1.687606e-05f, 4.202719e-06f, 2.0662117e-05f, -3.3850534e-05f, -3.9681872e-06f, -1.9484347e-05f, 1.7436827e-05f, -1.7445007e-05f, 1.380944e-05f, 5.547018e-06f, -2.6931775e-06f, 1.2572184e-05f, 2.0673306e-05f, -1.8157726e-06f, -1.9664873e-07f, -5.3654626e-06f, 2.1701217e-05f, 1.7103459e-05f, 2.4806677e-06f, 9.1856755e-06f, 1.0900411e-05f, 4.0780824e-06f, -1.6354257e-05f, -1.0136052e-05f, -2.1428219e-05f, -4.861564e-05f, 6.457502e-05f, 3.514069e-05f, -4.3560676e-06f, 7.299501e-06f, -5.2428386e-05f, 1.7354761e-05f, -2.2506689e-05f, 9.306205e-06f, -3.0767507e-05f, 1.4268037e-05f, -1.1779165e-05f, -1.3046759e-05f, -1.1301792e-05f, -3.8385897e-06f, -2.0068357e-05f, 2.564418e-05f, -2.960846e-05f, 9.932647e-06f, -2.9372872e-05f, -3.3917913e-05f, -3.3692115e-05f, 2.6144135e-05f, 1.1232333e-07f, 9.252114e-06f, -2.0640611e-05f, 1.3262793e-05f, -1.723507e-05f, 3.000761e-05f, -2.196641e-05f, -4.478906e-06f, 2.0671054e-05f, -2.0223184e-05f, -1.16850815e-05f, 1.9478473e-05f, 1.0732603e-06f, -1.2767103e-05f, -7.273763e-06f, 1.19473725e-05f, -1.1420453e-06f, 1.1312904e-05f, 2.0983923e-06f, 1.9792358e-06f, -1.2545476e-05f, -6.3007865e-06f, -1.8664046e-05f, 2.2069646e-05f, 3.267729e-05f, -1.2265358e-05f, 4.0921816e-05f, 5.498226e-05f, 8.527383e-06f, 5.4964872e-05f, -4.1755893e-06f, -6.184009e-06f, 2.0702908e-05f, -2.1981958e-05f, 1.4406257e-05f, 1.8508681e-05f, -1.6138012e-05f, 2.2115357e-05f, 1.751383e-05f, -1.5077482e-05f, 1.6715654e-05f, -2.869438e-05f, 4.081273e-06f, -2.2453436e-05f, -1.5624719e-05f, -8.11075e-06f, 1.235642e-05f, -1.1953258e-05f, -2.0734764e-05f, 2.265812e-05f, -1.5471001e-05f, -7.3808346e-06f, -1.0400953e-05f, 2.079773e-05f, -8.407244e-06f, -1.7536311e-05f, -1.1712036e-05f, 1.7737895e-05f, 1.3302649e-05f, 1.6810982e-05f, 4.169767e-07f, -5.052158e-06f, -8.781039e-06f, 1.2929275e-06f, 1.2964328e-05f, 5.0640774e-06f, 1.3249507e-05f, 4.412375e-06f, 4.568585e-06f, -1.550751e-05f, 1.3488966e-05f, 8.58716e-06f, 3.677236e-05f, 2.2796945e-05f, -3.326758e-05f, -3.950536e-05f, 4.9687715e-05f, -2.9709461e-05f, 1.941304e-05f, 2.0175563e-05f, 1.9965772e-05f, -2.0585667e-05f, -5.291506e-06f, 2.0159876e-05f, -2.527623e-06f, -2.2054532e-05f, 1.6268285e-05f, 2.3617275e-05f, 5.0967083e-06f, -1.3593401e-05f, 2.28545e-05f, -2.344512e-05f, -2.9857656e-06f, 1.2450055e-05f, 2.0991174e-05f, -6.340099e-06f, -3.1285384e-05f, -1.8728946e-05f, 2.745915e-07f, -3.4812856e-05f, -3.254393e-05f, -2.4139237e-05f, 1.202466e-05f, -6.7260767e-06f, -1.2783723e-06f, 4.824312e-06f, -9.824698e-07f, -7.348858e-06f, -1.80686e-05f, -8.976526e-06f, 1.49112875e-05f, 5.4982097e-06f, -1.4881962e-05f, -1.4150194e-05f, -9.515229e-06f, -1.7718874e-05f, 2.0031192e-05f, -1.25363995e-05f, 1.2733428e-05f, -2.1815871e-05f, 6.225333e-06f, -2.4565968e-05f, -1.179604e-05f, 2.0477191e-06f, -4.6506766e-06f, -4.4298584e-05f, -1.4727699e-05f, 3.1712505e-05f, -2.5132089e-05f, 7.2815606e-06f, 1.3951542e-05f, -5.087506e-06f, 5.4807633e-06f, -1.10909795e-07f, -2.9272838e-05f, 2.9002958e-05f, 4.318137e-06f, 1.0451072e-05f, -1.3837456e-05f, -1.42808e-05f, -2.7651055e-05f, 2.6086758e-05f, -1.2255597e-05f, 2.9202194e-05f, -3.4048822e-05f, 3.617902e-05f, 1.6962873e-05f, -1.9270883e-05f, -1.0519812e-05f, 2.8432965e-05f, 2.1580514e-05f, 1.74255e-05f, -8.523649e-06f, 8.907299e-06f, -7.987831e-06f, -5.545266e-06f, -1.3582138e-06f, -2.224605e-06f, 8.401349e-06f, -1.2453668e-05f, -5.2523633e-06f, 1.5196404e-05f, -3.3462936e-07f, 1.0162487e-05f, 9.371292e-06f, -1.9089648e-05f, -1.4298491e-05f, 2.913496e-05f, 2.0677038e-05f, -2.0616015e-05f, -2.7402839e-05f, 4.5733148e-05f, -1.6050055e-05f, -3.464408e-05f, 6.0692387e-06f, -3.0863936e-05f, 1.7343835e-05f, -1.3314839e-05f, 8.942997e-06f, -3.025373e-06f, -3.1106752e-05f, -3.1054322e-05f, 3.412134e-05f, -6.55736e-06f, -1.5912185e-05f, -1.7717495e-05f, -3.42585e-05f, -2.8876295e-06f, -8.265159e-07f, -4.9964974e-06f, -2.7747557e-05f, -5.046662e-06f, -2.339092e-05f, 1.4533984e-05f, -1.3810617e-06f, -2.0173644e-05f, 1.8984072e-05f, 1.6726517e-05f, -6.499248e-06f, -1.8172552e-05f, 1.1623778e-05f, -2.0129646e-05f, -1.1988121e-06f, 4.5582856e-06f, -1.1297429e-05f, 1.5727535e-05f, -2.9959306e-06f, 1.4879008e-05f, 1.3301477e-05f, -1.7791444e-05f, -1.4075457e-05f, 1.2319951e-05f, 1.3360618e-05f, 9.74216e-06f, -4.8567535e-06f, -8.362797e-06f, -4.5135806e-05f, -6.42881e-07f, 2.8943007e-06f, -3.911581e-05f, 8.779628e-06f, 5.2187723e-05f, 2.4411308e-06f, -4.166421e-06f, -1.6529313e-05f, -7.1807804e-06f, -3.719549e-05f, 1.3292267e-05f, -3.708119e-05f, -1.807433e-05f, 3.703468e-05f, 2.4114119e-05f, 1.0231722e-05f, -3.2984372e-06f, -2.0380603e-05f, 2.5892143e-05f, 2.4888973e-06f, -1.016774e-05f, -5.569796e-07f, -1.5644102e-05f, 5.8980063e-06f, -2.2962664e-05f, 5.3683625e-06f, -2.41609e-07f, 2.460979e-05f, 3.0681076e-05f, -3.6169426e-05f, 1.812163e-05f, -1.2692521e-05f, 1.4474846e-05f, -1.5011686e-05f, 9.34709e-06f, 7.95559e-06f, 1.6315696e-05f, -9.896032e-06f, 1.4738927e-05f, 1.4779181e-05f, 1.5369867e-05f, -7.955233e-06f, 1.1143446e-05f, 1.5025983e-05f, 1.2749938e-09f, -1.3787236e-05f, 2.9985074e-06f, 4.0837116e-05f, -2.0468508e-05f, 2.0441166e-05f, 1.4564029e-06f, -1.5249117e-05f, 5.114235e-05f, 1.2572385e-05f, -1.5885309e-05f, 2.5861591e-05f, 3.1038064e-05f, -3.073657e-05f, -2.1076314e-05f, -4.0630624e-05f, -1.4686809e-05f, 3.7033053e-05f, -1.8136878e-05f, 2.9988209e-05f, -1.848048e-05f, -3.704813e-05f, 1.4598778e-06f, -2.8672826e-05f, -4.4488283e-06f, 1.1448711e-05f, 1.7311075e-05f, 9.407369e-06f, 1.7435583e-05f, -1.26004725e-05f, 6.4263922e-06f, -2.8072564e-05f, 2.6932217e-05f, -2.4006578e-05f, -1.131726e-05f, 1.7365483e-05f, 1.4086964e-05f, -1.163315e-05f, 1.7249806e-05f, -1.0252733e-05f, 2.94568e-06f, 1.7241924e-05f, 1.7667919e-05f, 6.501449e-06f, -9.375113e-06f, -2.5230315e-06f, -3.2583273e-08f, 4.1270337e-06f, -5.9238205e-06f, -1.3618904e-05f, 3.4192853e-05f, -5.087581e-05f, 9.929517e-06f, -8.322295e-06f, 2.966101e-06f, -2.7492297e-05f, -9.243596e-06f, -1.3796698e-05f, -2.9978602e-05f, -1.3677775e-05f, 2.644195e-05f, -2.2474712e-06f, -1.4115667e-05f, 1.9810406e-05f, -4.5346493e-05f, 3.0664876e-05f, 2.0079547e-06f, 3.381457e-05f, 1.48741665e-05f, -8.743529e-06f, -2.8040637e-05f, -3.3068514e-05f, 2.0373003e-05f, -5.965717e-06f, -1.3363652e-05f, -1.7686114e-05f, -2.9250814e-06f, 1.3378906e-05f, 7.5244325e-06f, 2.7487673e-05f, 3.1410884e-05f, 2.4223693e-06f, 3.7746156e-06f, 3.0849753e-06f, -1.7889137e-06f, 1.42132085e-05f, -8.373393e-06f, 4.818867e-07f, 1.8781635e-05f, -1.1321497e-05f, -5.0988624e-06f, 3.1535806e-06f, 1.628662e-05f, 7.1248896e-06f, -1.40938755e-05f, 1.2916757e-05f, 4.7989506e-06f, 1.3200808e-05f, -3.9280098e-05f, 2.8209146e-05f, 3.3911823e-05f, 1.3304368e-06f, -1.8150595e-05f, -2.3979565e-05f, -1.342197e-06f, 3.5828736e-05f, 2.023063e-05f, -3.645321e-05f, 1.5476937e-05f, 2.5661218e-05f, 1.1761062e-05f, 8.099391e-06f, -1.1319493e-05f, -1.0327065e-05f, -1.2877023e-05f, -1.21814655e-05f, -2.1756976e-05f, -1.396673e-05f, -2.637323e-06f, -2.001024e-05f, -1.440384e-05f, 2.2282737e-05f, 1.671775e-05f, -1.6392134e-05f, 1.6149179e-05f, 3.201625e-05f, 1.5356394e-05f, -2.9101788e-05f, 3.3498412e-07f, -3.4975554e-05f, 1.3084852e-05f, 4.9851415e-06f, -8.627118e-07f, -3.301217e-06f, -3.961694e-06f, -3.5620956e-06f, 1.5115186e-05f, -3.7649147e-06f, -1.4468111e-06f, -5.418615e-06f, 1.2587364e-05f, -8.3368843e-07f, -3.547044e-06f, 1.6002716e-05f, -7.9063675e-06f, -4.17294e-06f, -2.2445683e-05f, -1.281505e-05f, -4.9571892e-05f, 2.4272574e-06f, 1.0293211e-05f, 4.710063e-05f, 4.3794826e-05f, 4.919407e-05f, 1.9211726e-05f, 4.4169636e-05f, 2.4917668e-05f, -1.2232639e-05f, -2.6682561e-05f, -8.136814e-08f, 1.4369438e-05f, -3.227397e-05f, 2.0953035e-05f, -1.3042279e-05f, -2.734304e-05f, 5.3416074e-06f, -1.1764142e-05f, -5.1115294e-06f, -3.44941e-05f, -8.8595325e-06f, 5.337254e-06f, -3.4039374e-05f, 2.545356e-06f, 3.2902444e-05f, 1.6411425e-06f, 2.8115948e-05f, -1.0104527e-05f, 4.983461e-06f, 1.9725644e-06f, 1.6209537e-05f, 3.2456683e-06f, -1.0244346e-05f, 1.8361812e-05f, -1.0497726e-05f, -1.3533439e-05f, -4.2743095e-06f, -1.4450987e-05f, 1.3914007e-05f, -7.1792765e-06f, 7.634612e-06f, 4.527825e-06f, 4.5639713e-06f, -1.641152e-05f, -1.613278e-05f, 5.2833357e-06f, -1.8948429e-05f, -2.6648433e-05f, -3.957521e-05f, -3.445806e-06f, -1.8111004e-05f, 2.738024e-07f, 2.7103937e-05f, 1.2152937e-05f, -2.7045164e-05f, 2.277697e-05f, -3.730024e-05f, 2.9909206e-05f, 7.451643e-06f, 2.2685838e-06f, -2.7928178e-05f, 1.7054554e-05f, -4.8786364e-06f, 1.4988537e-05f, -3.133918e-05f, 1.1525119e-05f, 7.2949283e-06f, -2.0009033e-05f, 5.214457e-06f, -1.7046375e-05f, -1.8692564e-05f, 1.8437444e-06f, 8.116494e-06f, -6.765278e-06f, -3.6484886e-05f, 2.7878586e-05f, -3.6509067e-05f, -1.1017513e-05f, -7.1245468e-06f, -1.5826916e-05f, 1.1420181e-05f, 1.543816e-05f, -1.691918e-05f, 6.348195e-06f, 3.3647075e-06f, -8.4993917e-07f, -9.773039e-07f, -1.4929961e-05f, 3.230057e-07f, -1.6162716e-05f, -6.066851e-06f, -9.622256e-06f, -1.4992473e-05f, 2.0946676e-05f, 2.181208e-05f, -2.1580445e-05f, 2.7675558e-05f, -3.234457e-05f, -2.513601e-05f, -2.1143516e-05f, 1.8896248e-05f, -2.066444e-05f, -1.4988798e-07f, -1.3794502e-05f, -1.9872175e-05f, -9.543451e-06f, 5.7114753e-06f, 2.7035772e-05f, -2.1420872e-05f, 3.1361208e-06f, 1.6622336e-05f, 2.1036e-05f, -3.6041332e-05f, -1.38565365e-05f, -3.1874548e-05f, 1.7864373e-05f, 1.014801e-05f, 3.11154e-05f, 1.2172568e-05f, 3.7591075e-05f, 1.638243e-05f, 2.5816678e-05f, 1.6921353e-05f, -8.98136e-06f, 1.2122668e-05f, -3.2932132e-06f, 5.708262e-06f, 2.3192945e-06f, 1.3026621e-05f, 1.8283277e-05f, 5.7872544e-06f, -1.3662606e-05f, 4.3702075e-06f, -3.8731123e-06f, -8.560513e-06f, 1.6397315e-05f, -3.5509406e-06f, -7.765027e-07f, 1.8595569e-05f, -1.6031752e-05f, -1.2053962e-05f, -1.4676103e-05f, -1.146461e-05f, 2.8704972e-05f, 1.6840468e-05f, -1.5803706e-05f, -1.6511172e-05f, -2.182433e-05f, -1.5969586e-05f, 2.5279398e-05f, 2.376346e-06f, -2.7865358e-06f, 1.19630795e-05f, -2.854456e-05f, -2.8742983e-05f, 3.0580446e-05f, 2.2934903e-05f, 1.6283246e-05f, -6.7294577e-06f, 2.0261321e-05f, -2.569343e-05f, -8.962687e-06f, -3.233751e-05f, -8.183494e-06f, -2.2287159e-05f, 2.9754929e-05f, -2.68789e-05f, 2.6845119e-05f, 1.1816853e-06f, 6.478199e-06f, -1.6031288e-05f, -2.1500196e-05f, 9.142476e-06f, -3.9064466e-06f, 5.754904e-06f, 4.3251252e-06f, 7.870231e-06f, -6.2478516e-06f, 1.4124624e-06f, -1.4988534e-05f, -8.9400155e-06f, 8.459166e-06f, 9.296158e-06f, -6.3469647e-06f, -1.5087854e-05f, -5.758071e-07f, -1.4104184e-05f, 8.845401e-06f, 8.382464e-06f, -1.14519735e-05f, -1.794992e-05f, 2.7188351e-05f, -1.459984e-05f, -1.01314245e-05f, 4.0288058e-05f, -2.4515764e-05f, 1.8602323e-05f, 2.0714017e-05f, 3.817958e-05f, 2.2179465e-05f, 6.4579435e-06f, 1.4952349e-05f, 1.7020651e-05f, 3.1663405e-06f, -2.637095e-05f, 2.6027905e-05f, 1.3428376e-05f, 6.7584533e-06f, -1.9223902e-05f, -2.930577e-05f, -4.577272e-06f, 4.5785555e-06f, -1.2216217e-05f, 1.2046321e-05f, -3.4933553e-05f, 1.6195578e-06f, 1.3618608e-05f, 4.655479e-06f, 1.2676364e-05f, 1.4862115e-05f, 4.909472e-06f, -1.3982754e-05f, 3.7289653e-06f, 1.0828231e-05f, -1.4498541e-05f, -4.184749e-07f, 1.1859033e-05f, 2.1123753e-06f, -1.8981376e-06f, -2.9386795e-06f, 4.8908455e-06f, -4.706938e-06f, 9.829452e-06f, -1.5190222e-06f, -1.5294163e-05f, 1.20487875e-05f, -6.8622256e-08f, 2.3212673e-05f, -6.0725074e-06f, -4.102435e-05f, 1.4111508e-06f, -5.547063e-06f, -3.865544e-05f, -7.2836756e-06f, 5.0491166e-05f, -2.8017612e-05f, -3.9938284e-05f, 4.5350625e-05f, 4.1107556e-05f, 1.726459e-05f, 2.2824712e-05f, -2.1067968e-05f, -3.7571397e-05f, 1.7388804e-05f, 3.475399e-05f, 1.9390904e-05f, -3.4278182e-05f, -3.0453471e-05f, 6.7444157e-06f, -2.6993093e-05f, 5.875936e-06f, 3.1747502e-05f, -2.703688e-05f, 9.524644e-06f, 4.0042076e-05f, -5.2634027e-06f, 2.4531657e-05f, -2.8250135e-05f, -3.32384e-06f, 2.1566766e-06f, 8.840892e-06f, -6.712312e-06f, 2.010172e-05f, -1.3210823e-05f, 2.1360856e-07f, 1.0217994e-05f, -1.0828606e-06f, -1.4860516e-05f, -5.231507e-06f, -1.2725003e-05f, -6.585451e-06f, -4.763083e-06f, -9.600206e-06f, 7.2475596e-06f, -6.3276975e-06f, -2.9014684e-05f, -2.5829422e-05f, -1.5721811e-05f, 3.615767e-06f, 4.6662033e-05f, 1.7947237e-05f, -1.01159285e-05f, 3.1943106e-05f, -4.0584266e-05f, 9.5365085e-06f, 1.6085818e-05f, 1.5104021e-05f, 1.9302981e-05f, 1.34966e-05f, -2.3988967e-05f, 1.1447062e-05f, 1.0811087e-06f, 2.5978513e-06f, 1.5176631e-06f, 8.168751e-06f, 2.3524544e-05f, 4.1001754e-06f, 1.9996216e-05f, 2.9180732e-05f, -2.2954915e-05f, -2.8671095e-05f, 9.697332e-06f, -8.084369e-06f, -1.2185415e-05f, 1.635999e-05f, 7.9452775e-06f, 2.162231e-05f, -9.315493e-06f, -5.365766e-06f, -2.046908e-06f, 7.4043905e-06f, -1.3833871e-05f, -1.3366545e-05f, -1.0514628e-05f, -1.1391681e-05f, -8.121727e-06f, -9.938014e-06f, -1.1368627e-05f, 1.0310074e-05f, -6.1062615e-06f, -2.588755e-06f, -1.1908161e-05f, 1.3758763e-05f, 3.9449264e-05f, -2.7201653e-05f, -9.324416e-06f, 1.0093089e-06f, 2.5923942e-05f, 2.2244252e-05f, -6.756329e-07f, 9.144669e-06f, -1.4985216e-05f, -1.177328e-05f, -1.48732615e-05f, -1.4554396e-05f, -1.7720515e-06f, -3.079032e-05f, -2.282902e-05f, -3.9594047e-06f, 1.8455103e-05f, -9.593571e-07f, -1.8557366e-05f, 1.9798623e-05f, 1.7504742e-06f, -1.6020273e-05f, -1.2908586e-05f, 7.5572984e-08f, -2.8706618e-05f, 7.654144e-06f, -2.3624656e-05f, -5.607263e-06f, -1.8271052e-05f, 2.0551033e-05f, 1.3516166e-06f, -3.631194e-05f, 5.882606e-06f, -6.1884766e-06f, 1.3803771e-05f, 5.0480267e-06f, 1.2321533e-05f, 5.9044264e-06f, -3.3775164e-06f, -3.0851627e-06f, 1.2248744e-05f, 1.1115992e-05f, -1.5954578e-05f, 3.2559785e-06f, -1.26508585e-05f, 7.791705e-06f, -7.0997503e-06f, 1.6561995e-06f, -4.13565e-05f, 1.2090366e-05f, -3.368994e-05f, 2.9697465e-05f, -2.3182736e-05f, 2.575416e-05f, 7.7030745e-06f, 2.6432797e-05f, -3.306227e-05f, 2.21567e-05f, 5.720853e-07f, -5.397288e-06f, -1.635417e-05f, 2.5148718e-06f, 3.5358644e-05f, -1.4240701e-05f, -1.2892505e-05f, 1.1050803e-05f, -8.329485e-06f, -7.33159e-07f, 2.3609014e-06f, 1.4185953e-05f, -1.4135764e-05f, -3.634978e-06f, 6.4108494e-06f, 6.148098e-06f, 1.6205142e-05f, 3.798865e-05f, -2.615255e-06f, -3.9258557e-05f, 3.1560707e-05f, -3.2505795e-05f, 2.4659182e-06f, 1.33951025e-05f, -1.1288487e-06f, 1.8803426e-05f, 1.7411154e-05f, 3.7894295e-06f, -1.5081015e-05f, 1.5630718e-05f, 1.992654e-06f, 1.37159805e-05f, 7.6235356e-06f, 1.51322065e-05f, 6.9180987e-06f, 1.0970109e-05f, -6.029183e-06f, -1.5294661e-05f, 1.1119688e-06f, -3.0185338e-05f, -3.6235615e-05f, -3.2717133e-05f, 3.1305077e-05f, -3.7542784e-05f, 4.3976666e-05f, 4.1722622e-05f, 1.9190378e-05f, 1.40060465e-05f, 8.731956e-06f, 9.465811e-06f, -1.5594092e-05f, -3.4819324e-05f, 8.367659e-06f, 8.628059e-06f, -1.4960467e-05f, 3.2521493e-05f, 2.937528e-06f, -2.4426963e-05f, 1.5558944e-05f, -2.5607953e-06f, 5.713392e-06f, 5.3488493e-06f, -2.4163528e-05f, -3.1261356e-05f, 3.5895962e-05f, -1.6356486e-05f, -1.1496029e-06f, -1.6637005e-05f, 3.704255e-05f, -3.4672838e-05f, 3.0866752e-06f, -2.969393e-06f, -3.1759494e-06f, -1.2970259e-05f, 3.331742e-07f, -7.7834e-06f, 1.61147e-05f, 8.440218e-06f, 9.1331995e-06f, 1.2569378e-05f, -1.3523149e-05f, -1.1512972e-05f, 1.2803358e-05f, 1.1268321e-06f, 3.7658077e-07f, 9.02494e-06f, -2.367642e-05f, 1.9845165e-05f, -4.9960276e-05f, 1.7711764e-05f, -5.997786e-06f, 4.3003216e-05f, -1.2738049e-05f, 5.1220148e-05f, -1.5523561e-05f, -3.1966435e-06f, -2.2033611e-05f, 2.5412639e-05f, 7.921059e-06f, -2.6508173e-05f, 3.2926415e-05f, -1.6569187e-05f, -1.6874743e-05f, 9.504169e-07f, -3.0984276e-05f, -2.759058e-05f, 1.5065361e-06f, -1.4083891e-05f, -2.158096e-05f, 2.5360974e-05f, 2.3865547e-05f, -3.3838973e-05f, 3.4845296e-05f, -2.2999438e-05f, 1.4354782e-05f, 2.6817268e-05f, 1.4852211e-05f, -1.4403302e-07f, -9.353807e-06f, -4.090105e-06f, -1.3628148e-05f, -1.9957213e-06f, 5.0954877e-06f, 1.75348e-05f, 1.9410172e-06f, -8.631323e-06f, -2.2998017e-06f, 5.1792845e-06f, -4.2385104e-06f, -1.3181483e-05f, 1.2386762e-05f, 1.4247812e-05f, -9.23646e-06f, -9.583953e-06f, 4.4010194e-06f, -1.1862008e-05f, 6.677493e-06f, 2.070495e-05f, 1.7428776e-05f, -2.6460653e-05f, -1.0998166e-05f, 4.2235275e-05f, -2.7349473e-05f, -2.1966514e-05f, -2.2669696e-05f, 1.9524892e-05f, -1.2787307e-05f, -7.016776e-06f, -1.8976625e-05f, -1.5046271e-06f, -1.0322217e-06f, 2.2721595e-05f, 1.0354721e-05f, -1.9477106e-06f, 1.8024592e-05f, -1.966535e-05f, -2.3528548e-05f, 2.7745056e-05f, -2.3673492e-05f, -4.203818e-05f, 1.3427602e-05f, 1.4647129e-05f, -2.5497156e-05f, -1.1049078e-05f, -2.4716086e-05f, -3.1855925e-05f, 9.012039e-06f, 1.043121e-06f, 2.007458e-05f, 4.5611014e-06f, 1.1439377e-05f, -3.306293e-06f, 1.0407645e-07f, -7.766067e-06f, -1.0280791e-05f, 1.8383143e-05f, 1.4083875e-05f, -2.0321519e-05f, 1.2315712e-05f, 4.374339e-06f, 4.809505e-06f, 1.0918485e-05f, 3.1430136e-05f, 1.3650557e-05f, -5.2302068e-05f, 1.0726732e-05f, -3.3498563e-05f, -3.7843638e-05f, -3.51535e-05f, -2.9383751e-05f, -1.3144589e-05f, -2.2803728e-05f, -1.2257153e-05f, -1.9737008e-06f, 2.9064677e-05f, -9.954681e-06f, 9.1147916e-07f, -2.5783189e-05f, -2.6844778e-05f, -6.5027066e-06f, -2.3111166e-05f, -7.074138e-06f, -1.9137258e-05f, -2.2245824e-05f, 4.30921e-06f, 2.6326961e-06f, 3.8644857e-06f, 1.8201483e-05f, 2.7704136e-05f, 7.666413e-06f, -1.8637822e-05f, -3.2326017e-05f, 3.3382436e-05f, -8.606369e-06f, -1.4401809e-05f, -1.1404507e-05f, -1.5475107e-05f, 1.0957941e-06f, -1.2382888e-05f, 1.9415862e-05f, -5.444437e-07f, 1.6600501e-05f, 3.561832e-06f, 1.952813e-05f, 2.1133837e-05f, -1.968453e-05f, 1.4917702e-05f, 2.1007081e-05f, -8.943221e-06f, -2.2150743e-05f, -2.3159422e-05f, 4.0401395e-05f, 1.8306897e-05f, 2.6411615e-05f, 3.6103906e-05f, 6.3502907e-06f, -2.0890691e-05f, 5.3618736e-05f, -6.8607283e-06f, -1.5779395e-05f, 1.4683698e-05f, 1.5936323e-05f, 2.559549e-05f, -1.7063148e-05f, 2.5749867e-05f, 1.5636755e-06f, -3.7851291e-06f, 6.913819e-06f, 1.2660331e-05f, 2.5692525e-05f, -2.5693347e-05f, 3.469086e-06f, -8.423712e-06f, 2.3834302e-05f, -2.9238969e-05f, 2.9682396e-06f, 9.130852e-06f, 5.6316226e-06f, -3.5291127e-05f, 2.5088655e-05f, 2.17529e-05f, 2.3938714e-05f, 4.7106525e-08f, -7.268517e-06f, -1.1215129e-05f, -2.232889e-06f, 2.4058118e-06f, -1.1399183e-05f, 1.7625593e-05f, 6.36594e-06f, -1.2207225e-05f, -1.1173288e-05f, -8.730841e-06f, -2.0185998e-06f, -5.3070717e-06f, -6.9922307e-06f, -1.1968367e-05f, 7.6035735e-06f, 4.637052e-06f, -4.933656e-05f, -2.0348874e-05f, 5.084401e-05f, -2.1462884e-05f, -1.4374911e-05f, -3.019195e-05f, 7.0685246e-06f, -2.4150222e-05f, 4.7351955e-07f, 1.08945715e-05f, -1.2634593e-05f, 2.2522483e-05f, 1.6777949e-05f, 1.7040426e-05f, 3.7927443e-06f, -1.9736275e-05f, 1.79507e-05f, 2.3181183e-05f, -2.4407229e-05f, -2.4559147e-05f, -5.9376525e-08f, -7.679364e-06f, 2.5178588e-05f, -3.5153967e-05f, 1.9114963e-05f, 4.55988e-05f, 3.2857537e-05f, 1.912724e-05f, 7.3209985e-06f, 9.801978e-06f, -7.120081e-08f, -1.6826705e-05f, 1.0765102e-05f, -2.1126498e-06f, -1.1546082e-05f, -7.5803077e-06f, -1.164e-05f, -1.3854577e-05f, -8.341863e-06f, -6.3861703e-06f, 1.23701e-05f, -3.541288e-06f, 1.212688e-05f, 3.2895416e-06f, -5.832371e-06f, -1.8194798e-05f, -1.7395434e-05f, -1.7020067e-05f, 4.2687774e-05f, 2.5366282e-05f, 3.293473e-05f, -2.6960117e-05f, -2.3066763e-05f, -7.4550376e-06f, -2.4119743e-05f, 2.8393993e-06f, 1.544092e-05f, 1.1727842e-05f, 7.687452e-06f, 8.652539e-06f, -3.6770692e-07f, 1.1132541e-05f, -6.47215e-06f, 2.2920527e-05f, 1.3611857e-05f, 2.2532546e-05f, -1.422686e-05f, 6.4535993e-06f, -1.505001e-05f, 9.818814e-06f, -2.3005989e-05f, 3.9058e-05f, -1.2790813e-05f, -7.832738e-06f, 1.7316497e-05f, -3.3687167e-05f, 2.9996185e-05f, 2.7289463e-05f, -3.6447782e-05f, -5.8588735e-06f, 1.0845806e-05f, -9.759266e-06f, 8.4324614e-07f, -1.6204147e-05f, -8.467622e-06f, -1.21077455e-05f, -5.2490204e-06f, -4.1572e-06f, -8.604888e-06f, 8.5402135e-06f, -1.902173e-05f, -1.1039847e-05f, -1.3888545e-06f, -2.1187761e-05f, -2.088965e-05f, 3.7237237e-06f, -2.6680615e-05f, 2.8036422e-05f, -3.949127e-05f, -2.204943e-05f, -2.9603576e-05f, -3.829141e-05f, 1.7368999e-05f, -1.8008723e-05f, 8.184976e-07f, -1.2488302e-06f, -1.640524e-05f, 4.0119253e-06f, -2.3308761e-05f, -6.020662e-06f, -1.3985478e-05f, -9.686539e-06f, -1.3371549e-05f, 2.547889e-06f, 1.7209268e-05f, -1.91476e-06f, 1.674576e-05f, -4.3409427e-06f, -7.1278887e-06f, -3.5031993e-05f, 2.4441915e-06f, -3.2061642e-05f, 3.645667e-05f, -3.56195e-05f, -4.1879734e-06f, -2.9378869e-05f, 6.1750243e-06f, -1.5512463e-06f, -1.5564736e-05f, 1.7629322e-05f, -5.4809207e-06f, 1.1434137e-05f, 1.7783078e-06f, 6.1931423e-06f, 9.0787835e-06f, 2.1149717e-06f, -1.2630982e-05f, -1.5371963e-05f, -1.5121248e-05f, 1.1372304e-05f, 2.0039379e-06f, -1.9763793e-05f, 1.612255e-05f, -1.4579221e-05f, -3.989066e-05f, -8.620287e-06f, 2.7605294e-05f, 8.223164e-06f, 1.3111839e-05f, 3.7452817e-05f, -4.2090433e-05f, -1.3580214e-05f, -9.031142e-06f, -1.4085284e-05f, 2.1476235e-06f, -1.6240852e-05f, -4.5559427e-06f, -1.346318e-05f, 1.5545093e-06f, 1.6544149e-05f, 2.2628003e-06f, 2.4697625e-05f, -2.2951726e-05f, -9.65941e-06f, -1.3940016e-05f, -2.691062e-05f, -7.477604e-06f, -3.133983e-05f, -1.0080676e-05f, -3.3741522e-05f, 2.8248585e-05f, -2.6205147e-05f, 3.0103767e-05f, -3.7413192e-05f, -1.535579e-05f, -2.4866763e-06f, 1.2005271e-05f, 1.68828e-05f, -1.4743485e-05f, 1.5246355e-05f, 1.5159824e-05f, 1.53777e-05f, -3.544252e-06f, -2.6620105e-06f, -7.2199873e-06f, 1.5622687e-05f, -1.5307976e-05f, -1.2927823e-05f, -1.6217442e-05f, -1.3883284e-05f, -1.7345325e-05f, 1.6520176e-05f, 4.166613e-05f, 3.7863676e-05f, -1.0150467e-06f, -2.5298901e-05f, -2.6252557e-05f, 5.144297e-05f, 5.861286e-05f, 1.0926472e-05f, 8.955871e-06f, 3.7171799e-06f, -1.117413e-05f, 9.678975e-06f, -7.574923e-06f, 4.583985e-06f, -6.1381265e-06f, -1.361807e-05f, -1.8092127e-05f, -2.0649366e-05f, 9.6523545e-06f, 2.1821783e-05f, 1.230446e-05f, -1.04413575e-05f, -2.0194986e-05f, 9.884205e-06f, -1.2653161e-05f, -3.53909e-05f, 3.9478873e-05f, -1.1235066e-07f, -3.716949e-05f, -2.1013113e-05f, -2.0272217e-05f, -1.1667842e-05f, 1.0920301e-06f, -1.4232366e-05f, -6.0564685e-06f, 8.833291e-06f, -1.6417054e-05f, 2.1748361e-05f, 1.0499887e-05f, -1.608911e-05f, 2.0865555e-05f, -1.5685919e-05f, -5.315109e-07f, 2.6194743e-06f, 2.353788e-05f, -1.8312086e-05f, -1.31746865e-05f, 4.145368e-06f, 4.100643e-05f, -6.2030367e-06f, 1.8865447e-05f, 3.99414e-05f, 4.846756e-05f, 3.368742e-05f, -3.3455748e-05f, -7.5075754e-06f, -1.9692701e-05f, -6.859527e-06f, 2.2429824e-05f, -3.6733752e-06f, -9.714945e-06f, 2.097538e-07f, 1.2759678e-05f, -1.8765546e-05f, -1.657399e-05f, 2.0473766e-05f, 1.8181485e-05f, 1.43964435e-05f, 1.8642598e-06f, -2.394552e-05f, -1.0099322e-05f, -8.784954e-06f, 1.4209701e-06f, 6.7361348e-06f, 3.300926e-05f, -2.900773e-05f, 2.8044398e-05f, 2.8695602e-05f, -1.4701022e-05f, 4.241312e-06f, -1.9821648e-05f, 1.2531063e-05f, -1.7703644e-05f, 3.965051e-06f, 1.5522834e-05f, -5.593126e-07f, -1.0667253e-05f, -1.982187e-05f, 8.368573e-06f, 3.9590777e-06f, -5.8882315e-06f, 1.5323558e-05f, 2.3204451e-05f, -1.0913828e-05f, -2.4308933e-06f, 3.3996832e-05f, -3.7391217e-06f, -1.3839776e-05f, 3.3063145e-05f, -3.550144e-05f, 4.5181963e-07f, 1.4157744e-05f, -1.3786235e-05f, -5.0500225e-06f, 4.8731063e-06f, 1.2933786e-05f, -9.235806e-06f, 5.2483083e-06f, 7.175277e-06f, 2.197028e-05f, -1.4405828e-05f, 1.9174944e-05f, 1.4394624e-06f, 2.8588304e-06f, -5.6722715e-06f, -1.5951815e-05f, -1.8687242e-05f, 1.7661487e-05f, -2.1160025e-05f, -2.7045668e-05f, -1.1152013e-06f, -1.1407485e-05f, 4.0813557e-05f, -4.5387602e-05f, -1.5026227e-05f, -1.0490683e-06f, 2.0353102e-05f, 4.551089e-06f, 5.3525864e-06f, 1.4859071e-05f, 1.8729632e-05f, -1.5555772e-05f, 6.206913e-06f, -1.2745034e-05f, -1.0955304e-05f, -1.2679284e-05f, 1.3587555e-05f, 1.7054166e-05f, -1.27352505e-05f, -2.205393e-05f, 1.7753748e-05f, -3.0112883e-06f, -1.483637e-05f, -6.036743e-05f, -6.037629e-05f, 1.8285093e-05f, 1.4055492e-05f, 3.1893323e-05f, -1.819376e-05f, 1.7919203e-05f, 3.1808635e-05f, 9.910752e-06f, 1.0510904e-06f, 8.98167e-06f, -8.610079e-06f, -3.9570464e-06f, -2.728507e-06f, 3.9123233e-06f, -1.26345185e-05f, 1.6761673e-07f, -6.784773e-06f, -1.2367754e-05f, -9.096218e-06f, -6.604423e-06f, -7.779592e-06f, -8.817705e-06f, -1.656419e-05f, 2.0103136e-05f, 1.1297257e-05f, 1.795006e-05f, 3.5781417e-05f, -5.9341987e-06f, 3.4986115e-05f, -3.456061e-07f, -2.5205505e-05f, -2.2055669e-05f, -1.1394277e-05f, 4.514734e-06f, 1.776789e-05f, -1.5638157e-05f, 1.9914742e-05f, -7.728099e-06f, 9.657655e-08f, 6.326789e-06f, -1.579095e-05f, 1.29821365e-05f, -2.3821688e-06f, 4.7928766e-06f, -1.5046538e-06f, -1.796999e-06f, -1.9376555e-05f, -5.142483e-05f, 4.3195003e-05f, 1.9057118e-06f, -4.8929094e-05f, 5.2260133e-05f, 5.295867e-05f, 5.8787704e-05f, -3.4237255e-06f, -6.538095e-07f, -3.293147e-06f, -1.2748557e-05f, 1.6016358e-05f, 2.1960685e-05f, 8.260811e-06f, -1.35731425e-05f, 1.6621969e-05f, 4.347019e-06f, 2.3341148e-05f, 1.2359565e-05f, 9.322375e-06f, -9.730135e-06f, 1.2642156e-05f, -2.0346894e-05f, -1.5824959e-05f, -3.2603202e-05f, 3.5108462e-07f, -1.5650765e-05f, 9.332159e-06f, 2.7132974e-05f, -3.1158073e-05f, -1.5290056e-05f, -3.821689e-05f, 1.5251458e-05f, -1.8539487e-05f, 1.902087e-05f, 1.6071732e-05f, -4.8015218e-06f, -8.065394e-06f, 1.3415181e-05f, -6.669563e-06f, 2.4291056e-05f, 2.341084e-05f, 1.8620918e-05f, 1.935556e-05f, -2.2676199e-05f, -7.0127086e-08f, -9.2708015e-06f, -1.81235e-05f, -5.815273e-05f, -8.401778e-06f, 2.3076947e-05f, 4.00862e-05f, 2.2836106e-05f, -2.388993e-05f, -5.5906225e-06f, 7.952939e-06f, 1.1830594e-05f, -3.2618746e-06f, 1.3845961e-05f, 6.201047e-06f, -8.909898e-06f, -1.3459222e-05f, 1.5146218e-06f, 1.746308e-05f, 1.2663265e-06f, 4.065045e-06f, -1.5177122e-05f, -1.2595687e-05f, -8.268605e-06f, -3.5121038e-06f, -2.2918071e-05f, -1.888167e-05f, 7.5322345e-07f, 4.0643736e-06f, 3.800125e-06f, 2.7454282e-06f, -1.2976216e-05f, 3.171443e-05f, 2.2247435e-05f, -1.1329602e-05f, 6.181279e-06f, -7.5609105e-06f, 9.487736e-06f, 1.7834038e-05f, -4.7612243e-06f, -1.0520689e-05f, 1.9393632e-05f, -3.5170212e-06f, -5.935155e-07f, -1.3704392e-05f, -1.141623e-05f, -7.383294e-06f, 1.577257e-05f, -1.7901828e-05f, -1.3134967e-05f, -1.5916874e-05f, 2.893535e-07f, 4.7801786e-05f, 8.342238e-06f, -3.5041298e-06f, -3.370909e-05f, 5.6198944e-05f, 1.0416726e-06f, -1.0443298e-05f, -1.05636045e-05f, -1.9505447e-07f, -2.2781127e-05f, 2.3136527e-05f, 2.33286e-05f, -1.4029229e-05f, -3.064016e-06f, -9.7114125e-06f, -5.8754563e-06f, 3.2106486e-06f, 5.9638937e-06f, -9.144328e-06f, -1.0344517e-05f, 5.337334e-06f, -8.984214e-06f, 1.0922778e-05f, 1.6130143e-05f, 2.565398e-05f, 3.5797304e-05f, -1.0939935e-05f, -1.3561332e-05f, 5.309215e-07f, 2.145873e-05f, 3.7777995e-06f, 5.6731533e-06f, -1.1005338e-05f, 2.1728792e-05f, -1.3472922e-05f, 1.6036023e-05f, -2.0980531e-05f, -3.4477507e-06f, 2.2887618e-05f, -4.7204944e-06f, 2.1031017e-05f, 2.3902521e-05f, -7.5371768e-06f, -1.3224384e-05f, -1.1895705e-05f, 1.8230732e-05f, -1.6746644e-05f, 4.9560884e-05f, -1.9512538e-06f, 3.2762873e-05f, 2.0709556e-05f, 3.575391e-05f, 1.9193253e-06f, 6.517212e-05f, 5.8495447e-05f, -1.0196762e-05f, 1.7895882e-05f, 1.5043347e-05f, -1.2746709e-05f, 1.2554134e-05f, -9.635462e-06f, 9.494759e-06f, 1.33616095e-05f, -1.5002648e-05f, -1.7740469e-05f, -1.3637327e-05f, -4.311333e-06f, -1.1937638e-05f, 9.442164e-06f, -2.0100195e-05f, 1.72412e-05f, -4.310102e-06f, 4.492625e-05f, 5.83028e-06f, -7.961954e-06f, 3.5099256e-05f, 3.7200844e-05f, -4.1379017e-06f, 1.7923656e-05f, -2.4247482e-05f, -1.34502125e-05f, 1.0286737e-05f, 1.178937e-05f, 2.8267107e-06f, -1.7742455e-05f, -1.1756819e-06f, 4.046193e-06f, 8.586863e-06f, 7.375132e-06f, -1.339346e-06f, 1.0487076e-06f, 8.0454197e-07f, -1.03466755e-05f, -2.1135209e-05f, -2.4297315e-05f, -1.0952776e-05f, -2.6672024e-07f, 6.7745705e-06f, 1.4187299e-05f, -5.099161e-05f, 5.9749025e-05f, -4.55414e-05f, -1.2101583e-05f, 6.3422704e-06f, -1.4118474e-05f, -1.4086298e-05f, 2.4423487e-06f, 1.7567925e-06f, -1.5324326e-06f, -1.682874e-05f, -5.718878e-06f, 2.7520057e-06f, 2.5481454e-06f, -2.3823077e-07f, -9.608927e-06f, 2.6551237e-07f, 1.1016401e-05f, 7.41308e-06f, 1.6999236e-05f, 1.9690731e-05f, 9.687646e-06f, -3.6331123e-05f, 3.6619964e-05f, 4.0913865e-06f, -4.6326277e-05f, -3.459807e-05f, -3.3405836e-06f, 1.3397007e-05f, -2.1138014e-05f, 1.5591932e-05f, 1.9104154e-05f, -1.0128964e-05f, 2.402417e-05f, -1.3937992e-05f, 1.0799786e-05f, -1.6672222e-05f, 3.0122956e-06f, -1.6707583e-05f, 2.340204e-06f, -1.8706301e-05f, -1.6622273e-05f, -1.0504212e-06f, -1.9354159e-06f, -5.733388e-05f, -2.4998635e-05f, -2.7904312e-06f, 1.878928e-05f, -3.9271334e-05f, 6.159479e-05f, -9.506107e-06f, -2.1237756e-05f, 1.4397761e-05f, -1.3602988e-05f, 7.965444e-08f, 5.1974524e-07f, 1.8113642e-05f, -1.4605969e-05f, -1.2014102e-05f, -3.4720485e-06f, -5.7528787e-06f, -1.4646066e-05f, 5.612927e-07f, 1.9442645e-05f, -9.456816e-06f, -1.0423947e-05f, -1.6189142e-05f, 5.043352e-06f, 1.8805546e-05f, -2.2436832e-07f, 4.5143657e-05f, -4.1951702e-05f, -1.4100867e-05f, 3.6858964e-05f, -8.999192e-06f, 3.3800123e-05f, 1.657464e-05f, 2.0449235e-05f, 6.1923665e-06f, -1.7668616e-06f, 6.505148e-06f, -4.3187138e-06f, -7.720593e-06f, 1.2731425e-05f, -5.329949e-06f, -1.7043687e-06f, 1.3461924e-05f, 2.6328837e-05f, -1.9285806e-05f, 1.678004e-05f, -1.0216503e-05f, -1.0152023e-05f, -4.587931e-05f, -4.6295976e-05f, 6.177957e-05f, -3.931333e-05f, 3.2377127e-05f, 5.2373056e-05f, -3.6054848e-07f, 4.1487587e-05f, -2.7073477e-06f, 1.0232339e-05f, 4.9299274e-06f, -1.2656626e-05f, 5.4615357e-06f, -7.5039247e-06f, 9.248012e-06f, 1.5597729e-05f, 1.5878772e-05f, -8.980317e-06f, -9.1185175e-06f, -1.0651156e-05f, -5.298402e-07f, 1.2670237e-05f, 7.320432e-06f, -1.327592e-05f, -4.0524865e-05f, -2.2054493e-05f, -1.0167448e-05f, -3.365597e-05f, 5.89482e-06f, -1.5594711e-05f, -3.1047824e-05f, 5.3849744e-06f, -2.3956076e-05f, -1.30806775e-05f, -1.6000535e-05f, -8.822422e-06f, 2.8682978e-05f, 6.246032e-07f, 9.930278e-06f, 2.2753813e-05f, -5.03584e-06f, -2.2119391e-05f, -1.121427e-05f, -1.158399e-05f, -1.387118e-05f, 2.4532252e-05f, -1.0397919e-05f, -7.920716e-06f, -2.476754e-06f, -6.3361476e-05f, 6.968304e-06f, -1.9375831e-05f, -2.7483851e-05f, -1.8569386e-05f, -8.475607e-06f, 2.6432568e-05f, 4.8357824e-06f, -6.664234e-06f, 8.237885e-06f, -9.6203785e-06f, 1.751513e-05f, -1.434586e-06f, 9.367616e-07f, 2.2436527e-05f, -8.695182e-06f, -5.314598e-06f, 4.297249e-06f, 5.31691e-06f, -4.6655127e-06f, 4.2356614e-06f, 1.769767e-05f, -4.1017665e-06f, 4.955994e-05f, 5.037523e-05f, 5.553695e-06f, 1.3602913e-05f, -1.4170866e-05f, 1.6147613e-05f, -4.2939766e-05f, -2.3242206e-05f, -5.9652734e-06f, 8.3516525e-06f, -9.726183e-06f, -1.534789e-05f, 1.0799689e-06f, -1.5198456e-05f, -8.390424e-06f, 2.235867e-06f, 2.3059996e-05f, 1.25921615e-05f, -1.8308221e-05f, -9.285165e-06f, 1.7454016e-05f, -1.5413329e-05f, 2.2763566e-05f, -3.2861499e-06f, -2.6694137e-05f, -6.965139e-05f, -2.0013174e-05f, -4.373184e-05f, 6.861139e-05f, 4.2318392e-05f, 6.925092e-05f, 5.1479815e-06f, -1.749911e-05f, 1.4933115e-05f, 2.2354983e-05f, 8.35647e-06f, -1.50893e-05f, -1.3232864e-05f, -2.3965856e-06f, 1.8667191e-05f, -3.5167209e-06f, 6.663073e-06f, 1.5391852e-05f, -1.528408e-05f, -1.7238655e-05f, -9.119525e-07f, -2.1820475e-05f, -5.359113e-07f, -2.340453e-05f, 5.90595e-06f, -7.492689e-06f, 3.9652186e-05f, 4.020678e-05f, 2.4912253e-05f, 7.738626e-07f, 4.091002e-05f, -2.5590278e-05f, -3.0017907e-05f, 7.805146e-06f, 6.0108755e-06f, 3.0746472e-05f, 1.9845827e-05f, 5.105806e-06f, 2.198726e-05f, 1.27042695e-05f, 4.816048e-06f, 2.4829313e-05f, -2.0512989e-05f, 2.158936e-06f, -1.3851365e-05f, 1.7987002e-05f, 1.3893956e-05f, 6.0462862e-05f, -1.1458976e-05f, 7.099114e-05f, 1.9993391e-05f, 2.9780991e-05f, -1.615963e-05f, -1.4002794e-05f, 2.5361904e-05f, -2.2520662e-05f, 1.6603589e-06f, -1.8652669e-05f, 1.0749663e-05f, 1.24464e-07f, -1.0529334e-05f, -1.1779236e-05f, 2.2364625e-06f, -1.1898249e-05f, 1.18722155e-05f, -1.7145094e-05f, -1.6999599e-06f, -1.2876613e-05f, -1.094256e-05f, -7.2808334e-06f, -1.807055e-05f, 7.696895e-08f, 4.0853804e-05f, 3.853866e-05f, 3.456058e-05f, -3.4806173e-05f, 7.5687826e-06f, -4.412043e-06f, 9.2555165e-06f, 2.3386587e-05f, 1.7342782e-05f, 2.9271225e-05f, 2.65939e-05f, 1.0100595e-05f, -2.0830369e-06f, -2.2893799e-05f, -8.930185e-06f, 5.3293564e-07f, -1.3761815e-05f, -2.6767545e-06f, 6.2348217e-06f, -2.694029e-05f, 2.4437068e-05f, -2.1600432e-05f, 1.5161888e-05f, 1.2661894e-05f, 2.0693671e-05f, 7.546541e-07f, 1.3286485e-05f, -5.126931e-05f, -3.315261e-05f, 3.5259352e-05f, -5.837921e-05f, -7.235396e-06f, -9.715381e-06f, 5.9896576e-07f, -2.031749e-05f, 8.8948485e-07f, 5.2615214e-06f, 2.2765755e-06f, -2.7923388e-06f, -1.7478837e-05f, -1.22603315e-05f, 5.4480774e-06f, -1.4172451e-05f, -1.6460597e-05f, 1.4870637e-05f, -5.7784428e-06f, 1.6646611e-06f, -3.0291032e-05f, 3.1823653e-05f, -3.615817e-05f, -5.166585e-05f, -3.840782e-05f, 1.3951594e-05f, 3.2802465e-05f, 5.1515144e-05f, -2.0617994e-05f, -2.8320788e-05f, 2.7901235e-05f, -1.2881384e-05f, -1.6909938e-05f, 1.8779378e-05f, -2.0623082e-05f, -1.9555044e-05f, 2.424347e-06f, 1.8850967e-06f, 1.1014275e-05f, -3.1944749e-06f, 1.504806e-05f, 8.292012e-06f, 2.490178e-05f, 1.9000863e-05f, -6.8100446e-05f, -5.5198303e-05f, -4.995136e-05f, 3.6880752e-05f, -1.260751e-05f, 6.3114734e-05f, -1.6759053e-05f, -1.0520606e-05f, 1.5837999e-05f, 6.0507878e-06f, -5.472543e-06f, -3.3971887e-06f, -4.697316e-06f, 1.0555741e-06f, 9.1350685e-06f, 1.6909507e-05f, -1.4767323e-05f, 7.720203e-06f, 1.4314943e-05f, -6.68568e-06f, 1.957681e-05f, 8.62454e-06f, 1.0592096e-06f, 1.5859026e-05f, 1.0862177e-06f, -1.6069363e-05f, -5.8149965e-07f, -5.169172e-05f, 3.660011e-05f, 3.855187e-05f, -3.788607e-05f, 4.984735e-05f, -1.8359082e-05f, -3.6949116e-06f, -1.8770563e-05f, 2.7605233e-06f, 2.4826657e-05f, -1.9558349e-05f, 2.3712362e-05f, 2.2270628e-05f, -1.3436401e-05f, -6.7537812e-06f, 1.9551375e-05f, -1.6149617e-05f, 3.0382537e-06f, -1.6512845e-07f, -2.0721562e-05f, 1.37867155e-05f, 1.0458582e-05f, -6.2745356e-05f, -4.3050888e-05f, 2.2273418e-05f, -4.4580607e-05f, 1.7315839e-05f, -1.8776478e-05f, 6.567891e-05f, 1.1415694e-05f, -7.985144e-06f, 2.390051e-05f, 7.112438e-06f, 1.2404993e-05f, 1.9003583e-05f, 1.4133184e-05f, 1.1945135e-05f, 8.094954e-06f, 2.6779708e-06f, -7.715354e-06f, 1.4009592e-05f, 1.50750575e-05f, -1.8868303e-05f, 9.995285e-06f, -1.7958406e-06f, 2.6047542e-06f, 1.1711726e-05f, -1.8081358e-06f, -5.549093e-05f, -5.161446e-06f, -5.5303655e-05f, -2.5511674e-05f, 1.582685e-05f, 1.3745278e-05f, -9.012011e-06f, 3.226078e-06f, -2.1716294e-05f, 8.293591e-06f, -5.494156e-06f, 2.9279146e-05f, 8.0624395e-06f, -1.7049427e-07f, -2.5638783e-05f, 1.6674285e-05f, 2.3656645e-05f, -2.9089599e-05f, 2.4842484e-05f, -2.29264e-06f, -1.3954844e-05f, -4.444654e-05f, 1.1729346e-05f, 1.2377226e-05f, -1.5187887e-05f, -5.087692e-05f, -4.7513655e-05f, 9.752355e-06f, 3.422177e-05f, 7.540697e-06f, 2.2608985e-05f, -7.2418493e-06f, -2.6327615e-07f, 1.2188165e-05f, 7.00338e-06f, 7.500211e-06f, -6.9481503e-06f, -1.2337271e-08f, -9.3839835e-06f, -1.0992295e-05f, 1.1659146e-05f, 9.686672e-06f, 1.4192753e-05f, -1.3376579e-05f, 2.5174413e-06f, -4.555685e-08f, -4.2502263e-05f, -1.4078205e-05f, -3.09946e-05f, 8.733247e-06f, 3.900805e-05f, 1.8078666e-05f, 3.0590854e-05f, 1.3818132e-05f, -4.022744e-06f, 2.821157e-05f, -1.6172728e-05f, 5.186867e-06f, 2.6085003e-05f, 3.29211e-05f, -2.812475e-05f, -2.506359e-05f, -2.7667165e-05f, 2.878402e-05f, 2.3553626e-05f, -1.5965458e-06f, 1.1066866e-05f, 2.6690932e-05f, 1.39874255e-05f, -1.9113257e-05f, 5.3726963e-05f, 4.7828355e-05f, 8.735417e-05f, 2.0477733e-05f, -5.1209812e-05f, 3.8699804e-05f, -6.386563e-06f, 1.3189771e-05f, 4.2595816e-06f, -1.8999168e-05f, 2.8567295e-06f, -1.3881791e-05f, -2.002603e-05f, 6.3443426e-06f, -1.1739891e-05f, -9.573017e-06f, -1.8604316e-05f, -6.1535625e-06f, 5.7175284e-06f, 5.562966e-07f, 1.868685e-05f, 1.5042732e-05f, -1.1455209e-05f, 5.572521e-06f, 1.7894048e-05f, -1.6634329e-05f, 1.7522745e-05f, 4.1256724e-05f, -3.6069676e-05f, 1.6581791e-06f, 1.135165e-05f, -1.3563251e-05f, 1.9572568e-05f, -2.9348808e-05f, -5.363699e-06f, 3.8022e-05f, -9.671574e-06f, -1.3301762e-05f, 3.1279316e-05f, 1.6340173e-05f, -1.0784184e-05f, 9.366947e-06f, 2.4663217e-05f, 1.8727902e-05f, -1.2345242e-05f, -1.2313781e-05f, 9.336385e-07f, 6.4263535e-05f, 2.7012315e-05f, -5.9901304e-05f, 5.4871132e-05f, 5.836833e-05f, -7.166897e-05f, -6.339766e-05f, -4.8469712e-05f, 7.179016e-06f, -1.4409269e-05f, 1.1693488e-05f, 2.0371295e-05f, 1.0572156e-05f, 3.8765984e-06f, 1.8247558e-05f, 1.7413433e-05f, -1.0359717e-05f, 1.3232525e-05f, 2.333981e-07f, -6.7021374e-06f, 1.2263025e-05f, 8.098849e-06f, -2.2222353e-05f, -1.5533195e-05f, -2.257788e-05f, 6.534093e-05f, -3.7967162e-05f, -2.65401e-05f, -3.7757978e-05f, -2.213982e-05f, -5.110893e-06f, -1.0214403e-05f, 1.1883483e-05f, -4.089659e-05f, -4.0486398e-06f, -4.1758144e-06f, 2.454251e-05f, 2.3046923e-05f, 2.1462018e-05f, -3.5673238e-05f, -8.1306825e-06f, -5.5878522e-06f, -2.0636282e-05f, 5.974939e-06f, -2.0301797e-05f, -1.49630305e-05f, -1.2883714e-05f, 1.0406172e-05f, 1.0548368e-05f, 7.4302916e-06f, 8.238259e-05f, -1.194225e-05f, 4.4515167e-05f, -7.74599e-05f, -4.9855502e-05f, 5.6837882e-05f, 1.3633132e-05f, 1.23314785e-05f, -1.6441345e-05f, 2.0603964e-05f, 2.198064e-05f, 1.951308e-05f, -1.9031055e-05f, -9.112512e-06f, 4.2806987e-06f, 1.5530479e-05f, -7.76819e-07f, -8.936149e-06f, -1.7542125e-05f, 8.640062e-06f, 1.2623582e-05f, -7.0872984e-06f, 3.0057461e-05f, -1.911169e-05f, 2.2812816e-05f, 3.2268395e-05f, -4.8459933e-06f, 1.1334013e-05f, 3.0059382e-05f, -6.008609e-05f, -1.6272845e-05f, -7.706595e-06f, -5.8737915e-06f, 2.293267e-05f, -3.8028763e-06f, 2.8160379e-05f, -7.2211706e-06f, 2.4649678e-05f, 3.266821e-05f, 3.9637926e-06f, -1.1102263e-05f, 2.3871928e-05f, -3.3456367e-05f, -8.587578e-06f, 8.174324e-06f, -2.1367789e-05f, -1.8873592e-05f, -6.286715e-06f, -8.34135e-06f, 4.8422855e-05f, -7.612008e-05f, -1.402028e-05f, -4.8186197e-05f, -6.1222185e-05f, -2.0887694e-05f, 2.0200709e-05f, -5.5824503e-06f, -2.0241545e-05f, 2.3700504e-05f, -1.3465739e-05f, 1.838804e-05f, 1.7762193e-05f, 1.2030853e-06f, 5.114764e-06f, -7.3894366e-06f, 5.5350292e-06f, -1.6416981e-05f, -1.0104859e-05f, 1.681566e-05f, -1.6993414e-06f, 1.62e-05f, 9.651078e-06f, -3.0411353e-05f, 3.430631e-05f, -6.627538e-05f, 2.7270022e-05f, 3.3502885e-05f, 3.8997394e-05f, -9.141612e-07f, 3.4802908e-06f, -3.8326787e-05f, -2.492389e-05f, 3.1205847e-05f, -3.52256e-05f, -2.8835268e-05f, -3.5040048e-05f, 1.9822659e-05f, -1.1953951e-05f, 1.2756934e-05f, -2.1910348e-06f, 1.9356452e-05f, 6.0260063e-06f, -5.981763e-06f, 2.2755265e-05f, 6.057881e-05f, 2.5375542e-05f, -2.3246172e-05f, -6.971456e-05f, 5.012637e-05f, -7.352918e-05f, 9.353937e-05f, 3.0727075e-05f, -2.4643043e-05f, 5.982621e-06f, -1.6274878e-05f, 8.27504e-06f, 2.0496489e-06f, -3.1759365e-07f, 1.150889e-05f, 2.7026733e-06f, 3.5022924e-06f, -2.0011452e-05f, 1.0404339e-05f, 1.9758434e-05f, -7.1091213e-06f, -7.445146e-06f, -1.0068314e-05f, 1.1935093e-05f, 1.4863249e-05f, -3.709979e-05f, -1.1416112e-05f, -6.4179345e-05f, 3.5466467e-06f, 2.384653e-05f, 5.674154e-05f, -5.982633e-05f, -1.6596805e-05f, -5.4323345e-06f, 3.3179414e-05f, 1.20037475e-05f, 3.8221755e-05f, 4.7287617e-06f, 2.344756e-05f, 3.9826406e-05f, 2.5664935e-05f, -2.3696984e-05f, 1.6541362e-05f, -1.6490498e-05f, -4.9514506e-06f, -2.0341398e-05f, -1.8300056e-05f, 2.6159909e-05f, 4.4211578e-05f, 4.2613112e-05f, 7.0414266e-05f, 6.754615e-05f, -6.4123036e-05f, 6.620618e-05f, -5.3862248e-05f, -3.4323322e-05f, 4.86358e-06f, 1.4848351e-05f, 2.0821886e-05f, -2.4360184e-05f, -9.801846e-06f, -1.5262689e-05f, 9.820231e-06f, 1.8016894e-05f, -1.917998e-05f, -1.9729747e-05f, -1.1182518e-05f, 1.9447585e-05f, 7.727618e-06f, -1.4936151e-05f, -6.3226375e-06f, -1.582115e-05f, 6.686185e-05f, 5.2346306e-05f, 6.320207e-05f, 8.916145e-06f, -2.2658967e-05f, 3.643659e-05f, -7.035757e-05f, -7.182844e-05f, -2.4568333e-05f, -1.0757952e-05f, 3.0980576e-05f, -6.8493036e-06f, -2.1426833e-05f, -3.5073044e-05f, 3.881621e-05f, 2.8007613e-05f, 3.021006e-05f, -3.313473e-05f, 2.3878865e-05f, -1.707995e-05f, -3.5107355e-06f, -7.4178333e-06f, -2.4559253e-05f, 1.9482499e-05f, 4.7396872e-05f, -2.3927505e-05f, -7.0676164e-05f, -7.913125e-06f, 9.359674e-06f, 1.6799064e-05f, -1.1846294e-05f, -6.43441e-06f, 8.743231e-06f, -2.390326e-06f, 6.939134e-06f, -1.6943362e-06f, 1.096903e-05f, 1.198586e-05f, 1.5654754e-05f, -1.4523826e-05f, -9.667683e-06f, 1.5355716e-05f, -7.3122783e-06f, -1.8689252e-05f, 6.001452e-06f, -1.6857042e-05f, 1.3898386e-05f, -1.4199105e-06f, -6.0855633e-05f, 5.5426506e-05f, 1.7864851e-06f, 3.528455e-05f, -1.384526e-05f, 5.1780935e-05f, -5.845312e-05f, -4.4951074e-05f, -1.2560895e-05f, -3.019738e-05f, 2.0231915e-05f, 4.1607393e-05f, -1.9917665e-05f, 1.8285571e-05f, 1.3924937e-05f, 9.437596e-06f, 3.3467084e-05f, 2.5698528e-05f, -2.092745e-05f, 2.3774504e-05f, -2.2212815e-05f, 3.768222e-05f, -1.6802715e-05f, -1.5570784e-05f, 9.120594e-05f, -0.00010518497f, 6.544028e-05f, -8.381937e-05f, 6.323365e-05f, -2.6829875e-05f, 1.2084157e-05f, -8.045307e-05f, 7.735991e-06f, 9.785569e-06f, -8.077814e-06f, 1.0271626e-05f, -7.4452614e-06f, -1.4408987e-05f, -8.56387e-06f, 9.422495e-06f, -2.3202172e-05f, -1.8201978e-05f, 4.7740564e-06f, 4.6815876e-06f, -1.4992799e-05f, -1.9341589e-05f, -3.4836103e-07f, -1.3174776e-05f, -3.1610534e-07f, 8.289353e-05f, -2.8672037e-05f, 5.842743e-05f, 9.787194e-06f, 4.919097e-05f, -4.8419945e-05f, 2.1291467e-05f, -4.567193e-05f, 2.474233e-05f, 2.5193278e-05f, 5.303629e-05f, 1.0905466e-05f, -3.0650554e-05f, -3.6509522e-05f, 3.3120482e-06f, 4.071442e-05f, 2.7272314e-05f, 3.0320257e-09f, -2.522039e-05f, -6.0394163e-06f, 8.446845e-06f, 4.0582527e-05f, 1.6781883e-05f, -8.5459564e-05f, -1.1021331e-05f, 9.3828115e-05f, -3.310564e-05f, 1.6969268e-05f, -9.3918694e-05f, 7.742314e-05f, 8.907643e-05f, -2.0686145e-06f, 2.0927444e-05f, -9.122247e-06f, -1.0119251e-05f, 3.7964555e-06f, -8.770719e-06f, -1.7508057e-05f, -2.2765291e-06f, 1.2636845e-05f, -6.805308e-06f, 4.528172e-06f, -3.6844378e-06f, 1.734402e-05f, -6.7159226e-06f, 7.4806653e-06f, 4.6046234e-06f, 6.170895e-05f, -5.275563e-05f, -2.219417e-05f, 1.7194261e-05f, 5.280369e-05f, 2.9359931e-05f, -5.2294396e-05f, -3.4162167e-05f, -1.846838e-06f, -2.1678623e-05f, -4.267005e-05f, 3.539307e-05f, 3.7650927e-05f, -4.439303e-06f, -1.2921374e-05f, -1.7907038e-05f, -3.0970954e-05f, -3.7916307e-05f, 4.015933e-05f, 6.976811e-06f, -3.9085793e-05f, 1.3527354e-06f, -1.0865138e-05f, 1.6300068e-05f, 8.966719e-05f, 3.872462e-06f, -2.8576353e-05f, 8.46868e-05f, 6.372191e-06f, 9.592181e-05f, 2.3379882e-05f, -5.2654254e-05f, -7.634032e-06f, -3.2652797e-06f, 2.2828415e-05f, 1.3455422e-05f, -1.0490406e-05f, 1.6027905e-05f, 5.403632e-06f, 7.813483e-06f, -1.683333e-05f, 2.632657e-06f, -8.205199e-06f, -6.935477e-06f, 2.3799414e-05f, 1.4450167e-06f, -2.128849e-05f, -2.146216e-05f, 4.133194e-05f, 5.50246e-05f, 8.653109e-05f, -5.770427e-05f, -4.5104996e-05f, 4.9295788e-05f, 3.0877512e-05f, 5.463139e-05f, 2.8828254e-05f, -5.5998527e-05f, -2.6831829e-06f, -3.2316548e-05f, 4.7585618e-05f, 1.2468572e-05f, -2.2021928e-05f, 3.9855827e-06f, 2.0481146e-05f, -8.458393e-06f, -6.5641516e-06f, 2.4863484e-05f, -9.826296e-06f, 6.5645586e-06f, 1.7117312e-05f, -1.936136e-06f, 3.753028e-05f, -5.5004923e-05f, -8.882516e-05f, -8.470417e-05f, 5.3199696e-05f, 5.3487987e-05f, -5.0744504e-05f, -5.79717e-05f, -2.9651526e-05f, 1.469379e-05f, 1.6077756e-05f, 1.9826059e-05f, 2.3839702e-05f, 2.1243264e-05f, 2.679952e-06f, 1.257357e-05f, -1.3530911e-05f, -2.7920357e-06f, 6.9551384e-06f, -7.263098e-06f, 3.041822e-05f, -2.476412e-05f, -1.0872866e-05f, -2.1074673e-05f, -2.5402484e-05f, -9.83547e-06f, -0.000114118346f, 3.5964862e-05f, 2.5429124e-05f, -8.000818e-05f, 2.1819952e-07f, -8.293484e-05f, 1.9325973e-05f, -1.6285925e-05f, 4.877845e-05f, -2.2469607e-05f, 5.657361e-05f, 4.7878957e-06f, 5.9892292e-05f, 1.7726948e-05f, 4.3884123e-05f, 3.7940743e-05f, -4.953504e-05f, 6.42123e-05f, 3.3067347e-05f, 8.017638e-05f, -6.111292e-05f, 4.330134e-05f, -5.160683e-05f, 0.000114523194f, 2.6907612e-05f, -0.00011244797f, -8.803112e-05f, 2.2948288e-05f, -2.5191207e-06f, -4.85427e-05f, -1.445587e-06f, 1.7448494e-05f, 2.658271e-05f, -1.53821e-05f, 6.3931975e-06f, -7.668177e-06f, -2.0519425e-05f, 1.1634661e-05f, 1.5361979e-05f, -1.5340987e-05f, 3.993344e-06f, -2.288261e-05f, 1.5268448e-05f, -8.581876e-06f, 7.9898755e-06f, -1.9325562e-05f, -2.0932748e-05f, 0.00013009866f, -7.518447e-05f, 0.00010521077f, 0.00012285609f, 5.3519725e-05f, 2.7615171e-05f, 0.0001132365f, -1.8058776e-05f, -2.5956944e-05f, -3.9418188e-05f, -6.869207e-05f, 3.6859703e-05f, -7.058241e-05f, 4.7179878e-05f, -5.337646e-05f, -3.6243473e-05f, -8.359247e-06f, 1.9193078e-05f, -2.689379e-05f, -1.6457338e-05f, -3.2236574e-05f, -1.8637651e-05f, -7.475606e-05f, 8.4556545e-05f, 5.8452697e-05f, 2.5305128e-05f, -3.7725193e-05f, 5.586759e-05f, 3.2497304e-05f, -8.356152e-05f, -7.434002e-05f, -8.107603e-06f, 1.8231895e-05f, -1.9219173e-05f, 2.1600406e-05f, 1.6419186e-05f, 2.1464248e-06f, -4.2604797e-06f, -1.4254779e-05f, -1.5875677e-05f, 1.2526805e-05f, 3.835622e-06f, -7.427362e-06f, 6.5634968e-06f, -1.3561717e-05f, 1.4618201e-05f, -7.079938e-06f, -4.7488596e-05f, -7.311843e-05f, -2.0530168e-05f, -5.2658044e-05f, 9.940048e-05f, -9.2124064e-05f, -5.4244306e-06f, 0.00013332262f, -1.1102664e-05f, -4.1959806e-06f, -2.4551677e-05f, -9.078868e-06f, -2.0704723e-05f, -2.3512957e-05f, 1.4783117e-05f, 2.7848968e-05f, -6.727824e-05f, -3.853224e-06f, -6.648154e-05f, -1.7308714e-05f, 1.979278e-05f, -2.0672389e-05f, -5.7520425e-05f, -6.483365e-05f, 1.944377e-05f, -7.113473e-05f, 8.941207e-05f, 9.215795e-05f, -2.948226e-06f, 0.0001066527f, -1.1531051e-05f, 9.6142874e-05f, 5.280076e-06f, -1.7755791e-06f, -8.4655585e-06f, 2.3033412e-05f, -8.548075e-06f, 2.7031533e-06f, -1.6021961e-06f, 2.3109296e-05f, 1.9695344e-05f, 2.2990134e-05f, 1.5666184e-05f, 5.9518206e-06f, -4.1880435e-06f, -1.9989637e-05f, -1.6767e-05f, -1.5118618e-05f, 1.3796417e-05f, -8.870994e-05f, -2.0178877e-05f, 0.00012862893f, -8.998671e-06f, 7.12045e-05f, -0.00010760524f, -4.3073436e-05f, 5.9817077e-05f, -4.654457e-05f, 6.0760587e-05f, -7.5495e-05f, 5.816291e-06f, -2.0197513e-05f, 1.4236668e-05f, -2.3713064e-05f, 3.317196e-05f, 8.004887e-05f, -6.9152324e-05f, 7.126422e-05f, -1.9489431e-05f, 7.5446515e-05f, 1.8084816e-05f, 7.917555e-05f, 9.2196875e-05f, 1.901462e-05f, -7.3603165e-05f, 9.2033566e-05f, -3.070239e-05f, -9.908326e-05f, -7.718551e-05f, -4.685113e-05f, -2.1072923e-05f, -1.8832316e-05f, -8.052617e-06f, -2.0340032e-05f, -5.310223e-06f, -1.4204099e-05f, 7.2026423e-06f, -1.0866864e-05f, -1.794836e-05f, -4.3385003e-07f, 1.4337174e-05f, -2.2485458e-06f, 3.0151498e-06f, -2.63168e-05f, 6.8946457e-07f, -2.2861812e-05f, -1.1903241e-05f, 1.7980821e-05f, 9.3885545e-05f, 6.677945e-05f, -0.00012040428f, 2.8662796e-05f, 0.00010609274f, 7.329379e-05f, 3.0551153e-05f, -2.1642709e-05f, 2.0729982e-05f, 2.8858864e-05f, 3.478151e-05f, -2.91907e-05f, 4.628489e-05f, 2.9458472e-05f, 7.055137e-05f, -5.643391e-05f, 6.8248344e-05f, 1.829933e-05f, -2.8277673e-05f, -1.1905939e-05f, 3.0808176e-05f, -2.4064158e-05f, -2.1942651e-05f, -2.70097e-05f, 2.7056774e-05f, -2.762277e-05f, 4.863293e-05f, 8.057182e-05f, -8.185176e-05f, 9.721094e-05f, -1.1811312e-06f, -1.2369635e-05f, -7.674255e-06f, 3.18793e-06f, 1.7095996e-05f, 1.7302069e-05f, 1.40267075e-05f, 3.4919901e-06f, -1.5690026e-05f, 2.4724452e-05f, 6.6457533e-06f, -2.1369806e-05f, -6.212472e-06f, -4.9482665e-06f, -1.7791956e-05f, -6.3564303e-06f, -7.3379844e-05f, -3.434368e-05f, 2.343509e-05f, 6.5608685e-05f, -0.0001141856f, -4.0454568e-05f, 3.526605e-05f, 0.00010865546f, -2.5601934e-05f, -3.734779e-05f, 3.697257e-05f, -6.583365e-05f, -4.3280706e-05f, 5.9528422e-05f, 2.6254926e-05f, 6.108164e-07f, 7.084581e-05f, 5.7343124e-05f, 1.1366422e-05f, -6.620531e-05f, -1.4484216e-05f, 2.7222536e-06f, -6.0557435e-05f, -2.1888334e-06f, 0.00010062434f, 6.381335e-05f, -5.6804958e-05f, 7.169737e-05f, -8.584638e-05f, -1.9943964e-05f, -8.055148e-05f, 4.4420543e-05f, 1.039633e-05f, 1.5610676e-05f, -7.6694905e-06f, -5.7851526e-06f, -2.3106452e-06f, 7.416897e-06f, 2.5178886e-05f, 9.463937e-06f, -1.1575274e-05f, 2.3594166e-05f, 2.0211315e-05f, 1.2713949e-05f, 1.0209642e-05f, -9.8694345e-06f, 6.1951077e-06f, 1.1861259e-05f, -7.881809e-05f, -2.234485e-05f, -0.00013973069f, -1.366401e-05f, 5.9442682e-05f, -4.2861728e-05f, -0.00011306898f, -0.00010633456f, 7.265268e-05f, 7.499333e-05f, 6.114086e-05f, -3.0391086e-05f, 4.4333046e-05f, 1.1693732e-05f, -5.746374e-06f, -6.729507e-05f, 1.5661579e-05f, -5.0060367e-05f, 8.936776e-05f, -6.187908e-05f, 4.8922517e-05f, -2.328358e-05f, -1.9138017e-05f, 5.9994123e-05f, -9.2213624e-05f, 0.0001033321f, -6.0839324e-05f, 2.1212118e-05f, 0.00010290205f, -2.5864258e-05f, 1.552961e-05f, -5.032447e-06f, 6.3344123e-06f, 8.656845e-06f, -8.082502e-06f, 1.2090046e-06f, 2.0423573e-07f, 1.3878494e-05f, 2.3748558e-05f, -8.860859e-06f, -1.0982227e-05f, 2.3853845e-05f, 2.337441e-05f, 1.9512609e-06f, 8.460864e-06f, 1.8382529e-05f, 2.094799e-05f, 9.4982515e-06f, -3.0143134e-05f, -4.7055717e-05f, 5.5468998e-05f, 0.00013315791f, 2.646371e-05f, 0.000104428946f, -2.9182547e-05f, -0.00010945215f, 1.2243196e-05f, 1.111226e-05f, 7.136119e-05f, -3.7916627e-05f, 5.8034297e-05f, 4.9639384e-05f, -4.3340247e-06f, 4.625839e-05f, -2.9113411e-05f, -2.3699104e-05f, -1.0516236e-05f, 2.3866702e-05f, -3.2345786e-05f, 6.783188e-05f, 6.7809066e-05f, -6.0713264e-05f, 3.956592e-05f, 9.61314e-05f, -5.7092025e-06f, 6.064758e-05f, 5.69143e-05f, 7.8563346e-05f, -9.53631e-05f, 2.9083594e-05f, 1.2228963e-05f, -6.5141476e-06f, -1.4961276e-05f, 1.3750967e-05f, -2.0490263e-05f, -2.8849747e-06f, 2.199667e-05f, 2.0328156e-05f, 1.4231358e-05f, 7.382076e-06f, 6.813645e-06f, -2.3374287e-05f, 2.4730729e-05f, -1.87746e-05f, 1.4292673e-05f, 1.18252665e-05f, 0.0001205821f, -9.275689e-05f, -8.224861e-05f, -8.6656466e-05f, -5.5561275e-05f, -3.6471294e-05f, 8.2461577e-07f, 1.4046946e-05f, 5.2578052e-05f, -5.7560494e-05f, -3.14956e-05f, -5.866754e-05f, -5.4956286e-05f, -4.045428e-06f, 2.3624092e-05f, -2.022714e-06f, 1.5336902e-05f, 3.873828e-05f, 5.731969e-05f, -6.86402e-05f, -4.577021e-05f, -2.0264872e-05f, -4.7854013e-05f, 5.287127e-05f, -9.8487406e-05f, 8.837939e-05f, -9.106278e-05f, -5.5332162e-05f, -5.4057884e-05f, 7.098157e-05f, -8.294188e-05f, 7.995567e-05f, 1.4012804e-05f, 1.0219e-05f, -1.6024504e-05f, -2.1678912e-05f, -1.5218294e-05f, -6.241956e-06f, 9.0058575e-06f, -4.3870373e-06f, -5.853415e-06f, -4.13416e-06f, -1.5052761e-05f, 1.1390229e-05f, 1.46990415e-05f, -1.0096311e-06f, 2.4275689e-05f, -2.0074716e-05f, 2.846349e-05f, 9.887982e-05f, 4.669444e-05f, 3.438875e-05f, 0.00012157325f, 0.00010775961f, 7.457189e-05f, 6.02139e-06f, 3.719432e-05f, 7.039046e-05f, -4.4325847e-05f, -4.7508165e-05f, 1.609802e-05f, 3.1929932e-05f, -4.5713405e-06f, 1.9661224e-05f, -2.717666e-05f, -4.7870184e-05f, -3.7010102e-06f, -1.0390519e-06f, -6.668937e-05f, -4.4276934e-05f, 1.0256637e-05f, -2.556355e-05f, 1.9927846e-05f, 5.8786645e-05f, 7.601294e-05f, 3.3262568e-05f, 8.3160885e-05f, 3.0573297e-05f, -0.000113349044f, 1.5821935e-05f, -2.3285513e-05f, -4.611421e-06f, 6.410744e-06f, -1.938465e-05f, 2.7922265e-06f, 2.2465772e-05f, -1.0370129e-05f, 1.0254614e-05f, 1.6577738e-05f, -4.8596e-06f, 2.170895e-05f, -2.1125537e-05f, 1.4142321e-06f, -1.846972e-05f, -1.7006223e-05f, 5.0216585e-07f, 7.7759476e-05f, 8.666667e-06f, 1.2907117e-05f, -4.5979188e-05f, 4.0201052e-05f, -3.482452e-05f, 1.9214638e-05f, -8.700921e-05f, -6.102681e-05f, -4.7808724e-05f, 3.795291e-05f, 4.215827e-05f, 2.6565376e-05f, -2.09474e-06f, 6.242282e-05f, -8.905894e-06f, 3.2129643e-05f, -9.042372e-06f, -5.579902e-06f, -4.506648e-05f, 2.7463375e-05f, 2.4483134e-05f, -1.16420315e-05f, 1.0719534e-05f, 2.8124465e-05f, -3.8597045e-05f, -2.0954161e-05f, 8.0206184e-05f, -5.994262e-05f, -3.0348103e-05f, 5.1997363e-06f, 2.5327203e-05f, 3.495262e-06f, -8.502391e-06f, -1.7288094e-05f, 1.16939655e-05f, 6.781711e-06f, 2.1620799e-05f, -7.942781e-06f, -1.5993366e-05f, -1.0513481e-05f, 1.2794557e-05f, 6.058504e-06f, 8.8263605e-06f, 1.6778402e-05f, 1.1436672e-05f, 2.4392634e-07f, -4.916037e-06f, 0.00010038552f, 0.000102468795f, 4.207277e-05f, 6.8274026e-06f, 1.0690223e-05f, 8.3128805e-05f, -8.750746e-05f, -9.205043e-05f, 7.2948416e-05f, -3.848394e-05f, -6.7483656e-05f, 7.15911e-06f, 5.136821e-05f, 5.0067647e-05f, 5.476116e-06f, -1.9826264e-05f, -3.7702746e-05f, 2.7921647e-05f, 2.6878532e-05f, -1.7916333e-05f, -3.5648775e-06f, 3.8019984e-06f, 2.2454427e-05f, 9.617104e-06f, -8.819561e-05f, 0.000104921935f, -6.7435176e-06f, -0.000100608166f, -3.4739984e-05f, 3.4484103e-05f, -2.128352e-05f, 0.000120953075f, 6.8180893e-06f, -1.9343626e-05f, 2.0021216e-05f, 1.4277517e-05f, -6.3518615e-07f, 4.0470871e-07f, -4.983278e-06f, 4.7391785e-07f, -3.7153347e-06f, -7.1795266e-06f, 1.8864912e-05f, -1.0544583e-05f, 2.0567055e-05f, 1.6832959e-05f, 1.6778381e-06f, -1.2836207e-05f, -5.800832e-05f, -1.2824154e-05f, -8.355257e-06f, 8.6065746e-05f, -2.6404583e-05f, 2.7073522e-06f, 6.105572e-05f, 4.0851846e-05f, -2.5114368e-05f, -4.2677508e-05f, -4.4433753e-05f, -1.6017673e-05f, -4.0757634e-05f, 5.6647732e-05f, -2.706059e-05f, 6.195599e-05f, 2.341497e-06f, -4.672923e-05f, 1.53118e-05f, -1.50699e-05f, 2.9705367e-05f, -1.8963015e-05f, 8.241892e-06f, 2.2857118e-07f, -9.55791e-05f, 2.7333583e-05f, -1.1164293e-05f, 7.07344e-05f, -1.6982289e-05f, -3.6307197e-06f, 3.5068988e-05f, 0.00010245955f, -1.4901789e-05f, 1.2793246e-05f, 1.7639828e-05f, 9.547199e-07f, 4.2988854e-06f, 3.6995948e-06f, -5.1153584e-06f, -8.920788e-06f, -9.625149e-06f, 7.85641e-06f, 1.8930832e-05f, -2.9671558e-06f, -1.3042826e-05f, 1.0295303e-05f, -2.370496e-06f, 1.8608607e-05f, 5.405717e-06f, -4.5414617e-05f, -1.0165456e-05f, 4.5616052e-05f, 2.5370227e-06f, 5.9571415e-05f, 4.2019765e-05f, 5.9540158e-05f, 9.830693e-06f, -8.172049e-06f, 5.3950334e-05f, 4.618891e-05f, -2.4940234e-06f, -2.6879581e-05f, 3.7562484e-05f, 3.8288813e-06f, 1.151831e-05f, 3.3590393e-05f, 3.1285177e-05f, -1.32305595e-05f, 2.5731667e-06f, -1.8527075e-05f, 5.191525e-06f, -1.0920324e-05f, 8.150945e-08f, 0.0001171087f, 5.16068e-05f, 7.747813e-05f, 0.000100591715f, -4.025095e-05f, -4.3471707e-07f, 5.714152e-05f, 1.8083712e-05f, -2.7646272e-06f, -1.7961558e-05f, 7.74972e-06f, 2.2957051e-06f, 7.6100832e-06f, 6.1741057e-06f, 1.9035719e-05f, -9.744275e-06f, -1.2818741e-05f, 5.202387e-07f, 3.3632753e-06f, -1.3920848e-05f, -1.0937551e-05f, 1.7584833e-05f, 4.753979e-06f, -3.104752e-05f, -3.334938e-05f, 7.1901144e-05f, -5.0779297e-05f, -2.0411764e-05f, -1.0615418e-05f, -3.0683124e-05f, -6.0364164e-05f, 2.3416573e-07f, -3.2796175e-05f, -7.020626e-05f, -3.161302e-05f, 5.1020237e-05f, 4.332909e-05f, -3.7598842e-05f, 6.8820074e-05f, 8.131382e-06f, -3.1240237e-05f, -2.692816e-05f, 3.260121e-05f, 3.6946025e-05f, -2.021387e-05f, -1.4301879e-05f, -2.1366082e-05f, -1.7565619e-05f, 5.746547e-05f, -6.2194675e-05f, 8.4621235e-05f, 6.47856e-05f, -8.300993e-05f, -5.500403e-05f, 8.5686435e-05f, -5.447431e-06f, -8.234339e-06f, 1.6415814e-05f, -7.4264976e-06f, -2.1924105e-05f, -5.3819065e-07f, 1.6767648e-05f, 6.281482e-06f, -1.7352375e-05f, 7.4948764e-07f, 3.1487427e-06f, 1.7059736e-05f, -1.6125166e-05f, -1.11946065e-05f, 1.8224755e-05f, 5.402317e-06f, -3.9031704e-05f, 6.9996655e-05f, 1.2225811e-05f, 1.9225017e-05f, -5.5535358e-05f, -4.827559e-05f, -6.0968883e-05f, 4.6780413e-05f, -1.7541905e-05f, 3.9919196e-05f, -3.400215e-05f, 6.1924104e-05f, -3.4747543e-06f, -2.2429602e-05f, 2.9752116e-05f, 3.4266806e-05f, 3.061666e-05f, 2.6460033e-05f, -2.3735187e-05f, -3.5107318e-05f, 1.9901825e-05f, 3.0293393e-05f, 2.0101525e-06f, 2.0849304e-05f, 3.2636475e-05f, 6.763793e-05f, -3.1372685e-05f, -2.4947212e-05f, -7.801961e-05f, 3.5722496e-05f, 5.6171877e-05f, -2.5939627e-05f, 1.5608488e-05f, -3.0151898e-06f, 1.2452968e-05f, 1.2760176e-05f, 5.108086e-06f, 2.4584004e-05f, 1.7341079e-05f, -1.0239598e-05f, 1.43625175e-05f, 1.3779135e-05f, -1.4855886e-05f, -2.5383008e-07f, 5.66617e-06f, -1.5330272e-05f, -3.295312e-06f, -2.9062478e-06f, -2.9333924e-05f, 2.61939e-05f, -2.591569e-05f, -4.3203927e-05f, 3.434173e-07f, 3.6089972e-05f, 2.2569906e-05f, 5.2661668e-05f, 3.3236764e-05f, 2.9461703e-06f, -5.5509383e-05f, 1.6031774e-05f, -5.7464942e-05f, -5.2119227e-05f, -2.5452118e-05f, -2.0097454e-05f, -2.6446078e-06f, -1.5033812e-05f, 2.1803271e-05f, -3.4375767e-05f, -3.8587008e-05f, -7.0120977e-06f, 3.187051e-05f, -1.0550636e-05f, 0.00010666841f, -9.301827e-05f, 4.2143893e-05f, -0.000101094134f, 0.000107423235f, -3.3925528e-05f, 8.483999e-05f, -1.477235e-05f, -2.4606497e-05f, -2.0181391e-05f, -8.439633e-06f, -1.9029481e-05f, -7.1177524e-06f, -9.848519e-07f, 2.2570868e-05f, 2.0645562e-06f, 1.6331833e-05f, 1.0509284e-06f, 2.3381499e-05f, -1.6221287e-05f, 2.1884541e-06f, -1.6901238e-05f, -1.68527e-05f, -1.2088991e-05f, -3.6765548e-06f, 7.0256465e-05f, 7.518289e-05f, -2.5924779e-05f, -8.037681e-06f, 8.365834e-06f, -6.0673843e-05f, -5.607901e-05f, 2.428843e-05f, -2.0997527e-06f, 1.6168551e-05f, -8.025317e-06f, -2.9035377e-06f, 4.1421412e-05f, 2.6323813e-05f, 3.3253113e-05f, -3.7281512e-05f, -1.8542476e-05f, 2.6369251e-05f, 1.8575593e-05f, 1.2774948e-05f, -3.4251574e-05f, -2.9771298e-05f, -7.5828552e-06f, -2.2528084e-05f, 4.9352224e-05f, -5.8215952e-05f, -6.0858067e-05f, -3.9688028e-05f, 6.739434e-05f, -2.6222406e-05f, -4.570648e-05f, 1.572699e-05f, -1.3266657e-05f, -1.5651323e-05f, -1.0916899e-05f, 1.1987284e-05f, 1.5667087e-05f, 1.0143103e-06f, -2.2643173e-05f, 3.5979288e-06f, 2.0219313e-05f, -7.60833e-06f, -1.5273716e-05f, 1.3840894e-05f, -3.5644678e-06f, 2.4101875e-05f, 2.5063669e-06f, 3.5592384e-05f, -4.297979e-05f, -2.555987e-05f, 2.9815006e-05f, 3.0338482e-05f, 1.4556979e-05f, -3.6919224e-05f, 2.5969804e-05f, -1.8946443e-05f, 4.0447572e-05f, 2.0813495e-05f, -1.3162963e-05f, 4.8275015e-06f, -1.2182639e-05f, -5.0145856e-05f, 4.0629355e-05f, -1.9875773e-05f, 2.5585608e-05f, 2.1213931e-05f, 1.2547651e-05f, -6.6507237e-06f, -7.004872e-06f, 2.1743625e-05f, 6.6130337e-06f, 5.6546847e-05f, -6.096344e-05f, 3.9499073e-06f, -5.4305216e-05f, -6.7205256e-06f, 6.2400664e-05f, -5.955573e-05f, 5.212916e-05f, 2.7150645e-06f, -2.426647e-06f, -1.5161393e-05f, -1.512585e-05f, -2.322056e-06f, 1.6195077e-05f, 1.651836e-05f, 1.9263307e-05f, -1.7881755e-05f, 1.1903393e-05f, 1.2988491e-07f, 9.371498e-06f, 6.1445885e-06f, -2.2156346e-05f, -3.4780771e-06f, 1.165029e-05f, -5.065737e-05f, 1.9710656e-05f, -3.0588606e-05f, -5.5513225e-05f, -3.0943524e-05f, -3.835784e-06f, 2.9071272e-05f, 6.0520997e-06f, -2.0014875e-05f, 2.6100617e-05f, -2.3277837e-05f, 5.5336237e-05f, 2.7900747e-05f, 4.8588176e-05f, -2.8304586e-07f, -1.4904694e-05f, -1.980236e-05f, 2.1544573e-05f, -3.0115658e-05f, 1.3912305e-05f, -6.5993763e-06f, 2.029e-05f, 1.2412283e-06f, -2.2410472e-05f, -3.3652545e-05f, -6.5791232e-06f, -7.683202e-05f, -9.877863e-06f, 3.7153204e-05f, 7.7757395e-05f, 1.7495739e-05f, 1.6860824e-05f, -2.5011335e-05f, 1.41945e-05f, -5.2208325e-06f, 1.8800036e-05f, -1.489105e-06f, 8.179751e-07f, -4.823193e-06f, -2.0535397e-05f, -2.2862489e-05f, -5.3533545e-06f, -1.491598e-05f, -5.959667e-06f, 1.7617982e-05f, 1.067567e-06f, 1.0704985e-05f, -1.4463346e-05f, -3.1403433e-05f, 3.7733527e-05f, -2.8659957e-05f, -4.3931082e-05f, -4.8082074e-05f, 4.9540617e-05f, 3.6693757e-06f, -9.258998e-06f, -1.36385925e-05f, -8.148547e-06f, 1.2184634e-05f, 1.1410286e-05f, -2.3781498e-05f, -2.481638e-05f, -3.5420899e-06f, -2.8772713e-05f, -3.1606087e-05f, -3.6559725e-06f, -3.117155e-05f, -2.885337e-05f, -1.1304326e-05f, -2.7621858e-05f, -3.4057825e-06f, -1.0773534e-05f, -4.741664e-05f, 9.07344e-05f, 6.460309e-05f, -4.5349563e-05f, 7.4004333e-06f, 7.3618496e-05f, 2.1224409e-05f, 4.3969732e-05f, -1.7717168e-05f, -1.3503389e-05f, 1.50481765e-05f, -2.2220795e-06f, -1.1528485e-05f, 1.2393484e-05f, -1.5668498e-05f, 1.5012088e-05f, 4.5104767e-07f, -9.530814e-06f, 1.22211e-06f, -4.5476677e-06f, -1.7611832e-05f, -1.8068285e-05f, 8.505254e-06f, 1.9324993e-05f, -4.582387e-05f, 5.562223e-05f, 3.236319e-05f, 2.4706731e-05f, 5.149731e-05f, 9.962747e-06f, 2.5910597e-06f, -4.440245e-06f, 1.2777436e-05f, -1.4431587e-05f, -4.999449e-06f, 3.5619076e-05f, 1.3669819e-05f, 7.611749e-06f, -8.201343e-06f, 3.9931198e-05f, 2.392339e-05f, -2.242289e-05f, -1.5652891e-05f, 2.3760205e-05f, 9.317543e-06f, -3.639784e-06f, 1.763445e-05f, -2.4386551e-07f, 7.7121265e-05f, -5.5364602e-05f, 4.934893e-05f, 0.000102054764f, 9.788497e-06f, -6.619134e-05f, -8.4885934e-05f, 9.5294636e-05f, 1.7703867e-05f, -9.327311e-06f, 1.5025497e-06f, 4.9258542e-06f, 1.2151951e-05f, -1.1517963e-05f, 1.9199624e-05f, 7.331383e-06f, -1.5347323e-06f, -1.5306952e-05f, 5.6638155e-06f, 1.1596768e-05f, -1.2168901e-05f, -1.0399976e-05f, 8.752814e-06f, -7.4720256e-06f, 5.2109834e-05f, 1.8244564e-05f, -4.101483e-05f, -5.756927e-05f, -1.1350149e-05f, -9.363857e-06f, -5.519573e-05f, 2.9219531e-05f, -9.0847425e-07f, 2.6161813e-05f, -1.4484205e-05f, 2.6928661e-05f, -3.8252205e-05f, 3.796291e-05f, -6.595506e-06f, 4.1635238e-05f, -7.7789455e-06f, -3.0259242e-05f, 3.3849162e-06f, -9.464334e-06f, -3.1355834e-05f, -1.973749e-06f, -1.9548686e-05f, 1.2119072e-05f, -3.6048426e-05f, -8.14221e-05f, -1.0629598e-05f, 9.208589e-05f, -8.8153145e-05f, -0.000114441194f, 3.0697367e-06f, 1.8362476e-05f, -1.8025705e-05f, 1.6226295e-05f, -8.282928e-06f, 1.9716742e-06f, -2.2022787e-05f, 1.3895416e-05f, -8.49493e-06f, 1.5771362e-05f, -4.7498525e-06f, 1.01246505e-05f, 1.998433e-05f, 1.2180784e-06f, -8.93076e-06f, -4.114229e-06f, 1.0286335e-05f, -1.454852e-05f, -1.4145497e-05f, 1.827937e-05f, -2.2495575e-05f, -1.752884e-05f, -1.1222133e-06f, 3.3273835e-05f, -5.8395663e-06f, 1.8596167e-05f, -9.844825e-06f, -1.7551441e-05f, -3.0168021e-05f, 2.6872533e-06f, -1.2552489e-05f, -2.6370433e-05f, -2.6974994e-05f, -2.6567599e-05f, -3.034516e-05f, -1.3230499e-05f, -1.4235707e-05f, 9.3026944e-07f, 1.878771e-05f, -2.5749801e-05f, 2.3198163e-05f, 7.872261e-06f, 9.7406635e-05f, 6.403298e-06f, -2.8705983e-05f, 9.423856e-05f, -8.926161e-05f, -4.961793e-05f, 5.2955907e-05f, 3.3471323e-07f, 1.3228118e-05f, 1.063777e-05f, 1.5475624e-05f, -1.0228462e-05f, -1.853794e-05f, 1.2416886e-05f, 2.205522e-05f, 1.5540521e-05f, -1.6152093e-05f, -4.4303774e-06f, -5.8844344e-06f, -1.832638e-05f, -1.2455762e-05f, -1.8191282e-05f, 2.3131566e-05f, 8.004111e-06f, -3.329931e-05f, 1.8902152e-05f, -3.912669e-05f, -4.243059e-05f, 2.4103543e-05f, -4.4135788e-05f, 2.5651358e-05f, -1.6931292e-05f, 4.096357e-05f, 1.20797995e-05f, 3.095018e-05f, 2.3471953e-06f, 1.358697e-05f, -1.9175917e-05f, -1.2087147e-05f, 1.4264559e-05f, 1.6310694e-05f, -1.6684622e-05f, -3.4825066e-06f, -1.9946592e-06f, -1.2944215e-05f, 1.060035e-05f, -1.5887883e-05f, 2.132965e-05f, -3.7177273e-05f, 6.826338e-05f, -9.7075324e-05f, 0.000101410566f, 4.0937222e-05f, 5.5183606e-05f, 1.776521e-05f, 6.4364365e-05f, -2.1251995e-05f, -1.2845675e-05f, -8.533987e-07f, -5.900112e-06f, -4.584059e-06f, -1.3834264e-05f, -1.697217e-05f, 1.3609243e-05f, 4.6955397e-06f, 1.8617904e-05f, -8.307391e-06f, -8.617995e-06f, -1.5888787e-05f, 2.3362743e-06f, 2.1897265e-05f, -6.261383e-06f, -4.217228e-05f, 6.242485e-05f, 2.7545879e-05f, -1.8539213e-05f, 5.4526685e-05f, 7.808078e-06f, 5.555973e-05f, 1.7707982e-05f, -1.00043335e-05f, 2.1296079e-05f, -1.1545921e-05f, -1.3679973e-05f, -3.0945226e-05f, 3.9073726e-05f, -3.5395515e-05f, 5.38839e-06f, -2.8895476e-05f, 8.710431e-08f, -7.11554e-06f, -8.667154e-06f, 2.3377583e-05f, 9.879999e-06f, -8.599621e-06f, 6.345659e-06f, 9.219155e-05f, 2.4820423e-05f, -3.5095065e-05f, 6.403476e-05f, 9.198088e-05f, 1.6911124e-05f, -6.43826e-05f, 7.206849e-05f, -1.2081025e-05f, -1.1345754e-05f, 1.4845183e-05f, 1.4619703e-05f, 2.4929689e-06f, -5.366696e-06f, -3.814577e-06f, 1.2262547e-06f, -2.0527157e-05f, 5.1192083e-06f, -1.15080875e-05f, -2.0092059e-05f, -1.3529496e-05f, 1.4824551e-05f, 7.394907e-06f, -1.2724985e-05f, -4.6143276e-05f, 1.2166614e-05f, 4.9504644e-05f, -1.868052e-05f, 7.476925e-06f, -2.8855511e-05f, 3.2367025e-05f, -5.316458e-05f, -1.8367617e-05f, -3.8632545e-05f, -2.2230102e-05f, 2.5557043e-05f, -6.296389e-09f, 3.6154215e-05f, -2.352051e-06f, -1.2845683e-05f, -2.9437319e-05f, -4.4538606e-06f, 1.6898168e-05f, 2.0335305e-05f, -2.2759239e-05f, 2.1047174e-05f, -1.9781146e-05f, -1.6986238e-05f, 8.207984e-06f, 5.5026126e-06f, 4.2529933e-05f, -3.615934e-05f, 5.6184068e-05f, -0.00010428169f, 6.750414e-05f, -6.274988e-05f, 2.81777e-06f, -1.3532735e-05f, -9.499379e-06f, -1.0830641e-05f, 2.312898e-06f, 1.3355867e-06f, -9.064995e-06f, 1.5504655e-05f, 6.4621527e-06f, -1.6584889e-05f, 2.4140025e-05f, 5.4186157e-06f, 6.8476074e-06f, -2.2936238e-05f, 2.1466565e-05f, -3.3110891e-06f, -2.9245055e-05f, 2.6069023e-05f, 6.1591854e-05f, -3.2812255e-05f, 5.879291e-06f, 5.1048414e-07f, 4.6103978e-05f, -3.524029e-05f, 1.2352612e-05f, 2.154206e-05f, -2.1833084e-05f, 5.5544992e-06f, 1.2302828e-05f, -1.2499962e-05f, -2.4142224e-05f, 1.5024612e-05f, 1.8075936e-05f, -2.2152764e-05f, 1.5366853e-05f, 3.7596965e-06f, -7.581539e-06f, 7.121446e-07f, 2.0120884e-05f, 2.2422419e-05f, 1.0468838e-05f, -6.3039115e-05f, -7.968394e-05f, -9.0453295e-06f, -4.4988465e-05f, 6.0770806e-05f, -6.170772e-05f, -9.645436e-06f, 1.2774311e-05f, -2.0416266e-05f, 8.7731314e-07f, 1.072376e-05f, -5.7438497e-06f, -1.1893795e-05f, -1.6373451e-05f, -7.4598306e-06f, 5.813658e-06f, 2.3650466e-05f, 1.5549364e-05f, -1.5464979e-05f, -6.9789303e-06f, -6.420906e-06f, -9.745005e-07f, -1.3851019e-05f, 3.3752836e-05f, -4.4093136e-05f, -1.0203813e-06f, 2.9360666e-05f, 3.969605e-06f, -5.300305e-05f, -9.131566e-06f, 1.9617635e-05f, -3.256932e-06f, -3.274754e-05f, 1.3029648e-05f, 1.5662326e-05f, -8.002345e-06f, 5.5270893e-06f, 1.9539992e-05f, 2.6506286e-05f, 8.5352385e-06f, -1.3821671e-05f, -2.7089487e-05f, 1.7497488e-05f, 2.1190375e-05f, 2.285404e-05f, -1.657755e-05f, 1.90154e-05f, 6.587659e-05f, 8.377219e-05f, -4.6372887e-05f, -1.32097075e-05f, 8.24971e-05f, 4.3878816e-05f, -2.629634e-05f, 7.3292745e-06f, 1.25826145e-05f, -2.2465762e-05f, -1.7215274e-05f, 2.0761778e-05f, -1.052396e-05f, 1.4734893e-05f, 1.0188898e-05f, -1.871725e-05f, -2.0050373e-05f, 1.6815797e-05f, 2.4541154e-05f, -2.0404792e-05f, 1.0318852e-05f, -2.4945877e-05f, -1.7819566e-05f, 1.0748842e-05f, 3.9897015e-05f, -2.4688592e-05f, -3.168234e-05f, -5.4096297e-05f, -5.224996e-06f, -1.7245056e-05f, -3.212479e-05f, 4.040447e-05f, 2.6390805e-06f, -1.1428748e-05f, -3.1258394e-05f, -1.1508897e-05f, -4.0673285e-06f, 1.0064374e-05f, -6.2890817e-06f, -5.222886e-06f, -1.0594981e-05f, 2.3403306e-06f, -2.8661227e-05f, -4.102626e-06f, -2.6729529e-05f, -1.1097496e-05f, -1.0648e-05f, 2.8000171e-05f, -6.423718e-05f, 6.189788e-05f, 3.8266156e-05f, -3.7644684e-05f, -3.1566902e-05f, -1.9299858e-05f, 6.8305715e-05f, 3.4645294e-05f, 3.4118334e-06f, -1.8252488e-06f, 1.9347179e-05f, -1.0038244e-05f, -4.699204e-06f, 1.7884815e-05f, 4.246637e-06f, 9.93483e-06f, -1.4425641e-06f, 2.0663692e-06f, 4.6912483e-06f, -1.5712196e-05f, -1.488131e-05f, -8.157739e-06f, 1.5663456e-05f, 6.2599725e-06f, -2.9138479e-05f, -1.2766624e-05f, 2.8805818e-05f, -2.0978563e-05f, 3.7722097e-05f, 4.4521357e-08f, -2.1091117e-05f, -3.3547094e-05f, 1.4668219e-05f, -2.954266e-05f, -2.7997468e-05f, 1.07562e-05f, -1.1578426e-05f, 3.3433345e-05f, 1.367651e-05f, 2.7519243e-05f, 1.156793e-05f, -1.5258364e-05f, 2.8138827e-06f, 1.9311905e-05f, -1.0470202e-06f, 2.2297276e-05f, -9.310046e-06f, 2.6571228e-05f, 7.4118165e-05f, 2.4776604e-05f, -4.898824e-05f, -1.9415394e-05f, 5.2745014e-05f, -3.6391706e-05f, -8.869464e-05f, -5.253678e-05f, -1.3197215e-06f, -1.5500986e-05f, -1.29503305e-05f, 4.811775e-06f, 1.872934e-05f, -9.346728e-06f, -6.0043635e-06f, -1.801432e-05f, -9.014673e-06f, -1.0593788e-07f, 1.1652693e-05f, 7.7095285e-07f, -1.6044256e-05f, -1.8867844e-05f, -1.7456525e-05f, -2.3434786e-05f, -6.7687806e-06f, -1.9134219e-05f, -6.068071e-06f, -1.3229933e-05f, 4.0035404e-05f, 3.1888467e-05f, 2.4065774e-05f, 3.984931e-06f, -2.3788587e-05f, 1.902789e-07f, 2.3295124e-05f, 9.444883e-06f, 2.299681e-06f, -5.005424e-06f, -1.9380937e-05f, 3.3247225e-06f, -1.7777924e-05f, 1.3415951e-05f, 3.059906e-06f, -1.3793921e-05f, 2.0687745e-05f, -9.784822e-06f, 1.3365505e-05f, 1.3803709e-06f, 6.5645516e-05f, 8.001193e-06f, -1.2437662e-05f, -6.603011e-05f, -4.551433e-05f, -8.057848e-05f, -2.0089826e-06f, 4.139629e-05f, -8.370172e-06f, 7.2902412e-06f, -1.5956412e-05f, -1.1467431e-06f, -5.462214e-06f, 9.070689e-06f, 1.8882389e-05f, -1.697196e-05f, 1.9864056e-05f, 2.030759e-05f, 2.0562975e-05f, 2.077652e-06f, -9.0305675e-06f, 1.0954167e-05f, -1.9097663e-05f, 2.0058253e-06f, 1.3336997e-05f, 3.300673e-05f, -3.6862377e-05f, -3.9392056e-05f, -1.1276127e-05f, 3.4978155e-05f, -1.4591049e-05f, -2.6186757e-05f, -1.9963198e-05f, 1.0891516e-05f, -2.3410528e-06f, 5.4064856e-07f, 1.3275309e-05f, -1.1964764e-05f, -1.6889717e-05f, 1.0386947e-05f, -2.1378599e-05f, -1.2690756e-05f, 7.031345e-06f, -1.5047054e-05f, -1.9845364e-05f, -1.609243e-05f, 2.1220261e-05f, -1.0802063e-05f, 1.3989598e-05f, 5.725548e-05f, -7.008156e-05f, 5.6755798e-05f, 3.243533e-05f, -5.799817e-05f, 3.1143874e-05f, 5.063404e-05f, 6.192776e-06f, 4.5130473e-06f, 1.1617624e-05f, -1.0179684e-05f, -1.470552e-05f, -3.047331e-06f, 2.8287225e-06f, -1.3647047e-05f, -7.151845e-06f, 9.792337e-06f, 1.6897865e-06f, -5.3359217e-06f, 2.1066038e-05f, -5.338878e-06f, 2.1878042e-05f, 4.031443e-06f, -4.3093536e-05f, 2.4415243e-05f, 2.9435021e-05f, 2.7962062e-05f, -2.6976693e-05f, 2.6663089e-05f, 2.8621096e-05f, 4.4507087e-05f, -4.959306e-06f, -2.4581164e-05f, -1.9679737e-05f, -5.974211e-06f, 1.539237e-05f, 6.829477e-06f, 2.1576292e-05f, -8.491014e-06f, -1.135614e-05f, -1.7878117e-05f, 1.8896539e-07f, -1.16840365e-05f, 1.1439693e-05f, -1.7288634e-05f, 9.42641e-07f, 1.3799088e-05f, -4.6915116e-05f, 9.137288e-06f, 9.041089e-07f, 2.3938552e-05f, -3.269652e-05f, -2.3161925e-05f, -7.573398e-05f, -5.7500074e-05f, 6.927539e-06f, 5.6662725e-07f, 1.4303021e-05f, 2.2730583e-05f, -1.1979155e-05f, -1.0326111e-05f, 8.78937e-06f, -2.088304e-05f, -2.7139868e-06f, -1.405985e-05f, 9.0286085e-06f, -5.9259714e-06f, 1.0358454e-05f, -2.4355424e-05f, 1.9481511e-05f, -7.5719904e-06f, -1.4835987e-05f, 6.497052e-06f, 1.5846792e-05f, -1.727414e-05f, -1.473949e-05f, -4.52731e-05f, -3.051391e-05f, -2.765117e-05f, 1.4307751e-05f, -2.8705725e-05f, -1.2583321e-05f, 3.9818287e-06f, 8.7223125e-06f, -5.4434363e-06f, -2.4440415e-05f, 1.9294845e-05f, -2.6127725e-06f, -2.0451545e-05f, -8.458358e-06f, 1.8310195e-05f, 6.874208e-06f, 1.5033178e-05f, 2.2010368e-05f, -9.068363e-06f, -5.128702e-05f, 1.5708518e-05f, -6.4788273e-06f, 3.073276e-05f, -5.9981525e-05f, -4.8224218e-05f, 2.409032e-05f, -1.0767973e-05f, 1.3859658e-05f, -1.6271168e-05f, -1.5240091e-05f, -8.406098e-06f, -8.942384e-06f, -9.172785e-06f, -1.4513318e-05f, 5.4035672e-06f, -8.699975e-06f, 9.719397e-06f, 1.5131066e-05f, 1.7677552e-05f, 2.1352276e-05f, 1.9896552e-05f, -1.9616624e-05f, 2.3278166e-05f, -3.6176523e-05f, -1.7785245e-05f, 1.2674797e-05f, -2.837976e-05f, 8.785956e-06f, -3.0984025e-05f, 7.391469e-06f, 6.1427654e-06f, -6.445806e-06f, 2.047168e-06f, -1.1392238e-05f, 2.8539242e-05f, -1.7004775e-05f, 2.2030845e-05f, 1.4461972e-05f, -4.5136414e-07f, -1.1710213e-06f, 3.592431e-06f, 1.3250363e-05f, 4.0533723e-06f, -1.0435872e-05f, 5.263608e-06f, -1.2597108e-05f, -1.1327699e-05f, 3.9666214e-05f, 6.378029e-05f, -1.3221076e-05f, 3.6199483e-05f, -6.446796e-05f, -2.308667e-06f, 2.4421695e-05f, -4.7733856e-06f, -9.224756e-06f, 1.2891169e-05f, -1.2022412e-05f, -1.4498389e-05f, -1.5114664e-05f, 4.026649e-06f, -7.4324753e-06f, 6.741464e-06f, -1.5914567e-05f, -3.9266097e-06f, 7.901473e-06f, -1.8740348e-05f, 2.5858353e-06f, 4.4754333e-07f, -1.9884923e-05f, -1.1088098e-05f, -2.2322454e-05f, 3.4955642e-06f, 1.8223178e-05f, -7.305001e-06f, -1.06214175e-05f, 1.7031045e-05f, 1.8126322e-05f, 7.448829e-06f, 1.9998357e-05f, -4.1965523e-06f, -2.5579373e-05f, 4.8964735e-06f, -4.345366e-06f, 2.2689408e-05f, -1.1735465e-05f, 1.5007138e-05f, 4.0689215e-06f, -1.9666493e-05f, 6.287034e-06f, 1.6533697e-05f, 1.4741223e-05f, -1.1267411e-05f, 2.7638785e-06f, 1.6350392e-05f, -2.3211825e-05f, -3.2119955e-05f, 2.2130083e-05f, -5.045773e-05f, 4.3911758e-05f, -4.0059556e-05f, 2.4577701e-05f, -6.946237e-06f, -2.0147629e-05f, -5.0757762e-06f, -3.7668683e-06f, -6.267828e-06f, 3.0818564e-06f, -1.0907236e-06f, 2.103669e-05f, 1.6425553e-06f, -1.4659081e-05f, -1.4037517e-05f, 2.9592118e-05f, -2.0970665e-05f, 1.531788e-05f, -5.5745113e-06f, -2.7376283e-05f, -2.3009026e-05f, 1.750673e-05f, -2.550521e-05f, 6.2465806e-06f, -2.8710898e-05f, -2.4088155e-05f, 2.083943e-06f, -3.3789198e-05f, 1.9240433e-06f, 7.3278857e-06f, 1.2554759e-05f, 8.968031e-06f, -8.179183e-06f, 6.54751e-07f, 3.1781444e-06f, 1.1036124e-05f, -4.436089e-06f, -1.5595453e-05f, 1.665833e-05f, 2.7359292e-06f, -1.8249708e-05f, -9.999388e-06f, 2.532765e-05f, 9.145329e-06f, -5.262812e-06f, -2.2321135e-05f, -2.8704813e-05f, -4.945444e-06f, 7.3932926e-05f, 5.54554e-06f, -7.3615774e-05f, 5.1669518e-05f, -1.5144932e-05f, 1.1850737e-05f, 1.9798733e-06f, -2.5143622e-06f, -3.376539e-06f, -1.3155423e-05f, 7.5812936e-06f, 1.4784968e-05f, -6.1819997e-06f, -5.638218e-06f, 1.8874553e-05f, 1.0372765e-05f, 3.8292086e-07f, -1.4430392e-05f, -2.149859e-05f, -1.367122e-05f, 2.4549452e-05f, -3.6651767e-05f, 2.3518951e-05f, -1.0562718e-05f, 1.1148387e-05f, -1.2577989e-05f, -2.5080735e-05f, 1.561208e-05f, 2.1463347e-05f, 1.2742382e-05f, -1.8828048e-05f, 7.201033e-06f, 6.357707e-06f, -2.1408176e-05f, 2.218432e-05f, 1.4781031e-05f, 8.276895e-06f, -2.0746381e-07f, -7.327578e-06f, 1.5248036e-06f, 1.0256257e-05f, -2.282102e-06f, 2.1799233e-05f, 1.2374829e-05f, -8.366006e-06f, 3.915271e-05f, -2.0690468e-05f, -2.2294762e-05f, 6.464425e-06f, -4.3619584e-05f, -3.0899173e-05f, 4.9966588e-05f, -3.1767675e-05f, -3.5265625e-06f, 2.213862e-06f, 2.905836e-07f, 2.0846217e-05f, 1.5224883e-05f, 2.2695347e-05f, 2.1488275e-05f, 6.0102966e-06f, -2.1600203e-05f, 2.5967689e-05f, 1.0163719e-05f, 1.1923113e-05f, -6.465453e-06f, -3.8072544e-06f, -2.0212503e-05f, 1.953479e-05f, 4.370435e-06f, 3.2336924e-05f, 2.1644719e-05f, -2.4265988e-05f, 1.8082634e-05f, -1.6074479e-06f, -5.1873726e-06f, 3.0037078e-05f, 8.126373e-06f, -1.6030439e-05f, 7.3437855e-06f, -1.402458e-05f, -4.586338e-06f, 5.056631e-06f, 1.083154e-05f, -1.492584e-05f, 1.5248158e-05f, 1.3807114e-05f, -1.2755899e-05f, -3.1569054e-06f, -1.760301e-05f, 1.4356963e-05f, 1.5739088e-05f, 1.3980395e-05f, -3.243614e-07f, 5.068012e-05f, -5.522185e-05f, -3.2939577e-05f, -4.5248416e-06f, -6.95066e-05f, -3.8086786e-05f, -4.5920115e-05f, 1.2157497e-05f, 1.857803e-05f, 9.0701915e-06f, 2.1833283e-05f, 1.2868271e-05f, 1.112154e-05f, -2.2961995e-06f, -2.0891366e-05f, -2.3418746e-05f, 1.973874e-05f, -1.3067379e-06f, 1.905297e-05f, 1.5327456e-05f, -2.3729806e-05f, -3.0829164e-05f, -2.0533382e-05f, 5.180829e-06f, 1.1691783e-05f, 2.48748e-05f, -3.485642e-05f, -9.1591855e-06f, 8.736599e-06f, -7.352879e-06f, 3.1734933e-05f, 9.16155e-06f, -7.692807e-06f, 7.5435514e-06f, 2.0196965e-05f, -3.7395655e-06f, 1.0052776e-05f, -1.2546576e-05f, 7.758362e-06f, -2.9496405e-06f, 3.2705593e-06f, 3.552056e-06f, 2.01693e-06f, 6.678351e-06f, 5.690449e-06f, 2.1448715e-05f, -1.3872388e-07f, 2.3598266e-05f, 6.137562e-05f, 4.252345e-05f, 7.7365e-06f, -2.2544455e-05f, -7.426737e-05f, -4.3299668e-05f, 5.3941712e-05f, 3.259256e-06f, 4.690372e-06f, 8.497601e-06f, 1.9661602e-05f, -1.9396548e-05f, -1.6963048e-05f, 5.107716e-06f, -4.9779796e-06f, -2.9946565e-05f, 5.066485e-06f, -1.8784556e-05f, -2.9191096e-05f, 2.9952416e-06f, -1.4597889e-05f, 1.6786753e-05f, -9.500098e-06f, -5.577294e-06f, 1.0602613e-05f, -2.3383871e-05f, 1.8562047e-05f, 1.5609286e-05f, 1.2021931e-05f, -2.8527495e-05f, 4.869403e-06f, -2.2696945e-06f, 8.096891e-06f, -4.116799e-06f, 9.580854e-06f, 1.5234606e-05f, 4.2080856e-07f, -1.1813811e-06f, -1.1355151e-05f, 1.4658674e-06f, -4.79784e-07f, 3.2188118e-06f, -5.5745137e-08f, -1.5035528e-05f, -6.8065438e-06f, 1.9856543e-05f, 7.3249525e-06f, -1.6717522e-05f, -3.946832e-05f, -1.3887025e-05f, 6.057583e-06f, 5.315833e-05f, 2.2402823e-05f, 1.6716242e-05f, 1.8147162e-05f, -1.9817222e-05f, 1.4379889e-05f, -1.926405e-05f, 1.91328e-05f, -1.0871378e-05f, 3.224645e-06f, 1.4883284e-05f, 9.314702e-06f, -5.9874155e-06f, -8.580219e-06f, -1.068859e-05f, 1.4975263e-05f, 2.5770243e-05f, -3.238673e-05f, 7.533953e-06f, -8.301991e-06f, -2.5722535e-05f, 1.1089793e-05f, 2.4214637e-07f, -3.2150132e-05f, 2.5111252e-05f, -2.2517375e-05f, -3.453385e-05f, 1.25561055e-05f, -1.7018841e-05f, -1.4091542e-05f, -5.328229e-06f, 2.0896323e-05f, 1.4868306e-06f, 1.923717e-05f, 7.507412e-07f, -3.67826e-07f, -1.6524611e-05f, 2.3786977e-06f, -1.9642112e-05f, 1.1184566e-05f, 1.8932575e-06f, 1.0516574e-05f, 8.702108e-06f, 1.5326565e-06f, 3.780749e-05f, -8.074115e-06f, -1.5135846e-05f, 1.91623e-06f, 4.6197238e-05f, -2.7833366e-05f, 3.6714642e-05f, -4.6971338e-05f, -4.3892255e-06f, -8.792405e-06f, -2.0128891e-05f, -4.0468585e-06f, 2.4860235e-05f, -7.647444e-06f, 1.5495474e-05f, -2.070997e-05f, -1.224611e-05f, -1.4741925e-05f, 2.2555638e-05f, -2.1504866e-05f, 8.008561e-06f, 1.2446141e-05f, -3.365218e-05f, 2.5244776e-06f, 1.32788855e-05f, 1.789874e-05f, -3.2494117e-06f, 1.9029121e-06f, -1.7575043e-05f, 1.640316e-05f, 3.5498042e-06f, -5.6327603e-06f, 2.2832382e-05f, -2.0636508e-05f, -1.649648e-06f, 2.103011e-05f, -2.0909729e-05f, -9.898962e-06f, 1.9230845e-06f, -1.8384739e-05f, 1.6406077e-05f, 9.1210395e-06f, -3.6754152e-06f, 9.453417e-06f, -9.475482e-06f, 9.703955e-06f, 4.3586256e-06f, 3.9028846e-06f, 6.403532e-05f, -9.57579e-06f, -1.7941447e-05f, 5.5987857e-05f, -3.5902973e-05f, -1.4203368e-05f, -1.1803792e-05f, 3.7391757e-05f, -1.0939535e-05f, -1.7590526e-05f, 4.0103123e-06f, 4.6866257e-06f, 2.2585678e-05f, -2.1296562e-05f, 2.3365099e-05f, 1.427566e-06f, -2.733956e-05f, 2.8364208e-05f, 1.4034351e-05f, -2.904058e-05f, 2.4978617e-05f, 6.38876e-06f, 7.1644627e-06f, 2.3094149e-06f, -1.8536313e-05f, -4.200163e-06f, -2.5760786e-05f, -2.6713291e-05f, -2.6831516e-05f, -1.3742792e-05f, 1.5563768e-05f, 8.201261e-06f, 4.155236e-06f, -1.2673789e-05f, -1.3563682e-05f, 2.881359e-06f, -3.1254235e-06f, -5.6848207e-06f, 3.7170634e-07f, 1.3080422e-05f, -1.6285558e-05f, 1.26123905e-05f, -1.8226472e-05f, 7.87428e-06f, 1.039038e-05f, 1.182264e-05f, -1.0034677e-05f, 2.9406995e-06f, -4.6833073e-05f, 3.3757744e-05f, -5.9066995e-05f, 3.7015885e-05f, 2.4935756e-05f, 9.797589e-06f, -4.817445e-06f, -9.210921e-06f, 1.6663991e-05f, -1.32198065e-05f, 1.625368e-05f, 9.220676e-06f, 2.0897263e-05f, -1.213691e-05f, 6.2828462e-06f, 1.4006903e-05f, 2.3116174e-05f, 6.995045e-07f, 8.57943e-06f, -2.7691534e-05f, 3.53984e-06f, -3.3898334e-06f, -2.71733e-05f, 1.2265803e-06f, 8.642176e-06f, -2.2366743e-05f, 2.495114e-06f, -2.6770074e-05f, 2.5554678e-05f, 2.0832617e-06f, 2.6206857e-05f, -1.8975603e-05f, -1.4314308e-05f, 2.4617189e-06f, 1.3978458e-05f, 6.1796422e-06f, 2.6429946e-06f, -5.4760258e-06f, 5.5705227e-06f, 1.871937e-05f, -6.0487396e-06f, -1.874645e-05f, -1.111231e-05f, -6.443349e-07f, 3.1934328e-06f, -8.626659e-06f, -1.2199614e-05f, 1.16390365e-05f, 4.2642132e-05f, 2.9712528e-05f, 1.8280085e-05f, -4.4190297e-06f, -4.044595e-06f, -4.34849e-05f, -3.484333e-05f, 2.8853528e-05f, 1.9404015e-05f, 1.5129423e-05f, -2.2642242e-05f, -1.1989187e-05f, 2.0355825e-05f, -2.1949294e-05f, 1.8185407e-05f, 5.984978e-06f, -7.035901e-07f, -1.7084982e-05f, 1.7976776e-05f, 2.9983812e-06f, -2.6425969e-05f, -3.1929543e-05f, -3.1501662e-05f, -1.1256799e-05f, -1.933859e-05f, -2.4407353e-05f, 2.4351132e-06f, -2.0617506e-05f, 1.5799966e-05f, -2.1304671e-05f, -1.0071345e-06f, 1.1894147e-05f, -1.50480555e-05f, -2.110504e-05f, -9.942513e-06f, -7.79126e-06f, 3.593873e-06f, -1.03747425e-05f, 1.3640888e-05f, 2.0556352e-05f, 1.6158261e-05f, 1.0615646e-05f, -1.4581487e-05f, -1.3407813e-05f, -6.23337e-06f, 1.0620408e-05f, 1.5624097e-05f, -1.4292688e-05f, -2.1966716e-05f, -3.9610345e-07f, -7.710965e-06f, 2.9783234e-05f, 3.447916e-05f, 4.4859567e-05f, -4.183885e-05f, 1.0594916e-06f, -2.1628413e-05f, 2.3916837e-05f, -1.8531545e-06f, 3.0014503e-06f, 1.1061087e-05f, -3.6876827e-06f, 3.4236793e-05f, -1.9614812e-05f, 2.3039396e-05f, -2.1764728e-05f, 4.171252e-06f, -2.3941986e-05f, -1.7638557e-05f, 1.84634e-05f, -1.4364995e-05f, -2.0162737e-05f, 2.0825446e-05f, 2.7279637e-05f, -2.6009811e-05f, 4.7573303e-06f, -9.23878e-06f, -3.2043412e-05f, -2.7965149e-05f, -2.3929426e-05f, 6.3951225e-06f, -2.2539134e-05f, 8.465014e-06f, -1.5962027e-05f, 1.4914141e-05f, 3.394524e-06f, 1.3526945e-05f, 1.701949e-05f, 4.567911e-06f, 1.4722874e-05f, 1.5563392e-05f, 1.4889474e-05f, 1.6609391e-06f, 2.0299782e-05f, -8.241586e-06f, -4.1094295e-06f, 3.807825e-06f, -3.0819618e-05f, -8.695033e-06f, 1.3083082e-05f, 3.537757e-05f, 1.986865e-05f, -3.571793e-05f, -3.2311542e-05f, 2.2930688e-05f, -2.107566e-05f, -2.871829e-05f, 1.26577115e-05f, 2.1734122e-06f, -1.9814017e-05f, 3.95871e-05f, -1.2928514e-05f, 1.9917707e-05f, 1.0614095e-05f, 1.2617099e-05f, -8.186634e-06f, -9.206195e-06f, -6.673364e-06f, 1.1088918e-05f, 3.1925785e-05f, -2.751151e-05f, -2.058003e-05f, -2.333306e-05f, -1.1637542e-05f, -5.6301074e-06f, 5.861362e-06f, -2.4209494e-05f, 2.1974682e-05f, -1.273391e-05f, 1.0611222e-05f, -1.7220456e-05f, -1.5407755e-05f, -6.871795e-06f, 1.3617859e-05f, -8.519814e-06f, 1.5391004e-05f, -1.606722e-05f, -2.7087717e-06f, 1.2003413e-05f, 8.930131e-06f, -1.1751374e-05f, 2.4350177e-07f, 1.0575067e-05f, 1.1840274e-05f, -4.18608e-05f, -3.8243452e-05f, -4.5138157e-05f, 5.475337e-06f, -1.9919133e-05f, 1.4453604e-05f, -5.0802017e-05f, -1.2978113e-05f, 2.2281634e-05f, 2.4738076e-05f, 9.120741e-06f, -7.107544e-06f, 3.085873e-05f, 3.5442154e-05f, -2.9549074e-05f, -3.335124e-05f, -2.9842065e-05f, 1.9677089e-05f, 1.6770759e-05f, -1.8271177e-05f, 1.1543839e-05f, 2.3709152e-05f, 1.5929883e-05f, -7.675077e-06f, -1.722686e-05f, 2.5556144e-05f, 5.7381686e-07f, -7.1244317e-06f, -1.5420555e-05f, 1.611206e-05f, 5.2407523e-07f, 1.3119436e-05f, -9.603495e-06f, 1.5469576e-06f, 2.5801955e-06f, -1.1130255e-06f, -2.130506e-05f, 9.0557805e-06f, -1.2647018e-05f, -1.2106303e-05f, -1.0939863e-05f, 1.1977409e-05f, -3.9630213e-06f, -6.1554756e-06f, -8.262891e-06f, 1.6904323e-05f, -8.191628e-06f, 9.5011865e-06f, -2.1401043e-05f, 1.5572363e-05f, -3.0186016e-05f, 4.879376e-05f, -4.3638956e-06f, 2.0698311e-05f, -5.596485e-05f, 3.163851e-05f, -2.9254812e-05f, 6.259288e-06f, -2.2612818e-05f, 3.661098e-05f, 2.1934507e-05f, -8.4873445e-06f, 2.3875238e-05f, -1.122896e-06f, -3.0141553e-05f, -2.278902e-05f, 2.8070222e-05f, -2.2813938e-05f, -1.6316404e-05f, -1.1823188e-06f, -7.0434007e-06f, 9.570351e-06f, 1.4656741e-06f, -4.3633477e-06f, 8.112701e-06f, 4.6114956e-06f, -1.0326088e-05f, 1.1576635e-05f, 2.43672e-05f, 2.790764e-05f, -9.9335275e-06f, -2.2283034e-06f, 1.4695653e-05f, -5.344397e-06f, 8.434898e-06f, -4.2395695e-06f, -1.1766839e-05f, 8.5701995e-06f, 5.034586e-06f, 1.3801261e-05f, 1.1942684e-05f, -1.3984496e-05f, -1.8063747e-05f, 1.7902734e-06f, 1.8006918e-05f, 5.4813804e-06f, 3.103663e-06f, -4.7966656e-05f, -4.1185707e-05f, 9.707424e-06f, 4.8529237e-05f, -1.2618128e-05f, 3.9422775e-06f, 4.322309e-05f, -1.351821e-05f, 2.5902289e-05f, -3.1100768e-05f, 7.686426e-06f, 3.3844943e-05f, 4.5111086e-05f, 8.433516e-06f, -4.6059587e-05f, 1.8678906e-05f, -9.144587e-06f, 2.1889688e-05f, -3.1460637e-05f, 5.6041126e-06f, -1.46394805e-05f, -3.0228696e-06f, -1.4221598e-05f, -7.6154893e-06f, 2.8148324e-05f, 2.4830382e-05f, -3.454672e-05f, 3.2701807e-06f, -3.4800019e-06f, 1.9306846e-05f, 9.328315e-06f, 5.217606e-06f, -1.3793342e-05f, -1.1775035e-05f, 1.0045029e-05f, 6.461657e-06f, 6.215724e-06f, -1.0563893e-05f, -1.0663804e-05f, 1.07749265e-05f, -1.5646307e-05f, -1.20829645e-05f, -1.13284805e-05f, -1.7349146e-05f, 1.5785148e-05f, 1.7148759e-05f, -1.5722697e-05f, 2.7683089e-05f, 3.5107416e-05f, -1.4974117e-05f, 3.746744e-05f, -5.1587136e-05f, 2.1075337e-05f, -6.172248e-06f, 4.064507e-05f, 1.5079973e-05f, -2.1762655e-05f, -4.1980015e-06f, -3.9838254e-05f, -4.3982112e-05f, 4.7148336e-05f, -2.1357423e-06f, -1.788738e-05f, 6.7219726e-06f, 2.766897e-05f, -1.3963191e-05f, 2.6001058e-05f, -3.397779e-05f, -1.8668368e-05f, 1.4372603e-05f, 2.9675224e-05f, -3.3089465e-05f, 5.0725507e-06f, -3.332623e-07f, -1.9776878e-06f, -2.5760679e-05f, 2.6913998e-05f, -3.061802e-05f, -1.1607144e-05f, 4.455249e-06f, -1.0582905e-05f, -1.7049702e-05f, 1.6587592e-05f, -5.3260127e-08f, 5.673966e-06f, -2.8470672e-07f, -1.077049e-05f, -4.5028237e-06f, 1.0933266e-05f, 7.6156707e-06f, -6.9322177e-06f, -4.9633254e-06f, 1.50386695e-05f, 1.4129021e-05f, -1.1347086e-05f, 1.2606937e-05f, 5.1780685e-06f, 4.1887284e-05f, -3.6578833e-05f, -4.7444746e-06f, -9.664841e-06f, -3.3889835e-06f, -2.6441026e-05f, -1.6957645e-05f, -5.728053e-06f, 8.0456275e-06f, -3.3072258e-05f, 2.9500046e-05f, 1.5634261e-05f, -1.43122e-05f, 3.394041e-05f, -2.83167e-05f, -1.6753735e-05f, -3.0674437e-05f, 1.5314543e-05f, -1.2482533e-06f, -5.0083563e-06f, -3.7282232e-05f, 3.6942296e-05f, -2.5395544e-05f, 1.9862115e-05f, -1.5320922e-05f, -1.0093028e-06f, 1.1399165e-05f, -2.7562064e-05f, 2.529883e-05f, -2.5716474e-05f, -1.5544008e-05f, -1.6139413e-05f, -8.482359e-06f, -9.508144e-06f, 9.250577e-06f, 2.1579679e-05f, -8.160692e-06f, 6.141074e-07f, -1.072119e-05f, -1.4831342e-05f, 3.1690595e-06f, 1.5799242e-05f, 4.130482e-06f, 8.8865e-06f, 1.5886677e-05f, 4.6011182e-06f, -1.61947e-05f, -3.7135167e-05f, 7.90591e-06f, -2.3928642e-05f, 6.343543e-06f, -3.7364287e-05f, -5.163296e-05f, 1.3762383e-06f, -4.372609e-05f, -1.8842033e-05f, -1.2709351e-06f, 1.1141687e-05f, -4.556616e-05f, 6.4165856e-06f, -2.2908229e-05f, -2.0120042e-05f, 2.5293008e-05f, 1.4202835e-05f, 1.9258454e-05f, 1.107594e-05f, 2.0334298e-06f, 2.9512687e-05f, -7.0263623e-06f, 2.5322486e-05f, 2.4782736e-05f, -7.6276365e-06f, 8.165915e-06f, 1.800299e-05f, -7.2509088e-06f, -3.7486243e-05f, 3.0711555e-05f, -3.105557e-06f, 2.2934091e-07f, 1.5403839e-05f, -5.497978e-07f, 1.4700307e-05f, 7.156677e-06f, -1.0710976e-06f, -1.7785844e-05f, -1.3275989e-05f, -6.2927015e-06f, 1.2950104e-05f, -8.8817515e-06f, -1.7091288e-06f, 3.8815065e-06f, 3.022626e-06f, -1.3317682e-05f, 4.418127e-06f, -2.8254208e-05f, -4.7592566e-06f, 2.2819704e-05f, -1.904904e-05f, 3.342642e-05f, 3.5099267e-05f, -4.6560428e-05f, -3.128155e-05f, 1.5012114e-05f, -1.7878368e-05f, 3.1500047e-05f, 2.005228e-05f, 3.4790995e-05f, 2.439745e-05f, -1.7355462e-05f, -1.1365038e-06f, 2.3230417e-05f, 8.981088e-06f, -2.2802154e-05f, -9.268502e-06f, -1.35363425e-05f, -1.2973281e-05f, 5.7449115e-06f, 3.539188e-05f, 2.1537373e-05f, 2.3745235e-05f, 3.4981756e-05f, -1.7142429e-05f, -1.7486449e-05f, -3.4854365e-05f, 1.121404e-05f, -1.972224e-05f, 1.794401e-05f, 4.371569e-06f, -5.611839e-06f, 6.0798143e-06f, -1.7037817e-05f, -1.0113057e-05f, -1.1941871e-05f, 3.703999e-07f, 9.346629e-06f, -1.5627675e-05f, 1.4411856e-07f, -6.3983234e-06f, -1.0332579e-05f, -6.5710856e-06f, 9.2992495e-06f, 7.872476e-06f, -2.2622808e-05f, -2.390277e-05f, -2.7822196e-05f, 4.8409984e-05f, 4.1568266e-05f, 2.5196654e-05f, -1.3552708e-05f, 5.0641843e-06f, -2.0307856e-05f, 1.710471e-05f, 4.7986006e-05f, -2.8330576e-05f, -2.6662581e-05f, 2.3908664e-05f, 1.922368e-05f, -1.2167583e-05f, -1.828812e-05f, 1.842782e-05f, 6.3014427e-06f, 1.4204958e-05f, 1.2259441e-05f, -2.1726206e-05f, 2.1834383e-07f, 5.911211e-06f, -2.915621e-05f, 2.7803053e-06f, 3.3445915e-05f, -3.1154975e-06f, 3.366582e-05f, -1.3264524e-05f, 6.5799526e-07f, 7.756223e-06f, -1.4911458e-05f, -8.412115e-06f, -1.8496557e-05f, -4.9200717e-06f, 1.1969856e-05f, -8.218101e-06f, 9.245581e-06f, -2.959904e-06f, 5.152037e-06f, 1.8061147e-07f, -2.2154284e-06f, -1.26699215e-05f, 1.8717421e-06f, 1.0907197e-06f, 9.3796825e-06f, -9.492678e-06f, 2.2575734e-05f, 1.0208154e-05f, -2.8734099e-05f, 9.2958035e-06f, 3.312355e-05f, -2.8968605e-05f, -5.464969e-05f, -1.5696573e-05f, -1.32156e-05f, 1.9644347e-06f, -3.0129366e-09f, -9.705959e-06f, -2.5624595e-05f, -3.0111718e-05f, 2.1501606e-05f, 1.8501152e-05f, 3.0101337e-06f, 1.6314323e-05f, -1.6578633e-05f, -1.9250201e-05f, -2.823317e-05f, -1.4746449e-05f, 1.4732056e-05f, -6.411499e-08f, -1.6791217e-05f, -2.9531337e-05f, 3.7762038e-05f, -9.583388e-06f, -2.3560222e-05f, 1.5789936e-05f, 2.36654e-05f, -1.0335655e-05f, -1.0951827e-06f, -1.543742e-05f, -1.5227503e-05f, -8.939246e-06f, -1.076904e-06f, 8.1253626e-07f, 3.4171546e-06f, 1.8894018e-05f, 5.1251923e-06f, 1.3195216e-05f, 1.7019025e-05f, -1.821208e-07f, 5.099928e-06f, 1.9978215e-05f, 1.589522e-05f, 2.9750033e-06f, -3.8130606e-06f, -4.4876524e-05f, 2.2606282e-05f, 5.3357264e-05f, -8.677542e-06f, 3.075541e-06f, 2.3270002e-05f, 3.305899e-05f, -2.8105775e-05f, -3.447155e-05f, 2.6837648e-05f, -1.8077215e-05f, 1.8455936e-05f, -3.7385693e-05f, 7.5857274e-06f, -3.2073964e-05f, 2.5448287e-05f, 8.87452e-06f, 2.8133705e-05f, 2.2993818e-05f, -3.3676793e-06f, -1.9587325e-05f, 3.2826774e-06f, -1.8046385e-05f, 1.8277262e-05f, -3.0564875e-05f, 3.773312e-05f, -9.528616e-06f, -1.12854e-05f, -6.215066e-06f, 3.0517604e-05f, 3.2018987e-05f, -9.447225e-06f, -1.7027276e-05f, -8.672777e-06f, -4.9357345e-06f, -7.977755e-06f, -1.3292541e-05f, -1.1218051e-05f, 1.3663898e-06f, 4.3422333e-06f, -1.6716382e-06f, 4.895054e-06f, 1.810859e-05f, -3.177119e-06f, 1.0248322e-05f, 1.6222668e-05f, -1.6615004e-05f, 4.6870402e-05f, 4.151352e-05f, 9.445251e-07f, -3.191877e-05f, -2.694813e-05f, -3.5939007e-05f, -3.8845126e-05f, 4.256882e-05f, 2.4054714e-05f, -6.760973e-06f, -8.762665e-06f, 9.255395e-06f, 1.7579177e-05f, 1.707754e-06f, -3.8384787e-05f, -5.2046416e-06f, -3.2554763e-05f, 1.4646384e-05f, -1.04466335e-05f, 1.996968e-05f, 7.81065e-06f, 4.1881003e-07f, -5.4539773e-06f, -2.1751985e-05f, -3.840341e-05f, -1.3590535e-05f, 3.5231275e-05f, -1.0617683e-05f, 8.4151475e-07f, -1.2353307e-05f, 1.7184504e-05f, -3.7803761e-06f, 3.2023963e-06f, -3.4783554e-06f, -1.9115656e-05f, -3.5678402e-06f, -1.8676123e-05f, 1.2351001e-05f, -1.5751225e-06f, -2.7517015e-06f, -5.943837e-06f, -9.296477e-06f, -6.828064e-06f, -1.9481058e-06f, -4.3476493e-06f, 3.76235e-06f, 1.0958396e-05f, -1.6512464e-05f, 6.555443e-07f, 5.165591e-06f, 8.935949e-06f, -1.0791042e-05f, -2.9352728e-07f, -4.3712083e-05f, 2.3917093e-05f, 4.8431513e-05f, 2.0735024e-05f, -3.2597105e-05f, -9.670073e-06f, -2.8036553e-05f, -3.9014398e-05f, 2.0808582e-05f, -3.5013268e-06f, 2.323365e-05f, 8.500999e-07f, -1.5335852e-05f, 4.7978033e-06f, 1.7722023e-05f, 4.8870775e-06f, -2.4526196e-05f, -2.4447352e-05f, -1.2551169e-05f, 9.542664e-06f, -2.209247e-05f, -2.2040675e-05f, 5.422783e-06f, 5.78138e-06f, 1.0860779e-05f, 4.5559927e-06f, 3.7852264e-05f, -9.513134e-06f, -2.1094558e-05f, -1.0816675e-05f, 5.5953833e-06f, 1.54279e-05f, -7.514576e-07f, 1.2457322e-05f, -1.0229147e-05f, 7.4523916e-07f, -7.646161e-06f, -1.011388e-05f, 1.5905709e-05f, -1.1867318e-05f, -1.2549895e-05f, 8.2259785e-06f, -1.067598e-05f, 2.8374634e-06f, 2.181851e-05f, -6.536152e-06f, 2.2911603e-05f, 3.088232e-05f, 1.1643098e-05f, -2.2082528e-05f, 3.0449758e-06f, -3.59354e-05f, -3.0268236e-06f, 2.0187568e-05f, 2.9032308e-05f, -2.7792685e-06f, -2.4152885e-05f, 3.0419726e-06f, -2.0354577e-05f, -2.5192194e-05f, -2.8052571e-05f, 8.352315e-06f, 1.8035253e-05f, -5.684468e-06f, 2.3555978e-05f, -5.28711e-07f, 1.781783e-05f, -2.216585e-05f, -1.6889701e-06f, 3.827182e-05f, -2.3173874e-05f, 2.281266e-05f, -2.899992e-05f, 1.1175982e-05f, -1.607807e-05f, 1.4229171e-05f, -2.022532e-05f, -1.460784e-05f, 8.012308e-06f, 6.0955954e-06f, 1.5846192e-05f, 9.868002e-06f, 1.8742117e-05f, -1.2498391e-05f, 4.4768526e-06f, 1.5702666e-05f, -5.222208e-06f, -1.7211682e-05f, 1.944039e-05f, 5.3320305e-06f, 9.589238e-06f, 8.06138e-06f, 1.8251171e-06f, 3.8366893e-06f, -1.9613803e-05f, 7.923608e-06f, -2.7200525e-05f, -2.826473e-05f, 4.8157e-06f, -2.0861742e-05f, -1.3401247e-05f, -2.6855549e-05f, -2.2704702e-05f, 7.053857e-06f, 8.276563e-06f, -1.1592494e-05f, 3.5167017e-05f, 4.1902767e-06f, -2.9236844e-05f, -1.7174647e-05f, 3.0048368e-06f, -2.2201688e-05f, 1.4944058e-05f, -2.8147671e-05f, 1.5280408e-05f, 1.2872986e-05f, -1.9676663e-05f, -2.1000827e-05f, 2.830771e-05f, -3.0701838e-05f, -3.9834602e-05f, -2.5104516e-06f, 9.896494e-06f, 1.8190965e-05f, 1.42245e-05f, -3.3303745e-06f, -4.726908e-06f, -1.865312e-05f, 1.6907548e-05f, 8.289716e-06f, 1.19607985e-05f, -6.8922973e-06f, 1.1321777e-05f, -5.1935913e-06f, -1.3247728e-05f, -3.2299877e-08f, 7.3242363e-06f, -1.0635834e-05f, 7.269957e-06f, -2.5950632e-05f, 4.0529078e-05f, -2.1167223e-05f, 4.308806e-05f, -3.923793e-05f, -3.8097798e-05f, -1.4795011e-05f, -3.8059436e-05f, -8.422566e-06f, 1.2689578e-05f, -1.1752204e-05f, -1.3985333e-05f, -1.0452175e-05f, 1.6349977e-05f, -2.4636096e-05f, 3.4723973e-05f, -1.961564e-05f, -2.267565e-05f, 1.02164795e-05f, -1.0956013e-05f, 8.09627e-06f, -2.440984e-05f, 2.1416005e-05f, 2.2989982e-06f, -2.3563276e-05f, -1.2516306e-05f, -3.895604e-06f, -3.4234337e-05f, -2.267685e-05f, 2.0988453e-05f, 7.276922e-08f, -2.1147942e-05f, -4.6095903e-07f, 1.3411574e-05f, -1.9449748e-09f, 1.564771e-05f, 4.2886697e-07f, 1.9393734e-05f, -1.5482583e-05f, 1.1039094e-05f, 1.0976718e-05f, -1.7115897e-05f, 2.1803269e-06f, -1.0339577e-05f, 6.086989e-06f, 2.016754e-05f, -1.3492883e-05f, 2.8147522e-06f, 3.9623585e-05f, -3.1460728e-05f, 3.151286e-05f, -1.1572205e-05f, -3.9457454e-06f, -1.0373233e-05f, -4.1280513e-05f, 5.668446e-06f, -1.7128661e-05f, 2.5362113e-05f, 1.3965599e-05f, -4.6655714e-06f, 2.0037558e-05f, -7.6465585e-06f, -3.376809e-05f, 1.7773473e-05f, 1.0114419e-05f, -2.692392e-05f, -1.5587862e-05f, -1.3878195e-05f, 2.1521131e-05f, -8.097917e-06f, 6.618161e-07f, 3.0603653e-06f, 1.2606137e-05f, -1.849812e-05f, -8.446372e-06f, 2.0307893e-05f, -2.80341e-05f, 5.822449e-07f, 3.0469288e-05f, -2.7131313e-05f, 5.7243886e-07f, -1.33337235e-05f, 1.3327666e-05f, 1.959812e-05f, -2.0178959e-05f, 1.201809e-05f, -1.9863435e-06f, 1.2834548e-05f, 7.322389e-06f, 8.314607e-06f, -1.8005587e-05f, 1.418671e-05f, -3.3158694e-06f, -1.2062921e-05f, 8.341611e-06f, -9.623965e-06f, 3.798618e-05f, -1.9814814e-05f, 4.0127285e-05f, 4.8896698e-05f, 2.20124e-05f, -3.1712367e-05f, -3.485366e-05f, 2.342211e-06f, -5.0537665e-06f, -9.6916365e-06f, 2.4149178e-05f, -1.4717657e-05f, 6.8919203e-06f, 2.1046571e-05f, 6.1046358e-06f, 1.47485825e-05f, -1.7493783e-05f, 5.1791976e-06f, 3.2922558e-06f, -2.4525157e-06f, -7.499718e-06f, 3.6551726e-06f, -6.5867725e-06f, 8.852459e-06f, 6.1294527e-06f, -1.1704045e-05f, -8.648825e-06f, 3.0990655e-06f, -1.6937962e-05f, -4.2558506e-05f, -1.2636055e-05f, 3.2418935e-05f, -6.7433684e-06f, -4.5145615e-07f, 4.377102e-06f, -1.4534768e-05f, -2.0796046e-05f, -1.5464386e-05f, 1.8297818e-06f, 3.5605929e-06f, -1.310716e-05f, -8.317526e-06f, 1.298753e-05f, -4.404849e-06f, 4.693889e-06f, 1.5961028e-05f, 1.4529478e-05f, 1.3030885e-06f, 8.96695e-06f, 1.7774188e-06f, 2.0146856e-05f, 3.3658765e-05f, -1.7132887e-05f, -8.971359e-06f, -8.633807e-06f, -4.285549e-05f, -6.270404e-06f, -7.5109233e-06f, -8.366482e-06f, -2.3881348e-05f, 5.619077e-06f, -2.6954822e-05f, 5.5812566e-06f, -9.965217e-06f, 2.4381261e-05f, -2.1189357e-05f, -1.2547046e-05f, 8.256171e-06f, -2.6652819e-05f, 2.3970675e-05f, 2.0046771e-05f, 3.4563686e-06f, 5.2773717e-06f, 1.7244609e-05f, 2.50684e-05f, 2.0396947e-05f, 1.2350458e-06f, -1.1101642e-05f, 2.1772454e-05f, -6.340479e-06f, -8.744843e-06f, 2.7488585e-07f, 7.12947e-06f, 1.4599735e-05f, 3.184374e-06f, 2.1798864e-05f, 9.101228e-06f, 4.608729e-06f, -8.481789e-06f, 8.541487e-06f, -1.4027959e-05f, -9.615843e-06f, -1.653404e-05f, -1.5000706e-05f, 1.7308885e-05f, 1.0146581e-06f, -1.4473167e-05f, -2.5611203e-05f, -3.6560793e-06f, -1.7760203e-06f, -3.7136444e-05f, -6.5249974e-06f, -2.4772515e-05f, 4.3814554e-05f, 3.314645e-06f, 8.891873e-06f, -1.2748752e-05f, -1.0116174e-05f, 1.6493357e-05f, 3.4317675e-06f, 1.3602547e-05f, -6.853073e-06f, -1.467945e-05f, 1.4148607e-05f, -2.3989998e-05f, 1.8354305e-05f, 1.6929785e-05f, 1.5915164e-05f, 1.8898556e-05f, 6.4554883e-06f, -1.2458975e-05f, 1.1344781e-05f, 4.7086164e-06f, 3.3453147e-05f, -6.9133075e-06f, 1.866376e-05f, 9.750205e-06f, -1.00703255e-05f, -9.70156e-07f, 8.916649e-06f, -1.6271031e-05f, 1.6391878e-05f, -2.1845899e-05f, -1.4434075e-06f, 3.3079912e-06f, -1.259712e-05f, -1.9861953e-05f, 1.3914725e-05f, -3.271351e-06f, 1.0779089e-05f, -1.5496533e-05f, 1.5391093e-05f, -6.051206e-06f, -2.3142073e-05f, -3.2772025e-06f, -1.44756405e-05f, -1.3990443e-05f, 2.657516e-05f, -2.3980624e-06f, -2.5616235e-05f, -1.017319e-05f, 4.7237194e-05f, -5.4004413e-06f, -1.6604334e-05f, 1.927111e-05f, -1.3732309e-05f, -1.7489798e-05f, 1.6896269e-05f, 2.8227657e-07f, 2.4960107e-05f, 9.0482337e-07f, 7.430089e-06f, -1.194217e-05f, -1.2669131e-05f, 5.86731e-06f, 4.373001e-07f, -1.2977248e-06f, 1.6724922e-05f, -1.1465377e-05f, -2.3858818e-05f, 1.8519577e-05f, -4.2168886e-05f, -1.9964462e-05f, -4.559266e-05f, 3.0219426e-06f, -6.8876557e-06f, 5.697146e-07f, 5.831514e-06f, 1.5583946e-05f, -8.815056e-06f, -1.9218105e-05f, -1.4317958e-06f, 1.0492961e-05f, 1.2922608e-05f, 8.778932e-06f, -1.8902074e-05f, -1.3677433e-05f, 4.193995e-06f, -1.707249e-05f, -1.4830222e-05f, -8.6791715e-06f, -1.160804e-05f, -3.5301793e-05f, -5.200733e-05f, -1.4965017e-05f, -3.8311533e-05f, -2.9795954e-05f, 3.9262188e-05f, -9.590737e-06f, -3.536833e-05f, 2.186021e-05f, -1.9479003e-05f, -1.697338e-05f, -1.761023e-05f, -1.8344259e-05f, 1.1264343e-07f, -2.5755411e-05f, -1.4494994e-05f, -5.056866e-07f, -1.4298427e-05f, 9.998386e-06f, 2.5121537e-05f, -2.8371405e-05f, 2.0091671e-05f, -2.2427948e-05f, 8.771526e-06f, 2.9953155e-05f, 3.2817792e-05f, 1.6837317e-05f, 3.111831e-05f, 2.3457274e-05f, 9.363442e-06f, 3.4573255e-05f, -1.2004573e-05f, 1.1238836e-05f, -7.3348065e-06f, -3.6764966e-06f, 2.365656e-06f, 8.3819435e-07f, -1.065303e-05f, -1.493069e-05f, 1.7783945e-05f, -9.296048e-07f, 6.6095795e-06f, 1.80268e-05f, 1.6818465e-05f, -6.630484e-06f, 8.798691e-06f, -1.2332235e-05f, -2.0444773e-05f, 5.4241504e-05f, 3.3580713e-05f, 9.729183e-06f, -1.8637598e-05f, 2.7725557e-05f, 4.0698313e-05f, 7.908104e-06f, 2.8822307e-05f, -1.733515e-05f, 9.875679e-06f, -4.4160697e-06f, -1.435722e-05f, -1.2382883e-05f, 1.3905137e-05f, -1.7823628e-06f, -7.367144e-06f, -1.5129756e-05f, -2.8375756e-05f, -1.110115e-05f, 1.9822239e-05f, -1.16602305e-05f, 1.8623366e-05f, 4.889774e-06f, -2.5952904e-06f, -2.087596e-08f, -3.605321e-05f, 2.7221402e-05f, -1.5286316e-06f, -2.9507532e-06f, 2.6656046e-05f, 2.7885171e-05f, 3.5443547e-05f, -9.948845e-06f, -1.2433248e-06f, -1.1873354e-05f, -1.2091839e-05f, 1.0608997e-05f, -4.1099756e-06f, 1.238996e-05f, 9.032636e-06f, -1.8635024e-05f, 1.0401645e-06f, 2.740314e-06f, -1.2338741e-05f, -1.7985254e-05f, 2.2096836e-05f, -1.2100907e-05f, -1.1952122e-05f, 1.2115911e-05f, 1.6244127e-05f, 4.127695e-05f, 4.2383595e-05f, 2.9859128e-05f, -1.9166935e-05f, -1.0038809e-05f, 1.7005626e-05f, 1.4317419e-05f, 1.7518776e-05f, 1.6916e-05f, 1.6511856e-05f, -2.1279748e-05f, 1.3118306e-05f, -2.1040312e-06f, 1.6213366e-05f, 3.2576174e-06f, -2.781715e-06f, 1.0183608e-05f, -5.05508e-06f, -2.6051632e-05f, 9.399827e-06f, 1.5551092e-05f, 4.548742e-06f, -1.1639775e-05f, 4.35509e-05f, -2.2812603e-06f, 1.192977e-05f, -4.031922e-05f, -2.6447317e-06f, -2.170393e-06f, -1.6935326e-05f, 6.123861e-06f, -3.1700424e-07f, 8.06306e-06f, 2.292963e-05f, -2.0993322e-05f, 1.4329417e-05f, -1.3681779e-06f, -4.8899196e-06f, 1.6001519e-05f, 1.1037975e-05f, 2.0420151e-05f, -1.0237718e-05f, -1.5008447e-05f, 7.0525493e-06f, 1.0304104e-05f, 1.610393e-05f, 5.6931523e-05f, -2.6961185e-05f, -5.246701e-05f, 1.6620728e-05f, 4.1206767e-05f, 2.1101647e-05f, -4.8508437e-06f, -2.156842e-05f, 1.0805153e-05f, -1.6513013e-05f, -1.4994432e-05f, -5.9887784e-06f, 1.9967474e-06f, -2.3129933e-05f, 7.319525e-06f, -8.953988e-06f, 2.1873775e-06f, 2.9992968e-06f, -5.205155e-06f, 1.8608356e-05f, -1.8765073e-05f, 2.1206006e-05f, 4.427733e-06f, 2.3022043e-05f, -1.9434452e-05f, -1.9699406e-05f, -3.6477253e-05f, -4.194572e-05f, 6.8631216e-06f, -5.617533e-07f, 2.3736067e-05f, 1.2938462e-05f, 6.8625754e-06f, -8.058977e-07f, 3.496546e-06f, 1.5380452e-05f, -1.857225e-05f, 3.2072762e-06f, -1.5661983e-05f, 9.406811e-06f, -4.6111977e-06f, 1.3452789e-05f, -2.100172e-05f, 1.2161284e-05f, 6.69293e-07f, 2.0999183e-05f, -1.1511839e-05f, 1.2789265e-05f, -1.18097405e-05f, -3.2302232e-05f, -5.51586e-05f, 4.4278753e-05f, -4.2438274e-05f, -3.9950515e-05f, 3.4817338e-05f, -1.4420303e-06f, 2.1033186e-06f, -1.4265736e-07f, -2.029533e-05f, -1.27605035e-05f, 6.104744e-07f, -1.31872375e-05f, -2.1672975e-05f, -1.2719213e-05f, -1.3555376e-05f, -1.916579e-05f, 1.79496e-05f, 1.7492594e-05f, -9.9911085e-06f, -1.1435802e-05f, 1.5842827e-05f, 5.0850476e-06f, 2.8347993e-05f, 1.3534246e-05f, 1.1019255e-05f, 3.863206e-06f, 2.2271147e-06f, 8.513245e-06f, 4.742555e-07f, -1.0374339e-06f, 1.8463044e-05f, -1.6842607e-05f, -6.2037866e-06f, 1.9894214e-06f, -2.2764829e-05f, 3.7838472e-06f, 6.585715e-06f, -3.401919e-06f, -2.1872416e-05f, -1.1623669e-06f, 1.8246581e-05f, -1.38345085e-05f, -2.3061499e-05f, -8.0147066e-07f, -9.319791e-06f, -1.2754633e-05f, 3.7197267e-05f, 4.0312472e-05f, 7.8541225e-06f, 2.3747029e-05f, 4.8596015e-05f, 3.2233807e-08f, -4.8580172e-05f, 3.894718e-05f, -3.9903745e-07f, -1.2330093e-05f, 1.6388892e-06f, -2.282034e-06f, 5.4552243e-06f, -2.8674397e-06f, -1.46415105e-05f, 7.9047226e-07f, 3.7425075e-06f, 4.898758e-06f, 1.6290109e-05f, 1.315114e-05f, -8.7705785e-06f, -1.8393157e-05f, -2.4664947e-05f, 1.1974795e-05f, 3.3859174e-05f, 3.9068735e-05f, 3.7540427e-05f, 1.1368983e-05f, -1.2232788e-05f, -2.4660352e-05f, 3.8193604e-05f, 6.156255e-06f, -1.599803e-05f, -2.1885595e-05f, -2.0974125e-05f, -8.648924e-07f, -2.1380589e-05f, 1.6260667e-05f, 1.9532854e-05f, -8.293134e-06f, -1.7196217e-05f, -2.3306775e-05f, -7.66624e-06f, -1.1590307e-05f, -1.7918328e-05f, 1.5886455e-06f, 7.77604e-06f, -2.3330964e-05f, -3.5835637e-05f, 1.7701108e-05f, -4.7493748e-07f, -2.8727629e-05f, -6.79692e-06f, -5.109453e-05f, -3.6027162e-05f, 4.7065307e-05f, 1.0661561e-05f, -1.6095697e-05f, 9.202399e-06f, -2.0894029e-06f, 1.4456821e-05f, -6.3922785e-06f, -2.2809487e-05f, 9.0014555e-06f, 2.3829358e-05f, 1.0911293e-06f, -2.447158e-05f, 2.0449936e-05f, -1.6956377e-05f, -1.2868983e-05f, -4.023728e-06f, -2.2856533e-05f, -4.615234e-05f, 2.4912859e-05f, -2.6659609e-05f, 2.1716573e-05f, 1.1783935e-05f, -4.630757e-06f, 5.2890978e-06f, -3.8959897e-05f, -1.3750744e-05f, 9.618585e-06f, 1.0131977e-05f, 2.1820812e-05f, 1.3189283e-06f, 2.112524e-05f, 1.657473e-05f, -3.5722348e-06f, 1.1689726e-05f, 7.653493e-06f, -1.21705725e-05f, -1.2928176e-05f, -1.5311065e-05f, -1.2132201e-05f, 6.8865374e-06f, -1.7191282e-05f, -1.2491116e-05f, 1.1651291e-05f, -2.5976344e-05f, 1.3801717e-05f, -3.999395e-05f, -2.5269332e-05f, 3.6625046e-05f, -5.0763596e-05f, 8.427016e-06f, -1.4628337e-05f, 1.7957842e-05f, 2.5759718e-06f, -2.0503689e-05f, -1.4776676e-05f, -3.00582e-06f, 2.104905e-05f, -1.1096984e-05f, 1.5365405e-06f, -1.5490345e-05f, -1.8582054e-05f, 2.2557431e-07f, -7.2299636e-06f, 2.2534714e-06f, -1.4515809e-06f, -5.7168127e-06f, -3.763847e-06f, 4.7258923e-06f, 4.065523e-05f, -4.0840398e-05f, -1.3956301e-05f, 2.119387e-05f, -3.238687e-05f, 1.3758993e-05f, 4.219031e-06f, 2.2237095e-06f, -5.6607178e-06f, 2.667512e-06f, 3.7425698e-06f, -1.740873e-05f, 1.8007999e-05f, -1.1509548e-05f, -1.4170267e-05f, 7.0980705e-06f, -9.399206e-06f, -1.2285057e-05f, -1.1253222e-05f, -8.020363e-06f, 2.1226745e-06f, -1.5793523e-05f, 2.946557e-06f, -6.6248563e-06f, 3.9419567e-05f, 4.962016e-05f, -1.4309873e-05f, 3.3753462e-05f, 5.8671867e-06f, -3.916307e-06f, 1.5010796e-05f, 2.1904698e-06f, 1.6123353e-05f, 9.2571645e-06f, -2.3389086e-05f, -2.0313022e-05f, -1.0427249e-05f, -1.473383e-05f, -2.2054983e-05f, 1.7397837e-05f, -8.729799e-06f, 1.672182e-05f, -1.6310752e-05f, 1.0605009e-05f, 3.2185148e-06f, 2.4289275e-05f, 2.456777e-05f, 9.906796e-06f, 3.40582e-06f, 1.8842076e-07f, 6.0198136e-06f, 8.5097245e-06f, -2.6394071e-05f, 1.1880452e-05f, 1.5168866e-06f, 1.18142225e-05f, -1.6073016e-05f, -2.0532781e-05f, 8.952418e-07f, -1.04309365e-05f, 1.5461191e-07f, 1.4624961e-06f, -1.6709444e-05f, -2.2834407e-05f, -1.7071783e-05f, -9.46802e-06f, 1.8623343e-05f, 2.0304362e-05f, 5.183466e-06f, 3.8567276e-05f, 2.7754313e-05f, -5.287492e-05f, -4.0893916e-05f, -4.2287535e-05f, -5.4292752e-05f, -2.3266382e-07f, -3.543222e-05f, -8.689932e-06f, -1.3901889e-05f, 7.1363106e-06f, -7.903326e-06f, -1.3351223e-05f, -2.3921855e-06f, -9.133915e-06f, -1.3217708e-05f, -5.7332068e-06f, -1.546572e-05f, 4.390989e-07f, -1.3453496e-05f, 1.538809e-05f, -9.648486e-06f, -5.3102076e-06f, 8.434624e-06f, -3.5566667e-05f, -3.3030607e-05f, -3.143323e-05f, -4.6925896e-05f, 2.4826e-05f, -2.7791042e-05f, -3.2573487e-05f, 1.1359691e-05f, -1.4354535e-05f, 3.2798355e-06f, 1.5855263e-05f, -7.4230684e-06f, -1.743119e-05f, 1.6058675e-05f, -1.111697e-05f, 1.6934217e-05f, -7.198216e-06f, 6.5038957e-06f, 1.1611565e-05f, 2.2740507e-05f, -2.0386135e-05f, -5.1125636e-07f, 6.9077123e-06f, 1.4364126e-05f, 4.9033162e-05f, -5.7368914e-05f, -6.31775e-05f, -8.824921e-06f, 1.1061724e-05f, -2.1134267e-05f, 1.4572053e-05f, -3.4654488e-05f, 1.1427428e-05f, -1.7879454e-05f, 1.5830723e-05f, 3.5026649e-06f, 1.4638528e-05f, 1.5024975e-05f, 7.3571955e-06f, 3.1514473e-06f, -1.2044671e-05f, -4.5991474e-06f, 1.9660098e-05f, -1.6411695e-05f, 1.4110708e-05f, 1.9446468e-05f, 5.242867e-07f, 1.2220448e-05f, 7.2944463e-06f, -1.272524e-05f, 3.989124e-05f, 2.2682311e-08f, 1.6496984e-05f, -2.264065e-06f, -3.3422155e-05f, -2.1955551e-05f, 2.6044274e-05f, -6.0981315e-06f, 5.0464323e-06f, 2.0374577e-05f, -6.6414536e-06f, -1.2816656e-05f, 1.7669454e-05f, 2.0752268e-05f, 1.7826556e-05f, 1.7157989e-06f, -2.3703498e-05f, -1.9093364e-05f, 1.0774273e-05f, -4.226796e-06f, 1.4128416e-05f, 1.2556216e-05f, 6.390198e-05f, -6.042784e-07f, -1.0668193e-05f, 2.9855417e-05f, -4.4398752e-05f, 4.1315147e-05f, 2.301925e-06f, 5.0889972e-05f, 1.29071495e-05f, -7.5001863e-06f, -1.8261799e-05f, -5.610091e-06f, 3.0510753e-06f, 1.1207487e-05f, -7.1639747e-06f, -1.2822002e-05f, -1.4331654e-05f, -7.954845e-06f, 1.4682878e-05f, 2.1202325e-06f, -2.0441446e-05f, -5.8739242e-06f, -1.1447966e-05f, -4.7457115e-06f, 2.529959e-05f, -3.866799e-05f, 1.703189e-07f, -1.8474235e-05f, 1.6373946e-05f, 4.0087005e-05f, 1.41542005e-05f, 6.866885e-06f, 1.3177416e-05f, 2.0343994e-05f, -1.9707353e-05f, 1.247389e-05f, -1.1315689e-05f, -8.391173e-06f, 2.5128025e-05f, -2.2791954e-05f, 1.2104819e-05f, 7.344047e-07f, 3.969989e-06f, -9.6874655e-06f, -1.3043719e-05f, -5.749375e-06f, -1.8324263e-05f, -7.6251977e-06f, -3.085155e-06f, -9.92741e-06f, -2.5075466e-05f, 4.078022e-05f, 6.189581e-05f, -3.2826454e-05f, -6.147513e-05f, 6.01854e-06f, 2.449374e-07f, -6.2526524e-06f, 1.3626663e-05f, 1.3765394e-05f, 8.609982e-06f, 1.5585276e-05f, -2.1796774e-05f, 2.2242839e-05f, 3.7907964e-06f, -5.0259378e-06f, -1.0356413e-05f, 2.3152315e-05f, -1.7313216e-05f, -7.0727556e-06f, -1.095657e-05f, -4.274362e-06f, -4.4338376e-05f, 2.034508e-05f, -1.3636608e-05f, -3.9783747e-05f, 1.4951773e-05f, 3.353342e-05f, -2.550414e-05f, -4.7369937e-05f, -1.0919012e-05f, -2.193672e-05f, 1.3382547e-05f, -1.7703791e-05f, -2.4496669e-05f, 5.0282927e-07f, 2.9084133e-05f, -1.891291e-05f, -1.0697739e-06f, -2.2419694e-05f, 1.9126473e-05f, -2.294151e-06f, -4.755851e-06f, 2.2423676e-06f, -1.671357e-05f, -1.2395884e-05f, 4.7451147e-05f, -1.354153e-05f, 2.7406846e-05f, -5.1394607e-05f, -3.599938e-05f, 1.8256396e-05f, -3.0289943e-05f, -2.9741059e-05f, 1.0870404e-05f, -5.716134e-06f, -1.9371206e-05f, -6.1585433e-06f, -1.32444875e-05f, 6.7049436e-06f, -2.5631723e-05f, 6.117978e-06f, -1.2896499e-05f, 6.3578714e-06f, 2.3224484e-06f, -1.5295842e-05f, 7.867969e-06f, 3.2822702e-06f, -1.07834585e-05f, -1.3698738e-05f, -2.6009715e-05f, 7.2494972e-06f, 5.135516e-06f, -3.893071e-05f, -6.1523556e-06f, -2.8064778e-05f, -9.494147e-06f, -3.1503027e-06f, -2.0529495e-05f, -5.74322e-06f, 1.3146398e-05f, 2.3919825e-05f, 1.3448659e-05f, -2.8624822e-06f, -9.711732e-06f, 1.472238e-05f, -1.2504145e-06f, -2.2204345e-05f, -1.5142959e-05f, 3.465973e-07f, -2.4458861e-05f, -1.7982846e-05f, -1.926518e-06f, 3.290538e-06f, 5.062728e-05f, -4.8183523e-05f, -4.2274423e-05f, 2.3114391e-05f, 3.573508e-05f, -3.7121613e-06f, 2.2168037e-05f, -1.0130735e-05f, -3.9696856e-06f, 1.7884537e-05f, -1.8138204e-05f, 3.5400348e-07f, 1.8307619e-05f, 1.7302456e-05f, 8.197117e-06f, -1.2177447e-05f, 4.454476e-06f, -5.652173e-06f, 7.807734e-06f, -5.5626297e-06f, 8.599753e-06f, 1.3613981e-05f, 1.2531471e-05f, -2.3535656e-06f, -3.7027847e-05f, -5.5165706e-06f, 3.877076e-05f, -4.5535093e-05f, 3.0733114e-05f, -2.6607016e-05f, 4.265531e-05f, 2.0652185e-05f, 1.8393668e-05f, -1.4412511e-05f, -1.0380195e-05f, 4.900383e-06f, 1.612872e-05f, 8.808842e-06f, 1.5423013e-05f, 1.3140296e-05f, 1.5838652e-05f, -1.8612278e-05f, 1.9098108e-05f, -2.5379824e-05f, -2.2790005e-05f, 1.43443e-05f, 2.5173138e-05f, -1.0116237e-05f, 3.9925053e-06f, -3.9022147e-05f, -4.8657643e-05f, -3.2800403e-05f, -4.045856e-06f, 3.347775e-05f, 2.2306569e-05f, 3.9120743e-05f, -3.245913e-06f, 9.026812e-06f, 1.9220337e-05f, 9.115963e-06f, -1.3807443e-05f, 3.8560606e-06f, -1.0594591e-05f, -7.503723e-06f, -8.660293e-06f, 5.292728e-06f, 1.6657157e-06f, 1.0624531e-05f, -8.118919e-06f, -6.9876446e-06f, -1.2375118e-05f, -4.266072e-06f, 2.7113341e-05f, 3.7955815e-05f, -3.6931568e-05f, 2.0657242e-05f, -2.7136552e-05f, 4.0722854e-05f, 2.3025254e-05f, -2.6772585e-05f, -2.0566598e-05f, -1.1623086e-06f, -8.2057595e-06f, -1.9985304e-05f, -2.3924069e-05f, -2.1905968e-05f, 6.178749e-06f, -2.3607532e-05f, 2.8470904e-06f, -2.3435708e-05f, -1.8136714e-05f, -1.9599236e-06f, 1.7491666e-05f, -1.3271622e-05f, 2.2955084e-05f, 2.849336e-05f, 5.5778157e-05f, 4.4912136e-05f, 7.1883e-06f, -9.049005e-06f, -1.9846366e-05f, -5.6208828e-05f, 6.148857e-05f, -3.907273e-06f, -1.762058e-05f, 2.0009418e-05f, 1.2175965e-05f, 1.2247578e-05f, 5.8058795e-06f, 1.4301234e-05f, 1.6645e-05f, 1.1269254e-05f, 1.4112795e-06f, 5.63777e-06f, 5.686478e-06f, 1.9057732e-05f, -1.9798223e-05f, 2.8811348e-06f, -4.877963e-06f, 1.343004e-05f, -1.1858283e-05f, 8.971947e-06f, 1.9954708e-05f, -9.750751e-06f, 3.90263e-06f, -8.456457e-06f, -1.8460903e-05f, 1.5029707e-05f, -9.76784e-06f, -1.0135774e-05f, -1.288634e-05f, 3.1427502e-05f, -2.5769508e-05f, 1.6991571e-05f, 6.724311e-07f, 3.5005633e-07f, -1.5347234e-05f, -2.6470625e-05f, 4.5590937e-06f, 1.590196e-05f, 1.8310671e-05f, 1.8949144e-05f, -1.9535635e-05f, -6.3513853e-06f, 6.6383116e-05f, 3.8716753e-05f, 2.403173e-05f, 1.6008527e-05f, -2.0625781e-05f, 6.7299276e-05f, -3.0590647e-05f, -2.2362343e-05f, 6.1893898e-06f, -1.9210804e-05f, -2.9051907e-06f, 1.9548212e-05f, -1.8361081e-05f, -3.5158785e-06f, -3.950508e-06f, -1.29127e-05f, -7.5998696e-06f, -7.5276944e-06f, 1.8122944e-05f, 1.973521e-05f, 7.494868e-06f, -1.7709672e-05f, -1.0716874e-06f, 1.2237396e-05f, 1.70888e-05f, 4.144386e-05f, 1.2492502e-05f, 5.3331446e-06f, 3.0226889e-05f, -1.31589495e-05f, 2.5474149e-06f, -8.7660277e-07f, 2.4828796e-05f, 1.9120229e-05f, 5.6930057e-06f, 1.4991721e-05f, -2.4500214e-05f, -2.3457913e-05f, 1.3729469e-05f, 2.3417513e-05f, 6.800024e-06f, 8.235701e-06f, -3.4229388e-06f, -1.4752022e-05f, 5.0254052e-06f, -3.9190168e-06f, 1.1838837e-05f, 1.1305218e-06f, -2.5154166e-05f, 5.7789865e-05f, -5.7796544e-05f, -3.346096e-05f, 2.052023e-05f, 6.4796426e-05f, -1.4767886e-05f, 5.0199236e-05f, -1.0392243e-05f, -1.184871e-05f, 3.0794313e-06f, -1.7804816e-05f, -7.3820906e-06f, 1.7364206e-05f, 9.401098e-06f, -1.0776508e-05f, 1.2078365e-05f, 1.2678865e-06f, 5.771004e-06f, 7.291244e-06f, 1.144516e-05f, -1.4678281e-05f, -1.9987832e-05f, -8.83596e-06f, -4.970399e-06f, -5.1445804e-05f, -2.4131967e-05f, 1.1789462e-05f, 8.156029e-07f, -8.88089e-07f, -1.2659295e-05f, 3.4039473e-05f, 1.4542781e-05f, -2.9788065e-05f, -2.8699917e-05f, -2.971243e-06f, -9.75941e-06f, -1.522692e-05f, 1.2188446e-05f, -7.83772e-06f, 8.223452e-06f, 4.3903287e-06f, -1.7005208e-05f, -2.1450214e-05f, 1.7485208e-05f, 2.2552811e-05f, -1.2579711e-05f, -4.1721723e-06f, 2.8030781e-06f, 4.2057683e-05f, 6.534964e-05f, -5.1731837e-05f, -4.9050795e-05f, -2.5949965e-05f, -6.110588e-05f, -4.5082583e-05f, 9.294668e-06f, 1.8866975e-05f, 9.256502e-06f, -2.1431566e-05f, 1.0388926e-05f, -5.289297e-06f, 1.1985163e-07f, 1.64348e-06f, 3.155915e-06f, -2.1982887e-05f, -1.815997e-05f, -4.785588e-06f, -9.2134064e-07f, 1.7391656e-05f, 1.216034e-05f, 1.8838417e-05f, -2.65928e-05f, -4.657013e-05f, 1.1595161e-05f, -3.7930524e-05f, 4.409133e-05f, -1.3826466e-05f, 1.5645098e-06f, 2.3616806e-06f, -9.841953e-06f, -2.595354e-05f, 8.146407e-06f, 2.2140019e-05f, -1.783923e-05f, 1.7103304e-05f, 3.661247e-05f, 2.7816048e-07f, -3.0176358e-05f, -1.776443e-05f, 3.088374e-06f, -2.7534543e-05f, -2.218684e-06f, -5.327664e-06f, -1.5335734e-05f, -5.8439455e-06f, 7.69708e-05f, -2.0220874e-05f, -7.649124e-05f, -4.1862164e-05f, -1.2481237e-05f, -3.4927612e-05f, -2.2456697e-05f, -7.820622e-06f, 5.4494653e-06f, 1.2549731e-05f, 2.05449e-06f, 1.9633146e-05f, 1.3505013e-05f, 1.5455364e-05f, -1.43035e-06f, -1.7651671e-05f, 7.395981e-07f, 1.2047344e-05f, 3.116437e-06f, -2.9871085e-06f, 1.4922141e-05f, 3.713731e-06f, 1.0894235e-05f, -1.4715598e-05f, -1.5447758e-05f, -3.0020254e-05f, -1.7788241e-05f, -2.2546654e-05f, 2.7705966e-05f, -2.3928735e-06f, 1.7075276e-05f, 3.4151122e-05f, 2.6505924e-05f, 4.3507657e-06f, -1.6304477e-05f, -2.4921892e-05f, 3.1822515e-07f, -2.1732209e-05f, 1.6332855e-05f, 2.7802134e-05f, 2.4240185e-06f, -2.5645551e-05f, 2.508567e-05f, -2.2832493e-05f, -2.3761946e-05f, -8.604205e-06f, -2.5258836e-05f, 1.3155595e-05f, 2.3622953e-05f, 3.1330003e-06f, -6.27822e-05f, 4.966612e-05f, 6.477393e-05f, 7.988418e-05f, -2.2847442e-05f, 8.00194e-06f, -1.2531376e-05f, 5.690415e-06f, -1.00301795e-05f, -1.8962015e-05f, 2.0923562e-05f, -1.8646691e-06f, -1.3383527e-05f, -2.030279e-05f, -5.9874236e-07f, 1.3879975e-05f, 1.5731082e-05f, 4.8915513e-06f, 1.5656695e-05f, 6.600529e-07f, 1.6258438e-05f, 1.647281e-05f, 5.7519746e-06f, 2.1222804e-05f, -4.838294e-05f, -3.6998823e-05f, -4.4178755e-06f, -1.8276569e-05f, 3.7074384e-05f, -5.2115465e-05f, -1.28031e-05f, -1.7408058e-05f, 7.2734156e-06f, -1.9575738e-05f, -6.5569634e-06f, -1.8132616e-05f, 1.4186667e-05f, 2.0463816e-05f, 8.621175e-06f, -2.113331e-05f, -2.7873424e-05f, -1.7674713e-05f, 2.1378104e-05f, -3.4097582e-06f, 2.7593573e-05f, 3.1192394e-05f, 5.4508106e-05f, 6.961967e-05f, 4.5369234e-05f, 4.2192947e-05f, -8.8188006e-07f, 3.2414777e-05f, -2.0634478e-05f, -1.049075e-05f, 1.5484535e-05f, 1.7342454e-05f, -1.6851474e-05f, 9.95332e-06f, 1.8403618e-05f, 1.0669929e-05f, -2.0691172e-05f, -7.2283724e-06f, -6.5524514e-06f, 1.1354525e-05f, 1.7141672e-05f, 4.217173e-06f, -1.6433907e-05f, 5.025089e-06f, -2.2630098e-05f, 3.956087e-06f, 1.117235e-05f, 3.3264183e-05f, -3.034789e-05f, -5.7712426e-05f, 5.0182363e-05f, -8.948831e-06f, 2.1308617e-05f, -5.1068942e-05f, -1.7264516e-05f, -3.9359835e-05f, 3.066748e-05f, 3.739708e-05f, -4.102303e-06f, -1.29868895e-05f, 1.3401494e-05f, -1.5488115e-05f, -4.783355e-06f, -2.5420257e-05f, 3.8832462e-07f, 2.4887122e-05f, 1.9239551e-05f, -2.2004238e-05f, 1.8685996e-06f, 4.6611335e-06f, 6.680258e-05f, 4.5877056e-05f, 4.173778e-05f, 4.7353948e-05f, -6.8157555e-05f, -5.3907443e-05f, -2.147893e-06f, 2.0490588e-05f, 2.9223902e-06f, 6.3936222e-06f, -1.2374382e-05f, 2.1737518e-05f, 2.3897954e-05f, -1.7796921e-05f, -5.279058e-06f, -9.675186e-06f, 7.876573e-06f, 4.096491e-06f, -2.2306394e-05f, -7.037696e-06f, 4.879865e-06f, 2.3754053e-05f, -1.1395967e-05f, 1.8695226e-05f, -3.699843e-06f, -1.0257054e-05f, 4.2554282e-05f, 5.872788e-05f, -1.2266822e-05f, -2.1534048e-05f, 2.5722718e-05f, -6.634091e-06f, 1.2639445e-05f, 2.1129392e-05f, 2.5874358e-05f, 4.029561e-05f, 1.537753e-05f, 2.6774656e-05f, -2.2911581e-05f, 1.9326495e-05f, 1.408965e-05f, 1.9790838e-05f, 4.607805e-06f, 1.6846598e-05f, 1.8564178e-05f, -2.8498589e-05f, 4.1843227e-06f, 3.1691485e-05f, -6.8640205e-05f, -5.879374e-05f, -2.2760543e-05f, 7.23147e-05f, -5.6723864e-05f, 7.028158e-05f, 2.2795504e-05f, 1.5204473e-05f, 7.5169282e-06f, 6.532188e-06f, -1.0993621e-05f, 1.7406333e-05f, 1.885124e-05f, -1.7210084e-05f, -3.9109586e-06f, -3.7494801e-06f, 2.2447166e-05f, -1.7345837e-05f, -2.5729107e-06f, 5.8962632e-06f, -1.3042968e-05f, 1.9581083e-05f, 1.3178651e-05f, -1.0810586e-06f, -1.0983704e-05f, -5.3395328e-05f, -4.785633e-05f, 6.1759594e-05f, 1.9569743e-05f, 5.4029435e-05f, 5.3716034e-05f, -4.0274244e-05f, -1.964207e-05f, 2.0605417e-05f, 8.533771e-06f, -5.5949386e-06f, -1.7039549e-06f, 4.514101e-05f, -2.1609954e-05f, -3.3112552e-05f, 1.5721567e-05f, 1.9690258e-05f, -2.111793e-06f, -1.401985e-05f, -7.1294476e-06f, 2.5647258e-05f, -2.6291427e-05f, 1.1375486e-05f, 2.7929682e-05f, 4.2117503e-05f, -2.6502423e-05f, -1.6877408e-05f, -7.5150856e-05f, 9.433731e-05f, -7.3924466e-06f, 4.6486814e-05f, 1.4591239e-05f, -1.7771577e-05f, 1.2874936e-05f, -2.1153219e-05f, 3.4928353e-06f, -2.6892376e-06f, -2.5778829e-05f, -1.5919759e-05f, 2.1029513e-05f, -2.2657257e-05f, -1.92342e-05f, -1.1314979e-05f, -9.293948e-06f, -6.709842e-06f, -1.0715506e-06f, -1.6331825e-05f, 2.9968065e-05f, 1.4524231e-05f, -5.1090105e-05f, -3.6782047e-05f, -1.8009114e-05f, -4.4952783e-05f, 4.986717e-05f, 3.3634124e-06f, -1.2632161e-05f, -2.3197865e-05f, 1.4899044e-05f, 1.2271816e-05f, -9.578613e-07f, -3.0028159e-05f, 1.94278e-05f, -1.4780878e-05f, 1.9953954e-05f, 1.3945647e-05f, 2.2335293e-05f, 1.4071268e-05f, -3.4925735e-05f, 1.138168e-05f, 2.1727668e-05f, 3.6815854e-06f, 6.709949e-05f, -4.2649222e-05f, 4.737715e-05f, 2.3366885e-05f, 1.418568e-05f, 1.7051896e-05f, 5.0967523e-05f, 7.751994e-05f, 5.302966e-06f, -1.25942e-05f, -6.8734494e-06f, -2.6227576e-06f, 1.9422378e-05f, 1.7580036e-06f, 6.1265854e-07f, -1.6872009e-05f, 3.4853556e-06f, -1.6020005e-05f, 1.8372688e-05f, 3.72564e-06f, -1.24811295e-05f, 1.3176677e-05f, -1.9338977e-05f, 1.4333313e-05f, 1.7818085e-05f, -5.28669e-05f, -5.5388904e-05f, 4.596992e-05f, -3.8006187e-05f, 2.3426719e-05f, 7.268781e-05f, -4.3692944e-05f, -2.161458e-05f, 1.1685339e-05f, -3.2215346e-05f, -2.3363255e-05f, 2.6933956e-05f, 1.9849314e-05f, 4.529526e-05f, -2.5840653e-05f, -1.8507137e-05f, -2.6565436e-07f, -3.9569077e-06f, -1.3082771e-05f, -2.4788873e-05f, -2.8416893e-05f, -2.6702504e-05f, 3.4218545e-05f, 6.2219115e-05f, -9.115008e-05f, 7.9030855e-05f, 8.394366e-05f, -5.2073785e-05f, 1.691506e-05f, 1.6787368e-05f, -6.8427384e-05f, 1.8193177e-05f, 1.4494618e-05f, 1.8793782e-05f, 1.9965555e-05f, 2.376452e-05f, -2.0955687e-05f, -1.03225575e-05f, 6.775291e-06f, -1.571676e-05f, -3.968084e-06f, -5.507284e-06f, 1.9548999e-07f, 3.7592135e-06f, 2.07868e-05f, 5.363728e-06f, -1.0996426e-05f, -4.1188163e-05f, 6.3e-05f, -1.4847041e-05f, 6.394458e-05f, 1.3935464e-05f, 5.9493766e-05f, 5.007952e-05f, -6.162347e-05f, -3.500858e-05f, -3.0389041e-05f, -2.4383964e-05f, -2.9132038e-05f, 3.4900168e-05f, 2.9325985e-05f, -2.2534135e-05f, -2.9076231e-05f, -1.9541802e-05f, 1.5159042e-05f, -9.881797e-06f, -2.0934038e-05f, -3.2101932e-05f, -2.8751638e-05f, 3.4063287e-05f, 3.4464047e-05f, -7.03562e-05f, -6.223138e-05f, -6.4157734e-06f, 7.1186856e-05f, -8.1277634e-05f, 8.405496e-05f, -5.046405e-05f, -3.5153727e-05f, 7.98761e-06f, 2.1806547e-05f, -1.1098827e-05f, 1.3763549e-05f, -1.4824961e-05f, 1.663671e-06f, 1.6077858e-05f, 1.9144085e-05f, 2.0520569e-05f, -1.9875346e-05f, -1.8848117e-05f, -1.5332462e-05f, -9.152373e-06f, 2.304241e-05f, -2.722114e-06f, -7.681795e-06f, 1.1175342e-05f, -1.5611378e-05f, -1.2856962e-05f, -6.784043e-05f, -4.668174e-05f, 6.6654466e-05f, -2.3754674e-05f, 9.962222e-06f, -3.14855e-05f, 3.4233268e-05f, -3.4513494e-05f, 3.0122615e-05f, 1.6495684e-05f, -2.3915036e-05f, 2.5031166e-05f, -1.897183e-05f, -3.002577e-05f, 3.490544e-05f, -9.960962e-06f, 3.015918e-05f, -3.8468826e-07f, 4.9145347e-06f, 2.7660413e-05f, 2.759257e-05f, 7.243407e-05f, 7.1917675e-05f, -2.206765e-05f, -3.7112924e-05f, -8.888278e-05f, -6.115558e-05f, 3.417279e-05f, 6.8183166e-05f, -6.8844784e-06f, 6.3797033e-06f, -8.8025345e-06f, 4.0662067e-06f, -1.8574066e-05f, 5.6867298e-06f, -1.7042938e-05f, -8.40194e-06f, 1.2900613e-05f, -2.2954518e-05f, 1.07846945e-05f, -8.915222e-06f, 2.4840851e-06f, -7.124047e-06f, -2.408327e-05f, 1.193562e-05f, -2.9616514e-05f, 1.2154818e-06f, -1.3170303e-06f, -2.403212e-05f, 5.535558e-06f, 8.0310165e-05f, 1.9761655e-05f, -2.6999509e-05f, -2.9481489e-05f, -2.4196675e-05f, 4.169819e-05f, -2.9202814e-05f, 3.0365454e-05f, -4.2291493e-05f, 3.157254e-05f, -1.7099983e-06f, -4.2253316e-05f, -6.0700067e-06f, 1.6179738e-05f, -7.975633e-06f, 7.6217198e-06f, 2.1828587e-06f, 4.248926e-06f, -2.00079e-05f, 3.7891023e-05f, -6.7566834e-06f, 4.064708e-05f, -1.5302368e-05f, 0.00010157798f, -3.6465328e-05f, -8.31393e-05f, 6.6628374e-05f, 1.2574989e-05f, -1.8280876e-05f, 1.01885935e-05f, 1.5193054e-05f, -1.8095452e-05f, -2.801277e-07f, 1.1453372e-05f, 1.5520534e-05f, 1.032751e-06f, 1.2844232e-05f, -2.1283851e-05f, 1.4408662e-05f, -1.3709804e-05f, -1.2936052e-06f, 1.3711195e-05f, -6.9547223e-06f, 4.8450034e-05f, -1.2978238e-05f, 7.9998455e-05f, 4.785429e-05f, 5.6132227e-05f, 1.6186405e-05f, 2.543352e-05f, 5.297074e-05f, 2.4758578e-05f, -2.7227376e-05f, -1.3421624e-05f, -3.613654e-05f, 1.9446197e-05f, 1.2954961e-05f, 5.8924645e-05f, 4.9477185e-05f, -1.325399e-05f, 2.7720098e-06f, -9.71688e-06f, 5.5602895e-06f, -2.9548039e-05f, 3.297573e-05f, -9.543198e-06f, -2.5389412e-05f, -5.8139434e-05f, 7.586673e-05f, 4.057778e-05f, 4.8644695e-05f, 8.30153e-05f, 9.5203206e-05f, 4.486441e-05f, 2.4189208e-05f, -2.0710346e-05f, 1.2293983e-05f, -2.231636e-05f, 2.9320547e-05f, -2.0964794e-06f, -7.527048e-06f, -1.0010647e-05f, 1.853091e-05f, 8.239635e-06f, -9.812516e-06f, -1.6790261e-07f, -1.4439901e-05f, -2.2863152e-05f, -1.7270258e-05f, 1.080973e-05f, -2.2546095e-05f, 1.63878e-05f, 8.681296e-05f, -3.0281526e-05f, 2.654803e-05f, -7.461535e-05f, 5.9922408e-05f, -5.2244828e-05f, -9.57325e-05f, 2.8116348e-05f, 7.384098e-06f, 5.9767728e-05f, 2.4147961e-05f, -2.1218055e-05f, 1.875035e-05f, -6.16172e-05f, -3.1160984e-05f, -4.678947e-05f, 2.0119887e-05f, -4.4511842e-05f, 3.546196e-05f, 3.3784945e-05f, 1.4807797e-05f, -1.006351e-05f, -6.5793014e-05f, 0.000101703175f, 4.0138235e-05f, 2.737617e-05f, 3.5388527e-07f, 3.4640067e-05f, -2.628862e-05f, -2.7421793e-05f, -7.697066e-05f, -9.368868e-06f, -1.5817499e-06f, 1.8990148e-06f, 2.2290349e-05f, 3.7059986e-06f, 1.6909762e-05f, -9.45444e-06f, 1.9007908e-05f, -1.8270697e-05f, 2.7035912e-06f, -5.952949e-06f, 2.2219932e-05f, 9.337287e-06f, 1.6360247e-05f, 2.3182596e-05f, -2.456216e-05f, -5.562651e-05f, 6.931013e-05f, 4.4528497e-05f, -0.00014076378f, -2.2004508e-05f, -8.673769e-05f, 0.0001226908f, -2.3224502e-05f, -5.641772e-05f, -4.692457e-05f, 2.3147908e-05f, -2.5841515e-05f, -2.2384029e-05f, 1.2527614e-05f, 4.690624e-05f, 2.4451594e-05f, 4.41075e-05f, -5.7131427e-05f, 1.10219835e-05f, -4.176387e-05f, 6.043464e-07f, 7.2764655e-05f, 2.5335134e-05f, -7.365048e-05f, 6.653561e-05f, 0.00012105482f, 7.6277324e-06f, 6.269537e-07f, 6.505228e-05f, 7.1455547e-06f, 0.00010706799f, 1.0391973e-05f, 5.8016412e-06f, -1.9052699e-05f, -2.6810658e-05f, 1.1357683e-06f, -2.4431221e-05f, -1.4821763e-05f, -1.191876e-05f, -9.207662e-06f, -6.7063747e-06f, 1.942986e-05f, 2.2409737e-05f, -2.285715e-05f, -1.745241e-05f, -4.19675e-06f, 1.7681572e-05f, 2.1153275e-05f, 3.207151e-05f, 7.579843e-05f, 0.00012959988f, 4.778384e-05f, 6.953927e-05f, 0.00012268715f, 0.00012960793f, -3.0361782e-05f, -2.1302458e-05f, 6.502412e-05f, 4.8091806e-05f, -5.0870083e-05f, -4.53191e-05f, -2.717669e-06f, -5.5158023e-05f, -2.5569498e-05f, 1.1873931e-05f, 3.5849986e-05f, 3.517883e-05f, 5.5409837e-05f, -8.8334375e-05f, 2.8141958e-05f, 2.0578427e-05f, 9.153776e-06f, 7.076813e-05f, 0.00011781954f, 0.00011352634f, -0.00012806394f, -9.53109e-05f, -1.0003972e-05f, 0.00010579335f, -5.431663e-05f, -1.5506233e-05f, -4.128774e-06f, 6.2034756e-06f, -1.6417598e-05f, 2.5535921e-06f, -3.3537078e-06f, -8.660308e-06f, -9.570445e-06f, -2.9906125e-06f, 4.158639e-06f, 1.4498652e-05f, 2.1982967e-05f, -2.2584894e-05f, -1.5720052e-05f, 6.1578994e-06f, 9.03287e-06f, -2.858754e-05f, -4.7177615e-05f, 6.0486218e-05f, -6.0374485e-05f, 7.402919e-05f, 3.6603768e-05f, -2.4379802e-05f, -3.578893e-05f, -4.2231484e-05f, -5.9320755e-05f, 2.0650397e-08f, 6.0438015e-05f, -2.7930018e-05f, -3.4230525e-05f, -6.050139e-05f, -6.1081024e-05f, 4.0043942e-05f, -1.5078844e-05f, 9.608985e-06f, -3.3027514e-05f, -3.4094257e-05f, -3.216914e-05f, 5.3793715e-06f, 2.74597e-05f, 7.468534e-05f, -2.19311e-06f, 2.5680201e-06f, -5.6458495e-05f, 6.597616e-05f, 0.00011527915f, 0.00011278014f, -3.5722278e-05f, 4.4852195e-06f, -1.3696187e-05f, 1.9524923e-05f, 2.415526e-05f, -7.344226e-06f, -1.4074294e-05f, -1.0030317e-05f, 2.017748e-06f, -1.33005815e-05f, 2.320271e-05f, -1.203305e-05f, 1.696471e-05f, 1.0085157e-05f, -1.2835828e-05f, 6.4725346e-06f, -2.0635067e-05f, -8.930854e-05f, -2.50743e-05f, -8.091849e-05f, -5.7737703e-05f, 0.00013351235f, 0.000112016976f, -5.388907e-05f, -6.0144637e-05f, -5.0304345e-05f, 5.8431066e-05f, -1.22671045e-05f, 1.1752436e-05f, -1.0240823e-05f, 1.3136642e-05f, 1.3978108e-05f, 1.33022e-06f, 2.3940154e-05f, 1.064539e-05f, 7.3135748e-06f, 6.290084e-05f, -2.6750306e-06f, 6.16574e-05f, 4.363943e-05f, -7.250718e-05f, -7.885479e-05f, -4.092532e-05f, -5.5585133e-05f, -5.296923e-05f, -2.3446739e-05f, 2.1506667e-05f, 8.0784775e-05f, 7.675221e-05f, 1.893321e-05f, 3.2726077e-06f, 1.44335745e-05f, 1.9126202e-05f, -1.5014158e-05f, 9.813234e-06f, -2.059992e-05f, -5.249115e-06f, -1.254358e-07f, -8.745807e-06f, 5.1585766e-06f, 1.2240894e-05f, -1.6060707e-05f, 8.471958e-06f, 7.658852e-06f, 1.7871906e-05f, -9.7962775e-06f, 0.00010421168f, -4.7515157e-05f, -0.00015037948f, 1.2119289e-05f, -6.64559e-05f, 9.169201e-05f, -8.7979286e-05f, -1.5125705e-05f, 4.5325487e-05f, -5.653833e-05f, 8.0123114e-05f, 5.494003e-05f, 1.9365061e-05f, -6.853651e-05f, 3.6648984e-05f, -2.589114e-05f, -4.7927693e-05f, -4.593103e-06f, -3.426041e-05f, -6.9086127e-06f, -7.091044e-05f, 7.355945e-05f, 6.673356e-05f, -8.877775e-05f, -1.9319465e-05f, -3.383962e-05f, -1.7820445e-05f, -5.1827858e-05f, 6.3113286e-05f, -9.8129676e-05f, 2.0469564e-05f, -4.7941057e-06f, -7.1200325e-06f, 1.72177e-05f, -1.1851888e-05f, 7.5580256e-06f, 1.6254295e-05f, 8.278276e-06f, -7.838485e-07f, -1.7533815e-05f, 1.6330165e-05f, -1.951786e-05f, 1.5255779e-05f, 9.810407e-06f, -1.7194523e-05f, 6.6906614e-06f, -2.4409337e-06f, -6.156006e-05f, -0.00010717182f, 0.0001362807f, -0.00011258439f, 9.605459e-05f, 1.9231376e-05f, 2.4443381e-05f, -1.2920977e-05f, 3.7632366e-05f, 5.0179915e-06f, 3.3894365e-05f, 4.9346636e-05f, 4.921754e-05f, -2.7010305e-05f, 3.863582e-05f, 1.7052807e-05f, 2.7488677e-05f, 8.054502e-05f, 1.965202e-05f, -5.474006e-05f, 5.4096086e-05f, 4.9602546e-05f, 3.8901555e-05f, -6.0213813e-05f, 5.7241876e-05f, 7.162835e-06f, -4.198091e-05f, -6.850076e-05f, -7.1506736e-05f, 2.5841042e-05f, 4.960476e-05f, 8.805566e-05f, 1.2726259e-05f, 9.16178e-06f, 1.2265232e-06f, 1.593571e-05f, 1.718463e-05f, -2.2468814e-05f, -1.428497e-05f, 1.3597089e-05f, -7.980079e-06f, -3.0196961e-06f, -1.2374635e-05f, 1.094983e-06f, 1.766214e-05f, 2.076598e-05f, -1.5965783e-05f, -2.3298366e-05f, -2.6620113e-05f, -7.133237e-05f, 1.1726457e-05f, 1.910877e-05f, 5.5236997e-06f, 0.00010443025f, 0.00010420216f, 3.615951e-05f, 3.7402835e-05f, 2.6004149e-05f, -3.390372e-05f, -2.9932158e-05f, 3.36424e-05f, 4.9396516e-05f, -7.442549e-05f, 3.0588428e-05f, -4.8299935e-05f, -5.045039e-05f, -7.3756855e-05f, -2.9680728e-05f, -1.4563e-05f, 5.5719134e-05f, -3.947464e-05f, 1.0250281e-05f, -1.41460605e-05f, 9.074232e-05f, -7.0251226e-05f, 8.446352e-05f, 6.166093e-05f, -7.29833e-05f, 4.927664e-06f, 3.7787588e-05f, 6.081423e-06f, 9.687532e-06f, -2.1810181e-05f, 4.637618e-06f, 4.371174e-08f, -9.338058e-06f, -1.7565091e-05f, -9.132459e-06f, -5.472697e-06f, -1.022733e-05f, -1.6790184e-05f, 1.2951504e-05f, -5.82199e-06f, 1.1790957e-05f, 1.8418445e-05f, -1.7653232e-05f, 5.2379197e-05f, 7.630049e-05f, 0.0001301048f, 1.9314086e-05f, 9.826052e-05f, 5.743585e-05f, -3.9756138e-05f, 7.6726414e-05f, 6.448468e-05f, -4.3423577e-05f, 2.9538396e-05f, 6.646323e-05f, 1.8681398e-05f, -7.730919e-06f, 8.567828e-06f, -4.696112e-07f, 3.643774e-05f, 1.1036089e-05f, 6.319812e-05f, -3.8201124e-05f, 5.2175707e-05f, -5.06989e-05f, -4.505809e-05f, 3.7272992e-05f, 6.8796624e-05f, 9.062291e-05f, -6.790032e-05f, -8.0356855e-05f, 3.436792e-05f, -4.714385e-05f, -3.8444945e-05f, -8.105975e-05f, 8.753301e-06f, -5.2861797e-06f, -1.6934142e-05f, -3.9851343e-06f, 1.4426514e-05f, 1.7014392e-05f, -1.1577116e-05f, 1.4727176e-05f, 1.1232364e-05f, -7.108685e-06f, -5.2994715e-06f, -9.245199e-06f, 8.582083e-06f, -1.2673883e-05f, 1.4698167e-05f, 4.538973e-06f, -6.5865834e-06f, -0.0001246795f, 3.446172e-05f, 9.151262e-05f, 8.613055e-05f, -5.029639e-05f, -7.186406e-05f, 5.144067e-05f, -4.2441163e-05f, -1.2803847e-05f, -6.311418e-05f, -1.2580873e-05f, -2.0464662e-05f, -1.1006893e-05f, 5.5658064e-05f, -3.5924462e-05f, 4.2115236e-05f, -1.3832256e-05f, -5.4984197e-05f, -4.2026415e-05f, 5.36173e-05f, -4.6234218e-05f, -4.427889e-05f, 5.4668104e-05f, -4.334092e-05f, -4.894496e-05f, -1.6127813e-05f, -6.0005692e-05f, 1.5360886e-06f, 5.8098976e-05f, -4.0105755e-05f, -9.023851e-05f, 4.7520475e-06f, -1.2947485e-05f, -2.3211705e-05f, -1.6893331e-05f, -5.9351464e-07f, 1.6339121e-05f, 7.086364e-06f, 1.1532046e-05f, -1.6599131e-05f, 1.2170175e-05f, 8.3676305e-06f, -1.0579623e-05f, 1.4978112e-05f, 1.1672115e-05f, -8.551297e-06f, 6.5350705e-06f, -7.5257514e-05f, -2.550283e-05f, -6.406311e-06f, -6.609797e-05f, -6.342205e-05f, -0.00011144898f, -9.29903e-05f, -5.932334e-05f, 1.2748175e-05f, -7.102338e-05f, -1.8226838e-05f, 4.347777e-05f, -2.6371927e-05f, 5.730002e-05f, 2.016855e-05f, -2.0623302e-05f, 1.8405048e-05f, -3.095953e-05f, -5.8986687e-05f, -1.0913961e-05f, 1.0383865e-05f, -6.9734e-08f, 2.2996262e-05f, 4.4296452e-05f, 0.000107564694f, 3.422963e-05f, 6.8011606e-05f, 8.258504e-05f, -3.009166e-05f, -1.3733243e-05f, -8.9636116e-05f, -7.936824e-05f, 9.69589e-06f, -1.2638992e-05f, -1.6025137e-05f, -3.6953106e-06f, 1.1528537e-05f, -7.6360254e-07f, -1.835889e-05f, 8.6461284e-07f, 1.7698376e-05f, 9.572072e-06f, -1.7715738e-05f, 5.0461454e-06f, -9.498551e-06f, 2.2644637e-05f, -2.0592912e-05f, 2.4654134e-06f, -8.1227765e-05f, 4.805372e-05f, -2.3566288e-05f, 1.0488069e-05f, 3.3218857e-05f, -3.7308728e-05f, 1.1961895e-05f, 1.7681936e-05f, -2.5083846e-05f, 4.5499724e-05f, -5.630792e-06f, -3.972206e-05f, -2.4406958e-05f, -3.796244e-05f, -5.991373e-05f, 3.888908e-06f, -3.88776e-05f, 3.5718138e-05f, -1.4143369e-05f, 5.7813926e-05f, -2.2530241e-05f, -2.4164816e-05f, -1.6978604e-05f, 1.422241e-05f, -1.3276442e-05f, -4.424386e-05f, 8.629121e-05f, -9.017021e-06f, 3.3685887e-05f, 8.525296e-05f, 4.5682915e-05f, -2.7785874e-05f, 1.639246e-05f, -9.924372e-06f, -2.1630603e-06f, -7.3651713e-06f, -9.018061e-06f, -1.5618856e-05f, 2.1720685e-05f, 5.4666434e-06f, -8.883375e-06f, 1.429744e-05f, -9.755552e-06f, -1.586591e-06f, -4.1696517e-06f, 5.3518133e-06f, 2.0157508e-05f, -1.32873265e-05f, 4.138514e-05f, -3.6571553e-05f, 5.517833e-06f, -7.19418e-05f, -4.3644675e-05f, -2.7070737e-05f, 4.847127e-05f, -4.767133e-06f, -4.4647997e-05f, 2.6284042e-05f, -6.26105e-05f, 5.0427034e-06f, -5.6588106e-05f, 3.337558e-05f, 5.2839183e-05f, -5.4118405e-05f, 3.594245e-05f, -1.7168015e-05f, -4.4595075e-05f, 3.2509437e-05f, -7.963459e-06f, 8.907365e-06f, -4.5283752e-05f, 4.94864e-05f, -2.2523616e-05f, 1.5801908e-05f, 5.7973593e-05f, -0.00011998611f, 6.364078e-05f, -9.454386e-06f, 4.134394e-05f, -1.7557171e-05f, -7.865084e-06f, -1.385755e-05f, 1.5075755e-05f, 1.9405288e-05f, -3.747441e-06f, -7.945562e-06f, 1.9662379e-05f, -9.518535e-06f, 1.5608739e-05f, 1.7449272e-05f, -6.4024634e-06f, 1.4041153e-05f, 1.7120461e-05f, 3.2995777e-06f, -1.7823327e-06f, -2.2193663e-05f, 2.0099958e-06f, 5.514682e-05f, -2.4585332e-05f, -4.017474e-05f, -4.388129e-06f, -3.0426909e-05f, -6.2471365e-05f, -5.5732885e-06f, -5.4973527e-05f, -1.5038187e-05f, 4.6565874e-05f, 1.4533324e-06f, -5.377532e-05f, 5.8442943e-06f, 5.749111e-05f, 4.9952494e-05f, 2.104729e-05f, -1.5453152e-05f, 3.746863e-05f, 2.2379292e-05f, -3.7946105e-05f, -4.3396456e-05f, 4.4447723e-05f, -1.939849e-05f, 4.2375857e-05f, 9.263888e-05f, -3.2105665e-05f, -6.44785e-05f, 9.224039e-05f, 8.3630955e-05f, -6.5812084e-05f, 3.6000006e-06f, -1.5843108e-05f, -1.9195715e-05f, -1.7122411e-05f, -6.979616e-06f, 1.8497974e-06f, 2.7161639e-06f, -1.06665975e-05f, 1.9557974e-06f, -1.2426437e-05f, -1.1212547e-05f, 1.6222608e-05f, -5.4125653e-06f, -1.6027305e-05f, 2.2929182e-05f, -8.527197e-06f, -1.7593335e-05f, 3.946681e-05f, -2.1934411e-05f, -5.6908924e-05f, -6.6745943e-06f, -4.731999e-05f, -3.7364225e-05f, 6.474177e-05f, -2.8894501e-05f, -1.8131952e-05f, -3.4405497e-05f, -4.4928685e-05f, 5.494462e-05f, 7.109816e-05f, -3.1248477e-05f, 1.9568082e-05f, -1.2838898e-05f, -3.6067197e-06f, 3.5664136e-05f, 1.3132235e-05f, 3.614713e-05f, -2.2227903e-05f, 1.904678e-05f, 3.4980036e-05f, -1.3081215e-05f, -5.186474e-05f, -4.467522e-05f, -2.0255635e-05f, 4.8091508e-05f, -0.00010001255f, -7.586095e-05f, 1.390724e-05f, -3.4879013e-05f, 2.0147387e-05f, -1.8025721e-05f, 1.5580652e-05f, -1.6450019e-06f, -3.3422016e-06f, -5.145129e-06f, -1.5703927e-05f, -8.480889e-06f, 1.3288018e-05f, 9.496493e-06f, 1.0175269e-05f, 3.0782453e-06f, -1.4738007e-05f, 1.5120312e-05f, 2.1760486e-06f, -1.696794e-05f, -5.7859743e-05f, 5.798696e-05f, -1.8450988e-05f, 3.2539832e-05f, -8.554159e-06f, -4.8821243e-05f, -5.6636625e-05f, -4.0354447e-05f, -1.1678412e-05f, 7.233467e-06f, 3.3748085e-05f, 4.378066e-05f, 4.752069e-05f, -4.9067516e-05f, 3.5963083e-05f, -4.5942106e-05f, -3.3457898e-05f, -1.7031489e-05f, -3.0586365e-05f, 1.4862294e-05f, -2.3410325e-05f, -3.4439658e-05f, -1.4980679e-05f, 1.8436163e-05f, 6.651319e-05f, 1.5925756e-05f, 7.57264e-05f, -3.7042355e-05f, 5.893943e-05f, -2.169859e-06f, -9.709979e-05f, -1.5542246e-06f, 1.2693246e-05f, 7.2190537e-06f, -6.638326e-06f, -1.4346414e-05f, -1.4705158e-05f, 1.09294215e-05f, -1.0001105e-05f, 2.4096977e-05f, -1.9080344e-05f, -1.17039135e-05f, -1.459907e-05f, -1.7175125e-06f, 8.045774e-06f, 1.605806e-05f, -1.4638104e-05f, 8.504375e-06f, 1.7496894e-05f, -4.461382e-05f, -4.4697863e-05f, -6.9087735e-05f, -3.246308e-05f, 3.7094864e-07f, 5.1788633e-05f, 4.84827e-05f, 9.765268e-06f, 4.1676645e-05f, 2.6346055e-05f, 2.939248e-05f, 6.113259e-05f, 7.840143e-06f, 7.356773e-06f, 1.9096698e-05f, -2.3963728e-05f, 3.54575e-05f, -2.744142e-05f, -2.5495806e-06f, 1.6629741e-05f, -1.7975895e-05f, -1.9307778e-05f, -3.1216211e-06f, -3.9903938e-05f, -4.8497484e-05f, 6.3116204e-05f, -8.2596685e-05f, 8.4340114e-05f, 3.756824e-05f, 9.374192e-05f, 9.287131e-05f, 9.121091e-06f, 1.5629814e-05f, -4.869545e-06f, -1.768854e-05f, -1.1747139e-05f, 1.1708122e-05f, 1.8502524e-05f, -4.0147515e-06f, -4.4124026e-06f, -4.490233e-09f, 1.5431862e-05f, 8.864576e-06f, -4.7442522e-06f, 2.2652584e-05f, 4.165012e-06f, -9.317661e-06f, 5.5521978e-05f, -5.705037e-05f, -5.112707e-05f, -2.1667063e-05f, 4.1809868e-05f, -4.3996635e-05f, -2.1966951e-05f, -3.2859425e-05f, 3.1393754e-06f, 1.1423886e-05f, -4.448787e-05f, -7.140071e-06f, 4.8221966e-05f, 4.8204306e-06f, 4.9022903e-05f, -1.9532372e-05f, -1.6889168e-06f, 3.1917072e-05f, -1.0980986e-05f, -8.403634e-06f, 4.5671613e-06f, 2.8197754e-05f, 1.7099259e-05f, 2.8860786e-05f, -3.3294175e-05f, -0.00011607086f, 6.739434e-05f, -7.625586e-05f, 2.717083e-05f, -8.435776e-05f, 6.323961e-05f, -8.019861e-05f, 2.0960013e-05f, -1.7522076e-05f, 1.2995289e-05f, 1.6449889e-05f, 1.6777109e-05f, 9.932765e-06f, -6.4245664e-06f, -9.267968e-06f, 1.7182716e-05f, -1.7513037e-05f, -1.5160034e-05f, 1.083883e-05f, -5.290933e-06f, 1.6383296e-05f, -3.51256e-06f, 7.0182564e-06f, -4.893606e-05f, -4.0760468e-05f, 3.9823095e-05f, -2.7288064e-05f, -1.3783318e-05f, -4.0860803e-05f, -1.839096e-05f, -2.6899253e-05f, 1.5530997e-05f, 4.595946e-06f, -3.5970108e-05f, -1.8447625e-05f, 4.7289283e-05f, -4.2015443e-05f, -4.655837e-05f, -2.610519e-05f, 1.073888e-05f, 7.200112e-06f, 1.1213907e-05f, -2.0877438e-05f, -8.696499e-06f, -2.2680098e-05f, -1.646807e-05f, -1.5899328e-05f, -7.906372e-06f, -9.55377e-05f, -1.803689e-05f, 5.573916e-05f, 0.00010767596f, 9.112001e-05f, -8.079714e-05f, -4.5936526e-05f, -5.107753e-06f, -6.2163726e-06f, -2.453406e-05f, 1.8645496e-05f, 3.9346137e-06f, 9.762279e-06f, -2.9430367e-07f, 2.1061276e-05f, 7.229042e-06f, 8.436713e-06f, 6.4759674e-06f, 7.48236e-06f, 4.279966e-06f, 7.4150526e-06f, 9.399453e-07f, 8.934318e-06f, -6.411358e-05f, 4.2719617e-05f, -1.903338e-05f, 1.2274637e-05f, -4.8141035e-05f, -2.4899722e-05f, -5.556748e-05f, 3.3200053e-05f, -3.20758e-05f, -4.25183e-06f, 1.9118137e-05f, 1.7814999e-05f, -2.6322243e-05f, -2.402563e-06f, -4.6152345e-06f, -2.3076684e-05f, -1.7218992e-05f, 3.3508284e-05f, -1.3223493e-05f, -1.5811094e-05f, 1.856211e-05f, -2.948544e-05f, -2.6840546e-05f, -9.12643e-06f, -1.2443429e-05f, -9.296507e-05f, 6.134252e-06f, -8.9096204e-05f, 2.5032628e-05f, 6.5755594e-05f, 8.536123e-05f, -5.5829143e-05f, -8.350427e-06f, 3.3483868e-06f, 8.918516e-06f, 5.882657e-06f, 8.8016295e-06f, -1.736336e-05f, 4.73377e-06f, 1.9466854e-05f, -1.0775897e-05f, -1.1260645e-05f, 1.3600542e-05f, -6.1827504e-06f, 1.0548503e-06f, -1.2683421e-05f, -1.6205551e-05f, -8.269819e-06f, -4.907891e-05f, -4.13189e-05f, -1.9160152e-05f, -7.850858e-06f, 3.406664e-05f, -1.0818964e-05f, 4.4443812e-05f, -2.0848302e-05f, 3.920322e-05f, -2.8905154e-06f, -2.8427108e-05f, 1.4135007e-05f, -3.2419208e-05f, 2.0081348e-05f, -1.9909755e-06f, -2.900376e-05f, -1.8940453e-05f, -5.0690132e-06f, -2.5827261e-05f, -3.6547185e-06f, -5.067759e-06f, 1.9562165e-05f, 2.7174778e-05f, -8.143717e-06f, 1.7388453e-05f, -5.842751e-05f, 0.00011004457f, -2.7102858e-05f, -3.0830863e-05f, 6.454538e-05f, 1.3977884e-05f, -4.597161e-05f, 1.5176871e-05f, -1.9711139e-05f, 1.0355934e-05f, 2.4433795e-05f, -3.0577992e-06f, 7.09295e-07f, 9.050377e-06f, -7.764113e-06f, 5.432897e-06f, -1.3110005e-05f, 1.2722528e-05f, 1.126538e-07f, -1.9135578e-05f, 6.6018156e-06f, -1.1842055e-05f, -5.3823e-06f, 2.3690474e-05f, -6.747755e-06f, -4.7577112e-05f, -5.3089225e-05f, 6.590275e-05f, -6.256004e-05f, 2.9509969e-05f, 4.6958066e-05f, -2.5175814e-05f, -4.2269938e-05f, 1.8208919e-05f, 1.1289064e-05f, 9.010151e-06f, -2.6239e-05f, -1.6050573e-05f, 1.5599358e-05f, -5.175773e-06f, -2.0413729e-05f, -1.2290337e-06f, -8.668752e-06f, 6.5567674e-06f, -6.669904e-06f, 2.1713435e-05f, 1.947982e-05f, -3.1356674e-05f, -1.1067867e-05f, -3.6927986e-06f, -2.9011688e-05f, 6.339778e-05f, 0.000105943414f, 1.9758105e-05f, 8.064348e-05f, -2.045288e-05f, 1.6592352e-06f, -2.3828185e-05f, 3.803697e-06f, 1.6150825e-06f, 3.5725182e-06f, 1.9953843e-05f, -6.397837e-06f, -4.604197e-06f, -3.9363463e-06f, -1.552313e-06f, -2.4361243e-06f, -1.6780043e-05f, -1.0334646e-05f, -1.8164797e-05f, -3.2522173e-06f, -5.5963587e-06f, 6.450229e-05f, 4.546031e-05f, -9.579195e-06f, 2.4207056e-05f, -2.8895016e-05f, -1.8596222e-05f, -4.930984e-05f, 2.362724e-06f, 1.6697531e-05f, 4.212661e-05f, 1.2719935e-05f, 7.778163e-06f, -1.5977748e-05f, -3.6410212e-05f, -8.791129e-07f, 1.6671272e-06f, -5.3459996e-07f, 2.2599294e-05f, 2.7050464e-05f, 1.0686697e-05f, 3.0756435e-06f, -1.3327592e-05f, -2.4892624e-05f, -9.3407856e-05f, -9.0724556e-05f, 7.754427e-05f, -2.4776495e-05f, -6.6293054e-05f, -5.303092e-05f, 1.4220454e-05f, -4.7720267e-05f, 7.1868017e-06f, -1.0651286e-05f, -1.3667611e-05f, -1.0639094e-05f, 1.0458476e-05f, -5.142428e-06f, -8.6951895e-06f, 2.2484945e-05f, 8.748157e-06f, 1.4104433e-05f, 1.5536493e-07f, 1.807964e-05f, -1.3628315e-05f, 4.0159543e-06f, 1.6364089e-05f, 6.7759156e-06f, 3.2101507e-05f, -7.05485e-06f, -6.976098e-06f, -7.261872e-06f, -4.863521e-05f, -3.896604e-05f, 4.6704e-05f, 2.4497183e-05f, 4.0400646e-06f, -3.0511326e-05f, -1.14184795e-05f, 1.885282e-05f, 5.8157825e-06f, -2.887685e-06f, 3.7359066e-05f, -5.39655e-07f, 5.04786e-06f, 2.474e-05f, -2.3238648e-05f, -7.4028203e-06f, -1.6934062e-05f, -3.2467553e-06f, 5.442076e-06f, 1.600207e-05f, -2.5870586e-05f, 6.8163486e-06f, -9.591721e-06f, -4.851307e-05f, -3.6408455e-05f, -2.0860061e-05f, 7.5974815e-05f, 7.8040066e-05f, 1.3192313e-06f, 5.302437e-06f, -2.0188601e-05f, -6.100689e-06f, -1.2033089e-06f, 1.413916e-05f, 4.272116e-07f, 6.5936943e-06f, 1.7612949e-05f, 5.971941e-06f, -7.964634e-06f, -1.1666668e-05f, -2.9462744e-06f, 2.155864e-06f, 1.1495821e-05f, -7.1277293e-07f, -2.67211e-05f, 4.936499e-05f, 1.8296872e-05f, -5.9949412e-05f, 2.8527476e-05f, -3.586658e-05f, 5.6278677e-05f, -4.5797206e-05f, -3.6366253e-06f, -4.0784114e-05f, -1.1355413e-05f, 7.141755e-06f, -8.481462e-06f, -8.055262e-06f, 2.8800618e-05f, -1.3269833e-05f, -2.5234405e-05f, -7.114753e-06f, 3.4611553e-06f, 8.5348944e-07f, 6.4744954e-06f, -2.689166e-05f, 2.1184685e-05f, -1.994238e-05f, -3.4855067e-05f, -5.7917023e-05f, 4.1023264e-05f, -1.8199435e-06f, 1.1528977e-05f, -4.6871297e-05f, -6.0894567e-05f, -3.464796e-06f, -1.8120729e-05f, -9.467924e-06f, 3.7111893e-06f, 1.8355706e-05f, -1.0566921e-05f, 4.0933046e-06f, -7.987476e-08f, -1.6821048e-05f, 1.9079942e-05f, 7.150971e-06f, -1.3130268e-05f, 3.7179655e-06f, 3.5028638e-06f, 9.63691e-06f, 5.63509e-06f, -1.533412e-05f, -1.617304e-05f, 3.388687e-05f, 2.4135548e-05f, -3.097025e-05f, 5.2484582e-05f, -3.992076e-05f, -7.0528918e-06f, 9.625556e-06f, -2.0908203e-05f, 2.1288364e-05f, -1.9489664e-05f, 1.1032058e-05f, -2.488797e-05f, 2.7451037e-05f, 1.3596594e-05f, -2.2563654e-06f, -2.1608208e-05f, 1.2062844e-05f, -1.0584001e-05f, -1.2873521e-05f, -2.0376068e-05f, -2.7815493e-05f, 1.6155644e-05f, 1.5403404e-05f, -1.1341693e-05f, 2.7243577e-05f, 6.049556e-06f, 7.063498e-05f, -7.17765e-05f, -4.9794682e-05f, -6.67597e-05f, -6.646477e-05f, 1.0282649e-05f, -4.7670183e-06f, -3.0222245e-06f, 1.9824996e-05f, 3.5263295e-06f, -9.515666e-07f, -1.7190747e-05f, -1.127227e-05f, -1.9852463e-05f, 4.5248994e-06f, -1.603566e-05f, 1.4144068e-05f, -2.9287928e-06f, 1.2344217e-05f, -4.7589265e-06f, 6.7903547e-06f, -3.776201e-05f, 6.2226405e-05f, 1.832327e-05f, -4.0896716e-06f, 4.1526073e-05f, 5.8419195e-05f, -2.7043377e-05f, 2.672122e-05f, 1.8759043e-05f, 5.916157e-06f, 2.4155748e-05f, 5.7681923e-06f, -4.3462574e-06f, -1.8875875e-05f, -2.8452334e-05f, -9.522589e-06f, 2.4755564e-05f, -7.172081e-06f, -2.5060417e-05f, 3.2813214e-06f, -2.6381183e-05f, -2.743178e-05f, 4.674169e-06f, -1.2187145e-05f, 9.9525515e-08f, -7.143922e-05f, -1.6204476e-05f, 1.3594803e-05f, -5.588645e-05f, -2.3581806e-05f, 2.5325417e-05f, 5.1115923e-05f, -1.0938751e-05f, 1.3165161e-05f, -2.3498931e-05f, -1.027712e-05f, 1.0590855e-05f, -9.53311e-07f, 7.184535e-06f, -4.6292556e-07f, 1.6735474e-05f, -5.976233e-07f, 2.8175275e-06f, 1.8860757e-05f, -4.7137846e-06f, -1.14616005e-05f, -3.424815e-06f, -7.2153066e-06f, 4.9906437e-05f, 8.703557e-06f, 2.4073239e-05f, 2.1749887e-05f, -2.8635513e-05f, 5.59799e-05f, 5.883175e-05f, 3.4183864e-05f, 1.9061516e-05f, 2.0554053e-05f, -1.1407038e-06f, 8.606734e-06f, -2.2526061e-05f, -1.5547854e-05f, 1.0364901e-05f, -1.958676e-05f, 8.3422265e-06f, -2.4223584e-05f, 1.3634502e-05f, -1.9872301e-05f, -8.391036e-06f, -4.889526e-06f, 1.940394e-06f, -9.67263e-06f, 5.767537e-06f, -4.1234307e-05f, 3.773136e-05f, 6.8458685e-06f, 9.04291e-05f, 7.568136e-05f, 1.1249442e-05f, -2.2729622e-05f, 1.0134258e-05f, 2.317076e-05f, -5.0168474e-06f, -5.7088337e-06f, -9.196949e-06f, -1.9490486e-05f, -1.0933853e-06f, 7.799312e-06f, 1.1604178e-05f, 1.5647583e-05f, 8.640299e-06f, -2.0778456e-05f, 1.5261277e-05f, -4.549257e-06f, -2.0886431e-05f, 4.010741e-06f, -2.0098618e-05f, 4.916884e-05f, 4.687257e-05f, -4.374482e-05f, -3.5462755e-05f, -1.6694072e-05f, 2.169607e-06f, -4.2498963e-05f, -1.9108678e-05f, 1.7361344e-05f, 2.7574652e-06f, -2.9813133e-05f, -1.2798952e-05f, 8.328389e-06f, 2.6232396e-05f, -2.1288284e-05f, -5.8878203e-07f, 5.435335e-06f, 3.3178733e-06f, 6.5102167e-06f, 6.2846307e-06f, 3.9037664e-06f, 5.7964303e-06f, -1.5314372e-05f, 4.1654424e-05f, -8.780922e-05f, -1.5911015e-05f, -6.345401e-05f, 1.4042271e-05f, 6.321963e-05f, -7.188553e-05f, 7.2882794e-05f, 1.2135796e-05f, -9.079337e-06f, 4.5457837e-06f, -2.2859654e-06f, -9.4698555e-07f, 1.5791527e-05f, -8.983817e-06f, -5.711434e-06f, 1.2846424e-05f, -3.7059112e-06f, -2.711788e-06f, 1.3094495e-05f, 1.26500345e-05f, -7.316499e-06f, 1.2733414e-05f, -1.5497342e-05f, 3.402984e-05f, 3.0669e-05f, -1.1590716e-06f, 3.2150474e-05f, 5.2860163e-05f, 4.4646535e-05f, -1.994012e-05f, 3.1204767e-05f, 1.9166038e-05f, 7.440647e-06f, 2.8737235e-05f, -3.3286993e-05f, 1.3679367e-05f, -2.9443221e-05f, -1.088091e-05f, 2.791425e-05f, -9.833837e-06f, 1.5761863e-05f, -6.389938e-06f, 2.2907514e-05f, 5.434305e-06f, -2.6920656e-05f, -1.7449416e-05f, -2.0699343e-05f, 6.0106326e-05f, 5.246082e-05f, -5.5411052e-05f, 2.3972307e-06f, 9.399058e-05f, -5.42436e-05f, -1.5537671e-05f, 3.26615e-05f, 3.0295965e-07f, 1.0322268e-05f, 1.1984177e-05f, -1.562864e-05f, 1.26966315e-05f, -1.5608248e-05f, 1.1178504e-05f, 5.03608e-06f, 1.4238382e-05f, 8.798568e-07f, -1.7351345e-05f, 1.1454696e-06f, -2.4442435e-05f, -3.2904265e-07f, -1.3473259e-05f, 1.34851525e-05f, -4.888195e-05f, -5.9483536e-06f, -8.347004e-06f, -1.9357285e-05f, 3.6431476e-05f, -3.4211913e-05f, -3.3926775e-05f, -3.1971336e-05f, -1.7379934e-05f, 3.144015e-06f, -2.5244566e-05f, 8.774265e-06f, -2.7200427e-05f, 6.966552e-06f, -1.5033554e-05f, 8.088631e-06f, -2.0753117e-05f, 1.1647431e-05f, -1.7211494e-05f, -1.4426405e-05f, 9.453505e-08f, -1.1193357e-05f, -1.1384465e-05f, -1.3708856e-07f, -3.262469e-05f, -2.7999986e-05f, -1.5778956e-05f, 4.0381463e-05f, -3.562533e-05f, -3.669723e-07f, 4.7007445e-05f, 3.6451445e-05f, 3.760673e-06f, 1.9917214e-05f, -1.3941557e-05f, 1.1454264e-06f, 1.3592762e-05f, 5.682225e-06f, 1.8444522e-06f, 7.78607e-06f, 1.1541778e-05f, 1.9348001e-05f, -4.0301425e-06f, 2.1384758e-05f, 1.313369e-05f, 1.9566987e-05f, -5.937024e-06f, 1.8768778e-05f, 1.9423334e-05f, -1.006582e-05f, -2.8773727e-06f, 3.5867226e-05f, -6.9140497e-06f, -2.5009547e-05f, 4.4862517e-07f, 8.155958e-06f, 2.3444996e-05f, -3.1293715e-05f, 5.833596e-06f, -8.561117e-06f, 6.2482545e-06f, 1.598486e-05f, -1.3279404e-06f, -1.3057603e-05f, 1.1028411e-05f, -2.0986407e-05f, 1.972525e-05f, -9.914075e-06f, -1.6552656e-05f, 4.9994526e-07f, -4.695771e-06f, 1.7317381e-08f, 2.2109562e-05f, 5.001862e-05f, 3.2069285e-05f, 4.3013235e-05f, -4.7375266e-05f, -3.8825718e-05f, 6.2988925e-05f, -3.540077e-05f, 1.243864e-05f, 7.13799e-06f, -2.2041197e-05f, 1.2615591e-05f, -1.1617252e-06f, 9.124544e-06f, -3.00028e-06f, 8.567167e-06f, -4.0450245e-06f, 1.5008865e-05f, -2.246094e-05f, -5.909857e-06f, -4.8912248e-06f, -1.3341133e-05f, -3.6704137e-06f, 1.7064509e-05f, -3.325799e-05f, 4.0070772e-05f, 2.8160428e-05f, 6.6055713e-06f, 9.548323e-06f, 2.9469316e-05f, -1.3285756e-05f, 6.348468e-06f, -4.8086636e-06f, -1.4437648e-05f, -1.1404132e-05f, -5.0992485e-06f, 1.4684381e-05f, 1.3579771e-05f, 1.718724e-05f, 2.3461595e-05f, -1.4300321e-05f, -6.527183e-06f, 3.8203684e-06f, 8.626088e-06f, 1.749549e-05f, 6.581774e-06f, 5.8718465e-06f, 1.2996564e-05f, -5.8642694e-05f, -4.6558504e-05f, 2.7990462e-05f, -2.8463593e-05f, 5.208482e-05f, 1.92013e-05f, 5.2236897e-05f, -7.264275e-05f, 1.0581532e-05f, 1.1301301e-05f, 1.2647123e-05f, 1.085809e-05f, -1.7897924e-05f, 3.6430092e-06f, -2.9306332e-06f, -7.5192143e-06f, -2.1054213e-05f, -1.7471393e-05f, 2.3288456e-05f, -5.635003e-06f, 2.2344895e-07f, -1.3500554e-07f, -1.587744e-05f, -2.0331883e-05f, 2.2998298e-05f, -1.4974462e-05f, -1.842495e-05f, 1.2482184e-05f, 2.0512387e-05f, 1.8347715e-05f, -9.823131e-06f, -4.1634157e-06f, -2.1493377e-05f, -1.4098568e-05f, 2.7625341e-05f, 8.664114e-06f, 2.188884e-05f, 2.0944196e-06f, -1.0372223e-05f, 2.6347423e-05f, -1.9764128e-05f, 7.621037e-06f, -1.5156336e-05f, -1.3229521e-05f, -1.199153e-05f, -2.497525e-05f, 9.222628e-06f, -5.133155e-06f, -2.6392785e-05f, -1.1408509e-05f, 3.5360357e-05f, 3.0068659e-05f, -4.571381e-06f, 5.160303e-05f, 3.1429514e-05f, 8.751712e-06f, 1.2201241e-05f, -2.0348964e-06f, -7.366154e-06f, 4.5794595e-06f, -8.673664e-06f, -1.058154e-05f, -1.101956e-05f, 1.006195e-05f, -1.5576572e-05f, 3.3910314e-06f, 2.1460875e-05f, 8.528338e-06f, -1.2040334e-05f, -6.3636135e-06f, 8.627331e-06f, -2.2672282e-05f, -2.0137282e-05f, -9.466742e-06f, -3.197664e-05f, -9.880874e-06f, -2.0774161e-05f, 1.1318275e-05f, -7.530372e-06f, 5.1778597e-06f, -2.3862465e-05f, 1.5456848e-05f, -1.8361758e-05f, -2.292258e-05f, -1.654109e-05f, -2.0760113e-05f, 1.6355938e-05f, 1.8284349e-05f, 1.3577337e-05f, -1.9973195e-05f, 1.1602765e-06f, 5.9292133e-06f, -6.093363e-06f, -1.5805661e-05f, -1.6438842e-07f, 1.8776122e-05f, -2.6633224e-05f, 3.8070182e-05f, 4.9841252e-05f, 2.7445945e-05f, 2.9380266e-05f, 7.876125e-05f, -7.451034e-05f, -6.274615e-05f, -1.310621e-05f, 1.0215915e-06f, -1.8058261e-05f, -3.5156977e-06f, -6.486415e-06f, 1.29844875e-05f, 8.198421e-06f, 1.6462642e-05f, -1.622105e-05f, -1.7675226e-05f, 8.402731e-06f, 7.486182e-06f, 1.9500569e-05f, 1.7085129e-05f, -4.5357015e-06f, 2.523223e-06f, 3.501598e-05f, -2.3001025e-05f, 3.288532e-06f, -1.6061791e-05f, 1.33056365e-05f, -1.7294084e-05f, 3.3460823e-05f, -1.0329662e-05f, 2.5768975e-05f, -1.4225095e-05f, -1.867233e-05f, -2.7885858e-07f, -2.3603496e-05f, -4.0816144e-06f, 1.7942106e-05f, -1.6095431e-06f, 7.162555e-06f, -2.2098888e-05f, -2.5315614e-05f, 2.1979602e-05f, 1.8378953e-05f, 1.6254817e-05f, -9.714052e-06f, 1.4366907e-05f, 5.588587e-05f, -1.15396015e-05f, -2.6110636e-05f, -1.5971018e-06f, 6.9305555e-05f, 3.4686003e-05f, 6.2213796e-05f, -1.8066887e-05f, -1.7221111e-05f, -7.4623304e-06f, 9.296921e-06f, -1.5969581e-05f, 8.555492e-06f, -1.7943164e-05f, 1.3401074e-05f, 1.132626e-05f, 1.6382526e-06f, -1.5717043e-06f, 1.1863345e-05f, -1.5289916e-05f, -6.083196e-06f, 2.016782e-05f, -1.7442524e-05f, 1.7797536e-05f, 7.330854e-06f, 5.0208682e-06f, 2.1022543e-05f, 2.5743739e-05f, -3.0691055e-05f, 3.8210525e-05f, -9.400519e-06f, -1.2794493e-05f, -1.6672366e-05f, -8.752242e-06f, 3.4083344e-06f, -1.8767914e-05f, -1.3456249e-05f, -1.5076833e-05f, 1.2883812e-05f, 2.3749955e-05f, 1.0384547e-05f, 1.5498194e-05f, -7.5777816e-06f, 4.144319e-06f, 1.4914614e-05f, -5.5289097e-06f, 1.0540644e-05f, -7.0025015e-07f, -8.173332e-06f, -6.24409e-05f, -5.0630108e-05f, -2.636064e-06f, 2.9724928e-05f, -5.3802294e-05f, -5.503304e-05f, -7.6440745e-05f, -5.6039185e-06f, -8.294994e-06f, 2.9910789e-06f, 1.7731276e-05f, 2.4014234e-06f, 9.7133925e-06f, 7.2488624e-06f, 1.7664386e-05f, 2.178166e-05f, 1.6578946e-05f, 3.3459025e-06f, -1.6929816e-05f, -3.0914878e-05f, 1.8168597e-05f, -8.879103e-06f, -1.785496e-05f, 7.9428455e-06f, 3.3852528e-05f, 2.9709483e-05f, 6.5954205e-06f, 4.6052483e-06f, 1.4703064e-05f, 3.0507232e-05f, 2.79135e-05f, -2.0774123e-05f, 1.4991256e-05f, 9.425751e-06f, -1.8140112e-05f, -1.2410496e-05f, -7.543554e-06f, -5.978687e-08f, -5.7373613e-06f, 1.8372331e-05f, -6.9168577e-06f, 8.3779205e-06f, -1.1490088e-05f, 5.8890464e-06f, -2.7420376e-06f, -4.2691627e-07f, -9.172026e-06f, -6.155827e-05f, -6.836957e-05f, -4.0521423e-05f, 1.0209466e-05f, -8.273053e-06f, 5.9859187e-05f, 3.65702e-05f, -3.41128e-05f, 1.626108e-05f, -1.1901275e-05f, -3.899101e-06f, 6.9162147e-06f, 1.8557522e-07f, 1.2190149e-05f, 7.2572443e-06f, 1.3118632e-05f, -2.3813343e-05f, 2.8639592e-05f, -1.0448349e-07f, -5.1371976e-06f, 1.382989e-05f, 2.1800925e-05f, -1.875812e-05f, 1.4065812e-05f, 2.0685844e-05f, 2.0784135e-05f, -2.5738935e-05f, 2.4791969e-05f, -3.8221006e-06f, -1.4211626e-05f, 5.897701e-06f, -1.5678172e-05f, -2.6395035e-06f, -1.5277328e-05f, -1.726559e-05f, 1.1204052e-05f, 2.3276976e-05f, -2.5117155e-05f, 6.8601542e-09f, -1.593803e-05f, 4.8948145e-06f, -2.55946e-06f, 1.0083851e-05f, -1.727408e-05f, 9.396891e-07f, -2.2994756e-05f, 2.3524623e-05f, 2.9612963e-06f, -2.2516404e-05f, 3.286407e-05f, -2.8877997e-05f, -5.3620544e-05f, -3.2051154e-05f, 6.5825414e-05f, -1.6516105e-05f, -2.2610897e-05f, -1.8186227e-05f, 2.3092389e-05f, -4.526311e-06f, -1.6476071e-05f, 1.7229144e-05f, -4.1878837e-07f, -1.747437e-06f, -1.9032088e-05f, -1.7037952e-05f, 6.461207e-06f, -3.110291e-06f, -2.668192e-05f, -9.974899e-06f, 1.9656802e-05f, 2.710004e-06f, -1.36958115e-05f, 5.790248e-06f, -1.9671252e-05f, -2.0649726e-05f, 2.6874706e-05f, -2.2883505e-05f, -1.9144685e-05f, 1.122769e-05f, -2.317817e-05f, -2.141255e-05f, -1.6010313e-06f, -1.4571906e-05f, 5.417736e-07f, -1.9038183e-05f, -3.1104562e-06f, -4.0461837e-06f, -1.3313474e-05f, -2.452472e-06f, 5.0873577e-06f, 1.19962415e-05f, -1.32885725e-05f, -1.8848596e-05f, 1.1050257e-05f, 1.5110533e-07f, 1.5441443e-05f, -3.5071577e-07f, 1.162295e-06f, 3.761849e-05f, 4.770748e-05f, 1.3792118e-06f, 1.5606514e-05f, -6.320655e-05f, -1.105802e-05f, -1.9661971e-05f, 1.0261027e-06f, -5.1868533e-06f, -3.5382336e-06f, -2.2306916e-05f, -1.5956648e-05f, -1.5375046e-05f, -1.9915818e-05f, 1.1291171e-05f, -2.360567e-05f, 4.4786805e-07f, 9.481554e-07f, 1.2267552e-05f, 1.0812197e-06f, -2.654835e-05f, -1.881881e-05f, -3.034439e-06f, -1.9994426e-05f, 2.6637255e-05f, -3.141921e-05f, 2.0445272e-05f, -2.7079006e-05f, -1.021549e-06f, -2.4027353e-05f, 7.0293218e-06f, -2.5271443e-06f, -1.398152e-05f, 7.4743675e-06f, -5.681935e-06f, -7.6154574e-06f, 1.6352376e-05f, 1.0160748e-05f, 1.7446393e-05f, 1.2541619e-05f, 1.1842459e-05f, 2.0354693e-05f, -1.50167e-05f, -8.9671885e-06f, 1.896788e-05f, -1.1982248e-05f, 6.3505606e-05f, 1.7495766e-05f, 1.8022012e-05f, 5.752546e-06f, 2.8541048e-05f, -6.565862e-05f, -2.2336588e-05f, -2.9163994e-05f, 2.1205038e-05f, -2.929445e-06f, -8.392652e-06f, 1.5838967e-05f, 2.5746247e-06f, -2.2248732e-05f, -1.9561789e-05f, 1.8227806e-06f, 1.7898887e-05f, -2.4302215e-05f, 2.7472131e-05f, -2.766524e-05f, -1.88855e-05f, -2.2911829e-05f, 2.7545571e-05f, -2.871125e-05f, 1.2134448e-05f, 4.961024e-06f, -2.4329976e-05f, -2.7437689e-05f, 1.129218e-05f, 2.2533888e-05f, 3.2356922e-05f, -1.0923768e-06f, 9.426334e-06f, -1.5462376e-05f, 9.172513e-06f, 1.6085129e-05f, 2.1670305e-05f, 1.0433826e-05f, 2.44492e-06f, 1.676154e-05f, 1.9659452e-05f, -1.8052655e-05f, -1.0073793e-05f, 2.2460697e-05f, -5.0836643e-06f, 1.8137004e-06f, 4.9746795e-06f, -1.206162e-05f, -1.8337141e-05f, -6.163447e-05f, -2.5356134e-05f, -4.5844452e-05f, -2.487383e-05f, -3.612865e-05f, -1.4570822e-05f, -2.159685e-05f, -4.6425594e-06f, 3.4655425e-06f, -2.5196561e-05f, -5.924528e-06f, -1.3820142e-05f, -8.8268025e-06f, -9.552078e-06f, -1.4827873e-05f, 2.4229385e-05f, -1.101015e-05f, -7.560849e-06f, 1.1895935e-05f, -3.0302868e-05f, 1.6401664e-05f, 1.1718121e-05f, -1.4693151e-05f, -2.0394036e-05f, -2.3786324e-05f, 2.7735838e-05f, -2.165211e-05f, 5.253649e-06f, -4.438924e-06f, -2.7180211e-05f, -1.694097e-05f, -6.2908744e-06f, 1.7092101e-05f, -1.0912318e-07f, -8.088673e-06f, 2.007298e-05f, 1.0647929e-05f, 4.472082e-06f, 4.9234454e-06f, -1.584741e-05f, -1.0235583e-05f, -4.064026e-06f, -2.910185e-06f, 8.719095e-06f, 4.5642014e-06f, -5.623902e-06f, 2.052233e-05f, -2.6850923e-05f, 4.046851e-05f, 5.7357778e-05f, -4.331915e-05f, -2.5584664e-05f, 2.8684191e-05f, -2.293176e-05f, -4.191753e-05f, -1.6207368e-05f, -6.1214932e-06f, -2.7398337e-05f, 3.097251e-07f, 1.9731706e-05f, -1.4652015e-05f, 7.630002e-06f, 1.8181834e-05f, -5.614287e-06f, -2.1299042e-05f, 2.1134687e-05f, -8.546145e-06f, -1.3161496e-05f, 1.46598995e-05f, -1.5779891e-06f, -1.1001709e-05f, 2.218085e-05f, 1.6624384e-05f, -4.5090815e-06f, -8.0470745e-06f, -1.4562497e-05f, -1.6511378e-05f, -1.8642857e-06f, -1.3458611e-05f, 1.8842617e-05f, -1.9336609e-05f, -1.7706307e-05f, -1.4805343e-05f, 7.479522e-06f, 1.5852871e-05f, -2.45491e-07f, 3.5673584e-06f, -3.364701e-06f, -1.2977186e-05f, -5.717424e-06f, 2.733644e-06f, 4.4314397e-06f, -1.0835684e-05f, 7.4086e-06f, -7.896035e-06f, -4.3154632e-06f, 3.542902e-05f, 2.495765e-05f, 4.3322554e-05f, -1.9651085e-05f, 3.466425e-05f, -5.1642583e-05f, 3.0283685e-05f, 2.2620756e-05f, 1.6761676e-05f, -1.0942989e-05f, 7.412873e-06f, -1.0030697e-05f, 1.7538705e-05f, -2.5714258e-05f, 4.56279e-06f, 6.9360044e-06f, -1.9058879e-07f, 6.4495994e-06f, 1.448568e-05f, -2.3821738e-05f, 2.708689e-05f, -9.64491e-06f, -2.4824967e-05f, 2.1143003e-05f, -1.669361e-05f, 1.1481191e-05f, 1.6003436e-05f, -5.688193e-06f, -2.0429183e-05f, 1.6192915e-05f, -4.057974e-06f, 8.773835e-06f, -1.7399498e-05f, 6.473109e-06f, -2.2216014e-05f, -1.4368693e-06f, -4.212178e-06f, 1.276354e-05f, 1.7753633e-05f, -1.4445234e-05f, -7.285313e-07f, 3.3056542e-06f, -1.3718278e-06f, -1.8139465e-06f, 1.4748379e-05f, -5.677072e-06f, -9.978379e-06f, 5.8179274e-05f, 4.0080453e-05f, 1.8282896e-06f, -4.5304052e-05f, -2.236938e-05f, -5.8799193e-05f, 3.6717207e-05f, -2.0881334e-05f, 5.9850568e-06f, -2.2609553e-05f, -1.7852308e-05f, 1.0572663e-05f, 2.6622038e-06f, 1.7427219e-05f, 2.2420309e-05f, 1.8618946e-05f, 2.4825935e-05f, 8.856074e-06f, -1.6777685e-05f, 2.472993e-05f, 1.8477023e-05f, 3.0267858e-05f, 1.972571e-05f, 1.3421644e-07f, 2.2140817e-05f, 1.8116378e-05f, -6.7557203e-06f, -2.9120543e-05f, 1.8770477e-05f, -2.162368e-05f, 2.0358364e-05f, 1.317319e-05f, -1.7524702e-05f, -1.42932395e-05f, 1.8236662e-05f, 1.0848376e-05f, -1.4376263e-05f, -1.3442141e-05f, -4.9641153e-06f, -5.287032e-06f, -1.5708732e-05f, 3.847826e-06f, 8.346564e-06f, -9.058602e-06f, 3.082207e-06f, 6.317035e-06f, 9.327091e-06f, -1.4428768e-05f, -1.6149397e-05f, 1.8070841e-05f, 1.8861445e-05f, -2.3930808e-05f, -2.9394896e-05f, -2.3090359e-05f, -2.1725931e-05f, 1.1698489e-05f, -3.4757197e-06f, 9.222287e-06f, -1.8668637e-05f, 5.5283053e-06f, 7.4029226e-06f, -1.1578304e-05f, -2.2421842e-05f, 2.8745966e-05f, -1.2592879e-05f, 1.5437481e-05f, 1.22019965e-05f, 1.9780951e-05f, 1.4015824e-05f, 2.117076e-05f, 8.419918e-06f, -2.8460494e-05f, 2.4961839e-05f, 2.8880508e-05f, 1.0652818e-05f, -1.6709439e-05f, -2.3433628e-05f, 1.9065523e-05f, -7.723293e-06f, -2.924417e-05f, -1.6242097e-07f, -2.0795862e-05f, -1.2850425e-05f, -1.07259675e-05f, 1.8274215e-05f, 1.30217095e-05f, 1.9186904e-05f, -7.4884724e-06f, 4.6405944e-06f, -1.1247536e-05f, -1.702561e-05f, 2.3343944e-06f, 1.1006172e-05f, 2.3852579e-06f, 8.191716e-06f, -1.5123842e-06f, -1.0103476e-05f, -5.8664737e-05f, -2.4303046e-05f, -2.5911295e-06f, 4.9670125e-05f, -2.3362725e-05f, 1.5537697e-05f, 4.3999262e-05f, 2.9511591e-05f, -1.9717747e-06f, 1.3218799e-05f, 1.9549783e-05f, 3.665462e-06f, 1.4851378e-05f, 3.864796e-06f, 9.079509e-06f, -1.627961e-05f, -3.2026746e-06f, 1.2590196e-05f, 4.1019975e-06f, 2.1273416e-05f, -1.03054645e-05f, -3.2500418e-06f, -1.7769225e-05f, 2.9689402e-06f, -8.635774e-06f, -2.104267e-05f, -2.0734238e-05f, 2.5450316e-05f, -2.6889666e-05f, 6.729426e-07f, -3.2367636e-05f, 1.6074722e-05f, -7.665343e-06f, -1.2209444e-05f, -7.109405e-06f, -1.1292187e-05f, 1.0717093e-05f, 3.1236875e-06f, -7.954317e-06f, 1.0279303e-05f, 8.9010405e-07f, 1.548507e-05f, 1.1888214e-05f, -1.31117085e-05f, 9.0678295e-06f, 1.558593e-05f, 3.8815974e-06f, -5.03207e-05f, -1.7927538e-05f, 4.3215314e-05f, -4.4351887e-05f, -1.5275164e-05f, 1.9322297e-06f, 3.2292664e-06f, 5.14706e-07f, -1.6104312e-05f, -2.1664846e-05f, -2.4816504e-06f, -2.3474391e-05f, -2.8434542e-05f, 1.0274026e-05f, -3.2010947e-05f, 1.7438728e-05f, 1.5858352e-06f, 6.4377755e-06f, 1.8341148e-05f, 2.5575486e-05f, 4.4526646e-06f, 2.2451199e-05f, -2.4251417e-06f, -2.482697e-05f, 4.797397e-06f, -2.1063268e-05f, 2.4765606e-05f, 2.3874596e-05f, 2.022246e-05f, 1.6093887e-06f, 7.865244e-06f, -2.4637347e-05f, 7.131127e-06f, 5.5097466e-06f, 8.205791e-07f, 2.489184e-06f, -9.947251e-06f, 1.2686483e-05f, -2.5781844e-06f, -3.8344817e-07f, 1.5037534e-05f, 1.7581497e-06f, -5.6320923e-06f, 8.795202e-06f, 3.5417258e-06f, 1.4809808e-05f, 1.2859938e-06f, 3.7893108e-06f, -1.7653589e-05f, 1.9426032e-05f, 4.5060788e-05f, -8.506415e-06f, 1.4174088e-05f, 2.881458e-05f, 3.237799e-05f, 2.3286937e-05f, 2.9744294e-06f, 1.96679e-05f, -7.5165794e-06f, -2.4221948e-05f, -1.0239266e-05f, -2.6544152e-05f, 1.893238e-05f, 6.2504296e-06f, -2.175657e-05f, -2.4719671e-05f, 3.778597e-06f, -7.0853284e-06f, 1.0661888e-05f, 1.557924e-05f, -2.3845067e-05f, 2.6388398e-05f, -5.481658e-06f, -2.6970692e-05f, -1.3127564e-05f, -2.8254872e-05f, -2.5549642e-05f, 3.3364606e-05f, -2.4876017e-05f, -8.669348e-06f, 1.31625375e-05f, -2.5156057e-06f, -1.9708912e-06f, 9.05758e-06f, 2.1548624e-06f, 1.8151155e-06f, -3.369272e-06f, 1.710892e-05f, -8.175098e-07f, -6.8741715e-06f, 4.2041785e-07f, -4.6420446e-06f, -1.7806689e-06f, 1.7779138e-06f, 4.282605e-06f, 1.3739711e-05f, -3.288152e-05f, -3.6095393e-05f, 4.229922e-05f, -4.6879013e-05f, -1.3911988e-05f, -1.6287922e-05f, 3.5548703e-05f, -4.2035226e-05f, -2.1492286e-05f, -2.190416e-05f, -2.4294204e-05f, 7.90284e-06f, 3.0382833e-05f, 1.6539167e-05f, 2.7221853e-05f, -2.0019002e-05f, -6.4928195e-06f, -1.6860924e-06f, -1.7968148e-05f, -4.776083e-06f, -1.0702831e-05f, 2.6325199e-05f, -1.9929026e-05f, 3.2024643e-06f, 1.585596e-05f, 5.0345566e-06f, -1.6399334e-06f, 1.8034363e-05f, 2.1663729e-05f, -2.8725317e-05f, -2.8782204e-05f, -6.973967e-06f, 1.1100252e-05f, -2.1484122e-05f, 3.195449e-06f, 4.6780087e-07f, -9.822231e-07f, 8.493026e-06f, -5.3503486e-06f, 3.701142e-06f, 1.770948e-05f, 6.26878e-06f, 1.0975875e-05f, 1.4314172e-05f, -9.2437045e-07f, -1.6816257e-05f, -1.18330345e-05f, 1.3614929e-05f, 4.667219e-05f, -2.030499e-05f, -2.9846795e-05f, 4.056529e-05f, 1.0144346e-05f, 3.672028e-05f, -2.786514e-05f, -4.7203754e-05f, 2.7893559e-05f, 2.5432191e-05f, -4.350852e-05f, 1.7771097e-05f, 1.333341e-05f, -3.5686713e-05f, -1.4729998e-06f, 7.6145825e-06f, -1.5194397e-05f, 2.682322e-05f, 2.3633129e-05f, 1.857206e-05f, -7.0473698e-06f, 7.703026e-06f, 1.6542342e-06f, -2.0985743e-05f, -2.8352875e-05f, -1.6709938e-06f, 9.379701e-06f, 3.4084256e-05f, -3.085393e-06f, 3.316987e-05f, 3.624604e-06f, -7.7999475e-06f, 6.487472e-06f, -1.3033866e-05f, -1.3085102e-05f, -1.474988e-05f, 1.2488004e-05f, 5.5999058e-06f, 1.6563243e-05f, -7.1586646e-06f, -1.372842e-06f, -1.9439544e-06f, -1.577682e-05f, 1.6072787e-05f, 1.056223e-05f, 6.221233e-06f, -1.0526932e-05f, -5.9203808e-06f, -2.4068397e-05f, -1.8950694e-05f, 2.4564044e-05f, 2.745756e-05f, 5.0046797e-06f, 3.2138723e-05f, -2.3817981e-06f, 4.4258726e-05f, -2.3118873e-05f, 3.229741e-05f, 1.2204671e-05f, -4.577966e-05f, 1.9768293e-05f, -3.246586e-05f, 3.256255e-05f, -1.03443845e-05f, 3.2208205e-05f, -8.439871e-06f, 2.269788e-05f, 2.7076954e-05f, -3.6544436e-06f, -1.9730664e-05f, -2.688517e-05f, 1.2886275e-05f, -2.822284e-05f, 6.547858e-06f, -1.0675337e-05f, -4.973401e-06f, 2.3097564e-05f, 2.7827236e-05f, -2.1278383e-05f, -1.9204199e-05f, 3.099661e-06f, -1.8213397e-05f, 6.733294e-06f, -1.7545295e-05f, -8.541397e-06f, -1.0392382e-05f, -8.3663435e-06f, 1.38940395e-05f, 1.1792448e-05f, 1.754935e-05f, 1.0681117e-05f, -9.637192e-07f, -8.23496e-07f, 9.879609e-06f, 8.804143e-06f, 9.7657e-06f, -2.9128489e-05f, -1.4841887e-05f, 1.5161969e-05f, -2.7405362e-05f, 6.8255194e-06f, 4.5695033e-05f, -5.3992622e-05f, -9.15046e-06f, 3.3665423e-05f, 1.5803045e-05f, -1.5993863e-05f, -1.6290885e-05f, -3.8427046e-05f, -1.2025033e-05f, -2.7391357e-05f, 1.2855288e-05f, 2.5675285e-05f, 2.5945666e-05f, 2.923695e-05f, 1.3095238e-05f, -2.8998618e-05f, 2.7738091e-05f, 3.2332864e-05f, 8.907571e-06f, 2.6678925e-05f, -2.173247e-05f, 2.484605e-05f, -5.196772e-06f, 2.3380286e-05f, -5.5832916e-06f, 1.5386178e-05f, 1.8873896e-05f, -1.6762287e-05f, -1.4207663e-05f, -1.06233565e-05f, -4.543265e-06f, 1.5718773e-05f, -6.372728e-06f, 9.14985e-06f, 3.06703e-06f, -4.369398e-06f, 1.2602836e-05f, -1.5771177e-05f, 1.622652e-05f, -1.943174e-06f, -6.6943346e-07f, 1.599282e-05f, 8.835406e-06f, 1.7467757e-05f, -4.6358644e-05f, 9.482945e-06f, -1.4000101e-05f, -1.7146078e-05f, -3.5005312e-05f, -3.3271484e-05f, 3.3037308e-05f, -4.4969165e-06f, 3.0999495e-06f, -1.3096734e-05f, -4.119572e-05f, -2.797428e-05f, 1.8608541e-06f, -1.5729258e-05f, 4.6039775e-05f, -1.4903912e-05f, -2.1622938e-05f, -1.666118e-05f, -1.5884878e-05f, -6.846095e-06f, 2.1980424e-05f, 9.362722e-06f, 5.790582e-06f, -2.6414771e-05f, 1.8938232e-05f, -1.2979393e-05f, -1.8056615e-05f, -2.0534517e-05f, 1.38326795e-05f, 3.2463322e-05f, -1.1105536e-05f, 1.8965116e-05f, 1.100468e-05f, -6.258506e-06f, 1.24474145e-05f, 1.8431798e-05f, 1.3443293e-05f, 1.40816865e-05f, -9.876005e-06f, 1.464053e-05f, 5.540282e-06f, 2.2371174e-07f, 1.49561365e-05f, 9.403266e-06f, -1.3263013e-05f, -1.5756931e-06f, 1.363131e-05f, 1.8358778e-05f, -4.614597e-06f, 4.394754e-05f, 2.1671436e-05f, 7.0678066e-06f, -4.4648314e-05f, -4.606638e-05f, -1.1259936e-05f, 1.2043667e-05f, -1.3599558e-05f, 2.1758586e-05f, -2.0673398e-05f, -2.8388264e-05f, -3.47618e-05f, 7.5308308e-06f, -1.7448807e-05f, 2.9121222e-06f, 2.3497661e-05f, 3.3509405e-05f, -1.3803587e-05f, -3.2688848e-05f, 1.2772595e-05f, 1.8295643e-05f, -1.5768757e-05f, -2.2891656e-05f, -1.44951755e-05f, -1.6353226e-05f, -1.4975101e-05f, 1.1738585e-05f, 1.0760001e-06f, 9.921068e-06f, 5.5162463e-06f, -8.496591e-06f, -1.76252e-05f, 1.7660173e-07f, 7.4686686e-06f, -1.18692205e-05f, 6.061845e-06f, -1.8095301e-05f, 9.465389e-06f, -3.2233916e-06f, -4.2468137e-06f, 5.5064097e-06f, -4.8874203e-06f, 1.0743317e-05f, -9.537585e-06f, -1.4630014e-05f, 1.418667e-06f, -7.722036e-06f, -1.0048339e-05f, -3.0150984e-05f, -2.9988938e-05f, -2.3687538e-05f, 3.431298e-05f, 1.1740875e-05f, -4.189683e-05f, -4.029496e-05f, 2.3641225e-07f, 3.1419668e-07f, 1.596023e-05f, 1.8333967e-05f, 1.8521436e-05f, 1.9349096e-05f, 2.579428e-05f, -7.981163e-06f, 1.8642846e-05f, 7.4927107e-07f, -8.239659e-06f, -2.00946e-05f, 1.1560608e-05f, -2.9146246e-05f, -2.0221692e-06f, 2.9935687e-05f, 1.730266e-05f, 4.527503e-06f, -2.480181e-05f, -1.3897741e-05f, -2.5445695e-05f, 5.279104e-07f, 2.9124894e-05f, -4.7015906e-06f, 1.0352246e-05f, -3.8816106e-06f, 1.8268634e-05f, -7.97862e-06f, 1.1679704e-05f, -8.825573e-06f, 4.0492287e-06f, -3.4632565e-06f, -4.5704282e-06f, -1.3152275e-05f, 3.5151438e-06f, 9.329603e-06f, -1.8723931e-05f, 5.835974e-07f, 1.1363155e-05f, 4.702455e-05f, -5.234857e-05f, -3.1853764e-05f, -3.921576e-05f, 2.6583559e-05f, 4.346698e-05f, 2.2023783e-06f, -4.605592e-05f, 4.092988e-05f, -2.2456707e-05f, 3.293484e-05f, 1.5880758e-05f, 7.436788e-06f, 1.7304155e-05f, 2.1611362e-05f, 4.336907e-06f, -1.7479515e-05f, -1.1890061e-05f, -4.655207e-06f, -2.5213549e-05f, 3.2420598e-06f, 5.106302e-07f, 1.99571e-05f, 1.1764448e-05f, 1.1341811e-05f, -2.244436e-05f, -9.65548e-06f, -1.4322319e-05f, -1.2526283e-05f, 3.086278e-05f, -3.1969936e-05f, -2.3752119e-07f, 4.1610015e-06f, -1.28768625e-05f, -9.479911e-06f, -1.1052841e-05f, 1.3715374e-05f, -2.7006297e-06f, -1.4786121e-05f, 1.5986743e-05f, -2.1738172e-06f, 1.0850184e-05f, -1.8269153e-05f, -1.3631252e-05f, 6.7082983e-06f, -1.5466092e-05f, 1.211994e-05f, -1.2321327e-06f, 5.2674354e-06f, -2.6898068e-05f, -1.9256202e-05f, 2.7531281e-05f, -3.388507e-05f, 6.095485e-06f, -6.866461e-06f, -7.296476e-06f, 8.671617e-06f, -3.29684e-05f, 1.43943225e-05f, 1.7129156e-05f, -1.9308895e-06f, -6.92129e-06f, -2.8703602e-05f, 3.0515093e-05f, -4.0736763e-06f, -9.991734e-07f, 4.427797e-06f, -2.2066495e-05f, -2.7914626e-05f, -5.885981e-07f, -1.2480846e-06f, -2.6970944e-05f, 2.0653153e-05f, -1.574333e-05f, -1.6856313e-05f, 2.7430533e-05f, 1.5272737e-05f, -1.859581e-05f, 2.4843685e-05f, 2.423128e-05f, 1.8508477e-05f, -5.7332604e-06f, -4.030321e-06f, -7.657937e-06f, 5.508061e-06f, 1.0890348e-05f, 5.9815375e-06f, 2.0666237e-05f, 2.8680442e-06f, 8.5091597e-07f, 1.4903107e-05f, 1.887057e-05f, -1.3475581e-05f, -1.6720041e-05f, -6.0314386e-07f, -1.4613247e-05f, -2.3383736e-05f, -1.7749915e-05f, -3.4363657e-05f, -5.21719e-05f, 4.945204e-05f, 2.2624488e-05f, -1.1563693e-05f, -3.8179987e-05f, -3.738718e-05f, -2.6325648e-05f, 1.7200216e-05f, -2.4868914e-05f, -2.171131e-05f, 4.2977263e-05f, 1.8345601e-05f, 1.5564125e-05f, 1.0869222e-05f, 6.8319564e-06f, 2.3974826e-05f, -3.389433e-05f, -1.6418928e-05f, 6.076524e-06f, 4.6513105e-06f, -4.250764e-06f, -5.6244096e-07f, -2.7220067e-05f, 1.25873e-05f, 7.4287286e-06f, 3.789321e-05f, 2.436958e-05f, -1.141841e-05f, -1.2306079e-05f, 9.822529e-06f, 3.312472e-06f, -4.1049407e-06f, -1.3168678e-05f, 2.7049387e-06f, -1.4148007e-05f, -3.4481425e-06f, 1.625792e-05f, -1.467551e-05f, -9.998467e-06f, -1.7197468e-05f, -8.8125435e-06f, -1.9169393e-05f, 9.365162e-06f, 1.1868287e-05f, -1.4567497e-05f, 4.3333923e-05f, -4.9585564e-05f, 3.8140937e-05f, 2.4643572e-05f, -2.8533788e-05f, 1.88513e-05f, -4.7449666e-05f, 2.3071245e-05f, -2.0313813e-05f, -2.3256878e-05f, -2.585771e-05f, 1.936802e-05f, -1.3253088e-05f, 1.4039376e-05f, -1.7842674e-05f, -3.7587774e-06f, -1.3623074e-05f, 2.3747578e-05f, 1.4379604e-05f, -2.210045e-05f, -1.6705339e-05f, -3.0887986e-05f, -1.1839736e-05f, -8.380433e-06f, 3.2526917e-05f, -1.2937019e-05f, 1.8190283e-05f, 2.4015855e-05f, 2.8958335e-05f, -7.443604e-06f, 2.9417992e-05f, -1.1924979e-05f, 1.649489e-05f, -2.0713724e-05f, -1.8672403e-05f, -4.5006555e-06f, 1.7459013e-05f, -1.1712029e-07f, -1.7936549e-05f, 1.4755808e-05f, -1.173733e-05f, 6.2884683e-06f, -4.2720703e-06f, -9.095983e-06f, 3.8250388e-07f, 3.6463753e-06f, 8.060556e-06f, -6.41081e-06f, 1.9265524e-06f, 3.7429185e-05f, -1.6162581e-06f, 3.126568e-05f, 4.556552e-05f, 2.1369875e-05f, -3.2802538e-05f, -1.3845847e-05f, 3.1928703e-05f, 2.309394e-05f, -2.4254494e-05f, -3.5408884e-05f, 3.5476503e-05f, 3.7978287e-05f, -2.4584813e-05f, -2.3297158e-05f, 2.6983154e-05f, 1.4155539e-05f, -7.0252886e-06f, -2.8247203e-05f, -2.32177e-05f, -1.02200465e-05f, -2.8037877e-05f, 1.614023e-05f, 1.7821736e-05f, 6.120819e-06f, 2.5550398e-05f, -2.269409e-05f, -1.7239168e-05f, 1.6946598e-05f, -1.2607256e-05f, -3.375848e-05f, 1.574385e-05f, -5.5657283e-06f, 9.869546e-06f, -6.8911686e-06f, 1.9521276e-05f, 1.6061693e-05f, 8.2849665e-06f, -4.245309e-06f, 1.6378204e-05f, 1.6320651e-05f, -1.959248e-06f, 2.0965444e-05f, -4.6366795e-06f, -1.1667555e-05f, 1.4533873e-05f, 1.6678234e-05f, -2.058551e-05f, 5.1233746e-06f, -1.4534241e-05f, -3.781142e-05f, 4.4587578e-05f, -7.938213e-06f, 3.805435e-05f, -1.492273e-05f, -2.1793694e-05f, 1.9040772e-05f, -4.9047853e-06f, -2.3790582e-05f, -1.622293e-05f, -1.760061e-05f, 2.6150128e-05f, -7.5023804e-06f, 1.9781794e-05f, 7.621567e-06f, 2.7546588e-05f, 6.2603212e-06f, -1.1998803e-05f, 1.4669051e-05f, -1.421677e-05f, 2.1345259e-05f, -2.5226043e-05f, 1.927566e-05f, 2.9179957e-05f, 5.5040396e-06f, -2.2351753e-05f, 2.2533486e-05f, 3.113926e-05f, 2.1429705e-05f, 1.0047295e-05f, 9.380019e-06f, -1.5731439e-05f, -5.2194723e-06f, 1.5263668e-05f, 6.1794194e-06f, 9.467181e-06f, 1.1779501e-05f, 2.6776408e-07f, 5.8430287e-06f, -1.9921954e-05f, -7.119925e-06f, -4.5905963e-06f, -1.724374e-05f, 9.535726e-06f, -7.882891e-06f, -1.6633401e-05f, 3.2081998e-06f, -3.0388795e-05f, -4.3565866e-05f, -2.5060572e-06f, -3.9289887e-05f, 1.1098322e-05f, 2.0585503e-05f, -1.4571562e-05f, 3.439453e-06f, -1.3561854e-05f, -7.145553e-06f, -2.1387668e-06f, -3.1797101e-06f, -1.8727444e-05f, -3.071276e-05f, -2.8527777e-06f, 1.3596335e-05f, -1.8955633e-06f, 4.8516667e-06f, -2.2693936e-05f, 1.9922134e-05f, 2.9279502e-06f, 1.5440524e-05f, 2.8682007e-05f, 1.9378858e-05f, -2.07939e-05f, 3.345725e-05f, 2.2573917e-05f, 3.382713e-05f, -3.1893655e-05f, 6.3863476e-06f, -1.755087e-05f, -1.749505e-05f, 1.05672425e-05f, 9.567526e-06f, 7.017664e-06f, 1.3097655e-05f, -4.6409045e-06f, -1.6761016e-05f, 5.334603e-06f, -5.694305e-07f, 2.052278e-06f, -6.396635e-07f, 1.60106e-05f, -3.2968765e-06f, 1.3232128e-05f, 1.8952625e-05f, -3.7462414e-05f, 3.8380276e-05f, -2.9416483e-06f, 2.3653523e-05f, -1.12384805e-05f, -2.1857742e-05f, 6.9307534e-06f, 1.8835708e-05f, -1.3475134e-05f, -6.9472158e-06f, 2.8204156e-05f, 2.011766e-06f, 1.990724e-05f, 6.615105e-06f, 1.8238367e-07f, 1.592006e-05f, 2.3649882e-05f, -3.061932e-05f, -7.4947893e-06f, -2.3633074e-05f, 1.9980407e-05f, -9.780234e-06f, 1.8692672e-05f, 4.1312937e-06f, -2.672825e-05f, -2.6630063e-05f, -3.2100263e-05f, 2.8458939e-05f, 1.44961405e-05f, -2.3280627e-05f, -6.08721e-06f, 3.5454282e-06f, 3.6024576e-06f, -9.762134e-06f, -1.9239222e-05f, 1.5574245e-05f, 7.0493993e-06f, -1.0398265e-05f, -1.5416581e-05f, 4.078969e-06f, 1.6463056e-05f, 1.4374549e-05f, -1.553332e-05f, 1.4095254e-05f, -1.1909181e-05f, -1.0734642e-05f, 1.9510866e-05f, -1.2040255e-05f, -3.5484252e-05f, 3.161449e-05f, -4.204293e-06f, -2.157415e-05f, 2.7507588e-06f, 3.854325e-05f, 3.643867e-05f, -3.0171184e-05f, 1.661535e-05f, 1.1573721e-05f, -2.3315072e-06f, -1.9969113e-05f, 2.9547453e-05f, 1.2558983e-05f, -3.2406708e-05f, -7.046545e-06f, -2.3081968e-05f, -1.8061335e-05f, 4.097513e-06f, -1.98502e-06f, -9.777841e-06f, -2.5994914e-05f, -1.6185417e-05f, 4.2326174e-06f, 2.6021751e-05f, 3.447657e-05f, -2.6102458e-05f, 1.8937784e-05f, 4.611543e-06f, -2.0830515e-05f, 9.942852e-06f, 6.345188e-06f, 2.0014097e-06f, -3.2499345e-06f, 1.0880899e-06f, -6.421321e-06f, 1.9326408e-05f, 1.0694543e-05f, -7.8018064e-07f, 6.2573513e-06f, 1.6588487e-05f, -5.1429042e-06f, -5.5995474e-06f, 1.4324139e-05f, 7.773369e-06f, 3.620025e-06f, -1.3745457e-05f, 5.868114e-06f, 4.0669478e-05f, -6.3875377e-06f, 1.2075474e-05f, -3.3634762e-05f, 3.3724904e-05f, -1.46808525e-05f, 1.5420626e-05f, -5.660011e-06f, 1.0960713e-05f, -3.5875647e-07f, 2.7249553e-05f, -1.0442839e-05f, 2.0312695e-05f, 2.7228481e-05f, -2.8384715e-05f, 5.1446973e-06f, 1.859194e-05f, -3.581378e-06f, -2.2904207e-05f, -1.05268955e-05f, 5.8796045e-06f, 9.069842e-06f, -2.0102887e-05f, -6.367141e-07f, -3.6792484e-05f, 2.6979005e-05f, 8.733061e-06f, 3.087418e-06f, 4.207143e-05f, 1.0355657e-05f, -2.895138e-05f, -1.320543e-05f, 1.4110939e-05f, 5.740635e-06f, -1.5486947e-05f, 1.1622956e-05f, -9.943448e-06f, -1.6270757e-05f, -8.935665e-06f, 1.1471206e-05f, 1.500684e-05f, -1.2179781e-05f, 4.342197e-06f, 6.7213173e-06f, 1.0948207e-05f, -3.448161e-06f, -7.6016554e-06f, 3.1744098e-06f, 4.203706e-05f, 3.9083243e-06f, 2.4822572e-05f, 4.362758e-07f, -1.817734e-05f, 2.3160404e-05f, -2.3718876e-05f, -2.0045622e-05f, -2.067481e-05f, -1.6511729e-05f, -8.904632e-06f, -4.6422892e-06f, -1.1949818e-05f, 1.2792641e-05f, 1.0342509e-05f, 1.0435901e-05f, -1.1018002e-05f, 1.6467351e-05f, 1.1410114e-05f, 1.3055727e-05f, 6.0778784e-06f, 1.4783155e-05f, -2.0962825e-05f, 2.4943325e-05f, -9.85303e-06f, -8.8328225e-06f, 1.7593347e-05f, 1.9434137e-05f, -2.4713909e-05f, 1.7881335e-05f, -3.9290017e-06f, -1.516895e-05f, 6.2236268e-06f, 1.51879785e-05f, -1.7546883e-05f, -1.7642686e-05f, 1.1580255e-05f, 8.564245e-06f, -4.17817e-06f, -3.9752344e-06f, 1.1284574e-05f, 6.561702e-06f, 4.1165404e-06f, 7.829278e-06f, -1.3445988e-05f, -9.661008e-06f, -1.9224093e-05f, 1.9671743e-05f, 9.888455e-07f, -4.136396e-05f, 3.587569e-05f, 3.2514716e-05f, -7.643482e-06f, -4.7923353e-05f, 2.7988366e-05f, -2.4188566e-05f, 1.5992937e-05f, -8.89618e-06f, 1.0988261e-05f, 9.620102e-07f, -1.63619e-06f, 5.6959984e-06f, -1.7535436e-06f, -2.0722578e-05f, -7.1302647e-06f, -3.489307e-06f, -2.0327097e-06f, -2.7152457e-05f, 1.4266681e-05f, -6.3302864e-06f, 4.646347e-06f, 2.2680762e-05f, -9.121888e-06f, 8.509315e-06f, -3.7089074e-05f, -1.2350476e-05f, -1.613312e-05f, 2.6737951e-05f, 1.750517e-05f, -2.646256e-05f, -1.2021278e-05f, -9.236585e-06f, -1.7390612e-05f, -3.6836202e-06f, -3.2933308e-06f, -6.7885145e-07f, 6.8792283e-06f, -2.2828633e-08f, -4.076329e-06f, 1.1024612e-05f, 7.836323e-06f, 9.181812e-06f, -1.7321679e-06f, -2.0831632e-05f, -1.0828714e-06f, -1.3398829e-05f, 4.110503e-05f, -3.721974e-05f, 3.863615e-06f, 2.5622343e-05f, 5.602065e-05f, -3.831204e-05f, 1.781497e-05f, -4.865584e-05f, -1.6266818e-05f, 1.3752655e-05f, 1.8647335e-05f, 3.319057e-06f, -1.7951392e-06f, 1.4441442e-05f, 1.3463198e-05f, -6.151762e-06f, 8.359427e-06f, 5.855898e-06f, 7.315023e-06f, 1.7330187e-05f, -5.147308e-06f, -6.5519057e-06f, 5.072333e-06f, 2.3659004e-06f, -2.1200072e-05f, -3.1494303e-05f, 1.8461602e-05f, 3.81481e-05f, 2.1291145e-05f, 2.4846773e-05f, 2.8184324e-05f, -4.9843943e-06f, -8.7482995e-06f, 7.57992e-06f, -5.051798e-08f, 8.790129e-06f, -1.4310734e-05f, 4.245935e-06f, 1.24728895e-05f, 1.2364579e-05f, -1.0106105e-05f, 1.0105234e-05f, -1.9099252e-05f, -3.3488857e-06f, 1.8404173e-05f, -1.3450417e-05f, 1.1684626e-05f, -1.567633e-05f, 3.1782718e-05f, 6.5615304e-06f, 1.4660975e-06f, -5.7489697e-06f, 5.1159008e-05f, 4.6044082e-05f, 3.2298263e-05f, -2.139692e-05f, 9.805104e-07f, -5.5550418e-06f, 2.0370115e-05f, -1.5564548e-05f, -1.1567048e-05f, 2.0594935e-05f, -1.4669483e-05f, -2.2096772e-05f, -2.253283e-05f, 7.425877e-06f, 7.822511e-07f, -5.3978656e-06f, 2.817257e-05f, 9.137195e-06f, -8.4989415e-06f, -5.5395576e-06f, -2.964344e-05f, 1.7288704e-06f, -1.4496012e-05f, -8.123731e-06f, -1.0896826e-05f, -2.3600061e-05f, 6.9785356e-06f, 2.8936638e-06f, 3.394283e-06f, 1.6686568e-06f, -7.8593484e-07f, -2.2877668e-06f, -1.5368303e-05f, 8.1431756e-07f, 7.2835275e-07f, 1.0775414e-05f, 2.4398566e-06f, 1.1742934e-05f, -1.2145764e-05f, -1.5959997e-05f, 2.7214382e-06f, -9.235791e-07f, -1.849512e-05f, 5.4262214e-06f, 4.7472393e-05f, 4.3503238e-05f, 3.3670785e-05f, 2.6208083e-06f, 5.87925e-05f, 3.218573e-05f, -6.8249136e-07f, -3.9738356e-06f, -2.6715913e-06f, -1.6635548e-05f, 3.8062822e-06f, -2.6305759e-06f, 1.17463266e-07f, -1.2557402e-05f, -2.1340305e-05f, -2.019595e-05f, -1.2698444e-05f, -1.4487606e-05f, -9.533895e-06f, 1.5148889e-05f, 2.043538e-05f, -2.364093e-05f, -1.8296334e-05f, 1.16993515e-05f, -6.262488e-06f, 3.5060195e-05f, 2.804598e-05f, 2.1591322e-05f, -6.874215e-06f, 1.6987498e-05f, 2.1006987e-05f, 3.193156e-05f, 3.384201e-06f, -1.46187485e-05f, 1.3421154e-05f, -1.6341104e-05f, -1.2328884e-05f, 9.642711e-06f, 6.44355e-06f, 1.1338013e-05f, 5.4427455e-06f, -8.1437265e-06f, -4.5622814e-06f, -1.0651214e-06f, -2.0050384e-05f, -9.464876e-06f, 3.4187656e-06f, 2.3738091e-06f, -4.9050886e-05f, 9.4439565e-06f, 2.576938e-05f, -3.762817e-05f, 3.6887264e-05f, -1.2491742e-05f, 3.7523387e-05f, 1.9529329e-05f, -1.6941187e-05f, 7.4793315e-06f, -1.0283062e-05f, -2.1177948e-05f, -1.5180176e-05f, 5.574201e-06f, -1.0935466e-06f, -2.482861e-07f, -9.211281e-06f, 1.0648096e-05f, -1.0723251e-05f, -1.2985782e-06f, -5.951776e-06f, -2.2234271e-05f, -1.9088608e-05f, -4.0519585e-06f, -3.3058077e-05f, 5.7210373e-06f, 1.8500261e-05f, -3.4212102e-05f, 1.1915805e-05f, 8.167097e-06f, -3.9641647e-05f, -1.7123302e-05f, 3.1593784e-06f, 3.5339858e-06f, 1.6614293e-05f, -3.5515552e-07f, -3.679771e-06f, -7.932853e-06f, 1.52436605e-05f, 5.1466177e-06f, 1.3562645e-05f, 1.5635145e-05f, 1.730907e-05f, 3.0035098e-06f, -8.081366e-06f, 3.2825358e-06f, -1.7255988e-05f, 1.1106802e-05f, 3.7409667e-05f, 3.505115e-05f, -3.8903716e-05f, -2.9286248e-05f, 3.946841e-05f, -3.4210818e-05f, -1.1056818e-05f, 4.4568875e-05f, -5.4486436e-06f, 5.5250302e-06f, 2.2447992e-05f, 1.1597155e-05f, 1.4590481e-05f, -1.5966061e-05f, -1.7514029e-05f, 6.502574e-06f, 1.9580042e-05f, 7.090129e-06f, -1.7216504e-05f, -1.2725421e-05f, -4.7756257e-06f, -5.9403656e-06f, -1.5876885e-05f, -1.2940881e-05f, -3.0346513e-05f, 3.249279e-06f, -2.1451528e-05f, -5.0304316e-06f, -2.9991272e-05f, -1.4555512e-06f, 3.9422488e-05f, -2.1297485e-05f, -1.9581244e-05f, -1.8984376e-05f, -5.9432264e-06f, -1.3575424e-06f, 2.0820813e-05f, -8.388415e-06f, 7.877268e-06f, 6.8312097e-06f, 1.9573696e-05f, 2.0142692e-05f, -1.0527622e-05f, 2.2614362e-05f, 1.2749008e-05f, 1.9301851e-05f, 1.5806783e-06f, 4.1817084e-06f, 4.762791e-05f, -3.5311863e-05f, -2.7497075e-05f, -4.3280716e-06f, -1.2087131e-05f, 3.44563e-05f, -8.508086e-06f, -3.5060002e-05f, -1.279098e-05f, -1.2106328e-05f, -3.3316135e-06f, 1.0516137e-05f, 2.0979262e-06f, -1.6326838e-05f, 1.6535603e-05f, -1.6837861e-05f, 2.0116777e-05f, 1.0733439e-05f, -4.9625874e-06f, -8.634173e-06f, -1.0314531e-05f, -1.1623972e-06f, -4.487652e-06f, 1.0793959e-05f, -2.4322439e-05f, 1.9238354e-05f, 2.8210243e-05f, 1.0273259e-06f, 4.791651e-05f, -3.1010022e-06f, 3.199024e-05f, -2.3527032e-06f, -7.690664e-06f, -7.468349e-06f, -3.8362755e-06f, 2.124431e-05f, -6.43009e-06f, -1.8560793e-05f, -2.1554171e-05f, -1.718184e-05f, 6.2165627e-06f, 2.1328735e-05f, -1.1006451e-05f, -7.63304e-06f, -2.1019496e-05f, -8.385743e-06f, 8.419181e-06f, -1.4570292e-05f, 4.4855577e-05f, 2.5167812e-05f, -4.789894e-05f, 2.3013434e-05f, -1.6313383e-05f, -1.039936e-05f, 8.585408e-06f, -1.2231578e-05f, -1.668946e-05f, -1.545577e-05f, 2.3720226e-05f, 3.6040035e-06f, 9.135419e-06f, -3.574944e-06f, 5.3585e-08f, -6.7393444e-06f, 1.4731982e-05f, -2.1451931e-05f, -1.4713924e-05f, -8.143071e-06f, -3.2351882e-06f, 6.9144216e-06f, -1.7529377e-05f, 2.0107756e-05f, -3.141272e-05f, 1.4852389e-05f, 2.833605e-05f, -1.5467358e-05f, -3.2681008e-05f, -3.9239305e-05f, -2.510461e-05f, -4.299897e-05f, 1.7408142e-05f, -1.189406e-05f, -3.8558187e-06f, 1.5730564e-05f, 8.762785e-06f, -1.0482287e-05f, 1.5322088e-05f, -1.8958415e-05f, -2.4968044e-06f, -1.3156488e-05f, 8.652839e-07f, -1.603821e-05f, 1.2197673e-05f, -9.614771e-06f, -1.8688741e-05f, 3.1383329e-06f, -3.809163e-07f, -4.2513424e-05f, 4.188949e-05f, -4.591341e-06f, 6.0742586e-05f, -1.9842687e-06f, -2.7886012e-05f, -4.7679532e-05f, -1.785064e-05f, -1.96683e-06f, -1.2646757e-05f, -7.143289e-06f, -1.1986299e-05f, 1.6249669e-05f, -9.332626e-06f, 8.473554e-06f, 1.5710468e-05f, -2.3851588e-05f, 3.6914224e-07f, -1.36594e-06f, 1.1672165e-05f, 2.2716447e-09f, 1.8905535e-05f, -8.807848e-06f, 1.276463e-05f, -3.1131487e-05f, -9.625035e-06f, 2.3139042e-05f, -3.025011e-05f, 2.9379733e-05f, -1.6002767e-05f, 3.2245243e-05f, -7.354951e-07f, 1.3424352e-05f, -2.2614238e-05f, 1.4351326e-05f, 2.3720613e-05f, -1.0418173e-05f, 2.9319144e-06f, -1.9573386e-05f, 6.520852e-06f, -7.273872e-07f, 6.6316043e-06f, -1.1407501e-05f, -2.9816104e-07f, 5.91655e-06f, 6.133702e-06f, 4.403981e-06f, -2.7967517e-05f, 3.524345e-05f, 5.100298e-05f, 3.843949e-05f, 4.058574e-06f, -4.7822493e-07f, -4.3086915e-05f, 4.3181408e-05f, -1.4738903e-07f, 1.3170533e-05f, 1.8889312e-05f, -2.7136798e-06f, 7.428029e-06f, -8.1599355e-06f, -1.8815197e-05f, -2.012532e-05f, -4.793647e-06f, -2.2410782e-06f, 1.8923964e-05f, -1.5218744e-05f, 1.7091717e-06f, 1.8321345e-05f, 4.77306e-06f, 2.3542396e-05f, -2.0811762e-05f, 4.453991e-05f, 3.6860616e-05f, -2.9873881e-05f, 3.4239267e-05f, 2.2920236e-05f, 1.1097983e-05f, 3.5069697e-05f, -8.070193e-06f, 6.651509e-06f, 1.1236654e-05f, 1.06428715e-05f, -7.1952772e-06f, -1.2245857e-05f, -2.1952606e-05f, 1.6182408e-05f, -3.8112503e-06f, 1.0002403e-05f, -1.7096605e-05f, 1.817267e-05f, -5.4847255e-06f, 2.0469592e-05f, -1.19805445e-05f, 9.807971e-06f, 1.5240071e-05f, 3.2710526e-05f, 5.7982893e-06f, 3.1487565e-05f, -4.8009056e-06f, 2.803599e-05f, 3.4215755e-05f, -3.601388e-05f, -4.418537e-06f, 8.917779e-06f, 7.2523635e-06f, -5.329501e-06f, 2.122644e-05f, 1.2864226e-05f, 1.6764037e-05f, 9.87772e-06f, 3.9876177e-06f, -1.1661373e-05f, 1.618623e-05f, -1.4657213e-06f, 1.1604914e-05f, -1.8276085e-05f, -1.1830087e-05f, -1.2343508e-05f, -1.4605646e-05f, 2.6714439e-05f, 8.315772e-06f, 1.9147308e-06f, 4.7002006e-05f, -4.425561e-05f, -4.367164e-05f, -1.7250568e-05f, 6.4003966e-06f, 1.3648077e-05f, 2.0330355e-05f, 9.782756e-06f, 2.1966069e-05f, 5.068051e-06f, -2.2171818e-05f, -1.770163e-05f, -7.0266547e-06f, 2.1952208e-05f, 1.8918689e-05f, 2.7191547e-05f, -2.0389805e-05f, -1.7187416e-05f, -9.412354e-06f, -6.424356e-07f, -1.5238335e-05f, 1.8601673e-05f, -1.3183464e-05f, 5.1808533e-05f, 1.24436865e-05f, 2.9315195e-05f, 3.668767e-06f, 1.5437738e-05f, -1.4476212e-05f, 1.2235984e-05f, 4.2081256e-06f, 1.37322795e-05f, 2.1271891e-05f, -1.4636367e-05f, 5.9629165e-06f, 3.0930912e-06f, -1.2080131e-05f, -4.0359196e-06f, 1.613563e-05f, 2.4541403e-06f, 2.4515297e-05f, 7.657631e-08f, -1.0785295e-05f, 3.3554347e-06f, -2.4524208e-05f, -3.1581647e-05f, -3.852845e-05f, 4.4201344e-05f, 1.815696e-05f, -1.3508937e-05f, 2.5168109e-05f, -1.8202323e-05f, 8.411439e-06f, 1.8188124e-06f, 1.6198655e-05f, 2.1966725e-05f, -6.3539956e-06f, 1.15538505e-05f, -1.5052414e-05f, -1.0550979e-05f, 1.0987948e-05f, -2.079023e-05f, -1.37143425e-05f, -5.3276317e-06f, -2.150232e-05f, -3.3361937e-06f, 1.9095332e-05f, -1.6324433e-05f, 5.314262e-05f, 4.4012533e-05f, 6.164255e-05f, -2.0682213e-05f, 2.1270476e-05f, 4.5386787e-05f, -3.9417922e-05f, -5.7104e-05f, 8.37902e-07f, -5.8646574e-06f, 1.7245722e-05f, -3.437631e-06f, -1.03733055e-05f, -1.7528744e-05f, -1.66834e-05f, 6.927795e-06f, 5.360944e-06f, -1.854763e-05f, -1.70306e-06f, -1.5730106e-05f, -9.345778e-06f, -9.057925e-06f, 5.9031396e-07f, 2.1990697e-06f, -1.0231266e-05f, 4.0666553e-05f, 5.208492e-06f, -3.455934e-05f, -2.7567397e-05f, 2.1637034e-05f, -4.0582094e-05f, 2.0102763e-05f, 1.8874482e-05f, -1.0830278e-05f, -1.1156591e-06f, -2.1019735e-06f, 1.98126e-05f, -2.9926318e-06f, -2.0753423e-05f, -1.804161e-05f, 1.4498187e-05f, 1.6033266e-05f, 9.2994915e-06f, 1.12396065e-05f, 1.5525116e-05f, 1.7259004e-05f, -6.660086e-06f, 1.114218e-05f, 1.1292713e-05f, 3.595947e-05f, 5.114279e-05f, -6.4965214e-05f, -2.7872824e-05f, -2.7944616e-05f, -2.6505631e-05f, -5.3289614e-06f, -1.4696909e-05f, 1.0013227e-05f, 1.0516599e-06f, -2.8830482e-06f, -2.1716899e-06f, -3.959047e-06f, 2.4066705e-06f, 1.247477e-06f, -1.3746256e-05f, -1.6961107e-05f, -1.3054356e-05f, 1.968878e-06f, 1.4628864e-05f, -1.2198295e-05f, 1.0076298e-05f, -1.5872925e-05f, 3.371169e-05f, -7.0043366e-06f, -3.3250726e-05f, 5.101063e-05f, 4.249592e-05f, -2.9059225e-05f, -3.1592186e-05f, -3.7170823e-05f, -5.866426e-06f, -2.3281984e-05f, -4.366289e-06f, -5.534159e-06f, 1.0762115e-05f, 1.864745e-05f, -1.6657898e-05f, 1.1239639e-05f, -1.0254096e-05f, 5.9707677e-06f, 2.1635475e-05f, -2.0282635e-06f, 1.4253611e-05f, -2.3635606e-05f, 1.2102611e-05f, 1.3127573e-06f, -1.99224e-05f, -2.7479084e-05f, -2.6222648e-05f, -1.3334489e-05f, 7.2651487e-06f, 1.11196e-05f, 7.19033e-06f, -4.6332738e-05f, -1.8631392e-05f, -1.1869971e-05f, -1.6714733e-06f, -5.3151866e-06f, -1.7378123e-05f, -1.7323215e-05f, 8.198916e-06f, -1.2223405e-05f, 1.4388478e-05f, 9.058054e-06f, -1.3057453e-06f, -7.006109e-06f, -1.0597435e-05f, -2.0205765e-05f, 7.932856e-06f, -8.578986e-06f, 3.765158e-06f, 2.3122651e-05f, 7.6063416e-06f, 3.9799297e-06f, 2.6128506e-05f, -5.183412e-05f, 3.804834e-05f, -2.7171003e-05f, -1.1950394e-05f, -1.9744242e-05f, -2.2710521e-05f, 2.6817515e-06f, 2.6075815e-05f, -1.4381521e-05f, 1.187711e-05f, -1.8310653e-05f, -1.6437609e-05f, 1.6205371e-05f, 4.437903e-06f, 2.1033606e-05f, -8.1939215e-06f, 1.6146307e-05f, -2.4238436e-05f, -2.0021964e-05f, 4.3814063e-05f, 2.1895481e-05f, -2.6034625e-06f, -2.082704e-05f, -7.595907e-07f, 3.145405e-05f, -2.7646198e-05f, -4.898403e-05f, 6.4866663e-06f, -5.161701e-06f, -7.392852e-06f, -2.5455862e-05f, 1.40953625e-05f, 4.442823e-06f, -2.3260724e-05f, -2.2408894e-06f, -1.7101554e-05f, 5.748653e-06f, 1.8046807e-05f, 1.5637748e-05f, -9.1538295e-06f, -7.5468806e-06f, 1.5737172e-05f, -4.835351e-06f, 4.1325104e-05f, 1.7098862e-05f, -3.6223166e-05f, -4.5175902e-06f, -9.566974e-06f, -6.0985058e-06f, -3.2958642e-06f, 2.8075594e-05f, -1.5563022e-05f, -1.9401477e-05f, -2.4357056e-05f, 1.6440246e-05f, 2.3715698e-05f, -1.2468243e-05f, -1.1342232e-05f, -1.2569481e-05f, 1.3458316e-05f, -1.5371126e-05f, -9.400076e-06f, -5.100574e-06f, 1.5990681e-05f, 1.4167612e-05f, -6.415187e-06f, -1.7231312e-05f, 3.524777e-05f, -4.868533e-05f, 6.198513e-05f, 9.497056e-06f, 5.2156487e-05f, -2.900509e-05f, -2.808125e-05f, -5.8148624e-05f, 1.733107e-05f, -2.1360871e-05f, 1.14192935e-05f, 2.9784603e-06f, 1.0043725e-05f, -8.684801e-07f, 1.5545544e-05f, -7.5862613e-06f, -5.446926e-06f, 7.3844835e-06f, -1.4832201e-05f, -4.9475684e-06f, -1.5960955e-05f, 1.9444904e-06f, 1.6387205e-05f, 1.3402194e-05f, -3.8397808e-05f, 1.240205e-05f, -5.2646858e-05f, 3.6922185e-05f, -1.5615036e-05f, 1.7690194e-05f, -4.358274e-05f, 4.470822e-05f, -2.8418792e-06f, 3.1144302e-06f, 2.3459703e-05f, -2.181187e-05f, 2.48219e-06f, 1.4479999e-05f, 2.5176856e-05f, -2.024143e-05f, -2.350282e-05f, -1.698523e-05f, -1.4882048e-05f, -1.0582761e-05f, 7.814914e-06f, 3.74071e-06f, -1.7989842e-05f, 2.4134447e-06f, -7.1002232e-06f, -3.2872688e-07f, -4.4123608e-05f, -4.7357476e-05f, -4.687895e-05f, -1.4874545e-05f, -3.1480802e-05f, 5.7795594e-05f, 1.279554e-05f, 2.2614468e-05f, -1.7454704e-05f, 1.1114132e-05f, -3.7231666e-06f, 1.801868e-05f, 5.911125e-06f, -1.3684405e-05f, 1.12946445e-05f, 3.882173e-06f, 1.0519511e-05f, 1.8676044e-05f, -1.1055932e-06f, -2.300604e-05f, 1.1761362e-05f, -4.8265256e-06f, 1.9882802e-05f, 1.9571382e-06f, 2.2820788e-05f, -1.1106316e-05f, 6.7099713e-06f, 4.6915616e-06f, -5.1694275e-05f, -3.4542856e-05f, -2.1571715e-05f, -5.1643397e-06f, -8.5386055e-06f, 2.2211852e-05f, -1.9504538e-05f, -2.4922914e-05f, -9.812822e-06f, 1.182579e-05f, 1.6558284e-05f, 1.6438045e-05f, -1.5631816e-05f, 1.5277139e-05f, 1.8776398e-05f, -1.0991338e-05f, -2.0521435e-05f, -1.7811077e-05f, 1.0782405e-05f, -2.7802856e-05f, 3.7475434e-06f, 4.5987446e-05f, 1.5890613e-05f, -2.033707e-05f, 9.63113e-06f, -2.8826213e-05f, -1.780096e-05f, -3.072745e-06f, 4.6609466e-06f, -5.2077385e-06f, -1.6766904e-05f, 1.4194064e-05f, 1.6504655e-05f, 1.3787705e-05f, 2.0136698e-05f, 7.976107e-06f, 8.266281e-06f, -1.7631393e-05f, 2.1555374e-05f, -1.5443198e-05f, -7.2432013e-06f, 1.6456179e-05f, -5.0001818e-05f, 2.1015521e-06f, -2.7135575e-05f, -3.3042343e-05f, -2.4298219e-05f, 4.0783147e-05f, 1.9456826e-05f, 1.6866128e-05f, -2.2623293e-05f, -2.7118986e-05f, -2.1916157e-05f, 1.8132092e-05f, 2.2908782e-05f, 2.44263e-05f, 8.316564e-06f, 1.2080281e-05f, -1.0625993e-05f, 6.885832e-06f, -2.3814966e-05f, 1.7140705e-05f, 1.6849493e-05f, -1.4704559e-05f, -1.4615802e-05f, -6.634039e-07f, 5.6174962e-05f, 3.0954747e-05f, 4.9582513e-06f, 4.2561107e-05f, 7.3279116e-05f, 6.007121e-05f, -5.147646e-05f, 2.6022472e-05f, -1.7128426e-05f, 7.71278e-06f, -1.0807453e-05f, -1.367951e-05f, 6.2431513e-06f, 9.752109e-07f, -2.4624134e-05f, 4.6319633e-06f, -3.2261582e-07f, 1.2389587e-05f, 3.0974495e-06f, 4.369767e-07f, -1.1388824e-05f, -1.21577e-06f, -1.680493e-05f, -3.1919765e-06f, -2.397894e-05f, -3.5476845e-05f, 6.0394345e-06f, 1.5999562e-05f, 3.464621e-05f, 3.6372454e-05f, 4.2700758e-05f, 1.714377e-05f, 1.159426e-05f, -1.5738313e-05f, -2.2597135e-07f, -2.1061402e-05f, 2.9853118e-05f, -1.8322666e-05f, 1.797904e-05f, -2.4074663e-05f, -1.189914e-05f, 9.350228e-06f, -1.4528282e-05f, -3.9828656e-06f, -3.8465864e-06f, -7.6181645e-06f, 1.0903973e-05f, -6.117446e-06f, 4.6837195e-05f, 3.5670168e-05f, -4.6843335e-05f, -4.8135116e-05f, -1.1312093e-05f, 1.5595e-05f, 2.9940436e-05f, 7.410657e-05f, -2.1466241e-05f, 1.8023125e-05f, 2.1186044e-05f, -5.8839005e-06f, 2.023724e-05f, 1.8307046e-05f, 1.07084525e-05f, 1.9094343e-05f, -1.9969375e-05f, -6.3264542e-06f, 1.8204903e-05f, 2.561187e-06f, -4.2716124e-06f, 1.00334355e-05f, -2.6427872e-06f, 1.1932707e-07f, 3.9377915e-06f, 5.8349808e-05f, -6.018446e-05f, -1.2722691e-06f, -3.7498514e-05f, 3.7446585e-05f, 4.6020454e-05f, -1.9801104e-05f, -1.64186e-05f, -1.7043003e-05f, -2.8900162e-05f, 2.6908623e-05f, -5.020505e-06f, 1.3359809e-05f, 1.9259858e-05f, 2.3767485e-05f, 1.10440205e-05f, -1.9319768e-05f, -2.7738628e-05f, 4.3478863e-06f, -6.6845614e-06f, -1.202521e-05f, 6.5372137e-06f, -1.7098262e-05f, 4.0057465e-05f, -8.6658845e-05f, 2.0457477e-05f, -1.126646e-06f, -4.594318e-05f, -4.861013e-05f, 3.1438107e-05f, 6.312711e-05f, 1.7782959e-05f, 1.713565e-05f, -1.0990434e-05f, -1.671511e-05f, 5.3076474e-06f, -2.0452695e-05f, -2.0622363e-05f, -1.0011515e-05f, -5.979322e-06f, 6.9605603e-06f, 7.161998e-07f, 2.0548574e-05f, -1.4110434e-05f, -2.338253e-05f, 1.6694241e-05f, -5.333742e-06f, -2.9466739e-05f, 5.6446075e-05f, 4.3965774e-05f, 2.1890066e-06f, -4.362296e-05f, -9.371043e-06f, -1.1794098e-05f, -8.576646e-06f, 3.334574e-05f, -3.078541e-05f, -1.3070202e-05f, 2.609311e-05f, 2.9338871e-05f, -1.8360442e-05f, 1.9611383e-05f, 1.1468942e-05f, -1.81091e-05f, 7.62623e-06f, -1.8769218e-07f, -8.971744e-06f, -2.2625043e-05f, 1.7601518e-05f, -8.903757e-06f, -1.126095e-05f, -1.8309234e-05f, 5.6858335e-05f, 4.9310947e-05f, 8.492337e-06f, 3.046407e-05f, -5.5344786e-05f, -1.0090607e-05f, -1.9485535e-06f, 1.5299222e-05f, 1.7775259e-05f, 8.217006e-06f, -1.0373486e-05f, 4.7928816e-06f, -1.6722297e-05f, -2.1132132e-06f, -2.0551804e-05f, -8.5931215e-06f, -2.0899173e-05f, -1.4828788e-05f, -3.3367078e-06f, -1.0662887e-06f, 4.1487506e-06f, -6.294405e-06f, -5.6519307e-06f, -6.00994e-06f, 1.9927666e-05f, -4.239484e-05f, 4.5364686e-05f, 5.185927e-05f, 1.991763e-05f, -8.521116e-06f, 1.4619012e-05f, 4.6941176e-07f, 1.9153198e-05f, -1.27787835e-05f, 8.097705e-06f, 1.0748543e-06f, -1.812451e-05f, -9.626466e-06f, -1.1395217e-05f, 9.273163e-06f, -2.3897072e-05f, -2.4057072e-05f, -2.4641345e-06f, 1.4105552e-05f, -3.1778466e-06f, -2.8807362e-05f, 5.164375e-06f, -2.7628872e-05f, -3.2084597e-05f, -6.841435e-05f, 4.0682718e-07f, -3.319474e-05f, 3.3017858e-07f, -3.0911284e-05f, -4.9055947e-05f, 6.0614445e-07f, -1.0020069e-05f, -9.564579e-06f, 9.5758605e-06f, 1.628834e-05f, 1.8146493e-05f, -6.4986017e-07f, -3.0937106e-06f, -6.2349086e-06f, -1.5541847e-06f, 8.437157e-06f, -1.200021e-05f, 2.1907406e-05f, -1.2441481e-05f, 2.3473922e-06f, 5.1674206e-06f, 2.6450272e-05f, -1.6027299e-06f, 1.26120385e-05f, 1.9697272e-05f, 3.694031e-05f, -5.4887805e-05f, 8.654742e-06f, 5.004147e-05f, -4.5915212e-06f, 1.9747731e-05f, 3.455035e-07f, 2.7998649e-05f, 3.0023888e-05f, -1.1129624e-06f, 2.6879807e-05f, -1.1247242e-06f, 1.6983557e-05f, 4.0110376e-06f, -2.6843907e-05f, 3.3624583e-05f, 2.4000628e-05f, 2.4394833e-06f, -1.3791868e-05f, -5.281215e-06f, 5.198091e-05f, 2.532421e-05f, -6.5464905e-05f, 8.491267e-05f, -3.5676294e-05f, 1.8079829e-05f, -7.431416e-05f, -7.809026e-06f, 1.4896805e-06f, -1.5935408e-06f, 1.2287402e-06f, 1.2684791e-05f, 2.4815346e-05f, -1.9793948e-05f, -2.4811596e-05f, 4.4950652e-06f, -5.6398585e-07f, -1.929876e-05f, -1.9511158e-06f, -7.1878153e-06f, 1.13529195e-05f, -2.3571158e-05f, 7.535472e-06f, 1.4596549e-05f, -1.1527493e-05f, -4.731955e-05f, -2.081458e-05f, 1.9556954e-05f, -3.4962395e-05f, 1.04979445e-05f, -5.2810055e-06f, -2.5288988e-05f, 1.0107645e-05f, -9.1617185e-06f, 4.236921e-06f, 2.266235e-05f, -7.904446e-06f, 1.62947e-05f, -2.5377049e-05f, 3.308786e-05f, -2.6051022e-05f, 2.1024209e-05f, -3.0906205e-05f, 1.126814e-05f, 3.0485278e-05f, -5.966783e-06f, 1.6140262e-05f, 8.665563e-06f, 6.168296e-05f, -2.5986821e-05f, -2.5111003e-05f, 7.904336e-05f, 4.315987e-05f, 2.9707933e-05f, -2.9680143e-05f, 3.9581293e-05f, -1.6915597e-05f, -8.4823005e-06f, -1.6434895e-05f, -4.6047107e-06f, -1.3581014e-07f, 1.9958958e-05f, -8.841894e-06f, 5.1337166e-09f, -1.4770944e-05f, -6.733489e-07f, 3.3026474e-06f, -5.9667477e-06f, 4.8458213e-07f, 6.696044e-08f, 7.3572783e-06f, -1.649892e-05f, 5.2252602e-05f, -1.3395311e-05f, -5.1802417e-05f, 2.5351094e-06f, 6.469642e-05f, -2.4541028e-05f, -1.7575785e-06f, 3.2402656e-06f, 2.8710101e-05f, -1.236357e-05f, -3.6167752e-05f, 1.630774e-05f, 1.2261997e-05f, 9.045237e-06f, 1.7358265e-05f, -2.6228348e-05f, -7.891819e-06f, -1.2129934e-05f, 4.429945e-06f, -5.820968e-07f, -1.164788e-05f, 2.5831825e-05f, 1.1320677e-05f, 3.6418194e-07f, -5.670982e-05f, 7.4605385e-05f, 3.7224834e-06f, 1.7466187e-05f, -3.162821e-05f, -4.204932e-05f, -8.374021e-05f, -6.59543e-05f, 2.9910789e-06f, 4.081924e-06f, -6.0027746e-06f, -5.9742815e-06f, -1.6905433e-05f, 9.061033e-06f, 1.3109136e-05f, -1.6708993e-05f, 1.4982177e-05f, 3.4121829e-06f, 1.9310326e-05f, 1.4217354e-05f, -1.3172215e-05f, -6.801505e-06f, -8.261682e-06f, -7.869505e-06f, 1.2336401e-05f, 5.3538715e-05f, -2.654632e-05f, -5.6549386e-05f, 1.7970682e-05f, 4.5241704e-05f, 3.145933e-05f, 1.451531e-05f, 8.923059e-06f, -3.720001e-05f, -3.1974363e-05f, 8.119691e-06f, -1.5803042e-05f, 4.363405e-06f, -1.1619183e-05f, 1.8899598e-05f, 2.5277148e-05f, 1.1520956e-05f, 1.2853973e-05f, 7.2300395e-06f, 2.9846273e-05f, 7.8502935e-06f, 1.3258145e-05f, -1.26331115e-05f, 8.087843e-05f, -7.540164e-05f, 3.9435185e-05f, 7.836859e-05f, 9.719381e-05f, 7.37338e-05f, 5.270094e-05f, -6.9469634e-06f, 2.1332511e-05f, -8.992476e-06f, 1.5141582e-05f, -1.4625441e-05f, 1.5715174e-05f, 4.7422436e-06f, -1.3564893e-05f, 1.441517e-05f, -1.0929693e-05f, -1.858498e-05f, -1.5167926e-05f, 4.127607e-06f, 2.046941e-05f, -4.952815e-06f, -2.798541e-06f, -7.4470254e-06f, 4.8381127e-05f, -2.2720046e-06f, 2.8533936e-05f, 6.556214e-05f, -4.6274607e-05f, 4.4246208e-05f, -1.7028317e-05f, 4.8084254e-05f, 3.6802507e-05f, 2.5466466e-05f, -1.5880412e-05f, 1.8062216e-05f, 1.59852e-05f, 2.3008717e-05f, 4.4780918e-05f, -8.919333e-06f, -1.2671219e-05f, -2.5086674e-05f, -3.7017806e-05f, -1.3383752e-05f, 1.9100973e-05f, -9.842989e-06f, 2.7334492e-05f, 4.3211226e-06f, -5.1930496e-05f, -2.9193176e-05f, 9.437655e-06f, 4.0320094e-05f, 5.5736942e-05f, -9.854268e-05f, -4.4842018e-05f, -3.0938e-05f, -1.0332598e-05f, 1.7968177e-05f, -7.362889e-06f, -1.5598845e-05f, 2.208068e-05f, -1.0678083e-05f, -1.1999323e-05f, -9.796116e-06f, -1.4196384e-05f, -1.623474e-05f, -4.6536596e-07f, -3.0541341e-06f, -1.1889964e-05f, -4.649124e-06f, -2.3368992e-05f, 7.716185e-06f, -4.4277844e-05f, 7.348644e-05f, -6.30396e-05f, 4.3087588e-05f, 5.9366896e-05f, -8.157988e-06f, -2.5078261e-05f, -1.447889e-05f, 2.78668e-05f, -4.628228e-06f, -3.6603164e-05f, -1.6980994e-05f, -3.721474e-05f, 3.8661574e-06f, 9.706105e-06f, 4.705807e-05f, 1.7584474e-05f, 2.8932804e-05f, 3.1170846e-05f, -3.947595e-06f, 2.31622e-05f, 3.5775765e-06f, -3.197164e-05f, -8.5334805e-06f, 3.4927278e-05f, 7.165499e-05f, -5.81776e-05f, -1.047666e-05f, -2.6713096e-05f, 1.7606313e-05f, 6.14779e-05f, 2.0084073e-05f, -1.6310261e-05f, -2.0377314e-05f, 8.8982324e-07f, -9.5556525e-06f, 6.655136e-06f, 2.0547774e-05f, -1.6676726e-05f, -1.7440174e-05f, -8.034505e-06f, 9.625247e-06f, -2.3261453e-05f, -6.4199594e-06f, 5.468032e-07f, 7.4453583e-06f, 1.254237e-05f, 7.08212e-06f, -2.1425001e-05f, 2.6206566e-05f, 5.3047606e-05f, 2.3735814e-05f, 4.716382e-05f, -7.738092e-05f, -3.4254048e-05f, 7.229382e-05f, -5.398935e-06f, 6.346738e-06f, 3.444224e-05f, -3.689304e-05f, -4.9554e-05f, -1.0899728e-05f, 2.9050001e-05f, -2.1553658e-05f, 2.5312109e-05f, 2.034603e-05f, 5.287095e-07f, -3.063104e-05f, 1.30380895e-05f, 1.729202e-05f, -3.361114e-05f, 3.1321964e-05f, 4.4731863e-05f, -6.028208e-05f, -5.9493952e-05f, -5.1337793e-05f, 1.4390406e-05f, 7.1731316e-05f, -5.188542e-05f, -4.0829735e-05f, -2.8160314e-06f, 1.2989053e-05f, 1.9032688e-05f, 1.0933882e-05f, -6.2425875e-06f, 1.2277708e-05f, 4.288684e-06f, 1.3073743e-05f, -1.89652e-05f, 5.656462e-07f, -4.148226e-07f, -1.9326899e-05f, 1.7737824e-05f, 9.596814e-06f, -5.307004e-06f, 5.266122e-07f, 2.461428e-05f, 2.2962373e-05f, 5.4678076e-05f, 6.173531e-05f, -3.975199e-05f, -1.774929e-05f, -2.0866288e-05f, -4.5371266e-06f, -2.9294208e-05f, -3.6012345e-05f, 2.7330007e-05f, -1.7104976e-05f, 1.8833452e-05f, 3.496207e-05f, -2.2434238e-05f, 1.7302245e-05f, -5.2292658e-06f, 2.239996e-05f, -3.6392514e-05f, 2.9979998e-05f, -1.5053113e-05f, -1.2883231e-05f, -7.872998e-06f, -1.763432e-05f, -7.951469e-06f, 3.589124e-05f, -6.620893e-05f, -1.9230967e-05f, -6.426528e-05f, -1.9101744e-05f, -9.245079e-05f, 3.8336948e-05f, -1.4001737e-05f, -1.3537292e-05f, -9.1357915e-06f, 8.922045e-06f, 1.2319422e-05f, -2.1910143e-06f, 3.4599973e-06f, -2.2312413e-05f, 1.3488831e-05f, 1.1450226e-05f, 6.766443e-06f, 1.8499552e-05f, 1.1915126e-05f, 1.0986486e-05f, -1.6345244e-05f, 1.2705109e-05f, -3.0064196e-08f, -4.554251e-05f, 3.6493188e-05f, 1.1221857e-05f, -6.926395e-05f, 6.0952785e-05f, -6.3826286e-05f, 7.1218914e-05f, 2.0527465e-05f, 8.693221e-06f, -1.5261284e-06f, -2.174162e-05f, -8.238498e-06f, -3.0337771e-05f, 4.667617e-05f, 3.0197098e-05f, 2.272804e-05f, -3.5331635e-05f, -3.697491e-05f, 6.529171e-06f, 5.5098526e-06f, -2.3631028e-05f, 3.1441465e-05f, -2.7511842e-05f, 9.27564e-06f, -8.236639e-05f, 8.138095e-05f, -3.6490335e-05f, 4.3899945e-05f, 5.12802e-05f, 1.7912846e-05f, 4.319966e-05f };
+static const float mlp_perf__32_32__1e_05_layer_1_biases[32] = { 0.142593f, -0.048404f, 0.149518f, 0.217482f, 0.050105f, -0.236349f, 0.059351f, -0.181293f, -0.070347f, -0.014309f, 0.117896f, -0.057916f, 0.003164f, -0.233241f, 0.093942f, -0.271074f, -0.118808f, 0.11865f, -0.10215f, -0.302834f, -0.051373f, 0.085573f, 0.230264f, 0.235355f, -0.139103f, 0.26112f, -0.086464f, -0.292799f, -0.109623f, -0.211728f, -0.129011f, 0.053159f };
+static const float mlp_perf__32_32__1e_05_layer_1_weights[1024] = { 0.129172f, 0.229553f, 0.00458f, 0.008782f, -0.0715f, -0.137871f, -0.040739f, -0.140197f, 0.225911f, -0.282815f, -0.311771f, 0.002811f, 0.037837f, 0.273044f, -0.042018f, -0.034928f, 0.167252f, 0.144118f, 0.171648f, -0.140654f, 0.022147f, 0.011363f, 0.052384f, 0.195172f, -0.068745f, -0.172605f, -0.025148f, -0.208314f, -0.316183f, -0.315679f, -0.037041f, -0.024692f, -0.154473f, 0.077816f, -0.018552f, -0.036552f, 0.305347f, 0.292058f, 0.131239f, -0.163087f, 0.192511f, 0.088458f, 0.187821f, 0.043745f, -0.053224f, -0.058957f, 0.302807f, 0.250256f, 0.303429f, 0.135829f, 0.141896f, 0.288721f, -0.165554f, -0.028086f, -0.210638f, -0.293751f, -0.20962f, 0.042875f, 0.257027f, -0.275729f, 0.213718f, -0.234959f, -0.155345f, -0.110426f, 0.099807f, -0.027783f, -0.043129f, 0.176317f, 0.213566f, 0.25359f, 0.20732f, 0.278519f, -0.237947f, 0.315146f, 0.234882f, 0.105615f, 0.151848f, -0.13353f, 0.022636f, -0.183835f, 0.132982f, 0.201748f, -0.204489f, -0.225596f, 0.005625f, 0.108203f, 0.219621f, 0.051082f, 0.178593f, -0.153011f, -0.097312f, 0.185992f, 0.118311f, -0.199751f, 0.256956f, 0.307215f, 0.032635f, 0.165442f, 0.293469f, 0.158865f, 0.05807f, -0.153513f, 0.186917f, -0.151197f, -0.005035f, 0.012244f, 0.034825f, 0.192096f, -0.128712f, 0.23227f, 0.167007f, -0.149907f, 0.182515f, -0.152852f, 0.181524f, -0.150958f, -0.20323f, -0.061868f, 0.312588f, -0.139282f, -0.077022f, -0.277501f, 0.02349f, 0.133354f, -0.294994f, -0.170418f, -0.141524f, -0.183767f, -0.278773f, 0.062984f, -0.214583f, 0.074444f, -0.016321f, 0.306926f, 0.267059f, 0.044572f, -0.298156f, 0.251755f, 0.055373f, -0.182994f, -0.206966f, 0.029272f, 0.05583f, -0.227632f, -0.046235f, -0.154363f, -0.272219f, 0.129336f, 0.220714f, 0.163326f, 0.004711f, -0.057747f, 0.116004f, -0.237629f, -0.023613f, 0.272741f, -0.143329f, -0.312205f, -0.193744f, -0.015216f, -0.0056f, 0.127787f, -0.05574f, -0.036617f, 0.05676f, 0.082402f, 0.246091f, 0.249159f, 0.15415f, -0.138786f, -0.252969f, -0.141276f, 0.024429f, 0.221957f, -0.197024f, -0.305717f, 0.089586f, 0.003264f, 0.002863f, -0.189149f, -0.207526f, -0.011318f, -0.285644f, -0.069139f, -0.103389f, 0.001169f, 0.213724f, -0.269737f, 0.196431f, -0.052403f, 0.273246f, 0.033233f, 0.102918f, 0.107965f, 0.066925f, 0.167092f, 0.146335f, 0.092065f, -0.092152f, -0.275455f, 0.117223f, 0.037253f, -0.29455f, 0.301099f, -0.170645f, 0.263661f, 0.215763f, -0.079927f, 0.096896f, 0.012089f, -0.046831f, -0.204522f, -0.231419f, 0.137551f, -0.24523f, 0.064293f, 0.008349f, -0.182106f, 0.098231f, 0.161644f, 0.026572f, -0.124466f, -0.068155f, 0.131064f, -0.117541f, 0.104094f, -0.108997f, 0.182387f, -0.298377f, -0.175107f, -0.221994f, 0.194131f, -0.069023f, 0.065756f, 0.111214f, -0.321108f, 0.041075f, 0.115493f, 0.125813f, 0.166666f, -0.202873f, -0.107087f, -0.130234f, 0.170748f, 0.122507f, -0.220077f, 0.161132f, 0.247949f, 0.255522f, -0.289981f, 0.257286f, 0.230853f, 0.292301f, 0.028541f, -0.196994f, -0.21471f, -0.016516f, 0.035793f, -0.227346f, -0.31256f, -0.21528f, -0.026393f, -0.045295f, -0.221451f, -0.139862f, 0.095621f, -0.10716f, -0.283287f, -0.008934f, -0.057468f, 0.153716f, -0.293963f, -0.07351f, 0.271483f, -0.123187f, 0.135836f, 0.290165f, 0.308406f, 0.080451f, 0.132922f, 0.309226f, 0.271448f, 0.008025f, -0.174487f, 0.109252f, 0.222976f, 0.205328f, 0.135184f, -0.29284f, -0.021769f, -0.187255f, -0.036963f, -0.09702f, 0.198222f, 0.029138f, 0.232285f, -0.212429f, 0.252991f, -0.088401f, 0.249707f, 0.008375f, 0.227109f, -0.08696f, -0.197819f, 0.139703f, 0.196183f, -0.14927f, -0.025785f, -0.115684f, 0.06505f, 0.196127f, -0.107764f, -0.056197f, 0.175255f, -0.310083f, 0.067883f, 0.148323f, -0.219312f, -0.037665f, 0.193162f, -0.090796f, -0.256963f, -0.239555f, -0.156752f, 0.230994f, -0.27505f, -0.183628f, -0.044457f, -0.14941f, -0.000314f, 0.32567f, -0.00388f, -0.159973f, 0.26415f, -0.096074f, 0.15178f, 0.112829f, 0.069757f, 0.133336f, -0.304471f, 0.003629f, -0.165672f, -0.128387f, -0.219582f, -0.164686f, -0.128049f, -0.197999f, 0.079291f, -0.235631f, 0.013275f, -0.019349f, 0.075558f, -0.110116f, 0.207544f, -0.263157f, 0.241139f, 0.246202f, -0.043995f, -0.040024f, -0.182259f, 0.095136f, 0.227099f, -0.171583f, 0.272891f, -0.304568f, -0.133966f, 0.107142f, 0.292375f, -0.083492f, 0.272253f, 0.227578f, 0.249003f, -0.189286f, 0.142205f, -0.270659f, -0.064482f, 0.07582f, -0.269318f, 0.287282f, -0.297795f, -0.269015f, -0.233389f, 0.141521f, -0.069211f, 0.033698f, 0.05651f, 0.137272f, 0.21678f, -0.184757f, 0.051613f, -0.00295f, -0.125078f, 0.053092f, -0.014366f, 0.040608f, -0.024137f, -0.001998f, -0.249613f, 0.194896f, -0.271393f, 0.056642f, -0.048308f, -0.168523f, -0.029107f, -0.054892f, 0.022634f, -0.156102f, 0.127615f, 0.226763f, 0.102525f, 0.22076f, -0.013384f, -0.307156f, 0.040639f, 0.307507f, -0.089307f, 0.29361f, -0.198887f, -0.265227f, -0.087031f, -0.090536f, -0.059068f, 0.007961f, -0.102173f, 0.20482f, -0.136729f, 0.038026f, 0.101018f, -0.057272f, -0.160548f, 0.167068f, -0.104184f, -0.166091f, 0.176337f, -0.024124f, 0.170349f, 0.127858f, -0.283964f, 0.15764f, -0.194274f, 0.108621f, -0.107597f, 0.021049f, 0.010181f, 0.229695f, -0.043698f, -0.303408f, 0.167613f, 0.050517f, 0.179884f, -0.054885f, 0.206904f, 0.29958f, -0.219252f, 0.282648f, -0.03439f, 0.140367f, -0.285063f, 0.155716f, -0.130014f, 0.115599f, -0.225038f, 0.184878f, -0.166837f, -0.019582f, -0.286024f, 0.130808f, -0.248106f, 0.112639f, -0.055965f, -0.037273f, -0.191085f, 0.122598f, -0.279941f, 0.291179f, 0.045058f, -0.216914f, 0.066938f, -0.01617f, 0.166372f, 0.083545f, -0.286186f, 0.243419f, 0.299503f, 0.141669f, -0.298367f, -0.055081f, 0.137152f, 0.251039f, 0.123639f, -0.087259f, -0.114684f, -0.294177f, 0.076689f, -0.067076f, 0.071901f, 0.264234f, -0.098969f, -0.085778f, -0.199018f, -0.278695f, -0.092355f, 0.202456f, 0.276745f, -0.053655f, 0.184576f, 0.279852f, 0.182203f, 0.288769f, -0.306141f, -0.238409f, 0.127049f, -0.037269f, -0.016477f, 0.012438f, 0.311375f, -0.011539f, 0.269675f, -0.255314f, 0.236198f, -0.087652f, 0.173267f, -0.107019f, 0.062939f, -0.243888f, -0.229652f, -0.234447f, 0.088698f, 0.062844f, -0.226004f, 0.061677f, -0.082081f, 0.051983f, 0.147593f, 0.219066f, -0.105865f, 0.00205f, -0.073437f, 0.282029f, 0.026362f, -0.238376f, 0.154946f, 0.119247f, -0.137849f, -0.188671f, 0.157236f, 0.263382f, 0.093344f, 0.176218f, 0.107387f, 0.287804f, -0.212008f, -0.131669f, -0.15195f, 0.285687f, 0.218777f, 0.161483f, -0.040678f, -0.13812f, 0.101817f, 0.290881f, 0.153536f, -0.050669f, 0.059477f, -0.295678f, 0.166303f, -0.205467f, -0.145426f, 0.090843f, -0.068791f, 0.123047f, -0.175602f, -0.22772f, -0.039042f, -0.178574f, -0.205423f, 0.230234f, 0.108729f, 0.172553f, 0.256737f, -0.299784f, -0.159726f, 0.272547f, -0.046657f, 0.255724f, 0.130773f, 0.115136f, -0.086206f, -0.04878f, 0.111863f, 0.152937f, -0.216281f, 0.233828f, 0.130015f, 0.246066f, -0.068279f, -0.237001f, -0.070252f, -0.228103f, -0.003946f, -0.255297f, 0.150429f, -0.099403f, -0.182798f, 0.154885f, -0.298248f, -0.278022f, 0.027589f, -0.267976f, 0.007088f, 0.305887f, -0.051284f, 0.109064f, -0.095868f, 0.200492f, 0.313525f, 0.162047f, 0.052721f, 0.280387f, 0.256751f, 0.17442f, 0.124757f, -0.275722f, 0.246114f, -0.286086f, 0.272222f, -0.002983f, 0.303536f, -0.271551f, -0.046402f, 0.233947f, -0.073478f, 0.272606f, -0.302506f, -0.096256f, -0.298998f, 0.106279f, -0.075176f, -0.234498f, -0.005387f, 0.042588f, 0.17935f, -0.072784f, 0.194843f, 0.170639f, 0.24253f, 0.114905f, -0.14776f, 0.282714f, 0.27106f, -0.265696f, -0.001059f, -0.274766f, 0.116409f, 0.085611f, -0.293388f, 0.205963f, -0.191952f, -0.251915f, -0.169658f, 0.190717f, -0.131229f, 0.243589f, -0.098578f, 0.087669f, 0.125726f, 0.286785f, 0.195673f, 0.214713f, -0.206828f, -0.253542f, -0.04223f, 0.028484f, -0.134934f, 0.052566f, 0.063444f, -0.086017f, 0.076209f, -0.071815f, -0.11248f, -0.165228f, -0.171105f, -0.29539f, -0.162764f, 0.118768f, 0.290421f, 0.212627f, -0.12151f, 0.232145f, 0.15113f, 0.003079f, -0.049839f, -0.28976f, 0.195441f, 0.290942f, 0.059471f, 0.085621f, -0.227241f, -0.071346f, -0.029469f, -0.216783f, 0.114375f, 0.270517f, 0.024722f, 0.241525f, 0.097153f, -0.021883f, 0.009018f, 0.125561f, -0.291186f, -0.119414f, 0.086094f, 0.096219f, -0.15141f, -0.165815f, 0.18073f, 0.078485f, -0.043409f, -0.246449f, 0.01389f, 0.157073f, -0.103805f, 0.231508f, -0.207817f, -0.227029f, -0.277404f, 0.214043f, -0.144683f, 0.145591f, -0.013927f, 0.180398f, 0.003433f, -0.253846f, -0.079969f, -0.046966f, -0.117092f, 0.022421f, -0.255627f, -0.087967f, 0.278963f, 0.292485f, -0.034172f, -0.047662f, -0.006778f, -0.010179f, -0.024762f, 0.122491f, 0.15268f, -0.249838f, -0.206939f, 0.029543f, 0.089131f, -0.103073f, 0.254959f, -0.250287f, 0.116086f, -0.217581f, 0.221605f, 0.03158f, 0.03877f, 0.0463f, 0.122585f, 0.259729f, 0.145029f, -0.137359f, -0.033222f, -0.066295f, 0.096239f, -0.068837f, -0.264204f, 0.270698f, -0.04618f, 0.260193f, 0.128253f, 0.246393f, 0.184971f, 0.091944f, -0.246167f, 0.196235f, 0.119972f, 0.297918f, -0.200632f, -0.270798f, 0.003353f, -0.097914f, 0.295373f, 0.14438f, -0.017547f, -0.206124f, -0.026367f, -0.005815f, -0.316528f, -0.133826f, -0.15612f, -0.082671f, -0.061399f, -0.12727f, -0.244682f, -0.216222f, 0.130616f, 0.267072f, -0.08353f, -0.20391f, -0.159933f, -0.225267f, -0.171556f, 0.112921f, -0.067631f, -0.170382f, 0.063796f, 0.24055f, -0.309905f, 0.063882f, 0.117773f, -0.058229f, 0.261454f, -0.188267f, -0.296779f, 0.228896f, -0.075339f, 0.186207f, 0.299878f, -0.216423f, 0.194683f, 0.178084f, 0.153027f, -0.048516f, 0.054271f, -0.135394f, -0.298562f, 0.129787f, -0.236469f, -0.132858f, -0.286888f, 0.059662f, 0.209405f, -0.268204f, -0.049174f, 0.220005f, 0.16196f, -0.189921f, -0.141947f, 0.064344f, -0.171685f, -0.110529f, 0.158158f, 0.05275f, -0.231017f, -0.068027f, -0.196323f, 0.045625f, 0.26582f, -0.009243f, 0.191134f, 0.101101f, -0.030611f, 0.272047f, 0.268939f, 0.281306f, 0.220052f, 0.164424f, 0.241012f, -0.194293f, 0.230502f, -0.008794f, -0.215895f, 0.008269f, -0.270221f, 0.233939f, -0.145627f, -0.138689f, -0.048475f, -0.202411f, 0.262036f, 0.112615f, 0.089601f, 0.26435f, -0.2245f, -0.16358f, 0.111037f, 0.11079f, 0.198841f, 0.160845f, -0.280488f, 0.055788f, 0.168732f, 0.246575f, 0.209893f, -0.171199f, -0.164086f, 0.081228f, -0.037295f, -0.068533f, 0.274465f, -0.175669f, 0.225915f, 0.068581f, 0.139412f, 0.17485f, -0.003768f, 0.279516f, -0.020373f, -0.148366f, 0.245712f, -0.017006f, 0.276312f, 0.009118f, -0.16785f, -0.090444f, 0.301664f, -0.174929f, -0.084943f, -0.127127f, 0.153493f, -0.143138f, 0.215314f, 0.267497f, -0.05054f, 0.006868f, 0.175793f, -0.034601f, -0.269776f, 0.012761f, 0.002226f, -0.049792f, -0.143369f, -0.145541f, 0.041697f, -0.222312f, -0.235243f, 0.011786f, -0.071746f, 0.162848f, -0.057363f, 0.252484f, -0.222402f, 0.237415f, -0.201671f, -0.181405f, -0.174279f, 0.159698f, -0.060671f, 0.198255f, 0.085547f, -0.240623f, -0.276432f, 0.072712f, 0.246239f, -0.181802f, -0.050677f, -0.269512f, -5e-06f, 0.20219f, -0.032251f, -0.038034f, -0.167082f, 0.024076f, 0.193464f, 0.040597f, -0.111132f, 0.169679f, -0.250168f, -0.267497f, -0.171472f, 0.009812f, -0.132043f, 0.116459f, 0.194765f, -0.125015f, 0.146258f, -0.170813f, 0.194187f, 0.249607f, -0.074978f, -0.263292f, -0.063866f, -0.093565f, 0.001121f, 0.016699f, 0.248881f, 0.056503f, -0.270408f, 0.110854f, 0.172369f, -0.196054f, -0.185561f, 0.255032f, 0.268082f, -0.247123f, 0.2494f, 0.322164f, -0.004345f, 0.194523f, -0.190406f, 0.007461f, -0.219235f, 0.106865f, -0.06061f, -0.221395f, -0.158934f, -0.245908f, -0.088984f, 0.194224f, -0.008717f, 0.090257f, 0.294524f, 0.104408f, -0.169532f, -0.273348f, 0.212281f, -0.118392f, 0.077096f, 0.238495f, 0.008547f, 0.027849f, -0.059238f, -0.00476f, 0.1071f, 0.056019f, 0.211511f, 0.315467f, -0.056609f, 0.308111f, 0.117597f };
 static const float mlp_perf__32_32__1e_05_layer_2_biases[6] = { 0.236087f, -0.316874f, 0.369539f, 0.253873f, -0.154083f, 0.222205f };
-static const float mlp_perf__32_32__1e_05_layer_2_weights[192] = { 0.058976f, -0.295091f, -0.084945f, 0.078768f, 0.039178f, 0.045697f, 0.334870f, 0.171562f, -0.149173f, -0.033122f, -0.333290f, -0.163340f, 0.330570f, 0.136235f, 0.408093f, -0.082649f, 0.009759f, 0.389494f, 0.080481f, -0.024955f, 0.202557f, 0.104950f, 0.362436f, 0.382093f, 0.233561f, -0.214923f, 0.084852f, 0.337640f, -0.398833f, -0.296643f, -0.042171f, 0.135486f, -0.311941f, -0.136282f, -0.379430f, 0.187686f, -0.253771f, 0.284574f, 0.066408f, 0.092005f, -0.266909f, -0.242158f, -0.144090f, 0.323051f, -0.294902f, 0.002561f, -0.185683f, 0.179826f, -0.159522f, 0.369259f, 0.027074f, -0.052541f, 0.224654f, -0.041956f, 0.274591f, 0.398144f, -0.150724f, 0.295761f, 0.162726f, -0.141583f, 0.373516f, 0.332456f, -0.135454f, 0.326410f, 0.191323f, 0.039227f, -0.187278f, -0.176665f, -0.109964f, 0.321137f, 0.054500f, 0.288644f, -0.216898f, 0.226395f, -0.384632f, 0.021541f, 0.316207f, -0.184146f, -0.043860f, 0.257829f, -0.364568f, -0.319374f, 0.072477f, 0.018257f, 0.239302f, 0.063582f, -0.348758f, 0.401761f, -0.394562f, -0.012629f, -0.012515f, 0.265620f, 0.156732f, -0.304612f, -0.042065f, -0.301983f, 0.354370f, 0.005127f, 0.060908f, -0.221299f, -0.346062f, -0.137244f, 0.289859f, 0.097976f, -0.137596f, 0.053024f, 0.208379f, 0.377497f, 0.384812f, 0.144605f, 0.274407f, -0.107438f, 0.253924f, 0.098089f, -0.007483f, -0.370002f, 0.069261f, 0.320686f, 0.226574f, 0.298180f, -0.006343f, -0.159731f, 0.323172f, 0.034688f, -0.170102f, 0.336816f, -0.267466f, 0.226766f, -0.204223f, 0.231192f, 0.065738f, 0.041218f, -0.032849f, -0.341485f, -0.060206f, -0.205889f, 0.413837f, 0.177515f, 0.167656f, 0.174405f, 0.056188f, 0.182122f, -0.269992f, 0.211403f, -0.378881f, -0.056661f, 0.068582f, -0.287849f, -0.218581f, -0.352753f, -0.340615f, -0.247364f, -0.340683f, -0.277272f, 0.068585f, -0.402071f, 0.020897f, -0.343155f, 0.124038f, -0.150781f, -0.064743f, -0.385281f, 0.320836f, 0.205273f, -0.372770f, 0.268567f, -0.015435f, -0.190072f, 0.021797f, 0.382450f, -0.065878f, -0.176941f, 0.061639f, -0.243302f, -0.026640f, -0.108746f, -0.077867f, 0.160226f, -0.325011f, 0.030103f, -0.221258f, -0.135867f, 0.053934f, 0.053746f, -0.068840f, 0.358565f, -0.310066f, -0.275749f, -0.043834f, -0.120104f, -0.024005f, 0.136528f };
-static float mlp_perf__32_32__1e_05_buf1[600];
-static float mlp_perf__32_32__1e_05_buf2[600];
+static const float mlp_perf__32_32__1e_05_layer_2_weights[256] = { 0.058976f, -0.295091f, -0.084945f, 0.078768f, 0.039178f, 0.045697f, 0.0f, 0.0f, 0.33487f, 0.171562f, -0.149173f, -0.033122f, -0.33329f, -0.16334f, 0.0f, 0.0f, 0.33057f, 0.136235f, 0.408093f, -0.082649f, 0.009759f, 0.389494f, 0.0f, 0.0f, 0.080481f, -0.024955f, 0.202557f, 0.10495f, 0.362436f, 0.382093f, 0.0f, 0.0f, 0.233561f, -0.214923f, 0.084852f, 0.33764f, -0.398833f, -0.296643f, 0.0f, 0.0f, -0.042171f, 0.135486f, -0.311941f, -0.136282f, -0.37943f, 0.187686f, 0.0f, 0.0f, -0.253771f, 0.284574f, 0.066408f, 0.092005f, -0.266909f, -0.242158f, 0.0f, 0.0f, -0.14409f, 0.323051f, -0.294902f, 0.002561f, -0.185683f, 0.179826f, 0.0f, 0.0f, -0.159522f, 0.369259f, 0.027074f, -0.052541f, 0.224654f, -0.041956f, 0.0f, 0.0f, 0.274591f, 0.398144f, -0.150724f, 0.295761f, 0.162726f, -0.141583f, 0.0f, 0.0f, 0.373516f, 0.332456f, -0.135454f, 0.32641f, 0.191323f, 0.039227f, 0.0f, 0.0f, -0.187278f, -0.176665f, -0.109964f, 0.321137f, 0.0545f, 0.288644f, 0.0f, 0.0f, -0.216898f, 0.226395f, -0.384632f, 0.021541f, 0.316207f, -0.184146f, 0.0f, 0.0f, -0.04386f, 0.257829f, -0.364568f, -0.319374f, 0.072477f, 0.018257f, 0.0f, 0.0f, 0.239302f, 0.063582f, -0.348758f, 0.401761f, -0.394562f, -0.012629f, 0.0f, 0.0f, -0.012515f, 0.26562f, 0.156732f, -0.304612f, -0.042065f, -0.301983f, 0.0f, 0.0f, 0.35437f, 0.005127f, 0.060908f, -0.221299f, -0.346062f, -0.137244f, 0.0f, 0.0f, 0.289859f, 0.097976f, -0.137596f, 0.053024f, 0.208379f, 0.377497f, 0.0f, 0.0f, 0.384812f, 0.144605f, 0.274407f, -0.107438f, 0.253924f, 0.098089f, 0.0f, 0.0f, -0.007483f, -0.370002f, 0.069261f, 0.320686f, 0.226574f, 0.29818f, 0.0f, 0.0f, -0.006343f, -0.159731f, 0.323172f, 0.034688f, -0.170102f, 0.336816f, 0.0f, 0.0f, -0.267466f, 0.226766f, -0.204223f, 0.231192f, 0.065738f, 0.041218f, 0.0f, 0.0f, -0.032849f, -0.341485f, -0.060206f, -0.205889f, 0.413837f, 0.177515f, 0.0f, 0.0f, 0.167656f, 0.174405f, 0.056188f, 0.182122f, -0.269992f, 0.211403f, 0.0f, 0.0f, -0.378881f, -0.056661f, 0.068582f, -0.287849f, -0.218581f, -0.352753f, 0.0f, 0.0f, -0.340615f, -0.247364f, -0.340683f, -0.277272f, 0.068585f, -0.402071f, 0.0f, 0.0f, 0.020897f, -0.343155f, 0.124038f, -0.150781f, -0.064743f, -0.385281f, 0.0f, 0.0f, 0.320836f, 0.205273f, -0.37277f, 0.268567f, -0.015435f, -0.190072f, 0.0f, 0.0f, 0.021797f, 0.38245f, -0.065878f, -0.176941f, 0.061639f, -0.243302f, 0.0f, 0.0f, -0.02664f, -0.108746f, -0.077867f, 0.160226f, -0.325011f, 0.030103f, 0.0f, 0.0f, -0.221258f, -0.135867f, 0.053934f, 0.053746f, -0.06884f, 0.358565f, 0.0f, 0.0f, -0.310066f, -0.275749f, -0.043834f, -0.120104f, -0.024005f, 0.136528f, 0.0f, 0.0f };
+static float mlp_perf__32_32__1e_05_buf1[32];
+static float mlp_perf__32_32__1e_05_buf2[32];
+static int32_t mlp_perf__32_32__1e_05_scratch[16];
 static const EmlNetLayer mlp_perf__32_32__1e_05_layers[3] = { 
-{ 32, 600, mlp_perf__32_32__1e_05_layer_0_weights, mlp_perf__32_32__1e_05_layer_0_biases, EmlNetActivationRelu }, 
-{ 32, 32, mlp_perf__32_32__1e_05_layer_1_weights, mlp_perf__32_32__1e_05_layer_1_biases, EmlNetActivationRelu }, 
-{ 6, 32, mlp_perf__32_32__1e_05_layer_2_weights, mlp_perf__32_32__1e_05_layer_2_biases, EmlNetActivationSoftmax } };
-static EmlNet mlp_perf__32_32__1e_05 = { 3, mlp_perf__32_32__1e_05_layers, mlp_perf__32_32__1e_05_buf1, mlp_perf__32_32__1e_05_buf2, 600 };
+{ 32, 600, mlp_perf__32_32__1e_05_layer_0_weights, mlp_perf__32_32__1e_05_layer_0_biases, EmlNetActivationRelu, EmlNetLayerDenseBlocked8 }, 
+{ 32, 32, mlp_perf__32_32__1e_05_layer_1_weights, mlp_perf__32_32__1e_05_layer_1_biases, EmlNetActivationRelu, EmlNetLayerDenseSparseInput }, 
+{ 6, 32, mlp_perf__32_32__1e_05_layer_2_weights, mlp_perf__32_32__1e_05_layer_2_biases, EmlNetActivationSoftmax, EmlNetLayerDenseBlocked8 } };
+static EmlNet mlp_perf__32_32__1e_05 = { 3, mlp_perf__32_32__1e_05_layers, mlp_perf__32_32__1e_05_buf1, mlp_perf__32_32__1e_05_buf2, 32, mlp_perf__32_32__1e_05_scratch, 64 };
 
     int32_t
     mlp_perf__32_32__1e_05_predict(const float *features, int32_t n_features)
     {
         return eml_net_predict(&mlp_perf__32_32__1e_05, features, n_features);
     }
-    
+
 
     int32_t
     mlp_perf__32_32__1e_05_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
     {
         return eml_net_regress(&mlp_perf__32_32__1e_05, features, n_features, out, out_length);
     }
-    
+
 
     float
     mlp_perf__32_32__1e_05_regress1(const float *features, int32_t n_features)
     {
         return eml_net_regress1(&mlp_perf__32_32__1e_05, features, n_features);
     }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_workspace_size(void)
+    {
+        return eml_net_workspace_size(&mlp_perf__32_32__1e_05);
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_predict_workspace(&mlp_perf__32_32__1e_05, features, n_features, workspace, workspace_length);
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_regress_workspace(&mlp_perf__32_32__1e_05, features, n_features, out, out_length, workspace, workspace_length);
+    }
+
+
+    static EmlNetChecked mlp_perf__32_32__1e_05_checked;
+
+    int32_t
+    mlp_perf__32_32__1e_05_check(void)
+    {
+        return eml_net_check(&mlp_perf__32_32__1e_05, &mlp_perf__32_32__1e_05_checked);
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_predict_unchecked(const float *features)
+    {
+        return eml_net_predict_unchecked(&mlp_perf__32_32__1e_05_checked, features);
+    }
+
+
+    void
+    mlp_perf__32_32__1e_05_regress_unchecked(const float *features, float *out)
+    {
+        eml_net_regress_unchecked(&mlp_perf__32_32__1e_05_checked, features, out);
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_predict_logits(const float *features, float *logits, float *margin)
+    {
+        return eml_net_predict_logits_unchecked(&mlp_perf__32_32__1e_05_checked, features, logits, margin);
+    }
+
+
+    void
+    mlp_perf__32_32__1e_05_set_profile(EmlNetProfile *profile)
+    {
+        mlp_perf__32_32__1e_05.profile = profile;
+    }
     
+
+    void
+    mlp_perf__32_32__1e_05_accumulate_reset(float *acc)
+    {
+        for (int32_t o = 0; o < 32; o++) {
+            acc[o] = mlp_perf__32_32__1e_05_layers[0].biases[o];
+        }
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_accumulate(int32_t offset, const float *values, int32_t n_values, float *acc)
+    {
+        return eml_net_dense_accumulate(&mlp_perf__32_32__1e_05_layers[0], offset, values, n_values, acc);
+    }
+
+
+    int32_t
+    mlp_perf__32_32__1e_05_predict_logits_accumulated(float *acc, float *logits, float *margin)
+    {
+        eml_net_layer_activate(&mlp_perf__32_32__1e_05_layers[0], acc);
+        return eml_net_predict_logits_from_unchecked(&mlp_perf__32_32__1e_05_checked, 1, acc, logits, margin);
+    }
+    
\ No newline at end of file
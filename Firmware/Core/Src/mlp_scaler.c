@@ -1,5 +1,8 @@
+#include "mlp_model.h"
 #include "mlp_scaler.h"
 
+#if !MLP_SCALER_FOLDED || MLP_INCREMENTAL
+
 const float MLP_MEAN[MLP_FEATURE_DIM] = {
     1424.379404f,
     161.571138f,
@@ -1205,3 +1208,5 @@ const float MLP_SCALE[MLP_FEATURE_DIM] = {
     2458.505051f,
     953.896434f
 };
+
+#endif // !MLP_SCALER_FOLDED || MLP_INCREMENTAL
@@ -0,0 +1,120 @@
+#include "mlp_model.h"
+#include <eml_net.h>
+const uint16_t mlp_select__32_32__1e_05_feature_index[150] = { 12, 13, 14, 15, 16, 17, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 48, 49, 50, 51, 52, 53, 96, 97, 98, 99, 100, 101, 174, 175, 176, 177, 178, 179, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 354, 355, 356, 357, 358, 359, 372, 373, 374, 375, 376, 377, 384, 385, 386, 387, 388, 389, 426, 427, 428, 429, 430, 431, 450, 451, 452, 453, 454, 455, 468, 469, 470, 471, 472, 473, 504, 505, 506, 507, 508, 509, 528, 529, 530, 531, 532, 533, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 594, 595, 596, 597, 598, 599 };
+static const float mlp_select__32_32__1e_05_layer_0_biases[32] = { 0.20225117f, 0.6907659f, -0.1663811f, -0.32860267f, -1.2721672f, 0.4795698f, -1.9952573f, -1.6898499f, -0.26623756f, -1.5551991f, 0.76474196f, 2.7184477f, 0.053199377f, -0.46422487f, 0.5186158f, -0.26784968f, -0.6434572f, 1.5591756f, 0.07108515f, -0.7385775f, 0.6095433f, -0.5448643f, 1.3653919f, -1.3018328f, -0.30705124f, 1.2038945f, -0.1456531f, -0.5997347f, 1.6116228f, 0.273239f, 0.8709736f, -0.4108465f };
+static const float mlp_select__32_32__1e_05_layer_0_weights[4800] = { -9.998549e-06f, 9.8409466e-05f, 5.3279153e-05f, 2.2675098e-05f, -1.5455425e-05f, -2.3926412e-05f, -4.3016647e-05f, 1.830039e-05f, -5.2422867e-05f, 2.4261239e-05f, -5.560288e-05f, -1.0208299e-05f, 0.00011170569f, 6.6863155e-05f, 2.6566672e-06f, 6.1832357e-06f, 7.127473e-05f, 0.00022150743f, 0.0002489997f, -0.00018602092f, -0.00012267735f, -0.0004173173f, 0.00013610159f, 5.162198e-05f, 2.7537778e-06f, -9.090202e-05f, 3.5692832e-05f, -0.00010851583f, -5.4916614e-05f, -9.474729e-05f, -5.012013e-05f, 0.000105864194f, -4.5308305e-05f, -0.00015301439f, -6.667523e-05f, -0.00013263518f, -0.00019765986f, 4.5123284e-06f, -6.2812896e-06f, 6.058296e-05f, 9.651201e-05f, -0.0002483746f, 0.000103117076f, 9.638467e-05f, 0.00016384204f, 8.080784e-05f, -0.00026291926f, -0.000111006346f, -3.836285e-05f, -1.9549405e-05f, 9.008783e-06f, -4.8947964e-05f, 2.7050488e-05f, -2.87756e-06f, 4.8496968e-05f, -1.27718295e-05f, 1.5528964e-05f, -3.4761735e-05f, 2.5390389e-05f, 9.2920345e-06f, 7.5643e-08f, 2.1457088e-06f, -1.8297673e-05f, 7.578232e-06f, 0.0004499198f, 0.00020262822f, -6.679527e-05f, 3.287125e-05f, 0.00040964814f, -4.638224e-05f, -0.00031512522f, -0.00015458235f, -5.4487515e-05f, 0.00029974576f, -0.00015691387f, 5.668286e-05f, 0.0002752454f, 0.00017694374f, -9.788498e-05f, -9.640178e-05f, 0.00019060509f, 5.1349587e-05f, 7.276282e-05f, -0.00010986708f, 0.00013752574f, 0.0001017221f, -0.0001689616f, -3.0790827e-05f, 5.2352167e-05f, -0.00016365023f, 6.7043155e-05f, -0.00038582517f, -0.0001506844f, 0.00013102224f, 0.00021738542f, 8.890488e-05f, 0.000101046964f, 3.1231197e-05f, -2.3381115e-05f, 5.4764783e-05f, -6.630127e-05f, 2.4155384e-05f, -3.5719495e-05f, 3.2395378e-06f, -4.948197e-05f, 4.176274e-05f, -2.6254904e-06f, -4.3256197e-05f, 2.68641e-05f, -1.02204385e-05f, 1.35261525e-05f, -1.1201275e-05f, -0.00019023044f, 5.1406005e-05f, 0.00015600902f, 3.1504496e-05f, -0.00022126848f, -2.960617e-05f, 0.00044323405f, -0.00013282616f, 4.5735214e-05f, -0.00030811294f, 0.0002640014f, 3.6412937e-05f, -0.00021943533f, -6.8600144e-05f, 9.9942874e-05f, -6.3313655e-06f, -0.000100639525f, -2.4168114e-05f, -0.0001511212f, 3.1581127e-05f, -6.0026552e-05f, 0.000107412474f, -2.4300989e-05f, 2.8866496e-05f, -0.00015850879f, 0.0002902387f, 0.0001389327f, 0.00010526857f, -2.451647e-05f, -1.0185305e-05f, -9.1137306e-05f, -9.375786e-05f, -9.557592e-05f, 1.8568358e-05f, 2.6426698e-05f, -2.2539081e-05f, 6.330298e-05f, -5.494976e-05f, -2.7004957e-05f, 4.71205e-07f, -5.0979008e-05f, -2.3934444e-05f, 6.111413e-06f, 5.0980314e-05f, 1.6269836e-05f, 7.673483e-05f, -1.0796856e-05f, 3.451784e-05f, 0.00013216787f, -0.00018949459f, -0.00018434713f, 7.196316e-05f, 0.0002828367f, 7.130999e-05f, -0.00022699108f, -0.0002105933f, 6.510312e-05f, 0.00021679958f, -0.00017329749f, 6.065608e-05f, -5.263423e-05f, -0.00018475566f, -1.7346529e-05f, 7.819684e-06f, 1.9883532e-06f, 0.00011796922f, 8.014506e-05f, -9.077188e-05f, 2.689306e-05f, -0.00034121625f, 0.00015554499f, 1.789618e-05f, 0.00013825645f, -0.00031727905f, 9.835568e-05f, 7.015892e-05f, 0.00063230976f, 0.00027481132f, 3.4596671e-06f, -7.326546e-05f, -2.3332594e-05f, -1.7954733e-05f, 3.5898058e-05f, 2.7535354e-05f, 7.0012848e-06f, -1.2715762e-05f, -3.9234324e-06f, 7.478284e-05f, 2.5077888e-05f, 1.2423793e-05f, 1.5115049e-05f, 6.678981e-05f, 2.3568728e-05f, -4.9615428e-05f, -3.7181617e-05f, 0.0001091681f, 0.00020039019f, 7.796046e-05f, 5.4641758e-05f, -0.00021479427f, -0.0003594314f, -5.1095135e-06f, -0.00011709595f, -7.68313e-05f, -5.3665866e-05f, -2.0265225e-06f, -8.425458e-05f, 3.1874104e-05f, 0.0001669961f, -0.00011722599f, 4.371543e-05f, -9.871072e-05f, 3.6975427e-05f, 0.0001723503f, -2.2969974e-05f, -6.8455784e-06f, 2.4188581e-05f, 4.2007257e-05f, -1.3056639e-05f, 2.1479296e-05f, -0.00025808546f, -0.0001823555f, -8.226827e-05f, -0.00013110905f, 0.00019133085f, -2.8883549e-05f, -0.00033401442f, -0.00014989795f, -2.422159e-05f, -3.6607966e-05f, -6.0536266e-05f, -4.3462038e-05f, 1.5504455e-06f, -7.9900215e-05f, -1.8609071e-05f, -6.128747e-06f, -6.66117e-05f, -1.8743578e-05f, 1.882791e-05f, 8.95555e-06f, 1.9931345e-05f, 1.7020839e-05f, -1.44087535e-05f, -2.7111786e-05f, 4.5533812e-05f, 0.000104434774f, -1.7322847e-05f, -4.5426055e-05f, -3.8020902e-05f, -1.4653409e-05f, 4.101136e-05f, -5.788415e-05f, 1.2900185e-05f, -1.9711651e-05f, -1.2254893e-05f, -2.27569e-05f, -5.5222637e-05f, -0.00016600551f, -1.37398665e-05f, -3.8258436e-06f, -0.00010551121f, -4.6773454e-05f, 3.148973e-05f, -1.6571627e-06f, -9.383784e-06f, -0.00022005945f, 3.555494e-05f, -6.339987e-05f, -0.00025592555f, -1.156207e-05f, -0.00015902675f, 0.00033279273f, -0.00027677263f, -0.00017731631f, -0.00010909441f, -0.00024960158f, -4.2527754e-05f, -3.8932743e-05f, 5.4051045e-05f, 2.9729765e-05f, -2.6243284e-05f, 8.430286e-05f, -6.0463743e-05f, -5.388832e-05f, 5.315292e-05f, -2.8564332e-06f, 3.5960806e-05f, 4.580115e-05f, -1.579478e-06f, 3.741335e-05f, -4.323174e-05f, 2.2234079e-05f, -1.0247893e-05f, -8.6392196e-05f, 0.000102883445f, -0.000111635294f, 7.5072836e-05f, 8.12015e-05f, -0.00010469295f, -9.997764e-05f, 3.4001063e-05f, -2.2227958e-05f, -0.00014392684f, 0.00012477381f, 6.937969e-05f, -4.0235125e-05f, 5.6455865e-05f, 4.779354e-05f, 0.00010619335f, 2.0430389e-05f, 7.8246565e-05f, 1.9071882e-05f, 2.1778604e-05f, 3.9152354e-05f, 0.00017100753f, 6.4356296e-05f, 0.00042572658f, 3.3513643e-05f, 0.0007093582f, 1.5247623e-05f, -9.709871e-06f, 0.0007403694f, -0.00018182369f, -9.331108e-05f, 6.665991e-05f, 1.7258093e-05f, -5.8743255e-05f, 1.0499257e-05f, -2.9103681e-05f, -6.888332e-05f, 5.427171e-05f, 2.713717e-05f, -5.0835122e-05f, 2.3351076e-06f, -2.0579038e-05f, -4.954506e-05f, 1.0635358e-05f, 3.736524e-05f, 2.1891221e-05f, -3.3898712e-05f, -3.6450416e-05f, 0.00013174654f, -3.072558e-05f, 3.150313e-05f, 1.5098277e-05f, -7.3367715e-05f, -6.2519853e-06f, 2.2115695e-05f, -7.4105075e-05f, -1.000018e-06f, 0.00016092997f, -9.682188e-05f, -0.000105406005f, -3.906137e-05f, 8.347506e-06f, -4.9603488e-05f, -5.620733e-05f, -1.7536964e-05f, -4.1349336e-05f, 2.9742984e-07f, 3.100355e-05f, -9.864717e-06f, -7.789465e-05f, -1.360632e-05f, -0.00028600832f, -0.00013828812f, -0.0005870824f, 9.9987265e-05f, -7.204911e-05f, -0.0004742175f, 0.00018685733f, -7.739922e-05f, 1.0788848e-05f, -2.1899996e-05f, -1.087838e-05f, 6.801854e-05f, 3.418816e-05f, 2.3619068e-05f, -3.1841842e-05f, 2.1242931e-05f, -5.6934397e-05f, -4.5241348e-05f, -1.1284968e-05f, -5.9073896e-05f, -1.2809986e-05f, 1.4280285e-05f, 8.495185e-05f, 3.4603778e-05f, -0.00017580256f, 6.521587e-06f, 6.078854e-05f, 2.534799e-05f, 6.0896023e-06f, 0.00017771895f, 1.9658186e-05f, -7.36077e-05f, 0.00013782563f, -2.1969395e-06f, -2.3609315e-05f, -1.9778669e-05f, 7.2318304e-05f, 0.00016771472f, -0.0001215764f, -4.564993e-05f, 4.2622847e-05f, 5.521106e-05f, -2.3536368e-05f, -2.8962688e-05f, 8.591593e-05f, 0.0001627502f, -1.531634e-05f, 1.3794244e-05f, 2.5313784e-05f, -0.00018006678f, -6.0678554e-05f, 0.00016256118f, -5.573554e-05f, 0.000111035435f, -5.6392546e-05f, -0.00012597034f, 5.7377518e-05f, -1.0947702e-07f, -8.064911e-05f, -0.00011412688f, 0.000103424696f, -3.050465e-05f, 9.544017e-05f, 3.3584904e-05f, 8.52749e-05f, 0.00010798096f, -3.0454635e-06f, 2.8445169e-05f, -5.9908863e-05f, -0.00013014612f, -0.00010480596f, 3.4894427e-05f, 0.00010870629f, 3.1465905e-05f, -0.00013720525f, -0.00013337319f, 5.4491382e-05f, -0.0002359111f, 7.681695e-05f, 9.1269634e-05f, -0.00019940178f, 8.673853e-05f, -2.391555e-05f, 3.58875e-05f, -6.0921106e-05f, -0.0003049977f, 0.00019591734f, 2.270205e-05f, -0.00020128605f, -7.303816e-05f, -6.042524e-05f, 1.7285447e-05f, -9.601945e-05f, -0.0002539507f, 0.00010790824f, -2.558932e-05f, -0.00019233291f, 2.17055e-06f, 0.00017939777f, -0.00040686518f, 0.00045387354f, -0.00011280036f, 0.00035684957f, 0.0002741008f, -6.8841373e-06f, -3.2341155e-05f, 7.318629e-05f, 4.7480564e-05f, -0.00022419145f, 6.5224674e-05f, -0.00013480133f, -3.6259036e-05f, 3.5851103e-06f, -0.00012357795f, 6.238448e-05f, -8.276123e-05f, 6.224925e-05f, 0.00016649887f, 4.199222e-05f, -2.6579604e-05f, 4.1028474e-05f, 7.927627e-05f, 0.00013402641f, 1.9969028e-05f, -4.7288846e-05f, 0.00018190277f, -5.815103e-05f, -1.6120197e-05f, 4.690445e-05f, -0.0001192523f, 2.9916405e-06f, -2.0676733e-05f, 7.3645555e-05f, 0.00016145571f, -0.00014941258f, 2.4594618e-05f, 0.00013476341f, 1.0569516e-05f, 1.28531665e-05f, -9.818923e-08f, 1.012697e-05f, 7.692629e-05f, -4.8206297e-05f, 6.9371294e-05f, 0.00022606115f, -1.8170775e-05f, -0.00023681571f, 0.00026235994f, -0.0005557462f, 3.9810748e-05f, -0.00023719361f, -0.00023275687f, -9.5202566e-05f, -0.00016020823f, 9.667075e-05f, -0.00010394956f, -0.00025498995f, 0.00018048707f, 1.2343609e-05f, 7.258309e-05f, -3.531878e-05f, -0.00019235854f, 2.6606116e-05f, 2.6194613e-05f, 4.013664e-05f, 5.4455384e-05f, -9.594882e-05f, 8.4507126e-05f, -2.599332e-05f, 7.756018e-05f, 0.00017011614f, -0.00015926758f, -0.00010823359f, 2.697299e-05f, 7.483867e-05f, 4.0388795e-06f, -6.714035e-05f, 0.000120443314f, -0.00012964498f, 0.00013208804f, 4.750924e-05f, -0.00023027037f, -4.029695e-05f, 3.4160093e-05f, -0.00029265354f, 0.000107481f, 0.00018699022f, -0.00011215255f, -0.00030908253f, -6.168503e-07f, -0.00018176639f, 0.00010583361f, -9.17644e-06f, -5.3958232e-05f, -0.00010786409f, -8.7404966e-05f, -0.00038175602f, 0.00011876697f, 3.4668377e-05f, -0.00015754877f, 0.000108226726f, 0.000119342854f, -6.5200584e-05f, 0.00018321979f, 0.00018562927f, -0.00016471144f, -8.052391e-06f, -0.00011223664f, 6.330537e-05f, 4.9047772e-05f, 5.0744507e-05f, -7.5028416e-05f, 1.4775565e-05f, 7.5591335e-05f, 7.262404e-05f, -4.2851356e-05f, -2.233095e-05f, -6.6504785e-05f, -0.00015064362f, 0.00019796257f, 0.00017448542f, 9.240859e-06f, -0.00011055408f, -7.941506e-06f, 0.00019185246f, -0.0001227766f, 0.00010169405f, -0.00017212125f, 2.3806322e-05f, 0.00021088534f, 0.00012542124f, -6.383749e-05f, 0.00030913f, -0.00018622936f, -0.0001838047f, 3.7609705e-05f, 0.00024131263f, 2.4694402e-06f, 0.00016895944f, -6.8490284e-05f, -8.641187e-05f, 5.9610196e-05f, -9.551492e-05f, -2.9011226e-05f, 0.0002784242f, -0.00016801235f, 2.846706e-05f, -8.84299e-06f, 7.167802e-05f, 5.537331e-05f, 1.8965598e-05f, -4.8641592e-05f, 3.3237644e-05f, -7.955331e-05f, -2.45312e-05f, 2.6894586e-05f, 3.190888e-05f, -3.1966078e-06f, 6.1381055e-05f, -2.6295136e-05f, 4.052781e-05f, 6.988637e-05f, 5.528883e-05f, -8.377852e-05f, -8.108654e-05f, 5.2143637e-06f, 6.489003e-05f, 4.424778e-05f, -2.3362942e-05f, 8.295294e-06f, -7.573917e-05f, 1.5219343e-05f, -2.2945418e-05f, -9.558068e-06f, -8.741702e-05f, 4.1262883e-05f, -0.00012852247f, -0.00013976572f, -2.9066885e-05f, 1.9959689e-05f, -0.0001320205f, -4.8963542e-05f, -6.843005e-05f, 5.3212403e-05f, -6.563444e-05f, -5.8470065e-05f, -9.554613e-05f, -4.175608e-06f, 6.6489406e-06f, -1.0331872e-05f, -6.502923e-05f, -2.4857505e-05f, -4.972777e-05f, -6.997303e-05f, -3.4875542e-05f, -8.105961e-05f, -3.2153002e-05f, -6.6826724e-05f, 2.0530872e-05f, 2.565651e-05f, 2.3138746e-05f, 3.5201996e-05f, 3.1253321e-06f, 4.936454e-05f, 2.4295832e-05f, 1.0459068e-05f, -5.3365625e-06f, -1.5332611e-05f, -1.50433425e-05f, -2.076685e-05f, -2.7634847e-05f, 2.0719246e-05f, 6.7511035e-05f, 4.3495933e-05f, -9.321398e-07f, -0.00012862937f, -1.83732e-05f, 2.996283e-05f, 5.288084e-05f, 9.327512e-06f, 8.161849e-05f, -4.1277003e-06f, 1.9404215e-05f, -3.1365e-05f, 8.509482e-06f, 6.138936e-05f, 2.0985204e-05f, -4.201531e-05f, 0.00018122305f, 9.3326285e-05f, 2.0047395e-05f, 4.5793393e-05f, 3.4004795e-05f, 4.125471e-05f, 0.00016303129f, -2.4352712e-05f, -0.0001056748f, 2.7432977e-06f, 5.7691796e-05f, 0.000120253186f, -4.4207395e-06f, 0.000116164316f, -2.3567116e-05f, 2.408273e-05f, 6.736863e-06f, 4.480982e-05f, -2.6309297e-05f, -8.666841e-05f, 2.2286016e-05f, -1.7514383e-05f, 3.3064458e-05f, -6.8917674e-05f, 1.2479858e-05f, 2.020947e-06f, -4.2180884e-05f, 2.3651994e-05f, -3.4751076e-05f, 2.280233e-05f, 0.00011292653f, -1.5347529e-06f, 2.5622892e-05f, 4.0648563e-05f, -8.422105e-05f, 6.135633e-05f, 5.1422507e-05f, 2.4557597e-05f, -6.1025545e-05f, -4.881253e-05f, -7.817458e-05f, -8.721358e-06f, -2.3547938e-05f, 4.7300215e-05f, -6.2918974e-05f, -3.9690432e-05f, 5.8968995e-05f, 2.1283997e-05f, -0.00011971463f, -6.893011e-05f, -5.197578e-05f, 3.057566e-05f, -8.790933e-05f, -3.1709114e-05f, -7.293422e-05f, 8.958887e-05f, 0.00013316076f, -7.3708754e-05f, -0.0001397926f, -0.00015915786f, -6.443698e-05f, -0.0001563644f, -1.7117278e-05f, 4.3183973e-05f, -1.9592253e-05f, 1.1692049e-05f, -1.092225e-05f, -1.5477146e-05f, 1.1569552e-05f, 1.6930651e-05f, 4.618083e-05f, -4.7044217e-05f, -1.4594318e-05f, 6.4199585e-06f, -4.288206e-05f, 5.090035e-05f, -3.088509e-05f, 1.4843151e-05f, 9.643682e-05f, -7.4307616e-05f, -2.6810646e-06f, 0.00010648218f, 3.4952766e-06f, 5.6345198e-05f, 0.00011733987f, 3.8158516e-05f, 5.1063187e-05f, -5.2270538e-05f, 1.9713852e-05f, -7.322559e-05f, -1.6222404e-05f, -1.0982392e-05f, -3.40108e-05f, 1.6170849e-05f, -2.8493387e-05f, 2.6135822e-05f, 1.918789e-05f, 3.3135908e-05f, -1.9552592e-05f, 2.5928828e-06f, 3.4029797e-06f, 4.594861e-05f, 2.1724982e-06f, -1.4850102e-05f, -2.147e-05f, -5.6426506e-05f, -2.1050928e-05f, -8.807065e-05f, -5.459842e-05f, -3.9553004e-05f, 4.2972784e-05f, 1.7840224e-05f, -6.521398e-05f, -5.5972505e-06f, -1.5504684e-05f, 2.0567109e-06f, -1.0114559e-05f, -1.9671632e-05f, 2.689949e-06f, -2.4513512e-05f, 9.98368e-06f, 9.525013e-06f, -5.1873076e-06f, -8.204787e-07f, -7.630938e-06f, -1.5347767e-05f, -1.2052694e-05f, 2.0999556e-05f, -3.283939e-05f, -1.9374864e-05f, -1.5991558e-05f, -1.7459648e-05f, -9.195336e-06f, -6.813144e-05f, -5.5240227e-05f, -7.6298944e-05f, 2.3695953e-05f, -3.8124315e-05f, 6.8793386e-05f, 3.230599e-05f, 1.2611592e-05f, -1.5033096e-06f, 4.1901836e-05f, 3.524717e-05f, 3.0128012e-05f, -4.5535515e-05f, 4.8028505e-05f, -1.9264466e-05f, 1.18011985e-05f, -2.7180196e-05f, 3.5176894e-05f, -4.7563803e-06f, 4.8203437e-05f, -1.19188935e-05f, -3.4726254e-05f, -5.0190465e-05f, -0.00011727705f, 1.7143047e-05f, -6.377162e-05f, -0.00013414037f, -8.111044e-06f, 4.8466845e-05f, -1.3748178e-05f, -5.8592486e-05f, 3.8427526e-05f, 9.606876e-06f, 8.163388e-06f, -1.6881815e-05f, -9.52252e-06f, -2.3201223e-05f, -4.9532744e-05f, -1.5318577e-06f, 2.6410506e-05f, -5.6044865e-07f, 6.197465e-05f, -6.343001e-05f, -1.9718686e-05f, -2.5486876e-05f, 2.2086222e-06f, 3.9683786e-05f, -9.096208e-05f, 3.3307654e-06f, -8.810204e-05f, 4.9857194e-06f, 7.1595714e-06f, 8.460297e-06f, -0.000114856324f, 1.8190506e-06f, -4.7699203e-05f, -2.422375e-05f, 2.8417217e-05f, -1.732217e-05f, -8.683273e-06f, -5.6402187e-06f, 7.260257e-05f, 6.562441e-05f, -3.0925253e-06f, -2.04428e-05f, -1.2379589e-05f, 2.4976625e-05f, 6.391001e-05f, -4.2782685e-05f, -4.54155e-05f, 0.00018238429f, -8.8006775e-05f, -0.00010907043f, -6.1379564e-05f, -1.3698917e-08f, -4.1137715e-05f, 3.0297995e-05f, -1.601735e-05f, 7.43437e-05f, 4.928972e-06f, -1.1414578e-06f, -2.7397946e-05f, 6.5153185e-06f, 1.04088895e-05f, 2.1621814e-05f, -7.5938156e-06f, -6.9689263e-06f, -2.1036545e-05f, 2.8158187e-05f, -2.9387113e-06f, 2.316578e-05f, 9.896242e-05f, 5.4771102e-05f, -0.00013206385f, -4.2849588e-05f, 1.6833715e-07f, -9.425338e-05f, -0.0001772948f, -3.504014e-05f, 3.540356e-05f, 5.07393e-05f, 6.8274916e-05f, -2.9024872e-05f, -3.030869e-06f, 1.110278e-05f, -1.2926632e-05f, 5.667072e-06f, -9.896085e-06f, 6.136885e-05f, 3.0760704e-05f, -1.6301616e-05f, 2.4671826e-07f, -3.2608186e-05f, -5.745485e-05f, 8.952149e-05f, 4.0718e-05f, 2.8028262e-05f, -1.3143516e-05f, 0.000111774614f, -6.952435e-05f, -0.00014229742f, -9.3208626e-05f, 6.5863234e-05f, -4.674354e-06f, -1.1533061e-05f, -1.8818588e-05f, -2.7706043e-05f, -4.5202654e-05f, 1.9743547e-05f, -9.889727e-06f, -8.625249e-06f, -2.7540733e-05f, 2.2232214e-05f, -2.0628817e-05f, -9.700184e-06f, 2.0083313e-05f, -2.548798e-05f, 1.1531488e-05f, -1.6614043e-05f, -6.350025e-05f, -1.7760723e-06f, 0.00013731694f, 3.273118e-06f, -5.7496418e-05f, -4.1689844e-05f, 0.00011388515f, -6.0278937e-05f, -1.880685e-05f, -6.135554e-05f, 2.8919045e-05f, -3.3762284e-05f, -7.327823e-05f, -8.390389e-05f, 6.813227e-07f, -5.316044e-05f, -2.3650597e-05f, -1.3634436e-05f, 4.3948152e-05f, 4.3473086e-05f, 1.6979355e-05f, 8.8848465e-06f, -4.0816627e-05f, 4.3223637e-05f, -0.00010667046f, 0.0001267556f, -0.000104723506f, 0.0001440815f, -0.00012784502f, -8.6388696e-05f, -5.3818894e-05f, -3.3345965e-05f, 0.00012786784f, -4.1219868e-05f, 0.0001610116f, 0.00010547397f, 8.928622e-07f, -3.9672464e-05f, 6.404531e-05f, 0.000116154195f, 0.000113786075f, -1.7519098e-05f, -9.819611e-05f, -3.9553313e-05f, 7.457245e-05f, -5.9620983e-05f, -5.1719064e-05f, -3.900325e-05f, 0.000103554805f, -3.5185574e-05f, 0.00014623035f, 0.00026615075f, 0.00029927524f, 0.00014642783f, 0.00044574318f, 0.00017792951f, -0.00014689416f, -6.0055237e-07f, 0.000208974f, 7.231051e-05f, -0.00030042054f, 0.00031353065f, -0.000126085f, -0.0001664471f, 0.00036228748f, -4.8448346e-05f, -6.704663e-05f, 5.3444513e-05f, 0.00010272704f, -0.000107315806f, -1.1885963e-05f, 3.114097e-05f, -0.0002773534f, 4.307735e-05f, -0.00042738862f, -9.104652e-05f, -0.00015694069f, -0.0003486637f, -0.00034372625f, -0.00021061633f, -0.00021667659f, 2.9409126e-05f, -0.00021779774f, -0.00014675688f, 1.9568659e-05f, 3.3993703e-05f, -0.00011619342f, -0.00018028502f, -0.00018815437f, -2.9342398e-06f, 1.9583355e-05f, 7.054598e-05f, -6.63151e-05f, -1.0143767e-05f, 4.7930476e-05f, -3.846999e-05f, -0.0007053003f, 0.0002443886f, -0.00037596724f, -0.00053205696f, -0.00045871933f, -0.00024939902f, -0.0006243311f, -0.00024481938f, 8.82862e-05f, 8.348219e-05f, -0.0002144789f, -0.00021245304f, 0.00023502391f, -0.00040878367f, 8.4746694e-05f, 0.00035288595f, -0.0006622123f, 0.00022067298f, 8.347478e-05f, -6.323632e-05f, 5.7849566e-06f, 0.00013490567f, -2.3263432e-05f, -0.00015497493f, 0.00025657352f, 0.00013562068f, 0.00030447496f, 0.00014783777f, 0.00025498876f, 0.0006112873f, 0.00023977629f, 2.3702645e-05f, 1.7525694e-05f, -5.951355e-05f, 5.5119184e-05f, 7.787625e-05f, -7.1769515e-05f, 2.0825753e-06f, 1.2426755e-06f, 3.237612e-05f, 9.0256144e-05f, -1.1556341e-05f, 3.5088167e-05f, -1.9764044e-05f, -4.0051177e-06f, 3.079621e-05f, -4.6965e-05f, 5.1611474e-05f, 0.00046228513f, -5.505106e-05f, 0.00015363788f, 0.00037463356f, 0.00010698866f, 0.00011641809f, 0.00031376356f, 0.000172796f, 6.4448424e-05f, -5.3938253e-05f, -2.4645733e-06f, 0.00016708508f, 4.887956e-05f, 0.00019068521f, 5.618154e-05f, -0.00022565824f, 0.0003541236f, -0.00016653666f, 6.688448e-05f, 3.7877955e-05f, -0.00013449667f, -1.0516997e-05f, 5.1312843e-05f, -1.1598397e-05f, -9.4010604e-05f, 1.6193244e-05f, -0.00015764077f, 7.239854e-05f, -0.00015681061f, -0.00031246725f, -6.504546e-05f, 0.00014180638f, 2.6524645e-05f, 5.5472024e-06f, 6.9123043e-06f, 4.1859906e-07f, -9.921897e-07f, 7.133232e-06f, 9.4881325e-06f, -1.4370649e-05f, 1.6228047e-05f, 3.260047e-05f, -5.719195e-05f, -1.4950661e-05f, -2.1513475e-05f, 2.5125812e-05f, 6.9463385e-06f, 1.7779153e-05f, -2.3418794e-05f, -3.5568268e-05f, 8.8221175e-05f, 8.961251e-06f, 2.0713756e-05f, -6.809195e-05f, -4.3843516e-05f, 3.1647767e-05f, -6.9148526e-05f, -3.0372503e-05f, -4.433126e-05f, -7.313875e-05f, -5.0854997e-05f, -1.9636575e-05f, -6.2817567e-06f, 1.8051147e-06f, 1.2624645e-05f, -8.436231e-06f, -5.0229093e-05f, 5.4316963e-05f, 0.00012698103f, -9.894676e-05f, -3.7463276e-05f, 4.4444834e-05f, 9.839418e-06f, 5.4870943e-05f, 7.683085e-06f, 6.659583e-05f, -9.2242495e-05f, -0.00012028585f, 5.4044854e-06f, 9.242103e-05f, 2.1266549e-05f, 1.2314664e-05f, -2.6554973e-05f, -8.924069e-06f, -6.433247e-05f, 2.4212139e-05f, -5.162497e-05f, -5.7283058e-05f, 1.0861574e-05f, -2.3710656e-05f, 1.0926326e-05f, -5.9345748e-05f, -1.0857391e-05f, 2.5301297e-05f, -5.5546396e-05f, 1.0885124e-05f, 0.0002870973f, -0.00011646763f, 0.0001259224f, 0.0001031816f, -0.00025182954f, -0.00029604122f, 0.00019674528f, 0.000102763304f, -7.337007e-05f, -1.2934125e-05f, 9.0093e-05f, 0.00018029322f, 9.4799034e-05f, 8.807547e-05f, 7.583742e-05f, 5.7410743e-06f, 2.6628999e-05f, 7.4109754e-05f, -0.00016691316f, -6.287281e-05f, -5.9351703e-05f, -2.0877886e-05f, 3.0080967e-06f, 0.00026287325f, -8.159786e-05f, -1.1938147e-06f, -1.5397385e-05f, -0.00033696377f, 0.00010950204f, -0.0002273301f, 9.502316e-05f, -2.4710322e-05f, 5.9455397e-05f, 3.464987e-05f, 1.5447829e-06f, -8.596534e-05f, -6.661376e-05f, 3.2859767e-05f, 4.2050226e-05f, 4.7303478e-05f, -9.330721e-06f, 1.567696e-05f, 3.1757543e-05f, 3.232131e-05f, -2.5865236e-05f, 1.2889502e-05f, 3.5145073e-05f, 1.6678978e-06f, 5.6209105e-05f, -0.00020148729f, -0.00019748864f, 0.000115309216f, 4.9217288e-05f, 8.203713e-05f, 0.00011565079f, -0.00018875556f, 0.00016790062f, -0.00011747957f, -0.0002898215f, -4.318627e-06f, -1.2668825e-06f, -0.00017852307f, -2.4852839e-06f, 4.0655315e-05f, -4.7924677e-05f, 0.00011124518f, 4.8457827e-05f, -8.828094e-05f, -0.00016246518f, -6.585629e-05f, 6.261363e-05f, -0.0002022093f, -2.3049279e-05f, -8.293226e-05f, -0.00022507663f, 0.0002750392f, 5.1375577e-05f, 0.00011243674f, -0.0002972814f, 0.00015498395f, -0.00010817812f, -1.0567105e-05f, 4.680519e-05f, 0.00015438f, 6.0926588e-05f, -0.00010798971f, 4.415705e-05f, -6.08652e-05f, 1.41143555e-05f, -2.3837423e-05f, -3.6090547e-05f, 3.8897564e-05f, -8.461988e-06f, -1.9273779e-05f, -4.7638434e-05f, -9.78106e-06f, 2.3330536e-05f, -7.334476e-05f, 0.00017572976f, 2.303858e-05f, -0.00030272026f, -9.2022616e-05f, -0.00027806388f, 0.00012834286f, -0.00016652033f, 5.6782505e-05f, 0.0002688178f, 0.00010998293f, -7.333491e-05f, 0.00027821184f, -2.3944227e-05f, 5.627598e-05f, 4.558377e-06f, -2.911117e-05f, -0.0001984807f, 0.00015040374f, 0.00013652645f, 0.00018964887f, -0.00020833852f, 0.00029830166f, -0.00019166748f, 5.8284462e-05f, 0.00011251064f, -0.0003325553f, 0.00018692829f, -7.009783e-05f, 0.00023213601f, -8.378267e-05f, 9.4840696e-05f, -9.642612e-06f, -1.3282262e-05f, -9.857642e-05f, -5.6325196e-05f, 0.0001188743f, -5.2347154e-05f, 5.6767687e-05f, 1.689415e-05f, 5.643587e-05f, 2.3639934e-05f, -7.518896e-05f, -2.2298702e-05f, 8.164743e-06f, -2.5689216e-05f, -1.2679019e-05f, -3.1903102e-05f, 0.0001754193f, 0.00011105018f, -1.5020174e-05f, 4.2792748e-05f, -0.00018876848f, 0.00012891662f, -8.5837695e-05f, -5.2662886e-05f, -2.601852e-05f, 4.606731e-05f, -2.3809176e-05f, 0.00028997546f, -9.040868e-05f, 4.1430252e-05f, -4.8090093e-05f, -0.00022819337f, -4.0064035e-05f, 0.00016713311f, 0.00020921968f, 3.191656e-05f, -2.5992317e-06f, 2.3452296e-05f, -0.00010464432f, 0.000120942874f, -3.0154586e-06f, -0.00025303545f, 2.1750106e-05f, 4.3595122e-05f, 0.0002613924f, -2.4201758e-05f, -4.6794685e-05f, 5.1376148e-05f, -2.1985556e-05f, -2.687482e-05f, -3.0583516e-05f, -7.296278e-06f, 4.3926608e-05f, 5.41837e-06f, -1.0852327e-05f, 3.1489164e-06f, -6.105603e-05f, 5.0551196e-05f, -5.9007674e-05f, -9.678599e-07f, -3.8207345e-05f, 5.1177172e-05f, -8.308804e-05f, -5.1930692e-05f, 2.3769335e-05f, -3.6180327e-06f, -0.00012937596f, 0.00012413728f, -0.0002522445f, -3.904455e-05f, -1.2057285e-05f, 8.299514e-05f, 8.291804e-05f, -5.6133333e-05f, 0.00014445365f, -0.00014032322f, 3.4971978e-05f, -2.5674428e-05f, 6.689141e-05f, 4.5439934e-05f, -0.00015184109f, 0.00018380405f, -1.9437599e-05f, -1.381308e-05f, -5.158937e-05f, 0.00022192148f, 5.5515047e-06f, 9.647599e-06f, -0.00025461646f, -0.0002753271f, 6.36651e-05f, 0.00037370622f, 4.474392e-05f, 4.2729374e-05f, 0.0001297785f, -7.681505e-06f, 5.523015e-05f, -3.3027307e-05f, -3.9597664e-05f, -6.9324306e-05f, 2.7558095e-05f, -6.795529e-05f, -4.9567603e-05f, 4.4861106e-05f, 7.748575e-05f, -1.34674665e-05f, -2.0090607e-05f, -3.2696524e-05f, 3.0994524e-05f, -2.1856897e-05f, 7.3889555e-06f, -0.00011903814f, -8.006733e-05f, 0.00013024881f, 0.00010733621f, -4.3013042e-05f, -4.127058e-05f, -8.5368476e-05f, 6.498328e-05f, -0.00015071886f, -4.3011107e-05f, -3.9060644e-05f, -2.609357e-05f, 0.00010810763f, 0.00013586288f, 0.00010934717f, 7.756119e-05f, -4.2210636e-06f, 3.4515186e-05f, -0.00018310784f, -4.833851e-05f, -2.4804189e-05f, 0.000112354275f, -0.00011782641f, -2.0567255e-05f, -0.00037795847f, -0.0003364244f, -0.00012358231f, -0.000110911766f, 0.00020616986f, 0.00012798837f, 0.00014369415f, 6.8809604e-05f, 1.5601605e-05f, 0.000120556644f, -2.6839749e-05f, -3.462194e-05f, -5.8391248e-05f, -5.1007166e-05f, -3.091607e-05f, -4.65261e-06f, 6.204747e-05f, -2.4086978e-05f, 2.0651656e-05f, -2.33593e-05f, -7.1682385e-05f, -2.3763607e-05f, 3.5714467e-05f, -4.9941344e-05f, 7.8348945e-05f, 3.0130092e-05f, -5.2104983e-06f, 0.00011530737f, -7.675961e-05f, -3.882533e-05f, -0.00011862959f, -0.0003118122f, -4.2053205e-05f, 2.5452318e-05f, 1.2520195e-05f, -3.958457e-05f, -1.4832475e-05f, -7.731751e-05f, -0.00014202614f, 3.8030998e-05f, 0.000107976084f, 8.817467e-05f, 0.00012338278f, 0.00014820785f, -3.8070695e-05f, -7.5970593e-06f, 1.0348809e-06f, -4.8796857e-05f, 0.0006047956f, 0.0003646298f, -1.3256006e-05f, 0.0005307171f, -0.00015293038f, -0.00017064437f, -0.00036642482f, 0.00015074803f, -2.0002064e-05f, -7.47332e-05f, 4.7390415e-05f, 1.8094066e-05f, 4.363176e-05f, 6.245121e-05f, -3.6166275e-06f, -5.4450306e-06f, -2.2114544e-05f, 5.631679e-06f, 4.8501747e-06f, 1.3855134e-06f, 5.415275e-05f, -1.5207231e-05f, -1.356032e-05f, 5.9205236e-06f, -2.4633293e-05f, -0.00018951761f, -6.9283824e-06f, 1.8056026e-05f, 0.000110628f, 8.096674e-05f, 0.00016159035f, 0.0002264048f, -1.1485498e-05f, 6.805203e-05f, -0.0001362672f, 4.8067006e-05f, -1.0940034e-05f, 0.00012135125f, 7.5255506e-05f, -6.831993e-05f, -5.354245e-05f, -8.980355e-05f, -8.999159e-05f, -9.115111e-05f, -3.8133028e-06f, -3.395075e-05f, 1.3867509e-05f, 1.08903105e-05f, -0.0004647425f, -0.00050645554f, -8.970254e-05f, -0.00027990446f, 0.0003334962f, 6.638232e-05f, 0.0004812732f, -0.00012301236f, 0.00010356334f, 4.398741e-06f, 3.9777347e-05f, -5.555006e-05f, -5.0611474e-05f, -4.25488e-06f, -8.046125e-05f, -3.6577916e-05f, -5.916896e-05f, 5.3702355e-05f, -3.5887338e-06f, 2.982961e-05f, 5.003153e-06f, -1.0045588e-05f, -3.2337735e-05f, 2.9303208e-05f, -5.2587802e-05f, -0.0001985573f, 9.765855e-05f, -0.000114081f, 8.707764e-05f, -0.00022628721f, -4.0181818e-05f, 1.1305879e-05f, 0.0002586167f, 5.1501658e-05f, -2.3578037e-05f, 6.2904866e-07f, -2.4274204e-05f, -0.000112016896f, 1.9824194e-05f, -1.0747376e-05f, 7.5471886e-05f, -4.1124647e-05f, 7.0281494e-05f, -9.627903e-06f, -2.1340373e-05f, 2.2112648e-05f, 6.743588e-05f, -3.258515e-05f, 3.7533522e-05f, -8.649125e-05f, 8.527619e-05f, 7.861627e-05f, 0.00022966416f, 9.548901e-05f, 2.0851643e-05f, -0.00016226077f, -0.00016371431f, -6.9442576e-05f, -5.3538017e-05f, 3.6341284e-05f, -6.0810003e-06f, -4.0108564e-05f, 8.264848e-05f, 2.5589616e-05f, 2.4984596e-05f, -6.781033e-05f, 5.0502014e-05f, 8.4267565e-05f, -5.60886e-05f, 8.8767214e-05f, 8.840083e-05f, 6.9865487e-06f, 5.182266e-05f, 0.00027316116f, -0.00022100908f, 0.0002454468f, 6.542066e-05f, 0.0003168366f, 8.803008e-05f, 0.0001776502f, -0.0003396951f, -0.00018122426f, -1.5055128e-05f, -7.6516535e-06f, -2.8030807e-05f, 0.00021033602f, 0.00012341717f, -1.847425e-05f, -0.00010559634f, 4.0541945e-05f, -0.00019384128f, -4.8599373e-05f, -9.27661e-06f, 2.6008387e-05f, -0.00013577678f, 0.00015657027f, 2.9710332e-05f, 3.445876e-05f, 0.00013582654f, -0.00021112747f, -0.0005404623f, -0.00043340883f, -6.758447e-05f, 0.00025145969f, 9.685694e-05f, 7.148848e-05f, 1.5175956e-05f, 3.1563425e-06f, 4.2749896e-05f, 4.8324353e-05f, -5.5527653e-05f, -1.5874615e-05f, 4.467363e-05f, 4.774399e-05f, -1.4343373e-05f, -8.264486e-05f, 5.570551e-05f, -6.3251864e-05f, -4.4310553e-05f, -2.251962e-05f, 1.0311309e-05f, -0.00017248288f, 0.00015257062f, -4.4130258e-05f, -0.00015350977f, -0.00024162042f, -4.464715e-05f, -0.00016947713f, 7.5017255e-05f, 0.0001721927f, -5.0400562e-05f, -3.954911e-05f, 6.503412e-05f, -0.000120896715f, -0.00023125265f, -2.057046e-05f, 1.7730492e-05f, 6.5665e-05f, 9.940065e-05f, 2.995004e-05f, -6.396097e-06f, 6.791183e-05f, 7.876213e-05f, -0.00019124182f, -0.00012836595f, -0.000107386644f, -0.00016541965f, 0.00018722285f, 0.00042172882f, 0.00046080217f, 0.00010532974f, -0.00019336473f, -3.9265436e-05f, 1.1841381e-05f, -0.00015586472f, -8.099781e-06f, 0.0001640306f, -0.00017786934f, -0.00022595197f, 0.00028142348f, 2.953671e-05f, 8.061244e-05f, -7.515516e-05f, -9.3375136e-05f, -7.4822215e-06f, -0.00011521286f, 1.052242e-05f, -6.456424e-05f, -4.045144e-05f, -0.00024863268f, -2.0697296e-05f, -0.00014353903f, -0.00014254403f, -5.5828477e-05f, 0.00018649265f, -4.8178867e-05f, 1.3219864e-05f, -6.738593e-07f, 7.139397e-05f, 1.3573008e-05f, 4.5291963e-05f, 0.00011540511f, 0.00018813844f, 0.00010234731f, 0.00021173991f, 0.00013487625f, -0.00015464817f, -5.0562157e-06f, 0.0003201322f, 0.00013343658f, -0.0001647853f, 0.00018309985f, 7.0900736e-05f, 7.2598225e-05f, -0.00018401374f, 1.7847849e-06f, 0.00024672862f, 7.1272174e-05f, 6.262177e-05f, -9.23279e-05f, 3.9224426e-05f, -4.9246287e-06f, 0.00021628423f, -5.2012725e-05f, -0.0001666062f, 9.889906e-05f, 0.000116394396f, -0.00019919233f, 6.874415e-06f, -3.604558e-05f, 1.3224642e-05f, -4.6539044e-05f, -2.045597e-05f, -4.7612616e-06f, -5.706656e-05f, 6.1638486e-05f, 6.94429e-05f, 0.000110685694f, 0.00010354834f, 0.00022226234f, 9.6854346e-05f, 2.7915845e-05f, -4.9347826e-05f, -3.750554e-05f, 1.2624671e-05f, 6.03455e-05f, 1.4888396e-05f, -2.9341589e-05f, -1.4089558e-05f, -0.00018011864f, -0.00012072402f, -0.00010540993f, -0.00015050253f, -7.9439065e-05f, 0.0001458972f, -4.456829e-06f, -0.0003191011f, -6.711215e-05f, 4.7076926e-05f, -0.00017637272f, -7.5264106e-05f, -8.77942e-05f, 0.000113472044f, -9.851083e-06f, -0.0002645863f, -0.000109751585f, -2.5060745e-05f, 0.00021247518f, -1.698974e-05f, -6.0614643e-06f, 8.080551e-05f, 2.9051755e-05f, 3.717254e-05f, 3.460311e-05f, 2.0570427e-05f, -7.701595e-05f, 8.44018e-05f, 6.1150575e-05f, 6.0330804e-05f, -0.00013627927f, -7.2617506e-05f, -7.719713e-05f, -2.6460384e-05f, 7.0854144e-06f, 6.277154e-05f, -0.00015456494f, 5.50831e-05f, 8.190494e-05f, 3.2389646e-05f, 3.1997683e-05f, -2.8591852e-05f, -8.054037e-06f, -9.377529e-05f, -5.9346956e-05f, -8.4629624e-05f, 0.00013398318f, 5.9871367e-05f, 0.000100599915f, -2.2129065e-05f, -3.771476e-06f, -4.394349e-05f, -7.3204355e-05f, -0.00012086751f, -3.461195e-05f, 0.00010392624f, 4.051904e-05f, 3.997801e-05f, -4.6181907e-05f, -1.1675027e-05f, -6.559436e-05f, -7.1917144e-05f, 1.2474787e-05f, 3.0289368e-05f, 1.4990329e-05f, -7.513032e-05f, 0.000121018165f, -4.3893084e-05f, 2.9399389e-05f, -8.632066e-06f, -1.0220429e-05f, -5.6143894e-05f, -4.75045e-05f, -4.3793803e-05f, 1.5960928e-05f, 8.701119e-06f, 3.485657e-07f, -5.4865952e-05f, 4.8396745e-05f, 4.5659486e-05f, 4.9475686e-05f, 2.8262812e-06f, -1.9265042e-05f, -4.955994e-05f, 3.71962e-06f, -7.0629385e-06f, -2.2566279e-05f, -2.5374186e-06f, -1.8791463e-05f, 2.176357e-05f, -1.8030214e-05f, 3.164042e-05f, 8.038675e-05f, 8.1569306e-05f, -4.7559075e-05f, 3.8959675e-05f, -8.197056e-05f, -2.4061328e-05f, 1.0278515e-05f, 5.2178457e-05f, 9.541994e-05f, 0.00017318582f, 6.496346e-05f, -0.00012322176f, -9.714097e-05f, -2.4987282e-06f, 1.4768515e-05f, 1.16595265e-05f, -8.608771e-06f, -6.9751586e-05f, -6.510289e-05f, 1.6575364e-05f, 4.8229333e-05f, 0.0001450045f, 6.0242786e-05f, -6.6927154e-05f, -4.982021e-05f, -3.0257743e-05f, 5.7072553e-05f, 7.6725264e-05f, -5.7249435e-05f, 8.1424e-05f, -4.9804858e-05f, -7.462714e-05f, 5.8790964e-05f, 4.1914127e-06f, -5.389727e-05f, -2.6653557e-05f, -6.503354e-05f, -5.022645e-05f, 0.00010136108f, -1.6785481e-05f, -2.9647577e-05f, 0.00012399943f, 3.3076125e-05f, -7.455128e-05f, 7.996382e-06f, 8.103499e-05f, -9.8306315e-05f, -1.29801365e-05f, -2.0155101e-05f, -2.574143e-05f, -2.9085755e-05f, -6.5838e-05f, 2.3180142e-05f, 3.7524922e-05f, 1.3381382e-05f, -1.3052991e-05f, 3.329244e-05f, -0.00010212719f, -9.012081e-05f, 5.5958226e-05f, 9.9521254e-05f, -6.505468e-05f, -2.5312376e-05f, -2.9993587e-05f, 2.0683385e-05f, -5.3557702e-05f, 0.0001594514f, -1.5167853e-05f, -8.830457e-05f, -0.00017475052f, 9.419417e-05f, -4.9634236e-05f, -9.2674945e-06f, 5.6829185e-06f, -1.120612e-05f, 3.3166085e-05f, -4.5642337e-05f, 2.888879e-05f, -1.76342e-05f, -1.2732572e-05f, -6.520755e-06f, 4.8011316e-05f, -1.4751433e-05f, -1.5831687e-05f, -6.8145614e-06f, -5.887243e-05f, -1.8562436e-05f, -9.30149e-05f, -3.630745e-05f, -3.849842e-05f, 0.00018557813f, -0.00014211268f, 5.1566825e-05f, -7.92477e-06f, -5.0285358e-05f, -2.1819571e-05f, -2.1534483e-05f, -3.1580075e-05f, -7.1155782e-06f, 3.7625705e-05f, 7.1322665e-06f, 1.1604242e-05f, -1.4797976e-06f, -5.834685e-05f, 6.576909e-06f, 3.5272123e-08f, -2.1329051e-05f, 5.4718444e-06f, 2.2125007e-05f, -6.336728e-05f, -1.465108e-05f, -3.6283652e-06f, -1.0113716e-06f, 5.468821e-05f, 8.514799e-05f, -4.410394e-05f, -2.8489772e-05f, 6.162491e-05f, -8.621867e-08f, 9.092922e-06f, -1.6478683e-05f, 4.215007e-06f, 2.7394477e-05f, -1.2015658e-05f, 2.1270744e-05f, 1.7936843e-06f, -1.6500929e-06f, -9.307349e-06f, -1.933151e-05f, 8.821424e-06f, 1.2504372e-05f, 1.2962265e-06f, -2.1028805e-05f, -1.21529265e-05f, -9.156333e-05f, -2.3261724e-05f, 1.3567058e-06f, -4.9281258e-05f, 8.201008e-05f, -3.2729844e-05f, 6.9052276e-06f, 5.308234e-06f, -3.850449e-05f, 3.9755196e-05f, 1.8799006e-05f, 7.263816e-05f, 2.0102909e-05f, -4.9791157e-05f, 1.9032328e-05f, 1.5773589e-05f, -1.9303918e-05f, -1.4288161e-05f, 5.3669664e-06f, 4.0919545e-05f, -1.5490503e-05f, -3.0403053e-05f, 3.8265094e-05f, -3.801337e-05f, -8.834957e-05f, -9.469391e-05f, 5.1606603e-05f, -1.4026534e-05f, -1.9488664e-07f, 9.413023e-05f, 4.3800726e-05f, 0.000118184755f, 7.53942e-06f, 1.2911406e-06f, 1.2337893e-05f, -1.1645554e-05f, 9.082239e-06f, 6.113196e-05f, -5.1404295e-05f, -6.6131142e-06f, 1.7825994e-05f, -6.171516e-06f, 2.7030894e-06f, -1.6615966e-05f, -2.9491204e-05f, -4.5756413e-05f, 3.4580615e-05f, -6.251023e-05f, 3.305557e-05f, 3.421989e-05f, 8.592661e-05f, 5.9723105e-05f, -3.0284855e-05f, 3.087484e-05f, 1.4853951e-05f, -2.7000226e-05f, 5.0772833e-06f, -5.3170694e-05f, -0.000118850054f, 1.1254762e-05f, 4.8854115e-05f, 3.5863308e-05f, -1.4460748e-05f, 1.6347071e-06f, 5.0091796e-05f, 1.1753661e-05f, 2.9444653e-05f, 1.986919e-06f, -9.617722e-06f, 3.9155543e-06f, -3.8168193e-05f, -1.3164802e-05f, -7.067242e-05f, -6.169252e-05f, -5.391939e-05f, 0.00012629715f, 2.2766835e-05f, -3.475395e-05f, 0.0001484333f, -6.9789276e-06f, 6.157507e-05f, -2.0970981e-05f, -9.031472e-06f, 1.5514292e-05f, -2.5726682e-05f, 3.0000121e-05f, -2.5355244e-05f, -2.1122225e-05f, 5.4441618e-05f, -1.3459656e-05f, -9.355356e-06f, 4.069374e-06f, -2.5558458e-05f, -4.6470996e-05f, -8.7179146e-08f, -1.0591771e-05f, -6.50914e-06f, -1.679705e-05f, 8.322835e-05f, 1.9480196e-05f, -1.7052773e-07f, -2.8913413e-05f, 7.387811e-05f, -9.776524e-05f, 7.844439e-05f, -5.687094e-05f, -4.208675e-06f, 6.69212e-05f, 4.0888613e-06f, 7.6275544e-05f, 5.65154e-06f, -4.694302e-05f, 4.0796407e-05f, 3.2877597e-05f, -2.6391519e-05f, 5.4035336e-06f, -2.5274001e-05f, -9.583534e-06f, 1.5984964e-05f, 2.4921801e-05f, 2.934855e-05f, -6.37295e-05f, -0.00023674882f, 3.066403e-05f, -4.6080764e-05f, -1.722757e-05f, 0.00017593964f, 7.782995e-05f, 3.8794784e-05f, 3.9882456e-05f, 2.3111896e-05f, -6.800503e-06f, 2.5799438e-05f, 2.0107334e-05f, 9.772915e-06f, 5.2871306e-05f, 2.2499524e-05f, -3.129152e-05f, -3.4456841e-06f, -1.7841847e-05f, -2.532393e-06f, 2.4080256e-05f, 3.049371e-05f, -3.49183e-06f, -8.169939e-06f, 9.475776e-06f, 4.7846384e-05f, -5.96865e-05f, -0.00010384837f, 3.1035255e-05f, -1.4852222e-05f, 3.2368e-05f, 0.000118926786f, 4.1496946e-06f, -3.8983108e-05f, -7.1397776e-06f, -2.795651e-05f, 6.158026e-05f, 3.22634e-05f, 7.297306e-05f, -3.810246e-05f, -4.7504113e-06f, -6.148678e-05f, 8.1793645e-05f, 8.117252e-05f, -5.643698e-05f, 3.5173848e-06f, -5.6752365e-06f, 3.710036e-05f, 1.5201278e-05f, 6.9080845e-05f, -9.093248e-06f, 0.00017650532f, -2.4335879e-05f, -0.00025331596f, -7.261149e-05f, 2.9424215e-05f, -9.1162576e-05f, 4.9748942e-05f, 0.000104099556f, 0.00011920959f, 8.908193e-05f, -5.078476e-05f, 8.0669735e-05f, 4.6197497e-06f, -2.0544774e-05f, -2.4924399e-05f, 7.35794e-05f, 9.592856e-05f, -8.4057196e-05f, -5.0963343e-05f, -1.3147091e-05f, -6.512941e-05f, 6.0214345e-05f, 0.000113723974f, 0.0002703201f, 5.4002012e-05f, -0.0004452842f, -2.8869665e-06f, 0.00011436378f, -0.00035862168f, 4.2875472e-05f, -6.660008e-05f, -0.00013776303f, -6.570408e-05f, 0.00021704454f, 1.8918925e-06f, 0.000167984f, 0.00016693381f, -5.4091743e-05f, -0.00019459456f, 0.00030045985f, 5.444785e-05f, -0.00020107189f, -0.00016487378f, -7.187894e-05f, -2.0004854e-05f, 0.0001848343f, 9.520675e-05f, 0.000118770244f, 0.0001364249f, 5.0355044e-05f, -0.00017998232f, -0.00012812919f, -6.7229103e-06f, 9.885698e-05f, -2.2736965e-06f, -0.00013806035f, -0.00020190624f, -0.00010068809f, 2.7350545e-05f, -1.1526703e-05f, 2.2965143e-05f, -2.2914825e-05f, -2.3333432e-05f, -0.00017117249f, -5.4810884e-05f, 0.00012245345f, 6.55206e-05f, 4.617937e-05f, 8.009169e-05f, -2.7736281e-05f, -0.00014617188f, -0.0005038909f, -0.00019474384f, 0.00044925135f, 0.00016448542f, -5.6587924e-05f, 0.00024210651f, -0.00016025393f, 6.400163e-05f, 0.00023638044f, -3.7329428e-05f, -0.00025229144f, -4.820331e-05f, -0.00017013837f, -0.00019420298f, 0.00029178362f, 0.00023606542f, -0.0003823732f, -0.00013746896f, 9.160042e-05f, 0.00015477701f, 3.706132e-05f, 5.387217e-05f, 0.0001228147f, -2.8680804e-05f, -6.669567e-05f, -0.000174975f, 4.9820205e-06f, -8.333594e-05f, 7.6719116e-05f, -0.00013445003f, -5.234684e-06f, 8.667453e-06f, -2.6705598e-07f, 6.584914e-05f, 5.0213373e-05f, 1.01694895e-05f, -4.7127636e-05f, -1.3258007e-05f, -4.3982178e-07f, 2.6808044e-05f, 7.5130316e-05f, -4.456434e-05f, -5.3932148e-05f, -5.914877e-05f, -3.5523444e-05f, -4.7631984e-05f, 7.340373e-05f, 0.0001777781f, 0.00019241382f, 0.00022109029f, -7.0212695e-06f, 4.590729e-05f, -0.0002193663f, -3.6959977e-05f, 1.1541785e-05f, -9.343554e-05f, 1.1440679e-05f, 0.00026068196f, 0.00011272625f, -3.1757776e-05f, 3.79165e-05f, 0.000109787004f, -0.000104551495f, -5.698061e-05f, 8.716922e-05f, 8.342772e-05f, 0.00014169051f, 9.2516195e-05f, -1.8602159e-05f, 6.587462e-05f, -0.00014984467f, -0.00018678734f, 9.1049165e-05f, -5.0361928e-06f, -1.5006322e-05f, 0.00025372033f, 0.00010242019f, 6.399693e-05f, -2.3568733e-05f, 7.141984e-06f, 4.5296096e-05f, 2.085039e-05f, -1.35574455e-05f, 2.5343957e-06f, 4.7688973e-06f, 1.5463726e-05f, -1.1239308e-05f, -8.540901e-06f, 4.071039e-06f, 2.1390797e-05f, 3.0574392e-05f, -1.1941427e-05f, -6.36869e-06f, -1.739181e-05f, 2.5204325e-05f, 2.5654872e-05f, 9.694676e-05f, -5.05755e-05f, -9.491798e-05f, 4.541487e-05f, 5.048226e-05f, -5.1778403e-07f, 3.732538e-05f, -2.5400472e-05f, -9.96216e-05f, -9.4202056e-05f, 6.1014714e-05f, 4.3911423e-05f, -4.7749785e-05f, -1.58042e-05f, 5.5321266e-06f, -5.0797982e-05f, 3.0753967e-05f, 1.2256226e-05f, -0.00012526389f, -4.806539e-05f, 2.3169749e-05f, -2.9899431e-05f, 0.00011404065f, -3.4604475e-06f, -0.00010010198f, -2.4049166e-05f, 8.823767e-05f, 1.5713243e-06f, -3.6430432e-05f, -6.772481e-05f, -5.1142924e-05f, 5.1416628e-05f, 2.252863e-05f, 3.401531e-05f, 4.566386e-05f, 2.0189127e-05f, -1.7424247e-05f, 1.2288063e-05f, -1.2030721e-05f, -1.967008e-05f, 4.0434483e-05f, -3.63441e-05f, 6.871598e-05f, -7.361189e-05f, 1.1048227e-05f, -5.6922658e-05f, -0.00011830055f, 6.860354e-05f, -0.0003111762f, 0.00019548298f, 0.000316732f, -0.00012854923f, 4.4680946e-05f, 0.00011450899f, 5.4799963e-05f, -6.5975386e-05f, 3.4560264e-05f, -0.00016958542f, 7.8483645e-05f, -9.9356024e-05f, 0.00015351668f, -2.2116517e-05f, -2.5432546e-05f, 6.276205e-05f, -0.00014842235f, 9.0727226e-05f, 4.611037e-05f, 0.00011436414f, -0.00015876886f, -6.541231e-05f, 0.00011935264f, 0.00020099257f, 0.00011704336f, -5.4959855e-05f, -5.087506e-05f, 0.00015648657f, -0.0002078487f, -3.7993163e-05f, -5.819271e-06f, -8.481018e-05f, 1.2439668e-05f, -5.080072e-05f, -4.2352087e-05f, 2.0506199e-05f, -2.8164533e-05f, 8.735388e-06f, -1.3873029e-05f, 8.670641e-05f, 4.420125e-06f, -8.830859e-06f, -1.7880191e-05f, -1.2508547e-05f, -5.1135623e-05f, -5.696262e-05f, -0.000120306926f, -3.6469824e-05f, 0.00041565052f, 0.00039217912f, -0.00049953687f, 0.00013339701f, -3.0848125e-05f, 0.00048796326f, -8.853933e-06f, -0.00018811336f, 5.3586402e-05f, 0.00013864634f, 1.0561037e-05f, -1.8418106e-05f, 3.6254885e-05f, 0.00011851508f, 0.0002291288f, -5.5461027e-05f, 0.00014142916f, -0.0001320877f, -0.00014216459f, -0.00017426888f, 0.00011451322f, -4.100329e-05f, 3.3655917e-05f, -3.5235214e-05f, -8.297047e-05f, 0.0003654573f, -4.305418e-05f, -0.00012119963f, -0.000190705f, 0.00041810746f, 1.6347933e-05f, 7.621895e-05f, -7.5298834e-05f, 5.646398e-05f, 7.864303e-05f, -5.938516e-05f, 0.00011805642f, 5.5197047e-06f, -1.2492145e-05f, 7.991152e-06f, 2.346835e-05f, 2.9856634e-05f, -5.8939804e-06f, -1.35517275e-05f, 5.67085e-05f, 8.229534e-05f, -7.436169e-05f, -0.00025705533f, -0.00040283724f, -0.00047730084f, 0.0002495714f, -6.165422e-05f, -8.891279e-05f, -0.0005608396f, 0.00010004947f, 0.00018944002f, 0.00013489428f, -0.0003527552f, 3.3673296e-05f, 4.0340983e-05f, -4.6818648e-05f, -0.00023183339f, -0.00014815744f, 9.499317e-05f, 2.4318946e-05f, 1.8166505e-05f, 0.000116513f, 0.0002509468f, -0.00014536426f, 0.00010765796f, 0.00014151995f, -9.295366e-05f, -6.3005995e-05f, -0.0003186596f, 9.041569e-05f, 0.00019934122f, 6.12798e-05f, -0.00057153474f, 6.3563702e-06f, -1.9236191e-05f, 5.6242116e-06f, -3.809882e-05f, -7.5784184e-05f, 8.632449e-05f, -6.7027127e-06f, 1.054761e-05f, -1.5919892e-05f, 3.996436e-05f, 5.8014386e-05f, -6.289535e-05f, 5.9126884e-05f, -2.9345862e-05f, 2.6794052e-05f, -5.797408e-05f, 0.00029581093f, 0.00011972667f, 0.0001257198f, 0.00039801543f, 8.1301296e-05f, 0.00015927569f, 6.431534e-05f, -2.439458e-05f, 8.179253e-05f, -0.000113897135f, -7.12077e-05f, 0.000100392106f, 4.7297955e-05f, 0.00019508431f, 0.00012941375f, 0.00019869895f, 5.8069745e-05f, -0.00010598099f, 4.3875174e-05f, -4.5004308e-05f, -0.00013186217f, -0.00011135988f, 8.22452e-05f, 1.7319091e-05f, -0.0002926888f, 0.00053714076f, -4.588846e-05f, 0.00022250751f, 6.956828e-05f, 1.1924661e-06f, -0.00027525242f, 0.00057280774f, -8.661022e-06f, -6.079124e-05f, -1.6803235e-05f, 3.900986e-05f, -1.2771219e-05f, 5.4888747e-05f, 6.479774e-05f, 4.780088e-07f, -1.1813867e-05f, 5.417788e-07f, 2.4021085e-05f, -2.4443698e-05f, 3.525723e-05f, -6.0454942e-05f, 4.65222e-05f, 1.43971665e-05f, -0.00016133444f, 0.0002681739f, 3.895734e-05f, -0.00019790283f, -2.880688e-05f, 0.00010771014f, -9.417991e-05f, 2.8990129e-05f, -5.368388e-05f, 7.966736e-05f, -0.00017267436f, 7.647061e-05f, -9.275049e-05f, -4.747543e-05f, 8.731368e-06f, 0.00010446202f, -5.2278796e-05f, 2.9107181e-05f, -3.489911e-06f, -7.174544e-05f, 0.00010893086f, -9.8171215e-05f, 5.097219e-07f, -7.943966e-05f, 0.000116763666f, 0.000121468955f, -0.00010468479f, 8.1026184e-05f, 7.3688876e-05f, 7.173326e-05f, 2.5093573e-06f, 0.00032827025f, -1.0439263e-05f, -2.4052304e-05f, 2.8005968e-06f, -1.1179826e-05f, -1.7267592e-05f, 1.5211612e-05f, -1.1849645e-05f, 2.7269843e-05f, -2.7166812e-05f, 4.401876e-05f, 6.1806946e-05f, -5.314641e-05f, -6.974225e-05f, -5.9493155e-05f, 4.465161e-05f, -4.446743e-06f, -0.0001229285f, 9.841327e-05f, 4.5563225e-05f, -0.00025868637f, 0.00013709675f, -7.802846e-05f, 8.365785e-05f, -2.8828972e-05f, 8.051272e-05f, -5.4424298e-05f, -8.578452e-05f, 0.00012985784f, 6.0094095e-05f, 0.00014106098f, -0.00021126852f, 0.00010937434f, -9.8581564e-05f, -0.00012890591f, -1.2755576e-05f, -7.949245e-06f, -0.000102676386f, 9.674871e-05f, -5.839822e-05f, 0.00018523623f, 0.0002804288f, 0.00013413135f, -0.00026421697f, 0.00018067865f, 0.00010614558f, -0.00012478245f, -6.728037e-05f, 0.00014464004f, 5.2768704e-05f, -6.523742e-05f, 1.7204755e-05f, 6.998064e-05f, -5.705476e-05f, 2.729271e-07f, 5.744568e-05f, -0.00012759354f, -6.848603e-06f, 5.2434265e-05f, 3.8008337e-05f, -5.3128188e-06f, 7.944552e-05f, -1.781351e-05f, -1.1743783e-05f, -4.2502616e-05f, 8.151932e-06f, 2.2388918e-05f, -5.668743e-05f, 0.00020005836f, -0.00017593015f, 0.00018627783f, -8.979732e-05f, 5.673236e-05f, -0.00012532333f, -0.00011014731f, -2.4718202e-07f, -0.00012988529f, 3.0199159e-05f, -0.0001171942f, 0.0002457055f, 7.456272e-05f, -4.265713e-05f, -7.7550554e-05f, 1.7874112e-05f, -5.6441895e-05f, 5.9267502e-05f, -8.694291e-05f, 7.142503e-05f, -6.254268e-05f, -0.0003215997f, 0.00026764022f, 0.0002571539f, -0.0005805004f, -0.00026073182f, -0.00019261902f, -7.011861e-05f, -0.00016892941f, -5.0309638e-05f, 3.4303e-05f, -2.329765e-05f, -8.3851104e-05f, 1.6044172e-05f, -9.281857e-06f, -5.3807544e-05f, 7.254584e-05f, -2.4277766e-05f, -3.8059206e-05f, 3.982184e-05f, -1.6166623e-05f, -3.7316746e-05f, -1.6751568e-05f, -2.4815427e-05f, 2.8810899e-05f, -0.00011177363f, -4.67745e-05f, 0.00012359634f, -0.00023830263f, 0.0001253035f, -0.0001785038f, 6.3402964e-05f, -4.3093074e-05f, 0.00013757886f, 4.7099547e-05f, -8.3914e-05f, 0.00013016585f, -2.928109e-05f, 0.00016810765f, -0.00020590622f, -5.397871e-05f, -5.8613127e-06f, 3.5714897e-05f, 3.699569e-06f, 3.49216e-05f, -2.2731892e-05f, 5.256534e-05f, -1.5502263e-05f, 2.1340089e-05f, 0.00022828195f, -0.00014137328f, -0.00032066557f, 0.00065490074f, 0.00015523343f, -4.9255843e-05f, 0.00010003707f, 0.000114876384f, -7.256932e-06f, -3.673132e-05f, -8.688423e-06f, 1.6127693e-05f, -5.0874318e-05f, 5.1661642e-05f, 9.120451e-05f, 1.605855e-05f, -6.8704336e-05f, 3.58276e-05f, 7.027178e-05f, -2.0108346e-05f, -2.3454675e-05f, -2.0424177e-05f, -8.279733e-05f, 5.6400095e-05f, 0.000188786f, -7.235321e-05f, -0.00014594465f, 4.571597e-05f, -0.00011980171f, 4.642693e-05f, -2.8358962e-05f, 1.0567303e-05f, -2.0969484e-05f, 4.9502025e-05f, 0.00018150486f, 7.656082e-06f, -1.8110575e-05f, 4.465157e-05f, 4.4530756e-05f, -1.4060436e-05f, 1.0261391e-05f, 5.160474e-05f, -3.4582394e-05f, 3.6171489e-06f, -4.8828748e-05f, 8.9433706e-05f, 2.679406e-05f, -4.286195e-05f, 0.00019083048f, -0.00029453545f, 4.5232402e-05f, 8.9773224e-05f, -5.8866382e-05f, -4.5179182e-05f, -6.380959e-05f, -0.00015849071f, 3.2201184e-05f, 9.5614465e-05f, 2.3686447e-05f, -2.2547085e-06f, -2.6544552e-05f, 4.15248e-05f, -0.00015431181f, -2.2340142e-05f, -5.583598e-06f, -9.557555e-06f, -9.946579e-05f, 7.353403e-05f, 2.6237618e-05f, 3.305161e-05f, 4.062954e-05f, -8.966876e-05f, -0.00024004442f, 0.00020582954f, 0.00025104088f, 7.311859e-05f, 0.0001462748f, -2.6330796e-05f, 0.00014114061f, 0.00010756898f, 0.0001075266f, -6.676981e-06f, -0.00025825316f, 0.00030089627f, 1.5207609e-05f, -0.00012727838f, 0.00012105094f, 0.00012663209f, 3.2818443e-05f, -2.1753503e-05f, -1.7052902e-05f, 4.2161188e-05f, -3.8155053e-05f, 1.4198188e-05f, 4.087537e-05f, 8.211019e-05f, -0.0004202742f, 0.00052145973f, 0.00018650747f, -0.00071527873f, -0.0001865478f, -0.00016867457f, 0.00048507555f, 7.963503e-05f, -2.686316e-05f, -2.938313e-05f, -4.3579497e-05f, 6.0425304e-05f, 0.00010339448f, -9.165212e-05f, 0.0001709176f, -2.0670204e-05f, -3.982969e-05f, 2.423199e-05f, 6.38358e-05f, -0.000112677815f, 4.12404e-05f, -8.327641e-05f, -6.941963e-05f, 1.3695785e-05f, 4.5808978e-05f, -7.484327e-05f, -0.00014549885f, -0.00020496224f, -4.3429616e-05f, -4.2860625e-05f, -0.0001709272f, -3.111164e-05f, -7.734466e-05f, -0.00014826118f, 0.0001626151f, -0.00029608113f, -5.4568587e-05f, 0.00010566513f, -0.00016621084f, -8.478829e-05f, -4.0210933e-05f, 3.1756026e-06f, 7.73559e-06f, 9.481477e-06f, 1.4341151e-05f, 5.816842e-06f, -3.121338e-05f, -1.0037208e-05f, 0.00031100053f, -0.00019575923f, -0.00030129496f, 0.0006724079f, 0.00027691695f, 1.608619e-05f, -0.00046393956f, 4.3476353e-05f, 0.00011693862f, 0.0001229465f, -0.00025096128f, 0.00014689582f, 0.0003158999f, -9.988817e-05f, 0.00029423306f, -0.0001758734f, -4.734089e-05f, -7.7223725e-05f, 0.00022567215f, -0.00031437556f, -6.8725676e-05f, 3.0767726e-05f, -3.2263782e-05f, -9.501918e-05f, -0.00015819445f, 3.8547234e-05f, -0.00019103546f, -0.00017771209f, 8.172661e-05f, -3.029037e-06f, -4.182726e-06f, 9.2663504e-05f, -0.00011056957f, -4.7761587e-05f, -0.00012229879f, 0.00018682695f, -1.7873315e-05f, 7.1802824e-05f, 7.376727e-05f, 0.00010550098f, 0.00014530779f, 2.7508639e-05f, -7.559617e-05f, 0.00015985337f, 8.797537e-05f, -1.5491767e-05f, 0.00043768756f, -0.00012953463f, -4.5960576e-05f, -5.6772056e-05f, -0.0004041627f, 0.00026915883f, 1.47645615e-05f, 0.00012949946f, -0.0002931386f, 0.00017160657f, -0.0001629629f, -0.00011587038f, 0.00021851284f, -0.0001600618f, -0.00024361716f, 0.00020598975f, -0.0002316146f, 8.6438486e-05f, 5.391693e-05f, 9.104752e-05f, -0.00016852623f, 0.00026463644f, 1.6985066e-05f, -5.7989455e-05f, -5.131494e-06f, 0.00019653581f, 6.3910746e-05f, 1.3326782e-05f, 0.00023291516f, 9.3690796e-05f, -0.00014103434f, -4.5016255e-05f, 4.488157e-05f, -9.109952e-05f, 5.517275e-05f, 3.141349e-05f, 2.5860294e-05f, -0.0001824107f, 8.697361e-07f, -4.8697035e-05f, -7.251751e-05f, -9.780817e-05f, -0.00015834246f, 3.0751395e-05f, 4.4616667e-05f, -0.0001788325f, -0.00010374073f, 6.781086e-05f, -0.00031435097f, 0.00014551952f, 2.3746347e-06f, -1.3400261e-05f, 0.00031879512f, -0.00017425264f, 7.256657e-05f, -8.935331e-05f, 5.8811074e-05f, -0.000118166645f, -4.666791e-05f, -7.275151e-05f, 6.742933e-05f, -5.068741e-05f, -2.0411026e-05f, -2.1197584e-05f, -2.8708053e-05f, -2.5735391e-05f, -1.1168716e-05f, 3.9602728e-05f, -4.9040154e-06f, 4.4408524e-05f, -2.1866257e-05f, -4.858714e-05f, 3.2655557e-06f, -1.1802721e-05f, -3.3486038e-05f, -4.7619655e-05f, 0.00015006227f, -2.6881868e-05f, 2.5615365e-05f, -7.518817e-05f, 0.00013943974f, 4.6060475e-05f, 9.542897e-06f, -9.5942334e-05f, -8.0371545e-05f, 7.0621216e-05f, 2.7350867e-05f, -8.748882e-06f, -3.0585223e-05f, 2.2318243e-05f, 6.1122504e-05f, -4.1322488e-05f, 5.095356e-06f, 9.4815325e-05f, -1.918811e-05f, 5.506959e-05f, 3.664588e-06f, -1.1566651e-05f, 5.883784e-05f, -4.4781176e-05f, -2.9669369e-05f, 4.754468e-05f, 4.0365547e-05f, -5.1495674e-05f, -0.00016777184f, 0.0001134467f, -5.342737e-06f, 1.1505036e-05f, -5.470941e-05f, 4.2517084e-05f, -2.385402e-05f, -9.368089e-06f, -2.743114e-05f, 5.4907792e-05f, -3.158949e-05f, -8.819328e-05f, 2.2459823e-05f, 2.0418345e-05f, -1.1086775e-05f, -1.8657516e-05f, -6.513845e-05f, 1.5253545e-05f, -1.9021207e-05f, -6.22003e-05f, -8.6597596e-05f, -7.556149e-05f, -1.6786116e-05f, 1.7335002e-05f, -6.8357134e-05f, -2.6851785e-05f, 1.0756584e-05f, 5.017744e-05f, 3.6996764e-05f, -9.600497e-05f, 6.6572434e-06f, 8.366281e-05f, 3.4809073e-05f, -3.7635622e-05f, -0.0001070296f, 4.7238573e-05f, 3.9920174e-05f, -0.0001882418f, -2.1400838e-05f, -8.549226e-06f, 9.10566e-06f, -2.7622185e-05f, 1.0038369e-05f, 0.00015787841f, 1.5945912e-05f, 2.7973234e-05f, -1.1936806e-05f, -0.00012276378f, 0.000105706735f, -6.933408e-05f, -4.180786e-05f, -3.0783722e-06f, 4.106757e-05f, -0.00010634411f, 3.0860036e-05f, 2.907838e-05f, -3.1561493e-05f, 3.9197672e-05f, -5.6644963e-06f, -2.3135563e-05f, -4.9423903e-05f, -1.6595975e-05f, 8.259249e-07f, 4.4229986e-05f, 4.6539833e-05f, 2.528987e-05f, 1.9587802e-05f, -2.1723614e-05f, 8.101982e-05f, 0.00011175324f, -8.020315e-05f, -7.331752e-05f, 7.275574e-05f, 4.126417e-06f, 1.7726364e-06f, -4.9229224e-05f, -4.097572e-05f, 0.00013194385f, -8.472192e-05f, 1.1742926e-06f, 1.8820348e-06f, 9.26284e-05f, 5.3318854e-05f, -4.0787316e-05f, -3.940621e-05f, 0.00014230536f, -8.254122e-06f, 3.597144e-05f, 3.891062e-05f, -5.3722273e-05f, 2.455313e-05f, -0.00015993878f, 6.962047e-05f, 4.203768e-05f, -6.11078e-05f, 1.1769483e-05f, -0.00018104831f, 3.4542125e-05f, 2.1460246e-05f, -1.4063718e-05f, -3.003147e-05f, -4.2957974e-05f, -3.515213e-05f, 1.3795616e-05f, -2.3025934e-05f, -7.019712e-06f, -1.307773e-05f, -5.9845635e-05f, -9.283064e-06f, 7.189726e-05f, -8.057522e-05f, 8.216634e-05f, 1.7846414e-05f, 6.315028e-05f, -2.6265452e-05f, 5.5445442e-05f, 3.684407e-05f, -3.779574e-05f, -3.8289985e-05f, -7.741422e-06f, 0.00012383948f, -1.3141766e-05f, -9.318919e-06f, 5.338333e-05f, 1.2609306e-05f, 1.9815627e-05f, -8.4669075e-05f, -1.9589845e-05f, -4.136315e-06f, 3.4500143e-05f, -3.9402214e-05f, 3.1522923e-05f, 2.7666754e-05f, -8.496556e-06f, -6.3739084e-05f, 3.0891486e-05f, -2.1712107e-05f, -1.3970843e-05f, 0.000108972505f, -4.5322497e-05f, -6.0243874e-05f, 8.459486e-05f, 5.5819102e-05f, 2.0672533e-05f, -4.0386334e-05f, 7.935011e-05f, 1.7049751e-05f, -3.1336374e-05f, 2.7089949e-05f, 5.2861574e-06f, 4.5247352e-06f, -5.7309036e-05f, -4.773701e-05f, 1.7296601e-05f, 7.224446e-06f, -1.0811304e-06f, -1.3613886e-06f, 2.0878355e-05f, -1.0181473e-05f, -6.387437e-05f, 3.4514019e-06f, -2.4677704e-05f, 5.9741382e-05f, 5.9215447e-05f, -1.5277597e-05f, 0.00013993323f, -4.894328e-05f, -2.8929699e-05f, 4.0011637e-05f, -2.0558055e-06f, 2.1872625e-05f, -3.986773e-05f, 1.06945945e-05f, -2.6962925e-05f, -9.034005e-06f, 4.768838e-05f, 9.648089e-06f, -1.5129538e-05f, -3.6019697e-05f, -4.489704e-05f, -3.128085e-05f, -5.0578794e-05f, -9.17257e-05f, -1.59627e-05f, 1.1799951e-05f, -7.4161985e-06f, -7.727516e-05f, 9.282229e-05f, -5.376611e-05f, 1.4186894e-05f, -2.9943907e-05f, -0.0001545633f, 3.533714e-05f, -2.3922055e-05f, 1.5513142e-05f, -2.4384042e-05f, 2.048212e-06f, 1.4022176e-05f, 8.141882e-06f, 2.822894e-06f, -4.4473807e-05f, -1.4018826e-05f, -4.0445604e-05f, -3.6536585e-05f, 2.5218269e-05f, -3.741944e-05f, 2.0175496e-05f, 1.4374033e-06f, -2.3510187e-05f, 1.7315966e-05f, -7.44897e-05f, -5.461118e-05f, 1.2459064e-05f, -0.00015724103f, 9.384935e-05f, 6.2935723e-09f, -5.6429184e-05f, -0.00010949324f, 4.623481e-06f, -2.9381385e-05f, 1.1778831e-05f, 4.2730804e-05f, -6.6921915e-05f, 2.7414399e-05f, 1.8355646e-05f, 2.5235928e-05f, 3.1004984e-05f, -1.5288953e-05f, -1.3081847e-05f, -3.3082353e-05f, -6.8203967e-06f, -2.5360428e-05f, 1.6745347e-05f, -2.897462e-05f, 0.00020353677f, -9.840946e-05f, -0.00014775546f, 2.4778235e-05f, 1.8547615e-05f, 1.801289e-06f, -3.357522e-05f, -2.0067762e-05f, -5.393808e-06f, -7.039702e-07f, 3.963943e-06f, 1.9098654e-05f, -1.9254723e-05f, 7.046229e-05f, -2.8228793e-05f, 1.2431569e-05f, -2.7663376e-05f, -3.563933e-06f, 3.156023e-05f, 3.0207584e-05f, -2.5552754e-05f, -1.7194463e-05f, -1.2445268e-05f, -1.1923293e-05f, -6.0968927e-05f, 4.223659e-05f, 7.6068376e-05f, -9.143421e-05f, -4.0913274e-05f, 5.3422256e-05f, 8.243705e-06f, 2.3770883e-05f, 4.8925617e-06f, -2.096735e-05f, -1.9527544e-05f, 2.175099e-05f, -2.6158754e-05f, -2.4617078e-05f, 4.110091e-05f, -1.269096e-05f, 1.7844424e-05f, -9.9370205e-05f, 1.3071181e-05f, -2.0508216e-05f, -2.6029718e-05f, 4.6119792e-05f, -3.458886e-05f, 5.83198e-05f, 0.00016500137f, -1.1637934e-06f, -5.7602643e-05f, -8.910831e-05f, -2.2292812e-05f, 3.0247335e-05f, 2.2044745e-05f, 8.703726e-06f, 1.1955972e-05f, 4.3939013e-05f, -6.3771795e-06f, 1.1964983e-05f, 6.091845e-05f, 2.7820693e-06f, -2.347872e-06f, -5.707473e-05f, 2.636129e-05f, -1.3304608e-06f, 6.9920866e-06f, 1.50378655e-05f, 2.331546e-05f, 1.8186092e-05f, -4.2529737e-06f, 3.708678e-05f, 8.100055e-06f, -6.855305e-05f, -0.00012371854f, -3.6793706e-05f, 0.00017274579f, -8.259207e-05f, 8.316215e-05f, -5.601002e-05f, 1.2615908e-05f, -4.5810804e-05f, -1.0717695e-05f, 4.4415232e-05f, -4.2067768e-05f, -2.1122913e-05f, 9.564462e-05f, 4.412676e-05f, 2.7286699e-06f, -6.1130304e-05f, -2.65413e-05f, -5.421722e-05f, 3.012021e-05f, -1.3055093e-05f, 5.4618406e-05f, 8.436619e-07f, 0.00015993795f, 0.00016259127f, -5.670473e-05f, 6.1239356e-05f, -5.7622463e-05f, 0.00012274286f, -0.00012047422f, 1.7889197e-05f, 6.4447944e-05f, 6.591328e-05f, -7.697758e-05f, -2.2825443e-05f, 0.00029321192f, -8.159867e-05f, -0.00016763723f, -0.00017274515f, 7.4923155e-05f, -6.6440284e-06f, 4.834493e-05f, -0.00013065686f, -2.476304e-05f, 8.583413e-05f, -4.104293e-05f, -4.4325534e-06f, -0.00012278178f, -1.2917905e-05f, -0.0002297337f, -0.0002590099f, 0.00012430894f, 5.8039976e-05f, 0.0005190152f, -0.0003319265f, -0.000110080546f, 4.6275636e-05f, 9.260779e-05f, 0.00017669595f, 6.30552e-05f, 6.8158675e-05f, 0.00017377298f, -0.00016444383f, -3.9622206e-05f, 0.00031025466f, 0.00011664512f, -0.000106096326f, 2.9250454e-05f, -0.00023533036f, 0.00016750956f, 0.00017478543f, 0.00044954402f, -0.000113680166f, 0.00019107769f, 0.00052165723f, -0.00035386687f, 0.00035160678f, 0.000110428446f, 0.00018740942f, -2.2784441e-05f, -6.5808585e-05f, 8.1658334e-05f, 3.0809253e-05f, -0.0002986491f, 7.869143e-05f, 0.00017574304f, 9.8287506e-05f, -3.889322e-05f, -6.785791e-05f, -0.0001147991f, 0.0003068855f, -4.4324443e-05f, -4.9345635e-05f, 4.397373e-05f, 6.844319e-05f, 0.00026509006f, 1.728092e-05f, 9.2658716e-05f, 0.0004963192f, -0.00020290408f, -0.00011929825f, -0.0004895072f, 0.00018524614f, 6.86426e-05f, -0.00018340696f, -1.6226943e-05f, -0.00043867953f, -3.8964125e-05f, 7.0137576e-05f, -0.00025375467f, 9.519822e-05f, 2.858644e-05f, -0.00042625092f, -0.00015676708f, -7.424508e-05f, -0.00022619363f, 0.00024137319f, -0.00026669513f, -0.0002625632f, -0.00048215862f, 4.118403e-05f, -0.000103406914f, -0.00037537148f, -2.787065e-05f, -0.00011300608f, -4.4716468e-05f, -0.000105976374f, 9.428779e-06f, -1.0860606e-05f, -7.4433765e-06f, 3.5628334e-05f, 2.7513077e-05f, -2.2039323e-05f, -3.6367746e-05f, 4.401536e-05f, 4.702774e-06f, 3.133684e-06f, 6.360654e-05f, -0.00023446356f, 3.384774e-05f, 5.4998076e-05f, -6.00402e-05f, -7.192788e-05f, -0.00018804063f, -8.492719e-05f, 1.4535656e-05f, -0.00013026966f, -1.47732935e-05f, 0.0002967171f, 0.0002550273f, 3.4736386e-05f, -7.156967e-05f, 0.00011884784f, -0.00014640598f, 0.00034359438f, 0.00010040487f, -0.00019955394f, 0.00017282242f, -5.476801e-06f, -3.2634132e-05f, 0.00013369048f, 4.2977103e-05f, 0.0002490372f, 0.00014966518f, -3.979035e-06f, 8.824707e-05f, 0.00020147084f, 0.00018750665f, -7.718444e-05f, 7.5136186e-06f, 4.7014102e-05f, 0.0001560796f, -0.00012050375f, -8.493007e-05f, 1.9793126e-05f, 9.067815e-06f, 2.2514232e-05f, -1.0212556e-05f, 5.5305827e-06f, 1.9942616e-05f, -2.5390214e-06f, -1.0315679e-05f, -1.5985845e-06f, 1.6841826e-05f, -1.3724646e-06f, -2.7645074e-05f, 4.2920165e-05f, -1.7422868e-05f, -1.15633975e-05f, 2.1123331e-05f, 8.100762e-06f, 6.550931e-05f, 5.097005e-05f, 4.134618e-05f, -3.838859e-05f, 8.4126536e-05f, 1.2264402e-06f, -1.33869435e-05f, -1.2315579e-05f, -6.2527797e-06f, -4.576984e-05f, 6.8100584e-05f, -0.00013345762f, -1.6658102e-08f, 5.9017202e-05f, 3.6411046e-05f, 1.9086976e-05f, -5.390821e-05f, 5.826847e-05f, 1.67541e-06f, -7.3319694e-05f, -3.6676993e-05f, -2.704725e-05f, 1.5422622e-05f, -6.6089688e-06f, -1.7836606e-05f, 0.00011895185f, 7.383385e-05f, 5.8782884e-05f, 7.960885e-05f, 0.00010645838f, 3.3070668e-05f, 8.098359e-05f, -3.231982e-05f, -3.6740025e-06f, -6.5080494e-05f, 6.216888e-05f, -2.2693446e-05f, -3.1192933e-05f, -3.490225e-05f, 5.249365e-05f, -3.7312046e-05f, 1.4094322e-06f, 1.9703668e-05f, 1.5329964e-05f, -6.396025e-05f, -2.4760218e-06f, 7.3037765e-05f, -6.0207218e-05f, -4.984395e-05f, 0.0002625839f, 0.00016779655f, -0.0001402285f, 2.6332638e-05f, 0.00013984035f, 0.00018719657f, -0.00022453717f, -8.569287e-05f, 2.509007e-05f, 0.0001512147f, -5.89609e-05f, -5.7405858e-05f, 2.4969102e-06f, -0.00015579173f, 8.835252e-06f, 3.808119e-05f, -1.3626924e-05f, -3.260763e-05f, 4.121101e-05f, -0.00010837216f, 0.00012625648f, 9.322113e-05f, -0.00019599572f, 0.00032092113f, 0.00030264247f, 0.0001874271f, -0.00019556754f, 7.026928e-05f, 3.996077e-05f, 0.00030565023f, -0.00019331621f, 3.2612756e-05f, -8.6340966e-05f, 7.718247e-05f, 1.6737162e-05f, -4.942617e-05f, 7.291312e-05f, -4.129688e-05f, -9.091795e-05f, 1.0893061e-05f, 7.1119546e-05f, 3.7489666e-05f, -4.0159834e-06f, 4.15119e-05f, -3.0129255e-05f, -1.2727119e-05f, 3.4385186e-05f, -0.00015404307f, -3.019977e-05f, 1.9187184e-05f, -0.0003057842f, 0.00014469818f, 0.00010418044f, -7.0664064e-05f, -0.00031429963f, -0.00014403704f, 9.271338e-05f, -0.00010383041f, 0.00030151356f, -0.00025721273f, 5.6090066e-05f, 8.322789e-05f, -0.00025337152f, 0.000108198605f, 2.3205492e-05f, 3.7429843e-05f, 0.0001511163f, -0.00010973869f, -0.00010098991f, 3.404399e-05f, 0.00013924378f, -0.00024172736f, -0.00020253978f, -0.00014540968f, -0.00017318857f, -3.121269e-05f, 0.00030328514f, -1.741452e-05f, 0.00011736708f, -1.9439558e-05f, 0.00014067254f, 3.6013993e-05f, -1.1482685e-05f, 2.4641868e-05f, -6.671243e-05f, 1.1093809e-05f, 4.1447838e-05f, -4.547643e-05f, -2.7748689e-05f, -6.669309e-05f, 7.224939e-05f, -5.5834025e-05f, -1.3813232e-05f, 1.8748255e-05f, -1.5706168e-05f, 5.6925954e-05f, -1.7320383e-05f, -6.473212e-05f, 9.9386445e-05f, 0.00026066907f, 9.85936e-05f, 0.00029400864f, 0.00034577944f, 0.00019623231f, -4.366991e-05f, 6.8144735e-05f, -0.00012028589f, 0.00045730965f, -4.1388423e-05f, -0.00016006635f, 0.00033524344f, -9.8373916e-05f, -1.2848557e-05f, 2.8969538e-05f, -0.00026632522f, 0.000239921f, 0.00021196342f, 8.043007e-05f, -0.00015031258f, 3.1995816e-05f, 9.472301e-05f, -0.00016305929f, 0.00019336872f, -0.00015949474f, -0.00027321768f, 0.00010630573f, 0.00026411333f, 5.8507732e-05f, -0.00010620902f, -0.00012083005f, 2.5435987e-05f, 3.3346932e-05f, 1.2612434e-05f, -2.838656e-05f, 5.610104e-05f, 3.605614e-05f, -2.6747293e-06f, -1.6966174e-05f, -2.863362e-05f, 6.134485e-05f, 4.795957e-05f, -2.0246518e-05f, -2.127199e-05f, -0.00010431103f, -0.00017420351f, 0.00022854215f, -5.637997e-05f, -6.618417e-05f, -0.0001540293f, -0.00024623208f, -5.8725785e-05f, -0.000106166925f, -6.351657e-06f, -0.00014325436f, 8.504239e-05f, -0.00023848061f, 8.1903214e-05f, 0.0001262323f, -0.00022224624f, 6.6636356e-05f, -5.504456e-05f, -0.00015695018f, 8.978014e-05f, -4.7784637e-05f, -0.00016339928f, -0.0001448186f, 0.000231371f, 0.00018564511f, 0.000220668f, 0.00010199064f, -0.00020832916f, 0.00018481557f, 0.000104290375f, -0.00019371106f, -0.00036993658f, 3.1857326e-05f, -4.745264e-05f, -1.1400493e-06f, -2.4389667e-05f, -2.2395026e-05f, 5.6766994e-06f, 8.0655e-06f, 1.44428805e-05f, -1.9857971e-05f, 2.7207652e-06f, 9.975879e-06f, 1.3249873e-05f, -1.896487e-05f, 0.0001131356f, -1.0555122e-05f, -2.6022002e-05f, -0.00011686465f, 1.7772605e-05f, -0.00015035024f, -0.00025816896f, 2.6629254e-05f, -0.00037059197f, 3.5574292e-05f, -4.508404e-05f, 9.621771e-06f, -2.749896e-05f, -3.2635107e-05f, 0.00017303678f, 0.00011594849f, -0.00014595316f, 4.2020638e-05f, -7.176408e-05f, -8.328036e-05f, 0.00015451662f, 2.227737e-05f, -0.00012159701f, -2.0283196e-05f, -0.00014953065f, 4.217874e-05f, -3.0381841e-05f, -0.00014488115f, -0.00045252292f, 0.0003565934f, -0.00033102385f, 0.00025856818f, 0.00018576023f, 9.581002e-05f, -0.00013282544f, -5.5315986e-06f, 3.841552e-05f, -2.8027625e-05f, -1.9163966e-05f, 4.7114037e-05f, -1.4489759e-05f, 8.8284805e-06f, 2.0884581e-06f, 5.252078e-05f, 1.3343046e-05f, -2.3252069e-05f, 5.188702e-05f, -2.2848553e-05f, 1.2282416e-05f, -1.6610772e-06f, -1.829448e-05f, -5.192619e-05f, 0.00024291272f, 0.000120206074f, -9.284483e-05f, 0.00014869313f, -1.7479317e-05f, 8.127242e-05f, 1.2785432e-05f, -5.0909148e-05f, 1.2827765e-05f, 3.484438e-05f, -9.933708e-05f, 2.1170463e-05f, -5.6253513e-05f, 5.62836e-06f, 2.3292901e-05f, -3.664748e-05f, -9.328728e-05f, -0.0001258316f, 0.000120955294f, 1.8863993e-05f, -1.6564922e-05f, 1.4610559e-05f, -3.589261e-05f, -5.833686e-05f, -0.0003731757f, 9.5192314e-05f, 9.480713e-06f, -9.75146e-06f, 2.272477e-05f, 1.1814781e-05f, 9.383798e-05f, 9.8337834e-05f, 2.1134092e-05f, -4.741916e-05f, 0.00011161834f, -5.4837405e-05f, 7.682218e-05f, -4.288366e-05f, 1.1636857e-05f, -5.7689664e-05f, 2.1411031e-05f, -1.2960121e-05f, 3.7320776e-06f, 2.3517943e-05f, -4.7167832e-05f, -5.4030123e-05f, -1.3302144e-06f, 1.5767278e-05f, -7.242009e-05f, -0.00012500543f, 0.000136281f, -8.412711e-05f, 3.822244e-05f, -0.00024031695f, -4.0662846e-05f, -7.5055286e-06f, -8.326487e-05f, 3.0062984e-05f, 5.5995697e-05f, 4.9008882e-05f, 0.00012262163f, 0.000119990254f, 9.965898e-05f, 3.989019e-05f, 0.000110068504f, -0.00018512798f, 8.674002e-05f, -4.124493e-05f, -6.11992e-05f, -7.5904165e-05f, 0.00011704302f, 0.00015336229f, 0.0005678191f, -5.812625e-06f, 0.000200733f, 0.00020954931f, 0.00018935553f, 0.0001229599f, -0.00017538422f, -7.476082e-05f, -7.547233e-06f, 1.6998903e-05f, -8.0657876e-05f, 3.709901e-05f, -5.402957e-05f, 5.4932414e-05f, 4.0566887e-05f, 2.0764463e-05f, -3.070136e-05f, 6.29764e-05f, -1.6453369e-05f, -4.4928653e-05f, 9.038325e-05f, 1.0532962e-05f, -7.3222777e-06f, 1.6491704e-05f, 4.426595e-05f, 0.00010707474f, -8.899237e-05f, 6.136809e-05f, 1.5318887e-05f, 0.0002347488f, 3.0045021e-05f, -2.4787352e-05f, 4.5821325e-05f, -6.209129e-05f, -3.9132272e-05f, -7.652628e-05f, -0.00012861486f, -5.3092244e-05f, -6.280577e-05f, 1.7367114e-05f, -4.9371312e-05f, 0.00014928891f, -8.2152015e-05f, 1.2952291e-05f, 7.3323145e-06f, 7.533798e-05f, -8.811553e-05f, -0.00022372363f, -0.00055194506f, 1.3524416e-05f, -0.00019367925f, -5.6309756e-05f, -6.309551e-05f, -2.6075548e-05f, -4.3978787e-05f, 5.7025856e-05f, 2.4178562e-06f, -9.759421e-05f, 0.00011272285f, -2.8533723e-05f, 3.1042007e-05f, 2.4960448e-06f, 3.1354426e-05f, -2.7867627e-05f, 7.5404416e-05f, 1.9005542e-05f, -2.2689264e-05f, -3.1497202e-05f, 0.00016484213f, -6.3545755e-05f, -5.3975175e-05f, 4.964566e-05f, -9.265328e-05f, -1.8565439e-05f, 7.5332064e-05f, -0.00012535164f, -6.228683e-05f, -6.966239e-05f, -3.1732543e-05f, -9.527482e-05f, -7.7109704e-05f, 7.568803e-05f, -0.0001347465f, -3.925427e-05f, -4.3492022e-05f, 6.575247e-05f, 2.2713804e-05f, 5.9783608e-05f, 9.54205e-06f, 6.216311e-05f, -0.00012463942f, 1.573299e-05f, -7.278246e-05f, 1.6844186e-05f, -8.040705e-05f, -0.000108833185f, -0.00023482888f, -5.0798535e-05f, 6.795115e-05f, -0.00013312958f, 9.461726e-05f, -0.00026608742f, -9.759311e-05f, -0.00013825767f, -6.044889e-06f, 0.00020575644f, -0.00016112205f, 3.8086193e-05f, -6.9971466e-05f, -7.9072396e-07f, -0.00018208448f, 1.5706924e-05f, -3.627321e-05f, -0.000111812114f, -6.509576e-05f, 9.1828944e-05f, -0.00029595522f, 4.008887e-05f, 9.9952864e-05f, -0.00013831217f, 7.45494e-05f, 2.2447573e-05f, 1.6895776e-05f, 0.00015870936f, 0.0001122388f, 0.0001202814f, 9.560617e-05f, 2.1216541e-05f, 1.8848395e-05f, -0.00013906641f, 0.00010037006f, -6.3827574e-05f, -3.9809423e-05f, -0.00021030351f, 0.00013770493f, -0.00011147749f, -9.791881e-05f, -2.9128016e-05f, 0.0001412475f, -9.333834e-05f, 3.071861e-05f, 0.00010763292f, 9.170699e-05f, 0.00028984732f, 0.00049168285f, -0.00025020624f, 0.00020458025f, 0.0003107147f, 0.00013717251f, 0.0003137951f, -0.000119946875f, 8.141022e-05f, 1.927374e-05f, -0.00019625785f, 7.038514e-05f, -1.8340479e-05f, 9.208306e-06f, -5.5659482e-05f, 0.00015662004f, 4.2486547e-05f, -4.9685736e-05f, 0.0001235198f, 5.358452e-05f, -0.00010876179f, 0.00020429569f, 1.19784845e-05f, -0.00015510811f, 0.00018457534f, 1.544684e-06f, -3.9031142e-06f, -0.00012375723f, -5.1450494e-05f, -0.000111964306f, -3.4666897e-05f, -0.00017335101f, 6.634299e-05f, -4.465085e-05f, 5.919829e-05f, 6.0597293e-05f, 0.00011388524f, 0.00018349131f, 0.00020967945f, -0.000196476f, 3.6253834e-05f, 5.84907e-05f, 2.5905549e-05f, -4.22977e-05f, 7.954857e-05f, 1.7791446e-05f, -6.4210384e-05f, -3.0087236e-05f, -0.00017365393f, -0.00021113896f, 0.00035342274f, -0.00034172827f, -0.00024678747f, -0.00023809884f, -0.00021778449f, 9.3307535e-05f, 3.6729214e-06f, -2.9331177e-05f, -0.00017989731f, 1.8766777e-05f, 7.079778e-05f, 2.3285833e-05f, 1.3986922e-05f, 0.000103951905f, -4.279257e-05f, 7.3994493e-06f, 2.0611296e-05f, 0.00017325135f, 0.00015880432f, 0.00016480805f, -0.00012347073f, -0.00013603341f, 0.00010748612f, -0.0001302394f, -5.6273766e-06f, -6.499154e-05f, 4.9290826e-05f, -3.0577385e-06f, -3.978371e-05f, -0.00012870654f, 5.5829743e-05f, -0.00021969373f, 6.085444e-07f, -0.00018367222f, -2.2093538e-05f, -0.00021662917f, 4.1347295e-05f, 0.00013956144f, 7.656658e-05f, -0.00019703727f, -0.00018867043f, 1.0156974e-05f, -6.638343e-05f, 0.00016406496f, -1.8056116e-05f, 0.0003505684f, -0.00028363708f, -8.310202e-05f, 0.00033947907f, -0.0001461592f, 1.0475991e-05f, 2.685052e-05f, 0.00024148858f, 0.00014607816f, 1.9639978e-05f, 7.167267e-05f, 8.5061656e-05f, -9.9440855e-05f, -8.929768e-05f, -9.7926146e-05f, 5.2144605e-06f, -1.9763223e-05f, 3.2007483e-05f, 1.3856276e-05f, 5.6493842e-05f, -0.00011446507f, -0.00020514967f, -4.6464083e-05f, 0.00010519724f, 0.00012116642f, -0.00012382817f, 0.00010648587f, 1.39303265e-05f, 3.6510686e-05f, 4.5683214e-06f, 4.2319356e-05f, 3.1745545e-05f, 4.9288832e-05f, 2.5541212e-06f, 0.00018185233f, -2.9933788e-05f, 9.362508e-05f, 6.8000386e-06f, 0.00019172893f, -4.310451e-05f, -8.6098975e-05f, -3.273801e-05f, 0.00022653211f, 0.0001110616f, 8.58738e-05f, 0.00010392569f, -0.00015612165f, 3.9606566e-05f, -0.00031223413f, 0.00024519578f, -8.0533246e-05f, -0.00024382508f, 7.2513714e-05f, -1.38431715e-05f, 4.474971e-05f, -0.00032842558f, -0.0001869797f, -4.8516563e-06f, -0.000114096416f, 5.400118e-05f, -1.3777781e-05f, -2.9036497e-05f, 7.749137e-05f, -2.6451814e-06f, 6.271729e-05f, -1.9649644e-05f, 4.0163828e-05f, 5.5224526e-05f, -0.00012455482f, -9.98291e-05f, 2.9395393e-05f, -1.1439718e-05f, -3.350958e-05f, 7.14212e-05f, -9.2185845e-05f, -2.6618175e-06f, -2.227602e-05f, 4.3282165e-05f, 3.1012987e-05f, 2.3675422e-05f, 4.6970326e-05f, 2.606984e-05f, -0.00010460428f, -7.3086005e-05f, 5.457714e-06f, 8.603346e-05f, -5.8479327e-05f, -2.4192328e-05f, 9.7549746e-05f, -2.8848395e-05f, -0.00017323234f, 6.731317e-05f, -5.6657533e-05f, -4.808709e-05f, -2.0991658e-05f, 4.4789535e-06f, -1.4455391e-05f, 5.9232316e-05f, -0.00018849378f, -1.0756294e-05f, -4.7324287e-05f, 5.2676856e-05f, 0.00010880158f, -6.554136e-05f, -0.00010071631f, -4.1132094e-05f, 5.698291e-05f, -7.7410834e-05f, -2.9175788e-05f, 6.2383165e-06f, -2.1440592e-05f, -2.1261058e-06f, -5.4089396e-05f, 3.7938196e-05f, 1.7607306e-05f, 2.4977255e-05f, 1.4610496e-05f, -4.64826e-05f, -1.3813849e-05f, -1.4024784e-05f, 1.3930022e-05f, 3.1455467e-05f, 5.8410016e-05f, 3.8380258e-05f, -4.0617174e-06f, 2.6357304e-05f, -2.7361051e-05f, 2.3882876e-05f, -3.3250628e-05f, 5.782314e-05f, 8.501028e-05f, -8.856251e-06f, -2.6784624e-05f, 4.0000945e-05f, 4.4538905e-05f, -6.636342e-06f, -5.296284e-07f, 4.8649545e-06f, 0.00023054032f, -7.060629e-05f, -1.6692977e-06f, 1.7387414e-05f, -4.6904093e-05f, 5.8011978e-05f, 4.8744478e-05f, -0.00014209043f, 0.00020302652f, -0.000101952704f, -4.9824706e-05f, -2.6816118e-05f, -7.250679e-05f, -1.6744038e-05f, 0.00013424364f, 6.5199206e-06f, -1.5753081e-05f, 7.353163e-05f, -3.900869e-05f, 5.084588e-05f, 8.2760984e-05f, -5.7378256e-05f, -1.4177929e-05f, 1.1977305e-05f, -2.5682988e-05f, -5.350766e-06f, -4.4068034e-05f, 3.383088e-05f, -1.1199186e-05f, -2.5872767e-05f, 4.80083e-05f, -5.957539e-05f, 9.658815e-06f, -5.6936835e-05f, 0.00012999616f, -1.8461079e-06f, 9.465475e-05f, -4.3492117e-05f, 3.4773423e-06f, -5.1189618e-05f, -7.586458e-05f, -2.8118287e-05f, 1.9175182e-05f, -1.537399e-05f, 4.15683e-05f, -3.790696e-05f, 4.2023003e-05f, 6.8098874e-05f, -6.692573e-05f, -4.3512628e-05f, 9.655338e-05f, -1.5334696e-07f, -5.54762e-05f, -1.9633808e-05f, 9.345346e-06f, 0.00012738966f, -7.041042e-05f, 0.0001044322f, 1.9122823e-05f, 0.0001041208f, 5.5815117e-06f, 0.00011455297f, -0.00017093829f, -3.2359494e-05f, -1.9170397e-05f, 6.6654065e-05f, -3.931641e-05f, -1.1348758e-05f, 1.984254e-05f, -3.4504534e-05f, -5.8845104e-05f, -4.123949e-05f, 5.2286764e-06f, -3.310288e-05f, 5.910174e-06f, 5.115111e-05f, -2.9095474e-05f, -5.7889934e-05f, 3.463528e-05f, -0.000105123065f, 5.302606e-05f, -2.7421609e-06f, 1.1604842e-05f, 3.1411513e-05f, 7.6379746e-07f, 5.0443527e-05f, -4.016665e-05f, 5.2174537e-06f, -4.968986e-06f, 1.7342807e-05f, -1.6247806e-05f, -3.1840897e-05f, -3.216422e-05f, 5.978971e-05f, -2.4967181e-05f, 1.6034739e-05f, 4.1087835e-05f, 1.7288025e-05f, -2.7020238e-05f, -1.1372361e-05f, -8.847074e-06f, -1.1265281e-06f, -1.922675e-05f, 0.000142354f, 9.3239305e-06f, 5.5160002e-05f, -3.8034836e-05f, 0.00021473138f, -5.560704e-06f, 8.806292e-05f, -5.49654e-05f, -4.07208e-05f, -1.6029597e-05f, -5.7486545e-06f, 2.9184486e-05f, 8.583008e-06f, -1.6757636e-05f, -7.753157e-06f, -1.0264978e-05f, 7.23884e-05f, -4.3695736e-06f, -1.9090034e-05f, -4.7027672e-05f, -1.38288315e-05f, -1.03632665e-05f, -2.831823e-05f, 2.037395e-05f, -0.0001077898f, -1.2108293e-05f, 0.00010936241f, -4.3300046e-05f, -8.307973e-05f, 4.8652775e-05f, 2.322849e-05f, -2.7504637e-05f, -1.04356795e-05f, 1.0984297e-05f, -4.714638e-05f, 8.6668966e-05f, 3.2579712e-05f, -1.4848464e-05f, -1.6879243e-05f, 8.381331e-06f, 1.6269169e-05f, 1.7787012e-05f, -1.8581302e-05f, 1.6563827e-05f, -1.1584612e-05f, 3.688105e-05f, -2.0592444e-05f, 3.3134205e-05f, 5.209737e-06f, 4.1679714e-06f, -6.0164806e-05f, 6.109756e-05f, -8.692357e-06f, 3.2077565e-05f, -5.38341e-05f, 4.003702e-05f, -3.2817843e-05f, 3.3566368e-05f, 5.8930185e-05f, -2.2692257e-05f, 2.8645747e-05f, -1.770467e-05f, -2.5626737e-06f, -1.0529352e-06f, -2.1132459e-05f, -5.372765e-05f, 3.6425008e-05f, -1.4032407e-05f, 3.2914784e-05f, -1.6809487e-05f, 1.0659761e-05f, 3.8600714e-07f, 1.0231906e-05f, 9.414895e-05f, -5.4494463e-05f, 5.9853977e-05f, 0.00013548647f, -8.7160624e-05f, -6.565032e-05f, 7.772538e-06f, 1.233711e-05f, -5.3677773e-05f, 5.1303774e-05f, 4.983856e-06f, 6.537925e-05f, -3.1523326e-05f, -3.9154187e-05f, -8.15352e-05f, 3.477934e-05f, 4.2507127e-05f, 3.602508e-07f, 4.297645e-05f, -2.0036226e-05f, 1.1282924e-06f, -1.2135703e-05f, -2.2824357e-05f, 6.4159605e-05f, 0.00012315206f, 0.0001395052f, -1.1720328e-05f, 4.623752e-05f, 4.919555e-05f, -7.193239e-05f, -0.0001572434f, -7.2732305e-06f, -2.7945023e-05f, -1.170862e-05f, -9.35005e-06f, -1.465873e-05f, 7.632143e-06f, 9.418755e-06f, -2.4650728e-05f, 1.1385641e-05f, 1.949777e-05f, 3.970298e-06f, 1.3176632e-05f, -1.4003475e-05f, -5.6015e-05f, 3.5197532e-05f, -7.2726098e-06f, -1.5605017e-05f, 1.13123715e-05f, -8.442985e-05f, 1.1484431e-05f, 1.0428643e-07f, -9.3824765e-06f, -5.4317134e-05f, -2.922143e-05f, -3.2122534e-05f, -2.956325e-05f, -5.4465465e-05f, 1.43211855e-05f, 4.2141488e-05f, 3.4287106e-05f, -2.3121127e-05f, -1.1251291e-05f, -4.1614298e-05f, -3.0329187e-05f, -4.412544e-06f, -1.0341996e-05f, 4.6864152e-05f, 1.7407933e-06f, -4.288794e-05f, -6.699452e-05f, 0.000107716776f, -5.134261e-05f, 3.7126363e-05f, -6.9753565e-05f, 4.572734e-05f, 2.8598863e-05f, -6.559527e-05f, -4.36886e-05f, -1.6854825e-05f, 6.200513e-05f, -3.2708801e-06f, -4.4892855e-05f, 4.9304377e-05f, 8.391547e-06f, -3.4496632e-05f, 1.7124072e-05f, -3.8061487e-05f, -1.817275e-05f, 3.402648e-05f, -4.8880515e-06f, -3.3937847e-06f, -1.755433e-05f, 6.065715e-07f, 1.101837e-05f, -4.2646683e-05f, 0.00010339128f, -8.5078755e-05f, 5.3943466e-05f, -3.8803864e-06f, 8.966657e-05f, 4.2425258e-05f, 8.555482e-05f, 1.3290193e-05f, -6.6184926e-05f, -7.198161e-05f, 8.3341525e-05f, 7.986584e-05f, -9.369754e-05f, 7.105421e-05f, 2.8550983e-05f, -1.07992455e-05f, 1.1731946e-05f, -0.00015039089f, 4.6154066e-05f, 7.15216e-06f, -4.7686797e-05f, -5.3128813e-05f, 3.505501e-05f, 0.000108008404f, 1.1778887e-05f, -8.843949e-05f, 0.000117936936f, -1.9881461e-05f, -4.7550635e-05f, -8.694261e-05f, 0.00010183388f, 0.000111945104f, 0.00013239532f, -7.410712e-05f, 4.0795112e-05f, 0.000121835394f, -5.8343518e-05f, -0.00015753364f, -5.296641e-05f, -3.7987215e-06f, -1.887845e-05f, -1.9826413e-05f, 1.1867765e-05f, 8.7850414e-05f, -0.00012415707f, 1.1794349e-05f, -7.082366e-05f, 0.0004486373f, 0.0005041864f, -0.00030137142f, 0.0002878428f, 0.0003418249f, -7.880528e-05f, -6.100544e-05f, 8.222541e-05f, 6.201326e-05f, -5.4858134e-05f, -0.00014315132f, -9.295392e-06f, -1.9824076e-05f, 0.000145387f, 2.5850872e-05f, 8.7401044e-05f, 0.00021116699f, 0.00028376514f, -0.00016887551f, 0.00014005216f, 0.000255662f, -8.916234e-05f, -4.0279458e-05f, -7.959558e-05f, 7.286424e-05f, -0.0001905838f, -7.7382094e-05f, 0.0005435886f, 0.00012977225f, -3.6838934e-05f, -0.00033219255f, -0.00041118398f, -0.00012043098f, -0.00017116679f, 7.355178e-05f, -0.00012644213f, -0.00011307931f, 1.8259261e-05f, 0.00017711688f, 2.8587767e-05f, -6.824581e-05f, -8.841719e-05f, 6.855983e-05f, -5.549268e-05f, -0.00012512271f, 0.000109920606f, -3.7463644e-05f, 5.4884964e-05f, -0.0006235498f, -0.00088250876f, 0.000404877f, -0.00037508737f, -0.00043034158f, 9.62773e-05f, 0.000112738686f, -0.0001557901f, 5.0349907e-05f, 2.2585837e-05f, -2.305352e-05f, 0.00020648121f, 1.5435264e-06f, -3.0353389e-05f, 7.120891e-05f, -1.5301852e-05f, -0.0002504917f, -0.00037433163f, 0.00031534466f, -0.00017881281f, -0.00019499518f, 0.0001371103f, 9.778257e-05f, 5.180827e-05f, 1.8628543e-05f, 0.0003482956f, 0.000106837135f, -0.00033849775f, 1.8069613e-05f, 5.6730973e-05f, 0.0003179351f, 0.00052348326f, -1.26646955e-05f, -1.0453625e-05f, 1.05651925e-05f, 6.545041e-05f, 2.0731457e-05f, 9.3042225e-05f, -6.4201144e-05f, 9.76958e-06f, 3.872075e-05f, 6.491105e-05f, -7.5693504e-05f, 5.4148208e-05f, 7.614027e-05f, 1.7281994e-06f, 2.4782477e-05f, -4.1897673e-07f, 0.00017581174f, 0.0004557703f, -0.00014071565f, 0.00023193331f, 0.00016436882f, -1.0219623e-05f, -7.298211e-05f, 0.00021732709f, -2.9652625e-05f, 4.696063e-05f, 0.00013505193f, -0.00026421607f, -5.6658337e-05f, -3.2062937e-05f, -7.751601e-05f, -3.6770034e-05f, 5.0133e-05f, 8.9344285e-05f, -0.00020930283f, 2.4376657e-05f, -9.34703e-06f, 4.287197e-05f, -4.453032e-05f, 5.22739e-05f, 6.4275373e-06f, -0.00020416212f, -0.00022410385f, -9.707344e-05f, -8.329746e-05f, 3.462277e-06f, -0.00013760052f, -0.0001931143f, 1.6325059e-06f, 3.5162095e-05f, -1.6013148e-05f, 4.297639e-06f, 3.1099727e-05f, -2.4898289e-05f, -4.9319497e-06f, -2.2354841e-05f, -8.911173e-06f, 1.1421649e-05f, 1.2413019e-05f, -7.43447e-06f, 8.14376e-06f, 1.1126821e-06f, -2.71833e-05f, 1.8332863e-05f, 6.356083e-05f, 1.3480473e-05f, 6.658193e-05f, 5.3283075e-05f, -4.5754372e-05f, -1.1918984e-05f, -0.00011054723f, 4.0358398e-05f, -1.3191038e-06f, -6.46978e-05f, -6.956571e-06f, 3.904448e-05f, 1.3451925e-05f, 6.735393e-06f, 8.648239e-05f, 3.9719536e-05f, 4.8491962e-05f, 1.6416641e-05f, -2.0825648e-05f, 3.326835e-05f, 5.8682002e-05f, -6.655119e-05f, 1.4201738e-06f, -7.246521e-05f, 5.3976573e-06f, -4.3846547e-05f, 9.083684e-05f, -1.0098188e-05f, 2.4789137e-05f, 5.1805804e-05f, -2.9581024e-05f, 5.0976167e-05f };
+static const float mlp_select__32_32__1e_05_layer_1_biases[32] = { 0.142593f, -0.048404f, 0.149518f, 0.217482f, 0.050105f, -0.236349f, 0.059351f, -0.181293f, -0.070347f, -0.014309f, 0.117896f, -0.057916f, 0.003164f, -0.233241f, 0.093942f, -0.271074f, -0.118808f, 0.11865f, -0.10215f, -0.302834f, -0.051373f, 0.085573f, 0.230264f, 0.235355f, -0.139103f, 0.26112f, -0.086464f, -0.292799f, -0.109623f, -0.211728f, -0.129011f, 0.053159f };
+static const float mlp_select__32_32__1e_05_layer_1_weights[1024] = { 0.129172f, 0.229553f, 0.00458f, 0.008782f, -0.0715f, -0.137871f, -0.040739f, -0.140197f, 0.225911f, -0.282815f, -0.311771f, 0.002811f, 0.037837f, 0.273044f, -0.042018f, -0.034928f, 0.167252f, 0.144118f, 0.171648f, -0.140654f, 0.022147f, 0.011363f, 0.052384f, 0.195172f, -0.068745f, -0.172605f, -0.025148f, -0.208314f, -0.316183f, -0.315679f, -0.037041f, -0.024692f, -0.154473f, 0.077816f, -0.018552f, -0.036552f, 0.305347f, 0.292058f, 0.131239f, -0.163087f, 0.192511f, 0.088458f, 0.187821f, 0.043745f, -0.053224f, -0.058957f, 0.302807f, 0.250256f, 0.303429f, 0.135829f, 0.141896f, 0.288721f, -0.165554f, -0.028086f, -0.210638f, -0.293751f, -0.20962f, 0.042875f, 0.257027f, -0.275729f, 0.213718f, -0.234959f, -0.155345f, -0.110426f, 0.099807f, -0.027783f, -0.043129f, 0.176317f, 0.213566f, 0.25359f, 0.20732f, 0.278519f, -0.237947f, 0.315146f, 0.234882f, 0.105615f, 0.151848f, -0.13353f, 0.022636f, -0.183835f, 0.132982f, 0.201748f, -0.204489f, -0.225596f, 0.005625f, 0.108203f, 0.219621f, 0.051082f, 0.178593f, -0.153011f, -0.097312f, 0.185992f, 0.118311f, -0.199751f, 0.256956f, 0.307215f, 0.032635f, 0.165442f, 0.293469f, 0.158865f, 0.05807f, -0.153513f, 0.186917f, -0.151197f, -0.005035f, 0.012244f, 0.034825f, 0.192096f, -0.128712f, 0.23227f, 0.167007f, -0.149907f, 0.182515f, -0.152852f, 0.181524f, -0.150958f, -0.20323f, -0.061868f, 0.312588f, -0.139282f, -0.077022f, -0.277501f, 0.02349f, 0.133354f, -0.294994f, -0.170418f, -0.141524f, -0.183767f, -0.278773f, 0.062984f, -0.214583f, 0.074444f, -0.016321f, 0.306926f, 0.267059f, 0.044572f, -0.298156f, 0.251755f, 0.055373f, -0.182994f, -0.206966f, 0.029272f, 0.05583f, -0.227632f, -0.046235f, -0.154363f, -0.272219f, 0.129336f, 0.220714f, 0.163326f, 0.004711f, -0.057747f, 0.116004f, -0.237629f, -0.023613f, 0.272741f, -0.143329f, -0.312205f, -0.193744f, -0.015216f, -0.0056f, 0.127787f, -0.05574f, -0.036617f, 0.05676f, 0.082402f, 0.246091f, 0.249159f, 0.15415f, -0.138786f, -0.252969f, -0.141276f, 0.024429f, 0.221957f, -0.197024f, -0.305717f, 0.089586f, 0.003264f, 0.002863f, -0.189149f, -0.207526f, -0.011318f, -0.285644f, -0.069139f, -0.103389f, 0.001169f, 0.213724f, -0.269737f, 0.196431f, -0.052403f, 0.273246f, 0.033233f, 0.102918f, 0.107965f, 0.066925f, 0.167092f, 0.146335f, 0.092065f, -0.092152f, -0.275455f, 0.117223f, 0.037253f, -0.29455f, 0.301099f, -0.170645f, 0.263661f, 0.215763f, -0.079927f, 0.096896f, 0.012089f, -0.046831f, -0.204522f, -0.231419f, 0.137551f, -0.24523f, 0.064293f, 0.008349f, -0.182106f, 0.098231f, 0.161644f, 0.026572f, -0.124466f, -0.068155f, 0.131064f, -0.117541f, 0.104094f, -0.108997f, 0.182387f, -0.298377f, -0.175107f, -0.221994f, 0.194131f, -0.069023f, 0.065756f, 0.111214f, -0.321108f, 0.041075f, 0.115493f, 0.125813f, 0.166666f, -0.202873f, -0.107087f, -0.130234f, 0.170748f, 0.122507f, -0.220077f, 0.161132f, 0.247949f, 0.255522f, -0.289981f, 0.257286f, 0.230853f, 0.292301f, 0.028541f, -0.196994f, -0.21471f, -0.016516f, 0.035793f, -0.227346f, -0.31256f, -0.21528f, -0.026393f, -0.045295f, -0.221451f, -0.139862f, 0.095621f, -0.10716f, -0.283287f, -0.008934f, -0.057468f, 0.153716f, -0.293963f, -0.07351f, 0.271483f, -0.123187f, 0.135836f, 0.290165f, 0.308406f, 0.080451f, 0.132922f, 0.309226f, 0.271448f, 0.008025f, -0.174487f, 0.109252f, 0.222976f, 0.205328f, 0.135184f, -0.29284f, -0.021769f, -0.187255f, -0.036963f, -0.09702f, 0.198222f, 0.029138f, 0.232285f, -0.212429f, 0.252991f, -0.088401f, 0.249707f, 0.008375f, 0.227109f, -0.08696f, -0.197819f, 0.139703f, 0.196183f, -0.14927f, -0.025785f, -0.115684f, 0.06505f, 0.196127f, -0.107764f, -0.056197f, 0.175255f, -0.310083f, 0.067883f, 0.148323f, -0.219312f, -0.037665f, 0.193162f, -0.090796f, -0.256963f, -0.239555f, -0.156752f, 0.230994f, -0.27505f, -0.183628f, -0.044457f, -0.14941f, -0.000314f, 0.32567f, -0.00388f, -0.159973f, 0.26415f, -0.096074f, 0.15178f, 0.112829f, 0.069757f, 0.133336f, -0.304471f, 0.003629f, -0.165672f, -0.128387f, -0.219582f, -0.164686f, -0.128049f, -0.197999f, 0.079291f, -0.235631f, 0.013275f, -0.019349f, 0.075558f, -0.110116f, 0.207544f, -0.263157f, 0.241139f, 0.246202f, -0.043995f, -0.040024f, -0.182259f, 0.095136f, 0.227099f, -0.171583f, 0.272891f, -0.304568f, -0.133966f, 0.107142f, 0.292375f, -0.083492f, 0.272253f, 0.227578f, 0.249003f, -0.189286f, 0.142205f, -0.270659f, -0.064482f, 0.07582f, -0.269318f, 0.287282f, -0.297795f, -0.269015f, -0.233389f, 0.141521f, -0.069211f, 0.033698f, 0.05651f, 0.137272f, 0.21678f, -0.184757f, 0.051613f, -0.00295f, -0.125078f, 0.053092f, -0.014366f, 0.040608f, -0.024137f, -0.001998f, -0.249613f, 0.194896f, -0.271393f, 0.056642f, -0.048308f, -0.168523f, -0.029107f, -0.054892f, 0.022634f, -0.156102f, 0.127615f, 0.226763f, 0.102525f, 0.22076f, -0.013384f, -0.307156f, 0.040639f, 0.307507f, -0.089307f, 0.29361f, -0.198887f, -0.265227f, -0.087031f, -0.090536f, -0.059068f, 0.007961f, -0.102173f, 0.20482f, -0.136729f, 0.038026f, 0.101018f, -0.057272f, -0.160548f, 0.167068f, -0.104184f, -0.166091f, 0.176337f, -0.024124f, 0.170349f, 0.127858f, -0.283964f, 0.15764f, -0.194274f, 0.108621f, -0.107597f, 0.021049f, 0.010181f, 0.229695f, -0.043698f, -0.303408f, 0.167613f, 0.050517f, 0.179884f, -0.054885f, 0.206904f, 0.29958f, -0.219252f, 0.282648f, -0.03439f, 0.140367f, -0.285063f, 0.155716f, -0.130014f, 0.115599f, -0.225038f, 0.184878f, -0.166837f, -0.019582f, -0.286024f, 0.130808f, -0.248106f, 0.112639f, -0.055965f, -0.037273f, -0.191085f, 0.122598f, -0.279941f, 0.291179f, 0.045058f, -0.216914f, 0.066938f, -0.01617f, 0.166372f, 0.083545f, -0.286186f, 0.243419f, 0.299503f, 0.141669f, -0.298367f, -0.055081f, 0.137152f, 0.251039f, 0.123639f, -0.087259f, -0.114684f, -0.294177f, 0.076689f, -0.067076f, 0.071901f, 0.264234f, -0.098969f, -0.085778f, -0.199018f, -0.278695f, -0.092355f, 0.202456f, 0.276745f, -0.053655f, 0.184576f, 0.279852f, 0.182203f, 0.288769f, -0.306141f, -0.238409f, 0.127049f, -0.037269f, -0.016477f, 0.012438f, 0.311375f, -0.011539f, 0.269675f, -0.255314f, 0.236198f, -0.087652f, 0.173267f, -0.107019f, 0.062939f, -0.243888f, -0.229652f, -0.234447f, 0.088698f, 0.062844f, -0.226004f, 0.061677f, -0.082081f, 0.051983f, 0.147593f, 0.219066f, -0.105865f, 0.00205f, -0.073437f, 0.282029f, 0.026362f, -0.238376f, 0.154946f, 0.119247f, -0.137849f, -0.188671f, 0.157236f, 0.263382f, 0.093344f, 0.176218f, 0.107387f, 0.287804f, -0.212008f, -0.131669f, -0.15195f, 0.285687f, 0.218777f, 0.161483f, -0.040678f, -0.13812f, 0.101817f, 0.290881f, 0.153536f, -0.050669f, 0.059477f, -0.295678f, 0.166303f, -0.205467f, -0.145426f, 0.090843f, -0.068791f, 0.123047f, -0.175602f, -0.22772f, -0.039042f, -0.178574f, -0.205423f, 0.230234f, 0.108729f, 0.172553f, 0.256737f, -0.299784f, -0.159726f, 0.272547f, -0.046657f, 0.255724f, 0.130773f, 0.115136f, -0.086206f, -0.04878f, 0.111863f, 0.152937f, -0.216281f, 0.233828f, 0.130015f, 0.246066f, -0.068279f, -0.237001f, -0.070252f, -0.228103f, -0.003946f, -0.255297f, 0.150429f, -0.099403f, -0.182798f, 0.154885f, -0.298248f, -0.278022f, 0.027589f, -0.267976f, 0.007088f, 0.305887f, -0.051284f, 0.109064f, -0.095868f, 0.200492f, 0.313525f, 0.162047f, 0.052721f, 0.280387f, 0.256751f, 0.17442f, 0.124757f, -0.275722f, 0.246114f, -0.286086f, 0.272222f, -0.002983f, 0.303536f, -0.271551f, -0.046402f, 0.233947f, -0.073478f, 0.272606f, -0.302506f, -0.096256f, -0.298998f, 0.106279f, -0.075176f, -0.234498f, -0.005387f, 0.042588f, 0.17935f, -0.072784f, 0.194843f, 0.170639f, 0.24253f, 0.114905f, -0.14776f, 0.282714f, 0.27106f, -0.265696f, -0.001059f, -0.274766f, 0.116409f, 0.085611f, -0.293388f, 0.205963f, -0.191952f, -0.251915f, -0.169658f, 0.190717f, -0.131229f, 0.243589f, -0.098578f, 0.087669f, 0.125726f, 0.286785f, 0.195673f, 0.214713f, -0.206828f, -0.253542f, -0.04223f, 0.028484f, -0.134934f, 0.052566f, 0.063444f, -0.086017f, 0.076209f, -0.071815f, -0.11248f, -0.165228f, -0.171105f, -0.29539f, -0.162764f, 0.118768f, 0.290421f, 0.212627f, -0.12151f, 0.232145f, 0.15113f, 0.003079f, -0.049839f, -0.28976f, 0.195441f, 0.290942f, 0.059471f, 0.085621f, -0.227241f, -0.071346f, -0.029469f, -0.216783f, 0.114375f, 0.270517f, 0.024722f, 0.241525f, 0.097153f, -0.021883f, 0.009018f, 0.125561f, -0.291186f, -0.119414f, 0.086094f, 0.096219f, -0.15141f, -0.165815f, 0.18073f, 0.078485f, -0.043409f, -0.246449f, 0.01389f, 0.157073f, -0.103805f, 0.231508f, -0.207817f, -0.227029f, -0.277404f, 0.214043f, -0.144683f, 0.145591f, -0.013927f, 0.180398f, 0.003433f, -0.253846f, -0.079969f, -0.046966f, -0.117092f, 0.022421f, -0.255627f, -0.087967f, 0.278963f, 0.292485f, -0.034172f, -0.047662f, -0.006778f, -0.010179f, -0.024762f, 0.122491f, 0.15268f, -0.249838f, -0.206939f, 0.029543f, 0.089131f, -0.103073f, 0.254959f, -0.250287f, 0.116086f, -0.217581f, 0.221605f, 0.03158f, 0.03877f, 0.0463f, 0.122585f, 0.259729f, 0.145029f, -0.137359f, -0.033222f, -0.066295f, 0.096239f, -0.068837f, -0.264204f, 0.270698f, -0.04618f, 0.260193f, 0.128253f, 0.246393f, 0.184971f, 0.091944f, -0.246167f, 0.196235f, 0.119972f, 0.297918f, -0.200632f, -0.270798f, 0.003353f, -0.097914f, 0.295373f, 0.14438f, -0.017547f, -0.206124f, -0.026367f, -0.005815f, -0.316528f, -0.133826f, -0.15612f, -0.082671f, -0.061399f, -0.12727f, -0.244682f, -0.216222f, 0.130616f, 0.267072f, -0.08353f, -0.20391f, -0.159933f, -0.225267f, -0.171556f, 0.112921f, -0.067631f, -0.170382f, 0.063796f, 0.24055f, -0.309905f, 0.063882f, 0.117773f, -0.058229f, 0.261454f, -0.188267f, -0.296779f, 0.228896f, -0.075339f, 0.186207f, 0.299878f, -0.216423f, 0.194683f, 0.178084f, 0.153027f, -0.048516f, 0.054271f, -0.135394f, -0.298562f, 0.129787f, -0.236469f, -0.132858f, -0.286888f, 0.059662f, 0.209405f, -0.268204f, -0.049174f, 0.220005f, 0.16196f, -0.189921f, -0.141947f, 0.064344f, -0.171685f, -0.110529f, 0.158158f, 0.05275f, -0.231017f, -0.068027f, -0.196323f, 0.045625f, 0.26582f, -0.009243f, 0.191134f, 0.101101f, -0.030611f, 0.272047f, 0.268939f, 0.281306f, 0.220052f, 0.164424f, 0.241012f, -0.194293f, 0.230502f, -0.008794f, -0.215895f, 0.008269f, -0.270221f, 0.233939f, -0.145627f, -0.138689f, -0.048475f, -0.202411f, 0.262036f, 0.112615f, 0.089601f, 0.26435f, -0.2245f, -0.16358f, 0.111037f, 0.11079f, 0.198841f, 0.160845f, -0.280488f, 0.055788f, 0.168732f, 0.246575f, 0.209893f, -0.171199f, -0.164086f, 0.081228f, -0.037295f, -0.068533f, 0.274465f, -0.175669f, 0.225915f, 0.068581f, 0.139412f, 0.17485f, -0.003768f, 0.279516f, -0.020373f, -0.148366f, 0.245712f, -0.017006f, 0.276312f, 0.009118f, -0.16785f, -0.090444f, 0.301664f, -0.174929f, -0.084943f, -0.127127f, 0.153493f, -0.143138f, 0.215314f, 0.267497f, -0.05054f, 0.006868f, 0.175793f, -0.034601f, -0.269776f, 0.012761f, 0.002226f, -0.049792f, -0.143369f, -0.145541f, 0.041697f, -0.222312f, -0.235243f, 0.011786f, -0.071746f, 0.162848f, -0.057363f, 0.252484f, -0.222402f, 0.237415f, -0.201671f, -0.181405f, -0.174279f, 0.159698f, -0.060671f, 0.198255f, 0.085547f, -0.240623f, -0.276432f, 0.072712f, 0.246239f, -0.181802f, -0.050677f, -0.269512f, -5e-06f, 0.20219f, -0.032251f, -0.038034f, -0.167082f, 0.024076f, 0.193464f, 0.040597f, -0.111132f, 0.169679f, -0.250168f, -0.267497f, -0.171472f, 0.009812f, -0.132043f, 0.116459f, 0.194765f, -0.125015f, 0.146258f, -0.170813f, 0.194187f, 0.249607f, -0.074978f, -0.263292f, -0.063866f, -0.093565f, 0.001121f, 0.016699f, 0.248881f, 0.056503f, -0.270408f, 0.110854f, 0.172369f, -0.196054f, -0.185561f, 0.255032f, 0.268082f, -0.247123f, 0.2494f, 0.322164f, -0.004345f, 0.194523f, -0.190406f, 0.007461f, -0.219235f, 0.106865f, -0.06061f, -0.221395f, -0.158934f, -0.245908f, -0.088984f, 0.194224f, -0.008717f, 0.090257f, 0.294524f, 0.104408f, -0.169532f, -0.273348f, 0.212281f, -0.118392f, 0.077096f, 0.238495f, 0.008547f, 0.027849f, -0.059238f, -0.00476f, 0.1071f, 0.056019f, 0.211511f, 0.315467f, -0.056609f, 0.308111f, 0.117597f };
+static const float mlp_select__32_32__1e_05_layer_2_biases[6] = { 0.236087f, -0.316874f, 0.369539f, 0.253873f, -0.154083f, 0.222205f };
+static const float mlp_select__32_32__1e_05_layer_2_weights[256] = { 0.058976f, -0.295091f, -0.084945f, 0.078768f, 0.039178f, 0.045697f, 0.0f, 0.0f, 0.33487f, 0.171562f, -0.149173f, -0.033122f, -0.33329f, -0.16334f, 0.0f, 0.0f, 0.33057f, 0.136235f, 0.408093f, -0.082649f, 0.009759f, 0.389494f, 0.0f, 0.0f, 0.080481f, -0.024955f, 0.202557f, 0.10495f, 0.362436f, 0.382093f, 0.0f, 0.0f, 0.233561f, -0.214923f, 0.084852f, 0.33764f, -0.398833f, -0.296643f, 0.0f, 0.0f, -0.042171f, 0.135486f, -0.311941f, -0.136282f, -0.37943f, 0.187686f, 0.0f, 0.0f, -0.253771f, 0.284574f, 0.066408f, 0.092005f, -0.266909f, -0.242158f, 0.0f, 0.0f, -0.14409f, 0.323051f, -0.294902f, 0.002561f, -0.185683f, 0.179826f, 0.0f, 0.0f, -0.159522f, 0.369259f, 0.027074f, -0.052541f, 0.224654f, -0.041956f, 0.0f, 0.0f, 0.274591f, 0.398144f, -0.150724f, 0.295761f, 0.162726f, -0.141583f, 0.0f, 0.0f, 0.373516f, 0.332456f, -0.135454f, 0.32641f, 0.191323f, 0.039227f, 0.0f, 0.0f, -0.187278f, -0.176665f, -0.109964f, 0.321137f, 0.0545f, 0.288644f, 0.0f, 0.0f, -0.216898f, 0.226395f, -0.384632f, 0.021541f, 0.316207f, -0.184146f, 0.0f, 0.0f, -0.04386f, 0.257829f, -0.364568f, -0.319374f, 0.072477f, 0.018257f, 0.0f, 0.0f, 0.239302f, 0.063582f, -0.348758f, 0.401761f, -0.394562f, -0.012629f, 0.0f, 0.0f, -0.012515f, 0.26562f, 0.156732f, -0.304612f, -0.042065f, -0.301983f, 0.0f, 0.0f, 0.35437f, 0.005127f, 0.060908f, -0.221299f, -0.346062f, -0.137244f, 0.0f, 0.0f, 0.289859f, 0.097976f, -0.137596f, 0.053024f, 0.208379f, 0.377497f, 0.0f, 0.0f, 0.384812f, 0.144605f, 0.274407f, -0.107438f, 0.253924f, 0.098089f, 0.0f, 0.0f, -0.007483f, -0.370002f, 0.069261f, 0.320686f, 0.226574f, 0.29818f, 0.0f, 0.0f, -0.006343f, -0.159731f, 0.323172f, 0.034688f, -0.170102f, 0.336816f, 0.0f, 0.0f, -0.267466f, 0.226766f, -0.204223f, 0.231192f, 0.065738f, 0.041218f, 0.0f, 0.0f, -0.032849f, -0.341485f, -0.060206f, -0.205889f, 0.413837f, 0.177515f, 0.0f, 0.0f, 0.167656f, 0.174405f, 0.056188f, 0.182122f, -0.269992f, 0.211403f, 0.0f, 0.0f, -0.378881f, -0.056661f, 0.068582f, -0.287849f, -0.218581f, -0.352753f, 0.0f, 0.0f, -0.340615f, -0.247364f, -0.340683f, -0.277272f, 0.068585f, -0.402071f, 0.0f, 0.0f, 0.020897f, -0.343155f, 0.124038f, -0.150781f, -0.064743f, -0.385281f, 0.0f, 0.0f, 0.320836f, 0.205273f, -0.37277f, 0.268567f, -0.015435f, -0.190072f, 0.0f, 0.0f, 0.021797f, 0.38245f, -0.065878f, -0.176941f, 0.061639f, -0.243302f, 0.0f, 0.0f, -0.02664f, -0.108746f, -0.077867f, 0.160226f, -0.325011f, 0.030103f, 0.0f, 0.0f, -0.221258f, -0.135867f, 0.053934f, 0.053746f, -0.06884f, 0.358565f, 0.0f, 0.0f, -0.310066f, -0.275749f, -0.043834f, -0.120104f, -0.024005f, 0.136528f, 0.0f, 0.0f };
+static float mlp_select__32_32__1e_05_buf1[32];
+static float mlp_select__32_32__1e_05_buf2[32];
+static int32_t mlp_select__32_32__1e_05_scratch[16];
+static const EmlNetLayer mlp_select__32_32__1e_05_layers[3] = { 
+{ 32, 150, mlp_select__32_32__1e_05_layer_0_weights, mlp_select__32_32__1e_05_layer_0_biases, EmlNetActivationRelu, EmlNetLayerDenseBlocked8 }, 
+{ 32, 32, mlp_select__32_32__1e_05_layer_1_weights, mlp_select__32_32__1e_05_layer_1_biases, EmlNetActivationRelu, EmlNetLayerDenseSparseInput }, 
+{ 6, 32, mlp_select__32_32__1e_05_layer_2_weights, mlp_select__32_32__1e_05_layer_2_biases, EmlNetActivationSoftmax, EmlNetLayerDenseBlocked8 } };
+static EmlNet mlp_select__32_32__1e_05 = { 3, mlp_select__32_32__1e_05_layers, mlp_select__32_32__1e_05_buf1, mlp_select__32_32__1e_05_buf2, 32, mlp_select__32_32__1e_05_scratch, 64 };
+
+    int32_t
+    mlp_select__32_32__1e_05_predict(const float *features, int32_t n_features)
+    {
+        return eml_net_predict(&mlp_select__32_32__1e_05, features, n_features);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+    {
+        return eml_net_regress(&mlp_select__32_32__1e_05, features, n_features, out, out_length);
+    }
+
+
+    float
+    mlp_select__32_32__1e_05_regress1(const float *features, int32_t n_features)
+    {
+        return eml_net_regress1(&mlp_select__32_32__1e_05, features, n_features);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_workspace_size(void)
+    {
+        return eml_net_workspace_size(&mlp_select__32_32__1e_05);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_predict_workspace(&mlp_select__32_32__1e_05, features, n_features, workspace, workspace_length);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_regress_workspace(&mlp_select__32_32__1e_05, features, n_features, out, out_length, workspace, workspace_length);
+    }
+
+
+    static EmlNetChecked mlp_select__32_32__1e_05_checked;
+
+    int32_t
+    mlp_select__32_32__1e_05_check(void)
+    {
+        return eml_net_check(&mlp_select__32_32__1e_05, &mlp_select__32_32__1e_05_checked);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_predict_unchecked(const float *features)
+    {
+        return eml_net_predict_unchecked(&mlp_select__32_32__1e_05_checked, features);
+    }
+
+
+    void
+    mlp_select__32_32__1e_05_regress_unchecked(const float *features, float *out)
+    {
+        eml_net_regress_unchecked(&mlp_select__32_32__1e_05_checked, features, out);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_predict_logits(const float *features, float *logits, float *margin)
+    {
+        return eml_net_predict_logits_unchecked(&mlp_select__32_32__1e_05_checked, features, logits, margin);
+    }
+
+
+    void
+    mlp_select__32_32__1e_05_set_profile(EmlNetProfile *profile)
+    {
+        mlp_select__32_32__1e_05.profile = profile;
+    }
+    
+
+    void
+    mlp_select__32_32__1e_05_accumulate_reset(float *acc)
+    {
+        for (int32_t o = 0; o < 32; o++) {
+            acc[o] = mlp_select__32_32__1e_05_layers[0].biases[o];
+        }
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_accumulate(int32_t offset, const float *values, int32_t n_values, float *acc)
+    {
+        return eml_net_dense_accumulate(&mlp_select__32_32__1e_05_layers[0], offset, values, n_values, acc);
+    }
+
+
+    int32_t
+    mlp_select__32_32__1e_05_predict_logits_accumulated(float *acc, float *logits, float *margin)
+    {
+        eml_net_layer_activate(&mlp_select__32_32__1e_05_layers[0], acc);
+        return eml_net_predict_logits_from_unchecked(&mlp_select__32_32__1e_05_checked, 1, acc, logits, margin);
+    }
+    
\ No newline at end of file
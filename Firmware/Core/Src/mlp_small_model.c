@@ -0,0 +1,115 @@
+#include "mlp_model.h"
+#include <eml_net.h>
+static const float mlp_wt__8___1e_05_layer_0_biases[8] = { 0.22635902f, 1.6617786f, -0.20386915f, 1.0308286f, 2.477859f, -1.2804615f, -0.77700794f, -1.8190702f };
+static const float mlp_wt__8___1e_05_layer_0_weights[4800] = { 6.6360585e-06f, 1.8930601e-05f, 9.2995315e-06f, 8.006618e-06f, -1.1423662e-05f, 2.3350078e-06f, 1.091253e-06f, 2.75098e-05f, 2.553581e-05f, -1.0915324e-05f, 1.39863705e-05f, 8.855829e-06f, 7.970274e-06f, 1.8062352e-05f, -3.2293545e-05f, -1.9079967e-05f, -0.00012019495f, 0.000102273414f, 5.9871665e-05f, 6.275139e-05f, 0.00014714639f, 9.7541524e-05f, -3.487767e-05f, 4.6830435e-05f, -4.5770525e-05f, 3.6985395e-05f, -5.3696152e-05f, 7.175353e-05f, 1.5109767e-05f, -2.5068432e-05f, -4.864077e-05f, 4.714664e-05f, -1.5287147e-05f, -5.8435126e-06f, -6.959501e-05f, 2.6700971e-05f, 2.3991784e-05f, 5.7743205e-06f, 8.331713e-05f, 1.4571689e-05f, -5.1677114e-05f, -5.240708e-05f, 4.9963175e-05f, -6.9535374e-05f, 2.952291e-05f, 5.681893e-05f, -4.759202e-05f, -8.2017534e-05f, -5.5910205e-06f, -2.2873213e-08f, 7.5828734e-06f, 1.5405782e-06f, 1.9193854e-05f, -2.489924e-05f, -1.20103205e-05f, -1.254044e-05f, 7.9176025e-06f, -1.7069426e-05f, -3.842155e-06f, -6.4479655e-06f, -1.3939902e-05f, -2.563775e-05f, -2.1017598e-07f, -1.5622372e-05f, -8.3019986e-05f, -1.539817e-05f, 7.0673115e-05f, -0.00013692013f, 0.000115362964f, -8.10798e-05f, 0.00010037539f, -3.2731277e-05f, 7.18311e-05f, 3.3950175e-05f, 2.507492e-05f, -4.8564365e-05f, -1.5338688e-05f, -6.591494e-05f, -4.5776378e-05f, -4.0541938e-05f, -3.38592e-05f, -2.8384711e-05f, -6.458679e-05f, 4.3527238e-05f, 1.4969426e-05f, -4.684625e-05f, 2.4703693e-05f, -7.13663e-05f, -9.98341e-06f, 6.787541e-05f, -4.4884244e-05f, 7.566387e-05f, -9.6512835e-05f, 6.45701e-05f, -2.7231385e-05f, -7.01403e-05f, 8.81049e-06f, -1.7385655e-05f, 2.0603624e-05f, -2.1117687e-05f, 2.4863075e-06f, -1.3605585e-05f, 1.4264798e-05f, 2.8909812e-05f, -1.2929046e-05f, 3.0834198e-07f, 2.5946406e-06f, 1.03874445e-05f, -1.0065906e-05f, 1.7961238e-05f, -1.071279e-05f, 2.0801283e-05f, 4.4062428e-05f, -3.7320136e-05f, 6.4049076e-05f, -6.090742e-05f, 0.00012944017f, 4.8048216e-05f, 8.10739e-05f, 2.6326337e-05f, 4.2039228e-05f, 2.0750704e-05f, 5.683767e-05f, 3.2829386e-05f, 3.6191466e-06f, -5.8240744e-07f, -8.494092e-05f, -1.7285518e-05f, 2.2501881e-05f, -4.8194517e-05f, 2.1927055e-05f, 9.22326e-06f, -5.7501475e-05f, -4.4511056e-05f, 3.1950174e-05f, 4.828374e-06f, -1.18583675e-05f, 6.4392015e-07f, 3.3421955e-05f, 1.3905581e-05f, 9.1885384e-05f, -2.2370572e-05f, 8.889907e-06f, 9.798061e-05f, 1.9827054e-05f, 1.6828217e-05f, -1.580953e-05f, 2.4088444e-05f, 4.173225e-06f, 2.3379685e-05f, -1.6357184e-05f, 2.3046918e-05f, -1.6289856e-05f, 2.4944422e-06f, -2.0351386e-05f, 2.363481e-05f, 1.9063024e-05f, -1.4035098e-06f, -1.2343474e-05f, -1.7925884e-05f, 3.9365776e-05f, -3.7798777e-06f, 3.941483e-05f, 6.52826e-05f, 0.0001572778f, 0.00012513793f, -0.00014864022f, -6.301249e-05f, 4.7802107e-05f, -2.5235497e-05f, 1.0154298e-06f, -5.1546238e-05f, -2.8232653e-05f, -8.391965e-05f, 2.3086432e-05f, -2.9775023e-05f, -2.226545e-05f, 5.680965e-05f, 4.5533725e-05f, -5.3899974e-05f, -6.316694e-05f, 5.6309073e-06f, 2.9144074e-05f, -5.0630846e-05f, 7.0461276e-05f, -8.320478e-06f, 4.207965e-06f, 4.5112283e-05f, 5.5819077e-05f, -3.5733778e-05f, 4.784131e-07f, -6.1111525e-05f, -9.893444e-06f, 2.7477654e-05f, 1.4750175e-05f, 2.745221e-06f, -1.876329e-05f, -1.1974328e-05f, -2.1134174e-05f, 1.8010139e-06f, -7.986098e-06f, 6.7648025e-06f, -7.5086477e-06f, -8.921116e-06f, -1.862297e-05f, -2.5310872e-05f, 1.044019e-06f, 7.8696706e-07f, -1.1625307e-05f, 0.000102764374f, 0.000112372945f, -0.00011053694f, 7.329516e-05f, -3.2957767e-05f, -0.0001389752f, 4.5385386e-05f, -9.014976e-06f, 4.8443617e-06f, 1.9921628e-05f, 5.5844048e-05f, 3.2334137e-05f, 3.9458875e-05f, -5.066425e-05f, 5.081973e-05f, -4.4945304e-05f, 6.863318e-05f, 4.8078713e-05f, -2.6156804e-05f, 6.0225815e-05f, 2.3021683e-05f, -3.8669074e-05f, -5.3073873e-05f, -2.4220079e-05f, -0.00013921109f, -6.9234e-05f, 3.4889913e-06f, -1.9799718e-05f, -1.0535341e-06f, -2.5996516e-05f, 2.3640634e-05f, 2.1343893e-05f, -1.0840614e-05f, 4.1519734e-06f, -1.3861023e-05f, 4.050314e-06f, -5.0770054e-06f, 1.7288988e-06f, -9.7173115e-06f, -1.4945617e-05f, -2.3141147e-06f, -8.259772e-06f, 2.6681017e-05f, 1.6407706e-05f, 6.9113958e-06f, 1.1528136e-05f, -1.662763e-05f, -1.11244935e-05f, 5.2869013e-06f, 0.000104301864f, -8.8089975e-05f, -4.1251224e-05f, -7.433911e-05f, -0.00013239801f, 9.200357e-05f, 4.2138334e-05f, 6.2938816e-05f, -2.3040868e-05f, 1.5583091e-05f, -4.969646e-05f, -1.265917e-05f, 5.0970448e-05f, 6.1187806e-05f, -1.5637232e-05f, 8.621159e-05f, -2.9258841e-05f, 9.678435e-05f, 5.467602e-05f, 3.321339e-05f, 1.4038694e-05f, 6.387774e-05f, -7.435982e-05f, 4.3549357e-05f, 2.384097e-05f, -9.095572e-05f, -1.9605044e-05f, -6.822151e-05f, 0.0001287268f, 1.0556477e-06f, 4.5898287e-06f, 1.2780911e-05f, -2.6686357e-06f, -1.3562288e-05f, 8.6805385e-06f, -1.390185e-05f, -9.141903e-07f, -7.709941e-06f, -1.6084676e-05f, 1.6114418e-05f, 2.0103786e-05f, 2.6933549e-05f, 2.2489581e-05f, 7.838946e-06f, -1.4616546e-05f, -1.6577025e-05f, -5.1584295e-05f, -9.497638e-05f, -0.00011922996f, -0.00014799424f, 8.888539e-05f, -9.480947e-05f, 8.086682e-05f, -0.00011852193f, -4.3047192e-05f, -3.7944847e-05f, 3.368898e-05f, -4.2076015e-05f, 8.29608e-07f, 2.9494727e-06f, 3.490882e-05f, 3.8499384e-05f, -2.4423945e-05f, -4.0138348e-05f, -5.81796e-05f, -1.6007041e-05f, -6.19797e-05f, -2.6183965e-05f, 1.6392754e-05f, 3.6845544e-05f, -7.635124e-05f, -5.9729355e-05f, -6.912761e-05f, 7.584601e-05f, -7.9625876e-05f, 5.5728382e-05f, 8.1619175e-05f, 6.6970686e-05f, -5.9332588e-06f, 9.5354363e-07f, 6.9420194e-06f, -7.600408e-06f, -1.1301044e-05f, -1.3080179e-05f, -2.9708426e-06f, -1.5552074e-05f, 1.6143742e-05f, -1.7208127e-05f, -4.2206452e-07f, -2.781441e-06f, 7.4160516e-06f, 1.5940584e-05f, -3.293723e-07f, -1.8714376e-05f, -4.5077195e-05f, -1.6631055e-05f, -1.116731e-05f, 2.2756913e-05f, -3.1138912e-05f, -7.141448e-05f, -1.620094e-05f, 9.503292e-05f, -2.7290847e-05f, 8.117789e-05f, 1.4942826e-05f, -1.8264029e-05f, 6.714306e-05f, -6.3640996e-06f, 1.5759286e-05f, -1.09638795e-05f, 7.737479e-05f, 5.2512725e-05f, 4.575133e-05f, -1.2709971e-05f, 1.847364e-05f, 5.245922e-06f, -5.692301e-05f, -4.5410627e-05f, 3.9987597e-05f, 6.746948e-05f, -3.5069868e-06f, 2.7619866e-05f, 0.00010050823f, 6.4830133e-06f, 0.00011566985f, 2.3812629e-05f, 1.8611756e-05f, 2.4270119e-05f, 1.67774e-05f, -1.2705838e-05f, 9.247559e-08f, -3.781395e-06f, -1.9740794e-05f, 1.1231061e-06f, -7.3805263e-06f, 1.9163957e-05f, -2.1635127e-05f, 2.5903892e-05f, -2.4419508e-06f, -1.0886293e-05f, -2.7923063e-05f, -1.2224585e-05f, -5.0562816e-05f, 8.879601e-05f, -0.00011829026f, 9.050344e-05f, 0.00011079815f, -1.2047315e-06f, -3.3041586e-05f, -8.769528e-05f, 3.5346708e-05f, -4.6506964e-05f, -6.252159e-05f, -2.6365946e-05f, -5.362327e-05f, -3.2367105e-05f, -5.708058e-05f, -3.323125e-05f, -3.9030616e-05f, -4.8388283e-05f, -4.202959e-05f, 2.8611603e-05f, 4.7826652e-05f, 5.7819398e-05f, -2.9393568e-05f, -3.8667713e-05f, 1.0992164e-05f, -3.5170284e-05f, 0.00011862055f, -9.259014e-05f, 8.5323554e-05f, -2.810042e-05f, -4.6284018e-05f, 4.2360614e-05f, -6.4750507e-06f, 1.3465928e-05f, 3.7384825e-06f, -1.4328991e-06f, -3.0964877e-06f, -8.10737e-06f, 9.1595775e-06f, 6.809168e-07f, -2.4786618e-06f, 1.9462255e-05f, 1.7495615e-05f, -1.4090293e-05f, -7.732936e-06f, -1.1151358e-05f, 7.1637082e-06f, 2.2251623e-05f, 8.310306e-05f, 7.961809e-05f, -6.563767e-05f, 0.00010134096f, -4.3978504e-05f, -8.939199e-05f, 0.00011228926f, -8.1961094e-05f, 4.6001445e-05f, -4.2629777e-05f, 4.1569005e-05f, 3.791003e-05f, -2.529553e-05f, -1.0707157e-05f, -3.3267777e-05f, 3.8480262e-05f, -2.1114762e-05f, -2.3012615e-05f, 4.920312e-06f, -1.574513e-05f, 2.5823476e-05f, -4.3230044e-05f, -1.5260544e-05f, 6.812288e-05f, 1.8714381e-05f, 4.82919e-05f, 0.00011424882f, 5.314018e-05f, 6.813714e-05f, 0.00012270288f, 0.00011324969f, -4.3146674e-06f, -1.4147179e-05f, -3.0734798e-06f, -1.210023e-05f, -2.0161592e-06f, -2.1417405e-05f, 6.16159e-06f, -4.0390873e-06f, 2.1488155e-05f, 2.3896526e-05f, 7.972639e-06f, -1.0422102e-05f, 9.476327e-06f, 2.0823676e-05f, -8.591271e-06f, -4.1458934e-06f, -9.018674e-06f, -3.25953e-05f, -3.129063e-05f, -7.1378934e-05f, -2.3838436e-06f, -3.2598524e-05f, -3.0764466e-05f, 1.2652626e-05f, 3.429728e-05f, -5.7774982e-06f, 8.192368e-05f, 5.9613474e-05f, -8.261086e-05f, -2.9630972e-05f, 1.0906796e-06f, -6.9438975e-05f, -1.954345e-05f, 4.0156145e-05f, 3.894053e-05f, 2.457296e-05f, 3.270052e-05f, -5.1045878e-05f, -2.5120786e-05f, 6.167913e-06f, 5.5945577e-05f, 7.892397e-06f, -8.166049e-05f, -8.456461e-05f, 3.9064944e-05f, -8.579396e-05f, -8.624611e-06f, 3.895022e-06f, 9.8954704e-05f, -1.3504262e-05f, 1.1895547e-06f, -1.7717552e-05f, -5.623051e-06f, -7.055381e-08f, -7.4486857e-06f, -1.0776546e-05f, -1.2410459e-05f, 7.26356e-06f, 1.4584565e-05f, 6.7619894e-06f, 2.4569898e-05f, -1.7475457e-05f, 1.6504681e-06f, -2.024717e-06f, 4.2110514e-06f, 7.0178045e-05f, -0.00010201669f, 2.2159184e-05f, 6.665879e-05f, 3.8309536e-06f, -3.949955e-05f, 6.234088e-05f, -9.7444834e-05f, 9.305423e-06f, 2.3324932e-05f, 3.4573037e-05f, -7.536648e-05f, -3.4443194e-05f, -2.5656432e-06f, 8.869066e-06f, 5.786533e-05f, 2.3766388e-05f, -2.2952327e-05f, 6.0509898e-05f, 4.6435354e-05f, -1.4569219e-05f, 4.0734238e-05f, -9.134797e-06f, 5.779242e-05f, 7.940616e-05f, 7.2540366e-05f, 0.000116136594f, -0.000116883864f, -4.8876915e-05f, -7.319819e-06f, 9.445567e-05f, -4.298596e-05f, -1.0595151e-05f, 2.0991023e-05f, 6.441943e-07f, 1.867834e-05f, -2.0191274e-05f, 9.683567e-06f, -8.1952415e-08f, -1.4193806e-05f, 1.2391058e-05f, -4.3310397e-06f, -1.9893148e-05f, -1.321548e-05f, -1.4971986e-05f, 1.2615338e-05f, 3.903798e-06f, 1.708005e-05f, 1.19926235e-05f, 3.16632e-06f, -5.199157e-05f, 0.00010221881f, -2.8617662e-05f, -1.3808984e-05f, -2.0440788e-05f, 7.1977105e-05f, -2.8454908e-05f, -4.0220984e-06f, 3.1556938e-05f, -7.741621e-05f, 1.7182494e-05f, 7.8063795e-06f, -2.7765029e-05f, -3.1129835e-05f, 1.1706991e-05f, 1.9366842e-06f, 4.119218e-06f, -1.0192893e-05f, 3.257164e-05f, -3.8674934e-05f, -5.2217405e-05f, -3.3954916e-06f, 3.0650215e-05f, 3.982226e-06f, -1.5727072e-06f, 9.666536e-05f, -9.022373e-06f, 6.509329e-05f, 2.1243453e-05f, 7.067431e-05f, 2.4923702e-05f, 2.0322084e-05f, 1.4543052e-05f, 9.1333395e-06f, -1.2543432e-05f, -1.2352047e-05f, -1.6073911e-05f, -7.038689e-06f, 1.2668135e-06f, 7.311366e-06f, 1.1272388e-05f, 2.477572e-05f, -1.2649018e-05f, -2.1282849e-05f, -2.453336e-06f, 1.0432732e-05f, 4.1583036e-05f, 7.7215096e-05f, 6.825998e-05f, -3.8029295e-06f, -2.7592945e-05f, -7.0067676e-05f, 3.163464e-05f, 1.1516451e-05f, 6.225971e-05f, -3.541917e-05f, 5.8846836e-06f, -5.7763064e-06f, -3.3307497e-05f, -3.294938e-05f, 6.326405e-05f, -5.3499327e-05f, 6.9197504e-06f, -2.1075135e-05f, 3.8581525e-06f, 4.8520422e-05f, -1.94026e-05f, 3.09944e-05f, -4.659317e-05f, -9.572801e-06f, -7.45019e-06f, -5.3058124e-05f, 6.186341e-05f, -5.2821517e-05f, 7.246529e-05f, 4.464567e-05f, -3.4128683e-05f, -1.7405664e-05f, 8.90753e-06f, -1.7105813e-05f, 1.708833e-05f, 6.7766896e-06f, 4.6323494e-06f, 5.0711756e-06f, -1.3619546e-05f, 6.2183645e-08f, 1.5768673e-07f, -1.229829e-06f, -2.0006239e-05f, 1.5460737e-05f, -1.31160505e-05f, -2.5353137e-07f, 2.3325736e-06f, 5.716038e-06f, 5.6927634e-05f, -5.8886253e-05f, 4.4940858e-05f, -6.132476e-05f, -3.56667e-06f, -2.5106592e-05f, 2.0139282e-06f, -3.6334484e-05f, -3.2385575e-05f, -4.5318528e-05f, 7.975256e-06f, 2.8300972e-05f, -1.591289e-05f, -2.4198207e-05f, -3.5392106e-05f, -4.7472724e-05f, -1.456591e-05f, -2.0979604e-05f, -1.2618204e-05f, -3.2325697e-05f, -4.8238973e-05f, 2.9733435e-05f, -3.9751296e-05f, 1.5403495e-05f, 7.825595e-05f, -3.8972026e-05f, -5.470564e-05f, -8.647689e-05f, 9.511332e-06f, 1.8538483e-05f, -4.641827e-05f, 5.875136e-05f, 1.47408255e-05f, 1.8233844e-05f, -1.7939095e-05f, 1.7101935e-05f, -1.004815e-05f, 2.0455464e-05f, 1.2266437e-05f, 2.571565e-05f, 1.5135647e-05f, 5.1754904e-07f, -6.432091e-08f, 2.4812536e-07f, -2.5221464e-06f, -1.4904986e-05f, -6.429322e-06f, 7.700618e-06f, -5.012023e-05f, 1.1958349e-05f, -7.2045914e-05f, -3.6481244e-05f, -7.950341e-05f, 6.187013e-05f, -7.8915604e-05f, -6.259817e-05f, 1.2805528e-05f, -3.7595222e-05f, 5.2265783e-05f, 1.2027756e-05f, 5.7387e-05f, 1.2470507e-05f, -6.262653e-06f, 1.2148563e-05f, 4.253926e-05f, 1.3591549e-05f, -1.1634809e-05f, 3.3626508e-05f, -2.0869633e-05f, -3.8953433e-05f, -3.062224e-05f, -4.784825e-06f, 9.883568e-05f, -3.750324e-05f, 1.0305429e-05f, -5.6742654e-05f, 0.00010959639f, 0.000110959976f, 9.583488e-05f, -3.868853e-05f, 2.3619545e-05f, 9.728254e-06f, 1.0515795e-05f, -1.2067675e-05f, -1.7862016e-05f, -1.0774144e-05f, 2.2880862e-05f, -4.939869e-06f, 2.1756864e-06f, 5.906349e-06f, 1.1704127e-05f, 2.0100144e-05f, -1.2306067e-05f, -7.91118e-06f, 8.260997e-06f, 1.3478378e-05f, -7.2516836e-05f, -3.922492e-05f, -4.1410764e-05f, -4.5736808e-05f, -2.194683e-05f, -6.6278815e-05f, 5.348326e-06f, -4.931009e-05f, 4.2793167e-06f, -3.593409e-05f, 6.0799e-05f, 3.6854282e-05f, -1.3749789e-05f, -1.9119374e-05f, -1.18759845e-05f, 3.866364e-06f, -2.6393118e-05f, 2.1605705e-05f, -4.0189323e-07f, -5.9228546e-06f, 1.3069418e-05f, 1.6852473e-05f, 2.3763534e-05f, -2.1191418e-06f, 0.00010768152f, 3.207968e-05f, -8.90527e-06f, 6.157651e-06f, -2.172601e-05f, 9.441101e-05f, -0.000100250254f, -7.813459e-05f, -1.1592191e-05f, -9.215496e-06f, 1.3341245e-05f, 9.888881e-08f, -5.840943e-06f, -1.794148e-05f, 1.0850861e-06f, -1.5270809e-05f, -8.229956e-06f, 2.4445044e-05f, -1.2190983e-05f, 2.0767542e-05f, 1.5589876e-05f, -1.930223e-05f, -1.7890371e-06f, -1.6362195e-05f, 1.6728221e-05f, 3.0583036e-05f, 2.9933624e-05f, 1.2285746e-05f, 4.5396802e-05f, -7.15284e-05f, -3.397556e-05f, 1.7340406e-05f, -1.8319573e-05f, -3.3079938e-05f, -4.0733266e-05f, 2.2160766e-05f, -4.3721116e-06f, 5.4595283e-05f, 4.324374e-05f, -4.734413e-06f, -1.4396564e-06f, 1.08652575e-05f, 3.3682903e-05f, 1.9544503e-05f, -4.441534e-05f, 1.5601205e-05f, 1.9966465e-05f, 2.3246375e-05f, -5.0649545e-05f, -3.069733e-05f, -5.6315792e-05f, -5.189497e-05f, 0.00012110225f, 0.000104399405f, -6.224813e-05f, -5.2373045e-05f, 6.2962013e-06f, 1.4948467e-05f, -1.3958704e-05f, -1.230099e-05f, 1.1421576e-05f, 4.1865073e-06f, 2.248328e-05f, -9.9179015e-06f, 5.550257e-06f, -1.4025787e-06f, -7.9892725e-06f, 3.322089e-06f, -4.9934295e-07f, -1.0891596e-05f, 1.1387078e-05f, 9.787807e-06f, 1.603565e-05f, -1.483753e-05f, -2.206123e-06f, 5.270073e-05f, 2.7231956e-05f, -3.0148367e-05f, 2.8766075e-05f, 1.9476198e-05f, -4.8176553e-05f, 3.6256308e-05f, -3.3186031e-06f, -1.4506851e-05f, -7.2977887e-06f, 1.8391358e-05f, 2.891686e-05f, 4.839945e-06f, 3.1880147e-05f, 1.773764e-05f, -7.358002e-07f, -3.2640735e-06f, 1.2074322e-05f, -7.9406655e-06f, -2.876955e-05f, -2.1853979e-05f, 0.000102143465f, 6.443136e-05f, -6.014264e-05f, -5.6843037e-05f, -4.5233763e-05f, -7.184153e-05f, 7.211258e-05f, -0.000116067604f, 2.2275392e-05f, -2.4343215e-05f, 1.6195758e-05f, 1.329347e-06f, -1.1252135e-05f, -2.3216032e-06f, 1.640245e-05f, -4.206958e-06f, 1.0860874e-05f, 6.6458497e-06f, -9.014529e-07f, 2.2764052e-05f, 4.2619026e-06f, 9.176885e-06f, 3.3208821e-06f, -1.9886154e-05f, 2.1303314e-05f, -2.2556376e-05f, 3.9039587e-05f, -4.225363e-05f, -3.2737895e-05f, -6.051717e-05f, -1.0925186e-05f, 2.9677058e-05f, -3.0195313e-05f, -4.4502693e-05f, -1.4959973e-05f, 1.9589026e-05f, -3.8535698e-05f, -1.6962791e-05f, -2.8937218e-05f, 2.5475663e-05f, 3.97141e-08f, -3.6605331e-06f, 1.9849562e-05f, -8.610473e-06f, 6.257575e-06f, 2.3009112e-05f, -2.7104546e-05f, 3.8099493e-05f, -5.1881456e-05f, -6.987713e-05f, -4.6966277e-05f, -5.411769e-05f, 2.0907855e-05f, 1.613305e-05f, 6.1014267e-05f, 6.210809e-05f, -1.3394682e-05f, -8.769855e-07f, -1.9033809e-05f, -3.6516096e-06f, -1.3325913e-05f, -3.323421e-06f, 4.20835e-06f, 1.4470261e-05f, -1.4327988e-05f, 2.2021453e-05f, 9.699493e-06f, -8.185328e-06f, 2.0234631e-05f, -4.4724443e-06f, 1.5062115e-05f, -1.3215157e-05f, -8.696488e-06f, -1.2116967e-05f, -3.608707e-05f, 2.6625841e-05f, 4.0589628e-05f, 2.7961178e-05f, 1.884654e-05f, -3.1323787e-06f, 3.1093343e-05f, -1.3439447e-05f, 3.7623104e-05f, 2.043517e-05f, -2.941462e-05f, 3.6425812e-05f, -3.2856653e-05f, -1.2815424e-05f, -1.0307014e-05f, 8.478872e-06f, 2.0292042e-05f, -2.339998e-05f, -7.184028e-06f, 3.0177058e-05f, -2.4473164e-05f, 1.8124043e-05f, 4.0430907e-05f, -0.00012670943f, 1.566874e-05f, 2.3130095e-05f, -7.1721355e-05f, 9.195071e-05f, -1.0878338e-05f, -0.0001228425f, -1.46260045e-05f, 1.393464e-05f, 1.1244313e-06f, -1.9605142e-05f, -1.488884e-05f, 3.0482663e-06f, -1.649355e-05f, 7.9894996e-08f, 3.6544375e-06f, -5.3708404e-06f, 3.3493425e-06f, 1.6598813e-05f, -1.0431829e-05f, 4.916982e-07f, -3.7623343e-07f, 1.8934488e-05f, 2.0951527e-05f, 5.6516266e-05f, -1.2894188e-05f, -2.3122151e-05f, 4.8659367e-05f, -5.4835135e-05f, -1.3337235e-05f, -6.243048e-05f, 3.1123363e-05f, 2.8390952e-05f, 2.1176527e-05f, -2.4615447e-05f, -2.403042e-05f, -1.1306418e-05f, -2.0662745e-05f, 6.248969e-06f, -1.5281632e-05f, -3.4711406e-06f, 1.3028e-05f, 1.5083265e-05f, -3.6476096e-05f, -1.1525982e-06f, 2.7198284e-06f, 2.8058488e-05f, 1.5355597e-05f, 7.836694e-05f, -2.9519224e-05f, -0.00012325545f, 2.1469197e-05f, -3.964678e-05f, 5.220461e-05f, -7.956523e-05f, -1.1677592e-05f, 6.5957315e-06f, 6.48818e-06f, 7.6440745e-07f, 3.9241545e-06f, 2.0151737e-07f, -1.706354e-05f, -1.7962897e-05f, 4.5883526e-06f, -1.2477758e-05f, -1.992352e-05f, 2.5850395e-05f, 1.5928137e-05f, -1.9624214e-05f, -2.7938813e-05f, 1.8615601e-05f, -3.9321087e-05f, -2.3175608e-05f, 1.1353165e-05f, -3.206838e-05f, -3.9714967e-05f, 4.706177e-05f, 5.905793e-06f, -7.074164e-06f, -1.75339e-05f, 1.0028623e-05f, -2.989761e-05f, 2.9672652e-05f, 2.9506415e-05f, 1.9688503e-05f, -2.6802581e-05f, 2.0911315e-05f, 3.0286341e-05f, 8.570389e-06f, -3.2700434e-06f, -2.109181e-05f, 7.3704105e-06f, 2.5719413e-05f, -2.8172977e-05f, 2.165115e-05f, -7.8776095e-05f, 8.022757e-05f, 4.161498e-05f, -1.1027431e-05f, -1.747046e-05f, 9.962917e-05f, -6.452871e-05f, 4.355856e-05f, 1.8023899e-05f, 6.2523277e-06f, -2.6738278e-06f, -2.1148595e-05f, -6.511289e-06f, -1.8610456e-06f, -8.072734e-06f, 5.587878e-07f, -2.0687723e-06f, -9.252384e-06f, -3.2114563e-06f, -4.4365074e-06f, 9.635676e-07f, -2.4674913e-05f, 1.1148141e-05f, 1.3168975e-05f, -6.497621e-06f, 5.6410165e-05f, 4.3366e-05f, -3.169283e-05f, 3.97816e-06f, 4.9079084e-05f, 4.6129473e-05f, 3.1345608e-06f, -3.8559614e-05f, -6.1652113e-06f, -3.968832e-05f, -3.429422e-05f, 3.5903387e-05f, -4.566657e-06f, 2.2943093e-05f, -1.4271466e-05f, 3.1469237e-05f, 1.9755018e-05f, -4.5698052e-06f, 1.755137e-05f, -2.9682773e-05f, -2.8536876e-06f, -1.9202886e-05f, 1.6738533e-05f, -5.9714264e-05f, -3.245701e-05f, -2.9075287e-05f, -2.071356e-05f, -6.2456065e-06f, 5.266901e-05f, -0.0001130527f, 3.0012282e-06f, -1.604136e-05f, -1.6670205e-05f, 9.659592e-06f, 1.813736e-05f, -1.3366195e-05f, 1.40102575e-05f, -1.2310363e-05f, 9.8918845e-06f, 1.499762e-05f, -9.880788e-06f, -4.043287e-06f, 2.3017741e-05f, -1.7622599e-05f, -2.5504332e-05f, -2.53484e-06f, -3.4425836e-06f, 2.2338585e-05f, 6.4717104e-05f, -3.4842393e-05f, 9.92826e-07f, -1.3174766e-05f, 3.5677834e-07f, 4.43695e-05f, 1.4543894e-05f, -1.6511585e-05f, -3.0376243e-05f, 3.468775e-05f, -3.7396945e-05f, 1.6206051e-05f, 4.144933e-05f, 2.377362e-05f, -2.5881416e-06f, -1.1032994e-05f, -1.085825e-06f, 1.6593318e-05f, 9.049572e-06f, 1.6728167e-05f, 2.3831402e-05f, 1.5806972e-05f, 2.900993e-05f, -2.3659264e-05f, -3.2012595e-05f, -9.906135e-06f, -1.008823e-05f, 5.708459e-05f, -3.2131655e-05f, -0.0001136259f, -4.4169898e-05f, -1.2618663e-05f, 1.3639334e-05f, 1.3304347e-05f, 1.42593035e-05f, 1.5879809e-06f, -8.159615e-06f, 7.451142e-06f, 1.7735958e-05f, -1.3604465e-05f, 1.803052e-05f, -2.1139214e-05f, 1.9892155e-05f, 1.2821874e-05f, -2.4180703e-05f, -9.514879e-07f, -6.130288e-07f, -5.114736e-05f, -2.5793917e-05f, 2.084806e-05f, 2.1519596e-05f, 4.462035e-05f, 4.6016652e-05f, 4.4093882e-05f, -5.2492185e-05f, 2.4320849e-05f, -3.0207306e-05f, -2.639099e-06f, 9.830965e-06f, -2.205677e-05f, 1.3188516e-05f, -1.2362443e-05f, -2.5701187e-05f, -1.5378046e-05f, -1.9074741e-06f, -2.2175489e-05f, -3.6261304e-06f, 1.9744562e-06f, -1.9802449e-06f, -2.292194e-05f, -1.8093438e-05f, -2.277941e-05f, -6.64726e-05f, 0.000102767f, -8.998494e-05f, 8.260574e-05f, 2.6544949e-05f, -5.33133e-06f, -2.1403708e-05f, 1.6261269e-05f, -1.1510435e-05f, 8.733155e-06f, 1.5341852e-06f, -9.603365e-06f, 1.801481e-05f, 9.569903e-06f, -1.2712632e-05f, 3.242091e-07f, 1.6830149e-05f, 7.440777e-06f, 2.4494711e-05f, -1.1622317e-05f, 7.0141396e-06f, -8.372655e-06f, 2.4509407e-06f, 3.931872e-05f, 6.9846e-05f, 3.0877625e-05f, -3.0127458e-06f, 3.2898584e-05f, 5.841977e-06f, -2.1658749e-05f, -6.076404e-05f, 1.1460827e-05f, -1.0830839e-05f, 2.0291163e-05f, 8.671877e-06f, 2.0322295e-05f, -5.888523e-06f, 3.0962845e-05f, 6.390835e-06f, 4.043594e-06f, 1.4860654e-05f, -2.0909785e-05f, -2.115096e-05f, -1.8082359e-05f, 2.9433797e-05f, -1.817639e-05f, -3.4295485e-06f, -6.5258115e-05f, -3.1468247e-05f, -2.333682e-05f, 6.293841e-05f, 8.819684e-05f, -1.26368695e-05f, -0.000110222594f, 3.97547e-05f, 2.6586326e-06f, -2.034321e-05f, 1.7560467e-05f, -1.7144894e-05f, 1.0775722e-05f, -1.0887724e-05f, 2.5137658e-06f, 1.6522832e-05f, 1.18293e-05f, 2.3338773e-05f, 4.1462786e-06f, -1.1790417e-05f, 1.5907703e-05f, 7.6565e-06f, 2.7862866e-06f, -2.0772073e-05f, -2.41571e-05f, -2.2231105e-05f, 2.614613e-05f, 3.486376e-05f, 3.1609492e-05f, 4.21867e-05f, 1.6754235e-05f, 4.8049107e-05f, 6.2481433e-07f, -4.1187293e-05f, -3.1774984e-05f, -1.8715695e-05f, 2.1788646e-05f, 3.1905627e-05f, 4.019628e-05f, -2.6004305e-05f, -1.8794482e-05f, 2.6854785e-05f, -5.564063e-06f, 3.122234e-06f, 1.8784347e-05f, -1.8171689e-06f, 1.1195073e-05f, 2.9152585e-07f, 6.9188114e-05f, 6.9258826e-06f, -3.889715e-05f, -6.406721e-05f, -2.2769631e-05f, 1.5595331e-05f, 1.5891197e-05f, 6.0625665e-05f, 4.033847e-06f, 6.743717e-06f, -1.7758919e-05f, -4.0684354e-06f, -8.572859e-06f, 5.6987988e-06f, -3.3901138e-06f, -4.530258e-06f, -2.676247e-06f, 1.7024724e-05f, 2.1601882e-06f, -1.2872889e-05f, -2.050625e-05f, -1.0094111e-05f, 5.262212e-06f, 7.607728e-06f, 1.040636e-05f, 4.368531e-05f, -3.213464e-05f, 1.6886792e-05f, -6.2014506e-06f, 1.6083699e-05f, 3.549278e-05f, -3.080962e-05f, 1.1948483e-05f, 1.890998e-07f, 5.6755534e-06f, 9.536261e-06f, 2.882444e-05f, -2.2185148e-05f, -1.3218747e-05f, 1.9027406e-05f, -1.6531854e-05f, 5.119935e-06f, -9.935499e-06f, -1.1920341e-05f, 3.8580715e-06f, -2.1020463e-05f, 2.2749518e-05f, 2.5113839e-06f, 1.935258e-05f, 9.669502e-06f, 3.4705234e-05f, -4.9456088e-05f, -5.0360144e-05f, -2.310545e-05f, -8.051614e-05f, -1.1680324e-05f, -1.1771846e-05f, 1.4256234e-05f, 1.5819362e-05f, 7.494702e-06f, 8.2236554e-08f, 1.7978176e-05f, 2.1457836e-05f, 1.48957815e-05f, -4.782955e-06f, -3.9932606e-06f, -1.4989256e-05f, 5.8083165e-06f, 2.0675145e-05f, 1.4582464e-05f, -2.4277922e-05f, -2.2565311e-05f, 3.0701503e-05f, 1.8174514e-05f, -3.919245e-05f, 2.8865654e-05f, 4.58596e-06f, -4.9001836e-05f, -3.896074e-05f, -5.2002e-05f, -2.4118075e-05f, -3.19739e-05f, -1.7993898e-05f, 3.6472375e-06f, -2.661989e-05f, -1.7323533e-05f, -1.3486825e-05f, -8.56611e-06f, -5.330336e-06f, -9.27313e-06f, 1.7472692e-05f, 2.5272673e-05f, -4.8226484e-06f, 2.6357879e-05f, -1.4516826e-06f, -1.4916924e-05f, 2.3691416e-06f, -3.3009983e-05f, 6.4912197e-06f, 6.1831174e-06f, 1.39128915e-05f, 8.5437445e-05f, 4.7155485e-05f, 1.4120927e-05f, -4.514848e-06f, -1.9885058e-05f, -7.936253e-06f, 1.1854337e-05f, -1.3653992e-05f, -1.8858615e-05f, 2.2062788e-05f, 1.2395961e-05f, 8.969036e-06f, 1.4709676e-05f, 1.4211798e-05f, 5.7756197e-06f, 1.5758369e-05f, 1.51012155e-05f, -1.7604598e-05f, 4.1399676e-06f, -5.290538e-06f, 1.7545917e-05f, 3.698274e-05f, -9.460038e-06f, 3.8281363e-05f, 3.0881314e-05f, -1.7732005e-05f, 2.5883417e-05f, 9.667009e-06f, 1.3241545e-06f, -9.715602e-06f, -2.5315972e-05f, 1.1125683e-05f, 2.6897314e-05f, -1.9951207e-05f, 1.0960942e-05f, 1.933764e-06f, 2.2133941e-05f, -4.5264705e-06f, -1.7248186e-06f, -5.720262e-06f, -1.4646816e-05f, 1.5029544e-05f, 2.1921174e-05f, -5.7519068e-05f, -3.342435e-05f, -7.159971e-05f, 5.6554698e-05f, 4.845912e-05f, 8.840875e-05f, -1.3463617e-05f, 3.064048e-05f, -9.136139e-06f, -1.0284026e-05f, -8.626377e-06f, 1.05762265e-05f, -1.0409313e-05f, 1.3714153e-05f, 2.4846688e-05f, -1.5430447e-05f, -1.08841095e-05f, -1.8080775e-05f, -2.2837077e-05f, -6.124252e-06f, -4.563861e-06f, 1.1694167e-05f, -2.0302154e-05f, -1.0513209e-06f, 3.707353e-05f, 2.8918521e-05f, 2.3481849e-05f, 1.3864179e-05f, 3.649103e-05f, 3.1190132e-07f, -5.607957e-05f, -3.3646887e-05f, -1.136372e-05f, -3.0066358e-06f, 1.652131e-05f, -1.219705e-05f, 1.3115489e-05f, 2.2953252e-05f, -2.1495212e-06f, 2.9745119e-05f, 1.2077744e-05f, 1.911889e-05f, 7.1995128e-06f, 1.1574285e-05f, 7.124471e-06f, 2.3913546e-05f, -1.2920272e-05f, 7.996364e-06f, 4.2991733e-06f, 7.068327e-05f, -5.9119833e-05f, 5.8905618e-05f, 8.117398e-05f, -6.031166e-05f, -1.8834315e-05f, 1.5735239e-05f, 5.634104e-06f, 1.2391061e-05f, 8.407223e-06f, -2.9838807e-06f, -4.6778778e-06f, 5.4425755e-06f, -9.413255e-06f, -8.649771e-06f, 2.5320703e-06f, -1.0483787e-05f, 1.6223388e-05f, 1.1019947e-05f, -9.432748e-06f, 1.2584897e-05f, 7.23998e-06f, 2.327957e-05f, 3.052245e-05f, 4.859787e-06f, -3.5661364e-05f, 3.869356e-05f, -4.694828e-05f, -1.942926e-05f, 2.4766397e-05f, 3.646998e-05f, 2.0299299e-06f, 1.9946824e-06f, -2.4074126e-05f, -6.269636e-06f, 3.894446e-06f, -2.6138748e-06f, -1.5776503e-05f, -1.259367e-05f, -2.6077607e-06f, -5.1769866e-06f, 8.742187e-06f, 1.0424621e-05f, -1.52135435e-05f, -4.834374e-06f, -1.8877055e-05f, -1.7542176e-05f, -2.406861e-05f, 3.8762275e-05f, 2.5317422e-05f, 2.3127977e-05f, 6.190313e-05f, 6.6823544e-05f, 2.1216136e-05f, 5.7070414e-05f, 1.1969516e-05f, -4.7957997e-08f, -1.3707994e-07f, -1.3616274e-05f, 1.5245847e-05f, -1.7345608e-05f, 1.4641177e-05f, 1.6365266e-05f, -2.8577815e-06f, -1.6468952e-05f, -2.0712758e-05f, 1.9204785e-05f, -4.552249e-06f, 6.2851486e-06f, 1.2744967e-05f, -1.7898581e-05f, 3.6785397e-05f, 4.354803e-06f, -1.6466518e-05f, 4.4908535e-05f, 3.561331e-05f, -2.7990493e-05f, 1.0592075e-06f, -3.7386715e-05f, 2.5633758e-06f, 9.449386e-06f, 1.1116307e-05f, -1.1321711e-05f, -4.8214724e-06f, 2.530533e-07f, 1.2590746e-05f, 2.2645845e-05f, 2.4743293e-05f, -2.5094265e-05f, -1.1292261e-05f, -1.918363e-05f, -2.0954512e-05f, -3.885935e-06f, 5.1431134e-06f, 1.1133413e-05f, 4.8860984e-05f, 6.01905e-05f, 7.992526e-05f, 5.717159e-06f, 7.202213e-05f, 5.3021762e-05f, -4.1936262e-05f, 3.940851e-05f, -2.1837872e-05f, -2.2682158e-05f, -1.25694e-05f, 3.8099975e-06f, 9.451064e-07f, -1.846907e-05f, 1.1919416e-05f, 1.5502166e-05f, -1.2499946e-05f, -6.714636e-06f, 8.5861686e-08f, 4.822649e-06f, 1.2721671e-05f, 1.8944875e-05f, 7.189906e-06f, -2.1777048e-05f, 2.6945938e-05f, -2.3448732e-05f, -1.9208099e-05f, -2.074883e-05f, -2.7176726e-05f, 2.9901958e-06f, 2.0931773e-06f, -6.161323e-06f, 1.8583e-05f, -2.1186905e-05f, 1.4962324e-05f, 1.2491268e-05f, 4.717209e-06f, 3.4750124e-06f, 1.2592997e-05f, -1.5847813e-06f, 6.212831e-06f, -8.464809e-06f, -9.120213e-07f, 8.867179e-06f, -2.5377225e-05f, -1.2361627e-05f, 2.1583388e-05f, 1.7656464e-05f, -2.2320379e-05f, -1.9558045e-05f, 6.785566e-05f, 2.9069093e-05f, 3.5280325e-05f, -3.2417072e-05f, -7.922763e-05f, -2.9030101e-05f, 3.0171532e-06f, 1.0464299e-05f, 1.0192796e-05f, -1.2497404e-05f, -1.4528336e-05f, -9.123978e-06f, -7.1256504e-06f, 1.5492624e-05f, 1.696649e-05f, -2.3358293e-06f, 2.4051262e-05f, -1.0838331e-05f, 1.8093437e-05f, -2.3824838e-05f, -2.5318817e-05f, 9.4343e-06f, -2.6414731e-05f, 1.551033e-05f, -2.7912643e-06f, 2.378757e-05f, 3.2159835e-05f, 2.2432008e-05f, 1.5409962e-05f, -3.8834598e-05f, -1.4696813e-05f, -6.5531763e-06f, -2.945062e-06f, -2.0180354e-05f, -8.2273455e-06f, 2.8064469e-05f, -2.9872979e-06f, -5.408991e-06f, -2.0679667e-05f, 1.1083492e-05f, -1.2683755e-05f, -1.40905295e-05f, -1.7353046e-05f, 2.1288777e-05f, -8.732761e-06f, 1.8569152e-05f, 5.5158624e-05f, 6.202266e-05f, -5.446423e-05f, -6.0795148e-05f, 5.349731e-05f, -3.51564e-05f, -3.9699815e-05f, -6.761587e-05f, -1.6585658e-05f, -2.6183302e-06f, -1.9000541e-05f, -1.1170857e-06f, -7.358135e-06f, -2.1523178e-05f, 7.157257e-07f, -1.2328079e-05f, 2.8589218e-06f, 1.3322899e-05f, 1.6204356e-05f, -1.4445999e-05f, 2.7009028e-06f, 1.3517771e-05f, -2.2034616e-05f, 1.3057766e-05f, 3.1783053e-05f, 3.204595e-05f, -2.4184572e-05f, -2.9473797e-05f, -1.9296243e-05f, -1.4001192e-05f, -2.230607e-06f, -1.15102375e-05f, 5.1067973e-06f, -1.4215696e-05f, -1.5743271e-05f, -1.5690937e-05f, 2.0365183e-05f, 2.7961885e-05f, -7.1524923e-06f, 1.6055532e-05f, -8.810885e-06f, 1.2519422e-05f, -1.2532334e-05f, 7.448891e-06f, -2.4863608e-05f, 2.465079e-05f, 1.4167788e-05f, 2.0253301e-05f, 1.8231864e-05f, -5.1435754e-06f, 1.981467e-05f, -1.4285437e-05f, 1.259599e-05f, 4.7660244e-05f, -5.238237e-05f, -6.5484535e-05f, -6.4123556e-06f, -8.485706e-06f, -2.0537216e-05f, 1.9557974e-05f, 6.2489166e-06f, -1.1510429e-06f, 2.4073159e-05f, -1.3235201e-05f, 1.7574483e-05f, -1.6970855e-05f, -7.4813306e-06f, -7.2962475e-06f, 1.2761231e-05f, -2.3299832e-05f, 9.960794e-06f, 7.758276e-06f, -2.7005535e-05f, 3.0998126e-05f, 1.389132e-05f, 3.3863023e-05f, 2.0860072e-05f, 7.127253e-06f, 1.3178595e-05f, -1.8356963e-05f, -2.480066e-06f, -1.653797e-05f, 2.3762983e-05f, -1.9501897e-05f, -2.1928712e-05f, -3.1747556e-06f, 7.2421994e-06f, -2.0977204e-05f, 3.1571894e-06f, 1.2095735e-05f, 1.01095675e-05f, 5.5505902e-06f, 1.4800216e-05f, 2.2371361e-05f, 1.9546973e-05f, 9.345552e-06f, 6.53192e-06f, -7.127383e-05f, 1.693524e-05f, 5.1270406e-05f, 6.162455e-05f, -1.2512209e-05f, -5.2491265e-05f, 2.2885595e-05f, 6.0599004e-06f, 1.7797027e-05f, 1.1303714e-05f, 8.26396e-06f, -2.0564888e-05f, -3.6185147e-06f, -2.3291914e-06f, 4.2569095e-06f, -7.84432e-06f, 1.5112314e-05f, 1.8804527e-05f, -2.1324636e-06f, 2.385058e-06f, -7.878222e-06f, 1.4107494e-05f, -1.8495244e-05f, 1.6993215e-05f, 4.0645366e-05f, -1.6524138e-05f, -1.4613935e-05f, 1.6902382e-05f, 2.1790074e-05f, -1.0497304e-05f, 4.6226505e-06f, -1.807698e-05f, -7.345333e-06f, -1.7050796e-05f, -1.4609527e-05f, -8.81246e-06f, 2.4471826e-06f, 2.7208554e-05f, -1.3397408e-05f, -4.913897e-06f, 5.1632975e-07f, 1.9332965e-05f, -1.5938547e-05f, 1.28507745e-05f, -1.8601406e-05f, 4.1062303e-06f, 2.4092428e-06f, -3.188718e-05f, -2.4325664e-05f, -4.498834e-06f, 3.2914097e-05f, 7.89224e-05f, 1.2667605e-05f, 5.0694736e-05f, -1.9711495e-06f, -1.0001627e-05f, -1.3143162e-05f, -7.410193e-06f, 7.1075965e-06f, -2.339602e-05f, -1.7619142e-05f, 9.336993e-06f, -7.4199274e-06f, 2.1918959e-05f, -1.5133333e-05f, -2.2262062e-05f, -1.5201558e-05f, 2.1264743e-05f, -2.53967e-05f, -2.8538412e-05f, 1.8921337e-05f, -1.2469449e-05f, 1.9606174e-05f, 2.6833743e-05f, 1.2292715e-05f, 3.4003173e-05f, 1.6685945e-05f, -3.4965462e-05f, 1.1948498e-06f, 5.608352e-06f, 8.011171e-06f, -2.0663505e-05f, 3.9566594e-06f, 1.6206017e-05f, 1.6248583e-05f, 7.4328473e-06f, -4.709868e-07f, 6.572538e-07f, 4.4714134e-06f, 1.6782258e-05f, 5.552414e-06f, 1.1311593e-05f, 6.913884e-06f, -1.3718624e-05f, 4.3544424e-06f, -2.054289e-05f, -3.3074728e-05f, -1.7516191e-05f, -4.1871677e-05f, 2.6155018e-05f, 3.463369e-05f, -2.8685712e-05f, -6.616432e-05f, -2.2650522e-05f, 3.0558153e-06f, -1.7310933e-05f, -1.4511749e-05f, 1.3404244e-05f, -1.5843541e-06f, -1.204439e-05f, 1.8705061e-05f, 3.0393103e-05f, -8.885068e-06f, -2.6026462e-05f, -1.3495085e-05f, -1.0278211e-05f, 1.8345885e-05f, -2.7123235e-05f, 1.6702166e-05f, -2.7678294e-05f, 5.1954457e-06f, 1.5319987e-05f, -2.3239347e-05f, 1.1426408e-05f, 3.162352e-05f, -3.1234063e-05f, 1.2242347e-05f, 6.355855e-07f, -1.9652567e-05f, -2.12159e-05f, -2.8122504e-05f, 2.6448704e-06f, 2.472954e-05f, 1.3265636e-05f, 1.100933e-05f, -2.3951711e-06f, -6.375758e-07f, -1.80552e-05f, 1.6755968e-05f, 5.7258226e-06f, 1.8797406e-05f, -3.6703227e-06f, -7.3293513e-06f, -4.0861825e-05f, 5.512577e-05f, 3.8630533e-05f, -6.0154725e-05f, 2.20261e-05f, -1.3767957e-06f, -4.02619e-05f, -6.0194194e-05f, 1.6582548e-05f, -8.449815e-06f, 1.5490397e-05f, -1.2192511e-05f, -6.738237e-06f, -1.9735291e-05f, -1.6610013e-05f, 6.777091e-06f, -2.0030697e-05f, 5.7956186e-06f, 1.1821798e-05f, -1.0263757e-05f, 2.1994267e-05f, 9.376625e-06f, -1.7850318e-05f, 9.882805e-06f, 1.8375913e-05f, -2.1272094e-06f, -2.0384819e-06f, -3.9380857e-06f, 1.14198065e-05f, 2.8432658e-05f, -2.999407e-05f, 2.136725e-05f, -2.504056e-05f, 2.0717584e-06f, -2.8234251e-06f, 6.9664966e-06f, 1.0939687e-05f, 3.773918e-06f, 1.3035491e-05f, 1.329666e-06f, 1.0358156e-05f, -4.7853127e-06f, -1.7103526e-06f, -9.2382425e-06f, -8.345068e-07f, -1.0706198e-05f, 8.051101e-06f, -9.563319e-06f, -3.5267032e-05f, -1.7448014e-05f, -7.2697394e-06f, -4.5552766e-05f, -3.2130138e-05f, -4.8774098e-05f, -5.243935e-05f, -4.452803e-05f, -5.9012837e-06f, 1.1042543e-05f, -5.44649e-06f, 2.58089e-05f, -2.6939428e-05f, -1.8365028e-05f, -2.531067e-06f, 8.344068e-06f, 2.295181e-05f, -1.6649707e-05f, -1.33244275e-05f, -1.7239036e-05f, 1.5270225e-05f, -1.0362846e-05f, -8.0868216e-07f, 2.6110032e-05f, -2.8181425e-05f, -1.3881353e-05f, 2.3556973e-05f, 2.4428955e-05f, 2.1043064e-05f, 5.102987e-06f, 2.146754e-05f, -9.239308e-06f, 4.150617e-07f, -2.3526212e-05f, -3.034674e-06f, 3.833963e-06f, -1.0206625e-05f, 2.3822968e-05f, 1.4699263e-05f, -8.059807e-06f, 8.113318e-06f, -2.0394216e-05f, 1.6385857e-05f, -1.6911614e-05f, 1.2550428e-05f, -1.2684886e-05f, 1.5275811e-05f, -1.6270022e-05f, -2.2734022e-05f, 2.2922402e-05f, 6.114845e-06f, -6.342085e-05f, 1.1165533e-06f, -5.7455713e-06f, 1.825471e-05f, 5.8709493e-06f, 1.2579623e-05f, 5.389665e-07f, -9.841932e-06f, -1.0254068e-05f, 9.506542e-06f, 6.9031566e-06f, 6.042505e-07f, 6.04998e-06f, 1.1464586e-05f, -2.8667564e-05f, -2.8040637e-05f, -2.0542825e-06f, 1.9682936e-06f, -3.7216148e-06f, 7.996059e-06f, 1.6522688e-05f, 2.694276e-06f, -1.4407991e-05f, 2.794609e-05f, 9.803462e-06f, 1.899688e-05f, 1.5530393e-05f, 2.0860207e-05f, -1.570565e-05f, 4.883594e-06f, -9.7510665e-06f, -3.6516249e-06f, -1.725789e-05f, -5.533221e-06f, 2.3571221e-05f, -2.360755e-06f, -9.762459e-06f, 3.369916e-07f, -1.2743098e-05f, -4.111097e-06f, 1.5051089e-05f, -1.5701804e-05f, -5.5984738e-06f, 9.1312695e-06f, 5.796055e-06f, 6.4832944e-05f, 1.3181845e-05f, 3.113181e-05f, 4.1103067e-05f, 3.570159e-06f, -7.951939e-06f, -4.4079417e-05f, -5.254607e-05f, -1.8365694e-05f, -1.594638e-05f, 8.711022e-06f, 9.738912e-06f, 2.9003081e-06f, 1.3048463e-05f, -9.015297e-06f, -3.583265e-06f, 1.3645413e-05f, -1.5294907e-05f, -2.8276672e-05f, 5.20146e-06f, 2.1428514e-05f, -8.153103e-06f, -1.2313154e-05f, 2.7252956e-05f, 1.2544252e-05f, 4.2273226e-07f, -1.9672547e-05f, 2.3344533e-05f, 1.6811835e-05f, 2.909855e-05f, -2.667431e-05f, -2.7268306e-05f, 5.6581493e-06f, -1.5875205e-05f, -1.2876364e-05f, -1.3260559e-05f, 1.4425e-05f, 5.9773593e-06f, -1.2677176e-05f, -5.1670565e-07f, 4.1428452e-06f, -1.2978132e-06f, -2.8208197e-07f, -8.753203e-06f, 8.749659e-06f, -2.8601892e-07f, 1.30066755e-05f, 2.2749626e-05f, -1.2546852e-06f, 3.5858582e-05f, -5.601846e-05f, -7.003733e-05f, 2.4204202e-05f, -1.2910254e-05f, -1.7839331e-05f, -3.8574e-05f, -1.4949997e-05f, 1.3719627e-05f, -1.0641427e-06f, 2.4694362e-05f, 1.22841e-05f, 1.5273361e-05f, 4.540721e-07f, 1.6727926e-06f, 2.6931395e-05f, 1.2114217e-06f, -2.5424697e-05f, 1.2064636e-05f, -1.2685189e-05f, 2.8427987e-05f, -3.062187e-05f, 4.1787102e-06f, 1.756052e-05f, -4.3690898e-06f, 3.5582176e-05f, 2.796307e-05f, 2.9777522e-05f, -2.8526925e-05f, -4.176444e-06f, -1.5985433e-05f, 1.0815835e-05f, 2.7704507e-06f, 2.2829465e-06f, -2.1592034e-05f, 2.726227e-06f, 9.675821e-06f, 2.524675e-05f, 4.445529e-06f, 1.4876378e-05f, 1.5192066e-05f, 2.6351768e-06f, 2.4661138e-06f, -6.058992e-06f, 1.2322832e-05f, -1.3520974e-05f, -1.1001858e-05f, -3.8995735e-05f, 2.0144726e-05f, -1.645138e-05f, 1.2386499e-06f, 2.5176414e-05f, -4.018512e-06f, 1.6153455e-05f, 5.8767764e-06f, 2.1842148e-05f, 5.358579e-06f, 1.7631967e-06f, -1.720002e-05f, 2.061713e-05f, -2.606332e-06f, 2.3654185e-05f, -2.0598509e-05f, -5.533493e-06f, -2.4710907e-05f, -1.3902581e-05f, 2.824044e-05f, 4.381433e-06f, -5.575316e-06f, -2.9477755e-05f, 2.7099319e-05f, 3.2826163e-05f, -8.853147e-06f, -2.3939927e-05f, 7.06729e-06f, 3.1893236e-05f, 2.7921562e-05f, -3.1367342e-06f, -1.556063e-05f, -1.0506658e-05f, 1.4325612e-05f, 2.5744137e-07f, -2.0678375e-05f, -9.320655e-06f, -5.028042e-06f, -9.116805e-06f, -6.764792e-07f, 1.26442865e-05f, 4.0515665e-06f, -1.9330477e-05f, -1.628742e-05f, -1.3138636e-05f, -7.865007e-06f, 1.5036212e-05f, 2.1462369e-05f, -6.1055543e-06f, 1.1378611e-05f, 5.766029e-05f, 1.33494805e-05f, 2.827316e-05f, -3.865073e-05f, -6.8217187e-06f, 3.662538e-05f, -2.4475952e-05f, 2.3297593e-05f, 7.4224213e-06f, 9.682414e-07f, -5.3653575e-06f, -1.7489125e-06f, 1.9182486e-05f, 8.30276e-06f, -2.5068017e-05f, 8.377458e-06f, -5.0689414e-06f, 3.9832204e-05f, -1.7405642e-05f, -1.6591906e-05f, -7.10671e-06f, 2.2579445e-06f, 2.8643248e-05f, -1.1458073e-05f, -8.911011e-06f, 1.0399993e-05f, -5.7045423e-08f, -1.9443787e-06f, 1.2070424e-05f, 2.4046096e-05f, -4.19664e-06f, 6.4193737e-06f, 1.2703635e-05f, -4.7870185e-06f, -7.4297627e-06f, 9.605828e-06f, 9.700183e-06f, 1.7004004e-05f, -1.979979e-05f, 1.3122414e-05f, -1.8598461e-06f, -1.5490703e-05f, -1.0389744e-05f, 5.7251027e-06f, 4.082195e-06f, 2.1655693e-05f, -2.2098488e-06f, -2.895235e-05f, 3.7191534e-05f, -8.763328e-06f, 3.2725195e-05f, 4.2431875e-05f, 3.2318207e-05f, -1.8064125e-05f, -3.1244374e-05f, 7.09053e-06f, 2.218021e-05f, 4.6407176e-06f, 2.0808357e-05f, -4.5361057e-06f, 1.33592075e-05f, 3.080878e-05f, 2.1285846e-06f, -3.6472884e-05f, 3.2661712e-05f, -6.803253e-06f, 1.0662472e-05f, -2.133886e-07f, 4.0315203e-06f, -1.9296758e-05f, 1.7702305e-05f, -1.5562391e-05f, 3.593805e-05f, 2.7421795e-05f, 4.856992e-06f, -3.7214481e-06f, -2.2150229e-05f, -3.0646079e-06f, 1.1870547e-05f, -9.380757e-06f, 4.6377048e-07f, -1.6141756e-05f, -5.704296e-06f, -8.491561e-06f, 2.5886384e-05f, 3.4954328e-06f, 5.502546e-06f, -1.685563e-05f, -8.068224e-06f, 1.719954e-05f, -1.9854675e-05f, -1.495216e-05f, 9.101435e-06f, 8.224124e-06f, 4.249393e-05f, 3.71134e-05f, -3.7202215e-05f, -3.982519e-05f, 4.513652e-06f, -4.5481967e-05f, -3.3217624e-05f, -3.8652644e-05f, -6.5229956e-06f, -1.616507e-05f, 2.241364e-05f, -2.1373949e-06f, 2.3220555e-05f, 3.0102015e-05f, 6.116935e-07f, -1.2858579e-05f, -1.6856917e-05f, 8.686265e-06f, -1.40744805e-05f, 2.0751393e-06f, -4.5807346e-06f, 5.2172354e-06f, 3.957358e-05f, -2.0219084e-05f, -5.99793e-06f, -5.9059244e-06f, -4.779423e-06f, -2.0572552e-05f, -6.661152e-06f, 2.5853944e-05f, -2.1346637e-05f, -1.150202e-05f, 1.4409742e-05f, 9.424323e-06f, 1.0440364e-06f, 5.5473306e-06f, -1.4207173e-05f, 2.4334186e-06f, -8.987991e-06f, -1.0073822e-05f, -1.6129608e-05f, -6.934415e-06f, -7.43932e-06f, 1.9167674e-05f, -1.308383e-05f, -3.5971532e-06f, 1.5808371e-05f, 1.5179674e-05f, 3.194953e-05f, -3.2574775e-05f, 8.603811e-07f, -4.68229e-05f, -2.0966578e-05f, 1.5470828e-06f, 3.8491096e-05f, -5.7661564e-06f, 2.5346551e-05f, 2.9269e-05f, -4.1790732e-05f, 1.6759095e-05f, 7.015637e-08f, 3.1023697e-05f, -3.4423916e-05f, 6.851676e-06f, -2.3969991e-05f, -3.9610208e-05f, 6.609671e-06f, 2.8318742e-05f, 1.4984907e-05f, -3.0426105e-05f, 1.3139869e-06f, -3.3113345e-05f, -1.2842549e-05f, -1.0466345e-05f, -1.458416e-05f, -5.206854e-06f, -1.226746e-05f, 3.0489487e-05f, -1.7883316e-05f, 2.2326438e-05f, -1.5729456e-05f, 1.1378194e-05f, -1.697038e-05f, -6.905717e-06f, -1.8814602e-05f, 1.5998274e-05f, 2.3905854e-05f, -1.7930184e-05f, 1.2662691e-05f, 8.177446e-06f, -8.218245e-06f, 1.7750644e-05f, -1.18068065e-05f, -5.8573214e-06f, -1.01720825e-05f, 9.316926e-06f, -4.443974e-05f, -1.16633155e-05f, 2.031235e-05f, 2.029132e-05f, -2.4662631e-05f, 3.475072e-05f, 3.599313e-05f, -1.8933238e-06f, 2.5174302e-06f, -2.8748622e-05f, 4.0028885e-06f, 2.1150233e-06f, 2.167598e-05f, -2.0610785e-05f, 6.994569e-06f, -7.4119257e-06f, 1.9455652e-05f, -2.6422635e-05f, -2.8043967e-05f, 2.6912086e-05f, -9.777179e-06f, 7.684371e-06f, -2.3798653e-05f, 2.7504315e-05f, 2.8331793e-05f, 1.769185e-05f, -2.8079481e-05f, -2.6947368e-06f, 3.3361575e-05f, 1.1993737e-05f, -3.0474144e-05f, -5.8980513e-06f, 1.5209232e-05f, 2.8962177e-06f, -1.8352564e-05f, -7.275522e-07f, -8.399366e-06f, -1.2009933e-05f, 2.3265118e-06f, 2.5578624e-06f, -2.0378846e-05f, 5.6441473e-07f, -2.6993432e-06f, 1.3626506e-05f, -7.1518475e-06f, -6.4207154e-07f, 1.3110966e-05f, 1.790451e-05f, -8.523457e-06f, 2.6493228e-07f, 2.0938982e-05f, -6.008467e-05f, 4.269609e-05f, -4.5354745e-06f, 3.0610307e-05f, -1.0516412e-05f, 1.3830758e-05f, 2.5804666e-05f, -2.9092937e-05f, 2.5991598e-05f, 2.1473019e-05f, -2.7646476e-05f, 1.9874436e-05f, 6.5666554e-06f, 2.4009085e-05f, -2.6078927e-05f, -2.3567369e-05f, -2.5241402e-06f, -2.0613754e-05f, 1.9596346e-05f, 2.4257997e-05f, 9.023384e-06f, -1.4984866e-05f, 3.350828e-05f, 3.3221444e-05f, 7.3941123e-06f, 1.185021e-05f, -1.2799926e-07f, -2.2536158e-05f, -1.7429122e-05f, -1.0228098e-05f, -1.0009575e-05f, 1.5841168e-05f, 8.546096e-06f, -1.0561953e-06f, -1.5408233e-06f, 2.318989e-05f, -1.0666124e-05f, -1.0633895e-06f, -1.73273e-05f, -1.4151551e-05f, 6.864089e-06f, 1.4285466e-06f, 3.4497074e-07f, 1.763226e-05f, 2.1279144e-05f, 2.9779902e-05f, -1.3850451e-05f, 3.4542783e-05f, -5.1375213e-05f, 3.0158784e-05f, 9.84738e-06f, -1.965999e-05f, 4.0941355e-05f, -1.570433e-05f, 1.8241808e-05f, 3.2643908e-05f, 1.2823118e-05f, -4.1722506e-05f, 2.3251541e-05f, -1.7615152e-05f, 3.5487665e-05f, 1.8607192e-05f, 1.4033218e-05f, -1.0684994e-05f, 2.7604094e-05f, 2.8463994e-05f, 4.4754365e-06f, 6.8065774e-06f, -3.540457e-05f, 1.7096238e-05f, 3.3603155e-05f, -1.4137936e-05f, -6.975768e-06f, 2.1015987e-06f, -2.8921411e-05f, -3.5573572e-05f, -8.59748e-06f, -1.2119464e-05f, -1.2289942e-06f, -1.6071612e-06f, 1.305212e-05f, 1.7510634e-05f, -1.0393261e-05f, 2.0908097e-05f, -1.6237997e-05f, -2.683491e-06f, -1.3188073e-05f, -7.883159e-06f, 1.1912533e-05f, -7.066382e-06f, 8.4153235e-06f, 1.2218915e-05f, 1.943552e-05f, 5.52215e-06f, 1.99461e-05f, -1.7424765e-05f, -2.8126144e-05f, 1.4252994e-06f, -1.0454555e-06f, -2.680453e-05f, -4.779153e-06f, -3.415649e-05f, 4.3425825e-05f, -3.636537e-05f, 7.5937705e-06f, -2.5805643e-05f, -3.4011002e-05f, 1.8393623e-05f, 1.1141687e-05f, -3.156306e-05f, -9.0438664e-07f, 1.7945755e-05f, 2.8466322e-05f, -3.2232623e-05f, 1.5505368e-05f, 2.3497449e-05f, 2.1794734e-05f, 4.402687e-06f, 7.2428143e-06f, 3.345084e-05f, 2.5184421e-05f, 6.074858e-06f, -1.2107895e-05f, 1.48390845e-05f, -6.345009e-06f, -1.8471346e-05f, 9.730026e-07f, 1.4452355e-05f, -7.361591e-06f, -1.8507404e-05f, 7.774133e-06f, 2.51864e-05f, 1.2117653e-05f, 1.2581088e-06f, 1.38519645e-05f, 8.116564e-06f, 3.2402234e-06f, -1.1032729e-06f, 5.701592e-06f, 1.6779099e-05f, -1.2178982e-05f, 2.8599088e-05f, -1.5721866e-05f, 1.6147334e-05f, 1.38718215e-05f, 1.5244838e-05f, -2.6094322e-05f, 4.0274485e-06f, -4.8475544e-05f, 2.0772051e-05f, 4.9905302e-05f, 3.0250732e-05f, 2.0071304e-06f, 2.4105914e-06f, -1.8835704e-05f, -4.173964e-06f, -2.5719317e-05f, 8.170951e-06f, -2.5823863e-05f, 2.8415294e-05f, 2.0542177e-05f, -3.3996497e-05f, -2.9423425e-05f, 4.2298212e-05f, -2.1357355e-05f, -8.736753e-06f, -9.78312e-06f, 3.0945477e-05f, 1.557356e-05f, 2.6230696e-06f, 2.8802333e-06f, -2.0645304e-05f, 4.392901e-06f, -5.7820644e-06f, -8.581801e-06f, 6.116912e-06f, -1.0206189e-05f, 1.1026208e-05f, 1.6520184e-07f, 6.403842e-06f, 1.0825068e-05f, -4.7721255e-06f, 1.5968515e-05f, 7.400668e-06f, 1.5035348e-05f, 1.1880413e-05f, -6.553431e-06f, 7.2797884e-06f, 1.0543173e-05f, 1.76133e-05f, 3.417032e-05f, -2.0932757e-05f, -3.2923163e-05f, 5.2519787e-05f, 3.744703e-05f, -1.6285618e-05f, 7.222477e-07f, 2.7430811e-05f, -2.683563e-06f, 1.6518268e-07f, 1.7688093e-05f, -4.8816287e-06f, 2.4394598e-05f, -5.1448722e-05f, -1.4075924e-05f, -1.8334576e-05f, -2.3968046e-06f, 1.48871995e-05f, -1.8817056e-05f, -2.8046563e-05f, 1.4354613e-05f, 2.488821e-05f, 3.022967e-06f, 3.7054564e-05f, 1.0021006e-05f, -2.318917e-05f, 1.7984401e-05f, 9.558138e-06f, 4.932211e-06f, -5.2233536e-06f, 2.6746888e-05f, -1.6805348e-05f, -1.315956e-05f, -1.3143568e-05f, -1.5120306e-05f, 3.5350072e-06f, 7.652054e-06f, -4.151148e-06f, -7.4195077e-07f, -3.5274377e-06f, -2.1411226e-06f, 7.815287e-06f, 2.3951357e-06f, 4.902182e-06f, -1.457294e-05f, 5.580153e-06f, 1.5270436e-05f, -3.178218e-05f, -1.4033805e-05f, 1.0512271e-05f, -4.312781e-05f, 3.6356272e-05f, -3.3358057e-05f, 5.6830344e-05f, -9.238534e-06f, -5.907938e-06f, -2.3883116e-05f, 1.0097641e-06f, 2.4125013e-05f, -3.3318775e-05f, -1.0267657e-05f, 1.9615938e-05f, 4.051969e-06f, -2.6582862e-05f, -3.146509e-05f, 2.2410808e-05f, -6.2381273e-06f, -2.6477857e-05f, 3.6216796e-05f, -3.2273394e-06f, -2.7162187e-05f, 1.5027917e-06f, 5.6322474e-06f, 3.090736e-05f, -2.0103278e-05f, -2.5417903e-05f, -2.9567209e-05f, 1.9562412e-05f, -6.711193e-06f, -1.588265e-05f, 6.9676476e-06f, 1.5419525e-06f, -1.6891634e-05f, 3.825443e-06f, -2.817421e-06f, -3.910487e-06f, -5.0795542e-08f, -1.0386702e-05f, -1.0211124e-05f, 1.061917e-05f, -8.971177e-06f, -1.23206e-05f, -6.728473e-06f, -3.7178454e-06f, -6.797359e-06f, 2.5681824e-05f, -2.739106e-05f, -3.8202932e-05f, -8.147157e-06f, -2.5451563e-05f, -5.8829373e-06f, 5.048443e-05f, -1.887883e-05f, 1.9471025e-05f, 9.060811e-06f, -2.2250266e-05f, 2.2013566e-05f, 3.4166147e-05f, -2.5737094e-05f, 1.17906175e-05f, 7.4956556e-06f, 1.6088134e-05f, -3.4427376e-05f, -1.6649468e-05f, 1.830107e-05f, -3.62477e-05f, 1.8843159e-05f, 3.1890148e-05f, -5.884698e-06f, -3.3865726e-07f, -5.2251994e-06f, -3.3630076e-05f, -1.681645e-05f, 3.6727026e-05f, 2.4265852e-05f, -2.4840157e-05f, 2.9364759e-05f, -7.4910085e-06f, -4.157441e-06f, -1.3142343e-05f, 9.973973e-06f, 1.839328e-05f, -3.3593383e-06f, 1.3876405e-05f, -6.8677195e-06f, -1.7203325e-05f, -3.7572058e-06f, -1.223123e-06f, -1.0218494e-05f, 7.147877e-06f, -2.7404983e-06f, -5.1713732e-06f, 7.0492442e-06f, 2.7234379e-05f, -2.7572585e-05f, 1.917087e-05f, -1.9116462e-05f, 5.6346045e-05f, 3.4548444e-05f, -7.563063e-07f, -5.306937e-05f, 2.1018977e-05f, -1.8053284e-05f, -2.261701e-05f, 4.3493474e-05f, 4.676849e-05f, -1.0649373e-05f, -2.5285934e-05f, -3.5059566e-05f, -9.614052e-06f, 1.3932833e-05f, 8.159553e-06f, 2.523598e-05f, -2.2904185e-05f, 1.8570288e-05f, 3.5140994e-05f, -1.6800579e-05f, 1.7939075e-05f, 3.3782237e-06f, -1.4210579e-05f, 3.8509315e-05f, -7.3453643e-06f, -2.9326002e-05f, -1.6480379e-05f, -6.7578785e-06f, 7.2923267e-06f, 2.0927095e-05f, 1.228153e-05f, 1.1090133e-05f, -1.2416237e-06f, 1.1569694e-05f, -1.1785035e-06f, -1.7153345e-05f, -7.754942e-06f, 7.728909e-06f, -1.1367182e-05f, 1.6752678e-05f, 6.2071294e-06f, -1.3901142e-05f, -1.6859212e-06f, 1.5643192e-05f, -2.7686961e-05f, -2.7318585e-05f, -1.5817208e-05f, 1.7164008e-05f, -3.379331e-05f, -3.3119173e-05f, 2.0856092e-05f, -1.6053496e-05f, 1.8242206e-05f, -1.34102675e-05f, 3.900472e-05f, 2.7977321e-05f, -2.5460113e-05f, 2.9213083e-05f, 2.694055e-05f, 2.6271566e-05f, 7.788645e-06f, -3.156598e-05f, 1.3774626e-07f, -1.22965375e-05f, 2.2679968e-05f, 1.7665574e-05f, 1.5515321e-05f, 8.270911e-06f, 5.0348465e-08f, 1.4046859e-06f, 3.1796324e-05f, -7.0285005e-06f, -2.9286144e-05f, -8.4368085e-06f, 1.2257135e-05f, 7.769601e-06f, 1.5424626e-05f, -1.1234686e-05f, 1.595186e-05f, -1.042332e-05f, -1.331858e-06f, 4.0125255e-07f, -8.535912e-06f, -1.045992e-05f, 6.18459e-06f, -1.6880898e-05f, -1.6657475e-05f, -1.4102476e-05f, 8.741081e-06f, 1.6370644e-06f, -7.67283e-06f, 1.370412e-05f, 4.193698e-05f, 3.0980227e-05f, 4.013269e-05f, -5.970851e-05f, 1.9823761e-05f, -1.5154246e-05f, 1.9443809e-05f, -2.3611592e-05f, -1.77316e-05f, -9.033916e-07f, 6.790401e-06f, 4.312337e-05f, -2.4877076e-05f, -7.673471e-06f, 1.6966027e-05f, 4.3126324e-06f, 1.3128407e-05f, 1.2466544e-06f, 1.0984773e-05f, -1.7807635e-06f, -2.3628552e-05f, 2.3140328e-05f, 1.264348e-05f, -2.5670523e-05f, 2.689247e-05f, 4.4150725e-05f, -1.0964172e-05f, -1.0055997e-05f, -2.6446827e-05f, 1.0951691e-05f, 2.4744275e-05f, -2.9279274e-05f, -2.748975e-06f, -1.14645545e-05f, -1.7633722e-05f, 8.824681e-07f, 1.3735606e-05f, -3.135948e-06f, 2.0592403e-05f, -1.5604624e-05f, -1.2581795e-05f, 1.6191205e-05f, -2.756307e-06f, 7.5422463e-06f, -2.1871381e-05f, -1.667559e-05f, -1.2054008e-05f, 1.897091e-05f, -3.9006583e-05f, 2.2549373e-05f, -1.515446e-05f, 1.6955235e-05f, -1.7793553e-06f, -1.3959785e-05f, -2.610078e-05f, -2.7038897e-05f, 5.3187528e-06f, 2.4026187e-05f, 3.4524076e-06f, 3.9133916e-05f, 1.1250429e-05f, -2.6493588e-05f, -1.4326915e-05f, 6.097473e-06f, -2.1607646e-05f, 3.5830287e-06f, -4.238704e-06f, -3.067029e-05f, 9.9481285e-06f, 8.484746e-06f, -1.5857133e-05f, -6.123551e-06f, -1.09088505e-05f, 3.886833e-05f, -1.5726464e-05f, 3.755383e-05f, 7.752854e-06f, -1.3716245e-05f, 1.433243e-05f, 1.2071722e-05f, -5.402707e-06f, 9.041249e-06f, 1.1003369e-05f, 8.070648e-06f, 1.1782406e-05f, -9.795105e-06f, 1.8851655e-05f, -1.8005214e-05f, -1.40974635e-05f, 6.1564715e-06f, -1.7680457e-05f, 7.379471e-06f, -1.1899351e-05f, -5.4571506e-06f, -2.3739456e-06f, -1.2486292e-05f, -3.9720107e-06f, 3.3325072e-05f, 9.9683875e-06f, -3.142453e-05f, 5.5315348e-05f, -2.0972022e-06f, 3.2174743e-05f, 7.312287e-06f, 3.64557e-05f, 2.8223832e-05f, -1.668008e-05f, -2.127884e-05f, 2.810744e-05f, 3.245698e-05f, -8.523833e-06f, 5.860649e-06f, -3.075015e-05f, -2.389263e-05f, -2.468847e-05f, 1.7379624e-06f, -2.3552178e-05f, -2.0075671e-05f, -2.9520402e-06f, 5.043516e-06f, 1.0790959e-05f, -1.7098881e-06f, 2.5197756e-05f, -1.1903989e-05f, -1.3369553e-05f, 4.2251395e-06f, -1.05587005e-05f, -6.2619233e-06f, -1.5296644e-05f, 4.3390446e-06f, -8.992592e-06f, -9.660495e-06f, 8.630632e-06f, 1.9896897e-05f, 1.6836091e-05f, -4.7809426e-06f, 9.337884e-07f, 1.1375417e-05f, -6.3240736e-06f, -1.9667177e-06f, -1.87363e-05f, 6.2870167e-06f, 1.774392e-05f, -3.178528e-06f, 2.3137101e-05f, -7.9996465e-07f, 2.6620504e-05f, -2.0814185e-05f, 3.5363115e-05f, -1.9243973e-07f, -2.6690659e-05f, -5.797551e-07f, 3.6131685e-06f, -1.4623658e-05f, 2.9872104e-05f, -2.00468e-06f, -2.0886628e-05f, -1.6525439e-06f, -1.2293645e-05f, 1.5940395e-05f, 1.1239763e-05f, -2.4382069e-05f, 1.4787587e-05f, -1.9118308e-05f, -1.5061088e-05f, -1.8318033e-05f, -1.681178e-05f, 4.296534e-06f, 3.724992e-05f, 1.0580124e-05f, 2.641688e-05f, 2.7079737e-05f, 1.7275175e-05f, 3.6494224e-05f, 1.39161875e-05f, -1.9007775e-05f, 9.315319e-06f, 1.172093e-05f, -3.5450182e-06f, -2.195899e-05f, -1.14739805e-05f, 1.4515722e-05f, -3.4768336e-06f, 1.8093171e-05f, 5.020222e-06f, 1.369474e-06f, -2.0912664e-07f, 7.70477e-06f, 1.3614519e-05f, -1.6103342e-05f, -4.1665676e-06f, 1.2160093e-05f, -2.9691542e-05f, 2.4499723e-05f, -1.5803838e-05f, -4.317313e-05f, -3.231618e-05f, 1.7926923e-05f, 4.450688e-05f, -2.7227108e-05f, 2.9932426e-05f, 1.4740201e-05f, -1.9715066e-05f, 8.743657e-06f, 1.0671118e-05f, -1.1917652e-05f, -1.679425e-05f, -8.207819e-06f, -3.0834373e-05f, -2.6786887e-05f, -2.3155173e-05f, -1.2225834e-05f, 7.724986e-06f, 2.4898814e-05f, -1.0521199e-05f, 8.0992095e-06f, 1.8439963e-05f, 4.138787e-05f, 3.730713e-05f, -2.421516e-05f, -2.7448867e-05f, 2.373868e-05f, -3.5173056e-05f, -2.514872e-05f, 1.3095763e-05f, 2.1433269e-05f, -6.6984e-06f, 7.7760815e-06f, 1.3647565e-05f, 7.0518668e-06f, 8.910122e-06f, 1.6667942e-06f, -1.0398414e-05f, 7.372928e-06f, -1.3100135e-05f, -9.558994e-06f, -8.307491e-06f, 5.3205436e-06f, 9.651727e-06f, 2.2562983e-05f, 9.576897e-06f, -4.6280496e-05f, -3.4124678e-05f, -5.2075236e-05f, -1.8465951e-05f, 1.8187679e-05f, 4.5922858e-05f, 3.3001787e-05f, 1.4777092e-07f, 2.5520876e-06f, 2.1686667e-05f, -6.142354e-06f, 1.1408078e-05f, -1.27061385e-05f, -8.1560365e-06f, -2.2982025e-05f, -7.1991476e-06f, -1.2299805e-05f, -7.352492e-06f, -1.994093e-05f, -2.6234176e-05f, -5.3245635e-06f, -6.024338e-06f, 6.910515e-06f, 2.2408272e-05f, 1.801184e-05f, -3.0698306e-05f, 9.8728915e-06f, -2.7983488e-05f, -3.659497e-05f, -2.073492e-05f, -2.1567072e-05f, 1.9946492e-06f, 2.1158317e-05f, 9.031372e-06f, 4.869604e-06f, 1.7370694e-05f, 8.158565e-06f, 9.424658e-06f, 2.6829491e-06f, 1.2530403e-05f, -1.530676e-06f, 9.280554e-06f, 9.407105e-06f, -1.2864261e-05f, -2.2664308e-05f, -6.918811e-06f, 1.22216925e-05f, 3.1893771e-06f, -3.3050957e-05f, -7.800454e-06f, 3.1403024e-06f, -2.4687615e-05f, 1.9399304e-06f, 4.730329e-06f, -1.2999939e-06f, 6.2909357e-06f, -7.5693324e-06f, 1.8113424e-05f, -1.8457393e-05f, -1.7717148e-05f, 4.3098038e-07f, 1.3542072e-05f, -1.6410682e-05f, -2.2642367e-05f, 1.7432172e-05f, -2.0582751e-05f, -1.281548e-05f, 6.3214093e-06f, -5.938874e-06f, -6.3725784e-06f, -1.1557327e-05f, 2.8570614e-05f, 4.4415952e-05f, -3.6960006e-05f, -2.2050126e-05f, 4.143205e-05f, 8.826798e-06f, -5.229966e-06f, 2.411504e-05f, -1.9795672e-05f, -1.4785486e-05f, 1.8896872e-05f, 7.310058e-06f, 9.545133e-06f, -1.0728163e-05f, 5.5072896e-06f, 1.5923993e-05f, 1.5834985e-05f, -1.6971648e-05f, 7.961025e-06f, -1.7334318e-05f, 1.5055564e-05f, -6.3856905e-06f, 2.4576682e-05f, -1.3045316e-06f, -2.5030806e-05f, -2.9039544e-05f, 2.1126287e-05f, -4.25772e-05f, 4.79797e-05f, 1.7462622e-05f, 5.957707e-05f, 4.273827e-05f, -1.0222807e-05f, 2.0761454e-05f, -1.723022e-05f, -1.961134e-05f, 2.6727897e-05f, 2.6385254e-05f, -2.317638e-05f, -7.615672e-06f, -4.8030793e-06f, 1.4510606e-05f, 4.7268527e-06f, 8.538718e-06f, -6.842208e-06f, 1.4749449e-05f, 2.0684694e-05f, 6.77775e-06f, -3.469239e-05f, -2.0716163e-05f, -1.0740683e-05f, -3.101e-05f, -4.7970525e-06f, -7.203967e-06f, 2.4740644e-05f, 4.924723e-06f, 6.6791777e-06f, 1.9869922e-05f, -1.8447138e-06f, -2.5532825e-05f, -8.6722775e-06f, 1.533904e-05f, 2.2473387e-05f, -7.2683165e-06f, -1.0638572e-05f, 2.1738857e-05f, -8.474961e-06f, 9.485996e-06f, -1.4448233e-05f, -1.9987505e-05f, 5.040255e-06f, 2.2190337e-05f, 7.4701593e-06f, -3.949708e-05f, 1.6216092e-05f, 1.3847518e-05f, -5.8919495e-06f, 1.42779845e-05f, 3.1284442e-05f, -3.9580755e-05f, 2.5935457e-05f, -3.5205687e-06f, 2.6309857e-05f, -1.1529101e-05f, 4.3843224e-06f, -1.1340054e-05f, -2.8479628e-05f, -1.6654607e-05f, -9.135128e-06f, -6.3469047e-06f, 1.8376164e-05f, 9.809639e-07f, -9.395967e-06f, 3.201555e-05f, 1.4022383e-05f, -1.4998104e-05f, 2.1876021e-05f, 1.1694172e-05f, 3.1694413e-05f, 3.762046e-05f, -6.4595342e-06f, 7.15303e-06f, -2.897307e-05f, 1.0278354e-05f, 1.8327923e-05f, 1.7873463e-05f, -4.8844827e-06f, -2.2024224e-05f, 1.8706605e-05f, -1.6149588e-06f, -1.7422641e-06f, -8.7482995e-06f, -2.0268826e-06f, 2.389753e-05f, 1.9397798e-05f, -5.9290887e-06f, -1.16863675e-05f, -2.4401854e-06f, -1.6245329e-05f, -9.707827e-06f, 4.0411556e-05f, -5.7519963e-05f, -4.3001593e-05f, -2.1411282e-05f, 3.5837827e-05f, -1.537966e-05f, -6.516901e-06f, -2.5535643e-05f, 2.0881453e-05f, -1.3506098e-05f, 6.8811055e-06f, 2.4451727e-05f, 1.4948678e-05f, -3.4237967e-06f, 5.900595e-06f, 1.5571206e-05f, -1.0045765e-05f, 9.959674e-06f, -2.3101646e-05f, 1.4049261e-05f, -2.6450234e-05f, -2.5212418e-07f, 1.0102134e-05f, -1.767662e-05f, 1.8822022e-05f, 1.6910806e-05f, 1.794864e-05f, -7.5413345e-06f, 8.122027e-06f, 2.8476516e-05f, 1.67029e-05f, 1.8111388e-05f, 3.361e-07f, 1.1612806e-05f, -1.6256947e-05f, -7.0135857e-06f, 1.4709785e-05f, 7.1546824e-06f, 2.454898e-05f, -1.1014523e-05f, -1.8963017e-05f, 1.00714315e-05f, -1.895147e-05f, 1.5162331e-05f, -1.6107006e-05f, -1.176292e-06f, 1.8781144e-05f, 1.7153832e-05f, -3.8787134e-06f, 4.079978e-05f, -2.7710294e-06f, -3.642934e-05f, -8.0656655e-06f, 3.3047552e-05f, 6.9241946e-06f, -1.4180018e-05f, -1.6169344e-05f, -9.875934e-06f, 1.935975e-05f, 1.5125489e-05f, 1.51912e-05f, -1.671715e-05f, -2.5800688e-05f, -1.2337508e-05f, -4.3862506e-06f, 2.156678e-05f, -7.1161494e-06f, -1.6686517e-05f, -2.2766346e-06f, 2.6591173e-05f, 1.9781643e-05f, 1.2285928e-05f, -2.1074811e-05f, -1.9747446e-05f, 2.66734e-06f, 2.201827e-05f, 4.312569e-05f, -9.157215e-06f, -2.289608e-05f, 1.5125795e-06f, 6.284738e-06f, 7.349955e-06f, 9.678232e-06f, -1.08380345e-05f, 1.5114597e-05f, -1.0223025e-05f, -8.372216e-07f, 9.880413e-06f, -7.954538e-06f, 1.2410556e-05f, -9.530356e-06f, -1.1576766e-05f, -1.4467842e-05f, 1.4677424e-05f, 3.2744383e-06f, -7.825392e-06f, -2.1533491e-05f, -5.9168542e-05f, 2.4221406e-05f, -4.2760563e-05f, 2.2774515e-05f, -4.2316544e-05f, 4.8697897e-05f, -3.873107e-05f, -1.6408638e-05f, -9.920777e-06f, 2.135637e-05f, -7.766733e-06f, 4.6693267e-06f, -3.468057e-07f, -1.4028061e-05f, 1.3586083e-05f, 1.1566464e-05f, 1.5084699e-05f, 5.6674196e-08f, 9.764471e-06f, -7.789498e-06f, 3.7823866e-06f, 7.4437858e-06f, -1.8309955e-05f, 4.3771197e-05f, -8.336066e-06f, -2.8618013e-05f, -1.7334292e-05f, 3.1157404e-05f, 2.5138681e-05f, -1.6014392e-05f, -4.245926e-05f, 1.8510129e-05f, -1.0562007e-05f, 1.51547665e-05f, 5.693574e-06f, 1.8620356e-05f, 1.4137198e-05f, -2.06442e-07f, -1.2453869e-05f, -5.4385823e-06f, -8.460094e-06f, 1.1083954e-05f, 1.7228524e-05f, 1.1004099e-06f, -1.6771097e-05f, -1.6222046e-05f, 8.309618e-06f, -5.937047e-06f, -3.7178e-05f, -1.6813141e-05f, -9.764407e-06f, 2.6667105e-05f, 4.7556437e-06f, 6.33512e-05f, -5.4082844e-05f, 1.0613624e-05f, 1.5113008e-05f, -6.97741e-06f, -9.510559e-06f, 1.5200956e-05f, 2.8723468e-06f, 1.4765758e-05f, -4.612106e-07f, 1.8178345e-05f, -2.0429079e-05f, -1.767955e-05f, 2.6717514e-06f, -9.648837e-06f, 2.1223528e-05f, 4.2270726e-06f, 4.8963993e-06f, 1.2587082e-05f, -2.0803469e-05f, 1.609774e-05f, 2.3930143e-05f, -3.202931e-05f, 5.899451e-06f, -2.4146162e-05f, -3.411406e-06f, -4.4999624e-06f, -1.1869266e-05f, -1.3839167e-05f, -2.3531868e-05f, -1.2363651e-05f, 1.7632774e-05f, -1.3157213e-05f, -4.1485887e-06f, 1.5000625e-05f, -1.3185599e-05f, -1.0684869e-05f, 1.2580512e-05f, 1.1506494e-06f, 1.4705347e-06f, -1.0398262e-05f, 1.8409923e-05f, -4.0232706e-05f, -4.3199856e-05f, 2.9172688e-05f, -2.8683171e-05f, -7.784191e-06f, -1.7097576e-05f, -6.711188e-06f, -2.2963583e-05f, 1.2133656e-05f, -1.2285504e-05f, -3.3283259e-06f, 1.3750559e-05f, 2.1274944e-05f, 7.993489e-06f, -2.1519256e-05f, -2.4040876e-06f, 4.18671e-06f, -5.28386e-06f, 1.4370274e-05f, 7.0519236e-06f, -1.9569502e-06f, -1.1926805e-05f, 1.6774973e-05f, 1.3350192e-05f, -1.5717e-05f, 5.456559e-05f, 1.9817244e-05f, -1.208195e-05f, 1.14441755e-05f, -1.8859222e-05f, -4.5269833e-05f, 2.9267012e-05f, 5.842498e-06f, 9.764594e-06f, -1.4727968e-05f, -1.1478638e-05f, 1.6954564e-05f, -1.1641007e-05f, -1.2381481e-05f, -1.4413364e-05f, -9.970595e-06f, 1.9062323e-05f, 9.721116e-06f, -2.1000998e-05f, -2.8550561e-05f, 3.73174e-06f, 1.10102455e-05f, -1.2898645e-05f, 1.1552937e-05f, -3.0584204e-05f, -2.0940979e-05f, -2.4734944e-05f, -2.9752231e-05f, 5.748072e-05f, 6.314233e-05f, -1.16116125e-05f, -5.780379e-06f, 1.716946e-05f, 1.6829606e-05f, 1.1951928e-05f, 2.8449513e-06f, -2.9883944e-07f, 6.042533e-06f, -3.3084616e-06f, 5.923538e-06f, 6.819269e-06f, 8.801036e-06f, -2.4870016e-05f, -1.0944632e-05f, -1.0891847e-05f, -4.4809694e-06f, -1.8896935e-05f, 7.1280692e-06f, -3.0216566e-05f, 3.6484045e-05f, 8.006009e-06f, -4.098788e-05f, 1.3015243e-05f, -2.9858176e-05f, -3.589738e-05f, 1.3112022e-05f, -8.200665e-06f, -1.6603264e-05f, -2.5669826e-05f, 1.1011043e-05f, 9.575345e-06f, -1.4338544e-05f, -1.3209916e-05f, 1.2275856e-05f, -1.0614836e-05f, 7.319899e-06f, -1.2150428e-05f, -8.315407e-06f, 2.1119115e-05f, -4.88329e-06f, 1.3660358e-05f, -7.0119117e-06f, -4.5661916e-05f, -1.886666e-05f, 2.3281107e-05f, 6.540175e-05f, 4.498938e-05f, -2.9200568e-05f, -2.4046896e-05f, 1.787931e-05f, 7.961226e-07f, 1.521338e-05f, 1.4555623e-05f, -1.3275636e-05f, -3.162676e-06f, -6.2366403e-06f, 1.4236717e-05f, 1.6837203e-05f, 6.142527e-07f, -1.9131565e-05f, -1.0511809e-05f, -3.5065107e-06f, 2.236366e-05f, -1.9774666e-06f, -1.3695519e-05f, 1.838565e-05f, 1.3921467e-05f, -3.415329e-05f, -2.5664927e-05f, -3.6538468e-06f, 1.9631405e-05f, 1.6928145e-05f, 4.273332e-05f, -6.5570466e-06f, 2.8453462e-07f, -2.1472968e-05f, 8.184844e-06f, 7.797412e-06f, 1.4828011e-05f, 5.9246727e-06f, 1.7756123e-05f, -1.948856e-05f, -1.2285299e-05f, -2.0020075e-06f, -1.8647519e-05f, -2.5770254e-05f, 7.5011803e-06f, -9.389049e-06f, 1.0914435e-05f, 4.9650123e-05f, 3.871548e-05f, -3.22508e-05f, -6.2305226e-05f, 6.339304e-05f, 6.258409e-05f, -6.9976413e-06f, -1.1309732e-05f, -1.05234085e-05f, 7.509282e-06f, 5.6373153e-07f, 1.6020475e-05f, 7.697613e-06f, -1.5742073e-05f, -1.22097745e-05f, 8.688605e-06f, 7.51494e-06f, 1.0226835e-05f, 6.84161e-06f, -1.5335105e-06f, 1.2985498e-06f, 9.201287e-06f, 8.676094e-06f, 6.445533e-06f, -5.254641e-06f, 1.1189895e-05f, -1.6118707e-05f, -1.9473515e-05f, -2.0139882e-05f, -4.7034417e-05f, -2.394782e-05f, -1.0998717e-05f, -1.9870027e-05f, -7.4526592e-06f, -1.06611415e-05f, -1.8983008e-05f, -5.2631995e-06f, -1.3241584e-05f, 1.7879485e-05f, -7.865567e-06f, -1.4640292e-05f, 1.0933436e-05f, -1.13483375e-05f, -2.030923e-05f, -2.2310975e-05f, 4.535928e-07f, 1.3272456e-05f, 1.1700213e-05f, -5.715322e-05f, 3.7878144e-05f, -2.3072102e-05f, 5.381384e-06f, -4.3658718e-05f, -6.6321e-06f, -5.0587256e-05f, 3.0248068e-05f, -8.881154e-06f, 6.303709e-06f, -5.5988726e-06f, -1.1782696e-05f, 2.2749611e-05f, 7.3488263e-06f, 1.1292078e-05f, -1.2427696e-05f, 1.3835253e-05f, 2.385734e-05f, -5.3554186e-06f, 1.15241955e-05f, -1.2056804e-05f, -4.0705413e-06f, 2.8822398e-05f, 1.4856363e-05f, -1.8480774e-05f, 4.43331e-05f, -2.206115e-05f, 5.137392e-05f, 2.7230139e-05f, 3.052914e-05f, -8.0676085e-07f, -2.0260813e-05f, -1.5576883e-05f, 7.182522e-06f, 8.699832e-06f, 4.451739e-06f, -1.3477125e-05f, 4.58439e-06f, 4.587192e-06f, -1.4005859e-05f, 6.55113e-06f, -4.334054e-06f, 5.9666972e-06f, -1.3718998e-05f, 1.3356787e-05f, -3.5900525e-06f, 8.88103e-06f, -1.3504853e-05f, 1.6811266e-05f, -2.2028868e-05f, 5.04832e-05f, -2.867783e-05f, 2.2795151e-05f, -2.8306134e-05f, 4.7545775e-05f, 2.9526043e-05f, -6.462834e-06f, 1.6746697e-05f, -1.5927119e-05f, 1.4695588e-05f, 2.8110367e-06f, 1.7709574e-05f, -6.5788977e-06f, -2.29653e-05f, -1.2213704e-05f, 2.5963938e-05f, -7.836019e-06f, -2.0832455e-05f, 8.970306e-06f, -1.6247232e-05f, -1.1714653e-05f, -1.36621275e-05f, -3.5621415e-05f, 5.8963826e-05f, 9.566844e-06f, 9.600173e-06f, 2.2404107e-05f, 8.35172e-06f, -3.7117985e-05f, -2.7545584e-05f, 1.5794156e-05f, -1.6977018e-06f, -1.6953084e-06f, -1.210938e-05f, -1.9161316e-05f, 1.2713496e-05f, 9.6455215e-06f, 8.228337e-06f, -6.105372e-06f, 2.0750397e-06f, -1.0669525e-05f, -3.2186597e-06f, 1.3575417e-06f, 2.5956806e-05f, 1.1029995e-05f, 6.1147157e-06f, -8.877533e-06f, -4.138722e-05f, -7.3468177e-06f, -5.8574347e-05f, 1.8693207e-05f, 3.389195e-05f, 5.753457e-05f, -3.179884e-05f, 6.325854e-08f, -1.4485768e-05f, 2.02215e-05f, 1.7598788e-05f, 1.6654069e-05f, -1.598077e-05f, -2.4311853e-06f, -1.588643e-05f, -1.643556e-05f, 1.6656606e-05f, -1.2856728e-05f, -6.0771404e-06f, -2.9874438e-06f, -9.007443e-06f, 6.622128e-06f, -2.3928766e-05f, -4.158861e-05f, 4.8614613e-05f, -1.6228825e-05f, 4.5930108e-05f, -6.732963e-06f, -1.30058315e-05f, -2.551144e-05f, -4.0869072e-05f, -1.1153639e-05f, 1.1505034e-05f, 1.3701434e-05f, -5.1219004e-06f, 1.5104061e-05f, -1.3653483e-05f, 1.201356e-05f, 1.8910385e-05f, -8.936493e-06f, -7.2698645e-06f, 1.6611146e-05f, 1.5920508e-05f, -1.8574008e-05f, -4.0768114e-06f, 9.05568e-06f, -9.396423e-08f, 1.6855312e-05f, 7.914094e-06f, 2.9317474e-05f, 2.6549715e-05f, 5.2888463e-05f, 1.9745874e-05f, 1.5534093e-05f, -1.3286508e-05f, -1.6153921e-05f, -9.360946e-06f, -1.545982e-05f, 7.841537e-07f, 2.0142837e-05f, 7.478667e-06f, 3.0445697e-06f, -1.8114748e-05f, -1.0113463e-05f, -9.162047e-06f, 1.3978376e-05f, -1.5334355e-05f, -1.3392024e-06f, -1.206259e-05f, -8.994488e-06f, -1.1204405e-05f, -1.1448428e-05f, -2.6670195e-06f, 7.4836476e-07f, -8.702386e-06f, 1.8141847e-05f, -4.486943e-05f, -2.249798e-05f, 1.3408477e-05f, 3.1490729e-06f, -1.2786339e-05f, -2.1150715e-06f, -1.6908933e-05f, 9.447472e-06f, -1.5447513e-05f, 1.6742672e-05f, -1.2470774e-06f, -6.0631314e-06f, 1.8217776e-05f, -1.0976573e-05f, -1.670137e-05f, -3.0225285e-05f, 2.204526e-05f, 1.7476875e-06f, 5.7379916e-06f, -4.807679e-05f, -4.0680705e-05f, -2.6517406e-05f, -1.5086923e-05f, 3.1845655e-05f, 5.930023e-06f, 4.3088447e-05f, -2.2853228e-05f, -1.6382142e-05f, -3.7882696e-06f, -1.4868672e-05f, -4.33848e-06f, 2.6483372e-05f, 1.906663e-05f, -1.6183798e-05f, -9.973707e-06f, -2.9076953e-06f, 1.6100821e-05f, -1.9983507e-05f, -2.5344056e-05f, -1.9866373e-05f, 8.336292e-06f, 3.225178e-06f, 9.883257e-06f, -1.6192937e-05f, 1.2323718e-05f, 1.0615522e-05f, 1.3094425e-05f, -2.4754821e-05f, -3.943295e-05f, -1.8507434e-06f, -3.6518326e-05f, 2.0538622e-05f, 8.578319e-06f, -1.5849535e-05f, 3.9001843e-06f, -1.739083e-05f, 1.7355624e-05f, 6.190222e-06f, -1.8094193e-05f, -1.7901411e-05f, 3.0527706e-05f, -6.751987e-06f, 2.3047087e-05f, -6.236238e-06f, 4.3167574e-06f, -1.877557e-05f, 2.7448545e-05f, 3.1599237e-05f, 1.3111683e-05f, -5.5262037e-05f, -6.016275e-05f, -4.1061453e-06f, -1.1707331e-05f, 7.929836e-06f, -6.1540704e-05f, -1.6097305e-05f, -1.9772554e-07f, -1.7786238e-05f, -1.6216893e-05f, -5.9453555e-07f, -1.6677799e-05f, -9.3431545e-06f, -1.6109761e-05f, -1.3035731e-05f, 1.0818793e-06f, -1.6279268e-05f, -1.2309293e-05f, -6.445243e-06f, 1.6662454e-05f, 2.4848121e-05f, -1.270173e-05f, -1.5621123e-05f, 1.9832558e-05f, -4.3851483e-05f, -5.2152373e-06f, -5.070115e-05f, -1.830757e-05f, -4.2277316e-05f, 2.7491249e-06f, 5.1095913e-06f, 3.2162934e-05f, -1.5238305e-05f, -2.3427061e-05f, 2.743568e-05f, 2.2923829e-05f, 1.4864584e-05f, 1.9589146e-05f, -9.319486e-06f, 2.474756e-05f, 2.3126604e-05f, -1.2242344e-05f, -5.9885924e-06f, 2.5881416e-05f, 1.0176743e-05f, 1.3083839e-05f, 9.030409e-06f, -1.9262217e-05f, 5.8511272e-05f, -2.5195597e-05f, -2.136652e-05f, 3.726158e-05f, 1.4545766e-05f, -2.749237e-05f, -4.51067e-06f, -1.3878353e-05f, -1.6022763e-05f, 9.253224e-06f, 5.3018557e-06f, -9.401656e-06f, -2.4058198e-05f, -2.6308402e-05f, 9.952278e-06f, -7.927118e-06f, -1.0095972e-05f, -2.6311542e-05f, -1.8207538e-05f, 1.8451441e-05f, -4.012927e-06f, 1.4255114e-05f, -2.8352904e-05f, -1.0470603e-05f, 2.677308e-05f, 2.321094e-06f, -3.1108586e-05f, 1.2070676e-05f, -4.906546e-05f, 3.472653e-05f, 1.6140082e-05f, -1.6706063e-05f, 1.7675164e-05f, 1.7496712e-05f, 3.401458e-06f, 7.3443985e-06f, 1.885724e-05f, -1.1177929e-05f, 1.3161146e-05f, 4.600258e-06f, -2.0443295e-07f, 2.1204756e-05f, 8.755771e-06f, 2.6487232e-05f, 1.789124e-05f, -1.8473047e-05f, 1.7134022e-05f, 3.990148e-05f, 1.6951628e-05f, -5.019812e-05f, -6.3123885e-06f, -5.6460576e-05f, -5.5771914e-05f, 1.4875932e-06f, 7.5858975e-06f, -1.4918749e-05f, 1.4162356e-07f, 2.1884157e-06f, -1.711357e-05f, -1.5228765e-05f, 2.070129e-06f, 1.7868362e-05f, 6.2166e-06f, -1.0747097e-05f, 1.3115326e-05f, -8.884426e-06f, -2.0862037e-05f, 6.947014e-06f, -4.613217e-06f, -8.140995e-06f, -1.3204227e-05f, 2.8415723e-05f, -1.6378184e-05f, -2.9984472e-05f, -3.73821e-05f, -6.953031e-06f, 2.4376879e-05f, -5.3445823e-05f, 3.3788797e-06f, -1.5644404e-05f, 7.212775e-06f, 1.1014375e-05f, -1.1381444e-05f, 3.4849922e-06f, 2.4888024e-05f, -1.6468506e-05f, -1.24927465e-05f, 2.7063417e-05f, 1.4870742e-05f, 1.2982627e-05f, 1.1299286e-05f, 6.30518e-06f, -5.1377094e-07f, 8.012674e-06f, 3.351493e-05f, -3.873319e-07f, -6.325731e-05f, -7.119618e-05f, 7.170214e-05f, -5.611739e-05f, 3.0631378e-05f, 5.536488e-05f, -1.4063744e-05f, 8.114768e-06f, -7.326413e-06f, -8.71879e-06f, 2.127133e-05f, 1.829282e-05f, -1.0201035e-05f, 1.4928175e-06f, -1.3683637e-05f, 1.7198343e-05f, 1.5731479e-05f, -1.3614407e-05f, 3.092175e-06f, 1.853306e-05f, -1.3528976e-05f, 1.0692255e-05f, 1.4290033e-05f, 5.5631162e-06f, -7.1593568e-06f, 4.3800414e-05f, 1.3739875e-05f, -7.007607e-06f, -5.7013076e-06f, 3.6629583e-05f, -1.9311452e-05f, -1.7454282e-05f, 1.1986315e-05f, 3.4459085e-06f, 8.613723e-06f, -1.0183609e-05f, -2.647499e-06f, 9.523156e-06f, -6.300996e-06f, 6.030969e-06f, -4.128174e-06f, 1.3316345e-06f, -2.1213908e-05f, -1.1756782e-05f, 1.2014743e-05f, -9.336994e-07f, -3.590261e-05f, 6.921069e-05f, -2.0224115e-05f, -7.6965334e-05f, 3.588257e-05f, -2.426582e-05f, 1.1247906e-05f, 9.672338e-06f, 2.2703733e-05f, -1.7121269e-05f, -9.278245e-06f, 2.2903025e-05f, 1.5256983e-05f, -3.674303e-06f, 7.999824e-06f, -8.571603e-06f, -4.0161344e-06f, -9.32442e-06f, 8.0896604e-07f, -1.5990056e-05f, 2.533874e-06f, -1.4326758e-06f, 2.156694e-05f, 7.3676256e-06f, -3.0016226e-05f, 2.4659235e-05f, 1.33148915e-05f, 1.2111085e-05f, -5.0964172e-05f, -6.9114158e-06f, -1.13373635e-05f, -2.4101897e-05f, 1.3355965e-06f, -4.012081e-06f, -1.4860884e-05f, 5.688813e-06f, -1.2776096e-05f, 2.3038183e-05f, 3.9416438e-05f, -5.892063e-07f, 2.3028138e-05f, -1.1907932e-05f, 2.116282e-05f, 2.612684e-05f, -6.0473835e-06f, -8.905122e-06f, -1.9592588e-05f, 2.7988586e-05f, -2.2048527e-05f, 1.7376475e-05f, -1.5821426e-05f, -3.102114e-05f, 4.6465702e-05f, 7.5200325e-05f, 2.3847655e-05f, 6.017791e-05f, -1.4214404e-05f, -7.821774e-07f, 8.032852e-06f, 1.2747327e-05f, 1.7155771e-05f, -9.577193e-06f, 1.5321228e-05f, -2.1680113e-05f, -9.707035e-06f, 3.3072463e-06f, 3.8388134e-06f, -1.4672143e-05f, 1.4364606e-05f, 8.1515435e-07f, -1.006544e-05f, 9.782277e-06f, 5.9171285e-05f, -1.4457352e-06f, -3.4306518e-06f, 2.0077876e-05f, 2.278428e-05f, -4.55669e-05f, 3.3613207e-05f, 1.7916731e-05f, -3.4114535e-05f, 1.1359192e-05f, -2.8757515e-05f, -9.476584e-06f, 1.17670315e-05f, 1.3082945e-05f, 3.759673e-05f, -9.542072e-06f, 2.5495669e-05f, 3.678047e-06f, 1.4426243e-05f, 1.82395e-05f, 5.3844014e-06f, 2.1115604e-05f, 5.854954e-06f, 2.2222686e-05f, 7.064046e-05f, 8.334401e-05f, -3.2838674e-05f, 5.244025e-05f, -6.2972285e-05f, 2.7884289e-05f, 5.271973e-06f, -5.328027e-05f, 6.8685824e-07f, -2.4510658e-05f, 9.681542e-07f, 1.8996368e-05f, -1.1293728e-05f, -1.0363251e-05f, 4.1307444e-06f, -1.1239902e-05f, -4.139367e-06f, -2.254317e-06f, -7.015227e-07f, -1.1408784e-05f, -1.760167e-05f, -9.830039e-06f, -1.09965495e-05f, -4.7264507e-06f, 4.766727e-05f, -3.039496e-05f, 8.606828e-06f, 2.3797759e-06f, 3.1110772e-05f, -2.2901997e-05f, 1.855929e-05f, -1.8817826e-05f, -1.7333473e-06f, 2.5720157e-05f, 3.3214325e-05f, -3.4116976e-05f, 7.737398e-06f, -2.0030955e-05f, -2.1104204e-05f, 2.066065e-05f, 3.427852e-05f, 1.2046584e-05f, -1.946856e-05f, -2.4230016e-05f, -1.8112876e-05f, -2.1936162e-06f, -3.117143e-05f, 2.525593e-05f, 2.9668195e-06f, 0.00010122703f, 5.656752e-05f, -2.2541963e-05f, 2.8166862e-05f, -1.9815454e-05f, -1.9627278e-05f, -7.447108e-05f, 4.249e-07f, -2.4354036e-05f, -4.8664806e-06f, -6.103793e-06f, 1.9043844e-05f, -8.054289e-06f, 1.7166949e-05f, -1.925171e-05f, 1.758519e-05f, 8.5041565e-06f, -1.6074935e-05f, -5.9775625e-06f, -1.2237025e-05f, 1.3607294e-05f, 1.3281233e-05f, -2.1724294e-05f, -4.7342814e-07f, 6.1975996e-05f, -2.0024476e-05f, 4.0515886e-05f, -5.6925306e-05f, 3.550357e-05f, -2.9178993e-06f, 4.399399e-05f, -2.3460016e-06f, 2.6364589e-05f, 3.5076195e-05f, 6.0583016e-06f, 1.1635209e-05f, -4.393511e-06f, -2.1345197e-05f, -2.040461e-07f, 1.3956637e-06f, 2.5970492e-05f, -1.3125771e-05f, 1.5613276e-05f, -3.5197514e-05f, 2.7840166e-05f, 6.4437836e-06f, 9.78283e-07f, -2.8389462e-05f, -3.0573527e-05f, 9.0858075e-06f, -3.8522237e-05f, 4.9967308e-05f, 7.9094614e-05f, -2.0898957e-05f, 9.246685e-06f, -5.8402807e-06f, -2.647951e-05f, 1.8221939e-06f, -4.3508903e-06f, -1.7209426e-05f, -4.048876e-06f, -2.0304547e-05f, 1.2104086e-06f, 1.5249829e-07f, 4.43889e-06f, 1.8965597e-05f, 1.0259133e-05f, 7.08414e-06f, 6.4719843e-06f, -3.7596776e-06f, -2.391952e-05f, -3.6669597e-05f, -4.7005205e-06f, -4.5940207e-05f, 2.1127118e-05f, -8.049334e-06f, -2.0954847e-05f, 3.3736695e-05f, 1.8696259e-05f, 8.337662e-06f, 7.892918e-06f, -3.1100095e-05f, -1.5653883e-05f, 6.6252137e-06f, 1.4316342e-06f, -2.5239033e-05f, 1.6141998e-05f, -8.065704e-06f, -2.1065141e-05f, 5.7574157e-06f, 2.7143737e-05f, -3.6887435e-05f, -2.4870415e-05f, 2.6765005e-07f, 8.334591e-06f, -6.865908e-05f, -4.4993343e-05f, 5.3345393e-05f, -3.2187265e-05f, -5.355119e-05f, -4.7213005e-05f, 3.289026e-05f, -4.6522116e-05f, -2.4692028e-05f, 9.917136e-07f, -2.5703905e-05f, -1.6284735e-05f, -1.0400333e-05f, -1.9559266e-05f, 1.1285607e-05f, -2.3724228e-05f, -1.647468e-05f, 2.0055259e-06f, -1.5345835e-05f, 4.5936113e-06f, -2.3625785e-06f, 1.9755895e-05f, -1.3127913e-05f, 1.2984786e-05f, -3.3675296e-05f, 7.211074e-05f, -3.0443141e-05f, 1.458603e-05f, -7.3701514e-05f, 2.1872958e-05f, -3.926382e-05f, 4.226598e-05f, 6.515656e-06f, -8.595007e-06f, -1.5734122e-05f, -3.5924106e-05f, 3.0153458e-05f, 8.6003746e-07f, -5.795188e-06f, 3.9990016e-05f, 2.6292966e-05f, 1.2603467e-05f, 2.4927915e-05f, -2.2662207e-05f, 2.6696953e-06f, -5.950803e-06f, 5.1882153e-06f, 3.5029163e-05f, 6.810593e-05f, 3.589604e-05f, 4.053062e-05f, -3.0480662e-05f, -2.7009657e-05f, -6.9131456e-05f, 4.507018e-05f, -8.199443e-05f, -4.7622225e-06f, 2.2137988e-06f, 1.4035115e-05f, 6.7942406e-06f, -7.6116685e-06f, -4.2549177e-06f, 7.23224e-06f, -1.8916346e-05f, 8.699791e-06f, 1.5710373e-05f, 1.3524246e-06f, 9.550673e-06f, -1.3580194e-05f, 5.052209e-06f, 2.4184392e-05f, 6.8982467e-06f, 5.13768e-05f, -1.8196613e-05f, 2.0962127e-06f, -9.424658e-06f, 7.1684235e-06f, -3.983933e-06f, 1.3898614e-05f, 3.5808919e-06f, 1.2535125e-05f, 3.1838084e-05f, -3.207162e-05f, 2.4363237e-05f, 2.1594359e-07f, -2.0348685e-05f, 4.489547e-05f, 2.8549342e-05f, 2.1467915e-06f, 1.3881507e-05f, -1.2056965e-05f, -4.0400096e-06f, -1.5073435e-05f, 2.2076427e-05f, -1.180108e-05f, 2.2344528e-05f, 7.101282e-05f, 3.9721845e-06f, -1.2469398e-05f, -2.1602382e-05f, -7.8031175e-05f, -4.2315605e-05f, 7.664999e-05f, 2.9435261e-05f, -2.2531312e-05f, 5.779695e-07f, -2.627016e-05f, 3.1956267e-06f, -1.0136126e-05f, 1.3131374e-05f, 5.0462872e-06f, -2.4847359e-05f, 4.541661e-06f, 2.1334909e-05f, 1.0763668e-05f, -2.3145758e-05f, 6.0735256e-06f, 8.407499e-06f, 1.2726327e-05f, 1.1371575e-05f, -1.5290796e-05f, -8.091131e-07f, -4.708228e-05f, 8.510442e-06f, -2.6775535e-05f, -6.305317e-05f, -3.7628906e-05f, -6.484914e-05f, -2.1908886e-06f, -1.7579303e-05f, -1.1451746e-05f, 1.4565839e-05f, 1.4154134e-05f, 7.800682e-06f, 4.837993e-05f, 1.3232182e-06f, 3.3682838e-05f, 1.2766584e-05f, -3.266831e-07f, -8.598217e-06f, 1.8452987e-05f, 1.0035691e-05f, -2.4367077e-05f, 6.7248243e-06f, -2.8723936e-05f, -2.3393495e-05f, -6.968441e-05f, 9.6630265e-06f, 6.5434506e-05f, -1.8801467e-05f, -4.185284e-06f, 4.0572737e-05f, -2.5773252e-05f, -1.3367951e-05f, -1.3062082e-05f, 3.513709e-06f, 2.3438439e-05f, -2.418967e-05f, 1.569495e-05f, -2.1564845e-06f, 1.9784834e-06f, 2.4255962e-05f, -1.5991789e-05f, -1.6147425e-05f, -1.2914896e-05f, 2.2693778e-06f, 1.051026e-05f, 8.865219e-06f, -5.118012e-05f, 8.849383e-06f, 5.4802967e-05f, 9.679635e-06f, 2.9619157e-05f, -6.015024e-05f, -3.210991e-05f, 1.916609e-05f, 3.3283764e-06f, 3.7497175e-06f, 1.7969653e-05f, 1.1252645e-05f, 4.327326e-05f, 1.3181645e-06f, 2.4038274e-05f, -3.2030657e-06f, 3.794583e-05f, 6.2824433e-06f, 1.5190343e-08f, 3.2871903e-05f, -4.421379e-05f, -5.9627396e-06f, 1.6237416e-05f, 1.510556e-06f, -8.557444e-06f, 4.2983145e-05f, -1.6013406e-05f, -5.9790007e-05f, -3.3279382e-05f, -2.0983722e-05f, 9.5399075e-05f, 7.665146e-05f, -2.199876e-05f, 4.895205e-06f, 2.819558e-06f, 7.461012e-06f, -1.5819738e-05f, -1.3535521e-05f, 1.1435457e-05f, -4.9390183e-06f, -2.3582397e-05f, 5.0494023e-06f, 1.6310942e-05f, 1.0783473e-05f, 1.7306307e-05f, 5.0060858e-06f, 5.5249734e-06f, -1.2444911e-05f, 6.57494e-05f, 6.291933e-05f, 4.9584494e-05f, -2.4358094e-05f, -7.450215e-05f, 2.4817182e-05f, 5.7681616e-05f, 4.5676377e-05f, -5.105322e-06f, 2.194177e-05f, -3.1624088e-05f, -3.3247947e-05f, 1.2831691e-05f, 4.14075e-05f, 1.0324086e-05f, 1.6057453e-05f, -2.4007642e-05f, 4.1601634e-05f, 5.9609197e-06f, -2.2448881e-05f, -2.1345413e-05f, 7.0413294e-06f, -3.360177e-05f, -1.8107843e-05f, 0.000106026804f, 0.0001018796f, -7.1580864e-05f, -7.2921284e-05f, 3.9559876e-05f, -3.2644486e-05f, -8.765076e-05f, 3.1621905e-05f, -1.7689757e-05f, -1.3658425e-05f, -1.4056765e-05f, -1.4086155e-05f, -1.1066951e-05f, -1.9233159e-05f, 2.1499993e-05f, 5.4671227e-06f, 1.7667991e-05f, 7.0129972e-06f, -6.9653893e-06f, -2.1588541e-05f, -1.153345e-06f, 3.5749347e-06f, 1.965127e-05f, 7.338012e-07f, -3.284553e-05f, 6.543003e-05f, -5.433994e-05f, 2.0472913e-05f, -8.516662e-05f, -2.1919905e-05f, 2.3077953e-05f, -7.002299e-05f, -5.8637506e-06f, 1.30626495e-05f, 4.2859607e-05f, -1.6575066e-05f, -3.0040364e-05f, -2.6566204e-05f, -9.749645e-06f, 3.6618076e-05f, -9.778283e-06f, 1.6220201e-05f, -2.5017243e-05f, -1.9852188e-05f, -1.065378e-06f, -2.3927989e-05f, 9.262839e-06f, -1.4663634e-06f, -2.2879725e-05f, 0.00010429245f, 4.2444517e-05f, -0.000119776036f, 4.7382564e-05f, -4.6346646e-05f, 9.71493e-05f, -7.49057e-05f, 1.2172407e-06f, -1.6796488e-05f, 1.5335709e-05f, -6.2936697e-06f, 9.225981e-06f, -1.978257e-05f, -2.4734652e-07f, 1.4854234e-07f, 9.875364e-06f, 6.283315e-06f, 1.0139363e-05f, 1.0133359e-05f, -9.392868e-06f, -3.3763233e-06f, -1.4536345e-05f, 2.259582e-06f, 8.602092e-05f, 5.1395964e-05f, 7.609784e-05f, 9.722304e-06f, 2.085776e-05f, -5.228897e-05f, -1.5280342e-05f, 5.4471875e-06f, -1.3690474e-05f, -3.6975216e-05f, -1.3806837e-05f, 3.4644445e-06f, 2.4771003e-07f, 2.1829446e-06f, 4.6260346e-05f, -1.406953e-05f, 1.809952e-05f, 3.523207e-05f, 3.0959156e-05f, -1.745186e-05f, -4.555926e-05f, -1.0838792e-05f, -3.180265e-05f, -3.6821533e-05f, -1.7890012e-05f, 3.1502943e-05f, 4.0010495e-05f, -5.63869e-05f, -4.9953276e-05f, 3.062274e-05f, 5.6490702e-05f, 4.3726195e-05f, 1.1676854e-05f, -1.5613246e-05f, -4.182886e-06f, 9.937231e-07f, -2.6855525e-06f, 4.909979e-06f, -1.5266294e-05f, 8.758969e-06f, -2.4064211e-05f, -1.6168326e-06f, 5.813456e-06f, -9.834785e-06f, 7.2747034e-06f, -1.723493e-05f, 2.3940624e-05f, -1.9364428e-05f, -1.9542518e-05f, -2.4987303e-05f, -7.4726144e-05f, -4.6544123e-05f, 3.7486887e-05f, 4.5939672e-05f, 3.3350687e-05f, 1.2429172e-05f, -5.3153908e-05f, -1.0854717e-05f, -4.607039e-05f, -5.989379e-05f, -3.6416848e-05f, -2.3576607e-05f, -3.6278252e-05f, -4.042008e-05f, -1.120559e-05f, 3.261291e-05f, -2.8680031e-05f, 4.2558382e-05f, 1.8120768e-06f, 3.649494e-05f, 6.967242e-06f, 1.9937319e-05f, -1.8521927e-05f, -2.3994218e-05f, 4.4017357e-05f, -1.7342554e-05f, 1.3168096e-05f, -5.1627198e-05f, -5.5528042e-05f, 1.7926475e-05f };
+static const float mlp_wt__8___1e_05_layer_1_biases[6] = { 0.598813f, 0.159479f, -0.349086f, 0.007237f, 0.168213f, 0.248556f };
+static const float mlp_wt__8___1e_05_layer_1_weights[64] = { 0.444117f, 0.379162f, -0.237812f, 0.457523f, -0.589733f, -0.004743f, 0.0f, 0.0f, 0.21143f, -0.236702f, -0.58915f, -0.351835f, -0.00071f, -0.233451f, 0.0f, 0.0f, -0.089875f, -0.53227f, -0.623434f, 0.47148f, -0.554283f, -0.257545f, 0.0f, 0.0f, 0.1954f, 0.483247f, -0.223084f, 0.170493f, -0.066788f, -0.611841f, 0.0f, 0.0f, -0.114841f, -0.61831f, 0.642359f, 0.308032f, -0.238658f, -0.322492f, 0.0f, 0.0f, -0.157765f, -0.241357f, -0.197881f, 0.524517f, -0.131389f, 0.340723f, 0.0f, 0.0f, -0.464479f, 0.053999f, 0.009806f, 0.087474f, 0.206482f, 0.492831f, 0.0f, 0.0f, -0.383282f, -0.131846f, -0.600281f, 0.129942f, 0.597809f, -0.138175f, 0.0f, 0.0f };
+static float mlp_wt__8___1e_05_buf1[8];
+static float mlp_wt__8___1e_05_buf2[6];
+static const EmlNetLayer mlp_wt__8___1e_05_layers[2] = { 
+{ 8, 600, mlp_wt__8___1e_05_layer_0_weights, mlp_wt__8___1e_05_layer_0_biases, EmlNetActivationRelu, EmlNetLayerDenseBlocked8 }, 
+{ 6, 8, mlp_wt__8___1e_05_layer_1_weights, mlp_wt__8___1e_05_layer_1_biases, EmlNetActivationSoftmax, EmlNetLayerDenseBlocked8 } };
+static EmlNet mlp_wt__8___1e_05 = { 2, mlp_wt__8___1e_05_layers, mlp_wt__8___1e_05_buf1, mlp_wt__8___1e_05_buf2, 8, NULL, 0, 6 };
+
+    int32_t
+    mlp_wt__8___1e_05_predict(const float *features, int32_t n_features)
+    {
+        return eml_net_predict(&mlp_wt__8___1e_05, features, n_features);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+    {
+        return eml_net_regress(&mlp_wt__8___1e_05, features, n_features, out, out_length);
+    }
+
+
+    float
+    mlp_wt__8___1e_05_regress1(const float *features, int32_t n_features)
+    {
+        return eml_net_regress1(&mlp_wt__8___1e_05, features, n_features);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_workspace_size(void)
+    {
+        return eml_net_workspace_size(&mlp_wt__8___1e_05);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_predict_workspace(&mlp_wt__8___1e_05, features, n_features, workspace, workspace_length);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length)
+    {
+        return eml_net_regress_workspace(&mlp_wt__8___1e_05, features, n_features, out, out_length, workspace, workspace_length);
+    }
+
+
+    static EmlNetChecked mlp_wt__8___1e_05_checked;
+
+    int32_t
+    mlp_wt__8___1e_05_check(void)
+    {
+        return eml_net_check(&mlp_wt__8___1e_05, &mlp_wt__8___1e_05_checked);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_predict_unchecked(const float *features)
+    {
+        return eml_net_predict_unchecked(&mlp_wt__8___1e_05_checked, features);
+    }
+
+
+    void
+    mlp_wt__8___1e_05_regress_unchecked(const float *features, float *out)
+    {
+        eml_net_regress_unchecked(&mlp_wt__8___1e_05_checked, features, out);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_predict_logits(const float *features, float *logits, float *margin)
+    {
+        return eml_net_predict_logits_unchecked(&mlp_wt__8___1e_05_checked, features, logits, margin);
+    }
+
+
+    void
+    mlp_wt__8___1e_05_set_profile(EmlNetProfile *profile)
+    {
+        mlp_wt__8___1e_05.profile = profile;
+    }
+    
+
+    void
+    mlp_wt__8___1e_05_accumulate_reset(float *acc)
+    {
+        for (int32_t o = 0; o < 8; o++) {
+            acc[o] = mlp_wt__8___1e_05_layers[0].biases[o];
+        }
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_accumulate(int32_t offset, const float *values, int32_t n_values, float *acc)
+    {
+        return eml_net_dense_accumulate(&mlp_wt__8___1e_05_layers[0], offset, values, n_values, acc);
+    }
+
+
+    int32_t
+    mlp_wt__8___1e_05_predict_logits_accumulated(float *acc, float *logits, float *margin)
+    {
+        eml_net_layer_activate(&mlp_wt__8___1e_05_layers[0], acc);
+        return eml_net_predict_logits_from_unchecked(&mlp_wt__8___1e_05_checked, 1, acc, logits, margin);
+    }
+    
\ No newline at end of file
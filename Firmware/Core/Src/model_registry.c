@@ -0,0 +1,273 @@
+#include "model_registry.h"
+#include "mlp_model.h"
+#include "mlp_scaler.h"
+#include "gru_model.h"
+#include "rf_model.h"
+
+#include <math.h>
+#include <string.h>
+
+const char *const model_class_names[MODEL_N_CLASSES] = {
+    "circle",
+    "downup",
+    "leftright",
+    "lightning",
+    "rightleft",
+    "updown",
+};
+
+void model_resample_window(const float *samples, uint16_t n_samples, float *window)
+{
+  if (n_samples == 0)
+  {
+    memset(window, 0, MODEL_WINDOW_LENGTH * sizeof(float));
+    return;
+  }
+
+  for (uint32_t i = 0; i < MODEL_WINDOW_SAMPLES; i++)
+  {
+    // Position of output sample i in the recording
+    const float pos = (float)i * (float)(n_samples - 1) / (float)(MODEL_WINDOW_SAMPLES - 1);
+    const uint32_t idx = (uint32_t)pos;
+    const float frac = pos - (float)idx;
+
+    for (uint32_t axis = 0; axis < MODEL_AXES; axis++)
+    {
+      const float val0 = samples[idx * MODEL_AXES + axis];
+      float val1 = val0;
+      if ((idx + 1) < n_samples)
+      {
+        val1 = samples[(idx + 1) * MODEL_AXES + axis];
+      }
+      window[i * MODEL_AXES + axis] = val0 + frac * (val1 - val0);
+    }
+  }
+}
+
+void model_resample_selected(const float *samples, uint16_t n_samples,
+                             const uint16_t *index, uint16_t n_index, float *features)
+{
+  if (n_samples == 0)
+  {
+    memset(features, 0, n_index * sizeof(float));
+    return;
+  }
+
+  // Position of the current output sample, only recomputed when index moves to another one
+  uint32_t i = MODEL_WINDOW_SAMPLES;
+  uint32_t idx = 0;
+  float frac = 0.0f;
+  for (uint32_t j = 0; j < n_index; j++)
+  {
+    // Same interpolation as model_resample_window, for window value index[j] only
+    const uint32_t sample = index[j] / MODEL_AXES;
+    const uint32_t axis = index[j] - sample * MODEL_AXES;
+    if (sample != i)
+    {
+      i = sample;
+      const float pos = (float)i * (float)(n_samples - 1) / (float)(MODEL_WINDOW_SAMPLES - 1);
+      idx = (uint32_t)pos;
+      frac = pos - (float)idx;
+    }
+
+    const float val0 = samples[idx * MODEL_AXES + axis];
+    float val1 = val0;
+    if ((idx + 1) < n_samples)
+    {
+      val1 = samples[(idx + 1) * MODEL_AXES + axis];
+    }
+    features[j] = val0 + frac * (val1 - val0);
+  }
+}
+
+void model_build_float(const float *window, void *features)
+{
+  memcpy(features, window, MODEL_WINDOW_LENGTH * sizeof(float));
+}
+
+void model_build_standardized(const float *window, void *features)
+{
+#if MLP_SCALER_FOLDED
+  // StandardScaler is folded into the first model layer, feed raw values
+  model_build_float(window, features);
+#else
+  float *out = (float *)features;
+  for (uint32_t i = 0; i < MODEL_WINDOW_LENGTH; i++)
+  {
+    const float centered = window[i] - MLP_MEAN[i];
+    const float scale = MLP_SCALE[i];
+    out[i] = (scale != 0.0f) ? (centered / scale) : centered;
+  }
+#endif
+}
+
+void model_build_int16(const float *window, void *features)
+{
+  int16_t *out = (int16_t *)features;
+  for (uint32_t i = 0; i < MODEL_WINDOW_LENGTH; i++)
+  {
+    const float v = roundf(window[i]);
+    out[i] = (v >= 32767.0f) ? INT16_MAX : (v <= -32768.0f) ? INT16_MIN : (int16_t)v;
+  }
+}
+
+// The window is already resampled, so this picks the selected values of it
+static void model_build_mlp_select(const float *window, void *features)
+{
+  model_resample_selected(window, MODEL_WINDOW_SAMPLES, mlp_select__32_32__1e_05_feature_index,
+                          MLP_SELECT_FEATURES, (float *)features);
+}
+
+// Class with the highest score (the first on ties, like the emlearn forests), and its margin over the runner-up
+static int32_t model_argmax(const float *scores, float *margin)
+{
+  int32_t best = 0;
+  for (int32_t c = 1; c < MODEL_N_CLASSES; c++)
+  {
+    if (scores[c] > scores[best])
+    {
+      best = c;
+    }
+  }
+  if (margin)
+  {
+    float second = -INFINITY;
+    for (int32_t c = 0; c < MODEL_N_CLASSES; c++)
+    {
+      if (c != best && scores[c] > second)
+      {
+        second = scores[c];
+      }
+    }
+    *margin = scores[best] - second;
+  }
+  return best;
+}
+
+static int32_t model_mlp_perf_predict(const void *features, float *scores, float *margin)
+{
+  return mlp_perf__32_32__1e_05_predict_logits((const float *)features, scores, margin);
+}
+
+static int32_t model_mlp_small_predict(const void *features, float *scores, float *margin)
+{
+  return mlp_wt__8___1e_05_predict_logits((const float *)features, scores, margin);
+}
+
+static int32_t model_mlp_select_predict(const void *features, float *scores, float *margin)
+{
+  return mlp_select__32_32__1e_05_predict_logits((const float *)features, scores, margin);
+}
+
+static int32_t model_gru_predict(const void *features, float *scores, float *margin)
+{
+  return gru_predict_logits((const float *)features, scores, margin);
+}
+
+// The forests give vote fractions. Unlike the MLPs they need the scores for the margin
+static int32_t model_rf_perf_predict(const void *features, float *scores, float *margin)
+{
+  float votes[MODEL_N_CLASSES];
+  float *out = scores ? scores : votes;
+  if (rf_perf_25_6_predict_proba((const int16_t *)features, MODEL_WINDOW_LENGTH, out, MODEL_N_CLASSES) != 0)
+  {
+    return -1;
+  }
+  return model_argmax(out, margin);
+}
+
+static int32_t model_rf_small_predict(const void *features, float *scores, float *margin)
+{
+  float votes[MODEL_N_CLASSES];
+  float *out = scores ? scores : votes;
+  if (rf_wt_2_6_predict_proba((const int16_t *)features, MODEL_WINDOW_LENGTH, out, MODEL_N_CLASSES) != 0)
+  {
+    return -1;
+  }
+  return model_argmax(out, margin);
+}
+
+static int32_t model_rf_perf_flat_predict(const void *features, float *scores, float *margin)
+{
+  float votes[MODEL_N_CLASSES];
+  float *out = scores ? scores : votes;
+  if (rf_perf_25_6_flat_predict_proba((const int16_t *)features, MODEL_WINDOW_LENGTH, out, MODEL_N_CLASSES) != 0)
+  {
+    return -1;
+  }
+  return model_argmax(out, margin);
+}
+
+static int32_t model_rf_small_flat_predict(const void *features, float *scores, float *margin)
+{
+  float votes[MODEL_N_CLASSES];
+  float *out = scores ? scores : votes;
+  if (rf_wt_2_6_flat_predict_proba((const int16_t *)features, MODEL_WINDOW_LENGTH, out, MODEL_N_CLASSES) != 0)
+  {
+    return -1;
+  }
+  return model_argmax(out, margin);
+}
+
+const ModelDescriptor model_registry[ModelIds] = {
+    { "mlp_perf__32_32__1e_05", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(float)), model_build_standardized,
+      model_mlp_perf_predict, mlp_perf__32_32__1e_05_check, mlp_perf__32_32__1e_05_workspace_size, model_class_names },
+    { "mlp_wt__8___1e_05", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(float)), model_build_standardized,
+      model_mlp_small_predict, mlp_wt__8___1e_05_check, mlp_wt__8___1e_05_workspace_size, model_class_names },
+    { "mlp_select__32_32__1e_05", (int32_t)(MLP_SELECT_FEATURES * sizeof(float)), model_build_mlp_select,
+      model_mlp_select_predict, mlp_select__32_32__1e_05_check, mlp_select__32_32__1e_05_workspace_size, model_class_names },
+    { "gru", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(float)), model_build_float,
+      model_gru_predict, gru_check, gru_workspace_size, model_class_names },
+    { "rf_perf_25_6", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(int16_t)), model_build_int16,
+      model_rf_perf_predict, NULL, NULL, model_class_names },
+    { "rf_wt_2_6", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(int16_t)), model_build_int16,
+      model_rf_small_predict, NULL, NULL, model_class_names },
+    { "rf_perf_25_6_flat", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(int16_t)), model_build_int16,
+      model_rf_perf_flat_predict, rf_perf_25_6_flat_check, NULL, model_class_names },
+    { "rf_wt_2_6_flat", (int32_t)(MODEL_WINDOW_LENGTH * sizeof(int16_t)), model_build_int16,
+      model_rf_small_flat_predict, rf_wt_2_6_flat_check, NULL, model_class_names },
+};
+
+const ModelDescriptor *model_get(int32_t id)
+{
+  if (id < 0 || id >= ModelIds)
+  {
+    return NULL;
+  }
+  return &model_registry[id];
+}
+
+int32_t model_find(const char *name)
+{
+  for (int32_t id = 0; id < ModelIds; id++)
+  {
+    if (strcmp(model_registry[id].name, name) == 0)
+    {
+      return id;
+    }
+  }
+  return -1;
+}
+
+int32_t model_check_all(void)
+{
+  for (int32_t id = 0; id < ModelIds; id++)
+  {
+    if (model_registry[id].check && model_registry[id].check() != 0)
+    {
+      return id;
+    }
+  }
+  return -1;
+}
+
+int32_t model_classify(int32_t id, const float *window, void *features, float *scores, float *margin)
+{
+  const ModelDescriptor *model = model_get(id);
+  if (!model)
+  {
+    return -1;
+  }
+  model->build_features(window, features);
+  return model->predict(features, scores, margin);
+}
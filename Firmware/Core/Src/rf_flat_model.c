@@ -0,0 +1,29 @@
+#include "rf_model.h"
+#include <eml_trees.h>
+static const uint16_t rf_perf_25_6_flat_feature[251] = { 405, 394, 213, 250, 328, 234, 350, 124, 231, 279, 431, 267, 243, 186, 395, 483, 380, 444, 138, 592, 59, 504, 54, 196, 10, 166, 381, 310, 237, 393, 373, 364, 18, 340, 366, 195, 572, 556, 175, 345, 284, 201, 216, 315, 298, 178, 216, 279, 328, 357, 490, 573, 225, 359, 42, 207, 225, 405, 174, 382, 594, 328, 274, 358, 407, 273, 459, 596, 261, 24, 520, 213, 387, 358, 146, 261, 363, 231, 220, 184, 192, 346, 418, 405, 333, 484, 59, 207, 190, 174, 216, 462, 162, 133, 456, 19, 246, 328, 519, 403, 42, 148, 292, 397, 172, 118, 246, 460, 103, 521, 465, 225, 204, 489, 260, 327, 160, 222, 330, 381, 249, 204, 213, 184, 390, 232, 357, 0, 127, 382, 231, 106, 238, 357, 358, 411, 291, 142, 75, 219, 568, 181, 387, 292, 124, 423, 570, 267, 316, 261, 370, 255, 471, 406, 79, 118, 115, 531, 123, 0, 274, 490, 195, 237, 399, 172, 357, 424, 189, 514, 244, 316, 130, 249, 261, 394, 9, 405, 79, 328, 234, 440, 231, 292, 193, 471, 594, 454, 225, 406, 267, 164, 382, 271, 263, 369, 417, 148, 503, 370, 297, 219, 397, 430, 471, 429, 291, 207, 240, 388, 594, 116, 225, 315, 280, 327, 484, 202, 471, 313, 230, 340, 249, 256, 477, 586, 196, 148, 228, 201, 351, 441, 351, 274, 136, 328, 169, 213, 134, 180, 254, 285, 298, 315, 529, 460, 183, 160, 583, 544, 71 };
+static const int16_t rf_perf_25_6_flat_threshold[251] = { -3571, -8321, -2064, 4215, -2965, -7599, -4340, 3229, 2814, -3289, 4031, 4113, -2048, -3331, 386, -323, -3566, -1429, -310, -4958, 435, -1250, 157, -316, 474, 3145, 1205, 2036, 3511, -4104, -6880, 4603, -363, -2838, 1170, -1312, 620, 1174, -3711, -4156, -12229, -1918, 1617, 3896, 1437, 1341, -4294, 3876, 4675, -4084, -1408, 1738, -1432, 130, -2102, 2845, -1883, -3033, 2333, 1230, -1724, -2223, -2081, -122, 2349, 3107, -3378, -5560, 3548, -828, 2274, -2506, -4502, 769, -1033, 3548, -4478, -2087, 4494, 1214, -1094, 71, 563, -3989, 5087, -1716, -1449, -1990, 4734, -285, -5669, 2140, -4988, -1238, 7821, 314, -1023, 3035, -2724, 6218, 2072, -188, -2548, 2433, 4152, 1094, -5248, -2948, -3288, -1495, -3528, -1842, -1328, -1282, -1513, 2666, -1514, -4281, 2678, -4696, 3321, -1237, -1806, 1763, -1608, -346, -4152, 5616, -1684, 3287, -2033, 1656, -703, 5394, 5935, -4117, 4064, 936, 1955, -1302, -470, -3131, -4540, -1562, 1674, 2665, -784, -777, -2629, 3548, 2862, 54, -2940, -5368, -1420, 6345, 750, 14, 2017, 573, 3006, -1212, 3748, -1169, -2353, 1891, -4152, 5457, -2046, 4876, 4851, -2633, 1905, -2123, 3616, 1321, -409, -4487, -3240, 2387, -7799, -7053, -2008, -3385, -3457, -2793, 5198, -3144, 2900, 3843, -578, -2752, 144, -4037, -277, 1589, -4348, -1468, 3048, 5021, 4143, -1690, -5255, -5275, 3248, -4295, 4165, -2452, 1332, 1342, -987, -738, -2056, 5455, 4067, -4635, -925, 1695, -6058, 388, 799, -2365, 3248, 3570, -3074, -5447, -1687, 563, -6936, -2848, -5819, -3536, 5141, 3821, 801, -2102, 2051, -1297, -1149, -4806, -321, 3973, 4555, -4066, 3301, -2582, -807, 4235, 3188, -2441, -239 };
+static const int16_t rf_perf_25_6_flat_left[251] = { 1, -3, 3, -1, 5, 6, -3, -3, 9, -1, -5, 12, 13, 14, -1, -2, -5, 18, 19, -3, -1, -5, 23, -3, -1, 26, -5, -4, 29, 30, -5, 32, 33, -3, -1, 36, -1, -3, -6, 40, -5, 42, -1, 44, 45, -3, -4, 48, 49, -2, 51, -3, 53, -1, -3, 56, 57, -2, -1, 60, 61, -4, -3, -2, -5, -4, 67, -3, 69, 70, -3, 72, -2, 74, -4, 76, -2, 78, -1, -3, 81, -4, -1, -2, 85, 86, -1, 88, -1, 90, -4, -5, -1, 94, 95, -6, -4, 98, 99, -2, -3, 102, -3, -2, 105, -2, -4, 108, -6, -2, -2, 112, -1, -2, 115, 116, -3, -4, -3, -2, 121, 122, -1, -3, -5, -3, 127, -2, -6, 130, -1, 132, -3, -5, 135, -2, 137, 138, -3, -1, -5, -6, -2, 144, 145, -3, -1, -1, -4, 150, 151, -1, 153, -3, 155, 156, -6, -1, -5, -5, 161, 162, -3, 164, -2, -6, 167, -2, 169, -1, -4, 172, -3, -1, 175, 176, -4, -2, -6, 180, 181, -3, -1, -3, -6, 186, -2, -3, 189, 190, 191, -2, -4, 194, -1, -4, -2, 198, -3, 200, 201, 202, -2, -3, -5, -2, 207, 208, -1, 210, 211, -4, -1, 214, 215, -2, 217, 218, -2, 220, -1, -4, 223, 224, 225, -3, 227, -3, 229, -1, -2, -2, 233, 234, 235, -3, -6, -1, -4, -1, 241, 242, 243, 244, -2, -3, -1, 248, 249, -3, -4 };
+static const int16_t rf_perf_25_6_flat_right[251] = { 2, -2, 4, -5, 8, 7, -4, -4, -6, 10, -6, -6, 17, 15, -3, 16, -1, 22, 21, 20, -4, -1, 25, 24, -2, 27, -1, -5, -6, 31, -2, 38, 35, 34, -4, 37, -4, -4, -5, 41, -2, 43, -5, -6, -5, 46, -1, -6, -5, 50, 52, -1, 54, -3, -4, 65, 59, 58, -5, 64, 62, -1, 63, -1, -6, -6, 68, -2, -6, 71, -5, 73, -1, -5, -1, -6, 77, 79, -5, 80, 82, -5, -5, 84, 92, 87, -3, 89, -5, 91, -3, -1, -6, 97, 96, -5, -3, -5, 101, 100, -1, 104, 103, -6, 106, -1, -1, 110, 109, -3, 111, 114, 113, -5, 117, -6, -5, 118, -5, 120, -6, 125, 123, 124, -4, -5, 128, -5, 129, 133, 131, -4, -1, -1, 141, 136, -6, 139, -1, 140, -4, -5, 143, 149, 147, 146, -6, 148, -1, -6, -5, -4, 154, -2, 160, 159, 157, 158, -4, -4, -5, 163, -6, 165, -1, -4, 168, -5, 171, 170, -5, 174, 173, -4, -6, -5, -1, 178, 179, 184, 182, -4, 183, -6, -5, 187, -3, 188, 195, 193, 192, -1, -1, -5, -6, -6, 197, 199, -6, 204, -6, 203, -1, -4, -6, 206, -6, 209, -2, -5, 212, -1, -3, -6, -5, 216, 219, -1, -3, 221, -4, -6, -6, -5, 226, -2, 228, -1, 230, -4, -1, 232, 239, -5, 237, 236, -2, 238, -6, -6, 247, -6, -5, 245, -1, 246, -4, -4, -1, 250, -2 };
+static const int16_t rf_perf_25_6_flat_roots[25] = { 0, 11, 28, 39, 47, 55, 66, 75, 83, 93, 107, 119, 126, 134, 142, 152, 166, 177, 185, 196, 205, 213, 222, 231, 240 };
+static const EmlTrees rf_perf_25_6_flat = { 251, 25, 6, 597, rf_perf_25_6_flat_feature, rf_perf_25_6_flat_threshold, rf_perf_25_6_flat_left, rf_perf_25_6_flat_right, rf_perf_25_6_flat_roots };
+
+    int32_t
+    rf_perf_25_6_flat_check(void)
+    {
+        return eml_trees_check(&rf_perf_25_6_flat);
+    }
+
+
+    int32_t
+    rf_perf_25_6_flat_predict(const int16_t *features, int32_t features_length)
+    {
+        return eml_trees_predict(&rf_perf_25_6_flat, features, features_length);
+    }
+
+
+    int
+    rf_perf_25_6_flat_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length)
+    {
+        return eml_trees_predict_proba(&rf_perf_25_6_flat, features, features_length, out, out_length);
+    }
+    
\ No newline at end of file
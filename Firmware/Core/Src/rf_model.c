@@ -0,0 +1,5 @@
+#include "rf_model.h"
+
+// The 25 tree forest as home-made/random-forest.ipynb exports it with emlearn.
+// Compiled from home-made/builds, so that the firmware and the host tools use the one generated copy
+#include "../../../home-made/builds/rf_perf_25_6.c"
@@ -0,0 +1,29 @@
+#include "rf_model.h"
+#include <eml_trees.h>
+static const uint16_t rf_wt_2_6_flat_feature[28] = { 405, 394, 213, 250, 328, 234, 350, 124, 231, 279, 431, 267, 243, 186, 395, 483, 380, 444, 138, 592, 59, 504, 54, 196, 10, 166, 381, 310 };
+static const int16_t rf_wt_2_6_flat_threshold[28] = { -3571, -8321, -2064, 4215, -2965, -7599, -4340, 3229, 2814, -3289, 4031, 4113, -2048, -3331, 386, -323, -3566, -1429, -310, -4958, 435, -1250, 157, -316, 474, 3145, 1205, 2036 };
+static const int16_t rf_wt_2_6_flat_left[28] = { 1, -3, 3, -1, 5, 6, -3, -3, 9, -1, -5, 12, 13, 14, -1, -2, -5, 18, 19, -3, -1, -5, 23, -3, -1, 26, -5, -4 };
+static const int16_t rf_wt_2_6_flat_right[28] = { 2, -2, 4, -5, 8, 7, -4, -4, -6, 10, -6, -6, 17, 15, -3, 16, -1, 22, 21, 20, -4, -1, 25, 24, -2, 27, -1, -5 };
+static const int16_t rf_wt_2_6_flat_roots[2] = { 0, 11 };
+static const EmlTrees rf_wt_2_6_flat = { 28, 2, 6, 593, rf_wt_2_6_flat_feature, rf_wt_2_6_flat_threshold, rf_wt_2_6_flat_left, rf_wt_2_6_flat_right, rf_wt_2_6_flat_roots };
+
+    int32_t
+    rf_wt_2_6_flat_check(void)
+    {
+        return eml_trees_check(&rf_wt_2_6_flat);
+    }
+
+
+    int32_t
+    rf_wt_2_6_flat_predict(const int16_t *features, int32_t features_length)
+    {
+        return eml_trees_predict(&rf_wt_2_6_flat, features, features_length);
+    }
+
+
+    int
+    rf_wt_2_6_flat_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length)
+    {
+        return eml_trees_predict_proba(&rf_wt_2_6_flat, features, features_length, out, out_length);
+    }
+    
\ No newline at end of file
@@ -64,7 +64,8 @@ def serial_reader(ser):
                 line = ser.readline().decode('utf-8').strip()
                 if line:
                     # Regex to parse for inference data
-                    match = re.search(r'Inference: ([\d.]+) us \| Class: (.*?) \(Prob: ([\d.]+)\)', line)
+                    # Firmware built with MLP_REPORT_PROB=0 reports the logit margin instead of Prob
+                    match = re.search(r'Inference: ([\d.]+) us \| Class: (.*?) \((?:Prob|Margin): ([\d.]+)\)', line)
                     if match:
                         inference_time = float(match.group(1))
                         classification = match.group(2).strip()
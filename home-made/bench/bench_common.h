@@ -0,0 +1,33 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+// Helpers shared by the host benchmarks in this directory
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+static inline uint64_t
+bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Deterministic pseudo-random values in [-1, 1]
+static inline void
+bench_fill_random(float *values, int32_t length, uint32_t seed)
+{
+    uint32_t state = seed ? seed : 1U;
+    for (int32_t i = 0; i < length; i++) {
+        state = state * 1664525U + 1013904223U;
+        values[i] = ((float)(state >> 8) / (float)(1U << 24)) * 2.0f - 1.0f;
+    }
+}
+
+// Keep the optimizer from dropping benchmark results
+static volatile float bench_sink;
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,109 @@
+/*
+ * Host benchmark: the compile-time C++ templates of eml_net.hpp vs the generic eml_net_infer()
+ * on mlp_perf__32_32__1e_05, over the recorded gestures. Checks that both give the same outputs.
+ *
+ * Build and run from home-made/bench:
+ *   g++ -std=c++17 -O2 -I../../Firmware/Core/Inc bench_cpp.cpp -o bench_cpp.out && ./bench_cpp.out ../data/[a-z]*.csv
+ * The C++ header is generated with:
+ *   python eml_export.py builds/mlp_perf__32_32__1e_05.c builds/mlp_perf__32_32__1e_05.hpp --name mlp_perf_cpp --cpp
+ * Add -march=native to let the compiler vectorize both for the host (AVX2 for the fixed 32-wide layers).
+ */
+// The generated C model defines its functions before mlp_model.h declares them extern "C"
+extern "C" {
+#include "bench_model.h"
+}
+#include "../builds/mlp_perf__32_32__1e_05.hpp"
+
+#include <math.h>
+#include <stdio.h>
+
+#define REPEATS 20
+
+// Generic runtime, outputs in out. ns per window
+static double
+time_generic(const BenchDataset *data, float *out)
+{
+    EmlNet *model = &mlp_perf__32_32__1e_05;
+    const int32_t n_outputs = eml_net_outputs(model);
+    const uint64_t start = bench_now_ns();
+    for (int rep = 0; rep < REPEATS; rep++) {
+        for (int32_t r = 0; r < data->n_samples; r++) {
+            eml_net_infer(model, data->values + (size_t)r * data->n_features, data->n_features);
+            for (int32_t i = 0; i < n_outputs; i++) {
+                out[(size_t)r * n_outputs + i] = model->activations2[i];
+            }
+        }
+    }
+    return (double)(bench_now_ns() - start) / ((double)REPEATS * data->n_samples);
+}
+
+// Compile-time model, outputs in out. ns per window
+static double
+time_templates(const BenchDataset *data, float *out)
+{
+    const auto &model = mlp_perf_cpp::model;
+    const uint64_t start = bench_now_ns();
+    for (int rep = 0; rep < REPEATS; rep++) {
+        for (int32_t r = 0; r < data->n_samples; r++) {
+            model.forward(data->values + (size_t)r * data->n_features, out + (size_t)r * model.n_outputs);
+        }
+    }
+    return (double)(bench_now_ns() - start) / ((double)REPEATS * data->n_samples);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s DATA.csv...\n", argv[0]);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, argc - 1) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+    using Model = mlp_perf_cpp::Model;
+    if (data.n_features != Model::n_inputs) {
+        fprintf(stderr, "Data has %d features, model has %d inputs\n", data.n_features, Model::n_inputs);
+        return 1;
+    }
+
+    const size_t n_values = (size_t)data.n_samples * Model::n_outputs;
+    float *generic = (float *)malloc(sizeof(float) * n_values);
+    float *templates = (float *)malloc(sizeof(float) * n_values);
+
+    printf("%d windows, ns per window\n", data.n_samples);
+#if EML_NET_X86
+    for (int32_t level = EmlNetX86Scalar; level <= (int32_t)eml_net_x86_detect(); level++) {
+        eml_net_x86_select((EmlNetX86Level)level);
+        char label[32];
+        snprintf(label, sizeof(label), "eml_net_infer (%s)", eml_net_x86_level_str((EmlNetX86Level)level));
+        printf("%-24s %10.1f\n", label, time_generic(&data, generic));
+    }
+    // Compare against the portable C kernels, which sum in the same order
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+    time_generic(&data, generic);
+    printf("%-24s %10.1f\n", "eml::Sequential", time_templates(&data, templates));
+
+    double max_diff = 0.0;
+    int32_t agree = 0;
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        const float *a = generic + (size_t)r * Model::n_outputs;
+        const float *b = templates + (size_t)r * Model::n_outputs;
+        for (int32_t i = 0; i < Model::n_outputs; i++) {
+            max_diff = fmax(max_diff, fabs((double)a[i] - (double)b[i]));
+        }
+        agree += eml_net_argmax(a, Model::n_outputs) == eml_net_argmax(b, Model::n_outputs);
+    }
+    printf("same class %d/%d, max output difference %g\n", agree, data.n_samples, max_diff);
+
+    free(generic);
+    free(templates);
+    bench_free_dataset(&data);
+    return 0;
+}
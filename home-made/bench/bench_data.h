@@ -0,0 +1,123 @@
+#ifndef BENCH_DATA_H
+#define BENCH_DATA_H
+
+// Loading of the recorded gestures (home-made/data/*.csv) for the host tools in this directory
+
+#include "bench_common.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct _BenchDataset {
+    float *values;      // n_samples x n_features, row-major
+    int32_t *labels;    // index of the CSV file each row came from
+    int32_t n_samples;
+    int32_t n_features;
+    int32_t capacity;   // rows allocated
+} BenchDataset;
+
+// Number of comma-separated fields in line
+static inline int32_t
+bench_count_fields(const char *line)
+{
+    int32_t n = 1;
+    for (const char *c = line; *c; c++) {
+        n += (*c == ',');
+    }
+    return n;
+}
+
+/*
+ * Append the rows of one CSV file, skipping the header line.
+ * All files must have the same number of columns.
+ * Returns 0 on success
+ */
+static inline int
+bench_load_csv(BenchDataset *data, const char *path, int32_t label)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Could not open %s\n", path);
+        return -1;
+    }
+
+    size_t line_size = 0;
+    char *line = NULL;
+    if (getline(&line, &line_size, f) < 0) {
+        fprintf(stderr, "Empty file %s\n", path);
+        fclose(f);
+        free(line);
+        return -1;
+    }
+    const int32_t n_features = bench_count_fields(line);
+    if (data->n_features && data->n_features != n_features) {
+        fprintf(stderr, "%s has %d columns, expected %d\n", path, n_features, data->n_features);
+        fclose(f);
+        free(line);
+        return -1;
+    }
+    data->n_features = n_features;
+
+    while (getline(&line, &line_size, f) > 0) {
+        if (line[0] == '\n' || line[0] == '\0') {
+            continue;
+        }
+        const int32_t row = data->n_samples;
+        if (row == data->capacity) {
+            data->capacity = data->capacity ? 2*data->capacity : 256;
+            data->values = (float *)realloc(data->values, sizeof(float) * (size_t)data->capacity * n_features);
+            data->labels = (int32_t *)realloc(data->labels, sizeof(int32_t) * (size_t)data->capacity);
+        }
+        float *values = data->values + (size_t)row * n_features;
+        char *pos = line;
+        for (int32_t i = 0; i < n_features; i++) {
+            values[i] = strtof(pos, &pos);
+            pos += (*pos == ',');
+        }
+        data->labels[row] = label;
+        data->n_samples = row + 1;
+    }
+
+    fclose(f);
+    free(line);
+    return 0;
+}
+
+// Load CSV files, labelled by their position in paths. Pass them sorted by name, like the notebooks
+static inline int
+bench_load_dataset(BenchDataset *data, char **paths, int n_paths)
+{
+    memset(data, 0, sizeof(*data));
+    for (int p = 0; p < n_paths; p++) {
+        if (bench_load_csv(data, paths[p], p) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// StandardScaler transform, in place. Zero scale (a constant feature) counts as 1,
+// like StandardScaler, model_build_standardized() in model_registry.c and the scaler folding of eml_export.py
+static inline void
+bench_scale_dataset(BenchDataset *data, const float *mean, const float *scale)
+{
+    for (int32_t r = 0; r < data->n_samples; r++) {
+        float *values = data->values + (size_t)r * data->n_features;
+        for (int32_t i = 0; i < data->n_features; i++) {
+            const float centered = values[i] - mean[i];
+            values[i] = (scale[i] != 0.0f) ? (centered / scale[i]) : centered;
+        }
+    }
+}
+
+static inline void
+bench_free_dataset(BenchDataset *data)
+{
+    free(data->values);
+    free(data->labels);
+    memset(data, 0, sizeof(*data));
+}
+
+#endif // BENCH_DATA_H
@@ -0,0 +1,155 @@
+/*
+ * Host benchmark: emlearn input-major dense kernel vs output-blocked and quantized kernels
+ * on the 600x32 first layer of mlp_perf__32_32__1e_05.
+ * float16 needs a compiler with _Float16 (GCC 12 or later on x86-64).
+ *
+ * Build and run from home-made/bench:
+ *   gcc -O2 -I../../Firmware/Core/Inc bench_dense.c -o bench_dense.out -lm && ./bench_dense.out
+ * On x86-64 the float layers run the SSE/AVX2 kernels of eml_net_x86.h.
+ * Add -DEML_NET_NO_X86 to time the portable C kernels that run on the target.
+ */
+#include "bench_common.h"
+#include "../builds/mlp_perf__32_32__1e_05.c"
+
+#include <math.h>
+#include <stdio.h>
+
+#define N_INPUTS 600
+#define N_OUTPUTS 32
+#define REPEATS 5000
+
+static float blocked4_weights[N_INPUTS * N_OUTPUTS];
+static float blocked8_weights[N_INPUTS * N_OUTPUTS];
+static int8_t int8_weights[N_INPUTS * N_OUTPUTS];
+static float int8_scales[N_OUTPUTS];
+static int16_t q15_weights[N_INPUTS * N_OUTPUTS];
+static float q15_scales[N_OUTPUTS];
+static uint16_t float16_weights[N_INPUTS * N_OUTPUTS];
+static uint16_t float16_biases[N_OUTPUTS];
+static int32_t scratch[N_INPUTS];
+
+// Same reordering as pack_blocked() in eml_export.py
+static void
+pack_blocked(const float *weights, int32_t n_inputs, int32_t n_outputs, int32_t block, float *out)
+{
+    const int32_t n_blocks = (n_outputs + block - 1) / block;
+    int32_t idx = 0;
+    for (int32_t b = 0; b < n_blocks; b++) {
+        for (int32_t i = 0; i < n_inputs; i++) {
+            for (int32_t k = 0; k < block; k++) {
+                const int32_t o = b*block + k;
+                out[idx++] = (o < n_outputs) ? weights[i*n_outputs + o] : 0.0f;
+            }
+        }
+    }
+}
+
+// Same quantization as quantize_int8() in eml_export.py
+static void
+quantize_int8(const float *weights, int32_t n_inputs, int32_t n_outputs, int8_t *out, float *scales)
+{
+    for (int32_t o = 0; o < n_outputs; o++) {
+        float w_max = 0.0f;
+        for (int32_t i = 0; i < n_inputs; i++) {
+            w_max = fmaxf(w_max, fabsf(weights[i*n_outputs + o]));
+        }
+        scales[o] = (w_max > 0.0f) ? (w_max / 127.0f) : 1.0f;
+        for (int32_t i = 0; i < n_inputs; i++) {
+            out[o*n_inputs + i] = (int8_t)lrintf(weights[i*n_outputs + o] / scales[o]);
+        }
+    }
+}
+
+// Same quantization as quantize_q15() in eml_export.py
+static void
+quantize_q15(const float *weights, int32_t n_inputs, int32_t n_outputs, int16_t *out, float *scales)
+{
+    for (int32_t o = 0; o < n_outputs; o++) {
+        float w_max = 0.0f;
+        for (int32_t i = 0; i < n_inputs; i++) {
+            w_max = fmaxf(w_max, fabsf(weights[i*n_outputs + o]));
+        }
+        scales[o] = (w_max > 0.0f) ? (w_max / 32767.0f) : 1.0f;
+        for (int32_t i = 0; i < n_inputs; i++) {
+            out[o*n_inputs + i] = (int16_t)lrintf(weights[i*n_outputs + o] / scales[o]);
+        }
+    }
+}
+
+// Round to nearest half precision bit pattern, like astype(np.float16) in eml_export.py
+static void
+to_float16(const float *values, int32_t length, float scale, uint16_t *out)
+{
+    for (int32_t i = 0; i < length; i++) {
+        const _Float16 h = (_Float16)(values[i] / scale);
+        memcpy(&out[i], &h, sizeof(out[i]));
+    }
+}
+
+static double
+time_layer(const EmlNetLayer *layer, const float *in, float *out)
+{
+    const uint64_t start = bench_now_ns();
+    for (int r = 0; r < REPEATS; r++) {
+        eml_net_layer_forward_scratch(layer, in, N_INPUTS, out, N_OUTPUTS, scratch, sizeof(scratch));
+        bench_sink = out[r % N_OUTPUTS];
+    }
+    return (double)(bench_now_ns() - start) / REPEATS;
+}
+
+int
+main(void)
+{
+    const float *weights = mlp_perf__32_32__1e_05_layer_0_weights;
+    const float *biases = mlp_perf__32_32__1e_05_layer_0_biases;
+    pack_blocked(weights, N_INPUTS, N_OUTPUTS, 4, blocked4_weights);
+    pack_blocked(weights, N_INPUTS, N_OUTPUTS, 8, blocked8_weights);
+    quantize_int8(weights, N_INPUTS, N_OUTPUTS, int8_weights, int8_scales);
+    const EmlNetInt8Weights int8_params = { int8_weights, int8_scales };
+    quantize_q15(weights, N_INPUTS, N_OUTPUTS, q15_weights, q15_scales);
+    const EmlNetQ15Weights q15_params = { q15_weights, q15_scales };
+    // Power-of-two scale, as in eml_export.py
+    float w_max = 0.0f;
+    for (int32_t i = 0; i < N_INPUTS * N_OUTPUTS; i++) {
+        w_max = fmaxf(w_max, fabsf(weights[i]));
+    }
+    const float float16_scale = exp2f(ceilf(log2f(w_max)));
+    to_float16(blocked8_weights, N_INPUTS * N_OUTPUTS, float16_scale, float16_weights);
+    to_float16(biases, N_OUTPUTS, 1.0f, float16_biases);
+    const EmlNetFloat16Weights float16_params = { float16_weights, float16_biases, float16_scale };
+
+    const EmlNetLayer layers[] = {
+        { N_OUTPUTS, N_INPUTS, weights, biases, EmlNetActivationRelu, EmlNetLayerDense },
+        { N_OUTPUTS, N_INPUTS, blocked4_weights, biases, EmlNetActivationRelu, EmlNetLayerDenseBlocked4 },
+        { N_OUTPUTS, N_INPUTS, blocked8_weights, biases, EmlNetActivationRelu, EmlNetLayerDenseBlocked8 },
+        { N_OUTPUTS, N_INPUTS, NULL, biases, EmlNetActivationRelu, EmlNetLayerDenseInt8, &int8_params },
+        { N_OUTPUTS, N_INPUTS, NULL, biases, EmlNetActivationRelu, EmlNetLayerDenseQ15, &q15_params },
+        { N_OUTPUTS, N_INPUTS, NULL, NULL, EmlNetActivationRelu, EmlNetLayerDenseFloat16, &float16_params },
+    };
+    const int n_layers = (int)(sizeof(layers) / sizeof(layers[0]));
+
+    float in[N_INPUTS];
+    float reference[N_OUTPUTS];
+    float out[N_OUTPUTS];
+    bench_fill_random(in, N_INPUTS, 42);
+    eml_net_layer_forward(&layers[0], in, N_INPUTS, reference, N_OUTPUTS);
+
+    double baseline_ns = 0.0;
+    for (int l = 0; l < n_layers; l++) {
+        const EmlNetLayer *layer = &layers[l];
+        eml_net_layer_forward_scratch(layer, in, N_INPUTS, out, N_OUTPUTS, scratch, sizeof(scratch));
+        float max_diff = 0.0f;
+        for (int o = 0; o < N_OUTPUTS; o++) {
+            max_diff = fmaxf(max_diff, fabsf(out[o] - reference[o]));
+        }
+
+        const double ns = time_layer(layer, in, out);
+        if (l == 0) {
+            baseline_ns = ns;
+        }
+        printf("%-16s %9.1f ns/inference  speedup %.2fx  max_diff %g\n",
+            eml_net_layer_type_str(layer->type), ns, baseline_ns / ns, (double)max_diff);
+    }
+
+    return 0;
+}
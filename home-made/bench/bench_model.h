@@ -0,0 +1,51 @@
+#ifndef BENCH_MODEL_H
+#define BENCH_MODEL_H
+
+/*
+ * Model under test for the host tools in this directory, chosen at compile time.
+ * Default is ../builds/mlp_perf__32_32__1e_05.c with the scaler in Firmware/Core/Src/mlp_scaler.c.
+ *
+ * Other models:
+ *   -DMODEL_C='"../builds/mlp_wt__8___1e_05.c"' -DMODEL=mlp_wt__8___1e_05
+ * Models with the scaler folded into layer 0 (eml_export.py --fold-scaler) take raw values:
+ *   -DMODEL_C='"../../Firmware/Core/Src/mlp_model.c"' -DNO_SCALER
+ */
+
+#include "bench_data.h"
+
+#ifndef MODEL_C
+#define MODEL_C "../builds/mlp_perf__32_32__1e_05.c"
+#endif
+#ifndef MODEL
+#define MODEL mlp_perf__32_32__1e_05
+#endif
+
+#include MODEL_C
+
+#ifndef NO_SCALER
+#define MLP_SCALER_FOLDED 0
+#include "../../Firmware/Core/Src/mlp_scaler.c"
+#endif
+
+#define BENCH_PASTE_(a, b) a##b
+#define BENCH_PASTE(a, b) BENCH_PASTE_(a, b)
+// Generated predict function of the model
+#define BENCH_MODEL_PREDICT BENCH_PASTE(MODEL, _predict)
+
+// Apply the scaler if the model needs it. Returns 0 on success
+static int
+bench_model_prepare(BenchDataset *data)
+{
+#ifndef NO_SCALER
+    if (data->n_features != MLP_FEATURE_DIM) {
+        fprintf(stderr, "Data has %d features, scaler has %d\n", data->n_features, MLP_FEATURE_DIM);
+        return -1;
+    }
+    bench_scale_dataset(data, MLP_MEAN, MLP_SCALE);
+#else
+    (void)data;
+#endif
+    return 0;
+}
+
+#endif // BENCH_MODEL_H
@@ -0,0 +1,69 @@
+/*
+ * Accuracy, balanced accuracy (mean per-class recall) and time per window
+ * of an exported EmlNet model over the recorded gestures.
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_accuracy.c -o eval_accuracy.out -lm && ./eval_accuracy.out ../data/[a-z]*.csv
+ *
+ * Kernels are timed with the portable C code that runs on the target.
+ * See bench_model.h for selecting other models. Used by sweep_export.py.
+ */
+#include "bench_model.h"
+
+#include <stdio.h>
+
+#define MAX_CLASSES 32
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 2 || argc - 1 > MAX_CLASSES) {
+        fprintf(stderr, "Usage: %s DATA.csv... (at most %d files)\n", argv[0], MAX_CLASSES);
+        return 1;
+    }
+    const int n_classes = argc - 1;
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, n_classes) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+#if EML_NET_X86
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+
+    int32_t support[MAX_CLASSES] = { 0 };
+    int32_t hits[MAX_CLASSES] = { 0 };
+    const uint64_t start = bench_now_ns();
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        const int32_t pred = BENCH_MODEL_PREDICT(data.values + (size_t)r * data.n_features, data.n_features);
+        if (pred < 0) {
+            fprintf(stderr, "Inference failed: %d\n", pred);
+            return 1;
+        }
+        support[data.labels[r]] += 1;
+        hits[data.labels[r]] += (pred == data.labels[r]);
+    }
+    const double ns = (double)(bench_now_ns() - start) / data.n_samples;
+
+    int32_t correct = 0;
+    double recall_sum = 0.0;
+    int present = 0;
+    for (int c = 0; c < n_classes; c++) {
+        correct += hits[c];
+        if (support[c] > 0) {
+            recall_sum += (double)hits[c] / support[c];
+            present += 1;
+        }
+    }
+
+    printf("windows %d\n", data.n_samples);
+    printf("accuracy %.4f\n", (double)correct / data.n_samples);
+    printf("balanced_accuracy %.4f\n", present ? recall_sum / present : 0.0);
+    printf("ns_per_window %.1f\n", ns);
+
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Accuracy and time per window of a model blob (eml_net_blob.h) over the recorded gestures,
+ * without compiling the model in: the blob file is mmap'd and used in place, as from flash on the target.
+ *
+ * Write a blob with eml_export.py --blob, then build and run from home-made/bench,
+ * with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_blob.c -o eval_blob.out -lm
+ *   ./eval_blob.out ../builds/mlp_perf__32_32__1e_05.emln ../data/[a-z]*.csv
+ *
+ * Features are raw, so the blob either has the scaler folded in or stored (--blob-scaler).
+ */
+#include "bench_data.h"
+#include "eml_net_blob.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAX_CLASSES 32
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 3 || argc - 2 > MAX_CLASSES) {
+        fprintf(stderr, "Usage: %s MODEL.emln DATA.csv... (at most %d files)\n", argv[0], MAX_CLASSES);
+        return 1;
+    }
+    const int n_classes = argc - 2;
+
+    const int fd = open(argv[1], O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    const void *blob = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (blob == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    EmlNetBlobModel model;
+    const EmlError load_error = eml_net_blob_load(blob, (int32_t)st.st_size, &model);
+    if (load_error != EmlOk) {
+        fprintf(stderr, "%s: invalid blob, %s\n", argv[1], eml_error_str(load_error));
+        return 1;
+    }
+    const int32_t workspace_length = eml_net_blob_workspace_size(&model);
+    void *workspace = malloc((size_t)workspace_length);
+    EmlNetChecked checked;
+    if (eml_net_blob_bind(&model, workspace, workspace_length) != EmlOk
+            || eml_net_check(&model.net, &checked) != EmlOk) {
+        fprintf(stderr, "%s: model failed validation\n", argv[1]);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 2, n_classes) != 0) {
+        return 1;
+    }
+    if (data.n_features != checked.n_inputs) {
+        fprintf(stderr, "Data has %d features, model has %d\n", data.n_features, checked.n_inputs);
+        return 1;
+    }
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        float *features = data.values + (size_t)r * data.n_features;
+        eml_net_blob_scale(&model, features, features);
+    }
+
+    printf("%s: %d bytes, %d layers, %d inputs, %d outputs, scaler %s\n", argv[1], (int)st.st_size,
+        model.net.n_layers, checked.n_inputs, checked.n_outputs, model.scaler_mean ? "stored" : "none (folded)");
+    for (int32_t l = 0; l < model.net.n_layers; l++) {
+        const EmlNetLayer *layer = &model.layers[l];
+        printf("  layer %d  %-18s %4d -> %-4d %s\n", l, eml_net_layer_type_str(layer->type),
+            layer->n_inputs, layer->n_outputs, eml_net_activation_function_strs[layer->activation]);
+    }
+
+    int32_t correct = 0;
+    const uint64_t start = bench_now_ns();
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        const int32_t cls = eml_net_predict_logits_unchecked(&checked,
+                                data.values + (size_t)r * data.n_features, NULL, NULL);
+        correct += (cls == data.labels[r]);
+    }
+    const double ns = (double)(bench_now_ns() - start) / data.n_samples;
+
+    printf("%d windows, accuracy %.4f, %.1f ns per window\n", data.n_samples,
+        (double)correct / data.n_samples, ns);
+    for (int c = 0; c < n_classes && c < checked.n_outputs; c++) {
+        const char *name = eml_net_blob_class_name(&model, c);
+        printf("  class %d: %-12s %s\n", c, name ? name : "-", argv[2 + c]);
+    }
+
+    free(workspace);
+    munmap((void *)blob, (size_t)st.st_size);
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Threshold for a two-stage cascade (eml_net_cascade.h) over the recorded gestures:
+ * mlp_wt__8___1e_05 first, mlp_perf__32_32__1e_05 when the small model's logit margin is below the threshold.
+ * Picks the threshold with the lowest expected time per window whose balanced accuracy
+ * reaches the target (default: that of the large model alone).
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_cascade.c -o eval_cascade.out -lm && ./eval_cascade.out ../data/[a-z]*.csv
+ *   ./eval_cascade.out --target 0.995 ../data/[a-z]*.csv
+ *
+ * Time per window is for the portable C kernels on the host, which scales with the cycles on the target.
+ * The threshold is picked on the same windows it is evaluated on, so leave some slack in the target.
+ */
+#include "bench_data.h"
+#include "eml_net_cascade.h"
+
+#include "../builds/mlp_wt__8___1e_05.c"
+#include "../builds/mlp_perf__32_32__1e_05.c"
+#define MLP_SCALER_FOLDED 0
+#include "../../Firmware/Core/Src/mlp_scaler.c"
+
+#include <math.h>
+#include <stdio.h>
+
+#define MAX_CLASSES 32
+#define N_CLASSES 6
+
+static EmlNetChecked small_checked;
+static EmlNetChecked large_checked;
+
+static int32_t
+small_predict_logits(const float *features, float *logits, float *margin)
+{
+    return eml_net_predict_logits_unchecked(&small_checked, features, logits, margin);
+}
+
+static int32_t
+large_predict_logits(const float *features, float *logits, float *margin)
+{
+    return eml_net_predict_logits_unchecked(&large_checked, features, logits, margin);
+}
+
+// ns per window of one stage over all windows
+static double
+time_stage(EmlNetPredictLogits predict, const BenchDataset *data)
+{
+    const uint64_t start = bench_now_ns();
+    for (int32_t r = 0; r < data->n_samples; r++) {
+        float margin;
+        predict(data->values + (size_t)r * data->n_features, NULL, &margin);
+        bench_sink = margin;
+    }
+    return (double)(bench_now_ns() - start) / data->n_samples;
+}
+
+// Mean per-class recall of predictions
+static double
+balanced_accuracy(const int32_t *labels, const int32_t *predicted, int32_t n, int n_classes)
+{
+    int32_t support[MAX_CLASSES] = { 0 };
+    int32_t hits[MAX_CLASSES] = { 0 };
+    for (int32_t r = 0; r < n; r++) {
+        support[labels[r]] += 1;
+        hits[labels[r]] += (predicted[r] == labels[r]);
+    }
+    double recall_sum = 0.0;
+    int present = 0;
+    for (int c = 0; c < n_classes; c++) {
+        if (support[c] > 0) {
+            recall_sum += (double)hits[c] / support[c];
+            present += 1;
+        }
+    }
+    return present ? recall_sum / present : 0.0;
+}
+
+static int
+compare_floats(const void *a, const void *b)
+{
+    const float x = *(const float *)a;
+    const float y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+int
+main(int argc, char **argv)
+{
+    double target = -1.0;
+    if (argc > 2 && strcmp(argv[1], "--target") == 0) {
+        target = atof(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc < 2 || argc - 1 > MAX_CLASSES) {
+        fprintf(stderr, "Usage: %s [--target BALANCED_ACCURACY] DATA.csv... (at most %d files)\n",
+            argv[0], MAX_CLASSES);
+        return 1;
+    }
+    const int n_classes = argc - 1;
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, n_classes) != 0) {
+        return 1;
+    }
+    if (data.n_features != MLP_FEATURE_DIM) {
+        fprintf(stderr, "Data has %d features, scaler has %d\n", data.n_features, MLP_FEATURE_DIM);
+        return 1;
+    }
+    bench_scale_dataset(&data, MLP_MEAN, MLP_SCALE);
+#if EML_NET_X86
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+    if (eml_net_check(&mlp_wt__8___1e_05, &small_checked) != EmlOk
+            || eml_net_check(&mlp_perf__32_32__1e_05, &large_checked) != EmlOk
+            || small_checked.n_outputs != N_CLASSES || large_checked.n_outputs != N_CLASSES) {
+        fprintf(stderr, "Models failed validation\n");
+        return 1;
+    }
+
+    const int32_t n = data.n_samples;
+    int32_t *small_class = (int32_t *)malloc(sizeof(int32_t) * n);
+    int32_t *large_class = (int32_t *)malloc(sizeof(int32_t) * n);
+    int32_t *cascade_class = (int32_t *)malloc(sizeof(int32_t) * n);
+    float *small_margin = (float *)malloc(sizeof(float) * n);
+    float *thresholds = (float *)malloc(sizeof(float) * (n + 1));
+    for (int32_t r = 0; r < n; r++) {
+        const float *features = data.values + (size_t)r * data.n_features;
+        small_class[r] = small_predict_logits(features, NULL, &small_margin[r]);
+        large_class[r] = large_predict_logits(features, NULL, NULL);
+    }
+
+    const double small_ns = time_stage(small_predict_logits, &data);
+    const double large_ns = time_stage(large_predict_logits, &data);
+    const double small_acc = balanced_accuracy(data.labels, small_class, n, n_classes);
+    const double large_acc = balanced_accuracy(data.labels, large_class, n, n_classes);
+    if (target < 0.0) {
+        target = large_acc;
+    }
+    printf("%d windows\n", n);
+    printf("small  %8.1f ns  balanced accuracy %.4f\n", small_ns, small_acc);
+    printf("large  %8.1f ns  balanced accuracy %.4f\n", large_ns, large_acc);
+    printf("target balanced accuracy %.4f\n\n", target);
+
+    // Candidate thresholds: 0 (never escalate), and each margin (escalate the windows below it)
+    thresholds[0] = 0.0f;
+    memcpy(thresholds + 1, small_margin, sizeof(float) * n);
+    qsort(thresholds, (size_t)n + 1, sizeof(float), compare_floats);
+
+    printf("threshold  escalated  balanced_acc  expected_ns\n");
+    float best_threshold = INFINITY;
+    double best_ns = small_ns + large_ns;
+    double best_acc = large_acc;
+    double best_escalated = 1.0;
+    for (int32_t t = 0; t <= n; t++) {
+        if (t > 0 && thresholds[t] == thresholds[t-1]) {
+            continue;
+        }
+        int32_t escalated = 0;
+        for (int32_t r = 0; r < n; r++) {
+            const bool escalate = small_margin[r] < thresholds[t];
+            cascade_class[r] = escalate ? large_class[r] : small_class[r];
+            escalated += escalate;
+        }
+        const double acc = balanced_accuracy(data.labels, cascade_class, n, n_classes);
+        const double fraction = (double)escalated / n;
+        const double ns = small_ns + fraction * large_ns;
+        // Print about 20 rows across the range
+        if (t % (n / 20 + 1) == 0) {
+            printf("%9.3f  %8.1f%%  %12.4f  %11.1f\n", thresholds[t], 100.0 * fraction, acc, ns);
+        }
+        if (acc >= target && ns < best_ns) {
+            best_threshold = thresholds[t];
+            best_ns = ns;
+            best_acc = acc;
+            best_escalated = fraction;
+        }
+    }
+
+    if (isinf(best_threshold)) {
+        printf("\nNo threshold reaches the target, always use the large model\n");
+    } else {
+        // Check the pick with the cascade runtime itself
+        const EmlNetPredictLogits stages[2] = { small_predict_logits, large_predict_logits };
+        const float cascade_thresholds[1] = { best_threshold };
+        const EmlNetCascade cascade = { 2, stages, cascade_thresholds };
+        if (eml_net_cascade_check(&cascade) != EmlOk) {
+            fprintf(stderr, "Cascade failed validation\n");
+            return 1;
+        }
+        const uint64_t start = bench_now_ns();
+        for (int32_t r = 0; r < n; r++) {
+            cascade_class[r] = eml_net_cascade_predict(&cascade, data.values + (size_t)r * data.n_features,
+                                    NULL, NULL, NULL);
+        }
+        const double cascade_ns = (double)(bench_now_ns() - start) / n;
+
+        printf("\nthreshold %.3f: %.1f%% escalated, balanced accuracy %.4f, expected %.1f ns, %.1fx less than the large model\n",
+            best_threshold, 100.0 * best_escalated, best_acc, best_ns, large_ns / best_ns);
+        printf("eml_net_cascade_predict: balanced accuracy %.4f, %.1f ns per window\n",
+            balanced_accuracy(data.labels, cascade_class, n, n_classes), cascade_ns);
+        printf("#define MLP_CASCADE_THRESHOLD %.3ff\n", best_threshold);
+    }
+
+    free(small_class);
+    free(large_class);
+    free(cascade_class);
+    free(small_margin);
+    free(thresholds);
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Host evaluation of an exported EmlNet model over recorded gestures.
+ * Runs every dense kernel level the CPU supports (see eml_net_x86.h, x86-64 only),
+ * and reports accuracy, time per window and agreement with the scalar kernels.
+ * With -DEML_NET_NO_X86, or on other hosts, only the portable C kernels run.
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_model.c -o eval_model.out -lm && ./eval_model.out ../data/[a-z]*.csv
+ *
+ * See bench_model.h for selecting other models.
+ */
+#include "bench_model.h"
+
+#include <stdio.h>
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s DATA.csv...\n", argv[0]);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, argc - 1) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+    printf("%d windows, %d features, %d classes\n", data.n_samples, data.n_features, argc - 1);
+
+    int32_t *reference = (int32_t *)malloc(sizeof(int32_t) * (size_t)data.n_samples);
+#if EML_NET_X86
+    const int32_t best = (int32_t)eml_net_x86_detect();
+#else
+    // Portable build (EML_NET_NO_X86, or not x86-64): only the scalar C kernels
+    const int32_t best = 0;
+#endif
+    for (int32_t level = 0; level <= best; level++) {
+#if EML_NET_X86
+        eml_net_x86_select((EmlNetX86Level)level);
+        const char *level_name = eml_net_x86_level_str((EmlNetX86Level)level);
+#else
+        const char *level_name = "scalar";
+#endif
+
+        int32_t correct = 0;
+        int32_t agree = 0;
+        const uint64_t start = bench_now_ns();
+        for (int32_t r = 0; r < data.n_samples; r++) {
+            const float *values = data.values + (size_t)r * data.n_features;
+            const int32_t pred = BENCH_MODEL_PREDICT(values, data.n_features);
+            if (pred < 0) {
+                fprintf(stderr, "Inference failed: %d\n", pred);
+                return 1;
+            }
+            if (level == 0) {
+                reference[r] = pred;
+            }
+            correct += (pred == data.labels[r]);
+            agree += (pred == reference[r]);
+        }
+        const double ns = (double)(bench_now_ns() - start) / data.n_samples;
+
+        printf("%-8s %9.1f ns/window  accuracy %.4f  agree with scalar %d/%d\n",
+            level_name, ns, (double)correct / data.n_samples,
+            agree, data.n_samples);
+    }
+
+    free(reference);
+    bench_free_dataset(&data);
+    return 0;
+}
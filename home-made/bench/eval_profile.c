@@ -0,0 +1,90 @@
+/*
+ * Per-layer profile of an exported EmlNet model over the recorded gestures (EML_NET_PROFILE, eml_net_profile.h):
+ * cycles of the layer kernel and of its activation, multiply-adds, and the share of the whole inference.
+ *
+ * Build and run from home-made/bench:
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_profile.c -o eval_profile.out -lm && ./eval_profile.out ../data/[a-z]*.csv
+ *
+ * Cycles are time stamp counter ticks on x86, which run at a fixed rate rather than the core clock.
+ * Each count includes reading the counter, some tens of cycles, which dominates short activations like relu.
+ * Kernels are the portable C code that runs on the target. See bench_model.h for selecting other models.
+ */
+#define EML_NET_PROFILE 1
+#include "bench_model.h"
+
+#include <stdio.h>
+
+static void
+print_profile(const char *title, const EmlNetProfile *profile)
+{
+    const double inferences = (double)profile->inferences;
+    const double total = (double)profile->total_cycles / inferences;
+    double layers_total = 0.0;
+
+    printf("%s: %u inferences, %.0f cycles each\n", title, profile->inferences, total);
+    printf("layer  type                  linear  activation       MACs  MACs/cycle  share\n");
+    for (int32_t l = 0; l < profile->n_layers; l++) {
+        const EmlNetLayerProfile *p = &profile->layers[l];
+        if (p->calls == 0) {
+            continue;
+        }
+        const double linear = (double)p->linear_cycles / p->calls;
+        const double activation = (double)p->activation_cycles / p->calls;
+        const double macs = (double)p->macs / p->calls;
+        layers_total += linear + activation;
+        printf("%5d  %-18s  %8.0f  %10.0f  %9.0f  %10.2f  %4.1f%%\n",
+            l, eml_net_layer_type_str(MODEL.layers[l].type), linear, activation, macs,
+            macs / linear, 100.0 * (linear + activation) / total);
+    }
+    printf("runtime overhead (checks, buffers)  %.0f cycles, %.1f%%\n\n",
+        total - layers_total, 100.0 * (total - layers_total) / total);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s DATA.csv...\n", argv[0]);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, argc - 1) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+#if EML_NET_X86
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+
+    EmlNetProfile profile;
+    eml_net_profile_reset(&profile);
+    MODEL.profile = &profile;
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        const EmlError err = eml_net_infer(&MODEL, data.values + (size_t)r * data.n_features, data.n_features);
+        if (err != EmlOk) {
+            fprintf(stderr, "Inference failed: %s\n", eml_error_str(err));
+            return 1;
+        }
+    }
+    print_profile("eml_net_infer", &profile);
+
+    EmlNetChecked checked;
+    if (eml_net_check(&MODEL, &checked) != EmlOk) {
+        fprintf(stderr, "Model failed validation\n");
+        return 1;
+    }
+    eml_net_profile_reset(&profile);
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        float margin;
+        eml_net_predict_logits_unchecked(&checked, data.values + (size_t)r * data.n_features, NULL, &margin);
+        bench_sink = margin;
+    }
+    print_profile("eml_net_predict_logits_unchecked (no output activation)", &profile);
+
+    MODEL.profile = NULL;
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * A/B of every model in the firmware registry (Firmware/Core/Inc/model_registry.h) over the recorded gestures:
+ * accuracy, balanced accuracy, and time per window of the feature builder and of predict.
+ * The models, feature builders and registry are the firmware sources, so each model sees the same window.
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_registry.c -o eval_registry.out -lm && ./eval_registry.out ../data/[a-z]*.csv
+ *   ./eval_registry.out --model rf_perf_25_6 ../data/[a-z]*.csv
+ *
+ * The CSV rows are windows of 100 samples already, so model_resample_window() is not involved
+ * (and model_resample_selected() only picks the values of the selected-input model).
+ * Times are for the portable C code on the host.
+ */
+#include "bench_data.h"
+
+#include "../../Firmware/Core/Src/mlp_model.c"
+#include "../../Firmware/Core/Src/mlp_small_model.c"
+#include "../../Firmware/Core/Src/mlp_select_model.c"
+#include "../../Firmware/Core/Src/mlp_scaler.c"
+#include "../../Firmware/Core/Src/gru_model.c"
+#include "../../Firmware/Core/Src/rf_model.c"
+#include "../../Firmware/Core/Src/rf_small_model.c"
+#include "../../Firmware/Core/Src/rf_flat_model.c"
+#include "../../Firmware/Core/Src/rf_small_flat_model.c"
+#include "../../Firmware/Core/Src/model_registry.c"
+
+#include <stdio.h>
+
+// Mean per-class recall of predictions
+static double
+balanced_accuracy(const int32_t *labels, const int32_t *predicted, int32_t n)
+{
+    int32_t support[MODEL_N_CLASSES] = { 0 };
+    int32_t hits[MODEL_N_CLASSES] = { 0 };
+    for (int32_t r = 0; r < n; r++) {
+        support[labels[r]] += 1;
+        hits[labels[r]] += (predicted[r] == labels[r]);
+    }
+    double recall_sum = 0.0;
+    int present = 0;
+    for (int c = 0; c < MODEL_N_CLASSES; c++) {
+        if (support[c] > 0) {
+            recall_sum += (double)hits[c] / support[c];
+            present += 1;
+        }
+    }
+    return present ? recall_sum / present : 0.0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int32_t only = -1;
+    if (argc > 2 && strcmp(argv[1], "--model") == 0) {
+        only = model_find(argv[2]);
+        if (only < 0) {
+            fprintf(stderr, "Unknown model %s. Models:", argv[2]);
+            for (int32_t id = 0; id < ModelIds; id++) {
+                fprintf(stderr, " %s", model_registry[id].name);
+            }
+            fprintf(stderr, "\n");
+            return 1;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc - 1 != MODEL_N_CLASSES) {
+        fprintf(stderr, "Usage: %s [--model NAME] DATA.csv... (%d files, one per class)\n", argv[0], MODEL_N_CLASSES);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, MODEL_N_CLASSES) != 0) {
+        return 1;
+    }
+    if (data.n_features != (int32_t)MODEL_WINDOW_LENGTH) {
+        fprintf(stderr, "Data has %d features, models take %d\n", data.n_features, (int)MODEL_WINDOW_LENGTH);
+        return 1;
+    }
+#if EML_NET_X86
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+    const int32_t failed = model_check_all();
+    if (failed >= 0) {
+        fprintf(stderr, "Model %s failed validation\n", model_registry[failed].name);
+        return 1;
+    }
+
+    const int32_t n = data.n_samples;
+    int32_t *predicted = (int32_t *)malloc(sizeof(int32_t) * n);
+    static float features[MODEL_FEATURES_MAX_SIZE / sizeof(float)];
+
+    printf("%d windows\n", n);
+    printf("model                    accuracy  balanced  features_ns  predict_ns  features_bytes  workspace_bytes\n");
+    for (int32_t id = 0; id < ModelIds; id++) {
+        if (only >= 0 && id != only) {
+            continue;
+        }
+        const ModelDescriptor *model = model_get(id);
+        uint64_t build_ns = 0;
+        uint64_t predict_ns = 0;
+        int32_t correct = 0;
+        for (int32_t r = 0; r < n; r++) {
+            const float *window = data.values + (size_t)r * data.n_features;
+            const uint64_t start = bench_now_ns();
+            model->build_features(window, features);
+            const uint64_t built = bench_now_ns();
+            predicted[r] = model->predict(features, NULL, NULL);
+            predict_ns += bench_now_ns() - built;
+            build_ns += built - start;
+            correct += (predicted[r] == data.labels[r]);
+        }
+        printf("%-24s %8.4f  %8.4f  %11.1f  %10.1f  %14d  %15d\n", model->name,
+            (double)correct / n, balanced_accuracy(data.labels, predicted, n),
+            (double)build_ns / n, (double)predict_ns / n, model->features_size,
+            model->workspace_size ? model->workspace_size() : 0);
+    }
+
+    free(predicted);
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Per-layer input sparsity of an exported EmlNet model over the recorded gestures,
+ * and the time of the dense vs the sparse-input kernel (EmlNetLayerDenseSparseInput)
+ * on the recorded activations.
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_sparsity.c -o eval_sparsity.out -lm && ./eval_sparsity.out ../../Data/data_set/[a-z]*.csv
+ *
+ * Kernels are timed with the portable C code that runs on the target.
+ * See bench_model.h for selecting other models.
+ */
+#include "bench_model.h"
+
+#include <stdio.h>
+
+#define MAX_LAYERS 8
+#define MAX_WIDTH 1024
+
+// Zero inputs seen by one layer
+typedef struct _SparsityCounter {
+    int64_t zeros;
+    int64_t total;
+    int32_t min_zeros;  // fewest zero inputs in one window
+    int32_t max_zeros;  // most zero inputs in one window
+} SparsityCounter;
+
+static void
+sparsity_count(SparsityCounter *counter, const float *in, int32_t length)
+{
+    int32_t zeros = 0;
+    for (int32_t i = 0; i < length; i++) {
+        zeros += (in[i] == 0.0f);
+    }
+    if (counter->total == 0 || zeros < counter->min_zeros) {
+        counter->min_zeros = zeros;
+    }
+    if (counter->total == 0 || zeros > counter->max_zeros) {
+        counter->max_zeros = zeros;
+    }
+    counter->zeros += zeros;
+    counter->total += length;
+}
+
+// ns per call of layer over the recorded inputs of all windows
+static double
+time_layer(const EmlNetLayer *layer, const float *inputs, int32_t n_windows, void *scratch, int32_t scratch_length)
+{
+    float out[MAX_WIDTH];
+    const uint64_t start = bench_now_ns();
+    for (int32_t r = 0; r < n_windows; r++) {
+        eml_net_layer_forward_scratch(layer, inputs + (size_t)r * layer->n_inputs, layer->n_inputs,
+            out, layer->n_outputs, scratch, scratch_length);
+        bench_sink = out[0];
+    }
+    return (double)(bench_now_ns() - start) / n_windows;
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s DATA.csv...\n", argv[0]);
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, argc - 1) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+#if EML_NET_X86
+    eml_net_x86_select(EmlNetX86Scalar);
+#endif
+
+    const EmlNet *model = &MODEL;
+    int32_t widest = 0;
+    for (int l = 0; l < model->n_layers && l < MAX_LAYERS; l++) {
+        widest = (model->layers[l].n_outputs > widest) ? model->layers[l].n_outputs : widest;
+    }
+    if (model->n_layers > MAX_LAYERS || widest > MAX_WIDTH) {
+        fprintf(stderr, "Model too large for this tool\n");
+        return 1;
+    }
+
+    // Inputs of every layer after the first, for all windows, to time the kernels on real activations
+    float *layer_inputs[MAX_LAYERS] = { NULL };
+    for (int l = 1; l < model->n_layers; l++) {
+        layer_inputs[l] = (float *)malloc(sizeof(float) * (size_t)data.n_samples * model->layers[l].n_inputs);
+    }
+    static int32_t scratch[MAX_WIDTH * 2];
+    SparsityCounter counters[MAX_LAYERS];
+    memset(counters, 0, sizeof(counters));
+
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        const float *in = data.values + (size_t)r * data.n_features;
+        float activations[2][MAX_WIDTH];
+        for (int l = 0; l < model->n_layers; l++) {
+            const EmlNetLayer *layer = &model->layers[l];
+            sparsity_count(&counters[l], in, layer->n_inputs);
+            if (l > 0) {
+                memcpy(layer_inputs[l] + (size_t)r * layer->n_inputs, in, sizeof(float) * layer->n_inputs);
+            }
+            float *out = activations[l % 2];
+            const EmlError err = eml_net_layer_forward_scratch(layer, in, layer->n_inputs,
+                                    out, layer->n_outputs, scratch, sizeof(scratch));
+            if (err != EmlOk) {
+                fprintf(stderr, "Layer %d failed: %s\n", l, eml_error_str(err));
+                return 1;
+            }
+            in = out;
+        }
+    }
+
+    printf("%d windows\n", data.n_samples);
+    printf("layer  inputs  zero inputs (mean/min/max)      dense ns  sparse_input ns\n");
+    for (int l = 0; l < model->n_layers; l++) {
+        const EmlNetLayer *layer = &model->layers[l];
+        const SparsityCounter *c = &counters[l];
+        printf("%5d  %6d  %5.1f%% %4d %4d",
+            l, layer->n_inputs, 100.0 * (double)c->zeros / (double)c->total, c->min_zeros, c->max_zeros);
+
+        // Only layers fed by a ReLU, with the input-major weights both kernels read
+        const bool from_relu = (l > 0) && model->layers[l-1].activation == EmlNetActivationRelu;
+        if (from_relu && (layer->type == EmlNetLayerDense || layer->type == EmlNetLayerDenseSparseInput)) {
+            EmlNetLayer dense = *layer;
+            dense.type = EmlNetLayerDense;
+            EmlNetLayer sparse = *layer;
+            sparse.type = EmlNetLayerDenseSparseInput;
+            const double dense_ns = time_layer(&dense, layer_inputs[l], data.n_samples, scratch, sizeof(scratch));
+            const double sparse_ns = time_layer(&sparse, layer_inputs[l], data.n_samples, scratch, sizeof(scratch));
+            printf("  %12.1f  %15.1f", dense_ns, sparse_ns);
+        }
+        printf("\n");
+    }
+
+    for (int l = 1; l < model->n_layers; l++) {
+        free(layer_inputs[l]);
+    }
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Multi-threaded host evaluation of an exported EmlNet model over recorded gestures.
+ * All threads share the const model (weights are not copied), each with its own workspace
+ * for eml_net_predict_workspace(). Reports throughput for 1..N threads,
+ * and checks that predictions match the single-threaded eml_net_predict().
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -pthread -I../../Firmware/Core/Inc eval_threads.c -o eval_threads.out -lm && ./eval_threads.out 8 ../data/[a-z]*.csv
+ *
+ * See bench_model.h for selecting other models.
+ */
+#include "bench_model.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+// Passes over the dataset per measurement, so short runs are not dominated by thread startup
+#define PASSES 20
+
+typedef struct _EvalThread {
+    pthread_t thread;
+    const BenchDataset *data;
+    int32_t start;      // first window
+    int32_t end;        // one past last window
+    int32_t *predictions;
+    int error;
+} EvalThread;
+
+static void *
+eval_thread_run(void *arg)
+{
+    EvalThread *self = (EvalThread *)arg;
+    const EmlNet *model = &MODEL;
+
+    const int32_t workspace_length = eml_net_workspace_size(model);
+    float *workspace = (float *)malloc((size_t)workspace_length);
+
+    for (int p = 0; p < PASSES; p++) {
+        for (int32_t r = self->start; r < self->end; r++) {
+            const float *values = self->data->values + (size_t)r * self->data->n_features;
+            const int32_t pred = eml_net_predict_workspace(model, values, self->data->n_features,
+                                    workspace, workspace_length);
+            if (pred < 0) {
+                self->error = -pred;
+            }
+            self->predictions[r] = pred;
+        }
+    }
+
+    free(workspace);
+    return NULL;
+}
+
+// Split the windows evenly over n_threads, and wait for all. Returns ns per window
+static double
+eval_parallel(const BenchDataset *data, int n_threads, int32_t *predictions)
+{
+    EvalThread threads[n_threads];
+    const uint64_t start = bench_now_ns();
+    for (int t = 0; t < n_threads; t++) {
+        EvalThread *thread = &threads[t];
+        thread->data = data;
+        thread->start = (int32_t)(((int64_t)data->n_samples * t) / n_threads);
+        thread->end = (int32_t)(((int64_t)data->n_samples * (t + 1)) / n_threads);
+        thread->predictions = predictions;
+        thread->error = 0;
+        pthread_create(&thread->thread, NULL, eval_thread_run, thread);
+    }
+    for (int t = 0; t < n_threads; t++) {
+        pthread_join(threads[t].thread, NULL);
+        if (threads[t].error) {
+            fprintf(stderr, "Inference failed in thread %d: %d\n", t, threads[t].error);
+        }
+    }
+    return (double)(bench_now_ns() - start) / ((double)data->n_samples * PASSES);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s MAX_THREADS DATA.csv...\n", argv[0]);
+        return 1;
+    }
+    const int max_threads = atoi(argv[1]);
+    if (max_threads < 1) {
+        fprintf(stderr, "MAX_THREADS must be at least 1\n");
+        return 1;
+    }
+
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 2, argc - 2) != 0) {
+        return 1;
+    }
+    if (bench_model_prepare(&data) != 0) {
+        return 1;
+    }
+    printf("%d windows, workspace %d bytes per thread\n",
+        data.n_samples, eml_net_workspace_size(&MODEL));
+
+    int32_t *reference = (int32_t *)malloc(sizeof(int32_t) * (size_t)data.n_samples);
+    int32_t *predictions = (int32_t *)malloc(sizeof(int32_t) * (size_t)data.n_samples);
+    int32_t correct = 0;
+    for (int32_t r = 0; r < data.n_samples; r++) {
+        reference[r] = BENCH_MODEL_PREDICT(data.values + (size_t)r * data.n_features, data.n_features);
+        correct += (reference[r] == data.labels[r]);
+    }
+    printf("accuracy %.4f\n", (double)correct / data.n_samples);
+
+    double single_ns = 0.0;
+    for (int n_threads = 1; n_threads <= max_threads; n_threads *= 2) {
+        const double ns = eval_parallel(&data, n_threads, predictions);
+        if (n_threads == 1) {
+            single_ns = ns;
+        }
+        int32_t agree = 0;
+        for (int32_t r = 0; r < data.n_samples; r++) {
+            agree += (predictions[r] == reference[r]);
+        }
+        printf("%3d threads %9.1f ns/window  speedup %.2fx  agree %d/%d\n",
+            n_threads, ns, single_ns / ns, agree, data.n_samples);
+    }
+
+    free(predictions);
+    free(reference);
+    bench_free_dataset(&data);
+    return 0;
+}
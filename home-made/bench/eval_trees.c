@@ -0,0 +1,116 @@
+/*
+ * The random forests as emlearn-generated if/else code against the same forests as node tables
+ * for the iterative traversal of eml_trees.h (eml_export.py --trees), over the recorded gestures:
+ * whether the vote fractions are identical, time per window, and the size of the node tables.
+ *
+ * Build and run from home-made/bench, with the CSVs in sorted order (labels are file indices):
+ *   gcc -O2 -I../../Firmware/Core/Inc eval_trees.c -o eval_trees.out -lm && ./eval_trees.out ../data/[a-z]*.csv
+ *
+ * Features are the window rounded to int16, like model_build_int16() in model_registry.c.
+ * Flash of each version is the .text + .rodata of its own object, for example with arm-none-eabi-gcc:
+ *   arm-none-eabi-gcc -Os -mcpu=cortex-m4 -mthumb -I../../Firmware/Core/Inc -c ../../Firmware/Core/Src/rf_model.c
+ *   arm-none-eabi-gcc -Os -mcpu=cortex-m4 -mthumb -I../../Firmware/Core/Inc -c ../../Firmware/Core/Src/rf_flat_model.c
+ *   arm-none-eabi-size -A rf_model.o rf_flat_model.o
+ */
+#include "bench_data.h"
+
+#include "../../Firmware/Core/Src/rf_model.c"
+#include "../../Firmware/Core/Src/rf_small_model.c"
+#include "../../Firmware/Core/Src/rf_flat_model.c"
+#include "../../Firmware/Core/Src/rf_small_flat_model.c"
+
+#include <math.h>
+#include <stdio.h>
+
+#define N_CLASSES 6
+#define REPEATS 20
+
+typedef int (*PredictProba)(const int16_t *features, int32_t features_length, float *out, int out_length);
+
+typedef struct _ForestPair {
+    const char *name;
+    PredictProba generated;
+    PredictProba flat;
+    const EmlTrees *trees;
+} ForestPair;
+
+static const ForestPair forests[] = {
+    { "rf_perf_25_6", rf_perf_25_6_predict_proba, rf_perf_25_6_flat_predict_proba, &rf_perf_25_6_flat },
+    { "rf_wt_2_6", rf_wt_2_6_predict_proba, rf_wt_2_6_flat_predict_proba, &rf_wt_2_6_flat },
+};
+
+// Time per window of predict_proba over all windows, REPEATS times. Returns ns per window
+static double
+time_forest(PredictProba predict, const int16_t *features, int32_t n, int32_t n_features, int32_t *correct,
+            const int32_t *labels)
+{
+    float out[N_CLASSES];
+    *correct = 0;
+    const uint64_t start = bench_now_ns();
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+        for (int32_t r = 0; r < n; r++) {
+            predict(features + (size_t)r * n_features, n_features, out, N_CLASSES);
+            int32_t best = 0;
+            for (int32_t c = 1; c < N_CLASSES; c++) {
+                best = (out[c] > out[best]) ? c : best;
+            }
+            *correct += (repeat == 0 && best == labels[r]);
+        }
+    }
+    return (double)(bench_now_ns() - start) / ((double)n * REPEATS);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc - 1 != N_CLASSES) {
+        fprintf(stderr, "Usage: %s DATA.csv... (%d files, one per class)\n", argv[0], N_CLASSES);
+        return 1;
+    }
+    BenchDataset data;
+    if (bench_load_dataset(&data, argv + 1, N_CLASSES) != 0) {
+        return 1;
+    }
+    const int32_t n = data.n_samples;
+    const int32_t n_features = data.n_features;
+    int16_t *features = (int16_t *)malloc(sizeof(int16_t) * (size_t)n * n_features);
+    for (size_t i = 0; i < (size_t)n * n_features; i++) {
+        const float v = roundf(data.values[i]);
+        features[i] = (v >= 32767.0f) ? INT16_MAX : (v <= -32768.0f) ? INT16_MIN : (int16_t)v;
+    }
+
+    printf("%d windows\n", n);
+    printf("forest          nodes  table_bytes  mismatches  accuracy  generated_ns  flat_ns\n");
+    for (size_t f = 0; f < sizeof(forests) / sizeof(forests[0]); f++) {
+        const ForestPair *pair = &forests[f];
+        if (eml_trees_check(pair->trees) != EmlOk) {
+            fprintf(stderr, "%s: node tables failed validation\n", pair->name);
+            return 1;
+        }
+        int32_t mismatches = 0;
+        for (int32_t r = 0; r < n; r++) {
+            float expected[N_CLASSES];
+            float actual[N_CLASSES];
+            pair->generated(features + (size_t)r * n_features, n_features, expected, N_CLASSES);
+            pair->flat(features + (size_t)r * n_features, n_features, actual, N_CLASSES);
+            mismatches += (memcmp(expected, actual, sizeof(expected)) != 0);
+        }
+        int32_t correct_generated = 0;
+        int32_t correct_flat = 0;
+        const double generated_ns = time_forest(pair->generated, features, n, n_features, &correct_generated,
+                                                data.labels);
+        const double flat_ns = time_forest(pair->flat, features, n, n_features, &correct_flat, data.labels);
+        const int32_t table_bytes = pair->trees->n_nodes * (int32_t)(sizeof(uint16_t) + 3 * sizeof(int16_t))
+                                    + pair->trees->n_trees * (int32_t)sizeof(int16_t);
+        printf("%-14s %6d  %11d  %10d  %8.4f  %12.1f  %7.1f\n", pair->name, pair->trees->n_nodes, table_bytes,
+            mismatches, (double)correct_flat / n, generated_ns, flat_ns);
+        if (correct_flat != correct_generated) {
+            fprintf(stderr, "%s: accuracy differs, generated %d, flat %d correct\n", pair->name,
+                    correct_generated, correct_flat);
+        }
+    }
+
+    free(features);
+    bench_free_dataset(&data);
+    return 0;
+}
@@ -0,0 +1,129 @@
+"""
+Sweep compression options of eml_export.py against balanced accuracy,
+cost and time per inference on the recorded gestures:
+the rank of a low-rank factorized layer 0 (--low-rank), the density of a pruned csr layer 0 (--density),
+and other weight layouts of layer 0, like codebook or int8.
+
+Each variant is exported with the scaler folded in, built with eval_accuracy.c
+and run over home-made/data. Time is for the portable C kernels on the host.
+For cycles on the target, export the chosen variant to Firmware/Core/Src/mlp_model.c
+and read the cycle count that main.c reports per classification.
+
+Run from home-made/bench:
+    python3 sweep_export.py --ranks 2,4,8,16
+    python3 sweep_export.py --densities 0.5,0.25,0.1
+    python3 sweep_export.py --layer0-layouts codebook,codebook_per_output,int8
+    python3 sweep_export.py --layer0-layouts binary,ternary --baselines ../builds/mlp_wt__8___1e_05.c
+"""
+import argparse
+import re
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+import numpy as np
+
+HERE = Path(__file__).resolve().parent
+sys.path.insert(0, str(HERE.parent))
+
+from eml_export import (export_mlp, factorize_low_rank, load_emlearn_c, load_scaler_c,  # noqa: E402
+                        MLPWeights, prune_magnitude)
+
+
+def evaluate(model_c, name, data_paths, workdir):
+    """Build eval_accuracy.c for model_c and run it. Returns dict of the reported values"""
+    exe = Path(workdir) / f"{name}.out"
+    subprocess.run(['gcc', '-O2', '-I', str(HERE.parent.parent / 'Firmware/Core/Inc'),
+                    f'-DMODEL_C="{model_c}"', f'-DMODEL={name}', '-DNO_SCALER',
+                    str(HERE / 'eval_accuracy.c'), '-o', str(exe), '-lm'], check=True)
+    out = subprocess.run([str(exe)] + [str(p) for p in data_paths],
+                         check=True, capture_output=True, text=True).stdout
+    return {k: float(v) for k, v in re.findall(r'^(\w+) ([\d.]+)$', out, flags=re.M)}
+
+
+# Layouts with other than float weights, besides csr and codebook
+BYTES_PER_WEIGHT = {'int8': 1, 'q15': 2, 'float16': 2}
+
+
+def model_cost(model, layouts):
+    """
+    Operations per inference, and bytes of weights and biases (thresholds and scales included).
+    Operations are multiply-adds, csr layers count only the kept weights,
+    and binary layers count one per 32-wide XNOR-popcount
+    """
+    macs = 0
+    size = 0
+    for w, b, lay in zip(model.coefs_, model.intercepts_, layouts):
+        if lay == 'csr':
+            kept = int(np.count_nonzero(w))
+            macs += kept
+            size += kept * (4 + 2) + (w.shape[1] + 1) * 2
+        elif lay in ('codebook', 'codebook_per_output'):
+            macs += w.size
+            n_codebooks = w.shape[1] if lay == 'codebook_per_output' else 1
+            size += w.shape[1] * ((w.shape[0] + 1) // 2) + n_codebooks * 16 * 4
+        elif lay in ('binary', 'ternary'):
+            words = w.shape[1] * ((w.shape[0] + 31) // 32)
+            macs += words
+            size += words * 4 * (2 if lay == 'ternary' else 1) + (w.shape[0] + w.shape[1]) * 4
+        elif lay in BYTES_PER_WEIGHT:
+            macs += w.size
+            size += w.size * BYTES_PER_WEIGHT[lay] + (w.shape[1] * 4 if lay in ('int8', 'q15') else 0)
+        else:
+            macs += w.size
+            size += w.size * 4
+        size += len(b) * 4
+    return macs, size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--model', default=str(HERE.parent / 'builds/mlp_perf__32_32__1e_05.c'))
+    parser.add_argument('--scaler', default=str(HERE.parent.parent / 'Firmware/Core/Src/mlp_scaler.c'))
+    parser.add_argument('--data', default=str(HERE.parent / 'data'))
+    parser.add_argument('--ranks', default='', help='comma-separated ranks for layer 0')
+    parser.add_argument('--densities', default='', help='comma-separated densities for a csr layer 0')
+    parser.add_argument('--layer0-layouts', default='', help='comma-separated layouts for layer 0')
+    parser.add_argument('--layout', default='dense', help='layout of the other layers, see eml_export.py')
+    parser.add_argument('--baselines', default='',
+                        help='comma-separated emlearn C files of other models to compare, exported as they are')
+    args = parser.parse_args()
+    if not args.ranks and not args.densities and not args.layer0_layouts:
+        args.ranks = '1,2,4,6,8,12,16,24'
+
+    base = load_emlearn_c(args.model)
+    scaler = load_scaler_c(args.scaler)
+    data_paths = sorted(Path(args.data).glob('[a-z]*.csv'))
+    n_layers = len(base.coefs_)
+
+    # (label, model, layouts), the uncompressed model first
+    variants = [('full', base, [args.layout] * n_layers)]
+    for rank in [int(r) for r in args.ranks.split(',') if r]:
+        variants.append((f"rank {rank}", factorize_low_rank(base, rank), [args.layout] * (n_layers + 1)))
+    for density in [float(d) for d in args.densities.split(',') if d]:
+        pruned = [prune_magnitude(base.coefs_[0], density)] + base.coefs_[1:]
+        model = MLPWeights(pruned, base.intercepts_, activation=base.activation,
+                           out_activation=base.out_activation_, layer_activations=base.layer_activations_)
+        variants.append((f"csr {density:g}", model, ['csr'] + [args.layout] * (n_layers - 1)))
+    for layout in [lay for lay in args.layer0_layouts.split(',') if lay]:
+        variants.append((layout, base, [layout] + [args.layout] * (n_layers - 1)))
+    for path in [p for p in args.baselines.split(',') if p]:
+        other = load_emlearn_c(path)
+        variants.append((Path(path).stem[:19], other, [args.layout] * len(other.coefs_)))
+
+    print(f"{'variant':>19} {'ops':>7} {'bytes':>7} {'balanced_acc':>12} {'accuracy':>9} {'ns/inference':>12}")
+    with tempfile.TemporaryDirectory() as workdir:
+        for idx, (label, model, layouts) in enumerate(variants):
+            name = f"variant_{idx}"
+            model_c = Path(workdir) / f"{name}.c"
+            model_c.write_text(export_mlp(model, name, layout=layouts, scaler=scaler))
+
+            result = evaluate(model_c, name, data_paths, workdir)
+            macs, size = model_cost(model, layouts)
+            print(f"{label:>19} {macs:>7} {size:>7} {result['balanced_accuracy']:>12.4f} "
+                  f"{result['accuracy']:>9.4f} {result['ns_per_window']:>12.1f}")
+
+
+if __name__ == '__main__':
+    main()
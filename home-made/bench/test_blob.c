@@ -0,0 +1,139 @@
+/*
+ * Malformed blobs (eml_net_blob.h) must fail to load, even when their CRC is right:
+ * csr layers whose row offsets or columns would make eml_net_dense_csr() read or write out of bounds.
+ * Also the same checks on a csr layer built by hand, and that a well-formed blob loads and runs.
+ *
+ * Build and run from home-made/bench, exits non-zero on the first failure:
+ *   gcc -O2 -Wall -I../../Firmware/Core/Inc test_blob.c -o test_blob.out -lm && ./test_blob.out
+ */
+#include "eml_net_blob.h"
+
+#include <stdio.h>
+
+#define N_INPUTS 4
+#define N_OUTPUTS 3
+#define MAX_VALUES 8
+
+// Blob offsets, each a multiple of EML_NET_BLOB_ALIGN
+#define OFFSET_LAYER 64
+#define OFFSET_VALUES 128
+#define OFFSET_COLUMNS 176
+#define OFFSET_ROW_OFFSETS 208
+#define OFFSET_BIASES 224
+#define BLOB_SIZE 240
+
+static int failures = 0;
+
+static void
+expect(const char *what, EmlError actual, EmlError expected)
+{
+    const bool ok = actual == expected;
+    printf("%-40s %-16s %s\n", what, eml_error_str(actual), ok ? "ok" : "FAIL");
+    failures += !ok;
+}
+
+// One csr layer with n_values weights of 1.0, biases 0.5, and a correct CRC
+static int32_t
+build_csr_blob(uint32_t *storage, const uint16_t *columns, const uint16_t *row_offsets, int32_t n_values)
+{
+    uint8_t *blob = (uint8_t *)storage;
+    memset(blob, 0, BLOB_SIZE);
+
+    EmlNetBlobLayer layer;
+    memset(&layer, 0, sizeof(layer));
+    layer.type = EmlNetLayerDenseCsr;
+    layer.activation = EmlNetActivationIdentity;
+    layer.n_inputs = N_INPUTS;
+    layer.n_outputs = N_OUTPUTS;
+    layer.biases = OFFSET_BIASES;
+    layer.arrays[0] = OFFSET_VALUES;
+    layer.arrays[1] = OFFSET_COLUMNS;
+    layer.arrays[2] = OFFSET_ROW_OFFSETS;
+    layer.values[0] = n_values;
+    memcpy(blob + OFFSET_LAYER, &layer, sizeof(layer));
+
+    for (int32_t k = 0; k < n_values; k++) {
+        const float one = 1.0f;
+        memcpy(blob + OFFSET_VALUES + k * sizeof(float), &one, sizeof(float));
+    }
+    memcpy(blob + OFFSET_COLUMNS, columns, n_values * sizeof(uint16_t));
+    memcpy(blob + OFFSET_ROW_OFFSETS, row_offsets, (N_OUTPUTS + 1) * sizeof(uint16_t));
+    for (int32_t o = 0; o < N_OUTPUTS; o++) {
+        const float half = 0.5f;
+        memcpy(blob + OFFSET_BIASES + o * sizeof(float), &half, sizeof(float));
+    }
+
+    EmlNetBlobHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = EML_NET_BLOB_MAGIC;
+    header.version = EML_NET_BLOB_VERSION;
+    header.header_size = sizeof(EmlNetBlobHeader);
+    header.total_size = BLOB_SIZE;
+    header.n_layers = 1;
+    header.n_inputs = N_INPUTS;
+    header.n_outputs = N_OUTPUTS;
+    header.layers = OFFSET_LAYER;
+    header.crc32 = eml_net_blob_crc32(blob + sizeof(header), BLOB_SIZE - sizeof(header));
+    memcpy(blob, &header, sizeof(header));
+    return BLOB_SIZE;
+}
+
+int
+main(void)
+{
+    static uint32_t storage[BLOB_SIZE / sizeof(uint32_t)];
+    EmlNetBlobModel model;
+
+    // Output 0 reads inputs 0 and 2, output 1 input 1, output 2 inputs 0, 1 and 3
+    const uint16_t columns[] = { 0, 2, 1, 0, 1, 3 };
+    const uint16_t row_offsets[] = { 0, 2, 3, 6 };
+    int32_t size = build_csr_blob(storage, columns, row_offsets, 6);
+    expect("well-formed", eml_net_blob_load(storage, size, &model), EmlOk);
+
+    const float in[N_INPUTS] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const float expected[N_OUTPUTS] = { 4.5f, 2.5f, 7.5f };
+    float out[N_OUTPUTS];
+    expect("well-formed, forward",
+        eml_net_layer_forward(&model.layers[0], in, N_INPUTS, out, N_OUTPUTS), EmlOk);
+    for (int32_t o = 0; o < N_OUTPUTS; o++) {
+        if (out[o] != expected[o]) {
+            printf("output %d is %f, expected %f FAIL\n", o, (double)out[o], (double)expected[o]);
+            failures += 1;
+        }
+    }
+
+    const uint16_t decreasing[] = { 0, 4, 3, 6 };
+    size = build_csr_blob(storage, columns, decreasing, 6);
+    expect("row offsets decreasing", eml_net_blob_load(storage, size, &model), EmlSizeMismatch);
+
+    // Arrays sized for 4 weights, rows reaching 6
+    size = build_csr_blob(storage, columns, row_offsets, 4);
+    expect("row offsets past n_values", eml_net_blob_load(storage, size, &model), EmlSizeMismatch);
+
+    const uint16_t first_nonzero[] = { 1, 2, 3, 6 };
+    size = build_csr_blob(storage, columns, first_nonzero, 6);
+    expect("row offsets not starting at 0", eml_net_blob_load(storage, size, &model), EmlSizeMismatch);
+
+    const uint16_t column_out_of_range[] = { 0, 2, 1, 0, 1, 4 };
+    size = build_csr_blob(storage, column_out_of_range, row_offsets, 6);
+    expect("column past n_inputs", eml_net_blob_load(storage, size, &model), EmlSizeMismatch);
+
+    // Not in the blob format, but the loader must still refuse a negative count
+    size = build_csr_blob(storage, columns, row_offsets, 0);
+    ((EmlNetBlobLayer *)((uint8_t *)storage + OFFSET_LAYER))->values[0] = -1;
+    ((EmlNetBlobHeader *)storage)->crc32 = eml_net_blob_crc32((const uint8_t *)storage + sizeof(EmlNetBlobHeader),
+        BLOB_SIZE - sizeof(EmlNetBlobHeader));
+    expect("negative n_values", eml_net_blob_load(storage, size, &model), EmlSizeMismatch);
+
+    // Built by hand, without a blob
+    const float values[] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    const float biases[N_OUTPUTS] = { 0.5f, 0.5f, 0.5f };
+    const EmlNetCsrWeights bad_params = { values, column_out_of_range, row_offsets, 6 };
+    const EmlNetLayer bad_layer = { N_OUTPUTS, N_INPUTS, NULL, biases,
+        EmlNetActivationIdentity, EmlNetLayerDenseCsr, &bad_params };
+    expect("by hand, column past n_inputs",
+        eml_net_layer_forward(&bad_layer, in, N_INPUTS, out, N_OUTPUTS), EmlSizeMismatch);
+
+    printf("%s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
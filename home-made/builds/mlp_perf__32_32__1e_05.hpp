@@ -0,0 +1,20 @@
+#pragma once
+#include <eml_net.hpp>
+
+namespace mlp_perf_cpp {
+
+inline constexpr float layer_0_weights[19200] = { 0.009608f, 0.033139f, 0.031436f, 0.018337f, -0.004274f, 0.015602f, -0.001902f, 0.089969f, 0.102373f, -0.01354f, 0.057626f, 0.005504f, -0.000805f, 0.095716f, -0.100792f, -0.097777f, -0.106161f, 0.052608f, 0.057563f, 0.070983f, 0.085353f, 0.076057f, 0.009595f, 0.045017f, -0.074149f, 0.044016f, -0.079899f, 0.104976f, -0.007506f, -0.026949f, -0.035841f, 0.066346f, -0.011704f, 0.023776f, -0.091698f, 0.029882f, 0.03498f, 0.03808f, 0.074877f, 0.052109f, -0.024379f, -0.008467f, 0.036557f, -0.096374f, 0.01854f, 0.028414f, -0.047812f, -0.064942f, -0.049078f, -0.010127f, 0.025227f, -0.026344f, 0.11033f, -0.089822f, -0.039437f, -0.07644f, 0.029886f, -0.035591f, -0.000609f, -0.052375f, -0.082927f, -0.062641f, 0.039208f, -0.081777f, -0.056908f, -0.009896f, 0.050999f, -0.082453f, 0.058076f, -0.068492f, 0.084265f, -0.018028f, 0.085928f, 0.003709f, 0.055763f, -0.071817f, -0.029428f, -0.084724f, -0.025289f, -0.068568f, -0.020024f, -0.007753f, -0.089956f, 0.02835f, 0.020045f, -0.063068f, 0.000172f, -0.065375f, 0.012918f, 0.068432f, -0.02387f, 0.020927f, -0.058817f, 0.047235f, -0.041183f, -0.075463f, 0.015714f, -0.080301f, 0.058943f, -0.083836f, 0.024813f, -0.032779f, 0.03091f, 0.107903f, -0.050923f, 0.001773f, 0.033133f, 0.008524f, -0.045752f, 0.085783f, -0.001999f, 0.079499f, 0.029478f, -0.024841f, 0.074402f, -0.034273f, 0.086292f, 0.007303f, 0.091354f, 0.027039f, 0.042886f, 0.011263f, 0.091164f, 0.036833f, -0.032364f, 0.0286f, -0.093985f, -0.04753f, 0.023592f, -0.057672f, 0.015773f, -0.025337f, -0.079388f, -0.025913f, 0.002689f, 0.006087f, 0.00367f, 0.046593f, 0.024335f, -0.028384f, 0.089807f, -0.028891f, -0.021624f, 0.091852f, 0.061521f, 0.053189f, -0.069443f, 0.090019f, 0.046357f, 0.112399f, -0.085674f, 0.060704f, -0.065594f, 0.028206f, -0.062401f, 0.049714f, 0.047363f, 0.020759f, -0.014108f, -0.092235f, 0.031936f, -0.026501f, 0.053362f, 0.054804f, 0.110041f, 0.082956f, -0.098664f, -0.039787f, 0.040457f, -0.048412f, -0.013672f, -0.101447f, -0.042893f, -0.095396f, 0.044354f, -0.063671f, -0.041853f, 0.092878f, 0.021822f, -0.091195f, -0.071393f, 0.018611f, -0.002043f, -0.039368f, 0.082481f, 0.032552f, 0.022202f, 0.000287f, 0.028093f, -0.02132f, -0.022239f, -0.062423f, -0.061466f, 0.081332f, 0.058215f, 0.007803f, -0.0411f, -0.060862f, -0.075788f, 0.0008f, -0.024718f, 0.044341f, -0.022169f, -0.059566f, -0.106378f, -0.071783f, 0.01753f, -0.026161f, -0.005372f, 0.064841f, 0.098785f, -0.057162f, 0.023758f, -0.028496f, -0.076253f, 0.043236f, -0.034816f, -0.005878f, 0.007057f, 0.082834f, 0.013772f, 0.062839f, -0.035134f, 0.070636f, -0.064096f, 0.098772f, 0.037822f, -0.048437f, 0.099798f, 0.060244f, -0.060318f, -0.03881f, 0.005991f, -0.088941f, -0.057908f, -0.02544f, -0.037554f, -0.011688f, -0.03485f, 0.025743f, 0.057815f, -0.057736f, 0.015029f, -0.086119f, 0.057463f, -0.032298f, 0.03007f, -0.072732f, -0.068762f, 0.010175f, -0.022404f, 0.083625f, 0.035141f, 0.061572f, 0.087248f, -0.09244f, 0.013251f, 0.032136f, 0.07818f, -0.045272f, -0.061913f, -0.067254f, -0.103011f, 0.071971f, 0.025154f, 0.039141f, -0.032585f, 0.034663f, -0.072423f, -0.013857f, 0.107776f, 0.084669f, -0.015957f, 0.099174f, -0.057313f, 0.080202f, 0.093653f, 0.040798f, 0.021051f, 0.08632f, -0.042404f, 0.052835f, 0.033944f, -0.107304f, -0.016774f, -0.06612f, 0.093527f, -0.017704f, -0.001774f, 0.040753f, -0.030641f, -0.057464f, 0.049405f, -0.049065f, -0.01264f, -0.035935f, -0.080597f, 0.056834f, 0.108406f, 0.087315f, 0.088248f, 0.051089f, -0.023845f, -0.069672f, -0.026596f, -0.038228f, -0.058053f, -0.101166f, 0.054285f, -0.10395f, 0.069484f, -0.07861f, -0.083089f, -0.069108f, 0.034091f, -0.038058f, -0.032966f, 0.01845f, 0.069081f, 0.036011f, -0.052713f, -0.088545f, -0.0915f, -0.050403f, -0.053898f, 0.004761f, 0.024649f, 0.02781f, -0.052702f, -0.006451f, -0.066288f, 0.040812f, -0.074178f, 0.037129f, 0.044691f, 0.069203f, -0.048157f, -0.011107f, 0.025502f, -0.035734f, -0.021867f, -0.042833f, -0.024764f, -0.099329f, 0.058606f, -0.075911f, 0.014645f, -0.055492f, 0.000803f, 0.096683f, 0.033663f, -0.09786f, -0.018458f, -0.01548f, 0.011205f, 0.019002f, -0.026272f, -0.058888f, -0.026412f, 0.076177f, -0.067132f, 0.094689f, -0.008977f, -0.023191f, 0.091089f, -0.009782f, 0.030985f, -0.024605f, 0.068918f, 0.047642f, 0.020625f, -0.030748f, 0.045535f, 0.026487f, -0.068107f, -0.060591f, 0.05423f, 0.098666f, 0.006217f, 0.000511f, 0.053021f, 0.005824f, 0.087266f, 0.00847f, 0.061898f, 0.079308f, 0.07309f, -0.056626f, 0.037731f, -0.032914f, -0.074813f, -0.001256f, -0.035141f, 0.070732f, -0.088266f, 0.094669f, -0.041714f, -0.015596f, -0.110223f, -0.078299f, -0.031559f, 0.070968f, -0.074811f, 0.08408f, 0.063912f, 0.008355f, -0.016584f, -0.055487f, 0.022583f, -0.074163f, -0.104361f, 0.004421f, -0.095099f, -0.057694f, -0.046394f, -0.035841f, -0.074498f, -0.084406f, -0.074089f, 0.030267f, 0.104553f, 0.110761f, -0.030619f, -0.048451f, 0.029063f, 0.000872f, 0.095613f, -0.095494f, 0.043162f, -0.045676f, -0.041658f, 0.041422f, -0.062557f, 0.049361f, 0.015114f, -0.029267f, 0.025863f, -0.053439f, 0.057602f, -0.027898f, -0.026426f, 0.076562f, 0.088304f, -0.090067f, -0.06877f, -0.016537f, 0.069673f, 0.083353f, 0.095433f, 0.094326f, -0.051707f, 0.090055f, -0.06201f, -0.065727f, 0.078997f, -0.063513f, 0.028241f, -0.101979f, 0.055121f, 0.091692f, -0.032068f, -0.034847f, -0.009424f, 0.064532f, -0.035386f, -0.054484f, -0.015298f, -0.039238f, 0.074068f, -0.068646f, -0.004042f, 0.099345f, 0.023898f, 0.056481f, 0.096571f, 0.035606f, 0.051817f, 0.09142f, 0.096577f, -0.022624f, -0.085047f, -0.026466f, -0.070196f, -0.002262f, -0.087825f, 0.03069f, -0.037447f, 0.094757f, 0.088661f, -0.00516f, -0.027036f, 0.021129f, 0.088798f, -0.020303f, 0.019201f, -0.032893f, -0.015937f, -0.006023f, -0.035242f, -0.013032f, -0.02972f, -0.033751f, 0.02122f, 0.039975f, -0.030578f, 0.093337f, 0.069032f, -0.07302f, -0.065052f, -0.003901f, -0.079175f, -0.036703f, 0.038534f, 0.018557f, 0.025218f, 0.029037f, -0.063945f, -0.017731f, 0.023163f, 0.065942f, -0.001512f, -0.025278f, -0.093829f, 0.025158f, -0.084548f, -0.02383f, -0.004117f, 0.096886f, -0.085206f, -0.00488f, -0.084197f, -0.021921f, 0.025067f, -0.026181f, -0.072848f, -0.08211f, 0.015038f, 0.045403f, 0.044553f, 0.070175f, -0.111873f, 0.035641f, 0.026062f, 0.011593f, 0.086721f, -0.111532f, 0.038983f, 0.045036f, 0.018147f, -0.019069f, 0.049875f, -0.091578f, -0.0187f, 0.020165f, 0.020511f, -0.094686f, -0.035651f, -0.019337f, 0.011564f, 0.082012f, 0.016336f, -0.059765f, 0.075121f, 0.077428f, -0.002477f, 0.089606f, -0.009688f, 0.080776f, 0.059457f, 0.098988f, 0.095381f, -0.107595f, -0.080077f, -0.008405f, 0.088884f, -0.045635f, -0.066929f, 0.080475f, 0.001137f, 0.089362f, -0.053608f, 0.018178f, -0.001213f, -0.068954f, 0.05009f, -0.049883f, -0.085599f, -0.078887f, -0.099091f, 0.091578f, 0.03965f, 0.060736f, 0.0215f, -0.00723f, -0.034471f, 0.09379f, -0.034807f, 0.011007f, -0.006524f, 0.094099f, -0.06314f, -0.016812f, 0.02526f, -0.066851f, 0.010398f, -0.013656f, -0.035264f, -0.03897f, 3.7e-05f, -0.014763f, -0.007068f, -0.023824f, 0.104014f, -0.05633f, -0.091398f, -0.013372f, 0.01974f, 0.031672f, -0.019118f, 0.086701f, -0.039695f, 0.038717f, 0.036858f, 0.070695f, 0.079707f, 0.093041f, 0.063401f, 0.024087f, -0.016949f, -0.080898f, -0.067856f, -0.061185f, -0.012103f, 0.01683f, 0.058676f, 0.088965f, -0.091401f, -0.063619f, 0.024921f, 0.036556f, 0.072863f, 0.09934f, 0.082073f, -0.026719f, -0.036974f, -0.057066f, 0.027113f, 0.01908f, 0.061202f, -0.09373f, 0.008828f, 0.028391f, -0.038158f, -0.075698f, 0.085495f, -0.068999f, 0.010125f, -0.065103f, -0.014809f, 0.094399f, -0.006604f, 0.052256f, -0.07897f, -0.031611f, -0.02098f, -0.034623f, 0.04439f, -0.044308f, 0.054329f, 0.026863f, -0.017892f, -0.026265f, 0.02056f, -0.069559f, 0.063238f, 0.044026f, 0.028148f, 0.015872f, -0.089889f, -0.001107f, -0.020914f, -0.049686f, -0.074706f, 0.058755f, -0.064443f, 0.018897f, 0.049313f, 0.035966f, 0.084003f, -0.065364f, 0.085328f, -0.10602f, 0.008168f, -0.028364f, 0.019993f, -0.033301f, -0.059307f, -0.083306f, 2.9e-05f, 0.084875f, -0.039223f, -0.048071f, -0.084964f, -0.085778f, -0.062847f, -0.094151f, -0.026871f, -0.096822f, -0.087917f, 0.081938f, -0.076916f, 0.005619f, 0.044452f, 0.008351f, -0.065939f, -0.07481f, -0.003816f, 0.009266f, -0.039599f, 0.068313f, 0.039959f, 0.096427f, -0.083301f, 0.085845f, -0.023477f, 0.090883f, 0.021785f, 0.095375f, 0.048237f, -0.018164f, 0.011575f, -0.039785f, -0.04107f, -0.038751f, 0.00648f, 0.033078f, -0.04702f, -0.012627f, -0.075867f, -0.082291f, -0.075134f, 0.104918f, -0.104272f, -0.075767f, 0.013869f, -0.065053f, 0.057349f, 0.027764f, 0.108517f, -0.00035f, -0.050976f, 0.021802f, 0.080169f, 0.016534f, -0.064001f, 0.080027f, -0.026697f, -0.086157f, -0.067116f, -0.040739f, 0.064942f, -0.001907f, 0.002233f, -0.049093f, 0.057369f, 0.10024f, 0.098067f, -0.031062f, 0.090051f, 0.065503f, 0.045751f, -0.039695f, -0.04283f, -0.078331f, 0.092807f, -0.026531f, 0.002592f, -0.004391f, 0.059368f, 0.074997f, -0.083791f, -0.002369f, 0.06244f, 0.045231f, -0.089451f, -0.07994f, -0.034182f, -0.08634f, -0.022541f, -0.060294f, 0.030574f, -0.046128f, 0.019039f, -0.058138f, 0.08288f, 0.102535f, -0.031175f, -0.059743f, -0.042577f, 0.008565f, -0.092563f, 0.038587f, -0.015772f, -0.014989f, 0.072714f, 0.055729f, 0.075944f, -0.012074f, 0.079497f, 0.050942f, -0.025478f, 0.013412f, -0.051181f, 0.068424f, -0.064622f, -0.046591f, -0.074921f, -0.001811f, 0.059847f, -0.009386f, 0.012586f, -0.109853f, 0.002878f, -0.095431f, -0.05552f, 0.096854f, -0.050229f, 0.070815f, 0.042098f, -0.05358f, 0.027018f, -0.086136f, 0.050468f, 0.0378f, 0.048597f, -0.012246f, 0.066569f, -0.075745f, -0.049405f, 0.030635f, -0.02773f, -0.077681f, -0.068478f, 0.069081f, 0.00684f, 0.063296f, 0.061368f, -0.000168f, -0.008694f, 0.013133f, 0.068573f, 0.048775f, -0.087942f, 0.020935f, 0.077489f, 0.053533f, -0.06523f, -0.018314f, -0.059102f, -0.042171f, 0.097516f, 0.081816f, -0.03936f, -0.043929f, 0.017489f, 0.104819f, -0.065408f, -0.033083f, 0.057174f, 0.004531f, 0.064429f, -0.047018f, 0.003562f, -0.049001f, -0.018886f, 0.007164f, -0.001313f, -0.02911f, 0.090932f, 0.048328f, 0.042443f, -0.030067f, 0.028799f, 0.040092f, 0.04832f, -0.040553f, 0.064301f, 0.040925f, -0.069885f, 0.081175f, -0.017042f, 0.016327f, -0.014227f, 0.01825f, 0.019419f, 0.001848f, 0.062775f, 0.013475f, -0.002285f, -0.027073f, 0.061775f, -0.018699f, -0.063087f, -0.087852f, 0.066764f, 0.097354f, -0.068811f, -0.048925f, -0.058408f, -0.067998f, 0.067685f, -0.076158f, 0.082498f, -0.06599f, 0.079805f, 0.021398f, -0.033066f, -0.013922f, 0.036025f, -0.028139f, 0.027994f, 0.012448f, 0.008552f, 0.073552f, -0.003128f, 0.072098f, 0.051029f, -0.084785f, 0.048223f, -0.072635f, 0.07654f, -0.105035f, -0.020057f, -0.065107f, -0.012606f, 0.049202f, -0.047856f, -0.051359f, -0.050065f, 0.046182f, -0.052423f, -0.055466f, -0.095294f, 0.053796f, -0.019578f, -0.024099f, 0.024141f, -0.024646f, 0.043392f, 0.071889f, -0.073031f, 0.086735f, -0.070357f, -0.036515f, -0.049595f, -0.047261f, -0.02092f, 0.019189f, 0.072079f, 0.068481f, -0.05501f, 0.037189f, -0.064311f, 0.002322f, -0.022831f, -0.049009f, 0.007069f, 0.058377f, -0.072274f, 0.069323f, 0.053009f, -0.054481f, 0.072194f, 0.012801f, 0.09418f, -0.075702f, -0.005147f, -0.053903f, -0.033442f, 0.013892f, 0.074499f, 0.075397f, 0.061124f, 0.015217f, 0.082505f, 0.014261f, 0.062897f, 0.083346f, -0.065427f, 0.042763f, -0.089768f, -0.022874f, -0.055781f, 0.013033f, 0.049121f, -0.068658f, 0.015362f, 0.100355f, -0.065303f, 0.050629f, 0.020321f, -0.099505f, -0.001012f, 0.030716f, -0.098278f, 0.069281f, 0.015409f, -0.082394f, -0.06692f, 0.105453f, 0.028345f, -0.091145f, -0.026497f, -0.021105f, -0.075885f, -0.027111f, -0.000535f, -0.037302f, 0.022002f, 0.052209f, -0.068501f, 0.036134f, 0.032666f, 0.076226f, 0.061209f, 0.072175f, -0.014174f, -0.070108f, 0.081569f, -0.059596f, -0.014979f, -0.094954f, 0.074524f, 0.078447f, 0.051078f, -0.026677f, -0.036365f, -0.056926f, -0.055918f, 0.022518f, -0.0537f, -0.025133f, 0.01715f, 0.048013f, -0.083562f, -0.029605f, 0.025808f, 0.079515f, -0.007169f, 0.076263f, -0.034772f, -0.110049f, 0.008869f, -0.048633f, 0.067101f, -0.064384f, -0.039148f, 0.071675f, 0.047104f, 0.025698f, 0.024886f, -0.013187f, -0.108983f, -0.084186f, -0.001192f, -0.096529f, -0.070638f, 0.107775f, 0.081911f, -0.068743f, -0.087182f, 0.077995f, -0.035208f, -0.051361f, 0.050845f, -0.090535f, -0.05952f, 0.081864f, 0.036106f, 0.00084f, -0.020801f, 0.062332f, -0.077752f, 0.110186f, 0.075554f, 0.026631f, -0.094252f, 0.0504f, 0.071718f, 0.005815f, -0.013044f, -0.07151f, 0.056623f, 0.079885f, -0.07473f, 0.049635f, -0.093685f, 0.100396f, 0.030894f, -0.006022f, -0.042972f, 0.094196f, -0.055127f, 0.059361f, 0.082212f, 0.066543f, 0.01319f, -0.076827f, -0.016808f, 0.003159f, -0.070273f, -0.00254f, -0.030045f, -0.055617f, -0.00533f, -0.039757f, -0.008017f, -0.082287f, 0.085361f, 0.07744f, 0.002738f, 0.050907f, 0.088812f, -0.092001f, 0.039201f, 0.109401f, 0.087134f, 0.006569f, -0.081179f, 0.032921f, -0.114088f, -0.073629f, 0.106269f, -0.035575f, 0.018697f, -0.030293f, 0.090554f, 0.057427f, -0.05112f, 0.064522f, -0.077255f, -0.017948f, -0.07249f, 0.039975f, -0.079893f, -0.017386f, -0.030453f, -0.016037f, -0.046641f, 0.056797f, -0.088309f, 0.018421f, -0.052656f, -0.030308f, 0.069765f, 0.099364f, -0.024538f, 0.050449f, -0.066676f, 0.039664f, 0.060528f, -0.072299f, -0.005789f, 0.085472f, -0.090534f, -0.082631f, 0.015122f, -0.029232f, 0.046262f, 0.069465f, -0.034128f, -0.025743f, -0.010282f, 0.033004f, 0.112042f, 0.042113f, -0.021333f, -0.031683f, 0.076616f, -0.052739f, 0.033632f, 0.072329f, 0.036837f, -0.003488f, -0.061876f, -0.01377f, 0.046324f, 0.039778f, 0.095712f, 0.086351f, 0.049398f, 0.095809f, -0.041134f, -0.031521f, -0.017971f, 0.002198f, 0.023395f, -0.046524f, -0.081772f, -0.010913f, -0.050594f, 0.103127f, 0.088341f, 0.055571f, 0.044625f, -0.043138f, 0.027078f, 0.051844f, -0.076638f, 0.071377f, -0.08531f, 0.066681f, 0.04288f, -0.075155f, 0.029244f, -0.010669f, -0.056767f, -0.070945f, 0.040774f, 0.004012f, 0.078548f, 0.107124f, 0.086188f, -0.084454f, 0.073331f, -0.056282f, 0.000807f, 0.048468f, -0.046942f, 0.001765f, -0.043463f, -0.059752f, -0.058554f, -0.0166f, -0.103806f, -0.010151f, 0.04416f, -0.031842f, -0.083999f, -0.078996f, -0.045733f, -0.079618f, 0.101243f, -0.083639f, 0.071359f, 0.014287f, 0.018159f, -0.009599f, 0.089462f, -0.01126f, 0.061849f, 0.025212f, -0.035041f, 0.087316f, 0.007231f, -0.069167f, -0.019956f, 0.039537f, 0.054425f, 0.097444f, -0.03476f, 0.050082f, 0.002218f, 0.003014f, 0.099047f, 0.102238f, 0.083353f, -0.041432f, 0.060439f, 0.015942f, -0.007834f, -0.091743f, 0.051304f, 0.006841f, 0.046208f, 0.067274f, 0.067098f, -0.036823f, 0.052672f, 0.023248f, -0.014141f, 0.045453f, -0.078805f, -0.071246f, -0.030184f, 0.085031f, -0.062324f, -0.032858f, -0.080291f, -0.035662f, -0.023558f, 0.080772f, 0.057397f, -0.005999f, -0.096385f, 0.050509f, 0.018678f, -0.059702f, 0.10658f, -0.073797f, 0.058345f, -0.027768f, -0.022824f, 0.071549f, 0.032783f, 0.096058f, 0.023437f, -0.065283f, 0.064515f, 0.059156f, 0.046394f, -0.071811f, -0.028815f, -0.082596f, 0.062312f, 0.022859f, 0.089283f, 0.102503f, 0.045562f, 0.082701f, 0.013548f, -0.073598f, -0.1116f, -0.045531f, 0.080014f, 0.068085f, 0.088343f, -0.0767f, -0.08341f, 0.093467f, -0.055031f, 0.019187f, 0.093078f, -0.023395f, 0.014047f, -0.004552f, 0.051777f, 0.006479f, -0.037973f, -0.061961f, -0.06468f, 0.023374f, 0.044869f, 0.079649f, 0.038153f, 0.069473f, -0.053403f, -0.013721f, -0.006231f, 0.02312f, -0.02925f, -0.024767f, -0.016571f, 0.05519f, 0.024826f, -0.073628f, -0.095369f, -0.014102f, 0.049818f, 0.020131f, 0.028565f, 0.039038f, -0.036448f, 0.005452f, 0.000921f, 0.062585f, 0.107094f, -0.039958f, 0.057389f, 0.041315f, 0.005531f, 0.071862f, 0.077494f, -0.101323f, -0.064418f, 0.061316f, -0.084359f, 0.015586f, -0.046598f, -0.032683f, 0.051366f, -0.076747f, 0.060897f, 0.00444f, 0.003193f, 5e-06f, 0.035945f, -0.039386f, -0.087353f, -0.040711f, -0.052618f, 0.01926f, -0.048814f, 0.106026f, 0.103895f, 0.008673f, 0.037607f, 0.081707f, 0.09311f, 0.042218f, -0.03547f, -0.013422f, -0.055003f, 0.004867f, 0.078505f, 0.092301f, -0.070965f, -0.103557f, 0.085709f, -0.001741f, -0.071066f, 0.024425f, 0.012294f, -0.060033f, -0.057018f, -0.094823f, -0.068498f, -0.075253f, -0.049509f, 0.031046f, -0.077799f, -0.088549f, -0.057988f, -0.01889f, -0.023127f, -0.036103f, 0.042558f, 0.102164f, 0.020304f, 0.080122f, -0.02239f, -0.083976f, -0.020424f, -0.054729f, 0.008997f, 0.014661f, 0.004238f, 0.080123f, 0.079948f, 0.027743f, -0.004596f, -0.056147f, -0.014569f, 0.054352f, -0.056195f, -0.083568f, 0.068562f, 0.038371f, 0.018803f, 0.041699f, 0.081776f, 0.012424f, 0.086782f, 0.0818f, -0.034794f, 0.008672f, 0.016585f, 0.015053f, 0.096668f, -0.051363f, 0.078615f, 0.067243f, -0.005871f, 0.062663f, 0.050667f, 0.035226f, -0.045927f, -0.040547f, 0.045573f, 0.066914f, -0.100819f, 0.041436f, -0.020072f, 0.091836f, -0.020934f, 0.002971f, 0.016216f, -0.084342f, 0.050566f, 0.065073f, -0.07706f, -0.052383f, -0.076447f, 0.091503f, 0.019868f, 0.109186f, 0.010973f, 0.042221f, -0.037f, -0.030119f, -0.013365f, 0.030332f, -0.041108f, 0.086207f, 0.086178f, -0.07716f, -0.061384f, -0.064117f, -0.093737f, -0.037721f, -0.018508f, 0.070813f, -0.050168f, 0.013027f, 0.07469f, 0.014684f, 0.058591f, -0.006379f, 0.11078f, 0.02786f, -0.096673f, -0.072435f, -0.027197f, 0.035525f, 0.03618f, -0.03121f, 0.057276f, 0.052493f, -0.0281f, 0.093318f, 0.035843f, 0.087086f, -0.005172f, 0.054941f, 0.051559f, 0.071171f, -0.08639f, 0.026347f, -0.012815f, 0.082204f, -0.063641f, 0.076516f, 0.055859f, -0.066116f, 0.004464f, 0.034232f, 0.049279f, 0.090607f, 0.069464f, -0.025854f, 0.009914f, 0.026166f, -0.0599f, -0.046107f, 0.007737f, -0.044003f, 0.080442f, 0.025975f, -0.042552f, 0.078712f, 0.057521f, 0.080501f, 0.055673f, -0.029656f, -0.068112f, 0.062602f, -0.093283f, -0.013134f, 0.100141f, 0.092545f, 0.027686f, 0.044103f, -0.099292f, 0.021113f, 0.000199f, -0.042512f, -0.079966f, -0.041576f, -0.031017f, 0.000184f, 0.027887f, 0.055149f, -0.0238f, -0.01859f, -0.104822f, -0.076585f, -0.044118f, 0.035355f, 0.034898f, 0.043969f, 0.042498f, 0.063823f, 0.055128f, 0.101091f, 0.064293f, 0.03335f, 0.030782f, -0.105598f, 0.111726f, -0.084818f, 0.06457f, 0.053423f, -0.024724f, -0.046204f, -0.075853f, 0.058511f, -0.026302f, 0.053268f, 0.083209f, -0.079752f, 0.090108f, -0.027916f, -0.050727f, 0.07695f, 0.079722f, -0.044707f, 0.019992f, -0.084056f, 0.017734f, 0.063905f, 0.047784f, -0.023509f, -0.013487f, -0.031597f, 0.017413f, 0.090841f, 0.097388f, -0.074915f, -0.066428f, -0.069988f, -0.044874f, -0.029456f, 0.000666f, 0.011345f, 0.042304f, 0.061624f, 0.105079f, 0.015599f, 0.07936f, 0.046388f, -0.032109f, 0.061968f, -0.091878f, -0.081366f, -0.039092f, 0.007117f, 0.015179f, -0.090828f, 0.02428f, 0.051346f, -0.064332f, -0.031744f, 0.019849f, 0.005698f, 0.071301f, 0.093519f, 0.067626f, -0.094804f, 0.071431f, -0.0782f, -0.042789f, -0.079704f, -0.074662f, -0.005496f, 0.032095f, -0.002748f, 0.087607f, -0.058994f, 0.04013f, 0.090295f, 0.02538f, -0.010503f, 0.01164f, -0.000638f, 0.001863f, -0.000952f, -0.00599f, 0.047087f, -0.065832f, -0.079679f, 0.078036f, 0.054377f, -0.032706f, -0.038411f, 0.098026f, 0.06903f, 0.008223f, -0.036542f, -0.082077f, -0.030091f, 0.0213f, 0.0538f, 0.079606f, -0.095328f, -0.063566f, -0.028144f, -0.06646f, 0.073428f, 0.050605f, 0.015327f, 0.08777f, -0.053054f, 0.072462f, -0.070411f, -0.062577f, 0.051765f, -0.085265f, -0.00503f, -0.014475f, 0.028169f, 0.095465f, 0.062013f, 0.059852f, -0.104464f, -0.045188f, 0.014447f, -0.032896f, -0.065394f, -0.021672f, 0.081803f, -0.029576f, -0.032571f, -0.089114f, 0.079968f, -0.082396f, -0.050066f, -0.048913f, 0.064226f, -0.075048f, 0.072346f, 0.062249f, 0.081998f, -0.061438f, -0.072709f, 0.031097f, -0.042657f, -0.034786f, -0.073345f, -0.060493f, 0.006849f, -0.065066f, -0.02362f, -0.00412f, -0.105773f, -0.011165f, -0.065675f, 0.010124f, 0.059798f, 0.07128f, -0.072668f, 0.006813f, 0.075737f, -0.052821f, 0.034439f, 0.064084f, 0.046734f, -0.073284f, -0.099143f, -0.069597f, -0.028546f, 0.041186f, -0.020063f, 0.040031f, -0.024175f, -0.077444f, -0.018225f, 0.065976f, 0.077811f, -0.052945f, 0.067351f, -0.047581f, 0.088595f, -0.053198f, 0.044554f, -0.069453f, 0.107023f, 0.028746f, 0.07928f, 0.01657f, -0.017331f, 0.035521f, -0.002426f, -0.01635f, 0.044615f, -0.050498f, -0.057254f, -0.026808f, -0.018934f, -0.06894f, 0.052166f, 0.06732f, -0.004624f, 0.11118f, -0.09194f, 0.051443f, -0.032557f, -0.024271f, -0.042342f, 0.039305f, -0.058045f, 0.067316f, 0.020788f, -0.077153f, 0.049834f, 0.011969f, 0.069682f, 0.032532f, 0.026191f, 0.054631f, -0.048054f, -0.002203f, -0.035894f, 0.104468f, -0.062157f, -0.085809f, -0.044608f, -0.004408f, -0.075737f, 0.024576f, 0.085375f, 0.040317f, 0.029692f, 0.104969f, 0.093042f, 0.064387f, 0.005199f, -0.005687f, -0.107651f, 0.029755f, 0.079014f, 0.074367f, -0.043427f, -0.062049f, 0.044415f, 0.044558f, 0.107416f, 0.077624f, 0.025076f, -0.089457f, -0.018774f, -0.04293f, -0.008245f, -0.039189f, 0.055435f, 0.082148f, -0.021365f, 0.032526f, -0.008802f, 0.088758f, -0.07356f, 0.050877f, 0.096285f, -0.060632f, -0.064985f, 0.02202f, 0.043676f, -0.006253f, 0.026894f, -0.058054f, -0.017514f, -0.086332f, -0.017209f, -0.027993f, -0.015056f, 0.076133f, -0.04914f, -0.02808f, 0.03818f, 0.100119f, -0.061724f, 0.094723f, -0.096397f, 0.006096f, -0.006215f, -0.046241f, -0.045228f, 0.006724f, 0.080329f, 0.073861f, 0.019895f, 0.079558f, 0.004401f, -0.041613f, -0.073299f, -0.005667f, -0.001591f, -0.102115f, -0.067797f, 0.015705f, -0.039143f, 0.064487f, -0.02118f, -0.084192f, -0.064351f, 0.082099f, -0.070794f, -0.0678f, 0.083708f, -0.05697f, 0.01545f, 0.062983f, 0.004641f, 0.106625f, 0.048878f, -0.083872f, -0.001983f, 0.035054f, 0.056318f, -0.108561f, 0.032925f, 0.07877f, 0.042367f, 0.014229f, -0.014521f, 0.017851f, 0.05266f, 0.068091f, 0.029796f, 0.074494f, 0.027387f, -0.101536f, 0.014173f, -0.038824f, -0.043844f, -0.014447f, -0.053752f, 0.001376f, 0.052044f, -0.035926f, -0.080834f, -0.082467f, 0.023123f, -0.050172f, -0.084388f, 0.093722f, -0.005825f, -0.06878f, 0.080077f, 0.105469f, -0.012278f, -0.081501f, -0.065626f, -0.035867f, 0.085516f, -0.070256f, 0.046564f, -0.106636f, -0.021118f, 0.029358f, -0.088772f, 0.012787f, 0.102882f, -0.04749f, 0.046961f, 0.021762f, -0.059293f, -0.106298f, -0.077363f, -0.002718f, 0.074825f, 0.032452f, 0.052811f, -0.004625f, 0.029418f, -0.05947f, 0.086114f, 0.062251f, 0.111687f, -0.048827f, -0.040734f, -0.068956f, 0.076579f, 0.067961f, -0.072434f, -0.000729f, -0.023013f, -0.055774f, -0.060272f, 0.076721f, -0.02249f, 0.100468f, -0.097768f, 0.006545f, -0.085477f, -0.078704f, 0.002324f, -0.07682f, 0.056323f, 0.038725f, -0.048962f, 0.069318f, 0.054018f, -0.039575f, 0.030244f, 0.054177f, -0.041275f, -0.037326f, -0.036552f, 0.006691f, 0.092536f, -0.074993f, 0.071477f, -0.10306f, 0.039173f, -0.002235f, 0.047097f, 0.050888f, -0.014298f, 0.020689f, 0.016233f, 0.072415f, 0.008071f, 0.01202f, -0.042819f, 0.037438f, -0.032431f, 0.017894f, -0.081029f, -0.070085f, -0.02375f, -0.005966f, -0.061555f, -0.059063f, -0.103789f, -0.086599f, -0.055246f, -0.010379f, 0.060987f, -0.000835f, 0.092427f, -0.101995f, -0.078575f, -0.03461f, 0.002513f, 0.068049f, -0.044065f, -0.03321f, -0.071267f, 0.075977f, -0.017843f, 0.022517f, 0.081573f, -0.084545f, -0.066233f, 0.052579f, 0.058405f, 0.036803f, -0.002902f, 0.086479f, -0.012338f, 0.017661f, -0.098394f, -0.025251f, 0.060233f, -0.036535f, 0.079382f, 0.027941f, -0.028571f, 0.043642f, -0.065273f, 0.105421f, -0.077447f, 0.097483f, -0.062902f, 0.060211f, -0.093494f, -0.037203f, 0.032541f, 0.022331f, -0.064772f, -0.035854f, -0.009446f, 0.021091f, 0.016089f, 0.054368f, -0.015301f, -0.009442f, -0.076259f, 0.046472f, 0.041429f, -0.0197f, 0.018139f, 0.031144f, -0.052388f, -0.099814f, -0.018468f, 0.017571f, -0.000118f, 0.038913f, 0.074956f, -0.011307f, -0.084732f, 0.069399f, -0.001289f, 0.06401f, 0.046739f, 0.0827f, -0.052991f, 0.033427f, -0.036841f, -0.036183f, -0.054393f, -0.015525f, 0.080526f, -0.027968f, -0.056962f, 0.025005f, -0.034316f, -0.01863f, 0.07131f, -0.053294f, -0.026982f, 0.004623f, 0.022518f, 0.095634f, 0.030433f, 0.060468f, 0.073425f, -0.026754f, -0.01221f, -0.079694f, -0.070565f, -0.047521f, -0.056766f, 0.06065f, 0.018321f, 0.043161f, 0.04946f, -0.041781f, -0.020833f, 0.051775f, -0.021436f, -0.0869f, -0.004041f, 0.066928f, -0.007361f, -0.034428f, 0.078878f, 0.015952f, -0.038804f, -0.078901f, 0.05337f, 0.030951f, 0.098675f, -0.03625f, -0.072992f, 0.044251f, -0.057683f, -0.073137f, -0.016865f, 0.052615f, -0.003485f, -0.083788f, 0.003946f, 0.032386f, 0.021196f, 0.028243f, -0.0406f, 0.079227f, 0.026481f, 0.032987f, 0.105819f, -0.00937f, 0.059607f, -0.08175f, -0.097555f, 0.005703f, -0.043141f, -0.037007f, -0.039539f, -0.049049f, 0.059691f, 0.028265f, 0.041178f, 0.078277f, 0.053356f, 0.001138f, -0.022935f, 0.082569f, 0.044657f, -0.08265f, 0.023542f, -0.044314f, 0.105645f, -0.096073f, 0.011502f, 0.052836f, -0.051085f, 0.079057f, 0.061211f, 0.064764f, -0.078984f, 0.001958f, -0.038288f, 0.057265f, 0.036232f, 0.024845f, -0.085401f, 0.01477f, 0.015558f, 0.08013f, 0.032278f, 0.100806f, 0.102898f, 0.042249f, 0.006856f, 0.010735f, 0.083477f, -0.087874f, -0.092436f, -0.081568f, 0.048255f, -0.023665f, 0.010532f, 0.033358f, -0.037465f, 0.012012f, 0.017756f, 0.083076f, 0.032171f, 0.025668f, -0.071554f, 0.077804f, -0.011045f, 0.057562f, -0.101605f, -0.0165f, -0.061924f, -0.035092f, 0.070443f, 0.037575f, -0.005365f, -0.087361f, 0.077965f, 0.102813f, -0.054239f, -0.095111f, 0.01009f, 0.072398f, 0.070565f, 0.007718f, -0.027943f, -0.035353f, 0.064127f, -0.007936f, -0.055984f, -0.034399f, -0.053504f, -0.084442f, 0.005481f, 0.072356f, 0.049077f, -0.070553f, -0.085479f, -0.030719f, -0.041467f, 0.064004f, 0.096088f, -0.010991f, 0.020197f, 0.112704f, 0.058807f, 0.011657f, -0.068577f, -0.026399f, 0.06396f, -0.07012f, 0.051929f, 0.049989f, -0.033321f, -0.00663f, 0.007071f, 0.041761f, 0.017886f, -0.072305f, 0.066429f, -0.026304f, 0.107523f, -0.041902f, -0.044942f, -0.031577f, 0.026451f, 0.068074f, -0.072175f, -0.042546f, 0.000474f, 0.007967f, -0.004538f, 0.053774f, 0.069819f, -0.009538f, 0.023949f, 0.043325f, 0.010279f, -0.025463f, 0.019166f, 0.029434f, 0.070278f, -0.077896f, 0.092669f, -0.005956f, -0.088859f, -0.030683f, 0.030457f, -0.018798f, 0.106828f, -0.011726f, -0.039077f, 0.076214f, -0.007964f, 0.029752f, 0.075297f, 0.040348f, -0.024541f, -0.06927f, 0.01614f, 0.088463f, -0.004462f, 0.090838f, -0.012227f, 0.034262f, 0.077825f, 0.023627f, -0.078326f, 0.094156f, -0.04124f, 0.028583f, 0.011431f, -0.005977f, -0.06635f, 0.031032f, -0.088041f, 0.091125f, 0.064983f, -0.002891f, 0.001842f, -0.022681f, 0.002157f, 0.074609f, -0.04517f, -0.009845f, -0.033522f, -0.041045f, -0.071088f, 0.09886f, 0.024881f, 0.041875f, -0.064373f, -0.011566f, 0.089821f, -0.069314f, -0.050732f, 0.016492f, 0.03499f, 0.070991f, 0.069705f, -0.054849f, -0.052821f, -0.02731f, -0.103769f, -0.071876f, -0.051729f, -0.017427f, -0.033676f, 0.088487f, -0.04946f, 0.096471f, 0.078956f, 0.00787f, -0.060209f, -0.041668f, 0.067063f, -0.045759f, -0.007442f, -0.019558f, 0.025103f, 0.09455f, -0.062325f, -0.018958f, -0.054859f, -0.040461f, -0.086292f, -0.043591f, 0.090426f, -0.05125f, -0.020039f, 0.075962f, 0.056334f, 0.02112f, 0.043268f, -0.067416f, -0.01683f, -0.083977f, -0.036357f, -0.062436f, -0.013803f, -0.008993f, 0.092635f, -0.02842f, 0.002914f, 0.065716f, 0.04397f, 0.044544f, -0.039363f, 0.005939f, -0.077433f, -0.046976f, -0.029137f, 0.052171f, -0.005131f, 0.072696f, 0.081919f, -0.08896f, 0.02079f, 0.012166f, 0.073502f, -0.091261f, -0.008861f, -0.059083f, -0.101085f, 0.024705f, 0.066299f, 0.067093f, -0.084509f, -0.010897f, -0.101202f, -0.036222f, -0.061553f, -0.064086f, -0.023102f, -0.058784f, 0.081702f, -0.039029f, 0.089358f, -0.064395f, 0.037909f, -0.090302f, 0.007273f, -0.081616f, 0.048137f, 0.076209f, -0.078054f, 0.075861f, 0.069708f, -0.014848f, 0.090877f, -0.026924f, -0.032326f, -0.068429f, 0.03646f, -0.080588f, -0.019188f, 0.052022f, 0.073936f, -0.082622f, 0.062249f, 0.050885f, -0.004948f, 0.004743f, -0.094656f, 0.031016f, -0.030526f, 0.060172f, -0.038412f, 0.016695f, 0.000463f, 0.072806f, -0.034776f, -0.090333f, 0.065852f, -0.016131f, 0.018043f, -0.091728f, 0.100241f, 0.06487f, 0.018712f, -0.094651f, -0.038719f, 0.109766f, 0.040088f, -0.075022f, -0.020195f, 0.085246f, -0.006605f, -0.107723f, 0.035588f, -0.030165f, -0.086761f, -0.005776f, 0.003376f, -0.084293f, 0.024106f, -0.009846f, 0.062382f, -0.014977f, -0.003202f, 0.030928f, 0.090361f, -0.019864f, 0.013936f, 0.051128f, -0.105818f, 0.056126f, -0.008338f, 0.036462f, -0.015484f, 0.04341f, 0.040483f, -0.049132f, 0.042916f, 0.079376f, -0.064373f, 0.061071f, 0.038897f, 0.099586f, -0.043296f, -0.07235f, -0.028833f, -0.059462f, 0.06056f, 0.043103f, 0.016683f, -0.067585f, 0.058022f, 0.080003f, 0.00433f, 0.019497f, 0.016779f, -0.0232f, -0.040459f, -0.035671f, -0.062849f, 0.068374f, 0.08801f, -0.016996f, -0.036036f, 0.089176f, -0.04317f, 0.006923f, -0.072749f, -0.045459f, 0.033761f, 0.043585f, 0.030216f, 0.064573f, 0.106138f, 0.056909f, -0.022262f, 0.080354f, -0.079278f, 0.021322f, -0.002987f, -0.050876f, 0.091274f, -0.045314f, 0.036987f, 0.089124f, -0.013969f, -0.061404f, 0.048469f, -0.01116f, 0.087607f, 0.073484f, 0.082149f, -0.030142f, 0.066104f, 0.080601f, 0.015534f, -0.008391f, -0.104485f, 0.048956f, 0.063385f, -0.062758f, -0.044133f, -0.016139f, -0.068459f, -0.092297f, -0.005103f, -0.057017f, -0.005554f, 0.009379f, 0.081738f, 0.091453f, -0.080015f, 0.064338f, -0.066425f, 0.006226f, -0.052306f, -0.011708f, 0.052538f, 0.002922f, 0.068611f, 0.048396f, 0.068575f, 0.002315f, 0.063515f, -0.028316f, -0.046271f, -0.005054f, -0.035044f, -0.071951f, -0.006419f, -0.080806f, 0.084033f, -0.084634f, -0.007066f, -0.049882f, -0.083519f, 0.057977f, 0.026333f, -0.071222f, 0.012409f, 0.060725f, 0.065921f, -0.065728f, 0.043573f, 0.048225f, 0.058493f, 0.014604f, -0.01214f, 0.080146f, 0.068616f, -0.003705f, -0.039931f, 0.055801f, 0.005688f, -0.081666f, -0.02234f, 0.069176f, 0.002159f, -0.079886f, 0.008682f, 0.085406f, 0.074207f, 0.014142f, 0.09725f, 0.073697f, 0.011111f, 0.030507f, 0.030526f, 0.077715f, -0.079477f, 0.064676f, -0.026482f, 0.047585f, 0.063155f, -0.004176f, -0.054451f, -0.009364f, -0.09895f, 0.025233f, 0.073586f, 0.068536f, -0.028984f, 0.005637f, -0.040587f, 0.011373f, -0.023923f, 0.046108f, -0.033853f, 0.082082f, 0.049026f, -0.083128f, -0.095068f, 0.097371f, -0.042496f, -0.044984f, -0.059885f, 0.081736f, 0.01523f, 0.017037f, 0.015284f, -0.04469f, 0.009996f, -0.021439f, -0.072337f, 0.01549f, -0.011089f, 0.069959f, -0.025713f, 0.014958f, 0.048219f, 7.2e-05f, 0.103446f, 0.045586f, 0.068439f, 0.088856f, -0.035555f, -0.000384f, 0.050475f, 0.037432f, 0.081831f, -0.02836f, -0.056956f, 0.081479f, 0.073874f, -0.058134f, 0.00318f, 0.052035f, -0.034432f, -0.001897f, 0.025922f, 0.004515f, 0.03652f, -0.085462f, 2.7e-05f, -0.020895f, 0.026637f, 0.041955f, -0.07545f, -0.078863f, 0.042759f, 0.043387f, 0.000869f, 0.081718f, -0.012493f, -0.081166f, 0.03502f, 0.010374f, 0.034389f, 0.0279f, 0.08602f, -0.071593f, -0.086743f, -0.077374f, -0.03154f, 0.008359f, 0.012274f, -0.048201f, 0.008838f, -0.00697f, 0.00505f, 0.074032f, 0.008145f, 0.062661f, -0.050543f, -0.00086f, 0.072023f, -0.057078f, -0.022386f, 0.036729f, -0.066275f, 0.034829f, -0.088606f, 0.098749f, -0.009398f, -0.045852f, -0.060319f, 0.002448f, 0.015826f, -0.065505f, -0.051467f, 0.082746f, 0.02237f, -0.058473f, -0.052761f, 0.076336f, -0.025469f, -0.075417f, 0.107894f, -0.040125f, -0.082786f, 0.00276f, -0.013773f, 0.069484f, -0.079066f, -0.095948f, -0.064336f, 0.066113f, 0.003012f, -0.078493f, 0.031587f, 0.02582f, -0.070064f, 0.023868f, -0.040857f, -0.061669f, 0.017239f, -0.038171f, -0.041001f, 0.088398f, -0.06243f, -0.025095f, -0.013051f, -0.037723f, -0.074214f, 0.048522f, -0.026967f, -0.069966f, -0.008206f, -0.058177f, -0.045937f, 0.079596f, -0.035524f, 0.024797f, -0.001362f, -0.071661f, 0.026513f, 0.060369f, -0.095352f, 0.052543f, 0.021171f, 0.068442f, -0.089741f, -0.038964f, 0.049989f, -0.079234f, 0.053322f, 0.074134f, -0.020759f, 0.000361f, -0.05056f, -0.108233f, -0.048736f, 0.078655f, 0.066798f, -0.057964f, 0.106096f, -0.027953f, -0.053041f, -0.069264f, 0.084705f, 0.109608f, -0.048174f, 0.030167f, -0.019793f, -0.085711f, -0.004242f, 0.022593f, -0.061944f, 0.074783f, -0.014937f, -0.041524f, 0.02549f, 0.068279f, -0.049808f, 0.055482f, -0.002323f, 0.078672f, 0.064495f, -0.019699f, -0.110413f, 0.019125f, -0.073477f, -0.063335f, 0.076678f, 0.086897f, -0.047543f, -0.033638f, -0.050253f, -0.008483f, 0.083882f, 0.030887f, 0.085018f, -0.05228f, 0.044798f, 0.082273f, -0.030767f, 0.029103f, -0.021742f, -0.043796f, 0.07769f, -0.013517f, -0.072858f, -0.031025f, -0.022247f, 0.043197f, 0.073892f, 0.046586f, 0.097754f, 0.00963f, 0.033098f, -0.023704f, -0.091152f, -0.0156f, 0.051035f, -0.055235f, 0.075152f, 0.057536f, -0.073721f, -0.048849f, 0.076098f, -0.046061f, -0.039676f, -0.017989f, 0.04271f, -0.088821f, -0.067372f, 0.012351f, -0.030976f, 0.030265f, -0.053078f, 0.090603f, 0.061984f, -0.073493f, 0.042579f, 0.102408f, 0.098979f, 0.056557f, -0.066151f, 0.001169f, -0.035706f, 0.079365f, 0.05308f, 0.017189f, 0.021739f, -0.024525f, -0.037072f, 0.073906f, -0.033435f, -0.098705f, -0.002423f, 0.07549f, 0.02828f, 0.090706f, -0.081154f, 0.070146f, -0.007406f, -0.015047f, -0.023164f, -0.070701f, -0.038182f, 0.043747f, -0.078678f, -0.056402f, -0.078679f, 0.082305f, 0.037337f, -0.071202f, 0.060057f, 0.096891f, 0.069121f, 0.097711f, -0.100527f, 0.001551f, -0.054034f, 0.024217f, -0.040587f, -0.081473f, 0.003519f, 0.014784f, 0.080099f, -0.075711f, -0.052561f, 0.085569f, 0.025365f, 0.06239f, 0.044588f, 0.047775f, 0.014453f, -0.069198f, 0.070993f, 0.010217f, -0.079668f, 0.069992f, 0.091063f, -0.043769f, -0.047486f, -0.097699f, 0.047073f, 0.076319f, -0.056537f, -0.013281f, -0.064665f, -0.0722f, 0.02068f, 0.074378f, -0.041311f, 0.06223f, -0.059644f, -0.050931f, 0.091336f, 0.015953f, 0.025086f, -0.072466f, -0.062993f, -0.079556f, 0.061042f, -0.075499f, 0.075665f, -0.024076f, 0.04246f, -0.011162f, -0.063705f, -0.073903f, -0.052657f, -0.004262f, 0.052321f, -0.012577f, 0.085099f, -0.000614f, -0.108486f, -0.013317f, 0.020749f, -0.055411f, 0.027254f, -0.004797f, -0.08084f, 0.067618f, 0.019687f, -0.081893f, -0.015971f, -0.02817f, 0.064105f, -0.054603f, 0.099442f, -0.00558f, -0.036019f, 0.047778f, 0.055028f, -0.018754f, 0.011616f, 0.054195f, 0.070306f, 0.076312f, -0.078796f, 0.057752f, -0.073777f, -0.067248f, 0.040817f, -0.062603f, 0.031729f, -0.024613f, -0.028078f, -0.025734f, -0.075969f, 0.011241f, 0.074187f, 0.038097f, -0.027168f, 0.077181f, -0.010162f, 0.046818f, 0.009775f, 0.07681f, 0.066382f, -0.059546f, -0.088076f, 0.049929f, 0.075999f, 0.005043f, 0.052306f, -0.083938f, -0.042728f, -0.076734f, 0.037286f, -0.058731f, -0.086401f, -0.037583f, 0.046252f, 0.00784f, -0.035832f, 0.060639f, -0.05697f, -0.030879f, 0.015019f, -0.013607f, -0.022343f, -0.073384f, -0.012873f, -0.062241f, -0.007426f, 0.060179f, 0.074988f, 0.067016f, -0.024565f, 0.029104f, 0.060317f, -0.027977f, -0.022247f, -0.069575f, 0.031856f, 0.050092f, -0.023132f, 0.059314f, 0.014202f, 0.06753f, -0.033033f, 0.05256f, -0.001935f, -0.08659f, -0.001386f, -0.004278f, -0.057117f, 0.086986f, -0.011819f, -0.079533f, -0.035665f, -0.003692f, 0.083272f, 0.068896f, -0.049513f, 0.051882f, -0.043884f, -0.043214f, -0.07165f, -0.093064f, 0.018991f, 0.069962f, -0.013515f, 0.055818f, 0.057195f, 0.022896f, 0.110193f, 0.077728f, -0.045897f, 0.056895f, 0.032358f, -0.029755f, -0.064305f, -0.065913f, 0.048989f, -0.044828f, 0.10801f, 0.034391f, 0.009888f, 0.028688f, 0.03558f, 0.104328f, -0.051394f, -0.051121f, 0.047338f, -0.044461f, 0.056834f, -0.014359f, -0.066759f, -0.104163f, 0.011909f, 0.074801f, -0.050855f, 0.067334f, 0.064599f, -0.069647f, -0.00119f, 0.026564f, -0.071871f, -0.015449f, -0.013625f, -0.089452f, -0.05487f, -0.068443f, -0.008052f, 0.03772f, 0.075283f, -0.068626f, 0.03987f, 0.044174f, 0.081187f, 0.07747f, -0.079671f, -0.097839f, 0.073461f, -0.079397f, -0.044495f, 0.06403f, 0.099355f, -0.016809f, 0.055253f, 0.071761f, 0.010887f, 0.001648f, 0.029563f, -0.040488f, 0.036154f, -0.03577f, -0.059632f, 0.000474f, 0.049813f, 0.031152f, 0.072686f, 0.02415f, -0.061578f, -0.061694f, -0.095358f, -0.044807f, 0.000512f, 0.071481f, 0.066918f, -0.014063f, -0.000196f, 0.048451f, -0.045925f, 0.009799f, -0.079253f, -0.001543f, -0.079513f, -0.011459f, -0.030119f, -0.021761f, -0.038933f, -0.056458f, -0.035672f, -0.054676f, 0.035162f, 0.055696f, 0.004937f, -0.093019f, 0.026865f, -0.096296f, -0.087338f, -0.042651f, -0.033678f, 0.016364f, 0.069839f, 0.044149f, 0.049254f, 0.102442f, 0.013138f, 0.012328f, 0.032001f, 0.06238f, -0.004757f, 0.069988f, 0.041283f, -0.025209f, -0.109024f, -0.046187f, 0.046785f, 0.026572f, -0.060013f, 0.003626f, 0.043253f, -0.084336f, -0.00194f, -0.007895f, -0.007986f, -0.007041f, -0.040026f, 0.058049f, -0.091522f, -0.102734f, -0.018669f, 0.084852f, -0.02809f, -0.063801f, 0.094402f, -0.07306f, -0.006788f, 0.044275f, -0.047859f, -0.051405f, -0.008311f, 0.049603f, 0.07579f, -0.097104f, -0.078141f, 0.105003f, 0.02134f, 0.00069f, 0.049476f, -0.096346f, -0.108475f, 0.075724f, 0.07718f, 0.063062f, -0.077577f, 0.00923f, 0.080685f, 0.095813f, -0.083552f, 0.037855f, -0.090806f, 0.096491f, -0.030473f, 0.076206f, -0.013269f, -0.035843f, -0.043562f, 0.056693f, -0.074191f, 0.075757f, 0.033745f, 0.084202f, 0.08342f, -0.056423f, 0.078744f, -0.078152f, -0.081117f, 0.095809f, 0.077487f, -0.057603f, 0.001704f, 0.009369f, 0.080791f, 0.010391f, 0.057213f, -0.015518f, 0.039836f, 0.035587f, 0.030097f, -0.109734f, -0.09f, -0.037637f, -0.084863f, -0.031742f, -0.004392f, 0.100656f, 0.009207f, 0.040676f, 0.069702f, -0.021716f, -0.078883f, -0.052387f, 0.052213f, 0.082513f, -0.017904f, -0.043471f, 0.097103f, -0.014109f, 0.043604f, -0.029657f, -0.063734f, -0.006429f, 0.088145f, 0.02969f, -0.072219f, 0.051041f, 0.047594f, -0.051149f, 0.004686f, 0.046687f, -0.074125f, 0.076381f, 0.004915f, 0.109351f, -0.075864f, 0.010235f, -0.079044f, -0.078817f, -0.056538f, -0.020636f, -2.1e-05f, 0.072172f, 0.041458f, -0.022188f, 0.105942f, 0.019479f, -0.043577f, 0.048366f, 0.008187f, 0.060321f, 0.071863f, -0.041933f, 0.027206f, -0.059618f, 0.040075f, 0.085505f, 0.078697f, -0.007493f, -0.09029f, 0.092183f, -0.03123f, -0.051656f, -0.02115f, -0.005333f, 0.10191f, 0.109056f, -0.037605f, -0.011659f, 0.012135f, -0.08801f, -0.081345f, 0.080537f, -0.082754f, -0.074162f, -0.031429f, 0.060647f, -0.063819f, -0.031864f, -0.047664f, 0.078804f, -0.065992f, -0.001625f, 0.086673f, 0.035427f, -0.047462f, 0.054756f, 0.073449f, -0.02913f, 0.032464f, -0.09352f, 0.087421f, -0.063933f, -0.016602f, 0.001631f, -0.055778f, 0.042637f, -0.003686f, 0.028383f, -0.014088f, -0.005097f, 0.072713f, 0.04621f, 0.058374f, 0.005511f, 0.020054f, -0.078096f, -0.012534f, 0.084651f, 0.008462f, 0.086057f, -0.034288f, -0.087576f, 0.041894f, -0.067298f, 0.066534f, -0.03441f, -0.006627f, 0.071073f, 0.063761f, 0.010228f, 0.076739f, 0.01593f, -0.031211f, -0.050193f, 0.058659f, -0.003867f, -0.03206f, -0.104698f, -0.052073f, 0.074053f, 0.052166f, 0.035876f, -0.096189f, -0.083607f, -0.021295f, -0.004743f, 0.089633f, -0.030838f, -0.0236f, 0.012826f, 0.079188f, 0.04802f, 0.08105f, -0.067114f, -0.07876f, 0.001573f, 0.026214f, 0.104012f, -0.02173f, -0.039172f, -0.008275f, 0.029042f, -0.000869f, 0.028227f, -0.010869f, 0.085625f, -0.072779f, -0.021987f, 0.051006f, -0.020404f, 0.044699f, -0.052727f, -0.05512f, -0.035946f, 0.06104f, -0.02375f, -0.041397f, -0.030155f, -0.105127f, 0.06104f, -0.069066f, 0.024609f, -0.076404f, 0.057277f, -0.072637f, -0.091217f, -0.049734f, 0.091652f, -0.035469f, 0.00828f, -0.030574f, -0.028856f, 0.096358f, 0.06674f, 0.06298f, -0.009828f, 0.065016f, -0.020908f, 0.004192f, -0.016656f, -0.067566f, 0.069835f, -0.05891f, -0.069499f, -0.048476f, 0.053229f, 0.069569f, 0.004504f, -0.100546f, 0.093072f, -0.077806f, 0.057705f, 0.073045f, 0.074498f, 0.044106f, -0.028528f, -0.041154f, -0.027052f, -0.043411f, 0.057513f, 0.077472f, 0.041775f, -0.046433f, -0.096732f, 0.020994f, -0.000435f, -0.073947f, -0.010124f, 0.003043f, 0.009531f, -0.011566f, 0.102787f, -0.096757f, 0.016774f, 0.094265f, -0.035471f, -0.071208f, 0.064528f, -0.016618f, 0.112366f, 0.011685f, 0.080108f, -0.081648f, -0.070678f, 0.050532f, -0.024667f, 0.076381f, -0.016376f, 0.03272f, 0.02403f, -0.062051f, 0.028513f, 0.035757f, -0.090962f, 0.027124f, -0.04638f, 0.007541f, -0.025509f, -0.063208f, -0.04816f, -0.091892f, -0.059226f, 0.05893f, -0.10415f, 0.001236f, 0.053918f, -0.065109f, -0.03872f, 0.045166f, 0.045959f, 0.022052f, -0.055928f, 0.039341f, -0.074132f, -0.061747f, 0.060327f, -0.041338f, -0.02088f, -0.061899f, -0.02786f, -0.040749f, 0.044614f, -0.063829f, -0.048633f, 0.042078f, 0.071085f, 0.006583f, -0.073844f, -0.005875f, 0.020085f, -0.041418f, 0.051628f, 0.064667f, 0.029663f, -0.060919f, 0.029834f, 0.068362f, -0.03502f, 0.074762f, 0.038471f, -0.02433f, 0.008923f, -0.022518f, -0.092688f, 0.075098f, 0.028707f, 0.008495f, -0.066486f, -0.034098f, 0.087408f, -0.07766f, -0.086057f, -0.048252f, -0.057571f, 0.072678f, 0.041267f, -0.082541f, -0.080941f, -0.001078f, 0.03643f, -0.065412f, 0.032525f, -0.066445f, -0.015538f, -0.005876f, -0.08648f, 0.101383f, 0.100745f, -0.026922f, -0.058536f, 0.075352f, 0.062477f, 0.036954f, -0.019587f, -0.02063f, 0.064037f, 0.019476f, 0.031627f, 0.021205f, 0.033026f, -0.061486f, -0.025612f, -0.066795f, -0.0485f, -0.046825f, -0.002784f, -0.100765f, 0.082499f, -0.007885f, -0.072346f, 0.038891f, -0.054293f, -0.087802f, 0.057037f, -0.072677f, -0.09192f, -0.074599f, 0.059755f, 0.019415f, -0.081876f, -0.0538f, 0.051738f, -0.055779f, 0.003614f, -0.049687f, -0.006149f, 0.057094f, -0.054491f, 0.047696f, -0.007234f, -0.087413f, -0.016503f, 0.050999f, 0.098519f, 0.083371f, -0.073926f, -0.04203f, 0.070143f, -0.001316f, 0.062795f, 0.064802f, -0.079108f, -0.043023f, 0.007221f, 0.099966f, 0.087943f, -0.002056f, -0.094077f, -0.019615f, -0.005982f, 0.089832f, -0.055736f, -0.053668f, 0.011993f, -0.010719f, -0.066971f, -0.066814f, -0.010257f, 0.071537f, 0.072965f, 0.08509f, -0.022562f, -0.027459f, -0.108372f, 0.082361f, 0.01738f, 0.043122f, -0.0013f, 0.093032f, -0.094896f, -0.060462f, -0.009625f, -0.067048f, -0.067014f, 0.027862f, -0.061806f, 0.02968f, 0.090752f, 0.047828f, -0.033191f, -0.085439f, 0.071249f, 0.089196f, -0.013994f, -0.01637f, -0.083155f, 0.055354f, 0.000604f, 0.04358f, 0.028574f, -0.103033f, -0.016174f, 0.054177f, 0.033617f, 0.039233f, 0.030115f, 0.034795f, 0.019903f, 0.034482f, 0.004371f, 0.041547f, -0.014293f, 0.008664f, -0.03305f, -0.060361f, -0.050697f, -0.071653f, -0.048696f, -0.006198f, -0.089739f, -0.040859f, -0.030402f, -0.064294f, -0.028881f, -0.078934f, 0.033586f, -0.016214f, -0.079358f, 0.030878f, -0.047919f, -0.086965f, -0.048475f, -0.006009f, 0.045542f, 0.009481f, -0.100438f, 0.066923f, -0.029817f, 0.019229f, -0.075416f, -0.039007f, -0.08705f, 0.05201f, -0.054798f, 0.020394f, -0.058256f, -0.083473f, 0.074067f, 0.003258f, 0.079336f, -0.048763f, 0.059055f, 0.086545f, -0.033776f, 0.087748f, -0.016912f, -0.025872f, 0.086959f, 0.080663f, -0.039104f, 0.050994f, -0.045479f, 0.108113f, 0.054511f, 0.094929f, -0.000553f, -0.02912f, -0.062668f, -0.008307f, 0.037352f, 0.034806f, -0.051427f, -0.004694f, -0.009017f, -0.045086f, 0.001481f, -0.026109f, 0.019203f, -0.046954f, 0.091137f, -0.045609f, 0.03202f, -0.06596f, 0.036323f, -0.060115f, 0.105136f, -0.0088f, 0.009263f, -0.044268f, 0.078856f, 0.04315f, -0.060832f, 0.066184f, -0.092514f, 0.042738f, -0.020273f, 0.06233f, 0.003813f, -0.068844f, -0.052896f, 0.102936f, -0.040622f, -0.048571f, 0.057022f, -0.090578f, -0.082453f, -0.028036f, -0.089953f, 0.089167f, 0.02877f, -0.006923f, 0.073222f, 0.035142f, -0.072858f, -0.065627f, 0.063955f, -0.045627f, -0.024582f, -0.009996f, -0.071991f, 0.030853f, 0.021789f, 0.03783f, -0.031166f, -0.006093f, -0.071155f, -0.009148f, 0.034408f, 0.072012f, 0.016203f, 0.015615f, -0.011524f, -0.086096f, 0.005681f, -0.082513f, 0.023183f, 0.060897f, 0.079054f, -0.051704f, -0.014216f, -0.074347f, 0.081639f, 0.073597f, 0.050801f, -0.098325f, 0.022433f, -0.038284f, -0.063827f, 0.068504f, -0.071904f, -0.003873f, -0.008113f, -0.044769f, -0.016784f, -0.10365f, -0.1102f, 0.062541f, -0.023003f, 0.082833f, -0.006561f, 0.003604f, -0.021251f, -0.090479f, -0.036792f, 0.014753f, 0.039295f, 0.025919f, 0.03878f, -0.076503f, 0.020857f, 0.085771f, -0.058018f, -0.038524f, 0.062764f, 0.074488f, -0.035826f, -0.017916f, 0.019205f, -0.014883f, 0.031364f, -0.015756f, 0.069365f, 0.061502f, 0.054314f, 0.014431f, 0.031739f, -0.018647f, -0.106071f, -0.024837f, -0.069203f, -0.02765f, 0.081739f, 0.004953f, 0.049666f, -0.067103f, -0.049995f, -0.052244f, 0.0631f, -0.028685f, 0.004894f, -0.058845f, -0.075186f, -0.038368f, -0.02206f, -0.018776f, 0.005986f, -0.038961f, 0.036464f, -0.064678f, -0.049132f, 0.047108f, 0.009538f, -0.060853f, 0.006551f, -0.048094f, 0.025805f, -0.081866f, 0.021719f, 0.007337f, -0.050468f, 0.060641f, -0.046059f, -0.070601f, -0.077272f, 0.079616f, 0.005897f, -0.01488f, -0.078874f, -0.066403f, -0.030792f, -0.012617f, 0.054748f, -0.017387f, 0.071425f, -0.033505f, -0.085968f, -0.028343f, -0.095664f, -0.04769f, 0.084542f, 0.054489f, -0.04803f, -0.034432f, -0.019069f, 0.057178f, -0.105218f, -0.081602f, -0.059168f, 0.033418f, -0.026742f, 0.061807f, -0.028216f, -0.016858f, 0.025208f, 0.023606f, -0.0492f, -0.051341f, -0.007328f, -0.059526f, 0.081105f, -0.00598f, -0.058811f, 0.029243f, -0.06707f, 0.041545f, -0.004119f, -0.060004f, -0.09889f, 0.113812f, -0.031626f, 0.099559f, 0.01363f, -0.013427f, -0.069106f, 0.095828f, 0.056348f, -0.011854f, -0.058131f, -0.051469f, -0.024878f, -0.015726f, 0.019716f, -0.098678f, -0.10081f, -0.011661f, -0.099424f, -0.09203f, -0.036056f, -0.088102f, -0.010863f, -0.034363f, -0.060412f, -0.016168f, -0.082378f, -0.011657f, -0.016164f, 0.062395f, 0.086676f, -0.025975f, -0.040669f, 0.006612f, -0.07956f, -0.039191f, -0.07484f, -0.020251f, -0.084294f, 0.001216f, 0.019568f, 0.081025f, -0.073096f, -0.045796f, 0.102499f, 0.068217f, 0.036596f, 0.072853f, -0.044364f, 0.084893f, 0.060444f, -0.04243f, 0.006924f, 0.068879f, 0.019858f, 0.041139f, 0.016269f, -0.054666f, 0.10296f, -0.025358f, -0.028846f, 0.06039f, 0.013078f, -0.043012f, -0.032033f, -0.068841f, -0.075471f, 0.034631f, -0.006844f, -0.063376f, -0.075263f, -0.080252f, 0.056775f, -0.044634f, -0.061598f, -0.101826f, -0.081587f, 0.084147f, -0.06505f, 0.07187f, -0.078058f, -0.059493f, 0.066299f, -0.00979f, -0.050792f, 0.054603f, -0.069032f, 0.06614f, 0.066866f, -0.086843f, 0.045626f, 0.10765f, -0.013472f, 0.003125f, 0.039874f, -0.034207f, 0.026212f, 0.009656f, -0.004197f, 0.092034f, 0.071271f, 0.099657f, 0.059121f, -0.084305f, 0.027978f, 0.023815f, 0.048288f, -0.050887f, -0.031041f, -0.097223f, -0.070276f, 0.003358f, 0.002086f, -0.044078f, 0.005652f, -0.021032f, -0.081451f, -0.083562f, 0.039335f, 0.089374f, 0.025126f, -0.060631f, 0.058839f, 0.000521f, -0.088498f, 0.030532f, -0.054767f, -0.024892f, -0.024677f, 0.042981f, -0.026903f, -0.079816f, -0.071204f, 0.015162f, 0.041102f, -0.083297f, 0.011298f, -0.062252f, 0.038571f, 0.055134f, -0.053143f, -0.01057f, 0.041952f, -0.048893f, -0.074986f, 0.09102f, 0.052959f, 0.04043f, 0.08427f, 0.016303f, 0.00424f, -0.007266f, 0.038767f, -0.011042f, -0.077855f, -0.086875f, 0.107843f, -0.102373f, 0.04829f, 0.076842f, -0.066449f, 0.029078f, -0.053162f, -0.064774f, 0.058573f, 0.064725f, -0.026334f, 0.016255f, -0.069186f, 0.066811f, 0.059199f, -0.027735f, 0.045472f, 0.081876f, -0.104722f, 0.064524f, 0.027978f, -0.0316f, -0.010947f, 0.077993f, 0.029932f, 0.016667f, -0.017958f, 0.087435f, -0.055126f, -0.092556f, 0.039871f, 0.024719f, 0.019729f, -0.057454f, -0.035145f, 0.034157f, -0.052689f, 0.017624f, -0.020422f, 0.013386f, -0.039406f, -0.072802f, 0.056253f, -0.0138f, -0.041174f, 0.054616f, -0.004095f, -0.063264f, 0.028885f, -0.031757f, 0.021027f, 0.008003f, 0.078873f, -0.073926f, -0.051606f, 0.078335f, 0.030719f, -0.012f, 0.058139f, -0.000804f, -0.017064f, -0.067302f, -0.004052f, -0.02858f, 0.021617f, -0.02199f, 0.071587f, 0.064223f, -0.06795f, 0.012862f, 0.03242f, -0.006426f, -0.064604f, 0.003644f, -0.022085f, -0.044755f, 0.007731f, -0.048121f, -0.0647f, 0.057594f, -0.040533f, 0.060624f, 0.107378f, -0.002181f, 0.073241f, -0.052579f, 0.046866f, 0.09692f, 0.009296f, -0.062861f, -0.080615f, 0.0905f, -0.029779f, -0.010511f, -0.003507f, -0.027552f, 0.060208f, 0.100613f, 0.018764f, 0.076586f, -0.053769f, -0.001294f, 0.041031f, 0.051702f, 0.038892f, -0.04379f, 0.085924f, -0.058131f, -0.032794f, 0.010331f, 0.001442f, -0.052443f, 0.065519f, 0.001858f, -0.092325f, 0.045631f, 0.078189f, -0.041194f, 0.006636f, 0.021755f, 0.053669f, -0.050869f, 0.084795f, 0.032379f, -0.09033f, 0.007328f, -0.105237f, 0.016799f, 0.007133f, 0.015778f, 0.088126f, -0.028256f, 0.064355f, 0.005225f, 0.046684f, 0.073468f, 0.056856f, 0.072558f, 0.020062f, 0.063728f, 0.08687f, 0.064625f, -0.017239f, 0.084964f, -0.102567f, 0.015231f, 0.0066f, -0.060106f, -0.007071f, -0.070524f, 0.026095f, 0.05343f, -0.056066f, -0.047916f, 0.040327f, -0.034426f, -0.021213f, -0.018136f, -0.007152f, -0.011224f, -0.077311f, -0.047615f, -0.083691f, -0.014984f, 0.077614f, -0.064304f, 0.017762f, -0.018024f, 0.056868f, -0.011575f, 0.02246f, -0.012835f, -0.002512f, 0.065061f, 0.109397f, -0.08111f, 0.005035f, -0.08129f, -0.102769f, 0.062585f, 0.086391f, 0.030247f, -0.067997f, -0.095442f, -0.018817f, -0.015524f, -0.091507f, 0.048442f, -0.009278f, 0.106936f, 0.075367f, -0.015881f, 0.040132f, -0.047904f, -0.03083f, -0.081749f, 0.014514f, -0.095961f, -0.024866f, -0.048591f, 0.046414f, -0.038093f, 0.081834f, -0.069536f, 0.077534f, 0.030053f, -0.089657f, 0.007398f, -0.029358f, 0.057157f, 0.019202f, -0.088751f, -0.002104f, 0.06059f, -0.033545f, 0.062366f, -0.088591f, 0.087921f, -0.015275f, 0.096426f, 0.005472f, 0.038671f, 0.097564f, 0.029459f, 0.018014f, -0.037004f, -0.084325f, -0.002036f, -0.02509f, 0.080522f, -0.048296f, 0.058547f, -0.076746f, 0.061382f, 0.043455f, -0.006128f, -0.034771f, -0.076346f, 0.029922f, -0.006088f, 0.035694f, 0.090411f, -0.031638f, 0.013117f, -0.02641f, -0.102732f, 0.011492f, -0.032132f, -0.106455f, -0.006701f, -0.066369f, 0.041145f, 0.00566f, -0.001815f, 0.076726f, 0.091838f, 0.036282f, 0.010442f, -0.045248f, -0.084512f, -0.073181f, -0.037813f, -0.068612f, 0.004999f, 0.015251f, -0.018911f, 0.049639f, 0.0342f, 0.02794f, -0.013614f, -0.101563f, -0.001724f, 0.015152f, -0.006568f, -0.082507f, 0.04224f, -0.034795f, -0.078591f, -0.01026f, 0.088884f, -0.085088f, -0.110462f, 0.002963f, 0.017724f, -0.09016f, -0.08757f, 0.074848f, -0.023915f, -0.063988f, -0.051187f, 0.013726f, -0.046061f, -0.085572f, 0.012296f, -0.088598f, -0.066519f, -0.078962f, -0.08025f, 0.062385f, -0.065499f, -0.058064f, 0.006327f, -0.084873f, 0.032426f, -0.016711f, 0.085335f, -0.104186f, 0.053279f, -0.07984f, 0.07187f, -0.036687f, 0.008733f, -0.097544f, 0.061546f, -0.037626f, 0.069855f, 0.031832f, -0.047177f, -0.060537f, -0.047123f, 0.046323f, -0.022777f, -0.038513f, 0.099591f, 0.056368f, 0.031301f, 0.073012f, -0.060584f, 0.046763f, -0.019303f, 0.030198f, 0.095362f, 0.061655f, 0.00127f, 0.064136f, -0.013765f, -0.058947f, -0.096996f, 0.039851f, -0.076208f, -0.021798f, 0.046464f, 0.091712f, 0.00559f, -0.040985f, -0.018881f, 0.047206f, -0.066766f, 0.040147f, 0.064728f, 0.000713f, 0.082971f, -0.062543f, 0.01843f, 0.075098f, 0.031096f, 0.069437f, -0.038461f, 0.001389f, -0.036823f, 0.016067f, 0.019438f, 0.008922f, 0.025304f, 0.035378f, 0.067865f, -0.067208f, 0.078143f, -0.019285f, -0.073821f, 0.071292f, 0.06957f, -0.02371f, 0.030639f, -0.037706f, -0.029381f, -0.001881f, 0.055772f, -0.009788f, 0.03117f, 0.053807f, -0.011825f, -0.011693f, -0.012172f, -0.08152f, -0.065313f, 0.078283f, 0.041061f, -0.076851f, 0.011679f, -0.107734f, -0.007406f, -0.076091f, 0.053918f, 0.026096f, -0.093595f, 0.020894f, 0.08933f, 0.029391f, -0.068549f, 0.048259f, 0.030322f, 0.01548f, 0.054917f, -0.024117f, -0.042996f, -0.073903f, 0.006583f, -0.03075f, -0.0646f, -0.066081f, -0.065083f, 0.009897f, -0.074744f, -0.027972f, 0.046184f, 0.014247f, -0.007074f, 0.091519f, -0.001322f, 0.067368f, 0.032282f, -0.006228f, -0.018806f, 0.091978f, -0.001137f, -0.037584f, 0.013332f, -0.037853f, -0.064799f, -0.062035f, 0.048056f, 0.043068f, -0.023212f, -0.009695f, 0.041005f, -0.105688f, -0.04608f, -0.049581f, 0.00324f, 0.065435f, -0.089683f, 0.080796f, 0.027418f, 0.017581f, 0.086166f, -0.080937f, -0.025783f, -0.058979f, -0.011308f, 0.018954f, 0.055733f, -0.086576f, -0.014705f, 0.07299f, -0.015274f, 0.067648f, -0.073546f, -0.04984f, 0.034866f, 0.014583f, -0.025358f, 0.021057f, 0.065675f, 0.092711f, -0.006884f, 0.041864f, -0.010153f, 0.095744f, 0.006294f, -0.028216f, 0.09263f, -0.087738f, -0.048771f, 0.052052f, 0.000329f, -0.025429f, 0.0067f, -0.009428f, -0.047685f, -0.035787f, -0.020504f, 0.074678f, 0.076708f, -0.071064f, 0.031313f, 0.030552f, 0.034585f, -0.104442f, -0.054217f, 0.059323f, 0.013016f, -0.082375f, 0.021985f, 0.053091f, 0.056391f, 0.063217f, 0.016841f, -0.020442f, -0.061775f, 0.05911f, 0.047535f, 0.069153f, -0.045706f, -0.082837f, 0.055485f, 0.098554f, 0.069443f, 0.005895f, 0.023694f, -0.090213f, -0.027261f, -0.005377f, 0.063181f, 0.001909f, 0.029464f, -0.088817f, 0.104927f, 0.012483f, -0.05285f, -0.01812f, 0.017566f, -0.076908f, -0.053549f, 0.087812f, 0.062063f, -0.057566f, -0.051224f, 0.010761f, -0.054271f, -0.095211f, 0.033655f, -0.073648f, -0.020201f, -0.026831f, -0.083562f, -0.056794f, -0.082946f, 0.105472f, 0.036496f, 0.080309f, 0.02723f, -0.036316f, -0.053196f, -0.013434f, 0.00983f, 0.052417f, -0.00325f, -0.05065f, 0.076991f, -0.080854f, 0.002671f, -0.102911f, -0.0105f, 0.01785f, -0.072348f, -0.005877f, 0.01409f, 0.097863f, -0.014686f, -0.083715f, -0.078431f, -0.053932f, 0.072456f, -0.05628f, 0.031947f, -0.066129f, -0.071713f, 0.040738f, -0.074595f, 0.043354f, -0.028616f, -0.045162f, 0.083433f, 0.030924f, -0.101322f, 0.048215f, -0.060619f, 0.095118f, -0.077403f, 0.028154f, -0.064951f, 0.071949f, -0.048409f, 0.007423f, -0.087127f, -0.000254f, 0.012846f, 0.045865f, 0.024773f, 0.02308f, 0.075926f, -0.022959f, -0.022266f, -0.101597f, 0.00881f, 0.105917f, 0.031234f, 0.080026f, 0.006069f, 0.035131f, -0.049582f, -0.031253f, 0.036883f, -0.009403f, -0.105453f, -0.029361f, 0.018466f, -0.02193f, -0.020828f, 0.074468f, -0.034311f, 0.015966f, 0.081109f, 0.072029f, -0.03981f, -0.074095f, -0.057268f, -0.052189f, -0.082019f, -0.027228f, -0.009367f, 0.035556f, -0.012916f, -0.069373f, 0.024697f, 0.056872f, 0.021853f, 0.058058f, -0.059389f, -0.012396f, -0.0071f, -0.046075f, 0.037732f, -0.056553f, 0.075923f, -0.089822f, -0.025325f, 0.01232f, 0.003038f, 0.023046f, -0.095721f, 0.075407f, -0.070985f, -0.042127f, -0.037565f, -0.10501f, -0.086326f, 0.067355f, 0.055266f, 0.037576f, 0.025671f, -0.092394f, -0.053718f, -0.107002f, -0.072107f, -0.074861f, -0.053903f, -0.072375f, -0.081003f, -0.037158f, 0.068228f, -0.097025f, 0.101358f, 0.040916f, 0.055155f, 0.017756f, 0.064331f, -0.034837f, -0.057887f, 0.041002f, -0.001819f, 0.011523f, -0.046847f, -0.060863f, -0.003463f, -0.010197f, 0.075279f, 0.00747f, -0.004589f, 0.073771f, -0.088916f, -0.033183f, -0.016f, 0.079179f, 0.068838f, -0.052403f, 0.054543f, -0.099742f, 0.010409f, 0.016251f, -0.043857f, -0.09605f, -0.058057f, -0.003857f, -0.026666f, -0.020718f, -0.062525f, -0.076707f, 0.061508f, -0.081898f, -0.042791f, 0.016773f, 0.08296f, -0.047758f, 0.0185f, -0.000361f, -0.076024f, -0.019682f, -0.07738f, 0.104343f, 0.064263f, -0.017943f, -0.036702f, -0.026059f, -0.030009f, -0.0187f, 0.072401f, -0.003045f, 0.038309f, -0.082135f, -0.000869f, -0.003456f, 0.013184f, 0.02124f, 0.084217f, -0.037578f, -0.038983f, -0.071872f, 0.010568f, 0.099051f, -0.028323f, 0.086307f, 0.032347f, -0.059394f, 0.016818f, 0.015845f, 0.043592f, 0.02549f, -0.069363f, -0.050974f, -0.034612f, 0.034003f, -0.003807f, 0.022041f, 0.073281f, -0.003256f, -0.010958f, -0.029705f, 0.008979f, -0.050248f, 0.049073f, 0.078417f, 0.051529f, 0.0559f, 0.078325f, -0.072094f, 0.106716f, 0.04709f, -0.031693f, 0.093214f, 0.013348f, 0.09498f, 0.030272f, -0.027648f, 0.05793f, 0.04126f, -0.052944f, 0.089723f, -0.068245f, -0.012057f, 0.016455f, 0.001189f, 0.01986f, 0.082786f, -0.096548f, 0.040502f, 0.04696f, -0.038647f, -0.055896f, -0.018581f, -0.006519f, -0.015373f, -0.050596f, 0.015212f, 0.069909f, 0.064859f, 0.031382f, -0.027237f, 0.057979f, -0.031434f, -0.037244f, -0.084249f, 0.106379f, -0.096365f, 0.01467f, -0.056923f, 0.057958f, -0.053061f, 0.030035f, -0.067758f, 0.074736f, 0.037017f, -0.006143f, 0.084456f, 0.016277f, -0.010494f, -0.054765f, 0.056449f, 0.005082f, -0.043069f, -0.038265f, -0.043599f, -0.013084f, -0.086286f, -0.030554f, 0.034373f, 0.034865f, 0.069369f, 0.031537f, -0.104828f, 0.000316f, -0.025814f, -0.031443f, 0.08481f, 0.035843f, -0.031198f, 0.023021f, -0.078391f, 0.043762f, -0.038397f, -0.046703f, -0.073921f, -0.10091f, 0.05861f, 0.055881f, -0.005494f, -0.033049f, -0.031166f, 0.068335f, -0.078031f, -0.090824f, -0.064111f, -0.007476f, -0.105828f, -0.091785f, 0.028529f, 0.003934f, 0.102548f, 0.085035f, -0.029441f, -0.010569f, 0.094088f, 0.025331f, -0.035817f, 0.065352f, 0.093873f, 0.017259f, -0.065707f, 0.073551f, -0.011575f, 0.027804f, 0.006174f, 0.072088f, -0.073253f, -0.050819f, -0.068133f, -0.067832f, -0.043943f, -0.082709f, 0.032221f, -0.046498f, -0.065893f, -0.067464f, -0.008561f, 0.103382f, -0.015772f, -0.022452f, -0.0979f, -0.04704f, -0.066701f, 0.06308f, -0.089427f, -0.071187f, -0.05524f, -0.051878f, 0.067879f, 0.066848f, 0.011399f, -0.024539f, -0.017442f, 0.005607f, 0.047017f, -0.021797f, -0.013819f, 0.090649f, 0.016124f, -0.004351f, -0.078604f, -0.051542f, -0.059745f, 0.038068f, -0.062423f, -0.078932f, -0.013645f, 0.057655f, 0.030867f, 0.06307f, 0.04442f, 0.014539f, 0.012207f, -0.06609f, -0.001582f, 0.019209f, -0.078911f, 0.00895f, -0.092186f, 0.02299f, -0.051682f, -0.090232f, -0.06076f, 0.066576f, 0.03321f, -0.057147f, -0.089156f, 0.020321f, -0.072015f, 0.06352f, -0.013153f, 0.055437f, -0.021372f, 0.030495f, 0.040903f, 0.027747f, 0.057159f, 0.011585f, 0.008695f, -0.022486f, 0.068282f, -0.004463f, -0.031664f, 0.004127f, -0.05115f, -0.050568f, -0.040204f, -0.006288f, 0.03405f, -0.027412f, -0.08021f, 0.021149f, 0.086053f, -0.032472f, 0.012997f, -0.050159f, 0.056263f, -0.092415f, -0.065641f, 0.108167f, 0.031851f, -0.007109f, 0.072184f, 0.101549f, -0.047009f, 0.046449f, -0.025666f, 0.030125f, 0.026489f, 0.082721f, -0.085454f, -0.111893f, 0.052214f, 0.005324f, 0.029902f, 0.063853f, -0.018391f, -0.022548f, 0.069173f, -0.014364f, 0.014216f, 0.075972f, -0.052509f, -0.110442f, -0.063551f, 0.073062f, -1.8e-05f, 0.103357f, -0.006724f, -0.036723f, 0.053628f, 0.016913f, 0.069056f, 0.01649f, -0.012425f, -0.053962f, -0.081339f, -0.027223f, -0.092975f, -0.004832f, -0.041428f, 0.050592f, -0.041207f, -0.095168f, 0.076999f, -0.074844f, 0.059779f, 0.072932f, -0.080755f, 0.021703f, -0.021137f, 0.069492f, 0.030835f, -0.059413f, -0.108632f, -0.016436f, 0.062359f, 0.075043f, -0.083988f, 0.07767f, -0.072998f, -0.062684f, 0.091355f, -0.026467f, -0.09248f, 0.012109f, -0.097354f, -0.101231f, 0.017249f, -0.044974f, 0.019149f, -0.023728f, -0.081778f, 0.088555f, -0.05498f, -0.085334f, -0.051671f, -0.060289f, -0.049308f, -0.042995f, 0.050187f, -0.071419f, -0.013247f, -0.072047f, 0.10812f, -0.056036f, 0.008577f, 0.00575f, 0.044442f, -0.037785f, 0.05871f, -0.10897f, 0.070539f, -0.065571f, 0.000104f, -0.074651f, -0.016933f, 0.014206f, -0.058399f, -0.024642f, 0.026464f, 0.053414f, 0.025931f, -0.010753f, -0.083583f, -0.060753f, 0.074856f, -0.104453f, 0.007987f, 0.064061f, -0.046383f, 0.009138f, -0.01454f, -0.065001f, 0.059226f, 0.094871f, 0.034994f, -0.093129f, 0.013032f, -0.062588f, -0.043934f, -0.050091f, 0.010697f, 0.006177f, -0.041925f, 0.071708f, -0.050591f, 0.060888f, -0.108681f, -0.047531f, 0.048982f, -0.004409f, 0.033228f, -0.002141f, -0.013683f, -0.05914f, -0.05011f, 0.094043f, 0.00542f, 0.009675f, 0.025356f, -0.088636f, 0.012091f, 0.069593f, -0.002069f, -0.02678f, -0.023776f, 0.061836f, 0.012172f, 0.045223f, 0.028752f, -0.073791f, 0.107406f, 0.024109f, 0.030467f, -0.10205f, 0.095511f, -0.014732f, 0.074461f, -0.002659f, 0.012536f, 0.083917f, -0.020973f, -0.050996f, -0.015238f, -0.032103f, 0.048866f, 0.082166f, -0.103763f, -0.006336f, -0.040861f, -0.050475f, 0.01647f, 0.055923f, -0.001683f, -0.070246f, 0.06687f, 0.001885f, 0.056324f, 0.081465f, -0.014953f, -0.021514f, -0.051961f, 0.046318f, 0.109433f, -0.058299f, 0.010446f, 0.000907f, 0.081915f, -0.062613f, 0.088671f, 0.015464f, 0.042772f, 0.038644f, -0.050878f, 0.099462f, 0.104529f, 0.060736f, 0.071831f, -0.048841f, 0.054783f, 0.061213f, -0.055248f, -0.079026f, 0.05415f, 0.006973f, -0.08384f, -0.004994f, -0.050076f, 0.036796f, 0.000991f, 0.037987f, 0.049039f, 0.039818f, 0.03697f, 0.064473f, -0.065344f, 0.016624f, 0.036821f, -0.037411f, -0.072255f, 0.044967f, 0.057049f, 0.061516f, -0.003414f, 0.025759f, -0.067418f, -0.046533f, 0.031021f, -0.058621f, 0.085448f, -0.067399f, 0.065844f, -0.024578f, 0.05864f, -0.032059f, 0.05928f, 0.08931f, 0.029607f, -0.074212f, 0.080197f, 0.015887f, -0.062501f, -0.006531f, 0.049178f, 0.068584f, 0.067771f, -0.083056f, 0.057614f, 0.014096f, -0.028425f, 0.00267f, 0.075438f, 0.084067f, 0.031277f, -0.09082f, 0.051119f, -0.074506f, -0.03146f, -0.018332f, 0.007275f, -0.036265f, -0.021994f, 0.065529f, -0.054809f, 0.055715f, -0.102361f, -0.070362f, 0.074492f, -0.018189f, -0.098142f, 0.006498f, -0.01745f, -0.065649f, -0.014538f, 0.02746f, 0.039053f, 0.088821f, 0.011252f, -0.067755f, -0.085645f, -0.009722f, -0.048354f, 0.065317f, -0.066324f, -0.010367f, 0.006199f, -0.044319f, 0.040554f, 0.007358f, 0.097194f, 0.081343f, 0.012091f, -0.02443f, 0.030367f, 0.008603f, -0.05379f, -0.054805f, -0.010824f, -0.043958f, -0.011525f, -0.082915f, 0.045491f, -0.069096f, 0.033608f, -0.075086f, -0.082016f, 0.031797f, 0.080712f, -0.009589f, 0.05983f, -0.095622f, 0.004109f, 0.050226f, -0.026902f, -0.055706f, -0.076687f, -0.034939f, 0.047465f, 0.108523f, -0.023497f, -0.026738f, -0.043075f, -0.091286f, -0.005121f, 0.036529f, 0.023219f, -0.081316f, 0.040211f, 0.04408f, 0.01424f, 0.101797f, -0.054589f, 0.074294f, -0.058167f, -0.049636f, -0.044403f, 0.064885f, 0.042604f, -0.016944f, -0.033787f, -0.097541f, 0.025629f, 0.104261f, 0.068548f, -0.068176f, -0.030766f, -0.028306f, -0.004296f, -0.061061f, 0.051156f, 0.068981f, 0.03809f, -0.0916f, 0.067278f, -0.020055f, -0.092076f, 0.017681f, 0.049287f, 0.049068f, -0.027161f, 0.064238f, -0.018793f, 0.02234f, 0.066351f, 0.033865f, -0.089011f, 0.037335f, 0.096069f, 0.064103f, -0.008147f, 0.054373f, -0.07688f, -0.035469f, 0.061824f, -0.080764f, -0.001869f, 0.053779f, 0.007271f, -0.097084f, -0.016726f, 0.035933f, -0.036814f, 0.090061f, 0.085855f, -0.080126f, -0.064956f, -0.030578f, 0.003974f, -0.077844f, -0.045663f, 0.06942f, 0.028213f, 0.00457f, 0.030768f, -0.111725f, -0.064859f, 0.029103f, 0.034443f, 0.083394f, -0.000787f, 0.016849f, -0.00349f, 0.070704f, 0.059552f, -0.009979f, -0.010179f, -0.102347f, 0.040722f, 0.04895f, -0.02501f, 0.017274f, 0.061069f, 0.082841f, -0.059721f, 0.05426f, 0.008618f, -0.093176f, -0.040001f, 0.026029f, 0.081985f, -0.066533f, 0.019157f, 0.035516f, -0.031796f, 0.060643f, -0.064159f, -0.064117f, -0.086257f, 0.012164f, -0.035219f, -0.088264f, 0.063323f, -0.049746f, 0.001421f, -0.033168f, 0.024176f, 0.013789f, 0.032501f, -0.052631f, -0.103153f, 0.066628f, 0.08069f, 0.087025f, -0.063125f, 0.072408f, -0.002242f, 0.020697f, 0.012634f, 0.02479f, 0.023931f, 0.014865f, 0.022072f, -0.058315f, 0.063568f, 0.059857f, 0.080129f, 0.052017f, 0.00791f, 0.079634f, 0.021867f, -0.04979f, -0.074203f, 0.005204f, 0.037532f, 0.077658f, -0.026705f, 0.08341f, 0.029348f, 0.057015f, 0.072795f, 0.09257f, -0.051243f, -0.014597f, 0.091161f, 0.048487f, -0.029058f, 0.008099f, 0.046029f, -0.097031f, -0.017582f, -0.070118f, 0.015517f, 0.069859f, -0.079435f, 0.080537f, 0.00176f, 0.037742f, -0.038567f, 0.005658f, 0.075931f, 0.032169f, -0.081854f, -0.03793f, -0.036922f, 0.10647f, 0.041334f, 0.016801f, -0.10068f, 0.07155f, -0.07546f, -0.060701f, 0.059672f, -0.106542f, -0.081642f, 0.098461f, -0.049909f, 0.069879f, 0.04832f, -0.088765f, 0.057553f, -0.043058f, 0.021558f, -0.010841f, -0.004491f, 0.07489f, -0.042605f, -0.027086f, -0.04116f, -0.011971f, 0.029355f, 0.069442f, 0.090706f, -0.070356f, 0.021423f, 0.023158f, 0.024533f, 0.056119f, 0.097143f, 0.037792f, -0.078573f, 0.081413f, 0.060832f, -0.041586f, -0.087291f, 0.073209f, 0.106842f, -0.088834f, 0.044924f, -0.108604f, -0.077579f, 0.046796f, 0.055928f, -0.016134f, -0.011806f, 0.057008f, 0.055073f, -0.031853f, 0.055436f, -0.067469f, -0.008048f, 0.058389f, 0.033885f, -0.006804f, 0.044668f, -0.072733f, -0.057024f, -0.066553f, -0.09098f, -0.075173f, 0.087804f, 0.081159f, 0.002316f, -0.011937f, 0.002178f, 0.096407f, 0.076106f, -0.047095f, -0.060436f, -0.103192f, -0.009967f, -0.032896f, -0.06128f, 0.077074f, 0.064914f, 0.058503f, -0.002211f, 0.061329f, 0.100834f, 0.085166f, -0.038037f, 0.059525f, -0.024697f, -0.088449f, 0.033981f, 0.045618f, 0.085089f, -0.018535f, -0.044091f, -0.09313f, -0.024306f, 0.029568f, -0.018202f, -0.059661f, -0.008648f, 0.09045f, -0.016663f, 0.001703f, 0.008594f, -0.037217f, -0.101791f, -0.037478f, -0.013245f, 0.032774f, -0.02048f, -0.017008f, 0.062413f, 0.02423f, 0.093581f, -0.108397f, 0.044546f, -0.09588f, -0.035433f, 0.090901f, 0.054425f, 0.028332f, -0.007797f, -0.07726f, -0.033702f, -0.017f, -0.003913f, 0.003732f, -0.080634f, 0.023083f, -0.022901f, -0.085849f, 0.07391f, -0.047464f, -0.060452f, 0.033383f, -0.040966f, 0.009049f, -0.11082f, -0.015863f, -0.103351f, -0.042909f, -0.041171f, 0.108264f, -0.038023f, 0.060944f, -0.024707f, 0.088573f, 0.021012f, -0.10409f, -0.067469f, -0.080035f, -0.088352f, -0.04329f, 0.045158f, 0.041228f, -0.058221f, -0.023957f, 0.062043f, -0.096487f, 0.00124f, -0.090214f, 0.088012f, 0.003015f, 0.096074f, -0.062634f, 0.109681f, -0.072307f, -0.073181f, 0.070516f, 0.043594f, -0.042886f, -0.035962f, -0.021987f, 0.077816f, 0.039469f, 0.068475f, 0.059765f, -0.063126f, 0.002731f, 0.107077f, -0.061796f, -0.017701f, 0.037209f, 0.103765f, -0.089609f, -0.029196f, 0.057474f, 0.003502f, 0.070769f, -0.067287f, 0.022705f, 0.03111f, 0.078295f, 0.057828f, -0.022843f, 0.00346f, -0.083464f, 0.023452f, -0.085175f, 0.016397f, -0.008772f, 0.092981f, -0.048243f, -0.022584f, 0.085953f, 0.020409f, 0.047746f, 0.001456f, 0.049608f, 0.057595f, -0.07511f, 0.061019f, -0.075012f, 0.053723f, 0.024203f, -0.033441f, 0.10238f, 0.081281f, -0.032088f, -0.043574f, -0.012269f, -0.040865f, -0.062015f, 0.089673f, 0.076378f, 0.083193f, -0.019565f, 0.041955f, -0.034262f, 0.05986f, 0.076626f, -0.006186f, 0.008861f, 0.020117f, -0.067377f, -0.063814f, -0.034982f, 0.067168f, 0.026844f, 0.061057f, 0.003773f, -0.074406f, 0.004912f, -0.104814f, -0.001411f, -0.057776f, 0.057827f, -0.070795f, 0.010762f, -0.020551f, 0.059025f, 0.024951f, 0.009931f, 0.003111f, -0.064022f, -0.004588f, -0.047986f, -0.058791f, 0.063933f, -0.032003f, -0.051869f, -0.086253f, -0.097241f, -0.058249f, -0.025521f, 0.057584f, -0.041937f, 0.075408f, 8.9e-05f, -0.042162f, -0.067062f, -0.097717f, -0.011891f, -0.016686f, -0.038696f, 0.072828f, -0.068391f, -0.067821f, -0.063912f, 0.006819f, 0.028986f, 0.065317f, -0.060035f, -0.082338f, -0.013036f, -0.034433f, 0.08574f, -0.096905f, -0.046025f, 0.031906f, -0.015673f, 0.028397f, 0.070475f, 0.024148f, 0.019295f, 0.049505f, -0.099706f, -0.094491f, 0.036302f, -0.039077f, 0.112837f, 0.046158f, 0.092877f, -0.058657f, 0.010611f, -0.0852f, 0.029613f, -0.091801f, 0.023512f, -0.050738f, 0.027299f, -0.041956f, -0.099416f, 0.04782f, 0.000272f, 0.05649f, -0.09963f, 0.017054f, -0.07472f, -0.058492f, 0.055836f, -0.067688f, -0.071727f, -0.081538f, -0.058334f, 0.069148f, 0.001129f, 0.045398f, -0.059881f, 0.011043f, 0.075789f, -0.004109f, 0.087505f, -0.036537f, 0.104278f, -0.081445f, 0.04571f, -0.067546f, -0.056616f, 0.000371f, -0.043928f, -0.044678f, -0.000538f, 0.085879f, 0.037363f, -0.05378f, 0.090903f, -0.051878f, 0.039154f, -0.05393f, 0.039923f, 0.016187f, -0.001041f, -0.016118f, -0.035881f, 0.036488f, 0.077858f, -0.077214f, 0.05886f, 0.086848f, 0.029032f, -0.057402f, -0.02275f, 0.061804f, -0.042642f, -0.103928f, -0.06156f, -0.038228f, -0.032809f, -0.018489f, 0.047317f, -0.041744f, -0.00043f, 0.055081f, 0.042712f, -0.048908f, -0.041974f, -0.079943f, -0.071392f, -0.004432f, -0.036033f, 0.012517f, 0.031667f, 0.030268f, 0.102949f, -0.059038f, 0.059972f, -0.104225f, -0.079034f, -0.089602f, 0.038246f, -0.006436f, -0.075595f, -0.063156f, 0.023466f, 0.091339f, -0.045582f, -0.029282f, -0.087852f, 0.01834f, 0.097132f, -0.06799f, 0.005586f, 0.066289f, 0.027711f, 0.008995f, 0.037971f, 0.043876f, 0.057225f, 0.012212f, -0.034111f, -0.042618f, 0.096839f, -0.094574f, -0.028496f, 0.041214f, 0.021927f, -0.004876f, -0.088337f, -0.084468f, 0.031387f, -0.013599f, -0.034207f, -0.038037f, -0.000447f, 0.049168f, 0.003253f, -0.067698f, -0.079612f, -0.073657f, -0.098882f, 0.0487f, 0.081638f, -0.017005f, 0.090232f, 0.055417f, 0.082562f, -0.025051f, 0.079194f, 0.049423f, -0.012891f, 0.081268f, -0.105707f, 0.027704f, 0.01871f, -0.096868f, 0.058384f, -0.05025f, -0.043106f, 0.012163f, 0.075514f, 0.012966f, 0.003818f, -0.014934f, -0.05396f, -0.014258f, -0.040305f, -0.012782f, -0.027868f, 0.084332f, 0.067171f, 0.050693f, 0.008394f, 0.040914f, -0.021203f, -0.006061f, 0.075552f, -0.014564f, -0.052681f, 0.000945f, 0.01718f, -0.068951f, -0.088653f, -0.05147f, 0.064761f, 0.024109f, -0.06903f, 0.024991f, 0.022367f, -0.002458f, 0.064423f, -0.110049f, -0.053254f, 0.107076f, 0.008531f, -0.090428f, -0.038454f, -0.083013f, 0.000664f, 0.081291f, 0.032959f, 0.008025f, -0.017467f, -0.067632f, 0.011602f, 0.081814f, -0.109203f, 0.020357f, -0.029875f, 0.021804f, 0.055781f, -0.004634f, -0.045566f, -0.021514f, -0.076622f, -0.069314f, -0.014064f, 0.036931f, -0.05927f, 0.092196f, 0.049176f, 0.047262f, 0.040679f, -0.112925f, 0.067593f, 0.069488f, -0.082024f, 0.018653f, 0.017916f, -0.070835f, 0.053455f, 0.012192f, -0.054961f, 0.082429f, -0.038987f, 0.053254f, 0.0055f, 0.043942f, -0.083619f, 0.078594f, -0.039502f, -0.065953f, 0.001992f, -0.01871f, 6.9e-05f, -0.100101f, -0.040373f, 0.042521f, 0.075043f, -0.061058f, 0.048591f, -0.099396f, -0.102665f, -0.033132f, -0.083787f, -0.073164f, 0.038854f, 0.084965f, 0.059162f, -0.017763f, 0.086471f, 0.07937f, 0.009674f, -0.015038f, -0.079835f, -0.05503f, -0.097425f, -0.002429f, 0.050051f, 0.026732f, 0.060476f, 0.038774f, 0.052006f, -0.05728f, -0.046943f, 0.076158f, -0.042802f, -0.046455f, 0.064844f, 0.078306f, 0.03565f, -0.036923f, 0.03816f, -0.084962f, -0.054589f, -0.016383f, 0.081804f, -0.042801f, -0.1036f, -0.040265f, -0.03793f, -0.099872f, -0.008692f, -0.041342f, 0.036008f, -0.078812f, -0.005664f, -0.026979f, 0.044802f, 0.093264f, -0.083828f, 0.061437f, 0.035256f, -0.108866f, 0.062311f, -0.005738f, 0.045068f, -0.014819f, 0.042315f, -0.060132f, -0.047686f, -0.015543f, 0.010941f, 0.057064f, 0.04781f, 0.053775f, -0.012246f, 0.084381f, -0.07254f, -0.055052f, 0.024332f, -0.061754f, -0.072091f, 0.064886f, -0.087939f, 0.082137f, 0.083971f, 0.085027f, 0.008591f, -0.037341f, 0.045295f, -0.078968f, 0.008294f, -0.016726f, 0.062061f, -0.092875f, -0.024437f, -0.020225f, -0.055165f, -0.015177f, 0.070561f, -0.005619f, -0.032873f, 0.014348f, -0.095454f, -0.025842f, 0.069979f, 0.012637f, -0.105293f, 0.007536f, -0.074161f, 0.109154f, 0.074093f, -0.078876f, -0.030817f, 0.010332f, -0.074241f, 0.029672f, 0.073433f, -0.082011f, -0.087639f, -0.025087f, 0.077819f, -0.032462f, -0.05826f, -0.073992f, 0.089149f, 0.062651f, 0.014696f, 0.021243f, 0.065563f, -0.029558f, 0.014124f, 0.049759f, -0.000235f, -0.077729f, 0.08005f, 0.050486f, -0.01669f, 0.028519f, 0.041786f, -0.01473f, 0.058112f, 0.035857f, -0.000591f, -0.044673f, 0.02798f, 0.003249f, -0.001097f, -0.071929f, 0.039243f, -0.008435f, 0.001948f, 0.047832f, -0.04311f, -0.060855f, 0.037425f, -0.017326f, -0.05202f, -0.04109f, -0.018373f, 0.052909f, 0.048929f, 0.061927f, 0.084534f, -0.084397f, 0.083938f, -0.002874f, -0.049829f, 0.103434f, 0.050434f, 0.094941f, 0.017089f, 0.059293f, 0.009498f, -0.008845f, 0.093496f, 0.034431f, 0.024722f, -0.024973f, -0.082003f, -0.086547f, -0.051376f, 0.028465f, -0.060915f, -0.08034f, -0.065147f, 0.085906f, -0.04373f, -0.057892f, -0.026424f, 0.015466f, 0.034921f, 0.070827f, 0.026645f, 0.023771f, 0.052614f, 0.021415f, 0.062991f, 0.003131f, 0.057116f, 0.068364f, 0.032781f, -0.035154f, -0.057206f, 0.014091f, 0.010509f, -0.100849f, 0.062052f, -0.039049f, -0.082219f, -0.053487f, 0.043845f, 0.017386f, 0.071156f, -0.087096f, 0.070535f, 0.04031f, -0.072079f, 0.038705f, 0.062927f, -0.07288f, -0.057862f, 0.034786f, -0.035374f, 0.06473f, 0.023863f, 0.064919f, -0.090279f, 0.054399f, -0.022304f, -0.009966f, -0.032861f, -0.06035f, -0.056738f, -0.015694f, -0.036123f, -0.05174f, 0.107052f, -0.011412f, 0.017395f, -0.041011f, 0.02611f, -0.013524f, 0.033523f, 0.030991f, 0.022585f, 0.058139f, -0.050943f, -0.073592f, -0.01525f, 0.014156f, -0.068295f, 0.052954f, 0.056556f, 0.063291f, 0.054338f, -0.089568f, 0.018231f, -0.014666f, -0.037629f, 0.018178f, -0.026556f, 0.022016f, 0.020576f, 0.020717f, -0.080016f, -0.0386f, 0.057437f, -0.026049f, 0.006428f, -0.026519f, -0.070275f, -0.071562f, 0.041924f, 0.014477f, 0.079337f, -0.02903f, 0.039748f, 0.006859f, -0.021659f, 0.085509f, -0.021671f, 0.088805f, 0.016364f, -0.085461f, -0.070918f, 0.09453f, -0.022873f, 0.000907f, -0.000548f, -0.064448f, -0.082529f, -0.055844f, 0.035893f, 0.018788f, -0.044099f, -0.074216f, -0.019696f, -0.034294f, 0.037204f, 0.042449f, -0.073366f, -0.037481f, 0.044397f, 0.022471f, 0.003514f, -0.063128f, -0.054724f, -0.101549f, 0.057534f, 0.069363f, 0.065892f, -0.06357f, 0.062831f, 0.067445f, 0.10488f, 0.054195f, -0.035287f, -0.043418f, 0.029414f, 0.048337f, 0.043236f, -0.023148f, -0.009811f, -0.035246f, 0.003931f, 0.039862f, 0.024139f, -0.02362f, -0.010069f, 0.058561f, -0.061001f, -0.060714f, 0.008216f, -0.01835f, -0.085033f, 0.032125f, -0.007163f, 0.008197f, 0.079563f, -0.018422f, -0.09131f, -0.073103f, -0.022192f, 0.057177f, 0.025369f, 0.080148f, -0.031541f, -0.07984f, -0.052371f, 0.102618f, 0.032184f, 0.081309f, 0.00778f, -0.038529f, 0.097871f, -0.049105f, -0.031106f, -0.029004f, 0.03786f, -0.005248f, 0.076266f, 0.102276f, -0.065753f, 0.09452f, 0.065731f, 0.02441f, -0.022512f, 0.022869f, 0.072315f, 0.053136f, 0.042896f, -0.046755f, -0.073607f, 0.000778f, -0.048105f, 0.047099f, -0.07118f, 0.003881f, 0.056813f, -0.081372f, 0.031377f, -0.062401f, -0.054468f, -0.049371f, -0.102827f, 0.037971f, -0.021134f, 0.085119f, -0.068461f, 0.065712f, -0.002529f, -0.084676f, 0.06321f, -0.083081f, 0.013749f, -0.062524f, -0.024934f, 0.006264f, 0.095582f, -0.026839f, -0.017543f, -0.044448f, -0.017266f, -0.059986f, 0.011683f, 0.001156f, 0.030608f, -0.041806f, -0.029615f, -0.096834f, -0.07352f, -0.033746f, -0.014587f, 0.045212f, 0.038446f, -0.005845f, 0.06598f, 0.040186f, 0.01119f, -0.060775f, -0.056822f, -0.007531f, 0.070754f, -0.034364f, 0.096916f, 0.040708f, -0.021606f, 0.020158f, -0.007271f, 0.082897f, -0.105207f, -0.069147f, -0.06607f, 0.046182f, -0.04819f, 0.034905f, 0.002855f, 0.072067f, 0.11453f, -0.060358f, -0.052029f, 0.044286f, -0.105221f, 0.061477f, -0.010253f, -0.037115f, 0.023074f, -0.043703f, -0.053316f, -0.055523f, 0.050698f, 0.050315f, 0.032641f, -0.034969f, 0.041967f, -0.051402f, 0.089126f, -0.019605f, -0.005196f, -0.054059f, 0.028264f, 0.095003f, 0.00557f, 0.020041f, -0.047635f, -0.044469f, -0.065238f, -0.010747f, -0.055675f, 0.035752f, -0.023466f, 0.041018f, -0.096444f, 0.077144f, -0.029984f, -0.061681f, 0.013428f, 0.084982f, 0.033771f, -0.047678f, -0.025199f, 0.034163f, -0.089779f, -0.026314f, 0.01109f, 0.061577f, -0.045249f, 0.071801f, 0.069548f, -0.107329f, -0.07324f, 0.028652f, -0.019794f, -0.077474f, -0.007717f, 0.016548f, 0.087522f, -0.044539f, -0.081019f, -0.036899f, 0.016159f, 0.039413f, -0.042963f, -0.036659f, -0.1126f, -0.075892f, -0.068772f, -0.050084f, -0.023545f, -0.07953f, -0.024575f, -0.051668f, 0.02815f, -0.018729f, 0.012878f, 0.057138f, -0.095796f, -0.036196f, 0.078595f, -0.107756f, -0.022907f, -0.00019f, 0.054273f, -0.04706f, 0.064614f, -0.114089f, 0.006407f, -0.019044f, 0.068842f, -0.025048f, -0.085112f, 0.054711f, -0.109767f, -0.048117f, 0.015226f, 0.033353f, -0.020815f, -0.093457f, 0.073781f, -0.091247f, 0.059105f, -0.070213f, -0.087653f, -0.063251f, -0.079384f, 0.062543f, 0.069917f, -0.060289f, -0.087286f, 0.025162f, 0.048744f, 0.020536f, -0.10472f, 0.063039f, 0.05472f, 0.053406f, -0.047828f, -0.100821f, 0.099686f, -0.016578f, 0.055916f, -0.095142f, -0.015817f, -0.010935f, -0.085594f, -0.0354f, 0.076632f, 0.02877f, 0.062917f, 0.092118f, -0.037953f, 0.056824f, -0.083592f, 0.004856f, 0.024815f, -0.025502f, -0.06615f, -0.000688f, 0.078582f, 0.033307f, -0.006214f, 0.07963f, 0.053939f, -0.099655f, 0.04198f, 0.035439f, -0.102868f, 0.070086f, -0.021313f, -0.058549f, 0.003638f, 0.080174f, -0.044572f, 0.094792f, -0.071677f, -0.067081f, 0.020546f, -0.008474f, 0.040197f, -0.078453f, -0.063075f, 0.031509f, -0.014084f, -0.034835f, 0.049794f, 0.06519f, 0.035898f, 0.038428f, 0.103016f, -0.097456f, -0.082069f, 0.001456f, -0.058032f, -0.05466f, 0.10352f, -0.104422f, -0.084498f, 0.092771f, -0.051374f, -0.081368f, 0.009006f, 0.080581f, -0.054899f, 0.068081f, 0.083781f, -0.056165f, -0.000286f, 0.07014f, -0.082344f, -0.077126f, -0.042541f, -0.045255f, -0.046421f, -0.073448f, 0.027346f, -0.066327f, 0.00517f, -0.091388f, -0.017792f, -0.032826f, 0.065711f, 0.04149f, 0.083313f, -0.004592f, -0.053339f, -0.000766f, 0.020165f, 0.023513f, 0.092696f, 0.008992f, -0.04923f, 0.091777f, -0.056732f, -0.006987f, 0.06365f, 0.033578f, 0.000633f, 0.025964f, -0.019594f, -0.033659f, 0.037603f, 0.05854f, 0.068392f, 0.082609f, 0.076977f, -0.075894f, 0.09006f, -0.062757f, -0.068383f, 0.032509f, 0.028963f, 0.075445f, 0.0661f, -0.017548f, 0.009762f, 0.021013f, 0.066862f, 0.027289f, -0.033802f, 0.050396f, -0.036352f, -0.042104f, -0.096468f, 0.062716f, -0.102566f, -0.025962f, 0.102605f, 0.004964f, -0.063162f, 0.108685f, 0.060615f, -0.094794f, -0.046603f, 0.033212f, -0.074364f, 0.023022f, -0.081188f, 0.019368f, 0.016096f, 0.091753f, -0.06027f, 0.008617f, -0.042087f, 0.034865f, -0.045316f, 0.087678f, -0.027067f, -0.010088f, 0.040998f, 0.066004f, -0.015625f, 0.04181f, -0.084304f, -0.042f, 0.028942f, 0.077234f, -0.064049f, -0.088181f, 0.101148f, -0.063491f, -0.080368f, 0.000492f, -0.054971f, -0.025334f, 0.008046f, -0.044775f, 0.112168f, -0.066834f, 0.086588f, 0.05684f, -0.001774f, 0.10128f, -0.055909f, -0.073388f, -0.001096f, -0.092769f, -0.016042f, 0.070518f, -0.006326f, -0.053129f, -0.059914f, 0.091393f, 0.041375f, -0.059542f, -0.019702f, 0.033496f, 0.014162f, 0.066645f, -0.085699f, -0.05967f, 0.015641f, -0.004812f, -0.065288f, -0.08044f, 0.032416f, -0.004987f, 0.015299f, 0.056429f, 0.017262f, -0.044443f, 0.022416f, -0.053647f, -0.048241f, 0.030503f, -0.094112f, -0.107811f, 0.093604f, 0.07827f, 0.069224f, -0.041369f, 0.061184f, -0.020833f, -0.080985f, 0.045792f, 0.058727f, 0.032046f, 0.089083f, 0.088939f, -0.077768f, 0.044467f, 0.016365f, 0.036629f, 0.109374f, 0.080695f, -0.017487f, 0.099348f, 0.084218f, 0.053125f, 0.085421f, -0.017707f, 0.048482f, -0.086342f, -0.003092f, 0.032708f, -0.006393f, 0.074848f, -0.015455f, -0.03497f, -0.002139f, 0.092821f, 0.046455f, 0.083323f, -0.024197f, 0.040348f, 0.009786f, -0.065449f, 0.057815f, -0.099848f, 0.024759f, -0.055288f, -0.045842f, 0.100632f, -0.005401f, 0.012674f, 0.015135f, -0.016302f, 0.056688f, -0.105751f, 0.046956f, -0.046657f, 0.065201f, -0.060807f, -0.07333f, -0.076447f, 0.020366f, -0.037592f, 0.034097f, -0.087101f, -0.037743f, 0.047022f, -0.080771f, 0.043272f, -0.090753f, 0.06778f, 0.057286f, -0.057793f, -0.008527f, 0.008891f, -0.021152f, -0.040659f, -0.037863f, 0.028823f, -0.070871f, -0.038759f, -0.077331f, -0.059942f, -0.102038f, 0.033164f, -0.024731f, -0.034537f, -0.011701f, -0.060025f, -0.01481f, 0.029802f, -0.070683f, 0.009753f, 0.001688f, -0.075f, -0.041821f, 0.006179f, -0.005928f, 0.044745f, -0.057669f, -0.022944f, 0.076067f, -0.065788f, 0.067127f, -0.01094f, 0.011144f, 0.040397f, -0.003678f, 0.078135f, -0.046905f, -0.083868f, -0.059108f, 0.099871f, -0.097096f, 0.017728f, 0.07291f, 0.057734f, 0.081022f, 0.109144f, -0.003539f, -0.061305f, 0.0096f, 0.050047f, -0.020062f, -0.02917f, 0.046773f, 0.049781f, 0.020457f, 0.020133f, 0.013789f, 0.057735f, 0.070701f, -0.084288f, 0.104939f, -0.025817f, -0.035138f, -0.022611f, 0.052383f, 0.032588f, -0.076943f, -0.029249f, -0.111848f, 0.065698f, -0.059881f, -0.086954f, 0.041537f, -0.071478f, 0.018378f, -0.049855f, 0.065156f, 0.088718f, -0.07766f, 0.080631f, -0.01692f, -0.103133f, 0.019742f, -0.01752f, 0.091481f, -0.047316f, 0.060507f, -0.067221f, -0.035288f, 0.013742f, -0.07567f, -0.054254f, -0.060788f, 0.051946f, 0.095757f, -0.067713f, -0.003345f, -0.058335f, -0.077126f, -0.088938f, -0.026232f, -0.003421f, 0.045285f, -0.01035f, -0.041167f, -0.093497f, 0.013169f, -0.067638f, -0.012027f, -0.110921f, -0.065913f, 0.017647f, -0.085294f, 0.027267f, 0.071707f, 0.063933f, -0.048867f, 0.011987f, 0.070912f, 0.045038f, 0.067216f, -0.032865f, 0.017974f, 0.064685f, -0.023979f, 0.045715f, -0.003037f, 0.027594f, 0.022162f, -0.023238f, 0.008374f, 0.007535f, 0.063481f, 0.027804f, 0.026079f, 0.078477f, -0.098888f, -0.068345f, -0.021725f, 0.101977f, -0.049722f, 0.026782f, -0.063484f, -0.031779f, -0.043975f, 0.030298f, -0.069081f, 0.060119f, -0.054845f, 0.033649f, -0.00951f, -0.01119f, -0.085487f, -0.069317f, -0.003609f, 0.040696f, -0.07366f, -0.075345f, -0.104654f, -0.056127f, -0.069218f, 0.022446f, -0.074357f, 0.020839f, -0.006298f, -0.06257f, 0.108907f, 0.007394f, -0.02299f, -0.075935f, -0.053154f, 0.006122f, -0.036795f, 9.6e-05f, -0.030546f, -0.101207f, -0.025497f, -0.018922f, -0.031485f, 0.015481f, -0.005479f, 0.105673f, 0.008251f, -0.02815f, -0.041668f, 0.015025f, 0.089069f, 0.012063f, 0.048793f, 0.036413f, 0.088733f, -0.021541f, 0.063202f, 0.018953f, -0.090134f, -0.079092f, 0.00095f, 0.023818f, 0.066993f, -0.087123f, 0.094875f, 0.068072f, 0.060797f, 0.023163f, -0.012459f, 0.048442f, -0.067064f, -0.053937f, -0.05165f, 0.108882f, -0.07716f, 0.056361f, -0.020511f, -0.100729f, -0.08466f, 0.080144f, 0.061001f, 0.012311f, -0.062292f, -0.113749f, 0.06685f, -0.03267f, -0.065696f, -0.064771f, 0.075216f, 0.037679f, 0.015689f, 0.098109f, 0.090455f, 0.024439f, 0.076806f, -0.048705f, -0.112509f, 0.092681f, -0.026324f, 0.084699f, -0.061854f, -0.03053f, 0.065971f, 0.050035f, -0.072895f, 0.017853f, -0.082057f, -0.068845f, 0.005956f, -0.096571f, 0.005499f, 0.022701f, 0.096752f, 0.084911f, 0.01885f, 0.013162f, 0.042022f, 0.087191f, 0.079778f, -0.087814f, 0.076862f, 0.045358f, -0.097044f, 0.046852f, 0.016731f, 0.086019f, -0.016405f, -0.004851f, 0.075576f, -0.019658f, 0.014224f, -0.033674f, -0.024521f, -0.046133f, -0.089489f, 0.030274f, 0.051868f, 0.03705f, -0.033791f, 0.002705f, 0.01313f, 0.045594f, -0.018327f, -0.085825f, 0.061934f, 0.038941f, -0.074943f, -0.051272f, -0.031165f, -0.000247f, -0.023703f, 0.008344f, 0.063482f, 0.035369f, -0.015717f, 0.066082f, 0.025923f, 0.029349f, 0.016616f, -0.06923f, 0.030328f, -0.034449f, 0.00729f, -0.086033f, 0.067742f, -0.014152f, 0.04736f, -0.068933f, 0.073631f, 0.012093f, -0.080665f, -0.044198f, 0.11195f, 0.040423f, -0.023262f, 0.081207f, -0.030573f, 0.037031f, -0.050787f, 0.02603f, -0.01212f, -0.001887f, -0.040541f, 0.081631f, -0.075353f, -0.069747f, -0.025084f, -0.083675f, 0.073629f, 0.073665f, -0.0279f, -0.014627f, -0.099823f, 0.058554f, 0.068365f, -0.005796f, -0.00179f, 0.045142f, 0.004149f, -0.031319f, -0.040276f, -0.006939f, 0.103736f, 0.007781f, -0.103291f, 0.072498f, -0.02125f, -0.086373f, -0.09593f, -0.056856f, 0.014325f, -0.011608f, 0.083989f, 0.051312f, -0.047864f, 0.104588f, 0.017369f, -0.108799f, 0.00327f, 0.064286f, -0.026598f, 0.089717f, 0.037411f, 0.022116f, -0.009012f, 0.100896f, -0.030429f, 0.010561f, 0.039527f, 0.014546f, -0.025051f, 0.058623f, 0.009794f, -0.012438f, -0.016703f, -0.065077f, 0.037503f, 0.073138f, -0.030581f, 0.08044f, -0.058873f, -0.019288f, 0.034213f, 0.000918f, 0.060302f, 0.0359f, 0.064895f, 0.027882f, -0.020879f, -0.027136f, -0.032632f, -0.002028f, 0.079256f, 0.035567f, 0.059195f, 0.087108f, 0.071258f, 0.081681f, 0.075627f, -0.039368f, -0.026882f, 0.003556f, 0.024802f, -0.02029f, 0.067923f, 0.037328f, 0.001378f, -0.05193f, -0.077366f, -0.049198f, 0.088345f, -0.085696f, 0.103064f, -0.000376f, -0.018487f, 0.049769f, 0.078454f, -0.067504f, 0.050618f, 0.001025f, -0.019429f, -0.06198f, 0.006259f, 0.069861f, 0.089221f, 0.082081f, -0.086481f, -0.015148f, -0.1068f, 0.036256f, 0.095118f, 0.028589f, -0.029751f, 0.063282f, 0.082871f, -0.10814f, 0.069392f, -0.031165f, 0.032893f, -0.037111f, -0.074f, 0.046063f, 0.063327f, 0.061033f, 0.061323f, -0.075942f, 0.073148f, -0.011277f, -0.041931f, 0.017401f, -0.046258f, 0.044146f, 0.023375f, 0.054299f, 0.08218f, 0.046445f, -0.084837f, 0.058411f, 0.005252f, 0.006967f, -0.022264f, -0.08235f, -0.054426f, -0.070095f, 0.067924f, 0.043049f, 0.068917f, 0.053866f, -0.079592f, 0.030441f, 0.026876f, -0.090499f, 0.09378f, 0.062484f, 0.034989f, -0.011158f, -0.064582f, -0.072987f, 0.047363f, 0.098399f, -0.106178f, 2.9e-05f, -0.067375f, -0.010208f, 0.002514f, -0.004257f, -0.084344f, 0.086527f, 0.070921f, 0.064102f, -0.005847f, 0.048001f, 0.053637f, -0.045454f, -0.093969f, 0.01088f, 0.099344f, 0.032186f, -0.070257f, -0.000935f, -0.033024f, 0.006872f, 0.046223f, -0.010285f, 0.098245f, 0.055771f, -0.037704f, 0.02206f, -0.011535f, 0.045446f, -0.077851f, 0.004235f, -0.103633f, 0.106021f, 0.013346f, -0.056635f, -0.080102f, -0.042889f, 0.024704f, 0.080298f, -0.091005f, -0.062314f, -0.059522f, 0.040643f, -0.096378f, 0.068982f, -0.04106f, 0.057439f, 0.053011f, 0.09065f, -0.046295f, 0.056351f, -0.029779f, -0.032088f, 0.009304f, -0.06278f, -0.044472f, 0.071915f, -0.045722f, -0.032407f, 0.0473f, -0.041563f, -0.077174f, -0.04613f, 0.09474f, -0.023771f, -0.032543f, 0.060114f, -0.100194f, -0.079152f, 0.053342f, -0.050762f, 0.054819f, -0.086871f, 0.03254f, 0.014081f, -0.052051f, -0.061579f, 0.066586f, -0.014521f, -0.074814f, -0.081888f, 0.046383f, -0.017027f, 0.010689f, 0.001403f, 0.10065f, 0.073509f, 0.109578f, 0.10375f, 0.029019f, -0.087807f, 0.111495f, -0.021854f, -0.07955f, 0.083186f, -0.002022f, -0.008437f, -0.091891f, -0.017937f, -0.053049f, 0.059838f, -0.100285f, 0.022437f, -0.0733f, 0.038418f, 0.082994f, -0.084431f, -0.066287f, -0.006698f, 0.081921f, -0.02095f, 0.016686f, 0.039624f, 0.070538f, -0.076302f, 0.09173f, 0.035903f, 0.042118f, -0.022839f, -0.013449f, -0.0714f, 0.069006f, -0.060186f, 0.022824f, -0.010987f, -0.094253f, -0.035236f, 0.069437f, 0.009573f, -0.04838f, -0.011791f, 0.068505f, 0.047159f, -0.087068f, 0.02132f, -0.044622f, 0.084236f, 0.033458f, -0.074203f, -0.067885f, -0.072495f, -0.00576f, 0.052539f, -0.092486f, -0.052609f, -0.059286f, 0.01323f, 0.097889f, 0.065522f, -0.073457f, 0.054739f, -0.004866f, -0.015703f, 0.090927f, 0.017528f, -0.059548f, -0.06251f, 0.081354f, -0.069272f, -0.057954f, 0.033988f, -0.070164f, 0.066862f, -0.030828f, -0.01754f, -0.086104f, -0.10413f, 0.035523f, -0.075579f, 0.019877f, 0.002073f, 0.012623f, -0.054994f, 0.059345f, -0.003267f, -0.059649f, -0.090668f, -0.030957f, 0.035129f, -0.069297f, 0.031746f, -0.060626f, -0.019826f, 0.021859f, 0.046823f, -0.064522f, -0.092563f, -0.006921f, -0.062992f, 0.002342f, -0.082299f, -0.013446f, -0.017491f, -0.057552f, -0.000265f, -0.017805f, -0.07521f, 0.044277f, 0.069348f, 0.010233f, 0.035751f, 0.062007f, 0.09605f, 0.10719f, -0.015329f, 0.080742f, -0.040557f, 0.056432f, 0.069342f, -0.11162f, 0.070133f, 0.063505f, -0.05867f, -0.01452f, -0.080964f, 0.066034f, 0.072391f, 0.064302f, -0.01128f, 0.023399f, 0.055176f, -0.06112f, -0.086693f, 0.050825f, 0.000695f, 0.071022f, -0.110883f, -0.081173f, -0.037738f, -0.021742f, 0.053196f, -0.010805f, 0.076098f, -0.030856f, -0.095614f, -0.02237f, -0.02572f, 0.023347f, 0.042157f, -0.084089f, 0.036905f, -0.061108f, -0.00048f, 0.074998f, -0.081719f, -0.048745f, -0.006696f, -0.102858f, -0.056362f, -0.067954f, -0.000519f, 0.00172f, 0.055669f, 0.070599f, 0.002041f, 0.023095f, -0.093535f, -0.016364f, 0.082284f, 0.003023f, -0.038957f, -0.069459f, -0.015758f, 0.097277f, -0.077205f, 0.020962f, -0.009301f, 0.067742f, -0.054669f, -0.080894f, 0.026699f, 0.048022f, -0.009967f, -0.083801f, 0.056753f, 0.086725f, 0.042341f, 0.101921f, 0.060071f, 0.051917f, -0.010719f, -0.097524f, -0.091785f, 0.00479f, -0.024213f, -0.016517f, -0.104132f, -0.074488f, -0.071773f, -0.09297f, 0.019082f, -0.070419f, -0.051412f, -0.083221f, 0.06767f, 0.09043f, -0.075447f, 0.016447f, 0.028143f, -0.030382f, 0.00665f, -0.025136f, -0.079555f, 0.083479f, 0.023162f, 0.075314f, -0.08131f, 0.068533f, -0.004537f, 0.066152f, 0.053217f, -0.08239f, -0.107039f, -0.071292f, 0.039203f, -0.081959f, 0.001555f, 0.003292f, 0.042593f, 0.003754f, -0.092176f, -0.065339f, -0.089343f, 0.108839f, 0.041378f, -0.107591f, -0.074721f, -0.039273f, 0.046076f, -0.03271f, 0.008736f, 0.053796f, 0.086426f, 0.005496f, 0.039873f, -0.059845f, -0.050725f, 0.078784f, 0.01595f, 0.035995f, 0.076581f, -0.107311f, -0.028198f, 0.026897f, -0.022637f, 0.097701f, -0.009342f, -0.061556f, 0.082007f, -0.096729f, 0.062944f, -0.083367f, -0.003145f, -0.073972f, 0.091396f, -0.034474f, -0.105718f, 0.040574f, -0.048189f, 0.012171f, -0.010906f, -0.01909f, -0.051203f, 0.064717f, -0.022644f, -0.080125f, 0.102733f, 0.0076f, -0.006502f, -0.029838f, 0.040389f, -0.033914f, 0.033256f, 0.089039f, -0.016486f, 0.044318f, -0.055312f, 0.034203f, 0.030989f, -0.011141f, -0.061638f, 0.032951f, -0.025049f, -0.033573f, 0.07209f, 0.044794f, -0.075063f, -0.000747f, -0.072128f, 0.038206f, -0.03337f, 0.049321f, 0.065483f, 0.111059f, -0.028075f, -0.049815f, -0.074591f, 0.011684f, -0.045533f, 0.091396f, -0.09748f, 0.034203f, -0.013842f, 0.015348f, 0.016669f, 0.009465f, 0.03134f, 0.026704f, 0.100654f, -0.000651f, 0.081872f, 0.058855f, 0.055574f, 0.09552f, -0.07047f, -0.042081f, 0.089012f, -0.05623f, -0.015185f, -0.085053f, -0.079811f, 0.014698f, -0.031873f, -0.028445f, -0.003312f, 0.015067f, -0.011387f, -0.044871f, -0.069118f, 0.00681f, -0.009366f, 0.063085f, -0.080507f, 0.024068f, 0.035874f, 0.093303f, 0.064644f, 0.011761f, -0.034272f, -0.112901f, -0.065824f, 0.082002f, 0.096541f, 0.026597f, 0.027397f, 0.008745f, 0.043388f, -0.099814f, -0.033956f, -0.044335f, 0.103461f, -0.112229f, 0.031698f, -0.007772f, -0.100136f, -0.011405f, -0.066866f, -0.075193f, 0.040736f, -0.075435f, -0.081397f, -0.031193f, -0.087315f, 0.002516f, -0.039535f, -0.064809f, 0.014596f, 0.021005f, 0.038055f, 0.088051f, -0.086864f, -0.075966f, 0.022874f, -0.022293f, 0.094963f, -0.013119f, -0.037585f, 0.070932f, 0.01153f, -0.099637f, -0.087604f, 0.008163f, -0.024468f, 0.052418f, 0.042007f, -0.10284f, -0.077938f, 0.082054f, -0.064131f, 0.006777f, 0.09077f, 0.104197f, 0.055945f, 0.063616f, 0.076476f, -0.088362f, 0.057717f, -0.029646f, -0.10235f, 0.017316f, -0.064201f, -0.099768f, 0.010237f, -0.049892f, 0.057373f, -0.032469f, 0.061174f, -0.083059f, 0.093893f, -0.094553f, -0.064546f, -0.078307f, 0.094144f, -0.098128f, -0.030555f, 0.047113f, -0.02032f, -0.105313f, -0.035387f, 0.056233f, -0.031321f, 0.049392f, 0.05422f, -0.002038f, -0.067945f, 0.113502f, -0.007139f, -0.054787f, 0.032437f, 0.026201f, -0.017349f, 0.032981f, -0.072739f, 0.05774f, 0.048555f, 0.037396f, -0.088739f, 0.015147f, 0.037746f, 0.015432f, -0.075682f, -0.085349f, 0.035126f, 0.070095f, 0.100651f, -0.003398f, -0.049252f, -0.032716f, -0.091149f, -0.029693f, 0.053597f, -0.036423f, -0.07971f, -0.071887f, 0.027932f, 0.045331f, -0.0739f, 0.070155f, -0.026716f, 0.018944f, -0.040908f, 0.038085f, -0.010194f, 0.036366f, -0.01849f, 0.043031f, 0.068424f, 0.00189f, -0.005306f, -0.051f, 0.042337f, -0.069447f, 0.041197f, 0.072244f, 0.097329f, 0.046862f, 0.010981f, 0.075282f, -0.001736f, -0.03759f, 0.047126f, -0.047129f, -0.096739f, -0.037586f, -0.020257f, -0.060197f, 0.080146f, 0.046525f, -0.104957f, -0.00329f, -0.080902f, 0.014337f, 0.037576f, -0.03434f, 0.007021f, -0.002298f, 0.015417f, -0.000267f, -0.072015f, -0.032601f, 0.095106f, 0.035084f, 0.094162f, -0.086466f, -0.04825f, 0.107579f, -0.024349f, 0.008687f, 0.023827f, -0.057771f, 0.034257f, -0.095762f, -0.004673f, 0.006702f, -0.069189f, 0.034623f, 0.07279f, 0.077068f, -0.103425f, -0.050942f, 0.072403f, -0.073855f, -0.029525f, 0.007975f, 0.060692f, -0.042899f, -0.026135f, -0.061702f, -0.02171f, 0.00947f, 0.083104f, 0.035023f, 0.026133f, 0.02837f, -0.028667f, -0.096355f, -0.03964f, -0.07167f, -0.038886f, -0.056481f, -0.022779f, -0.033763f, -0.021223f, 0.059339f, -0.071903f, -0.054867f, -0.097672f, 0.098521f, -0.054013f, 0.029071f, -0.019654f, 0.027975f, 0.041611f, 0.049542f, -0.013863f, -0.020752f, -0.075579f, 0.033453f, -0.084403f, 0.061245f, -0.082047f, 0.081488f, -0.046302f, 0.013734f, 0.063389f, 0.039672f, -0.019773f, 0.01476f, -0.107314f, -0.025233f, -0.058861f, -0.037594f, -0.040683f, -0.063153f, 0.081623f, -0.008703f, 0.04387f, 0.077709f, 0.030478f, -0.056765f, 0.059852f, 0.046067f, -0.013695f, 0.021793f, -0.026169f, -0.066036f, 0.049228f, 0.041813f, 0.016469f, -0.02181f, -0.020035f, -0.028711f, -0.035766f, 0.05011f, 0.086232f, -0.108372f, 0.02521f, -0.02778f, 0.081076f, -0.036842f, -0.0253f, 0.039806f, -0.101399f, 0.054883f, 0.039211f, -0.049166f, 0.040483f, 0.093758f, 0.073553f, -0.003967f, -0.056511f, 0.091034f, -0.009084f, -0.030964f, 0.014751f, -0.074611f, -0.01982f, 0.06548f, 0.001006f, 0.043043f, 0.063533f, 0.035266f, -0.080414f, 0.034669f, 0.000757f, -0.100508f, 0.078503f, -0.070394f, -0.10796f, 0.039253f, -0.063756f, -0.074361f, 0.086708f, -0.067689f, 0.016424f, -0.013877f, -0.084971f, -0.052961f, -0.025616f, -0.015374f, 0.025632f, 0.084972f, -0.009257f, 0.071237f, 0.013013f, 0.011775f, -0.075456f, 0.021406f, -0.06116f, -0.034212f, 0.003007f, 0.037945f, 0.019873f, -0.036987f, -0.077824f, -0.064438f, -0.024365f, 0.095555f, 0.006799f, 0.087968f, 0.003433f, -0.001682f, -0.028767f, 0.078159f, -0.000499f, -0.036988f, 0.09179f, 0.048691f, 0.02045f, 0.022514f, 0.006169f, -0.092343f, 0.043554f, -0.014294f, -0.10844f, 0.032757f, -0.061524f, 0.071853f, -0.035808f, 0.032775f, 0.001915f, -0.075641f, -0.025409f, 0.074364f, 0.076893f, -0.111179f, -0.080744f, 0.011623f, -0.095977f, 0.054651f, 0.009251f, 0.051387f, 0.042521f, 0.007489f, -0.077435f, -0.050014f, -0.019858f, -0.01422f, 0.042604f, 0.022302f, -0.02748f, 0.100278f, 0.01783f, 0.056736f, 0.066833f, -0.063382f, -0.030391f, -0.099986f, -0.072631f, 0.000751f, -0.007886f, -0.025904f, 0.030937f, -0.031873f, -0.001743f, 0.086856f, 0.026874f, 0.045138f, 0.060611f, -0.012944f, -0.024265f, 0.003072f, 0.074061f, -0.044621f, 0.058859f, -0.075302f, -0.043046f, 0.064877f, 0.091953f, -0.069447f, -0.041016f, 0.045985f, -0.036763f, -0.0672f, -0.04235f, -0.053132f, 0.051513f, 0.00202f, -0.087336f, -0.009376f, -0.028946f, -0.067584f, 0.06813f, 0.062289f, 0.001266f, 0.022566f, -0.046718f, 0.09545f, -0.013281f, -0.063232f, -0.017615f, -0.035286f, -0.080782f, -0.016241f, 0.09977f, -0.030691f, 0.062187f, -0.083114f, -0.065044f, -0.024567f, -0.109956f, 0.001243f, 0.079188f, -0.058802f, 0.030621f, 0.072968f, 0.081096f, -0.08924f, 0.084281f, -0.087022f, -0.019822f, 0.06326f, -0.019853f, -0.094676f, 0.052286f, 0.025839f, -0.018807f, -0.029313f, 0.023295f, 0.075508f, -0.027943f, -0.033001f, -0.040161f, -0.048346f, 0.073971f, -0.070525f, 0.026264f, 0.040817f, -0.110362f, 0.008279f, -0.018412f, -0.06985f, 0.069311f, -0.028027f, -0.043163f, 0.048077f, -0.005175f, -0.03608f, 0.011441f, -0.011733f, 0.063665f, 0.045767f, 0.064739f, 0.071304f, 0.001754f, 0.049387f, -0.040164f, 0.061963f, -0.005789f, 0.02549f, -0.076482f, -0.09872f, -0.067111f, -0.111216f, 0.041597f, 0.056069f, -0.010179f, 0.005961f, -0.055055f, 0.051384f, 0.01112f, -0.017645f, 0.069483f, 0.052077f, -0.014125f, -0.025208f, -0.045618f, -0.051723f, -0.00584f, -0.04216f, -0.081912f, -0.050954f, -0.086175f, 0.046933f, -0.017281f, -0.076607f, -0.058321f, 0.055841f, 0.005953f, 0.007653f, -0.023916f, 0.057572f, 0.025531f, -0.066296f, -0.086419f, -0.04419f, 0.106214f, -0.095999f, -0.007674f, 0.09783f, -0.09727f, -0.046049f, 0.008946f, -0.085524f, 0.087654f, -0.089952f, -0.082368f, -0.068873f, 0.034794f, 0.073746f, -0.001142f, 0.016595f, -0.004234f, -0.006646f, -0.038621f, 0.048016f, 0.026278f, -0.007055f, 0.080685f, 0.045162f, 0.009756f, 0.082744f, 0.005986f, -0.096773f, 0.045365f, 0.079581f, -0.102971f, 0.035787f, 0.081789f, 0.045471f, -0.018323f, 0.047128f, -0.047238f, 0.048377f, 0.021729f, 0.019457f, -0.016774f, -0.064695f, -0.028503f, 0.013628f, 0.022092f, -0.054019f, 0.036934f, -0.039364f, 0.041775f, 0.03178f, -0.086481f, 0.01287f, -0.090171f, 0.076844f, -0.035f, -0.109774f, -0.010588f, -0.087286f, 0.017379f, 0.05876f, 0.084956f, 0.077177f, -0.02341f, -0.018315f, 0.10525f, -0.015739f, -0.029489f, 0.092023f, -0.059011f, -0.023345f, -0.019401f, 0.061458f, -0.007093f, 0.058232f, 0.041021f, 0.071206f, -0.032299f, 0.056975f, -0.084881f, 0.049775f, 0.079075f, -0.033239f, 0.028216f, 0.101623f, -0.075617f, 0.038608f, -0.082702f, -0.016408f, -0.064495f, 0.024375f, 0.033821f, 0.078694f, 0.07571f, 0.084447f, -0.000271f, 0.087646f, -0.041166f, -0.066194f, 0.015091f, 0.017636f, 0.084991f, -0.08014f, 0.087924f, 0.005372f, 0.085123f, 0.063075f, -0.041179f, 0.027895f, -0.037746f, 0.065999f, -0.096764f, 0.01717f, -0.003239f, -0.059375f, 0.003075f, -0.044902f, 0.049962f, 0.065326f, 0.060537f, -0.029681f, -0.05527f, -0.024866f, -0.005735f, 0.009821f, 0.056336f, 0.037196f, -0.076079f, 0.036441f, -0.088077f, 0.091378f, 0.045213f, -0.093557f, 0.080471f, 0.020582f, 0.023081f, 0.00744f, 0.022345f, -0.000614f, 0.020778f, 0.046667f, -0.076744f, 0.087263f, -0.031072f, -0.079976f, 0.025814f, 0.020118f, -0.026477f, 0.023837f, 0.056714f, -0.029467f, -0.081165f, -0.010953f, -0.038f, -0.052816f, 0.013153f, 0.064665f, -0.10594f, -0.012419f, -0.060979f, 0.054571f, -0.058012f, -0.013145f, -0.080622f, -0.083603f, -0.083973f, -0.04301f, 0.048709f, 0.025667f, 0.06617f, -0.052245f, 0.035932f, 0.050085f, -0.017802f, -0.063936f, 0.050678f, -0.0127f, -0.002311f, 0.051888f, -0.016329f, -0.051336f, 0.035212f, -0.05992f, -0.035973f, -0.062757f, -0.082413f, 0.065238f, 0.026205f, -0.012723f, 0.059393f, 0.097664f, -0.008578f, -0.000929f, 0.01963f, -0.059873f, -0.064077f, 0.013612f, -0.014765f, -0.026856f, 0.001756f, 0.061794f, 0.041449f, -0.082198f, 0.03058f, -0.104952f, -0.006788f, -0.019899f, 0.060297f, 0.083871f, 0.049552f, 0.039859f, 0.089737f, 0.007057f, -0.057757f, -0.036249f, -0.003369f, -0.021962f, -0.027257f, 0.110244f, 0.086887f, 0.012602f, 0.046664f, 0.055375f, 0.020717f, -0.083081f, -0.082732f, 0.064072f, -0.092592f, 0.040002f, 0.052784f, 0.06006f, -0.050977f, 0.014939f, -0.073383f, -0.003701f, 0.016793f, -0.006969f, -0.009215f, 0.074923f, -0.02884f, -0.050691f, 0.069944f, -0.015199f, -0.012745f, 0.082649f, -0.05466f, 0.043054f, 0.008303f, 0.020737f, -0.01707f, -0.036087f, -0.081873f, 0.10875f, 0.05918f, -0.007336f, 0.012293f, -0.088294f, -0.078871f, 0.056851f, -0.099474f, 0.062338f, 0.041994f, 0.0165f, -0.008113f, -0.015512f, 0.097979f, 0.067499f, 0.003079f, -0.076296f, -0.037672f, -0.099023f, 0.061835f, -0.035166f, 0.008634f, -0.009962f, 0.047156f, 0.032347f, -0.097542f, -0.008459f, -0.003106f, 0.057607f, 0.061076f, -0.079207f, 0.032751f, -0.108279f, 0.050213f, -0.041454f, -0.045915f, -0.039774f, 0.058645f, -0.046524f, 0.057201f, 0.03245f, 0.073543f, -0.042713f, 0.022111f, 0.049294f, 0.021063f, -0.079569f, -0.062827f, 0.037208f, 0.009369f, 0.061331f, 0.078903f, 0.065525f, -0.066638f, -0.026561f, 0.107728f, -0.008355f, -0.015373f, 0.106049f, 0.048347f, 0.028309f, -0.012155f, -0.063547f, 0.081203f, -0.093756f, 0.031452f, -0.09301f, -0.107402f, -0.106687f, 0.073198f, 0.002215f, 0.027167f, -0.087686f, 0.011209f, -0.010734f, -0.086045f, 0.003884f, 0.078612f, 0.028043f, -0.053127f, 0.078308f, 0.058508f, 0.095844f, 0.062462f, 0.000425f, 0.053705f, 0.038684f, -0.082275f, -0.070572f, -0.061273f, 0.025462f, 0.031949f, 0.072677f, 0.081698f, 0.000351f, 0.028912f, -0.0645f, 0.041445f, -0.053858f, 0.093771f, -0.068643f, 0.027006f, -0.069894f, 0.007797f, -0.083654f, 0.079856f, 0.00651f, 0.081894f, -0.059297f, 0.069188f, 0.056612f, -0.021111f, -0.090999f, 0.058656f, -0.067572f, 0.063618f, 0.041165f, -0.051784f, 0.077141f, 0.041981f, 0.009549f, 0.032397f, -0.021263f, -0.071765f, 0.020901f, -0.021471f, 0.099093f, -0.096946f, -0.056016f, 0.093376f, 0.005145f, -0.061203f, -0.034869f, -0.06862f, 0.011801f, 0.06701f, 0.029624f, 0.01267f, -0.026251f, 0.026704f, 0.089737f, -0.08401f, -0.068519f, 0.087423f, 0.052005f, -0.068917f, -0.064439f, -0.023797f, -0.025345f, -0.080248f, -0.078002f, -0.037381f, -0.057499f, 0.048868f, -0.006803f, -0.043817f, 0.081661f, 0.061764f, -0.005904f, 0.058484f, 0.010848f, 0.010232f, -0.064856f, -0.032573f, -0.096487f, -0.03127f, -0.096913f, -0.057447f, -0.003331f, 0.016509f, -0.044597f, -0.063068f, 0.06017f, -0.081209f, 0.019892f, 0.043149f, -0.04683f, 0.015934f, 0.032657f, 0.048218f, -0.074592f, 0.018327f, -0.079077f, -0.050704f, 0.07744f, -0.096359f, 0.05568f, 0.006763f, -0.107629f, 0.038076f, 0.056377f, -0.021161f, 0.070601f, 0.094859f, 0.014712f, 0.094829f, -0.007204f, 0.073569f, 0.051262f, 0.031538f, -0.007624f, -0.006978f, -0.075023f, -0.060114f, 0.04978f, -0.027862f, 0.031177f, 0.032541f, -0.041287f, -0.050714f, -0.039837f, -0.037483f, 0.020183f, -0.073774f, 0.056155f, 0.015466f, -0.077561f, -0.061323f, -0.052765f, 0.021267f, 0.028607f, -0.020258f, 0.06782f, -0.07201f, 0.047193f, 0.060632f, -0.052866f, 0.072447f, 0.057373f, 0.063565f, 0.049562f, -0.074173f, -0.039275f, 0.066683f, -0.071903f, 0.059573f, 0.019606f, -0.011386f, 0.030211f, -0.061156f, 0.01811f, 0.024251f, -0.037929f, -0.073451f, 0.094168f, 0.089984f, -0.088505f, -0.069278f, -0.032394f, 0.102816f, -0.007307f, -0.041871f, 0.081953f, -0.046866f, 0.051958f, -0.089192f, 0.012686f, -0.069793f, -0.048567f, -0.025211f, 0.038408f, -0.002187f, -0.053106f, 0.055878f, 0.00932f, -0.082141f, -0.099248f, -0.097918f, -0.03499f, -0.039143f, 0.047985f, 0.037928f, 0.061486f, 0.043566f, 0.065806f, 0.026172f, -0.088465f, 0.036938f, -0.023064f, 0.069153f, -0.019027f, -0.056566f, 0.035588f, 0.068736f, -0.076081f, -0.037208f, -0.064543f, 0.07053f, -0.048158f, -0.022975f, -0.032376f, 0.064739f, -0.02617f, -0.060197f, -0.075975f, 0.00758f, -0.064178f, 0.049182f, -0.066317f, -0.003135f, 0.037024f, 0.077701f, 0.089899f, 0.03316f, -0.052013f, -0.072944f, 0.059347f, -0.024041f, -0.091031f, 0.068991f, -0.006255f, 0.072247f, 0.005074f, 0.074343f, -0.005653f, -0.056458f, 0.084864f, -0.085079f, -0.056822f, 0.086057f, 0.064539f, 0.08156f, 0.002023f, -0.024511f, -0.042602f, -0.073007f, -0.102393f, -0.048237f, -0.0378f, 0.017436f, -0.050334f, 0.06618f, 0.099731f, -0.000788f, -0.100893f, -0.062345f, -0.052038f, 0.088659f, 0.063176f, 0.093087f, -0.036331f, -0.055828f, -0.009056f, -0.025848f, -0.009737f, -0.024267f, -0.096212f, -0.023784f, 0.061318f, 0.006787f, 0.068054f, 0.026583f, 0.069551f, 0.023162f, 0.023982f, -0.081404f, 0.070808f, 0.08482f, 0.055725f, -0.076543f, -0.070382f, -0.032721f, 0.05575f, 0.082016f, -0.075027f, 0.02436f, -0.059042f, -0.089373f, 0.012254f, 0.057775f, 0.012521f, 0.043001f, -0.007939f, -0.054559f, 0.071704f, -0.029491f, -0.003878f, -0.092255f, -0.098848f, 0.047167f, 0.067931f, 0.015132f, 0.064799f, 0.040172f, -0.058623f, -0.069615f, 0.087558f, -0.052353f, 0.034209f, -0.038709f, -0.000698f, -0.013588f, 0.052483f, 0.060758f, 0.07905f, -0.073727f, 0.001867f, -0.017804f, -0.103377f, -0.042826f, -0.004566f, 0.087527f, -0.041169f, 0.02738f, 0.077534f, -0.050602f, -0.091365f, 0.087053f, -0.078613f, -0.054611f, 0.087028f, -0.038761f, -0.04795f, 0.061741f, 0.061099f, -0.062996f, -0.016193f, 0.061693f, -0.007735f, -0.067491f, 0.049784f, -0.066187f, 0.07319f, -0.005671f, 0.009185f, 0.033849f, -0.011285f, 0.104771f, -0.060025f, 0.090311f, -0.006034f, 0.040452f, 0.059826f, 0.011217f, 0.045448f, 0.011827f, 0.027785f, -0.075886f, 0.067984f, -0.050031f, -0.005095f, -0.018041f, -0.025025f, -0.052222f, -0.002406f, 0.072297f, 0.015602f, -0.041612f, 0.069962f, -0.07177f, -0.00914f, 0.038112f, 0.064258f, 0.070528f, -0.066626f, 0.012769f, -0.073291f, -0.053995f, 0.05652f, -0.043974f, -0.061722f, -0.049835f, -0.009804f, 0.038541f, 0.012557f, 0.065122f, -0.031547f, -0.009949f, -0.054395f, -0.073955f, 0.10532f, -0.064952f, 0.003713f, 0.028169f, 0.054159f, -0.049895f, -0.009758f, -0.019672f, -0.097072f, -0.058112f, 0.000852f, -0.108017f, -0.100977f, -0.074899f, 0.03731f, 0.064617f, 0.084643f, -0.080703f, 0.014761f, -0.028666f, -0.099424f, -0.08677f, -0.074248f, 0.009212f, -0.026795f, -0.065291f, -0.064334f, 0.078967f, -0.083433f, 0.002088f, -0.10043f, -0.065283f, -0.020057f, -0.072524f, 0.016932f, -0.037396f, 0.040303f, 0.038079f, 0.087831f, -0.033005f, -0.006273f, 0.023673f, -0.004821f, -0.036061f, -0.088663f, -0.044048f, 0.07317f, 0.031381f, -0.1106f, 0.041538f, -0.078326f, 0.073184f, 0.016657f, 0.066377f, 0.083515f, 0.078879f, -0.037614f, -0.059912f, -0.034886f, -0.055411f, 0.052589f, 0.015328f, -0.039032f, 0.069832f, -0.021575f, -0.091306f, -0.057449f, -0.030245f, -0.09284f, 0.038273f, -0.045045f, 0.029273f, -0.079233f, -0.075337f, -0.05066f, -0.094337f, 0.106648f, -0.066745f, 0.067794f, 0.02432f, 0.078386f, 0.082861f, 0.079273f, 0.008843f, 0.108078f, -0.043879f, -0.021879f, 0.054728f, 0.004739f, 0.082444f, 0.063294f, -0.069808f, 0.048278f, 0.082981f, 0.020666f, 0.086571f, -0.005694f, 0.04088f, -0.041066f, -0.05957f, 0.04034f, -0.062902f, -0.058299f, -0.039291f, 0.011212f, -0.044244f, -0.021245f, 0.003688f, -0.008376f, -0.079783f, -0.026525f, 0.006858f, -0.055507f, -0.01566f, 0.023563f, 0.063716f, 0.035784f, -0.064329f, -0.058194f, -0.090629f, -0.032288f, 0.077832f, -0.079879f, -0.027511f, 0.00348f, 0.005816f, 0.000927f, -0.084772f, 0.038472f, 0.07155f, -0.039403f, -0.082043f, 0.067077f, 0.049528f, 0.072509f, 0.09064f, -0.071832f, 0.020812f, 0.039876f, -0.014541f, 0.015665f, -0.000317f, -0.083667f, 0.06554f, -0.060238f, -0.082082f, 0.036178f, 0.006212f, -0.056632f, 0.113147f, -0.036952f, -0.046029f, -0.061922f, -0.007093f, -0.067094f, -0.081271f, 0.029365f, -0.091493f, 0.049843f, -0.090498f, -0.032521f, -0.055672f, 0.087818f, -0.033872f, -0.010138f, -0.043082f, -0.00397f, 0.08753f, 0.013032f, 0.031541f, -0.041761f, -0.043099f, -0.08345f, 0.078729f, -0.036987f, 0.060111f, 0.032033f, 0.038078f, -0.024707f, -0.027784f, -0.02014f, 0.033466f, 0.096351f, 0.004786f, 0.019429f, 0.055353f, 0.077186f, 0.013438f, 0.067757f, -0.007319f, -0.074927f, 0.041138f, -0.034166f, 0.088712f, -0.071627f, 0.009657f, 0.002842f, 0.065584f, 0.078496f, 0.090162f, -0.105126f, 0.111703f, 0.052373f, -0.059499f, -0.03248f, 0.087787f, 0.06663f, -0.084942f, -0.063541f, -0.072041f, -0.035931f, -0.017383f, 0.018097f, -0.074747f, 0.067847f, 0.014812f, -0.065033f, 0.076464f, 0.073713f, 0.062437f, 0.004969f, 0.024284f, -0.076068f, 0.054394f, 0.024697f, 0.042667f, 0.07622f, 0.061748f, 0.061897f, -0.006504f, 0.051169f, 0.086344f, -0.042235f, 0.044136f, -0.03958f, -0.027477f, -0.00673f, -0.011023f, 0.041629f, -0.063097f, 0.052579f, -0.085328f, -0.076346f, -0.03405f, 0.067477f, -0.042216f, 0.076263f, 0.035335f, 0.027301f, 0.004066f, 0.012334f, -0.049289f, 0.062862f, -0.012775f, -0.0019f, 0.042391f, 0.061688f, 0.051152f, -0.001324f, -0.022357f, -0.053616f, -0.075774f, 0.099632f, -0.067101f, -0.0283f, 0.081879f, -0.001803f, 0.054756f, 0.050493f, -0.102856f, -0.077041f, -0.086571f, -0.014595f, 0.064675f, 0.048116f, -0.063317f, 0.001312f, 0.056979f, 0.063796f, 0.081023f, 0.009473f, -0.030346f, 0.047389f, 0.019083f, 0.079796f, 0.006929f, 0.020417f, -0.016872f, 0.029377f, -0.044558f, -0.097522f, 0.002589f, -0.057648f, 0.045259f, -0.080087f, 0.053472f, 0.037949f, -0.037837f, -0.050293f, 0.083935f, -0.029457f, -0.063583f, 0.011139f, -0.076828f, -0.070189f, -0.082843f, 0.010049f, -0.036558f, 0.026527f, -0.093238f, -0.023819f, -0.0324f, 0.035653f, 0.082701f, -0.015612f, 0.026014f, 0.052884f, 0.059424f, 0.042739f, -0.034463f, -0.089734f, -0.061188f, 0.031608f, 0.001127f, 0.015991f, -0.078813f, -0.001847f, -0.083001f, 0.046642f, -0.035807f, 0.02405f, -0.008136f, -0.083654f, -0.083513f, 0.091761f, 0.059921f, 0.066527f, 0.024528f, -0.019114f, 0.082987f, 0.095313f, -0.079465f, -0.08969f, 0.007999f, 0.052892f, -0.020214f, -0.065139f, -0.027536f, -0.071384f, 0.050914f, 0.016809f, -0.025364f, -0.087122f, 0.020218f, 0.006015f, 0.047511f, 0.056379f, -0.075326f, -0.037061f, -0.019636f, -0.047649f, -0.053055f, -0.102587f, -0.008647f, -0.002475f, -0.014962f, -0.08309f, -0.089362f, 0.058923f, 0.05022f, -0.054713f, 0.034568f, 0.070997f, 0.047702f, -0.022983f, -0.06515f, -0.074023f, 0.011315f, -0.021217f, 0.031927f, 0.046652f, -0.071404f, 0.07902f, -0.045407f, -0.009004f, 0.028121f, -0.078483f, 0.055622f, -0.044674f, 0.076692f, -0.062163f, -0.015523f, -0.071948f, 0.044705f, -0.004248f, -0.062052f, 0.058393f, 0.051449f, -0.019991f, -0.052988f, 0.078608f, 0.001765f, -0.021914f, -0.047432f, 0.049559f, 0.001612f, 0.040354f, -0.016861f, -0.082959f, -0.040379f, -0.086909f, -0.078588f, 0.102626f, -0.076516f, -0.026666f, 0.069832f, -0.028193f, -0.064701f, -0.025338f, 0.048881f, -0.103867f, 0.004773f, -0.064565f, -0.090877f, 0.058128f, -0.100664f, -0.005995f, 0.022795f, -0.056496f, 0.07865f, -0.014982f, -0.048025f, 0.007736f, 0.012903f, -0.005566f, -0.106542f, 0.045286f, -0.063245f, -0.060541f, 0.065823f, -0.01258f, -0.009856f, 0.045295f, 0.010776f, 0.009077f, -0.016849f, 0.085558f, 0.02051f, 0.064412f, 0.080913f, 0.060507f, -0.005695f, 0.019717f, -0.043925f, 0.095642f, 0.08101f, 0.072421f, -0.096867f, -0.076635f, 0.067077f, 0.072743f, 0.053042f, -0.026443f, -0.059563f, 0.065212f, -0.021577f, -0.033514f, -0.044988f, 0.092037f, -0.0446f, 0.05173f, -0.004451f, -0.037427f, 0.002289f, -0.025274f, -0.009695f, 0.00968f, 0.023317f, 0.074807f, 0.014226f, -0.067527f, -0.052513f, -0.026248f, 0.046558f, 0.063679f, -0.095758f, 0.080117f, -0.015649f, -0.084461f, -0.001203f, 0.005416f, -0.073196f, 0.016429f, 0.097657f, 0.004568f, -0.040047f, 0.02914f, -0.056486f, 0.091306f, -0.008166f, 0.038732f, -0.104725f, 0.059204f, -0.06153f, -0.067544f, 0.079153f, -0.087723f, -0.026033f, -0.030479f, 0.066521f, -0.078659f, 0.035634f, -0.051067f, -0.043924f, -0.002747f, 0.003737f, -0.049041f, 0.022542f, 0.03649f, -0.010571f, -0.041938f, -0.018219f, -0.094372f, 0.033725f, -0.094082f, -0.045858f, 0.093964f, -0.074225f, 0.015881f, -0.057373f, 0.092889f, 0.055652f, -0.021534f, 0.060576f, -0.002849f, -0.05453f, -0.055575f, -0.061639f, 0.020051f, 0.077087f, 0.041963f, 0.069067f, -0.050792f, 0.071483f, -0.099959f, 0.103915f, -0.077519f, -0.009167f, -0.013735f, -0.01853f, 0.032334f, 0.071609f, 0.030384f, -0.009795f, -0.060522f, 0.076889f, 0.007391f, -0.030194f, -0.001654f, -0.089508f, -0.067674f, 0.083357f, -0.067748f, -0.048453f, -0.003511f, -0.020916f, 0.02842f, -0.019281f, -0.005007f, -0.053358f, -0.014183f, -0.031783f, 0.078175f, -0.059181f, 0.00951f, 0.093205f, -0.062799f, 0.056093f, 0.08333f, -0.018777f, 0.028883f, -0.084095f, -0.044504f, -0.04785f, 0.01804f, -0.070235f, 0.01642f, -0.000739f, 0.075273f, 0.093843f, -0.11063f, 0.004483f, -0.013346f, 0.024814f, 0.014105f, -0.031584f, 0.035409f, 0.074531f, 0.08536f, 0.048498f, 0.015399f, -0.005016f, 0.055161f, 0.066262f, -0.087861f, -0.088035f, -0.021331f, 0.075283f, -0.068234f, -0.085351f, 0.076449f, 0.061797f, -0.06029f, 0.073104f, 0.045516f, 0.091344f, -0.063978f, 0.072962f, -0.075668f, 0.047115f, 0.040101f, 0.082241f, -0.049882f, -0.050071f, -0.011232f, 0.074075f, -0.026939f, 0.042517f, -0.02137f, -0.059312f, 0.043199f, 0.055952f, -0.108293f, 0.016107f, 0.002358f, -0.004951f, 0.04281f, -0.026969f, 0.018656f, -0.006205f, -0.024161f, -6e-06f, -0.056858f, 0.044061f, -0.051076f, 0.013358f, -0.030238f, 0.08092f, 0.081141f, 0.084384f, -0.043676f, 0.06118f, 0.082496f, 7e-06f, -0.075695f, 0.027641f, 0.075772f, 0.065568f, -0.076778f, -0.099174f, 0.009829f, 0.098862f, 0.030094f, 0.097229f, 0.034417f, 0.06026f, 0.078588f, -0.005075f, -0.092325f, -0.064966f, 0.074749f, -0.034268f, 0.006734f, -0.053199f, 0.069055f, 0.075564f, 0.073581f, 0.080419f, -0.003493f, 0.005703f, 0.07767f, -0.03893f, 0.038878f, 0.00277f, -0.029003f, 0.09727f, 0.023912f, 0.005903f, -0.09123f, -0.078333f, 0.018463f, 0.0923f, -0.023999f, 0.007498f, 0.082208f, 0.088768f, -0.038619f, -0.056767f, 0.077153f, 0.019294f, 0.06984f, -0.052998f, -0.089779f, 0.086868f, -0.003729f, -0.011597f, 0.10207f, -0.01944f, 0.028353f, 0.049551f, -0.03808f, -0.038252f, 0.062275f, 0.07474f, -0.074014f, -0.050752f, -0.097839f, -0.035366f, 0.089176f, -0.032552f, 0.062373f, -0.074891f, 0.018509f, 0.081499f, 0.108628f, 0.020308f, -0.110912f, 0.067168f, 0.061241f, -0.104769f, 0.042793f, 0.032107f, -0.085934f, -0.003547f, 0.018336f, 0.065102f, -0.03024f, 0.028798f, 0.001313f, 0.021708f, 0.085262f, 0.102348f, 0.066771f, -0.053471f, 0.088411f, -0.054484f, -0.109225f, 0.004304f, -0.084533f, -0.013116f, 0.033753f, 0.055069f, -0.02696f, 0.064535f, -0.092752f, 0.016522f, -0.04316f, -0.008912f, -0.041928f, -0.044796f, 0.07908f, 0.069675f, 0.054754f, -0.020777f, 0.02271f, 0.004877f, -0.06187f, -0.093437f, 0.097375f, 0.051164f, 0.067323f, -0.069313f, 0.089999f, -0.072509f, 0.054174f, 0.052555f, 0.02856f, 0.052933f, -0.038254f, 0.01951f, -0.085226f, 0.081764f, -0.072882f, -0.02312f, 0.085456f, 0.075383f, -0.104881f, 0.009928f, -0.010565f, 0.058614f, 0.02832f, -0.086077f, -0.005073f, 0.028476f, 0.103477f, -0.009367f, 0.100701f, 0.011004f, -0.02368f, -0.012507f, 0.002987f, -0.029977f, -0.029978f, 0.078591f, -0.01632f, 0.061201f, -0.003036f, -0.05743f, 0.088122f, 0.071485f, -0.059033f, 0.087535f, -0.052028f, 0.014948f, 0.087495f, 0.026477f, -0.069995f, -0.059753f, 0.050974f, 0.03279f, 0.031542f, -0.053607f, -0.054114f, 0.032921f, -0.066141f, -0.066401f, -0.074849f, 0.063371f, 0.028417f, 0.084051f, -0.036327f, 0.025411f, 0.067734f, -0.051424f, 0.001202f, 0.075698f, 0.078421f, 0.01239f, 0.003999f, 0.097603f, 0.035916f, -0.051791f, -0.013938f, -0.00018f, 0.022799f, -0.032725f, -0.075235f, 0.059524f, -0.086435f, -0.06675f, -0.062582f, -0.095842f, 0.087202f, 0.094735f, -0.086857f, -0.007584f, -0.010739f, -0.087156f, 0.088791f, 0.058349f, 0.034368f, -0.058154f, -0.032706f, -0.068568f, 0.051328f, -0.018938f, -0.07536f, -0.100427f, -0.058595f, 0.08929f, -0.107198f, 0.065951f, -0.098129f, 0.019152f, -0.016052f, 0.005721f, -0.053027f, -0.017829f, -0.026611f, 0.053395f, 0.067715f, -0.028882f, 0.072267f, -0.099501f, 0.04065f, -0.011905f, 0.078396f, -0.046423f, -0.036552f, 0.047379f, 0.05296f, 0.009653f, 0.061989f, -0.004594f, 0.085366f, 0.092284f, -0.008377f, 0.091465f, 0.059832f, 0.010023f, 0.10945f, 0.04032f, -0.044809f, -0.069762f, -0.031829f, 0.061532f, -0.00523f, -0.032848f, 0.0461f, -0.105524f, 0.071359f, 0.035092f, -0.050643f, -0.009769f, -0.092706f, -0.102349f, 0.109717f, -0.00497f, -0.041625f, -0.053799f, 0.075158f, 0.028401f, -0.106532f, 0.046002f, -0.07555f, 0.075775f, -0.024072f, -0.019516f, -0.115339f, 0.080398f, -0.048871f, 0.029046f, 0.099603f, -0.051082f, 0.057277f, 0.005905f, 0.099442f, 0.043742f, -0.025713f, -0.082462f, -0.097248f, 0.059913f, -0.017544f, 0.019768f, 0.081369f, -0.041063f, 0.076464f, -0.099922f, -0.0549f, 0.042267f, 0.087269f, 0.094718f, -0.02482f, 0.06675f, 0.079628f, -0.010747f, -0.058024f, -0.079064f, 0.037896f, -0.06709f, -0.006448f, -0.024665f, -0.003652f, 0.092518f, 0.000877f, 0.077242f, 0.046919f, -0.0403f, -0.053335f, -0.008821f, 0.040346f, 0.022691f, 0.082893f, 0.094724f, 0.007305f, -0.099786f, 0.015297f, -0.001005f, -0.005964f, -0.077685f, 0.081163f, -0.092333f, -0.035003f, -0.08511f, 0.019746f, -0.032193f, -0.014998f, 0.069654f, 0.083917f, -0.064168f, -0.057913f, -0.001256f, -0.087673f, -0.038303f, -0.04502f, 0.067476f, -0.074033f, 0.049489f, -0.059249f, 0.019277f, 0.015755f, -0.009136f, 0.072587f, -0.042763f, 0.002461f, 0.095918f, -0.057819f, 0.022753f, -0.054047f, -0.087073f, 0.084713f, -0.000272f, 0.028977f, -0.001454f, -0.055005f, 0.01583f, -0.093016f, 0.034387f, -0.089604f, -0.043621f, -0.053074f, -0.042727f, 0.070957f, -0.033262f, -0.097046f, -0.082002f, -0.058115f, -0.035692f, -0.069281f, -0.04155f, -0.047572f, -0.02829f, 0.017497f, 0.090363f, 0.039531f, -0.078197f, 0.071666f, 0.026626f, 0.073242f, -0.024983f, 0.060661f, 0.042254f, -0.038462f, -0.027538f, 0.083439f, 0.078392f, -0.062957f, 0.065428f, 0.097369f, 0.059262f, -0.005347f, -0.004569f, 0.054815f, 0.048848f, 0.054183f, -0.050351f, 0.007935f, -0.099373f, -0.046827f, -0.062196f, -0.037611f, 0.043328f, -0.062624f, -0.076822f, 0.05517f, 0.066323f, 0.002602f, -0.035498f, -0.046898f, -0.002625f, 0.070072f, 0.024656f, 0.010127f, 0.081921f, -0.071539f, -0.009279f, -0.018902f, -0.006628f, -0.051712f, -0.056968f, -0.029027f, 0.029653f, -0.053598f, 0.013349f, 0.089368f, -0.105596f, -0.017896f, 0.00856f, 0.051733f, -0.040272f, 0.067068f, -0.009837f, -0.065411f, 0.026284f, -0.083568f, 0.045907f, -0.082719f, 0.03512f, 0.05823f, 0.026688f, 0.018379f, -0.025686f, -0.023434f, -0.03848f, -0.012998f, 0.018257f, -0.075047f, 0.066941f, 0.035477f, -0.032477f, 0.077017f, 0.076393f, 0.03586f, -0.036293f, -0.036967f, -0.087198f, -0.027287f, -0.062156f, 0.029171f, 0.03734f, -0.058918f, 0.026075f, 0.04366f, 0.045802f, 0.063855f, -0.038453f, 0.011875f, -0.037767f, -0.035727f, -0.063811f, -0.040963f, -0.007735f, -0.058688f, -0.042245f, 0.065353f, -0.08305f, -0.049137f, -0.089965f, 0.044916f, -0.003661f, -0.014689f, -0.109345f, 0.108348f, 0.075303f, 0.076096f, 0.085749f, 0.038407f, -0.08505f, 0.081353f, 0.094829f, 0.026125f, -0.036696f, -0.081616f, 0.009468f, 0.031181f, 0.109346f, -0.056406f, -0.08279f, -0.026859f, 0.049956f, -0.048983f, 0.048257f, 0.095671f, 0.045888f, -0.086962f, 0.001001f, -0.104514f, -0.075887f, 0.059352f, -0.045782f, -0.003016f, 0.034063f, -0.082361f, 0.075598f, -0.076846f, 0.079722f, -0.064941f, 0.074245f, -0.015529f, 0.069865f, -0.016684f, 0.045977f, 0.056399f, 0.009092f, -0.031053f, -0.036843f, -0.092014f, -0.109454f, 0.032145f, -0.010342f, -0.071432f, 0.06716f, 0.025587f, -0.004428f, -0.016944f, -0.020334f, -0.018283f, 0.077581f, -0.019324f, -0.079782f, -0.082838f, -0.043537f, -0.048802f, 0.04748f, 0.110761f, -0.041886f, 0.003152f, -0.086035f, -0.072923f, -0.054526f, -0.023319f, 0.080679f, -0.032709f, 0.046963f, 0.015742f, 0.040106f, -0.072998f, -0.087935f, -0.039122f, -0.092793f, 0.029314f, 0.023536f, 0.071251f, -0.008042f, -0.030119f, 0.069966f, -0.004634f, -0.019716f, 0.08895f, -0.043947f, -0.023195f, -0.059593f, -0.082439f, 0.017615f, 0.087819f, 0.022959f, 0.049395f, 0.088305f, 0.025575f, -0.024287f, 0.070052f, -0.087663f, 0.090194f, -0.010801f, -0.003721f, 0.088895f, 0.049111f, -0.090747f, -0.062036f, 0.028714f, -0.086627f, -0.049931f, -0.061752f, 0.037398f, -0.103437f, -0.044378f, -0.025337f, -0.09801f, 0.004799f, 0.020351f, 0.093124f, 0.086588f, 0.097263f, -0.032019f, -0.073421f, 0.015631f, -0.04731f, 0.012542f, -0.073874f, -0.102085f, 0.002721f, 0.034536f, -0.091657f, 0.018749f, -0.02768f, -0.0339f, -0.06921f, -0.065782f, 0.065319f, -0.077465f, -0.05419f, 0.011684f, 0.044457f, -0.004891f, -0.037438f, -0.044584f, 0.022205f, 0.043444f, 0.099882f, 0.056347f, -0.027662f, -0.060338f, -0.000184f, 0.032494f, -0.072982f, -0.098879f, -0.042608f, -0.002874f, 0.025195f, -0.10304f, 0.01451f, -0.051803f, -0.045498f, -0.010169f, 0.00701f, -0.029616f, -0.093157f, -0.063259f, 0.004208f, -0.035569f, 0.104111f, 0.049509f, -0.001851f, 0.026249f, -0.100576f, 0.052688f, 0.028819f, 0.020147f, 0.037407f, 0.061836f, -0.03849f, -0.080694f, 0.015764f, -0.034718f, -0.015085f, -0.101798f, -0.026146f, 0.074644f, 0.041915f, 0.056835f, 0.032687f, 0.006001f, 0.087097f, -0.020736f, 0.074731f, -0.043984f, -0.063813f, -0.04917f, -0.046879f, -0.020204f, 0.064868f, 0.027631f, 0.017089f, -0.018107f, 0.048679f, -0.006774f, 0.033906f, 0.019705f, -0.022603f, -0.081318f, -0.085938f, 0.015825f, -0.100927f, 0.007547f, 0.097556f, 0.004866f, 0.083364f, -0.02996f, 0.014776f, 0.073481f, -0.022616f, 0.024212f, 0.053379f, -0.021499f, -0.111147f, 0.09106f, -0.009208f, -0.07832f, 0.056152f, -0.038484f, -0.053538f, -0.060885f, 0.041014f, 0.096254f, -0.032928f, 0.055596f, 0.018321f, -0.03181f, -0.092723f, -0.032685f, -0.10708f, 0.094055f, -0.020656f, 0.010175f, 0.083613f, 0.016742f, -0.052843f, 0.094715f, -0.05415f, -0.069809f, -0.022048f, 0.001183f, 0.079457f, -0.002836f, 0.075828f, 0.036916f, -0.005525f, -0.091744f, -0.068481f, 0.097827f, 0.056765f, -0.032283f, 0.064207f, 0.095076f, 0.069344f, 0.072637f, -0.050943f, 0.065507f, -0.100554f, 0.061453f, 0.025274f, 0.030666f, -0.000481f, 0.029011f, -0.07619f, -0.080358f, 0.077372f, -0.039922f, 0.042454f, 0.025178f, 0.025379f, -0.09126f, -0.08971f, -0.034992f, 0.072012f, -0.049389f, -0.009504f, 0.021584f, 0.016808f, -0.074056f, 0.024568f, 0.081412f, 0.030808f, 0.001244f, 0.083167f, 0.052289f, -0.073752f, -0.008762f, 0.0758f, 0.037268f, 0.05307f, -0.084404f, -0.019093f, 0.038094f, 0.029056f, -0.086493f, 0.025093f, 0.010555f, -0.037855f, -0.053238f, -0.079063f, -0.006884f, -0.036182f, 0.000547f, 0.054148f, -0.056446f, -0.009508f, 0.045589f, -0.038056f, 0.066779f, 0.070121f, -0.093018f, -0.062494f, 0.036677f, -0.009219f, 0.087798f, 0.043295f, 0.01412f, -0.089198f, -0.092031f, -0.022495f, -0.024452f, 0.100946f, 0.043303f, -0.035746f, -0.013525f, -0.068808f, -0.05058f, -0.047655f, 0.027471f, -0.061134f, 0.051486f, -0.084315f, 0.067608f, 0.016844f, 0.005128f, -0.06313f, 0.033934f, -0.040413f, 0.071204f, 0.045327f, 0.078643f, 0.055149f, -0.039231f, -0.002569f, 0.027224f, -0.030741f, 0.049184f, -0.046731f, -0.06417f, -0.078577f, 0.017023f, -0.039442f, 0.067155f, 0.035561f, -0.058253f, -0.002817f, 0.109414f, 0.079599f, 0.090089f, -0.060709f, 0.050734f, -0.014513f, 0.044588f, -0.093228f, 0.034285f, 0.021701f, -0.059523f, 0.015512f, 0.069106f, 0.026717f, -0.067832f, -0.027572f, -0.040268f, -0.038593f, 0.01709f, 0.105284f, 0.008663f, 0.069901f, 0.099684f, -0.041063f, -0.097243f, 0.037996f, 0.054426f, -0.046909f, -0.040188f, 0.055267f, -0.055385f, 0.079891f, 0.082639f, 0.027414f, -0.05445f, 0.075233f, -0.050046f, -0.054879f, 0.005413f, 0.023829f, -0.019862f, -0.107115f, 0.081848f, -0.107186f, 0.063231f, 0.069713f, 0.102702f, -0.050328f, -0.051338f, -0.102328f, 0.032923f, -0.057902f, -0.067207f, -0.042556f, -0.048011f, -0.043965f, 0.034463f, 0.003159f, 0.029127f, 0.016195f, 0.073487f, -0.10177f, -0.005244f, -0.026237f, 0.04122f, -0.068267f, 0.026921f, -0.047459f, -0.057021f, -0.036873f, -0.081912f, 0.059105f, 0.0799f, -0.087565f, 0.032855f, 0.017414f, 0.092869f, 0.022625f, -0.029044f, 0.031466f, -0.088179f, -0.05234f, -0.061805f, 0.001917f, -0.043974f, -0.091219f, 0.000914f, 0.038654f, -0.061429f, 0.031373f, -0.093652f, 0.048988f, 0.096701f, -0.022335f, -0.083061f, -0.032002f, -0.083835f, -0.009984f, -0.05223f, 0.110774f, -0.004718f, -0.005425f, -0.082876f, 0.001793f, -0.089719f, -0.033677f, -0.053413f, -0.083223f, 0.051883f, -0.086749f, 0.0008f, -0.035517f, -0.057356f, -0.036476f, 0.05162f, 0.0437f, -0.017893f, -0.023574f, 0.030566f, -0.02713f, 0.059636f, -0.052943f, -0.081211f, 0.007875f, -0.047319f, -0.02079f, -0.052586f, 0.087625f, 0.090383f, 0.006946f, 0.076187f, -0.052875f, 0.04214f, 0.043881f, -0.043415f, 0.055677f, -0.06507f, -0.050568f, -0.042536f, 0.038015f, -0.045512f, -0.048087f, -0.055972f, 0.09739f, 0.083626f, 0.05069f, -0.027265f, 0.010188f, -0.015535f, -0.020215f, -0.060657f, -0.060331f, -0.047654f, 0.06903f, 0.02362f, -0.084287f, -0.000678f, -0.019283f, -0.081588f, 0.055661f, 0.003507f, -0.014336f, -0.064756f, -0.016314f, -0.047288f, -0.000343f, -0.031567f, -0.045475f, -0.021839f, 0.01307f, 0.061868f, -0.049019f, -0.046472f, 0.039142f, 0.10981f, -0.064831f, -0.061014f, 0.054712f, 0.043991f, -0.027844f, -0.09221f, 0.000541f, 0.000719f, 0.036523f, 0.041955f, 0.042384f, 0.044278f, 0.059027f, -0.00546f, -0.094076f, 0.077824f, 0.005515f, -0.072538f, 0.070738f, -0.002866f, -0.050664f, 0.009451f, 0.050093f, 0.063394f, -0.108614f, -0.041758f, -0.096057f, 0.053836f, 0.030582f, -0.055113f, 0.055534f, 0.01899f, 0.042808f, 0.036945f, -0.065474f, 0.000658f, 0.017814f, -0.024052f, 0.056182f, 0.002258f, -0.024831f, -0.060557f, 0.034839f, -0.087835f, -0.006094f, 0.012598f, -0.029636f, -0.053381f, -0.016618f, -0.064831f, 0.057028f, 0.016733f, -0.101394f, 0.090415f, 0.035371f, 0.109232f, 0.047604f, 0.075018f, 0.04917f, -0.026098f, 0.035226f, -0.084722f, 0.008079f, 0.097187f, -0.009053f, 0.097826f, -0.038544f, 0.001912f, 0.022538f, 0.086987f, 0.050278f, 0.013156f, -0.072069f, -0.040384f, -0.07394f, 0.001534f, 0.084631f, 0.070147f, -0.013396f, -0.013766f, -0.092468f, 0.05008f, -0.038421f, -0.086595f, 0.080482f, -0.017093f, 0.029628f, 0.012038f, 0.067613f, 0.094897f, 0.030038f, -0.070914f, 0.022683f, -0.077396f, -0.043662f, -0.096004f, -0.025537f, 0.062128f, -0.042655f, 0.047988f, -0.015363f, -0.024403f, 0.053732f, -0.020147f, 0.094821f, -0.041412f, 0.060622f, -0.045808f, 0.021017f, -0.065594f, -0.102142f, -0.023367f, -0.052065f, -0.017464f, -0.060262f, -0.079923f, 0.056592f, -0.021423f, -0.04735f, 0.090697f, -0.019641f, -0.004295f, 0.102856f, -0.088675f, -0.066673f, 0.028497f, 0.000999f, -0.012254f, -0.07008f, 0.010353f, 0.006033f, 0.051881f, -0.052506f, -0.019156f, -0.02528f, -0.072748f, 0.019443f, 0.051604f, -0.103566f, 0.003228f, 0.062852f, 0.018087f, 0.081809f, -0.098253f, -0.073255f, -0.036837f, -0.112316f, 0.000788f, 0.01075f, -0.029727f, -0.023222f, 0.058143f, 0.034111f, -0.032011f, -0.033444f, -0.044206f, -0.032347f, 0.045728f, 0.020677f, -0.058202f, 0.018829f, 0.067093f, -0.058677f, -0.110695f, -0.031794f, 0.09525f, -0.106034f, -0.064521f, -0.079433f, 0.053846f, 0.088044f, 0.004461f, -0.093288f, 0.003143f, 0.070008f, -0.048603f, -0.030971f, 0.048041f, -0.023334f, 0.040956f, 0.042728f, 0.058732f, 0.005521f, -0.006474f, 0.027794f, -0.066318f, -0.066779f, 0.071048f, 0.053285f, -0.030704f, 0.004564f, -7e-06f, -0.02255f, -0.059534f, -0.069959f, 0.049955f, 0.042984f, 0.095093f, -0.052174f, 0.076518f, 0.036896f, 0.017278f, 0.040203f, 0.05021f, 0.010076f, 0.029003f, 0.076245f, 0.059316f, -0.0972f, 0.060801f, 0.105383f, -0.003076f, -0.103426f, 0.049778f, -0.020572f, 0.061939f, -0.078545f, -0.027399f, -0.098856f, -0.025017f, -0.068132f, 0.009202f, 0.049873f, -0.050681f, -0.058848f, -0.086309f, -0.04508f, 0.045036f, -0.000196f, -0.053435f, -0.036348f, -0.014231f, -0.077078f, 0.009911f, 0.001561f, 0.061009f, 0.035964f, -0.043796f, -0.051087f, 0.089508f, 0.076509f, -0.084451f, -0.079712f, -0.000682f, 0.054023f, 0.085436f, -0.077178f, 0.077081f, 0.003393f, 0.018601f, -0.046031f, -0.061734f, 0.026251f, -0.048213f, -0.084794f, 0.108427f, -0.027517f, -0.067649f, 0.045338f, 0.067951f, -0.029677f, 0.032566f, -0.064445f, -0.027724f, -0.041124f, -0.035967f, 0.088617f, -0.091796f, -0.000682f, 0.031046f, -0.043301f, -0.06673f, 0.055626f, -0.07948f, 0.013922f, 0.102605f, 0.063932f, -0.020303f, 0.02991f, 0.022479f, 0.040904f, -0.032472f, 0.007341f, -0.0779f, -0.046464f, -0.005692f, -0.080233f, -0.079142f, -0.04646f, -0.005597f, 0.004223f, 0.01776f, 0.098198f, 0.021626f, -0.066925f, -0.04927f, -0.057445f, 0.071283f, -0.014036f, -0.076848f, 0.083088f, -0.011759f, 0.007606f, 0.093837f, 0.026833f, -0.013619f, 0.069285f, 0.086976f, 0.005454f, 0.046541f, 0.051146f, -0.03492f, -0.083011f, -0.003168f, -0.077599f, 0.048666f, 0.046119f, 0.028198f, 0.072598f, 0.093636f, -0.001002f, 0.028059f, 0.109917f, 0.087453f, 0.016368f, -0.01196f, 0.059696f, -0.100514f, -0.074997f, 0.036908f, -0.085092f, 0.066682f, -0.006779f, 0.080304f, -0.099339f, -0.011381f, -0.052355f, -0.079375f, -0.008185f, -0.099229f, -0.073368f, -0.023276f, -0.036483f, 0.05526f, -0.029674f, -0.020592f, 0.081885f, -0.049828f, 0.037809f, -0.00775f, -0.091211f, 0.045947f, 0.108448f, -0.017637f, 0.006251f, 0.047296f, 0.067192f, 0.010706f, -0.05467f, -0.039138f, 0.055957f, -0.068871f, 0.012389f, -0.013956f, -0.01483f, 0.068335f, -0.05291f, 0.109619f, -0.027682f, 0.078936f, -0.053303f, 0.046467f, 0.019066f, 0.049444f, 0.091134f, 0.052942f, 0.015415f, 0.035691f, 0.040628f, 0.007558f, -0.062947f, -0.067088f, -0.082283f, 0.064061f, -0.04315f, 0.044054f, -0.089239f, 0.018107f, -0.07656f, 0.020699f, -0.078695f, 0.034359f, 0.040887f, -0.004609f, -0.016521f, -0.068515f, 0.072839f, -0.005595f, 0.033638f, 0.039402f, -0.084375f, -0.045842f, -0.039056f, 0.088164f, -0.048776f, 0.081144f, 0.041864f, 0.02107f, -0.059932f, -0.091363f, -0.01427f, 0.014274f, -0.038085f, 0.079337f, 0.027667f, 0.087709f, 0.071685f, -0.010499f, -0.061065f, 0.010234f, -0.056261f, -0.0127f, -0.003115f, 0.013804f, -0.068794f, -0.087026f, -0.001835f, -0.003891f, -0.084084f, 0.009593f, -0.059382f, 0.106298f, 0.059803f, -0.015449f, 0.078416f, -0.075415f, 0.061931f, 0.034148f, -0.099027f, 0.004591f, 0.038605f, 0.013197f, 0.035934f, 0.04213f, 0.013917f, 0.051811f, -0.086643f, 0.106963f, -0.027011f, -0.031991f, -0.017618f, 0.086509f, 0.090765f, 0.058546f, -0.044628f, -0.047783f, 0.077758f, 0.043294f, -0.052714f, 0.070425f, 0.068689f, 0.030842f, 0.083845f, -0.006684f, 0.068644f, -0.053829f, 0.072661f, -0.021884f, -0.079668f, -0.072708f, 0.01939f, 0.056305f, -0.07539f, -0.002176f, 0.061665f, 0.010984f, -0.00987f, -0.049124f, -0.088539f, -0.045097f, -0.025665f, -0.041483f, -0.069119f, -0.058332f, 0.007105f, 0.096241f, -0.029812f, -0.020957f, -0.03982f, 0.028641f, 0.056628f, 0.031103f, 0.107461f, 0.095408f, 0.053264f, -0.087975f, 0.060304f, 0.007353f, 0.037684f, 0.10292f, -0.040411f, -0.016059f, 0.026727f, -0.025722f, 0.053715f, -0.008301f, -0.083578f, 0.065843f, -0.000375f, 0.023729f, -0.009135f, 0.02675f, 0.098958f, -0.017362f, 0.056004f, 0.088652f, -0.090796f, 0.015673f, 0.00465f, 0.081441f, 0.103122f, -0.07364f, -0.09137f, -0.003296f, -0.079857f, -0.007995f, 0.03204f, 0.06272f, 0.082668f, 0.079526f, 0.064386f, -0.035235f, -0.039225f, 0.047358f, -0.012389f, -0.083697f, 0.002879f, -0.011317f, -0.078864f, -0.01486f, 0.103011f, 0.095624f, 0.084695f, 0.001927f, -0.06512f, -0.054979f, -0.073322f, -0.079251f, 0.086848f, -0.047707f, -0.036213f, -0.070108f, -0.10644f, 0.100891f, 0.046158f, -0.023592f, -0.077894f, 0.099809f, 0.002199f, 0.023351f, -0.075047f, -0.027589f, -0.035166f, -0.074816f, 0.061492f, -0.069201f, -0.098644f, 0.112012f, 0.101532f, 0.042642f, 0.056375f, -0.052036f, -0.092798f, 0.059413f, -0.016699f, -0.021643f, 0.02286f, 0.043419f, 0.004218f, -0.094807f, -0.012855f, -0.092343f, -0.065022f, 0.042483f, -0.061424f, -0.053625f, 0.10615f, 0.045312f, 0.038442f, -0.032738f, -0.080684f, 0.077038f, 0.068062f, 0.088538f, -0.044771f, -0.061677f, -0.013814f, 0.055221f, 0.110367f, 0.061579f, -0.108856f, -0.09671f, 0.021418f, -0.085721f, 0.01866f, -0.103383f, 0.046512f, -0.033175f, 0.063417f, 0.024804f, 0.00133f, -0.01732f, -0.069077f, 0.034517f, 0.021696f, 0.076136f, -0.107637f, -0.052141f, 0.019297f, 0.014771f, -0.013499f, -0.085706f, 0.080717f, -0.030743f, -0.013394f, 0.001964f, 0.019946f, -0.047799f, -0.011674f, 0.088733f, -0.075567f, 0.026621f, 0.111916f, -0.014711f, 0.068565f, -0.078958f, -0.00929f, -0.107336f, -0.037985f, 0.09847f, -0.029676f, 0.002352f, -0.034527f, 0.04803f, -0.010566f, -0.001572f, -0.076079f, 0.035181f, 0.020763f, 0.10591f, 0.068112f, -0.031914f, -0.034395f, 0.035859f, -0.018356f, -0.00615f, 0.091589f, -0.095361f, 0.003021f, 0.039352f, -0.056085f, 0.011207f, 0.045941f, -0.03488f, 0.104457f, -0.068649f, 0.00111f, 0.053097f, -0.005627f, 0.016641f, -0.018075f, -0.099333f, -0.01854f, -0.097049f, 0.064181f, -0.008185f, -0.014299f, 0.051042f, 0.017213f, -0.021331f, -0.06843f, 0.014056f, -0.073519f, -0.017918f, 0.084483f, -0.034981f, -0.026469f, -0.089922f, 0.087564f, -0.097208f, 0.015943f, 0.101724f, 0.094555f, -0.080485f, -0.028334f, -0.068919f, -0.035667f, -0.025797f, -0.051995f, 0.039253f, -0.034271f, -0.032192f, -0.05035f, -0.036981f, -0.010551f, -0.023547f, 0.020377f, 0.059351f, -0.089432f, -0.079483f, -0.054152f, -0.093142f, -0.047729f, -0.103822f, 0.050722f, 0.064279f, -0.078898f, -0.04123f, 0.01016f, -0.079576f, -0.071839f, -0.086083f, -0.083064f, 0.025606f, 0.007947f, -0.059309f, -0.052798f, -0.032137f, 0.007391f, 0.095382f, 0.036686f, -0.020678f, 0.065295f, 0.00134f, 0.010559f, 0.018266f, -0.022058f, -0.0006f, -0.089352f, 0.048889f, 0.098999f, 0.088579f, -0.101358f, 0.077964f, 0.050374f, -0.058326f, 0.038534f, -0.096992f, 0.04716f, 0.058119f, 0.106286f, 0.001987f, 0.006109f, 0.001962f, 0.01265f, 0.056785f, 0.056441f, -0.10483f, 0.024633f, 0.04155f, 0.039014f, 0.04986f, 0.034862f, -0.061964f, 0.029568f, 0.053559f, -0.084199f, -0.024978f, -0.072419f, -0.100775f, 0.053749f, -0.009044f, 0.060013f, -0.052471f, -0.060073f, -0.066791f, 0.050028f, -0.034233f, 0.036264f, -0.046088f, -0.009709f, 0.071128f, 0.030056f, -0.017375f, 0.062833f, -0.020061f, 0.047861f, 0.074815f, -0.042074f, 0.003524f, 0.008468f, 0.004947f, 0.026627f, 0.076681f, 0.013365f, 0.06518f, 0.095118f, 0.002771f, -0.049989f, 0.015639f, 0.057767f, 0.01593f, -0.079946f, -0.079689f, -0.040912f, -0.044406f, 0.077408f, 0.046872f, -0.072039f, -0.054453f, -0.100683f, -0.038593f, -0.027317f, -0.035906f, 0.058443f, 0.02293f, -0.064446f, 0.039293f, -0.026926f, 0.050287f, -0.013273f, -0.063373f, -0.079154f, 0.026772f, -0.022319f, -0.033641f, 0.045166f, 0.021935f, 0.059694f, 0.026345f, -0.060992f, -0.060849f, 0.014971f, 0.015961f, 0.029984f, 0.012578f, 0.104501f, 0.089799f, -0.035716f, 0.050219f, 0.066302f, 0.079947f, -0.02055f, 0.081216f, -0.032922f, 0.046269f, 0.010033f, -0.043358f, -0.052434f, 0.020435f, 0.062942f, -0.015253f, -0.079848f, -0.048359f, -0.027855f, -0.010626f, 0.038438f, -0.071815f, -0.069389f, -0.054584f, -0.059137f, -0.049385f, -0.109507f, -0.056152f, 0.029047f, 0.08009f, -0.003901f, 0.064669f, -0.053102f, 0.085629f, -0.10753f, -0.096933f, -0.023364f, 0.090634f, -0.000608f, -0.093113f, 0.076601f, -0.057105f, -0.037619f, -0.07926f, 0.094913f, -0.111514f, 0.063438f, -0.054785f, -0.04399f, -0.043549f, -0.053288f, -0.060959f, 0.055283f, -0.032742f, -0.013881f, -0.063852f, 0.073775f, 0.003996f, -0.040999f, -0.054231f, 0.085287f, -0.063633f, -0.067293f, 0.044108f, -0.057245f, -0.062936f, 0.033719f, -0.022907f, -0.048773f, 0.002051f, 0.019552f, 0.043221f, -0.034375f, -0.00309f, -0.04617f, 0.07108f, -0.011749f, 0.011787f, -0.010237f, 0.093982f, 0.059623f, 0.080985f, -0.055842f, -0.019142f, 0.002072f, 0.053219f, 0.045665f, -0.001387f, 0.018773f, 0.005825f, 0.044791f, -0.013418f, 0.047035f, 0.063398f, 0.023902f, -0.045333f, 0.006251f, 0.003955f, 0.076838f, -0.003318f, 0.064185f, 0.093541f, 0.04387f, -0.06734f, -0.028424f, 0.024361f, -0.032084f, -0.051124f, 0.002035f, 0.034882f, 0.038666f, 0.014842f, -0.055972f, -0.040557f, -0.031864f, -0.040254f, -0.039391f, -0.004796f, -0.083333f, -0.061786f, -0.010716f, -0.097258f, -0.008192f, 0.054637f, 0.078575f, -0.007522f, -0.065369f, 0.008233f, -0.055089f, 0.086414f, 0.062503f, -0.065644f, -0.095833f, 0.096016f, 0.102787f, -0.066538f, -0.063053f, 0.039799f, 0.080932f, -0.033662f, -0.040607f, -0.013466f, -0.011256f, -0.028074f, -0.003835f, 0.061539f, -0.003199f, -0.06188f, 0.066019f, 0.005837f, -0.05342f, -0.043044f, 0.000252f, -0.084004f, -0.093542f, 0.027851f, 0.060139f, -0.018955f, 0.078548f, -0.001763f, 0.059414f, 0.089976f, 0.047202f, -0.023426f, -0.094191f, -0.07742f, -0.034079f, -0.093493f, 0.05382f, -0.002155f, 0.060838f, 0.009153f, -0.081783f, 0.082294f, 0.088555f, 0.023505f, 0.028082f, -0.078201f, 0.020851f, -0.064357f, -0.015275f, -0.049773f, 0.055984f, 0.003682f, -0.098919f, -0.060383f, -0.004601f, 0.104258f, -0.063129f, 0.062145f, -0.079f, 0.030445f, -0.043799f, 0.048549f, 0.016674f, 0.069603f, -0.061822f, -0.046962f, 0.046165f, -0.034344f, -0.091963f, 0.044343f, -0.080538f, -0.091106f, 0.001884f, -0.032923f, -0.078998f, 0.037566f, -0.017507f, 0.030464f, -0.032048f, 0.071485f, 0.026142f, 0.063809f, 0.030577f, -0.017491f, -0.015977f, 0.073688f, -0.10474f, -0.075649f, 0.041493f, 0.031567f, 0.082062f, 0.051103f, 0.097059f, 0.081532f, -0.028823f, 0.051111f, -0.035687f, 0.101094f, 0.083178f, 0.042905f, -0.021985f, 0.098977f, -0.102801f, -0.015806f, 0.01294f, -0.012472f, -0.063982f, -0.009223f, 0.055152f, 0.064912f, 0.058909f, -0.084551f, 0.017255f, -0.067043f, 0.041292f, -0.037625f, 0.008777f, -0.066235f, 0.023725f, 0.083216f, -0.027675f, -0.091213f, 0.103024f, 0.028257f, 0.050818f, 0.086796f, 0.086491f, -0.010383f, 0.111106f, -0.024572f, -0.061832f, 0.077022f, 0.088386f, -0.092194f, 0.031658f, -0.044304f, 0.061833f, -0.052404f, -0.000729f, -0.075021f, 0.05694f, -0.084951f, 0.024835f, -0.069203f, 0.061002f, -0.04762f, 0.052902f, 0.015823f, 0.054296f, 0.016559f, 0.003749f, 0.007881f, -0.040289f, 0.016276f, -0.055873f, -0.058059f, 0.009892f, -0.042285f, 0.010524f, -0.029855f, -0.077669f, 0.091588f, -0.016306f, 0.078168f, -0.030653f, -0.101933f, -0.043179f, 0.080607f, -0.022808f, 0.082988f, -0.012648f, -0.046488f, 0.043262f, -0.094722f, 0.063478f, 0.001639f, -0.015463f, -0.046854f, 0.007205f, 0.101301f, -0.040799f, -0.059768f, -0.038394f, -0.07694f, -0.065048f, 0.020209f, 0.023712f, -0.033212f, 0.100752f, -0.062438f, 0.054551f, -0.014052f, -0.068159f, -0.046478f, -0.050425f, 0.074919f, -0.021494f, 0.024691f, -0.028122f, 0.07251f, 0.03805f, -0.076666f, 0.020334f, 0.109508f, 0.052631f, -0.043927f, 0.037652f, -0.02838f, -0.002498f, 0.008044f, 0.048334f, -0.048163f, -0.012385f, 0.014277f, -0.099615f, -0.058517f, 0.010238f, -0.075645f, 0.050917f, -0.095904f, 0.052063f, 0.0674f, 0.025968f, 0.093856f, 0.02133f, -0.040882f, 0.04998f, -0.048439f, 0.072727f, 0.026948f, 0.018026f, 0.024788f, -0.008139f, -0.035258f, -0.002507f, -0.066175f, 0.01297f, 0.01725f, 0.016543f, 0.043604f, 0.102218f, -0.007037f, -0.105635f, 0.084922f, -0.087465f, 0.034638f, -0.052945f, -0.056508f, 0.076169f, -0.082611f, -0.107185f, -0.006755f, 0.026629f, -0.067877f, 0.051866f, 0.078516f, 0.01481f, -0.060143f, 0.060632f, 0.083788f, 0.057662f, 0.017435f, 0.057057f, -0.040941f, 0.001953f, -0.09745f, -0.049743f, 0.085139f, 0.067991f, 0.012731f, 0.069156f, -0.005828f, 0.097078f, 0.08989f, 0.019564f, -0.07786f, 0.080698f, 0.093916f, 0.073438f, -0.017194f, -0.024404f, -0.096302f, 0.08729f, 0.042798f, 0.061751f, 0.051872f, 0.048427f, -0.081218f, -0.026947f, 0.078803f, 0.031903f, 0.048877f, 0.060815f, -0.075627f, 0.050339f, -0.078671f, 0.073916f, -0.050989f, -0.066548f, -0.049445f, -0.068414f, 0.010426f, 0.071765f, 0.039888f, 0.079175f, 0.036197f, 0.057398f, -0.031546f, -0.080025f, -0.036062f, 0.059238f, -0.027174f, -0.069315f, -0.000169f, 0.038322f, -0.055649f, 0.038038f, 0.001401f, 0.030572f, -0.104236f, -0.037253f, -0.024019f, -0.090223f, 0.049893f, -0.041245f, -0.033012f, -0.105387f, -0.060416f, 0.059432f, 0.003831f, 0.028819f, -0.059876f, -0.077161f, 0.00229f, -0.062164f, -0.074624f, -0.067378f, 0.06447f, -0.077316f, 0.090566f, 0.085924f, -0.053443f, 0.083466f, -0.043592f, 0.088736f, -0.080807f, -0.078459f, -0.030469f, -0.07838f, -0.034255f, 0.006607f, -0.062583f, -0.08972f, -0.005161f, -0.080914f, 0.022856f, 0.042394f, -0.013502f, -0.069168f, 0.037319f, -0.047104f, -0.007791f, -0.051745f, 0.020568f, 0.046795f, 0.058367f, 0.042599f, 0.026558f, 0.02879f, -0.047429f, -0.105902f, 0.02545f, 0.026242f, -0.025617f, 0.038595f, -0.035744f, -0.042536f, -0.03179f, 0.049728f, -0.07493f, 0.105612f, -0.044319f, 0.010461f, -0.041248f, -0.021733f, -0.006505f, -0.009671f, -0.056959f, -0.093412f, 0.064383f, -0.024145f, -0.037135f, -0.07101f, -0.059646f, 0.078657f, 0.036885f, -0.062238f, -0.051545f, 0.11205f, 0.010121f, -0.084161f, 0.053607f, -0.008823f, 0.019685f, 0.018429f, -0.067584f, -0.078127f, 0.0352f, -0.037748f, 0.027895f, -0.084102f, 0.073787f, 0.007921f, -0.009829f, 0.046845f, -0.006531f, 0.016716f, -0.07819f, 0.06864f, 0.010088f, 0.053199f, 0.096263f, -4e-06f, -0.067864f, -0.078461f, 0.004083f, 0.018565f, -0.024088f, -0.012277f, -0.064087f, -0.082912f, 0.095204f, -0.043381f, -0.003049f, -0.044125f, 0.098245f, -0.09196f, -0.062495f, -0.033196f, -0.010332f, -0.090797f, -0.060144f, 0.055666f, 0.000193f, -0.056089f, 0.076071f, 0.051397f, -0.05515f, 0.088736f, 0.059871f, 0.089717f, -0.084589f, 0.016938f, -0.041863f, -0.076399f, -0.057942f, 0.046967f, 0.009129f, -0.051789f, -0.073081f, -0.074049f, 0.01587f, -0.015267f, -0.016329f, -0.066686f, 0.001713f, -0.040018f, 0.082853f, 0.043395f, -0.00237f, 0.068955f, -1e-05f, 0.080452f, 0.002205f, 0.099712f, -0.079603f, 0.056757f, -0.090237f, -0.08995f, 0.054331f, 0.049191f, 0.036081f, 0.067341f, -0.023861f, -0.086176f, -0.07469f, 0.030625f, -0.044494f, 0.02782f, -0.027123f, -0.062752f, 0.057239f, -0.077563f, 0.047075f, 0.064786f, -0.069702f, -0.059341f, 0.065992f, 0.005808f, 0.001941f, 0.046517f, 0.056577f, -0.08822f, 0.011238f, -0.053293f, 0.031374f, 0.103949f, -0.069546f, 0.014508f, 0.027496f, -0.002935f, 0.010578f, -0.003297f, 0.082523f, -0.016993f, 0.068202f, 0.097687f, 0.0413f, 0.019731f, 0.027298f, -0.081007f, -0.047563f, -0.024755f, -0.017609f, -0.08385f, -0.048598f, 0.040734f, -0.102548f, 0.036355f, -0.012311f, 0.088268f, -0.026146f, 0.105134f, 0.081331f, -0.064576f, 0.064683f, -0.023753f, -0.008099f, -0.021292f, -0.084732f, 0.011635f, -0.076895f, 0.078779f, -0.006038f, 0.048551f, -0.023068f, -0.044865f, 0.014226f, 0.038662f, -0.042879f, 0.061665f, -0.061255f, -0.08054f, -0.064266f, -0.035444f, -0.002658f, -0.054335f, -0.050388f, -0.010376f, -0.071519f, 0.082487f, 0.025711f, -0.086043f, 0.106876f, -0.053782f, -0.055598f, 0.082323f, 0.045331f, -0.015144f, 0.06504f, -0.02482f, -0.109608f, 0.057691f, -0.043739f, -0.02255f, 0.091548f, 0.00653f, 0.064617f, 0.021472f, 0.000592f, 0.051675f, 0.092072f, 0.026626f, -0.084777f, -0.035671f, 0.057082f, -0.10078f, 0.089967f, 0.017403f, -0.059231f, 0.003336f, -0.108756f, -0.096844f, 0.005288f, -0.049435f, -0.07575f, 0.089018f, 0.035502f, -0.094504f, -0.054714f, -0.048713f, 0.07554f, -0.028424f, 0.002323f, 0.010742f, 0.083012f, -0.107475f, -0.026307f, -0.082953f, 0.070132f, -0.034329f, 0.065612f, 0.014501f, 0.098518f, 0.004301f, -0.020032f, 0.058309f, -0.052533f, 0.030121f, -0.080689f, 0.034463f, 0.062467f, -0.088572f, 0.091206f, -0.0602f, 0.037573f, 0.070193f, 0.038875f, -0.000377f, 0.032996f, -0.048418f, -0.022108f, 0.053155f, -0.073378f, 0.001524f, 0.079752f, -0.071015f, -0.06996f, -0.069703f, -0.084021f, 0.07449f, 0.037943f, -0.060936f, -0.015933f, 0.00928f, 0.04354f, -0.03579f, -0.044422f, -0.017711f, -0.081805f, -0.104759f, 0.027238f, -0.008382f, -0.047877f, -0.020935f, -0.069755f, -0.010215f, 0.026081f, 0.089751f, 0.009935f, -0.044179f, 0.00293f, -0.068248f, 0.068217f, 0.100312f, -0.103285f, 0.061514f, -0.010167f, 0.065693f, 0.018439f, -0.049967f, -0.098475f, 0.079716f, 0.036082f, -0.053223f, -0.078909f, 0.020878f, 0.048004f, 0.010785f, -0.091376f, 0.087422f, -0.028028f, -0.094033f, 0.050941f, 0.008522f, -0.011668f, 0.026277f, -0.021504f, -0.066876f, 0.062844f, 0.072286f, -0.046861f, -0.048624f, 0.03715f, 0.042184f, -0.091351f, 0.071976f, -0.016823f, -0.061201f, 0.042321f, -0.048827f, 0.083525f, 0.072929f, -0.078808f, 0.071512f, -0.060421f, -0.054462f, 0.098988f, -0.061086f, 0.042198f, 0.033416f, -0.069209f, 0.065632f, -0.083739f, 0.025768f, -0.099998f, 0.022792f, 0.009038f, -0.02436f, 0.013713f, 0.04252f, 0.035792f, -0.05434f, -0.022586f, 0.086735f, 0.078009f, -0.040692f, 0.082406f, 0.100415f, 0.045205f, -0.065125f, -0.071576f, 0.00481f, -0.072871f, 0.064924f, -0.008634f, -0.044305f, 0.005649f, 0.079153f, 0.074831f, -0.06196f, -0.000479f, 0.002472f, -0.072802f, 0.005947f, 0.067923f, 0.058879f, 0.038655f, -0.073128f, -0.094629f, -0.076004f, -0.078437f, 0.067556f, -0.044244f, -0.024278f, -0.065659f, -0.005206f, -0.017486f, -0.033533f, 0.083556f, -0.050923f, 0.023846f, 0.072821f, 0.021122f, 0.05103f, 0.057489f, 0.040045f, -0.008067f, -0.069093f, 0.102234f, 0.043454f, -0.112127f, -0.024381f, -0.083957f, 0.055686f, -0.049849f, 0.002454f, -0.058194f, 0.016439f, 0.045432f, 0.035178f, -0.003652f, 0.080389f, 0.036635f, -0.006891f, 0.063771f, -0.069576f, -0.083244f, 0.098162f, -0.061893f, 0.018324f, 0.011648f, -0.008677f, -0.026534f, 0.012932f, -0.023304f, 0.03132f, -0.081664f, -0.063901f, 0.014497f, -0.007023f, -0.034594f, -0.09197f, -0.057264f, 0.014975f, -0.011802f, -0.024302f, -0.078948f, -0.075089f, 0.069942f, 0.011394f, 0.089953f, -0.058491f, -0.061012f, -0.108342f, 0.034606f, 0.037749f, -0.065712f, -0.028476f, -0.063699f, -0.0821f, 0.015797f, -0.030164f, -0.02229f, 0.007987f, -0.043653f, -0.109683f, -0.032566f, 0.083551f, 0.067064f, 0.088854f, -0.067272f, 0.048807f, 0.011885f, -0.053685f, 0.025625f, 0.016353f, -0.064379f, 0.043112f, 0.062896f, -0.033449f, -0.094251f, -0.042116f, 0.071675f, -0.007777f, 0.045893f, 0.005312f, 0.102228f, 0.023227f, 0.058254f, -0.016837f, 0.00053f, -0.039548f, -0.03434f, -0.002299f, 0.02229f, -0.074017f, -0.105902f, -0.078751f, 0.009318f, 0.018132f, 0.010192f, -0.01655f, 0.005541f, -0.0327f, 0.098418f, 0.054461f, -0.003973f, 0.031865f, 0.030157f, -0.063075f, -0.06301f, 0.08745f, -0.036565f, 0.06886f, 0.047476f, 0.059013f, -0.051219f, 0.091585f, 0.070166f, -0.101242f, 0.061357f, 0.021793f, 0.023961f, 0.054396f, -0.0653f, -0.041438f, 0.064704f, -0.021945f, 0.023385f, 0.079518f, 0.072386f, 0.006492f, 0.082644f, -0.025622f, -0.027897f, 0.071363f, 0.038727f, 0.018035f, -0.06848f, 0.029235f, 0.085467f, -0.060247f, -0.096805f, -0.10353f, 0.013742f, -0.10377f, 0.08032f, 0.056449f, 0.064154f, 0.027863f, -0.106757f, 0.021895f, -0.068376f, -0.077245f, -0.071754f, -0.059977f, 0.018303f, 0.003628f, 0.041123f, 0.068703f, -0.034971f, -0.018312f, -0.017623f, -0.087475f, 0.083013f, -0.013038f, 0.024648f, -0.068654f, 0.068838f, -0.029966f, 0.031476f, -0.011553f, 0.05669f, 0.021686f, 0.082729f, -0.033488f, -0.013335f, 0.045109f, 0.03024f, -0.091102f, -0.048657f, -0.084412f, -0.045372f, -0.007306f, 0.107588f, -0.036849f, 0.003374f, -0.095441f, -0.023211f, -0.027803f, -0.03097f, -0.088401f, 0.0208f, -0.099778f, 0.02066f, -0.036888f, 0.040573f, -0.001328f, 0.100869f, -0.038656f, 0.075191f, 0.100791f, -0.105071f, 0.019044f, -0.041071f, -0.065337f, 0.00466f, 0.083244f, -0.088706f, 0.07841f, 0.075379f, 0.06173f, -0.096634f, -0.023408f, -0.083194f, -0.025465f, -0.068889f, -0.080079f, 0.015512f, 0.009477f, 0.087766f, -0.076276f, -0.045166f, 0.02972f, -0.095943f, 0.086288f, 0.072163f, 0.012442f, 0.066926f, -0.012892f, -0.082449f, -0.037894f, 0.021165f, 0.032649f, -0.072365f, -0.002292f, 0.049416f, 0.041362f, -0.072156f, -0.019897f, -0.079274f, -0.067477f, -0.050839f, -0.024797f, 0.009822f, 0.046261f, 0.070413f, 0.019485f, -0.04737f, -0.08216f, 0.084845f, -0.021874f, 0.013413f, 0.043829f, 0.063714f, 0.051841f, 0.003139f, -0.028216f, 0.055337f, -0.016115f, -0.093512f, 0.06857f, 0.022196f, 0.007847f, 0.106929f, 0.02632f, -0.073583f, -0.033563f, 0.011623f, 0.04974f, 0.051498f, 0.021899f, -0.098601f, -0.039899f, -0.02809f, 0.073878f, -0.072982f, -0.057793f, -0.078421f, 0.005553f, -0.062751f, 0.098391f, -0.002759f, 0.084124f, -0.044315f, 0.001393f, 0.036129f, 0.073985f, 0.016137f, 0.110467f, 0.046121f, 0.023355f, 0.071508f, 0.029091f, -0.078481f, 0.0589f, -0.050389f, -0.082453f, -0.045282f, 0.058131f, 0.025161f, -0.042279f, 0.062583f, -0.067547f, -0.054882f, 0.056923f, -0.017023f, -0.020029f, 0.017422f, 0.095518f, 0.103372f, -0.096283f, 0.072967f, 0.102752f, -0.043744f, -0.108346f, -0.041487f, 0.041779f, -0.068615f, -0.047034f, -0.080873f, -0.073373f, 0.084663f, 0.004963f, 0.073403f, -0.059575f, 0.021239f, 0.032876f, 0.053551f, -0.016866f, -0.037182f, 0.015527f, -0.009649f, 0.022164f, 0.073484f, -0.034908f, 0.00635f, -0.044701f, 0.008837f, 0.061915f, -0.047192f, 0.082326f, 0.037304f, 0.053819f, 0.073569f, 0.01294f, -0.042569f, 0.109259f, -0.029492f, -0.052188f, -0.00745f, -0.003619f, -0.075673f, -0.013296f, -0.050479f, 0.089281f, 0.085659f, 0.007964f, 0.050581f, 0.000889f, -0.03704f, 0.047194f, -0.048332f, -0.040847f, 0.056336f, -0.010918f, -0.07227f, -0.094567f, 0.060987f, -0.085418f, 0.089469f, 0.080724f, -0.026887f, -0.061839f, 0.057545f, 0.062454f, 0.100308f, -0.06687f, 0.100913f, 0.006128f, 0.01299f, 0.034847f, -0.049962f, -0.039645f, 0.064637f, 0.013449f, 0.053308f, -0.026857f, -0.081024f, -0.064709f, -0.034897f, -0.018193f, -0.046831f, 0.050134f, 0.040532f, 0.040898f, 0.050216f, 0.00051f, 0.048257f, 0.075357f, 0.020686f, 0.074687f, 0.027477f, 0.018611f, -0.013833f, 0.025267f, 0.046268f, 0.093895f, -0.093898f, 0.012678f, -0.030785f, 0.087104f, -0.053647f, 0.051707f, -0.087673f, 0.067077f, 0.061871f, 0.058163f, 0.069066f, 0.023592f, -0.040266f, 0.060181f, 0.041699f, 0.047713f, 0.022212f, 0.054026f, -0.07661f, 0.091157f, -0.041881f, 0.071114f, -0.088583f, 0.09565f, 0.096662f, 0.084946f, 0.015613f, -0.070366f, -0.072796f, 0.00739f, 0.022733f, 0.014021f, -0.087864f, 0.062463f, 0.054158f, 0.0596f, -0.031019f, 0.028245f, 0.011723f, 0.083288f, -0.017212f, 0.046467f, 0.024275f, -0.025072f, -0.024531f, -0.021991f, 0.043802f, 0.048385f, -0.06153f, 0.044519f, -0.009782f, -0.037766f, -0.019848f, -0.07882f, -0.053775f, -0.059191f, -0.024575f, -0.010116f, 0.098899f, 0.052421f, 0.000237f, -0.036569f, -0.056425f, -0.011234f, 0.012104f, -0.057351f, 0.088677f, 0.032028f, -0.004881f, 0.044861f, -0.081862f, 0.08247f, -0.10991f, -0.007262f, 0.016643f, -0.063378f, 0.031312f, 0.076413f, -0.088281f, -0.088763f, 0.058262f, 0.043088f, -0.021021f, -0.02f, -0.020247f, 0.054036f, -0.081634f, 0.069372f, -0.085129f, 0.051409f, 0.017885f, 0.079219f, -0.058466f, -0.053514f, -0.041816f, -0.009668f, -0.025418f, -0.033489f, -0.057322f, 0.036417f, -0.095128f, 0.066644f, -0.015668f, 0.051626f, -0.07422f, 0.073715f, -0.028982f, -0.110838f, 0.054047f, 0.031427f, 0.019716f, 0.037498f, -0.064399f, -0.046271f, -0.092073f, 0.094217f, -0.01703f, -0.078643f, -0.110718f, 0.047118f, -0.039039f, -0.058436f, 0.003674f, -0.02002f, 0.009299f, -0.098938f, -0.040807f, 0.101961f, -0.043041f, -0.028827f, -0.060546f, 0.014175f, -0.006572f, -0.029029f, -0.028056f, 0.053293f, -0.004809f, -0.05137f, -0.020401f, 0.094728f, 0.001983f, -0.08295f, 0.071944f, 0.065204f, -0.015328f, -0.096104f, 0.056127f, -0.048507f, -0.001297f, 0.070697f, 0.01124f, -0.043944f, 0.085435f, 0.084311f, 0.035088f, -0.110354f, -0.100014f, 0.001961f, 0.045118f, -0.052324f, 0.093273f, 0.069483f, 0.07057f, 0.015707f, -0.022365f, -0.068764f, 0.079808f, -0.05687f, -0.072431f, 0.069973f, 0.001169f, 0.103368f, 0.066232f, -0.036842f, 0.045506f, 0.003984f, -0.006776f, 0.023589f, -0.007262f, -0.085819f, -0.056554f, -0.003842f, -0.089731f, 0.06337f, -0.029854f, -0.095054f, 0.082489f, -0.09775f, -0.073791f, 0.067115f, 0.086671f, -0.091255f, -0.091823f, -0.000222f, -0.028712f, 0.094139f, 0.003383f, 0.02778f, -0.04465f, -0.047368f, 0.021937f, 0.001635f, -0.004852f, 0.062532f, -0.026659f, -0.013046f, -0.0076f, -0.101519f, 0.053341f, -0.023668f, 0.017372f, 0.0848f, -0.034651f, 0.049343f, 0.01956f, 0.019863f, 0.093492f, -0.028237f, -0.077798f, -0.037164f, -0.085909f, 0.046713f, 0.111434f, 0.080297f, 0.046743f, 0.017891f, 0.023954f, -0.000174f, -0.028019f, -0.058306f, 0.045258f, -0.103052f, -0.048789f, -0.111419f, 0.007385f, -0.016832f, -0.022292f, 0.020795f, -0.090638f, -0.030182f, -0.039426f, 0.065342f, 0.042779f, -0.064669f, 0.07057f, -0.007636f, 0.043658f, 0.049905f, -0.043358f, 0.004247f, 0.022744f, 0.082113f, -0.084028f, 0.053758f, -0.01055f, -0.057658f, -0.037854f, -0.058127f, -0.069186f, -0.041657f, 0.002845f, 0.029121f, 0.077822f, -0.04402f, -0.09597f, -0.00715f, 0.052399f, 0.064532f, -0.060031f, -0.046125f, -0.086844f, -0.018395f, -0.016446f, -0.00339f, 0.034353f, -0.000114f, -0.088596f, 0.034905f, -0.052979f, 0.041206f, 0.060947f, -0.029003f, -0.081595f, 0.097918f, -0.029959f, 0.058031f, -0.016613f, 0.05689f, 0.015432f, -0.027361f, -0.085356f, -0.081606f, 0.041184f, -0.088674f, -0.064164f, 0.019675f, -0.080091f, -0.069572f, -0.040716f, -0.054456f, -0.019123f, 0.051719f, 0.036762f, 0.043074f, -0.008126f, -0.097726f, -0.00508f, -0.062857f, 0.059578f, -0.054216f, -0.032441f, -0.093987f, -0.024985f, 0.011857f, -0.003099f, 0.044418f, -0.033766f, 0.084688f, 0.050324f, 0.065339f, -0.053486f, -0.045762f, -0.01479f, -0.047851f, -0.070035f, -0.103177f, -0.029689f, -0.076006f, -0.059112f, 0.077892f, -0.019027f, -0.070167f, 0.081548f, -0.07384f, 0.007665f, 0.050832f, 0.111139f, -0.076007f, 0.035343f, -0.096528f, 0.004923f, 0.067951f, -0.015889f, 0.015639f, -0.018433f, -0.036109f, -0.039912f, 0.013735f, 0.012301f, 0.066894f, 0.050808f, 0.033304f, 0.037485f, -0.001593f, 0.048229f, -0.028039f, 0.094704f, -0.084388f, -0.073533f, -0.076292f, -0.079472f, 0.000488f, -0.111579f, -0.062796f, -0.070472f, 0.05958f, 0.080785f, 0.014379f, -0.007777f, 0.062564f, 0.058326f, -0.026651f, 0.039775f, 0.025515f, -0.025317f, -0.085515f, -0.014036f, -0.035933f, 0.096004f, -0.096635f, 0.087433f, 0.051924f, 0.085953f, -0.05427f, 0.024618f, -0.05741f, 0.037455f, -0.087759f, -0.001929f, -0.054543f, 0.03814f, 0.095829f, -0.108226f, 0.076642f, -0.085554f, 0.03346f, 0.031888f, 0.022338f, 0.027904f, 0.066108f, -0.019635f, -0.024993f, 0.019349f, 0.009025f, -0.000692f, 0.09242f, 0.066985f, 0.013669f, -0.027755f, 0.044681f, 0.074189f, -0.042431f, 0.093492f, -0.030617f, -0.018749f, 0.04145f, -0.080636f, 0.071801f, 0.065322f, -0.087244f, 0.071698f, 0.078555f, 0.040303f, 0.074487f, 0.056149f, 0.022413f, 0.082757f, -0.028735f, -0.050746f, -0.075387f, 0.044191f, 0.091314f, 0.050964f, 0.059475f, 0.067464f, -0.011931f, 0.047f, -0.029665f, -0.059368f, 0.095083f, -0.031672f, 0.054335f, 0.023278f, -0.029231f, -0.028994f, 0.053673f, -0.048296f, 0.004173f, -0.08019f, -0.041904f, -0.059918f, -0.025976f, 0.055618f, -0.036298f, -0.018194f, 0.011707f, 0.004148f, -0.052719f, -0.073888f, 0.088008f, -0.043293f, 0.037511f, -0.00025f, 0.0435f, -0.07082f, 0.021012f, 0.061725f, 0.061189f, 0.017608f, -0.101087f, 0.004586f, -0.032789f, -0.002943f, 0.003823f, -0.010455f, 0.062901f, -0.019091f, -0.039516f, 0.039219f, -0.087353f, -0.050698f, -0.006378f, -0.0973f, -0.095931f, -0.004269f, 0.030353f, 0.082784f, 0.077235f, -0.030449f, 0.040406f, -0.056633f, -0.093888f, -0.04641f, 0.046406f, -0.087709f, -0.015379f, 0.084517f, -0.061768f, 0.053659f, -0.07199f, 0.03615f, -0.029512f, 0.01679f, -0.100692f, 0.040784f, -0.081719f, -0.051133f, 0.023337f, 0.007259f, -0.052011f, 0.054654f, -0.076984f, -0.042983f, -0.057709f, -0.074645f, 0.033859f, 0.105738f, 0.065462f, 0.018966f, -0.036332f, 0.054048f, 0.079337f, 0.015416f, 0.056186f, 0.061957f, 0.012791f, 0.002858f, -0.011207f, 0.099729f, 0.089758f, 0.062962f, -0.041711f, -0.001882f, -0.069008f, -0.035371f, 0.062474f, -0.071866f, 0.022292f, 0.007822f, -0.107736f, -0.081144f, 0.003688f, -0.005627f, -0.073919f, 0.018077f, -0.105025f, -0.027128f, -0.063016f, -0.078109f, 0.044498f, -0.019898f, -0.064691f, -0.055795f, 0.062654f, -0.008031f, -0.033195f, 0.004418f, -0.02503f, 0.091784f, -0.070131f, -0.052119f, 0.092797f, -0.066098f, -0.099564f, 0.005524f, 0.066103f, -0.065526f, 0.072091f, 0.07649f, 0.056571f, 0.070203f, -0.053908f, -0.037805f, -0.052187f, 0.009944f, 0.067165f, -0.007473f, 0.065356f, -0.016942f, -0.027819f, -0.059049f, -0.110746f, -0.043326f, 0.077363f, -0.045508f, 0.072684f, 0.019084f, -0.010129f, -0.087942f, 0.028982f, 0.003053f, -0.021067f, 0.109953f, 0.035661f, -0.03317f, -0.02162f, 0.034414f, -0.05166f, 0.01539f, 0.023221f, 0.038468f, 0.067129f, 0.037595f, 0.075484f, -0.082227f, 0.005737f, -0.075255f, 0.085571f, -0.083606f, -0.00983f, -0.068958f, 0.014494f, -4.9e-05f, -0.084624f, 0.063894f, -0.003588f, -0.006926f, 0.062567f, 0.065452f, 0.083193f, -0.069579f, 0.004058f, -0.034025f, -0.019068f, -0.025577f, -0.055394f, 0.01638f, 0.006792f, -0.081056f, -0.041867f, -0.046268f, -0.070197f, -0.005366f, 0.026276f, -0.067817f, -0.049229f, -0.007597f, -0.076226f, 0.086337f, -0.026842f, 0.055997f, 0.008709f, 0.03033f, 0.044462f, -0.048723f, -0.006089f, -0.058148f, -0.059218f, 0.051956f, -0.020128f, 0.060678f, 0.044236f, 0.016623f, 0.008172f, -0.003849f, -0.011204f, -0.075264f, 0.003988f, 0.003567f, 0.052771f, -0.041403f, -0.018606f, 0.051382f, 0.080213f, -0.010004f, 0.010312f, -0.033399f, 0.004417f, 0.009524f, -0.056879f, -0.069222f, -0.068093f, 0.051211f, 0.009024f, -0.088999f, 0.072602f, -0.083916f, 0.004684f, 0.01234f, -0.055563f, -0.08099f, 0.099505f, -0.054492f, -0.053822f, 0.010987f, 0.05288f, -0.054694f, -0.07187f, 0.012255f, -0.004159f, -0.083286f, 0.024435f, -0.039332f, 0.047044f, -0.042444f, 0.005433f, -0.00758f, 0.069882f, 0.015598f, 0.011391f, -0.028048f, -0.076743f, -0.016584f, 0.053108f, 0.01582f, 0.025225f, 0.072053f, -0.080975f, 0.023309f, 0.031251f, 0.07941f, 0.081539f, 0.057444f, -0.036874f, -0.019313f, 0.032716f, 0.091329f, 0.083693f, 0.064777f, 0.005042f, 0.113107f, 0.06192f, -0.001313f, -0.007645f, -0.046045f, -0.017529f, 0.073459f, -0.069165f, 0.015223f, 0.031161f, 0.063707f, 0.021247f, -0.06324f, -0.042056f, -0.065592f, 0.010001f, -0.07563f, -0.021216f, -0.062695f, 0.007239f, 0.066673f, 0.081581f, 0.078774f, 0.076892f, -0.099095f, 0.061089f, -0.009798f, 0.075502f, -0.012441f, -0.077468f, 0.017725f, -0.01225f, 0.000547f, -0.058477f, -0.099377f, -0.094048f, -0.069853f, -0.103031f, 0.032678f, 0.093738f, -0.06913f, 0.059731f, 0.02069f, -0.095179f, 0.065773f, 0.008996f, 0.098188f, -0.091247f, -0.038402f, -0.05542f, -0.106986f, -0.029728f, 0.012951f, -0.011059f, 0.040486f, -0.020097f, -0.103571f, 0.03737f, 0.061825f, 0.018084f, -0.050484f, -0.057597f, -0.037903f, 0.060226f, 0.081243f, -0.093987f, -0.072739f, 0.046512f, 0.045785f, 0.089727f, -0.000939f, 0.024963f, 0.079538f, -0.043441f, 0.054129f, -0.05082f, -0.072083f, -0.023186f, -0.077607f, 0.064973f, -0.060273f, 0.06924f, -0.086052f, -0.035319f, -0.026772f, 0.100169f, -0.005247f, 0.027439f, -0.092736f, -0.006083f, -0.004992f, -0.038952f, -0.014404f, 0.08064f, 0.064507f, 0.049661f, -0.015811f, 0.039072f, 0.048317f, 0.073444f, 0.083461f, -0.042403f, -0.008961f, 0.020186f, -0.074943f, 0.071421f, 0.041355f, 0.052225f, -0.012041f, 0.058132f, 0.08175f, -0.071391f, 0.073826f, 0.073407f, 0.074462f, -0.017162f, 0.029653f, -0.001535f, 0.039043f, 0.11103f, -0.101654f, 0.069386f, -0.006625f, -0.023678f, 0.016387f, -0.070787f, 0.064988f, -0.079127f, -0.059699f, 0.046692f, 0.031201f, 0.054901f, -0.015266f, 0.03231f, -0.03039f, 0.066891f, -0.085194f, 0.071297f, 0.080157f, -0.083954f, -0.011749f, -0.031866f, 0.068952f, -0.067563f, -0.057058f, -0.071577f, -0.061275f, -0.076555f, 0.070624f, 0.048717f, 0.090126f, -0.045185f, -0.066241f, 0.031127f, 0.045478f, 0.071076f, 0.024022f, -0.035943f, -0.020136f, -0.004701f, -0.088494f, -0.041774f, 0.015089f, 0.010477f, -0.072521f, -0.068283f, 0.071872f, -0.06603f, -0.006378f, 0.075059f, 0.048467f, 0.031796f, 0.031216f, 0.078731f, 0.071546f, -0.001918f, -0.047804f, -0.049606f, 0.097205f, 0.110753f, 0.107576f, -0.050945f, -0.09914f, 0.031406f, 0.077863f, 0.039873f, -0.009166f, -0.040755f, -0.092685f, 0.017845f, 0.048693f, -0.071101f, 0.069701f, -0.023604f, 0.070903f, 0.036902f, -0.089673f, 0.025453f, -0.049918f, 0.00077f, 0.029933f, -0.040647f, 0.01173f, -0.087773f, 0.052237f, 0.042816f, 0.017771f, -0.053421f, 0.046273f, -0.036214f, 0.021915f, -0.029345f, 0.051657f, -0.078945f, -0.071685f, -0.028631f, 0.009546f, -0.110579f, 0.034993f, -0.042807f, -0.080992f, 0.035757f, -0.049161f, -0.101247f, -0.072573f, 0.026649f, -0.005228f, -0.001187f, 0.022934f, 0.029833f, -0.025066f, -0.008984f, -0.024116f, 0.059241f, 0.070614f, 0.03811f, -0.055266f, -0.073423f, -0.083801f, 0.039172f, 0.088559f, 0.049935f, -0.042374f, -0.081957f, 0.008877f, 0.012172f, -0.021124f, 0.075518f, -0.076154f, 0.08606f, 0.017969f, 0.09343f, -0.037382f, 0.043213f, -0.043518f, -0.00527f, -0.024154f, -0.090233f, -0.077467f, -0.016444f, -0.082465f, 0.100835f, 0.010345f, -0.011051f, 0.091217f, 0.044251f, -0.03023f, 0.022734f, 0.022346f, -0.028606f, -0.080011f, 0.089253f, -0.000254f, -0.084032f, -0.047506f, -0.045831f, -0.043937f, -0.044536f, -0.082467f, -0.09483f, 0.015516f, -0.00127f, 0.053662f, 0.029251f, -0.074737f, 0.012934f, 0.041825f, -0.077346f, 0.026939f, 0.018464f, -0.089621f, -0.038712f, -0.058479f, 0.009874f, 0.046036f, 0.070825f, -0.082517f, 0.021096f, 0.028248f, -0.051142f, -0.055784f, 0.005221f, -0.068045f, -0.028956f, 0.042232f, -0.07849f, 0.103979f, 0.0502f, 0.03281f, -0.003853f, 0.016717f, 0.073534f, -0.088794f, 0.015334f, -0.07488f, 0.044974f, 0.015105f, 0.016896f, 0.079433f, -0.001698f, -0.017593f, -0.037927f, 0.07288f, 0.024606f, 0.101579f, 0.080599f, 0.027172f, -0.014639f, 0.06545f, -0.022659f, 0.052213f, 0.007723f, -0.069713f, 0.090409f, -0.067966f, -0.002303f, 0.01135f, 0.101988f, -0.079345f, -0.057085f, -0.01998f, 0.05829f, -0.090999f, 0.052694f, 0.0029f, 0.090988f, -0.04988f, 0.055415f, 0.058766f, 0.067746f, 0.074999f, 0.013014f, -0.035016f, 0.014223f, -0.074769f, 0.048125f, -0.037913f, -0.028523f, -0.069444f, 0.068896f, -0.088687f, -0.111512f, 0.088543f, -0.026674f, 0.00773f, 0.076466f, -0.011567f, 0.035179f, 0.07448f, 0.090379f, 0.062818f, -0.062386f, -0.022022f, -0.060235f, -0.102856f, 0.082568f, -0.079136f, -0.074497f, 0.064925f, -0.002689f, 0.069759f, 0.065361f, -0.072545f, -0.054611f, 0.073598f, -0.063794f, -0.020618f, 0.083109f, -0.028379f, 0.000807f, -0.001845f, 0.06026f, 0.022901f, 0.061695f, 0.073479f, -0.040851f, -0.036365f, -0.095387f, -0.033226f, 0.108645f, -0.017793f, -0.047057f, 0.001016f, 0.061805f, 0.010188f, -0.000691f, -0.098306f, -0.061809f, 0.002957f, -0.063876f, -0.104979f, -0.061609f, -0.026392f, 0.026762f, 0.108733f, 0.056174f, 0.070673f, -0.077336f, -0.084834f, 0.031497f, 0.010371f, 0.039305f, -0.051375f, 0.009681f, -0.05881f, -0.058872f, 0.056722f, -0.068886f, -0.077689f, -0.068616f, 0.084761f, 0.075271f, 0.059601f, 0.007718f, -0.099134f, -0.041811f, -0.056119f, -0.079346f, 0.074311f, 0.072419f, -0.041363f, -0.047344f, 0.065589f, 0.021052f, 0.081061f, 0.029353f, -0.071276f, -0.052683f, -0.019771f, -0.024593f, -0.06573f, -0.053575f, -0.071777f, -0.042699f, -0.02049f, 0.059711f, 0.025362f, -0.019695f, 0.047481f, -0.045051f, -0.019561f, 0.003164f, 0.014999f, 0.0735f, -0.06459f, 0.062445f, 0.063895f, -0.032734f, 0.063121f, 0.030136f, 0.024536f, 0.008602f, 0.004959f, 0.018956f, 0.001056f, -0.00231f, -0.067571f, 0.007235f, -0.047765f, -0.011201f, -0.06678f, -0.003241f, 0.08778f, -0.047422f, 0.079285f, -0.097396f, -0.030011f, 0.074846f, -0.055259f, -0.080103f, 0.033284f, 0.089304f, 0.019989f, -0.093418f, 0.059058f, -0.083436f, 0.018687f, 0.073158f, -0.002636f, -0.050274f, 0.087015f, -0.079378f, -0.029238f, 0.009376f, -0.107289f, 0.017833f, 0.031038f, -0.016033f, -0.092285f, -0.089472f, -0.02801f, -0.006398f, 0.098127f, -0.039534f, 0.037125f, 0.032195f, -0.082382f, -0.01437f, 0.042386f, -0.025227f, 0.037265f, 0.072206f, -0.034677f, 0.029978f, -0.084583f, 0.03571f, 0.016894f, -0.025126f, 0.065388f, 0.099017f, -0.046571f, -0.010373f, -0.093333f, -0.00496f, 0.077861f, -0.059034f, -0.098407f, -0.00342f, -0.039769f, -0.054426f, 0.083524f, 0.085952f, -0.044923f, 0.096499f, 0.054402f, 0.082364f, 0.006745f, 0.017844f, 0.079701f, 0.061237f, 0.074484f, -0.033308f, -0.02443f, 0.041421f, 0.02322f, -0.096238f, 0.062227f, -0.006844f, -0.025332f, 0.060518f, -0.064981f, 0.000827f, 0.025914f, -0.025234f, 0.068085f, 0.073787f, 0.014376f, 0.043466f, 0.088949f, 5.9e-05f, -0.08892f, 0.071288f, 0.087177f, -0.064634f, -0.05033f, -0.007922f, -0.022124f, 0.063068f, -0.015573f, -0.064173f, -0.108509f, -0.063151f, -0.012116f, 0.060949f, -0.009144f, -0.070795f, 0.077747f, 0.021402f, -0.024577f, 0.023716f, 0.062945f, -0.044948f, 0.025542f, 0.03492f, 0.106923f, -0.070109f, -0.001942f, -0.060007f, 0.007976f, -0.011106f, 0.026549f, -0.013955f, -0.071256f, 0.003847f, -0.06225f, -0.058918f, -0.016214f, 0.051179f, 0.01021f, -0.079458f, 0.080474f, -0.081945f, 0.080455f, 0.001973f, 0.01161f, 0.045197f, -0.033882f, -0.041192f, -0.074824f, 0.079696f, 0.081111f, 0.006089f, 0.012093f, -0.023994f, -0.067477f, -0.079048f, 0.074709f, -0.089508f, 0.015831f, 0.020722f, 0.068908f, 0.05563f, -0.0371f, -0.077804f, -0.104334f, 0.050654f, 0.085095f, 0.045403f, -0.020992f, -0.036523f, -0.043631f, -0.004917f, -0.018983f, 0.045659f, 0.076109f, -0.064086f, -0.046969f, -0.063788f, -0.054675f, -0.059155f, -0.079654f, -0.073689f, -0.059708f, -0.002462f, -0.025184f, 0.090103f, -0.100201f, -0.033173f, -0.002316f, 0.044933f, 0.07475f, 0.086251f, 0.082877f, 0.025099f, -0.027006f, -0.054442f, 0.084319f, 0.013591f, -0.053696f, 0.042472f, 0.062279f, 0.002268f, 0.105784f, -0.006846f, 0.070624f, -0.005194f, -0.02698f, -0.069427f, -0.041899f, 0.012049f, 0.042858f, -0.092623f, 0.027843f, 0.057034f, 0.021106f, 0.024823f, 0.06891f, 0.08686f, -0.072141f, 0.028785f, -0.059106f, -0.050806f, -0.074192f, -0.101496f, -0.097269f, -0.004011f, -0.099154f, 0.07541f, 0.090585f, -0.03846f, -0.035666f, -0.034635f, -0.017791f, 0.098522f, -0.02982f, -0.086077f, -0.099959f, -0.079682f, 0.07337f, -0.041207f, 0.006341f, 0.010968f, -0.021403f, -0.080859f, 0.045627f, 0.01405f, -0.053466f, 0.057296f, 0.071914f, -0.053702f, -0.092997f, 0.074864f, -0.012698f, -0.062562f, -0.072513f, -0.09828f, -0.032327f, -0.048874f, -0.075558f, 0.006699f, 0.03279f, -0.098382f, 0.026214f, 0.089939f, -0.046412f, -0.032187f, -0.088635f, -0.035361f, 0.035502f, -0.06144f, 0.047908f, 0.021478f, -0.036403f, -0.066035f, -0.029481f, -0.017646f, -0.071038f, -0.043254f, -0.109057f, -0.109073f, 0.033033f, 0.025392f, 0.057617f, -0.032868f, 0.032372f, 0.057464f, -0.064739f, 0.031978f, -0.000858f, -0.051898f, -0.012279f, -0.092305f, -0.065085f, 0.085026f, 0.081034f, 0.045467f, -0.086532f, 0.041575f, -0.029471f, -0.018787f, 0.01551f, -0.022097f, -0.100619f, 0.096672f, -0.075582f, -0.066007f, -0.006742f, 0.08691f, -0.012863f, -0.069493f, 0.048088f, 0.0051f, 0.04358f, -0.041777f, -0.0192f, -0.013239f, 0.018983f, -0.061304f, 0.051731f, -0.078098f, 0.044651f, -0.010138f, 0.070146f, -0.031016f, -0.110674f, 0.043676f, -0.080979f, -0.074993f, 0.115093f, 0.017487f, 0.044326f, -0.017346f, 0.00026f, -0.0327f, -0.0054f, -0.061369f, -0.015111f, -0.080632f, 0.028158f, 0.025902f, 0.075521f, -0.094107f, 0.000724f, -0.029306f, -0.053421f, -0.03929f, -0.028527f, -0.033603f, -0.038087f, -0.071547f, 0.102928f, 0.004713f, -0.105702f, 0.088331f, -0.073241f, -0.055586f, -0.01738f, -0.098726f, 0.063633f, -0.092659f, -0.063555f, -0.035173f, -0.013974f, 0.029866f, -0.075716f, 0.086853f, -0.055414f, 0.05081f, 0.093909f, 0.059516f, 0.045576f, -0.033474f, 0.024439f, -0.079065f, 0.044033f, 0.024745f, 0.039317f, 0.078374f, -0.012998f, 0.076632f, -0.000757f, -0.055209f, -0.10109f, 0.054568f, -0.058394f, 0.047567f, 0.025811f, -0.010143f, 0.011585f, -0.085336f, -0.068805f, 0.032532f, 0.062066f, -0.033879f, -0.071583f, -0.085948f, -0.054988f, -0.094183f, -0.044077f, -0.04049f, 0.011067f, 0.062528f, -0.025127f, -0.048223f, -0.019074f, 0.024461f, -0.100485f, -0.051912f, 0.020569f, 0.08095f, -0.071247f, 0.090731f, -0.035209f, 0.00044f, -0.062648f, 0.043822f, 0.046161f, 0.099415f, 0.006009f, 0.096246f, 0.075514f, -0.016275f, 0.079311f, -0.054189f, -0.017567f, 0.071668f, 0.039923f, -0.047757f, 0.069807f, -0.086374f, 0.07544f, -0.050766f, 0.104159f, -0.077842f, -0.06721f, -0.057718f, -0.061633f, -0.026348f, 0.026381f, -0.065844f, 0.054132f, -0.009933f, 0.019985f, -0.006274f, -0.007493f, -0.080795f, 0.048743f, 0.031913f, -0.050748f, -0.053907f, -0.063843f, -0.050588f, 0.028715f, -0.071683f, -0.010411f, -0.054859f, 0.003608f, -0.066875f, 0.050861f, -0.040091f, -0.077927f, 0.013086f, 0.070374f, -0.008539f, 0.008465f, 0.044892f, -0.10195f, 0.0462f, -0.08781f, -0.074993f, -0.090992f, 0.07643f, 0.003372f, -0.086576f, 0.09247f, 0.093706f, 0.10402f, -0.006058f, -0.022102f, 0.020616f, -0.045963f, 0.024421f, -0.070766f, -0.044712f, 0.064805f, -0.089822f, -0.000674f, -0.075224f, 0.07412f, -0.008124f, 0.107479f, -0.003511f, -0.049342f, -0.084365f, -0.105958f, 0.008576f, 0.032159f, -0.080139f, -0.015531f, -0.02087f, -0.038292f, 0.004146f, -0.003147f, -0.015851f, -0.061363f, 0.077092f, 0.105704f, 0.039762f, -0.065332f, 0.080007f, 0.040562f, -0.070411f, 0.086437f, 0.012399f, -0.098691f, -0.071125f, -0.014468f, 0.101316f, -0.085921f, -0.009467f, -0.060873f, -0.034383f, -0.057694f, 0.078215f, -0.044921f, 0.040786f, -0.070279f, 0.081984f, -0.004063f, -0.041287f, 0.043296f, -2.2e-05f, -0.034114f, 0.024049f, 0.019136f, 0.10275f, 0.054408f, 0.041038f, -0.042833f, 0.055652f, -0.089569f, -0.069663f, -0.04885f, 0.006764f, -0.06819f, -0.0818f, 0.000993f, -0.031827f, 0.00992f, -0.00639f, 0.069159f, -0.104997f, 0.001625f, -0.006013f, 0.051382f, 1e-05f, 0.083224f, -0.038773f, 0.045534f, 0.073669f, 0.002533f, -0.029629f, -0.038781f, -0.007366f, -0.070346f, -0.018839f, -0.071134f, 0.000766f, -0.034147f, 0.020361f, 0.059199f, -0.067981f, -0.03336f, -0.083382f, -0.012473f, -0.008212f, 0.010311f, 0.088702f, -0.089106f, -0.03045f, 0.046241f, -0.070662f, 0.02785f, -0.067923f, -0.021f, 0.050485f, -0.066f, 0.064101f, -0.034915f, 0.070353f, 0.048352f, -0.06694f, 0.065697f, -0.033336f, -0.018741f, 0.026952f, 0.085071f, -0.033186f, 0.068181f, -0.08288f, 0.085032f, 0.071848f, -0.021465f, -0.036056f, 0.059972f, -0.029816f, 0.061509f, 0.018861f, 0.009941f, -0.025306f, 0.011925f, 0.016731f, -0.077825f, 0.080504f, -0.003288f, 0.060013f, -0.101096f, 0.064157f, 0.106042f, -0.046574f, 0.013107f, -0.087502f, -0.019673f, -0.023982f, 0.090306f, -0.020429f, 0.058934f, 0.061452f, 0.08684f, -0.000781f, 0.100452f, 0.096812f, 0.077004f, 0.080042f, -0.093774f, -0.00029f, -0.038338f, -0.074947f, -0.047596f, -0.058599f, 0.029353f, -0.038869f, -0.050803f, -0.046536f, -0.033167f, 0.008778f, 0.026966f, -0.003008f, 0.027424f, -0.047174f, -0.001233f, 0.024467f, 0.025365f, 0.018212f, -0.081601f, -0.096792f, -0.047937f, -0.015518f, -0.068981f, -0.065426f, -0.097514f, -0.059838f, -0.100929f, -0.014582f, 0.040052f, 0.069573f, 0.039634f, -0.041463f, -0.009703f, 0.013803f, -0.027411f, 0.005114f, -0.011498f, 0.068416f, 0.08612f, -0.024836f, 0.058582f, 0.010183f, -0.04854f, 0.061168f, 0.08852f, 0.066715f, 0.007044f, -0.00083f, -0.074781f, 0.074945f, -0.101165f, 0.076859f, -0.042888f, -0.050107f, 0.057764f, -0.080827f, 0.043578f, -0.101423f, 0.056348f, -0.015536f, 0.065947f, 0.029535f, -0.042437f, -0.064105f, 0.007214f, 0.083175f, -0.018653f, 0.071495f, 0.010433f, 0.076794f, 0.044091f, -0.1114f, -0.096749f, -0.049664f, -0.000702f, 0.06273f, 0.089968f, -0.012925f, 0.035379f, -0.038865f, -0.089615f, -0.095855f, -0.071808f, -0.044021f, -0.043032f, 0.080872f, 0.06837f, -0.08221f, 0.058316f, 0.007424f, 0.005659f, 0.018166f, -0.067824f, -0.056288f, -0.036951f, -0.015695f, -0.102417f, -0.084379f, -0.065843f, -0.09856f, 0.077748f, -0.039012f, 0.074727f, -0.07289f, 0.047392f, 0.014383f, -0.021422f, -0.010015f, 0.084568f, -0.06801f, 0.007638f, 0.081875f, 0.02133f, 0.105207f, -0.063688f, -0.051078f, -0.046525f, 0.038975f, -0.049928f, 0.02788f, -0.081703f, -0.03699f, 0.001639f, 0.008844f, 0.008269f, 0.005974f, -0.028236f, 0.06901f, 0.04841f, -0.024653f, 0.052853f, 0.053459f, 0.021557f, 0.007411f, 0.00041f, 0.013099f, 0.018517f, -0.057433f, -0.045286f, 0.096918f, 0.080208f, -0.065005f, 0.074504f, 0.049874f, 0.024149f, 0.076311f, 0.088998f, -0.031208f, 0.067072f, -0.020136f, -0.032511f, -0.007307f, 0.079514f, -0.032499f, 0.027066f, -0.033107f, 0.041544f, 0.07809f, -0.020848f, -0.046067f, 0.084919f, -0.0154f, 0.052021f, 0.006642f, 0.051731f, -0.070379f, -0.089907f, 0.00392f, -0.045674f, 0.000677f, -0.035337f, 0.029125f, 0.049202f, 0.046602f, -0.031506f, -0.053621f, -0.096124f, 0.070858f, 0.007419f, -0.034113f, 0.044999f, 0.100849f, -0.071791f, 0.034878f, -0.002343f, -0.023714f, -0.002439f, -0.056317f, -0.046914f, -0.030341f, 0.064816f, -0.073566f, -0.053977f, -0.065409f, 0.00601f, -0.068666f, -0.093836f, -0.070155f, -0.038908f, 0.076531f, 0.083439f, 0.021301f, -0.015662f, 0.041104f, -0.070257f, 0.074679f, -0.022539f, 0.084118f, -0.049233f, 0.040305f, 0.060694f, -0.061665f, -0.107754f, -0.011188f, -0.00882f, -0.071243f, 0.059134f, 0.052317f, 0.00049f, 0.080949f, 0.014127f, -0.005934f, -0.057084f, 0.095169f, 0.001764f, -0.017685f, 0.065311f, 0.047f, -0.08954f, -0.069251f, -0.071611f, -0.091941f, -0.000394f, -0.060002f, 0.025808f, 0.055393f, 0.009819f, 0.053322f, -0.00813f, 0.047477f, 0.057942f, -0.060987f, 0.085146f, 0.05727f, -0.073459f, -0.078923f, 0.081444f, 0.02679f, -0.021766f, -0.006376f, -0.049608f, -0.000916f, -0.106983f, 0.108652f, 0.109554f, -0.065883f, -0.014389f, -0.045606f, -0.040809f, -0.065285f, 0.033513f, -0.037115f, -0.062699f, -0.011234f, -0.042894f, -0.062072f, -0.02075f, 0.041879f, 0.034058f, -0.025028f, 0.099682f, 0.060412f, 0.078726f, 0.046387f, -0.062561f, -0.063883f, -0.101433f, -0.01048f, -0.017082f, 0.08017f, 0.094917f, -0.05945f, -0.026641f, 0.014558f, 0.027042f, -0.041463f, -0.046905f, 0.024201f, -0.040737f, 0.049527f, -0.025996f, -0.070126f, 0.001991f, -0.061002f, 0.069774f, -0.043749f, -0.024078f, 0.038245f, 0.018081f, -0.052876f, 0.073393f, -0.006646f, 0.05262f, -0.082869f, -0.053641f, -0.055969f, 0.03364f, -0.065158f, -0.023635f, -0.004268f, -0.077009f, -0.058248f, -0.027628f, 0.020562f, 0.034969f, 0.055616f, 0.077606f, -0.023717f, -0.0294f, 0.001151f, 0.046521f, 0.00819f, -0.077106f, -0.071608f, -0.068145f, -0.101732f, 0.053821f, -0.060249f, -0.070617f, 0.024627f, -0.031664f, 0.057915f, 0.018028f, 0.004151f, 0.101897f, -0.095943f, -0.094677f, -0.037398f, 0.09379f, -0.098627f, -0.103034f, 0.078993f, 0.059073f, 0.048458f, 0.037275f, 0.086259f, 0.024292f, -0.047124f, 0.093041f, -0.05769f, 0.068665f, -0.089837f, -0.014763f, 0.098003f, -0.061465f, 0.014044f, 0.067891f, -0.031785f, -0.074639f, 0.068762f, -0.047602f, 0.072511f, 0.027406f, 0.05844f, 0.087053f, 0.041889f, 0.094057f, 0.021701f, -0.094938f, -0.075797f, -0.053555f, 0.025583f, 0.006285f, 0.042827f, -0.025884f, -0.103392f, -0.010619f, -0.038856f, -0.019288f, 0.085933f, 0.097666f, -0.030797f, -0.054035f, -0.048606f, 0.074491f, -0.068427f, -0.029412f, 0.026575f, 0.047445f, 0.092918f, -0.083298f, -0.002089f, 0.028225f, 0.058692f, -0.028711f, 0.089697f, 0.077302f, 0.111105f, -0.083313f, -0.070228f, -0.038459f, -0.002625f, 0.088779f, 0.041206f, 0.014158f, 0.045668f, -0.040292f, 0.011789f, -0.090017f, -0.03462f, 0.082269f, -0.003239f, 0.054385f, 0.034377f, 0.05935f, 0.003186f, 0.108183f, 0.0971f, 0.081393f, -0.09523f, -0.104872f, -0.014649f, 0.018362f, -0.035082f, 0.024189f, -0.057525f, -0.025295f, 0.030878f, -0.021884f, 0.086f, 0.020656f, 0.048662f, 0.00609f, 0.025626f, 0.017794f, -0.074655f, 0.06543f, -0.065218f, -0.022055f, -0.066533f, -0.013762f, -0.024539f, -0.047178f, 0.0828f, 0.069602f, -0.058976f, 0.058085f, -0.044581f, 0.04393f, 0.061821f, 0.052872f, -0.082724f, 0.073245f, 0.016206f, 0.067729f, 0.069517f, 0.03404f, 0.014581f, -0.066978f, 0.056613f, 0.01947f, 0.063536f, 0.09842f, -0.067719f, 0.027589f, 0.014311f, 0.005396f, -0.057521f, -0.055583f, 0.030037f, 0.068258f, 0.072007f, 0.054081f, -0.098764f, -0.068963f, -0.081548f, -0.062687f, -0.019818f, -0.054874f, 0.043403f, -0.092395f, 0.079253f, -0.055366f, -0.021141f, 0.090372f, -0.07544f, 0.064863f, 0.08939f, 0.00241f, 0.056174f, -0.055529f, -0.018552f, 0.074171f, 0.011281f, 0.11269f, 0.000352f, -0.049577f, 0.015424f, -0.023127f, -0.024155f, 0.017578f, 0.097276f, -0.06512f, -0.019525f, -0.05561f, -0.058907f, -0.009311f, 0.097053f, 0.012595f, -0.0172f, 0.075824f, 0.080364f, -0.008939f, 0.03872f, 0.015758f, -0.02749f, 0.086176f, 4.9e-05f, 0.035638f, -0.004891f, -0.072201f, -0.04743f, -0.052979f, -0.068225f, -0.083232f, 0.095487f, 0.039224f, -0.029183f, 0.05437f, -0.039322f, -0.035948f, 0.068529f, -0.022603f, -0.076854f, -0.111871f, 0.030784f, 0.032196f, 0.0585f, -0.101306f, -0.056195f, 0.042978f, 0.049256f, 0.01181f, -0.074128f, -0.004912f, 0.016905f, 0.108813f, -0.025478f, 0.021084f, 0.085125f, -0.027748f, -0.053548f, 0.073823f, 0.086703f, 0.035143f, 0.007599f, 0.067678f, 0.091777f, -0.026547f, 0.048272f, -0.062889f, -0.044082f, -0.014924f, -0.039617f, 0.067701f, 0.024077f, 0.103741f, -0.042829f, 0.059673f, 0.084667f, 0.034922f, 0.029994f, -0.005447f, 0.004265f, 0.003272f, -0.042079f, -0.085955f, -0.098815f, 0.072499f, 0.006978f, -0.0964f, -0.077651f, 0.043818f, -0.01719f, 0.057459f, 0.051065f, 0.044687f, -0.084552f, -0.055775f, -0.021667f, -0.087448f, -0.013568f, 0.077659f, -0.06639f, -0.066183f, -0.020846f, -0.033139f, 0.03963f, -0.07049f, -0.035715f, 0.061278f, 0.032303f, -0.017781f, -0.000433f, 0.010998f, 0.023032f, -0.082781f, 0.096998f, -0.073933f, -0.019646f, 0.10374f, -0.000981f, -0.017319f, 0.048468f, -0.072078f, 0.067072f, 0.003737f, 0.082616f, 0.086273f, 0.071451f, 0.100072f, -0.033576f, 0.034531f, 0.073682f, -0.063992f, -0.092704f, -0.019528f, 0.080252f, -0.067126f, -0.088539f, -0.027882f, 0.058492f, 0.044258f, -0.044083f, 0.028975f, -0.064501f, -0.064354f, 0.011158f, 0.008026f, -0.007001f, -0.076883f, -0.026127f, 0.058967f, -0.034265f, -0.08343f, -0.02563f, 0.013939f, 0.051202f, -0.032729f, -0.058578f, 0.003828f, -0.026793f, 0.078788f, -0.015705f, -0.047391f, -0.080081f, -0.076219f, 0.03165f, 0.099164f, 0.037583f, 0.01869f, -0.050006f, -0.056864f, -0.104275f, 0.021291f, -0.041802f, 0.012811f, 0.011862f, -0.001109f, -0.044731f, 0.001236f, 0.051283f, 0.034509f, 0.079134f, -0.066716f, -0.037031f, 0.068351f, 0.00987f, -0.095158f, -0.027344f, -0.053292f, -0.022092f, 0.024956f, -0.086342f, -0.007928f, -0.073226f, -0.043506f, -0.042166f, 0.002748f, 0.010237f, 0.003413f, 0.003282f, -0.041611f, -0.071611f, 0.002481f, 0.005672f, 0.003625f, 0.061461f, 0.042198f, 0.020761f, -0.077859f, 0.078478f, 0.008768f, -0.099279f, -0.074145f, -0.007159f, 0.054218f, -0.082867f, 0.000365f, -0.039591f, 0.03509f, 0.085908f, 0.030333f, 0.014716f, -0.021926f, 0.08715f, 0.011162f, -0.074062f, -0.059078f, 0.046369f, -0.086969f, 0.043081f, -0.078635f, 0.009923f, -0.082296f, 0.09569f, 0.036758f, 0.004655f, 0.058133f, -0.043135f, 0.054481f, -0.085961f, 0.063407f, 0.07769f, -0.041191f, 0.097698f, -0.056681f, 0.043919f, 0.053588f, 0.082732f, -0.080143f, 0.050727f, -0.046017f, -0.034124f, 0.102187f, -0.092687f, 0.076756f, -0.044043f, -0.004537f, -0.008548f, 0.080571f, -0.01217f, -0.084397f, -0.073369f, 0.063313f, -0.013948f, -0.009446f, 0.106266f, -0.049625f, -0.096894f, -0.00907f, 0.079353f, -0.067424f, 0.012182f, -0.067567f, 0.009464f, -0.07565f, -0.067222f, -0.004248f, -0.007827f, 0.048953f, 0.00297f, 0.016055f, -0.039177f, -0.05275f, -0.023251f, -0.074105f, -0.030837f, 0.058632f, 0.06484f, 0.037608f, 0.045454f, 0.062785f, 0.069797f, -0.026934f, 0.04506f, 0.06804f, 0.035808f, 0.067862f, 0.09845f, -0.010745f, 0.003037f, -0.008806f, -0.002607f, -0.091042f, -0.039696f, -0.004431f, 0.029836f, -0.06236f, 0.097808f, -0.015095f, -0.033724f, -0.004899f, -0.015764f, -0.039818f, 0.064756f, 0.098286f, -0.052126f, -0.097618f, 0.009557f, 0.017932f, 0.057101f, 0.081211f, -0.10316f, -0.04426f, -0.044374f, -0.042089f, -0.008462f, -0.079667f, 0.0806f, 0.008522f, 0.081625f, 0.039505f, -0.009294f, -0.04356f, 0.057713f, 0.065071f, -0.061479f, 0.00036f, 0.002349f, 0.081865f, -0.066012f, -0.054298f, -0.015692f, 0.001107f, -0.028259f, 0.061586f, 0.062213f, 0.038913f, 0.070438f, -0.098511f, 0.100527f, -0.066423f, 0.045255f, 0.004753f, -0.01303f, -0.009815f, -0.017893f, 0.010877f, 0.005638f, 0.045965f, 0.036218f, -0.108948f, 0.017084f, 0.016154f, 0.039078f, 0.091199f, -0.03315f, -0.027089f, -0.068965f, 0.002643f, 0.091551f, -0.04453f, -0.049084f, -0.076231f, 0.023748f, 0.01785f, -0.023666f, -0.048766f, 0.109019f, -0.081524f, -0.033304f, -0.051592f, -0.020127f, -0.064728f, -0.079866f, -0.06147f, 0.009271f, 0.068884f, -0.057439f, 0.047447f, -0.074742f, -0.040806f, 0.001848f, -0.042141f, -0.029348f, -0.042106f, 0.069837f, -0.055282f, 0.004754f, 0.03998f, -0.000477f, 0.095974f, -0.089188f, -0.029978f, 0.078361f, -0.019132f, 0.071858f, -0.094262f, 0.043253f, -0.028991f, -0.084579f, 0.031787f, 0.071291f, -0.054221f, -0.100707f, 0.07167f, -0.014891f, -0.07069f, 0.108447f, 0.090345f, -0.061779f, -0.067164f, -0.079024f, -0.014633f, 0.048424f, -0.046957f, -0.051054f, 0.037977f, -0.038609f, -0.085605f, -0.007353f, 0.065497f, 0.080808f, 0.02447f, -0.006982f, 0.025706f, -0.017066f, -0.030509f, 0.05031f, -0.043148f, -0.086686f, 0.052883f, -0.069959f, -0.096802f, 0.001987f, 0.11493f, -0.074737f, -0.023182f, -0.092002f, -0.017254f, -0.021869f, 0.042528f, 0.073688f, -0.065826f, 0.044415f, 0.092528f, 0.075692f, 0.082971f, -0.004812f, 0.105809f, -0.06632f, -0.051997f, 0.09384f, -0.021409f, -0.006846f, 0.054073f, 0.105756f, -0.077466f, 0.067401f, -0.041037f, -0.040778f, -0.004297f, -0.090054f, 0.076826f, -0.009215f, -0.019103f, 0.009007f, -0.067134f, -0.049791f, -0.041188f, 0.023983f, 0.086904f, -0.008147f, 0.057253f, -0.094938f, 0.048613f, 0.005273f, 0.026159f, -0.021897f, -0.041308f, 0.083702f, 0.004631f, -0.092273f, -0.087364f, -0.064433f, -0.071132f, -0.071778f, 0.095784f, -0.060952f, 0.050198f, 0.0812f, -0.000559f, 0.064323f, 0.073569f, -0.020995f, 0.042492f, -0.079683f, -0.055814f, 0.028305f, -0.046962f, -0.046111f, -0.030888f, -0.042604f, -0.040656f, -0.020674f, 0.011264f, 0.01724f, 0.011148f, -0.071835f, 0.046123f, 0.104761f, -0.03739f, 0.062511f, 0.042413f, -0.014584f, 0.05926f, 0.058072f, -0.01208f, 0.045656f, 0.021997f, -0.056473f, 0.024369f, -0.033482f, 0.041264f, 0.069596f, 0.048503f, -0.025505f, -0.086433f, -0.027479f, -0.059096f, 0.029917f, -0.114367f, 0.027298f, -0.083132f, -0.052963f, -0.007458f, -0.023716f, -0.07754f, -0.077295f, 0.036583f, -0.05454f, 0.010771f, -0.007323f, -0.022323f, 0.055036f, -0.004507f, -0.013738f, -0.053344f, -0.059268f, 0.075372f, -0.042627f, -0.043283f, -0.050558f, -0.002515f, 0.060142f, 0.034748f, -0.063017f, -0.061216f, 0.030179f, 0.011024f, -0.072605f, 0.037347f, 0.01558f, -0.051186f, -0.065024f, 0.068298f, 0.042996f, -0.006198f, -0.033256f, -0.050303f, -0.095911f, 0.037655f, -0.040722f, -0.012925f, -0.060736f, 0.071736f, 0.058868f, 0.057116f, -0.082362f, -0.075442f, -0.027975f, -0.085287f, -0.046415f, -0.021398f, -0.070831f, 0.012406f, -0.03282f, -0.065342f, 0.011333f, -0.054739f, 0.015257f, 0.010808f, -0.081932f, -0.012948f, -0.059064f, -0.019981f, -0.00663f, 0.007924f, 0.048663f, 0.016008f, 0.008376f, 0.054989f, -0.109088f, 0.080075f, -0.057183f, 0.04088f, -0.044813f, 0.019951f, -0.009453f, -0.06505f, 0.064883f, -0.052743f, -0.077865f, -0.091858f, -0.050157f, -0.061353f, -0.033829f, 0.109983f, 0.002395f, 0.038077f, 0.087248f, -0.078719f, -0.022022f, 0.050409f, 0.091719f, 0.051568f, -0.010976f, -0.037239f, 0.056452f, -0.045823f, -0.075708f, -0.087082f, 0.010283f, 0.099986f, -0.055145f, 0.045542f, -0.070211f, -0.059475f, -0.019614f, -0.031368f, 0.018494f, -0.070727f, 0.048864f, 0.003651f, 0.023023f, -0.020036f, -0.088006f, -0.044618f, -0.046089f, -0.055189f, 0.097606f, -0.04137f, -0.031514f, -0.004975f, -0.088344f, -0.060249f, 0.001379f, -0.097314f, -0.071548f, -0.007665f, 0.013092f, -0.0654f, 0.064476f, 0.017657f, 0.083686f, -0.032601f, 0.064241f, -0.096437f, -0.079661f, -0.086277f, -0.017053f, -0.004885f, 0.08544f, 0.051246f, -0.02543f, 0.013958f, -0.018042f, -0.003753f, -0.096011f, 0.010559f, -0.02936f, -0.041646f, -0.028138f, -0.012843f, 0.040053f, 0.076715f, -0.073012f, -0.064058f, 0.035025f, 0.054149f, -0.005625f, 0.033591f, -0.015351f, 0.066391f, 0.033178f, -0.003945f, -0.031559f, -0.001151f, 0.047662f, -0.041892f, -0.074225f, -0.099737f, -0.04157f, 0.066806f, 0.083241f, -0.049135f, 0.044763f, -0.074888f, -0.047982f, 0.021351f, -0.029424f, 0.036372f, -0.042476f, 0.077333f, -0.006334f, 0.004136f, 0.099062f, -0.017527f, 0.078964f, -0.080084f, 0.001563f, 0.080832f, 0.076394f, 0.036192f, -0.053766f, 0.02864f, -0.02279f, -0.032641f, -0.112393f, 0.062234f, 0.019616f, -0.102701f, -0.009894f, 0.041945f, 0.027585f, 0.000874f, -0.070045f, -0.071883f, 0.062002f, -0.075886f, 0.062498f, -0.041367f, -0.025284f, 0.020444f, 0.025295f, -0.022196f, 0.020151f, 0.084196f, -0.019514f, 0.021192f, -0.02689f, 0.037145f, -0.026464f, 0.040913f, 0.064768f, 0.059618f, -0.011197f, -0.08136f, 0.027349f, 0.085857f, 0.074396f, -0.043549f, -0.035904f, 0.074869f, -0.023004f, -0.009861f, 0.083994f, -0.079535f, -0.02365f, -0.0966f, -0.021709f, -0.088699f, 0.015232f, 0.102793f, 0.104484f, 0.011519f, 0.028214f, -0.029392f, 0.033492f, -0.089062f, -0.048207f, -0.0768f, -0.011442f, 0.080415f, -0.094445f, 0.063744f, -0.055186f, 0.088472f, 0.042835f, 0.085713f, 0.035465f, -0.075131f, -0.00937f, -0.019843f, -0.012649f, -0.006836f, 0.058232f, -0.012121f, 0.071754f, 0.029808f, -0.037125f, -0.015758f, 0.073319f, 0.050707f, -0.015907f, -0.022155f, 0.031018f, -0.036123f, -0.057002f, 0.004011f, -0.056447f, -0.031162f, 0.008304f, 0.068314f, -0.053528f, -0.038552f, 0.0182f, 0.059902f, 0.032716f, 0.057281f, 0.048803f, -0.057801f, -0.072057f, -0.090462f, 0.061059f, 0.08808f, -0.046307f, -0.042125f, -0.046683f, -0.053604f, 0.085526f, 0.023168f, -0.04086f, 0.072128f, 0.064852f, -0.026425f, 0.058377f, 0.090706f, 0.049531f, -0.072015f, -0.036523f, 0.068655f, -0.060628f, 0.08954f, -0.012926f, 0.062301f, -0.073211f, 0.075122f, -0.099831f, -0.089644f, 0.056423f, 0.099018f, -0.039792f, 0.052938f, -0.060462f, -0.036975f, -0.020063f, 0.062899f, 0.055728f, -0.025234f, -0.067779f, 0.089886f, 0.07154f, -0.040496f, 0.031439f, -0.088498f, -0.015011f, -0.034831f, 0.043819f, -0.039528f, -0.103138f, -0.029635f, -0.064757f, 0.101598f, 0.062664f, 0.102545f, 0.007623f, 0.005912f, -0.057783f, -0.072051f, -0.04857f, -0.005991f, 0.049573f, 0.033031f, 0.057929f, 0.052194f, -0.072092f, 0.091786f, 0.014063f, 0.077232f, -0.04295f, -0.041582f, -0.086105f, -0.018245f, 0.078401f, 0.030401f, 0.081763f, 0.099332f, -0.005523f, -0.024688f, 0.029851f, -0.076748f, 0.065494f, 0.098045f, 0.03665f, -0.066179f, -0.058037f, -0.010511f, 0.081871f, -0.014236f, 0.03959f, 0.084297f, 0.039981f, -0.060557f, 0.016912f, -0.046466f, -0.03291f, 0.076011f, -0.093685f, 0.050083f, 0.013063f, 0.04405f, -0.003809f, 0.06818f, -0.033272f, -0.092311f, -0.009236f, 0.024282f, 0.037726f, -0.015705f, 0.054973f, 0.081873f, 0.063451f, -0.01674f, 0.031717f, 0.073267f, -0.072754f, -0.082058f, -0.004341f, -0.103868f, -0.002551f, -0.041224f, 0.025194f, 0.007929f, 0.050574f, -0.038647f, -0.033262f, -0.058907f, -0.020307f, -0.025928f, 0.035151f, -0.070603f, -0.023551f, -0.075976f, 0.009256f, 0.078005f, 0.063796f, 0.098691f, 0.030964f, -0.105755f, -0.061292f, -0.060158f, -0.07132f, -0.00957f, 0.010301f, -0.047392f, 0.011959f, -0.015172f, 0.080292f, 0.081415f, 0.050445f, 0.001567f, 0.082839f, 0.054902f, 0.076857f, -0.074783f, 0.041829f, -0.054949f, 0.08246f, 0.046624f, -0.054212f, -0.077752f, 0.025113f, -0.106605f, 0.074764f, -0.031619f, 0.035821f, -0.088251f, 0.09053f, 0.044504f, 0.051774f, 0.056025f, -0.013784f, -0.052939f, -0.003236f, -0.074091f, 0.074226f, -0.09192f, -0.107824f, 0.028036f, 0.021591f, 0.110441f, 0.071286f, 0.01834f, 0.078978f, -0.073875f, -0.004175f, -0.029475f, -0.071787f, -0.085935f, -0.078686f, 0.022194f, -0.084798f, -0.010208f, 0.011187f, 0.084267f, -0.078348f, 0.008916f, 0.052012f, 0.090435f, -0.072707f, -0.076171f, 0.103704f, 0.106482f, -0.049577f, -0.068921f, -0.064318f, -0.000163f, 0.049335f, 0.049218f, 0.018658f, 0.096192f, -0.07947f, 0.008364f, -0.053662f, 0.069684f, 0.053827f, 0.01103f, -0.090793f, -0.070264f, -0.007593f, 0.067765f, -0.051416f, 0.088931f, 0.110387f, -0.091053f, -0.065803f, -0.057655f, -0.040999f, 0.030276f, 0.014492f, -0.069695f, 0.00935f, -0.008886f, -0.097498f, 0.029402f, -0.067555f, -0.082992f, -0.027715f, 0.024724f, 0.05886f, 0.087183f, -0.016523f, 0.102364f, 0.028829f, 0.042942f, -0.023301f, -0.020191f, 0.03657f, 0.080428f, 0.06476f, 0.010365f, -0.013048f, -0.028617f, -0.081049f, 0.088662f, -0.005634f, -0.010238f, -0.000474f, -0.063623f, -0.068286f, -0.067596f, -0.021448f, -0.045393f, 0.083337f, -0.086291f, -0.068336f, -0.093257f, 0.068671f, -0.05829f, -0.035441f, -0.054519f, 0.083568f, -0.098432f, 0.007257f, -0.081526f, 0.046984f, 0.000544f, -0.046021f, -0.051484f, 0.009775f, -0.077015f, 0.087456f, 0.053218f, 0.053531f, 0.025376f, 0.062507f, 0.072751f, 0.049255f, 0.055926f, 0.098842f, -0.07629f, 0.048577f, -0.016273f, 0.078755f, 0.025836f, -0.059811f, -0.03396f, 0.023363f, 0.009408f, -0.084877f, 0.004179f, 0.017834f, -0.055449f, 0.080246f, -0.056672f, 0.056548f, -0.081663f, -0.008097f, -0.061332f, -0.05212f, -0.034679f, -0.086071f, 0.006722f, 0.026853f, 0.027085f, 0.090773f, -0.0943f, 0.013723f, -0.023234f, 0.063968f, 0.053797f, 0.018491f, 0.050105f, 0.088955f, -0.005266f, -0.109579f, 0.05602f, -0.022989f, 0.085069f, 0.057706f, -0.003731f, 0.015047f, 0.077594f, -0.050755f, -0.016635f, 0.010804f, 0.000152f, 0.080679f, 0.076107f, 0.068251f, -0.068736f, 0.014947f, -0.008713f, 0.018278f, -0.023418f, 0.017718f, 0.039407f, -0.019256f, 0.007707f, -0.0167f, -0.036457f, 0.029681f, 0.039265f, 0.003865f, 0.045067f, -0.021933f, 0.013251f, 0.009265f, -0.102087f, -0.068216f, 0.068996f, 0.030679f, 0.059867f, -0.032663f, 0.053695f, -0.069566f, 0.008459f, 0.049105f, 0.081105f, 0.060145f, 0.101513f, 0.092228f, 0.035029f, -0.007224f, -0.079396f, -0.03097f, -0.033875f, -0.035151f, -0.04469f, 0.108991f, -0.089369f, 0.058927f, 0.002332f, 0.001214f, -0.074811f, -0.01791f, -0.029612f, 0.077031f, -0.067642f, -0.086433f, -0.034031f, 0.041012f, -0.005242f, -0.065523f, -0.021022f, 0.008195f, -0.00793f, 0.03952f, -0.051816f, 0.087674f, 0.00203f, -0.05242f, -0.010196f, 0.023749f, -0.102618f, 0.093083f, -0.082278f, 0.057753f, -0.058459f, -0.100829f, 0.017366f, 0.060572f, 0.069747f, 0.072179f, -0.074413f, -0.024193f, 0.063072f, 0.062614f, -0.059543f, 0.058192f, 0.071521f, -0.041867f, -0.078168f, -0.067844f, 0.028433f, 0.013583f, -0.006751f, 0.005212f, 0.042146f, -0.070532f, -0.076206f, 0.056156f, 0.017718f, 0.028957f, 0.001056f, 0.018592f, -0.071742f, -0.046391f, 0.049339f, -0.081691f, 0.092891f, 0.054177f, 0.033628f, 0.022401f, -0.028862f, 0.094173f, -0.042806f, -0.031292f, 0.015088f, -0.038905f, 0.005244f, 0.064351f, 0.022236f, -0.028458f, 0.013477f, -0.040337f, 0.085459f, -0.068416f, -0.001112f, 0.057659f, -0.041424f, 0.054163f, 0.085244f, -0.087306f, -0.03148f, -0.04227f, 0.002606f, -0.088398f, 0.00387f, 0.022892f, 0.009905f, -0.012149f, 0.026929f, -0.083583f, -0.01264f, 0.085051f, -0.079886f, -0.015297f, -0.017188f, -0.056181f, -0.077449f, -0.013369f, 0.020279f, -0.022658f, -0.07295f, 0.061756f, 0.071809f, 0.059988f, 0.006573f, 0.073841f, 0.02678f, -0.005687f, 0.080892f, -0.097777f, 0.018038f, -0.06981f, -0.083065f, -0.058265f, 0.025891f, -0.067352f, -0.078226f, 0.07067f, -0.027461f, 0.007911f, -0.036117f, -0.035774f, 0.086126f, 0.093788f, 0.035618f, -0.084162f, -0.005093f, 0.058156f, 0.095696f, 0.037905f, 0.039284f, -0.08379f, 0.102438f, -0.073391f, -0.034422f, 0.078205f, 0.048302f, 0.06833f, 0.009392f, -0.036968f, 0.067787f, -0.050064f, -0.081172f, -0.07838f, -0.058087f, 0.061026f, -0.069338f, -0.099076f, -0.073652f, 0.026754f, 0.062903f, 0.098787f, 0.03277f, 0.079474f, 0.023956f, 0.010227f, 0.057964f, -0.025234f, 0.004885f, -0.001681f, -0.095885f, 0.00403f, -0.052036f, -0.063363f, -0.046595f, 0.078207f, 0.037311f, 0.032343f, -0.014959f, 0.045859f, 0.048858f, -0.088362f, -0.045434f, 0.061191f, -0.017492f, 0.004705f, -0.068898f, -0.094638f, 0.093236f, -0.043045f, -0.056507f, 0.062754f, -0.068915f, -0.065346f, 0.082969f, 0.063893f, 0.019024f, 0.050097f, -0.081871f, -0.078388f, 0.045879f, 0.078253f, -0.075599f, -0.090622f, -0.073236f, 0.060591f, 0.076553f, 0.081624f, 0.027791f, 0.040368f, 0.084108f, -0.009518f, 0.066555f, -0.024926f, -0.004713f, 0.056574f, -0.055697f, 0.096161f, 0.009041f, 0.00703f, 0.041075f, -0.011913f, 0.056118f, 0.030923f, 0.092865f, 0.070859f, 0.025359f, 0.030713f, -0.012765f, -0.055014f, 0.018741f, -0.014615f, 0.04415f, 0.004216f, -0.039627f, 0.025679f, -0.088812f, 0.063922f, 0.062836f, -0.054837f, -0.054506f, -0.002474f, -0.029009f, 0.071677f, -0.04468f, 0.099624f, 0.015894f, -0.038556f, -0.087689f, -0.023589f, -0.091762f, -0.074377f, -0.067307f, 0.049695f, -0.016988f, 0.085044f, -0.022582f, -0.014176f, -0.033894f, 0.077869f, -0.077878f, -0.045087f, 0.02765f, 0.08731f, -0.019899f, 0.067641f, 0.075693f, 0.04171f, 0.006681f, 0.057349f, 0.09874f, 0.080943f, -0.069362f, 0.035064f, -0.057571f, 0.023882f, -0.088316f, -0.083804f, -0.077693f, -0.017832f, -0.0197f, 0.037219f, 0.068584f, 0.026202f, -0.023698f, -0.014711f, -0.020341f, 0.004571f, 0.039558f, 0.073224f, -0.045002f, -0.051309f, 0.013335f, -0.077101f, -0.031967f, 0.075193f, 0.04071f, -0.046666f, -0.074172f, 0.033399f, -0.0468f, -0.059237f, 0.027035f, 0.004223f, -0.106631f, 0.020058f, 0.092971f, 0.008745f, -0.064727f, -0.005922f, -0.05117f, -0.055907f, 0.057889f, 0.049346f, -0.069988f, 0.036589f, 0.067844f, -0.031686f, 0.092782f, 0.040875f, 0.00502f, 0.075162f, 0.057244f, 0.006009f, 0.027351f, 0.034556f, 0.054243f, -0.069566f, -0.09473f, -0.041877f, -0.001529f, 0.058719f, 0.01468f, 0.002071f, -0.053976f, -0.005762f, -0.079645f, -0.015128f, -0.006684f, -0.045454f, 0.076197f, -0.014484f, -0.037203f, 0.053477f, 0.019285f, -0.029235f, 0.002023f, -0.029928f, -0.001083f, -0.096272f, 0.068165f, 0.0718f, -0.07056f, 0.092837f, -0.009257f, -0.095814f, -0.044944f, 0.021957f, 0.001519f, -0.001654f, -0.023577f, 0.063396f, -0.044659f, -0.066073f, 0.011248f, 0.029798f, 0.064526f, 0.067741f, 0.079527f, 0.031929f, -0.074452f, -0.098183f, -0.042234f, 0.05379f, 0.029689f, -0.042357f, 0.074051f, -0.082847f, -0.058984f, -0.011871f, -0.060306f, 0.008869f, 0.079763f, -0.062837f, 0.076183f, 0.071551f, 0.046723f, -0.095703f, -0.092207f, -0.009546f, -0.031355f, -0.048921f, 0.039159f, -0.025181f, 0.03725f, -0.050564f, -0.000726f, -0.067666f, 0.095912f, -0.058867f, 0.057763f, -0.077347f, 0.072067f, -0.072626f, 0.084929f, -0.052549f, 0.01613f, -0.101603f, -0.058171f, -0.041586f, -0.048903f, -0.024581f, 0.071159f, -0.058778f, 0.011058f, -0.000601f, -0.075418f, 0.050178f, 0.02993f, 0.015979f, -0.061892f, -0.07807f, 0.063639f, 0.082083f, -0.045785f, -0.015185f, -0.043308f, 0.034031f, -0.052877f, -0.014496f, -0.014f, -0.027727f, 0.039686f, -0.022265f, 0.029096f, 0.055148f, 0.057935f, 0.047262f, -0.087074f, -0.065474f, 0.032763f, 0.008084f, 0.013626f, -0.081748f, -0.056089f, 0.029019f, -0.058082f, 0.02256f, -0.024463f, 0.08557f, 0.003652f, 0.054795f, 0.085141f, -0.067399f, -0.063906f, -0.033809f, -0.079612f, -0.058736f, 0.061022f, 0.046473f, -0.06103f, -0.062713f, -0.014738f, 0.020318f, 0.039008f, 0.09655f, -0.020628f, 0.091602f, -0.08496f, -0.10487f, 0.055474f, 0.036787f, -0.094766f, -0.033346f, 0.049053f, -0.034312f, 0.1027f, 0.030562f, 0.053304f, 0.081658f, 0.06073f, 0.051328f, 0.039939f, 0.081071f, 0.039775f, -0.092091f, 0.044641f, -0.022728f, 0.000515f, 0.007062f, -0.09224f, 0.077445f, 0.091036f, -0.025283f, 0.086959f, 0.078665f, 0.046014f, 0.082048f, -0.062999f, -0.019907f, -0.035411f, 0.083569f, -0.079487f, 0.037357f, -0.054297f, 0.048767f, 0.038193f, 0.012635f, -0.036402f, 0.066099f, 0.071126f, -0.089023f, 0.047159f, -0.008473f, 0.01489f, -0.103718f, -0.085681f, -0.022579f, -0.004347f, 0.082056f, 0.057374f, 0.088882f, -0.094218f, -0.029849f, 0.085893f, 0.012084f, -0.020154f, 0.047339f, -0.012469f, 0.000563f, 0.04723f, -0.060083f, -0.02839f, 0.0313f, 0.020264f, -0.084952f, -0.072867f, -0.032909f, 0.004715f, 0.0212f, -0.003273f, -0.100447f, -0.009343f, -0.100108f, -0.04618f, 0.028649f, -0.048137f, -0.084299f, 0.020989f, -0.06866f, 0.079812f, -0.025028f, 0.002832f, 0.004275f, 0.007128f, 0.105622f, -0.108943f, -0.002303f, -0.067878f, 0.067784f, 0.083304f, -0.035843f, 0.025989f, -0.079643f, 0.057824f, -0.023078f, -0.01256f, -0.084885f, 0.066174f, 0.011135f, 0.042398f, -0.027798f, 0.009951f, -0.066985f, 0.025582f, -0.016947f, 0.090313f, 0.024869f, -0.030358f, -0.080055f, 0.025128f, 0.068292f, -0.055026f, 0.052756f, 0.112933f, 0.000858f, -0.050644f, -0.05257f, -0.089144f, 0.083001f, -0.015486f, 0.041209f, 0.059408f, 0.073312f, -0.046402f, -0.074035f, 0.091926f, -0.01743f, 0.073922f, 0.081298f, -0.070452f, 0.053894f, -0.000604f, -0.090829f, 0.059071f, 0.083807f, -0.103054f, 0.088008f, -0.008122f, -0.049437f, -0.106904f, -0.062933f, 0.010941f, -0.097545f, -0.00786f, -0.018874f, -0.054329f, -0.020703f, 0.039125f, -0.068443f, -0.098268f, 0.015403f, -0.023681f, -0.042601f, 0.023159f, -0.060573f, -0.088642f, 0.066787f, -0.092408f, -0.066085f, -0.104498f, 0.07385f, 0.006968f, -0.024335f, -0.05598f, 0.014773f, 0.015589f, -0.019129f, -0.064079f, -0.059843f, 0.012283f, 0.043102f, 0.096944f, -0.025468f, -0.09634f, -0.052725f, -0.01572f, -0.043991f, -0.028284f, -0.00985f, 0.050452f, -0.109146f, 0.025766f, -0.001419f, -0.057865f, -0.061224f, 0.039596f, 0.079508f, 0.069639f, -0.021294f, 0.009864f, -0.029939f, -0.022083f, -0.050686f, -0.000629f, -0.059277f, 0.032222f, 0.09661f, -0.030945f, -0.001125f, 0.052081f, 0.029926f, 0.032049f, -0.02969f, 0.023286f, 0.053626f, 0.008779f, 0.083894f, 0.057708f, 0.066042f, -0.006112f, -0.075427f, 0.075988f, 0.073222f, -0.046963f, -0.071425f, 0.02268f, -0.087396f, -0.088121f, -0.04278f, 0.008609f, 0.079023f, 0.002012f, -0.079104f, 0.002147f, 0.004225f, 0.087869f, -0.047444f, -5.8e-05f, -0.044116f, -0.051677f, 0.054812f, 0.045539f, 0.066723f, -0.062886f, 0.011835f, 0.003477f, 0.056637f, 0.014651f, -0.014043f, 0.070152f, 0.017459f, 0.051216f, -0.069181f, -0.02811f, 0.032723f, 0.003367f, 0.096603f, -0.066336f, -0.109926f, 0.078483f, -0.025075f, -0.070836f, -0.057235f, 0.064477f, 0.001691f, -0.057267f, -0.02366f, 0.0769f, 0.003742f, -8e-05f, -0.074636f, -0.024722f, -0.054428f, 0.015336f, 0.0685f, 0.031747f, 0.053719f, -0.027127f, -0.052717f, -0.031237f, -0.039593f, 0.048653f, -0.004202f, 0.029985f, 0.059971f, -0.051745f, 0.099122f, 0.077206f, 0.003844f, -0.076604f, -0.016456f, -0.020711f, -0.015061f, -0.076046f, 0.045615f, 0.03266f, -0.033684f, -0.104939f, -0.021306f, -0.099644f, -0.052659f, 0.040904f, -0.011908f, 0.083511f, -0.047874f, 0.015354f, 0.077216f, 0.097452f, -0.083254f, 0.078462f, 0.012879f, -0.048264f, -0.073773f, 0.000942f, -0.064331f, 0.048348f, 0.082299f, 0.098709f, -0.09113f, -0.03869f, 0.07724f, 0.086848f, -0.05435f, 0.058053f, 0.03395f, -0.019814f, -0.025514f, -0.042201f, 0.027403f, -0.03766f, -0.006836f, -0.080536f, 0.084631f, -0.086264f, -0.095225f, 0.099069f, 0.081067f, -0.005495f, 0.03809f, 0.091865f, 0.048142f, 0.008343f, -0.088267f, 0.08634f, -0.078585f, -0.081784f, -0.029614f, -0.086936f, 0.045279f, -0.062328f, 0.026248f, -0.000646f, -0.030879f, -0.077871f, 0.060581f, -0.030645f, -0.038758f, 0.028278f, 0.004624f, -0.03644f, 0.081755f, 0.025779f, -0.054774f, -0.064623f, 0.026179f, -0.023463f, 0.065954f, 0.058713f, 0.107234f, 0.025138f, -0.062864f, 0.047507f, -0.00784f, 0.028999f, 0.003846f, -0.07707f, 0.060969f, 0.079515f, 0.098064f, -0.028047f, 0.009823f, -0.022476f, 0.069798f, 0.060533f, 0.010425f, 0.037397f, -0.06794f, -0.012387f, -0.002392f, -0.07389f, -0.066666f, -0.01564f, 0.079376f, -0.038867f, 0.10735f, 0.014129f, -0.00432f, 0.056093f, 0.018115f, -0.080799f, 0.012149f, -0.059036f, -0.085166f, 0.026981f, -0.049927f, -0.053293f, 0.0242f, -0.042656f, -0.080641f, 0.088983f, -0.00793f, -0.056917f, -0.086343f, 0.065064f, 0.075594f, 0.034945f, -0.044116f, 0.020383f, -0.071116f, -0.008987f, -0.087402f, -0.093668f, 0.005727f, -0.025169f, -0.055985f, 0.061912f, -0.019831f, 0.04529f, -0.092021f, -0.044656f, -0.086785f, -0.028705f, 0.026671f, 0.002595f, 0.08717f, 0.070171f, -0.053436f, -0.002793f, 0.064747f, 0.073382f, 0.022818f, 0.073035f, 0.003079f, 0.075842f, 0.076842f, -0.040085f, -0.09749f, -0.069173f, -0.015565f, -0.004974f, 0.019353f, -0.029362f, -0.026365f, -0.059696f, 0.09595f, -0.030097f, -0.049918f, -0.009672f, -0.047887f, 0.097508f, -0.06072f, 0.00944f, 0.030313f, -0.028179f, 0.029684f, 0.06989f, -0.061103f, 0.002809f, 0.01923f, 0.009744f, 0.035952f, -0.081962f, -0.062677f, -0.007484f, -0.030961f, 0.062805f, -0.088285f, -0.010181f, 0.033758f, -0.071818f, 0.076849f, 0.087851f, 0.033741f, -0.014435f, 0.024765f, 0.064765f, -0.065547f, 0.032046f, -0.036231f, -0.053582f, 0.002427f, 0.060689f, -0.044861f, -0.038487f, 0.055539f, -0.08328f, -0.01522f, 0.107891f, -0.027444f, -0.037745f, 0.088758f, -0.03633f, -0.049397f, 0.020639f, -0.055548f, -0.018606f, -0.051453f, 0.040256f, 0.058068f, 0.001332f, 0.054349f, -0.036261f, 0.022978f, 0.00305f, -0.05143f, -0.027316f, -0.032335f, -0.059434f, 0.10482f, -0.018503f, 0.101903f, 0.03728f, -0.072306f, -0.073916f, 0.030215f, 0.054535f, -0.035992f, 0.031262f, 0.082313f, 0.062504f, -0.041202f, -0.041097f, 0.003116f, 0.028773f, -0.070532f, -0.093027f, -0.058989f, 0.071349f, -0.01138f, 0.092093f, 0.104104f, 0.030949f, -0.079756f, -0.08029f, -0.008224f, 0.047077f, -0.010606f, -0.096144f, 0.017236f, -0.097547f, 0.074586f, 0.017166f, 0.098497f, -0.005267f, -0.037646f, 0.06076f, -0.002643f, 0.076296f, 0.03207f, -0.071117f, 0.065145f, 0.069297f, -0.085088f, -0.075268f, -0.057545f, 0.064714f, 0.082655f, 0.053864f, 0.050093f, -0.001047f, 0.038484f, -0.024498f, -0.012455f, -0.032802f, -0.038092f, -0.081224f, 0.000483f, -0.03941f, 0.000392f, -0.036699f, -0.058241f, 0.050714f, 0.037531f, 0.06489f, 0.010597f, -0.075076f, 0.000924f, 0.052896f, 0.080896f, 0.030545f, -0.061308f, 0.049753f, 0.086675f, 0.044982f, 0.016494f, 0.077639f, 0.07409f, 0.065883f, 0.073788f, -0.071699f, 0.042349f, 0.078303f, 0.045398f, -0.088036f, -0.030755f, 0.002579f, -0.042633f, -0.040695f, 0.040743f, 0.069303f, 0.077209f, -0.002765f, -0.013163f, 0.072956f, 0.059432f, -0.046263f, 0.008667f, 0.068555f, -0.101062f, -0.083141f, -0.086047f, -0.047893f, 0.061174f, 0.001079f, -0.030984f, 0.056692f, 0.037441f, -0.102734f, -0.07181f, -0.030292f, 0.052492f, 0.079246f, 0.019496f, -0.075974f, 0.023231f, -0.104619f, 0.018289f, -0.028824f, -0.007185f, 0.039005f, -0.055477f, 0.101278f, -0.057517f, 0.010852f, 0.023889f, -0.032954f, -0.066544f, 0.026174f, 0.093275f, -0.045556f, 0.020555f, -0.045313f, 0.029033f, -0.036697f, 0.106202f, -0.06171f, -0.043137f, -0.06137f, -0.035985f, -0.008307f, -0.016602f, 0.018159f, 0.054066f, -0.049326f, -0.093803f, 0.081564f, -0.014545f, 0.034634f, -0.083005f, 0.042991f, -0.002605f, 0.020499f, 0.032015f, 0.060041f, -0.089212f, 0.014067f, 0.081335f, -0.062886f, 0.004969f, 0.07319f, -0.087359f, -0.10523f, -0.075947f, -0.098153f, 0.016118f, 0.032331f, -0.111266f, -0.011015f, -0.011361f, 0.066772f, 0.062703f, 0.058391f, -0.097055f, -0.046971f, -0.107085f, 0.083436f, 0.101745f, -0.011161f, -0.035333f, 0.036461f, -0.042138f, -0.012492f, 0.053727f, 0.00094f, 0.076175f, 0.081685f, -0.003028f, 0.073131f, -0.00306f, 0.075423f, -0.051398f, -0.00847f, 0.092432f, -0.045116f, 0.034084f, -0.01006f, 0.045793f, -0.026277f, -0.018059f, -0.066693f, 0.01931f, -0.065612f, -0.048358f, -0.041638f, 0.033631f, -0.015459f, -0.082154f, 0.001255f, 0.080431f, 0.062179f, -0.071114f, 0.006039f, 0.015064f, 0.054888f, 0.012963f, -0.086755f, 0.108669f, 0.077566f, 0.007884f, -0.044573f, -0.017068f, 0.034039f, -0.09013f, -0.097855f, 0.086426f, -0.024858f, -0.06591f, 0.014743f, -0.078116f, 0.012199f, 0.008593f, 0.095274f, -0.013811f, 0.051481f, -0.089581f, -0.057657f, 0.065732f, 0.077256f, 0.053056f, 0.048269f, 0.054764f, -0.078823f, -0.062343f, -0.002484f, 0.023697f, 0.060115f, 0.029287f, -0.075709f, 0.0982f, -0.041259f, 0.020909f, -0.085943f, -0.009031f, 0.037045f, -0.079379f, 0.073695f, -0.047819f, -0.067043f, -0.066702f, 0.011471f, -0.086439f, 0.05815f, 0.052598f, -0.070128f, 0.087883f, 0.093755f, 0.08323f, -0.081174f, -0.038868f, 0.012465f, 0.027271f, -0.052781f, 0.092718f, 0.101933f, -0.07591f, -0.022517f, -0.041268f, 0.006354f, -0.006797f, 0.005241f, 0.054105f, 0.105846f, -0.084428f, -0.10583f, 0.019173f, -0.061336f, -0.106613f, 0.025217f, 0.053462f, 0.001225f, -0.017294f, -0.080773f, -0.001065f, 0.01959f, 0.071073f, -0.003555f, -0.040895f, -0.080279f, 0.03954f, 0.05777f, -0.032434f, 0.036046f, 0.018747f, -0.102082f, -0.032207f, 0.022332f, 0.108707f, -0.052152f, 0.085556f, -0.002581f, -0.088318f, -0.008929f, -0.032894f, 0.051955f, -0.10787f, 0.034485f, 0.066799f, -0.008915f, 0.064701f, 0.06618f, -0.003492f, 0.014381f, 0.021375f, 0.062735f, -0.07486f, 0.046916f, -0.029831f, 0.035608f, 0.050367f, -0.007564f, 0.017691f, 0.046919f, -0.093787f, -0.005775f, -0.01601f, 0.066422f, 0.091667f, -0.019147f, -0.033612f, 0.04015f, -0.010355f, -0.017993f, -0.07386f, -0.032489f, 0.030526f, -0.054572f, 0.016386f, -0.008243f, -0.039473f, 0.095564f, -0.025717f, 0.002359f, 0.063936f, 0.005191f, 0.010764f, -0.015966f, -0.080121f, -0.04244f, -0.020099f, -0.015319f, 0.059809f, -0.009918f, 0.073443f, -0.018833f, 0.064287f, 0.032964f, 0.055106f, 0.067481f, 0.105092f, 0.040105f, 0.069829f, -0.059754f, 0.050404f, 0.026361f, -0.023894f, 0.01105f, 0.059104f, -0.020615f, 0.042497f, -0.066184f, 0.086294f, -0.049222f, 0.022939f, -0.00375f, -0.072286f, 0.078494f, -0.087942f, 0.011988f, -0.072588f, 0.102213f, 0.012402f, -0.034737f, 0.074691f, -0.104679f, -0.026869f, 0.025576f, -0.066856f, 0.044084f, 0.061922f, 0.014417f, 0.05271f, 0.058084f, -0.089167f, 0.013092f, 0.099157f, -0.081509f, 0.065781f, -0.0967f, 0.035256f, 0.095383f, -0.018669f, 0.0505f, 0.027113f, 0.015681f, 0.016088f, 0.013949f, -0.07645f, -0.012161f, 0.057781f, -0.048807f, -0.069523f, -0.021054f, -0.007013f, -0.009305f, 0.054017f, -0.084914f, -0.01564f, -0.053753f, -0.068295f, -0.07657f, -0.065586f, -0.02539f, 0.080669f, -0.063277f, 0.078401f, 0.025429f, 0.016961f, 0.068809f, -0.028989f, -0.028012f, 0.088175f, 0.048146f, 0.03314f, -0.033109f, 0.044154f, -0.081161f, -0.056197f, 0.037392f, 0.030082f, -0.036046f, 0.082135f, -0.054334f, 0.082689f, -0.089512f, 0.086568f, -0.023923f, -0.086743f, 0.101566f, -0.057706f, 0.0788f, 0.076118f, 0.032213f, 0.027993f, -0.047112f, 0.074593f, 0.080785f, -0.073752f, -0.01676f, -0.016068f, -0.07249f, -0.03635f, -0.07043f, -0.019733f, -0.000582f, 0.085532f, -0.037891f, 2.2e-05f, 0.076144f, 0.060785f, -0.068213f, 0.003253f, 0.037396f, -0.04086f, 0.060052f, -0.021494f, 0.005462f, 0.023221f, -0.033548f, 0.025129f, -0.074533f, -0.045876f, 0.076343f, -0.007715f, 0.10191f, -0.07875f, -0.011681f, 0.026769f, -0.059215f, 0.088898f, 0.059831f, -0.004908f, -0.06706f, -0.003057f, 0.014994f, -0.027089f, 0.0022f, 0.000304f, 0.033402f, -0.074905f, -0.0838f, -0.023942f, 0.007719f, -0.082937f, 0.058962f, 0.019772f, 0.105759f, 0.092652f, 0.024398f, 0.014535f, -0.045801f, 0.051667f, -0.099814f, 0.04107f, 0.050457f, 0.058732f, -0.016542f, -0.080416f, -0.072074f, 0.093013f, 0.029473f, 0.081371f, 0.080899f, -0.060655f, 0.078695f, -0.020174f, -0.078017f, 0.003818f, 0.097436f, -0.03696f, -0.002647f, 0.00488f, -0.051249f, 0.01332f, -0.026384f, -0.019488f, 0.070262f, 0.05174f, 0.068252f, 0.070516f, -0.002286f, 0.008703f, -0.095842f, -0.062326f, 0.078035f, -0.088087f, -0.072107f, -0.087623f, -0.049118f, 0.051527f, 0.02134f, -0.013991f, -0.004261f, 0.112882f, -0.054039f, -0.082803f, 0.071794f, -0.030917f, -0.090443f, 0.04078f, 0.030663f, 0.022619f, 0.043407f, -0.065588f, 0.029119f, 0.006669f, -0.015553f, 0.017604f, 0.082924f, -0.066204f, -0.07921f, -0.048909f, 0.060037f, -0.036205f, 0.038637f, -0.006636f, 0.058625f, 0.018251f, -0.018117f, 0.068919f, 0.047616f, 0.059636f, -0.006396f, -0.042462f, -0.021593f, 0.077678f, -0.079629f, 0.034453f, -0.023902f, -0.036738f, 0.013417f, -0.001763f, -0.035278f, 0.078237f, 0.034287f, 0.001103f, -0.095873f, -0.003694f, 0.056894f, 0.040446f, 0.022813f, -0.107328f, -0.050477f, 0.09605f, 0.065746f, 0.02754f, -0.025229f, -0.075661f, 0.054402f, -0.079801f, 0.101518f, 0.033348f, 0.030312f, 0.04571f, -0.028763f, -0.018317f, -0.081561f, 0.102384f, -0.008023f, 0.050452f, -0.061547f, 0.080969f, 0.00404f, 0.018956f, -0.034326f, -0.045636f, -0.090883f, -0.07158f, -0.102924f, -0.077747f, 0.082028f, 0.015227f, 0.057014f, -0.078952f, -0.0751f, -0.036628f, -0.10638f, 0.025826f, -0.070256f, 0.035722f, 0.008848f, -0.001371f, 0.049682f, 0.011667f, 0.062988f, -0.076717f, 0.055579f, -0.091315f, 0.015078f, -0.011609f, -0.111283f, -0.068723f, 0.012912f, 0.017621f, -0.025913f, -0.02579f, -0.072978f, 0.039115f, 0.05659f, -0.07213f, -0.041404f, -0.096605f, -0.088349f, -0.027037f, 0.042771f, -0.019574f, -0.055029f, 0.066599f, 0.01578f, -0.090164f, 0.046878f, 0.089024f, -0.032031f, -0.033545f, -0.045364f, 0.053775f, 0.094751f, -0.102085f, -0.086662f, -0.050981f, -0.041875f, -0.030232f, -0.004828f, -0.073585f, 0.067504f, 0.015374f, 0.087005f, 0.064058f, -0.059349f, -0.030645f, -0.037224f, -0.035457f, -0.077345f, -0.0767f, -0.016908f, -0.046507f, 0.018032f, 0.021437f, 0.038799f, -0.051946f, 0.021658f, -0.05406f, -0.016635f, -0.093519f, 0.005168f, 0.034748f, 0.082681f, -0.087176f, 0.043668f, 0.021164f, -0.074446f, -0.053597f, -0.026242f, -0.065503f, 0.072664f, 0.004901f, 0.017976f, 0.078014f, -0.038682f, -0.082401f, 0.026186f, 0.065924f, 0.045841f, 0.021151f, -0.038922f, -0.052996f, 0.035161f, 0.003272f, -0.091885f, 0.008123f, -0.01477f, 0.05517f, -0.039748f, -0.01301f, 0.079462f, 0.028748f, 0.091538f, 0.011325f, 0.056155f, 0.095381f, -0.030253f, -0.055557f, 0.035682f, 0.02939f, -0.002294f, -0.071915f, 0.046528f, -0.035399f, 0.02137f, -0.089091f, -0.076576f, 0.019446f, -0.037847f, 0.01045f, -0.027827f, 0.045263f, 0.009215f, 0.035521f, -0.036914f, 0.062064f, -0.048095f, 0.039264f, 0.054183f, -0.102095f, 0.075184f, -0.069419f, 0.048457f, -0.048308f, -0.014505f, -0.059589f, -0.053609f, 0.076634f, 0.058454f, 0.040853f, 0.06543f, 0.041221f, -0.102313f, 0.033342f, 0.06365f, 0.010785f, 0.074048f, 0.03375f, 0.037655f, 0.02118f, 0.087433f, 0.022997f, 0.038839f, -0.037008f, 0.034235f, 0.039611f, -0.081539f, -0.063428f, -0.07267f, 0.021863f, -0.04321f, -0.026987f, 0.046522f, 0.04484f, 0.074094f, 0.071076f, -0.067474f, 0.069666f, -0.056677f, -0.036117f, 0.070606f, -0.044878f, 0.049853f, 0.024588f, 0.014927f, 0.017943f, 0.053631f, 0.081571f, 0.085105f, -0.079342f, 0.041496f, 0.082464f, 0.102273f, 0.077587f, 0.055455f, -0.00731f, 0.034054f, 0.036914f, -0.038972f, 0.020608f, 0.027802f, -0.044436f, -0.001276f, 0.056183f, 0.021164f, 0.064613f, 0.090607f, -0.106004f, -0.042653f, -0.066416f, 0.042733f, 0.078401f, 0.023076f, -0.054804f, -0.02991f, -0.011413f, 0.084517f, 0.00765f, 0.002666f, -0.073419f, 0.092829f, -0.039131f, 0.065889f, -0.063643f, 0.068385f, 0.020636f, -0.059028f, 0.062728f, 0.016033f, 0.02849f, -0.026244f, 0.086735f, 0.021871f, -0.053351f, -0.057914f, -0.097544f, -0.085649f, -0.088104f, -0.049936f, 0.086844f, 0.034508f, -0.066698f, -0.028234f, -0.07065f, 0.015564f, -0.071538f, 0.082044f, 0.016637f, -0.055735f, 0.058841f, -0.086359f, 0.064006f, -0.048807f, -0.082992f, -0.067733f, 0.018432f, 0.091407f, -0.022117f, -0.012497f, -0.033255f, -0.028504f, 0.112936f, -0.038386f, 0.096467f, -0.047543f, 0.048337f, -0.038058f, -0.026824f, 0.094142f, 0.073704f, 0.088989f, 0.012554f, -0.031904f, 0.051303f, -0.099064f, -0.101135f, 0.025088f, -0.074437f, -0.077988f, 0.064726f, -0.053513f, 0.032985f, 0.102345f, -0.06152f, 0.068121f, -0.003199f, 0.040176f, 0.092312f, -0.065155f, 0.062299f, -0.023976f, 0.067703f, -0.023783f, 0.060068f, 0.0217f, 0.061768f, -0.081007f, 0.075655f, -0.063437f, -0.050172f, -0.056269f, -0.024639f, 0.070955f, -0.015687f, -0.049074f, -0.080328f, 0.088901f, 0.064146f, -0.049504f, 0.026763f, -0.073783f, -0.053509f, 0.061687f, 0.045461f, 0.10374f, -0.059183f, 0.084289f, 0.058326f, -0.036371f, 0.041368f, 0.036611f, 0.052697f, 0.102562f, -0.020428f, 0.060686f, 0.032061f, 0.080185f, 0.003517f, -0.0248f, 0.074051f, -0.056237f, -0.104638f, 0.085517f, -0.093796f, 0.067595f, -0.048349f, -0.009938f, -0.020998f, -0.069521f, 0.05515f, -0.052389f, -0.000752f, -0.011201f, -0.037034f, -0.070171f, -0.080441f, -0.075588f, 0.096864f, -0.035869f, -0.071014f, -0.104788f, -0.037886f, 0.05407f, -0.027863f, 0.077377f, 0.012232f, 0.047048f, 0.076969f, -0.112056f, -0.044413f, 0.026361f, 0.062643f, -0.075829f, -0.036331f, 0.048624f, -0.024547f, -0.072506f, -0.008118f, 0.009602f, 0.017234f, -0.012153f, -0.006601f, 0.06383f, -0.09351f, 0.081077f, 0.086117f, -0.053422f, 0.017353f, 0.017222f, -0.070199f, -0.053275f, -0.029949f, 0.009682f, 0.041364f, 0.05718f, -0.101094f, -0.046003f, -0.031739f, 0.016705f, -0.056774f, -0.101232f, 0.050704f, 0.056372f, -0.051687f, -0.06982f, -0.100757f, 0.038315f, -0.010475f, 0.030409f, -0.007425f, 0.048069f, 0.052525f, 0.068603f, -0.063647f, 0.079727f, 0.063519f, 0.082359f, 0.087494f, 0.104142f, -0.091833f, -0.045236f, 0.029691f, -0.04528f, 0.078741f, -0.032266f, -0.068358f, 0.096763f, -0.046794f, -0.052584f, -0.042929f, 0.094194f, -0.081971f, -0.019681f, -0.04623f, -0.086476f, -0.03373f, 0.032688f, -0.010562f, -0.042629f, 0.06771f, -0.032243f, -0.082409f, 0.026463f, -0.07433f, 0.061284f, -0.006261f, -0.069302f, -0.017497f, -0.024284f, 0.000862f, 0.016576f, 0.091658f, 0.023651f, -0.048488f, -0.062598f, -0.071586f, -0.002052f, -0.013467f, -0.052428f, -0.0205f, -0.103044f, 0.034024f, -0.0024f, 0.111087f, -0.059677f, -0.000615f, -0.103004f, -0.059537f, 0.100047f, 0.110416f, -0.082981f, 0.075578f, 0.002436f, 0.048113f, -0.018879f, 0.070607f, -0.079705f, -0.061294f, -0.056163f, 0.085905f, -0.020245f, 0.087193f, 0.019002f, 0.081124f, 0.068287f, -0.084028f, -0.060376f, 0.100204f, -0.085959f, 0.058753f, 0.080951f, -0.011124f, -0.034196f, -0.019743f, -0.044798f, 0.078632f, -0.029469f, -0.102977f, -0.086582f, -0.086356f, -0.060236f, -0.061105f, -0.02746f, -0.066016f, 0.04423f, 0.09096f, -0.043543f, 0.039975f, 0.030442f, 0.020632f, -0.076534f, -0.066435f, -0.053307f, -0.063687f, 0.076297f, 0.064111f, -0.049263f, -0.063565f, 0.060921f, -0.010118f, -0.08002f, -0.037123f, -0.081357f, 0.008452f, 0.021219f, 0.102876f, -0.08252f, 0.104f, 0.031708f, -0.058724f, 0.010172f, -0.087481f, 0.079578f, 0.022795f, 0.091442f, 0.070216f, -0.05718f, 0.064959f, -0.060692f, 0.102959f, -0.04591f, -0.042544f, -0.053394f, 0.041419f, -0.027f, -0.057198f, -0.087712f, -0.078558f, 0.093071f, 0.094166f, 0.048046f, 0.079053f, 0.085168f, -0.010786f, 0.063286f, 0.009775f, -0.087356f, -0.023316f, -0.101397f, 0.096404f, -0.04388f, 0.048835f, 0.074281f, 0.079446f, 0.00517f, -0.082177f, 0.089816f, -0.103582f, 0.064443f, -0.082542f, 0.06227f, -0.026421f, 0.0119f, -0.079227f, -0.069284f, -0.061283f, -0.006318f, 0.070102f, -0.080039f, 0.082774f, -0.049695f, -0.034618f, 0.034395f, 0.070563f, -0.057291f, -0.010317f, -0.026306f, 0.017338f, 0.060541f, 0.019778f, -0.053749f, -0.075713f, -0.086384f, 0.051867f, -0.097759f, 0.094212f, -0.042332f, 0.011581f, 0.034219f, 0.043285f, -0.035731f, 0.045435f, -0.032933f, -0.063736f, -0.037881f, 0.041679f, 0.035332f, 0.096458f, -0.049094f, 0.060881f, -0.065576f, 0.007359f, 0.071118f, 0.084681f, -0.072146f, -0.090136f, 0.003936f, -0.042268f, 0.029438f, 0.09089f, -0.073767f, -0.077144f, 0.021202f, 0.020198f, -0.045216f, 0.014322f, 0.054713f, 0.023645f, -0.091155f, -0.02706f, -0.101371f, -0.079525f, 0.020858f, 0.020454f, -0.065504f, -0.084504f, -0.001522f, -0.057561f, 0.089655f, -0.086836f, -0.082348f, -0.066988f, -0.039987f, 0.100673f, -0.011893f, -0.033562f, -0.035103f, 0.042053f, -0.10163f, -0.028049f, 0.002389f, 0.032529f, 0.054798f, 0.030942f, 0.014105f, 0.101103f, -0.008053f, 0.104735f, 0.039802f, -0.079953f, -0.016735f, 0.076946f, -0.000419f, 0.109876f, -0.038005f, 0.077446f, 0.012973f, 0.065203f, -0.064181f, 0.028222f, 0.014813f, -0.020693f, -0.017042f, -0.089923f, -0.061877f, 0.088351f, -0.031487f, 0.013205f, -0.028399f, 0.034737f, 0.070315f, 0.031462f, 0.062516f, -0.102569f, -0.045404f, 0.095826f, 0.021994f, -0.05197f, 0.038544f, 0.031597f, 0.0702f, 0.073396f, 0.041826f, -0.087069f, -0.095507f, 0.05174f, 0.052683f, 0.110907f, 0.022805f, -0.064095f, -0.076347f, 0.006926f, -0.065841f, 0.071587f, -0.072173f, 0.062991f, 0.034495f, -0.05001f, 0.052344f, -0.039673f, -0.01129f, 0.013272f, 0.072024f, -0.077149f, -0.103625f, -0.022793f, 0.060748f, -0.045072f, 0.001767f, -0.068329f, 0.070474f, 0.042801f, 0.091252f, 0.061493f, 0.055363f, -0.014084f, 0.107425f, 0.071958f, 8e-06f, -0.066544f, -0.015935f, 0.022287f, 0.107077f, 0.044279f, -0.079223f, 0.092098f, -0.026282f, 0.079575f, -0.001015f, 0.012967f, 0.072982f, 0.072803f, 0.066786f, 0.053683f, 0.001395f, -0.08082f, 0.034401f, 0.045625f, -0.088683f, 0.082643f, -0.104916f, -0.025638f, -0.014535f, 0.063892f, -0.056887f, -0.082411f, -0.077275f, 0.016981f, -0.082084f, -0.010586f, 0.090122f, -0.031798f, 0.016299f, -0.090209f, 0.074365f, 0.085558f, 0.069573f, 0.069077f, -0.021196f, -0.035647f, -0.085372f, -0.05874f, 0.032823f, 0.06549f, 0.042965f, -0.057901f, -0.057144f, -0.04931f, 0.013822f, 0.068898f, -0.049836f, -0.039217f, -0.097092f, -0.048544f, 0.078515f, -0.04209f, -0.101057f, -1e-04f, 0.059022f, -0.09599f, -0.009233f, 0.093407f, -0.040716f, -0.045166f, 0.016945f, -0.039147f, -0.078145f, -0.010161f, -0.030728f, 0.028475f, -0.039289f, 0.018149f, -0.082903f, 0.025382f, -0.076069f, -0.037501f, -0.012569f, 0.057975f, 0.08495f, 0.048802f, -0.027863f, 0.0548f, 0.019142f, 0.058353f, -0.06101f, 0.083503f, -0.088058f, 0.01721f, -0.109956f, 0.064954f, -0.047626f, 0.060847f, 0.054712f, -0.029464f, 0.019605f, -0.015952f, 0.075092f, -0.029077f, 0.032388f, 0.019936f, 0.055854f, -0.099383f, 0.046693f, -0.038599f, 0.010755f, -0.030844f, -0.10427f, 0.051676f, -0.082111f, 0.002449f, -0.001796f, -0.083677f, 0.076797f, 0.04155f, -0.022977f, 0.00228f, -0.074908f, 0.002617f, -0.000667f, 0.051029f, 0.08527f, 0.070172f, -0.021288f, 0.063915f, 0.079606f, -0.068056f, -0.028631f, 0.022181f, 0.068118f, 0.037875f, -0.067461f, -0.04407f, -0.038206f, 0.001568f, -0.001699f, -0.031002f, 0.007141f, 0.103602f, 0.025493f, -0.03483f, 0.031753f, 0.029622f, 0.070536f, 0.07964f, -0.051281f, -0.022897f, -0.026918f, -0.005853f, -0.086885f, -0.029455f, -0.093779f, 0.043869f, 0.066142f, 0.029093f, 0.02117f, 0.063383f, -0.003698f, -0.043408f, -0.08544f, 0.070869f, 0.07539f, -0.008889f, -0.025873f, -0.035856f, -0.059032f, -0.04845f, 0.083494f, -0.058474f, 0.060802f, -0.084682f, 0.063219f, -0.003424f, -0.058657f, -0.072109f, 0.054724f, -0.03425f, 0.037711f, 0.070006f, -0.044921f, 0.034645f, 0.097968f, -0.069657f, 0.014522f, 0.085487f, 0.041173f, -0.060542f, -0.039009f, -0.05497f, -0.078759f, -0.096421f, 0.102125f, 0.017742f, -0.099395f, 0.00344f, -0.02763f, 0.041451f, -0.10745f, -0.015436f, 0.041145f, -0.020282f, 0.019382f, 0.005551f, 0.010805f, -0.05088f, -0.013298f, 0.056963f, -0.092546f, 0.076239f, -0.03828f, -0.032762f, -0.020021f, -0.044844f, 0.072266f, 0.046771f, -0.111384f, 0.070838f, -0.075389f, -0.032307f, 0.078539f, 0.083769f, 0.084655f, 0.003656f, -0.026979f, 0.079953f, 0.006016f, 0.09056f, 0.022073f, -0.049711f, 0.035773f, -0.006379f, 0.038375f, -0.014447f, 0.0959f, -0.034427f, -0.078492f, 0.062904f, -0.007507f, 0.033885f, -0.062508f, -0.018156f, -0.060673f, -0.018034f, -0.087283f, 0.036194f, 0.013078f, -0.00056f, -0.019786f, 0.035998f, -0.038634f, 0.053032f, -0.086114f, -0.089674f, -0.034501f, -0.014757f, 0.10317f, 0.06081f, -0.04741f, 0.072436f, 0.024421f, 0.035312f, 0.056831f, -0.082618f, 0.046046f, 0.068663f, -0.08178f, -0.001266f, 0.051762f, 0.070143f, -0.063279f, -0.06118f, -0.041288f, 0.040322f, 0.055676f, -0.009902f, 0.015637f, -0.100838f, 0.071553f, 0.039746f, -0.103242f, -0.051301f, -0.048697f, 0.05612f, 0.04046f, 0.066688f, -0.072598f, 0.011354f, -0.035387f, -0.029911f, 0.102641f, 0.006232f, -0.091812f, -0.092561f, 0.004454f, 0.055394f, -0.091792f, 0.062141f, -0.059127f, -0.005579f, 0.059133f, -0.029994f, 0.058174f, 0.049382f, 0.029182f, 0.079784f, 0.051387f, 0.047382f, -0.070493f, 0.054794f, 0.032528f, -0.080301f, 0.1059f, -0.019569f, -0.08065f, -0.060477f, -0.03901f, -0.02417f, 0.052242f, 0.069549f, 0.109372f, -0.072936f, -0.057011f, 0.062308f, 0.039028f, 0.069052f, 0.061239f, -0.016404f, 0.101115f, 0.060486f, 0.070949f, 0.020459f, 0.032147f, 0.066953f, -3.8e-05f, -0.057564f, 0.046126f, 0.014184f, -0.087547f, 0.077042f, -0.080674f, 0.090018f, 0.077792f, -0.007299f, -0.109177f, -0.090065f, -0.050199f, -0.019905f, 0.067624f, -0.018785f, 0.055536f, -0.107878f, -0.005169f, -0.062256f, 0.091671f, 0.02402f, -0.042424f, 0.007678f, 0.047696f, -0.052452f, -0.025856f, -0.069615f, 0.037462f, 0.024957f, 0.113515f, 0.095315f, 0.039545f, 0.016747f, -0.00294f, -0.041884f, -0.015871f, -0.058444f, 0.089919f, 0.058173f, 0.049602f, 0.029932f, -0.030577f, 0.089478f, 0.105226f, -0.088271f, -0.032338f, 0.022533f, 0.050353f, -0.020795f, -0.016138f, 0.061127f, -0.024158f, 0.016139f, 0.042083f, -0.00476f, -0.032585f, 0.006815f, -0.023889f, 0.01367f, -0.072644f, 0.081071f, -0.023462f, -0.06242f, 0.055877f, -0.086863f, -0.090903f, 0.016052f, 0.013546f, -0.058097f, 0.077299f, -0.067638f, 0.02133f, 0.031693f, 0.083469f, 0.051473f, -0.050039f, -0.110864f, -0.006621f, 0.085309f, 0.0358f, -0.052469f, -0.08473f, -0.080799f, 0.050747f, 0.051022f, -0.048405f, -0.055299f, -0.055459f, 0.072369f, 0.038707f, 0.046402f, 0.079188f, 0.090814f, 0.042796f, 0.023074f, 0.008848f, -0.078569f, 0.077629f, -0.034808f, 0.041876f, 0.048916f, 0.017087f, 0.041208f };
+inline constexpr float layer_0_biases[32] = { -0.056104f, -0.077486f, -0.081478f, 0.078756f, -0.015881f, -0.065573f, -0.002713f, 0.028302f, 0.072239f, -0.042626f, -0.082569f, 0.090163f, 0.04673f, -0.105588f, 0.085866f, -0.099719f, 0.04966f, 0.024121f, -0.017419f, -0.048973f, -0.087346f, 0.032082f, -0.068866f, 0.089475f, -0.0424f, 0.059808f, -0.025868f, -0.054855f, 0.076428f, 0.05175f, 0.015291f, 0.020223f };
+inline constexpr float layer_1_weights[1024] = { 0.129172f, 0.229553f, 0.00458f, 0.008782f, -0.0715f, -0.137871f, -0.040739f, -0.140197f, 0.225911f, -0.282815f, -0.311771f, 0.002811f, 0.037837f, 0.273044f, -0.042018f, -0.034928f, 0.167252f, 0.144118f, 0.171648f, -0.140654f, 0.022147f, 0.011363f, 0.052384f, 0.195172f, -0.068745f, -0.172605f, -0.025148f, -0.208314f, -0.316183f, -0.315679f, -0.037041f, -0.024692f, -0.154473f, 0.077816f, -0.018552f, -0.036552f, 0.305347f, 0.292058f, 0.131239f, -0.163087f, 0.192511f, 0.088458f, 0.187821f, 0.043745f, -0.053224f, -0.058957f, 0.302807f, 0.250256f, 0.303429f, 0.135829f, 0.141896f, 0.288721f, -0.165554f, -0.028086f, -0.210638f, -0.293751f, -0.20962f, 0.042875f, 0.257027f, -0.275729f, 0.213718f, -0.234959f, -0.155345f, -0.110426f, 0.099807f, -0.027783f, -0.043129f, 0.176317f, 0.213566f, 0.25359f, 0.20732f, 0.278519f, -0.237947f, 0.315146f, 0.234882f, 0.105615f, 0.151848f, -0.13353f, 0.022636f, -0.183835f, 0.132982f, 0.201748f, -0.204489f, -0.225596f, 0.005625f, 0.108203f, 0.219621f, 0.051082f, 0.178593f, -0.153011f, -0.097312f, 0.185992f, 0.118311f, -0.199751f, 0.256956f, 0.307215f, 0.032635f, 0.165442f, 0.293469f, 0.158865f, 0.05807f, -0.153513f, 0.186917f, -0.151197f, -0.005035f, 0.012244f, 0.034825f, 0.192096f, -0.128712f, 0.23227f, 0.167007f, -0.149907f, 0.182515f, -0.152852f, 0.181524f, -0.150958f, -0.20323f, -0.061868f, 0.312588f, -0.139282f, -0.077022f, -0.277501f, 0.02349f, 0.133354f, -0.294994f, -0.170418f, -0.141524f, -0.183767f, -0.278773f, 0.062984f, -0.214583f, 0.074444f, -0.016321f, 0.306926f, 0.267059f, 0.044572f, -0.298156f, 0.251755f, 0.055373f, -0.182994f, -0.206966f, 0.029272f, 0.05583f, -0.227632f, -0.046235f, -0.154363f, -0.272219f, 0.129336f, 0.220714f, 0.163326f, 0.004711f, -0.057747f, 0.116004f, -0.237629f, -0.023613f, 0.272741f, -0.143329f, -0.312205f, -0.193744f, -0.015216f, -0.0056f, 0.127787f, -0.05574f, -0.036617f, 0.05676f, 0.082402f, 0.246091f, 0.249159f, 0.15415f, -0.138786f, -0.252969f, -0.141276f, 0.024429f, 0.221957f, -0.197024f, -0.305717f, 0.089586f, 0.003264f, 0.002863f, -0.189149f, -0.207526f, -0.011318f, -0.285644f, -0.069139f, -0.103389f, 0.001169f, 0.213724f, -0.269737f, 0.196431f, -0.052403f, 0.273246f, 0.033233f, 0.102918f, 0.107965f, 0.066925f, 0.167092f, 0.146335f, 0.092065f, -0.092152f, -0.275455f, 0.117223f, 0.037253f, -0.29455f, 0.301099f, -0.170645f, 0.263661f, 0.215763f, -0.079927f, 0.096896f, 0.012089f, -0.046831f, -0.204522f, -0.231419f, 0.137551f, -0.24523f, 0.064293f, 0.008349f, -0.182106f, 0.098231f, 0.161644f, 0.026572f, -0.124466f, -0.068155f, 0.131064f, -0.117541f, 0.104094f, -0.108997f, 0.182387f, -0.298377f, -0.175107f, -0.221994f, 0.194131f, -0.069023f, 0.065756f, 0.111214f, -0.321108f, 0.041075f, 0.115493f, 0.125813f, 0.166666f, -0.202873f, -0.107087f, -0.130234f, 0.170748f, 0.122507f, -0.220077f, 0.161132f, 0.247949f, 0.255522f, -0.289981f, 0.257286f, 0.230853f, 0.292301f, 0.028541f, -0.196994f, -0.21471f, -0.016516f, 0.035793f, -0.227346f, -0.31256f, -0.21528f, -0.026393f, -0.045295f, -0.221451f, -0.139862f, 0.095621f, -0.10716f, -0.283287f, -0.008934f, -0.057468f, 0.153716f, -0.293963f, -0.07351f, 0.271483f, -0.123187f, 0.135836f, 0.290165f, 0.308406f, 0.080451f, 0.132922f, 0.309226f, 0.271448f, 0.008025f, -0.174487f, 0.109252f, 0.222976f, 0.205328f, 0.135184f, -0.29284f, -0.021769f, -0.187255f, -0.036963f, -0.09702f, 0.198222f, 0.029138f, 0.232285f, -0.212429f, 0.252991f, -0.088401f, 0.249707f, 0.008375f, 0.227109f, -0.08696f, -0.197819f, 0.139703f, 0.196183f, -0.14927f, -0.025785f, -0.115684f, 0.06505f, 0.196127f, -0.107764f, -0.056197f, 0.175255f, -0.310083f, 0.067883f, 0.148323f, -0.219312f, -0.037665f, 0.193162f, -0.090796f, -0.256963f, -0.239555f, -0.156752f, 0.230994f, -0.27505f, -0.183628f, -0.044457f, -0.14941f, -0.000314f, 0.32567f, -0.00388f, -0.159973f, 0.26415f, -0.096074f, 0.15178f, 0.112829f, 0.069757f, 0.133336f, -0.304471f, 0.003629f, -0.165672f, -0.128387f, -0.219582f, -0.164686f, -0.128049f, -0.197999f, 0.079291f, -0.235631f, 0.013275f, -0.019349f, 0.075558f, -0.110116f, 0.207544f, -0.263157f, 0.241139f, 0.246202f, -0.043995f, -0.040024f, -0.182259f, 0.095136f, 0.227099f, -0.171583f, 0.272891f, -0.304568f, -0.133966f, 0.107142f, 0.292375f, -0.083492f, 0.272253f, 0.227578f, 0.249003f, -0.189286f, 0.142205f, -0.270659f, -0.064482f, 0.07582f, -0.269318f, 0.287282f, -0.297795f, -0.269015f, -0.233389f, 0.141521f, -0.069211f, 0.033698f, 0.05651f, 0.137272f, 0.21678f, -0.184757f, 0.051613f, -0.00295f, -0.125078f, 0.053092f, -0.014366f, 0.040608f, -0.024137f, -0.001998f, -0.249613f, 0.194896f, -0.271393f, 0.056642f, -0.048308f, -0.168523f, -0.029107f, -0.054892f, 0.022634f, -0.156102f, 0.127615f, 0.226763f, 0.102525f, 0.22076f, -0.013384f, -0.307156f, 0.040639f, 0.307507f, -0.089307f, 0.29361f, -0.198887f, -0.265227f, -0.087031f, -0.090536f, -0.059068f, 0.007961f, -0.102173f, 0.20482f, -0.136729f, 0.038026f, 0.101018f, -0.057272f, -0.160548f, 0.167068f, -0.104184f, -0.166091f, 0.176337f, -0.024124f, 0.170349f, 0.127858f, -0.283964f, 0.15764f, -0.194274f, 0.108621f, -0.107597f, 0.021049f, 0.010181f, 0.229695f, -0.043698f, -0.303408f, 0.167613f, 0.050517f, 0.179884f, -0.054885f, 0.206904f, 0.29958f, -0.219252f, 0.282648f, -0.03439f, 0.140367f, -0.285063f, 0.155716f, -0.130014f, 0.115599f, -0.225038f, 0.184878f, -0.166837f, -0.019582f, -0.286024f, 0.130808f, -0.248106f, 0.112639f, -0.055965f, -0.037273f, -0.191085f, 0.122598f, -0.279941f, 0.291179f, 0.045058f, -0.216914f, 0.066938f, -0.01617f, 0.166372f, 0.083545f, -0.286186f, 0.243419f, 0.299503f, 0.141669f, -0.298367f, -0.055081f, 0.137152f, 0.251039f, 0.123639f, -0.087259f, -0.114684f, -0.294177f, 0.076689f, -0.067076f, 0.071901f, 0.264234f, -0.098969f, -0.085778f, -0.199018f, -0.278695f, -0.092355f, 0.202456f, 0.276745f, -0.053655f, 0.184576f, 0.279852f, 0.182203f, 0.288769f, -0.306141f, -0.238409f, 0.127049f, -0.037269f, -0.016477f, 0.012438f, 0.311375f, -0.011539f, 0.269675f, -0.255314f, 0.236198f, -0.087652f, 0.173267f, -0.107019f, 0.062939f, -0.243888f, -0.229652f, -0.234447f, 0.088698f, 0.062844f, -0.226004f, 0.061677f, -0.082081f, 0.051983f, 0.147593f, 0.219066f, -0.105865f, 0.00205f, -0.073437f, 0.282029f, 0.026362f, -0.238376f, 0.154946f, 0.119247f, -0.137849f, -0.188671f, 0.157236f, 0.263382f, 0.093344f, 0.176218f, 0.107387f, 0.287804f, -0.212008f, -0.131669f, -0.15195f, 0.285687f, 0.218777f, 0.161483f, -0.040678f, -0.13812f, 0.101817f, 0.290881f, 0.153536f, -0.050669f, 0.059477f, -0.295678f, 0.166303f, -0.205467f, -0.145426f, 0.090843f, -0.068791f, 0.123047f, -0.175602f, -0.22772f, -0.039042f, -0.178574f, -0.205423f, 0.230234f, 0.108729f, 0.172553f, 0.256737f, -0.299784f, -0.159726f, 0.272547f, -0.046657f, 0.255724f, 0.130773f, 0.115136f, -0.086206f, -0.04878f, 0.111863f, 0.152937f, -0.216281f, 0.233828f, 0.130015f, 0.246066f, -0.068279f, -0.237001f, -0.070252f, -0.228103f, -0.003946f, -0.255297f, 0.150429f, -0.099403f, -0.182798f, 0.154885f, -0.298248f, -0.278022f, 0.027589f, -0.267976f, 0.007088f, 0.305887f, -0.051284f, 0.109064f, -0.095868f, 0.200492f, 0.313525f, 0.162047f, 0.052721f, 0.280387f, 0.256751f, 0.17442f, 0.124757f, -0.275722f, 0.246114f, -0.286086f, 0.272222f, -0.002983f, 0.303536f, -0.271551f, -0.046402f, 0.233947f, -0.073478f, 0.272606f, -0.302506f, -0.096256f, -0.298998f, 0.106279f, -0.075176f, -0.234498f, -0.005387f, 0.042588f, 0.17935f, -0.072784f, 0.194843f, 0.170639f, 0.24253f, 0.114905f, -0.14776f, 0.282714f, 0.27106f, -0.265696f, -0.001059f, -0.274766f, 0.116409f, 0.085611f, -0.293388f, 0.205963f, -0.191952f, -0.251915f, -0.169658f, 0.190717f, -0.131229f, 0.243589f, -0.098578f, 0.087669f, 0.125726f, 0.286785f, 0.195673f, 0.214713f, -0.206828f, -0.253542f, -0.04223f, 0.028484f, -0.134934f, 0.052566f, 0.063444f, -0.086017f, 0.076209f, -0.071815f, -0.11248f, -0.165228f, -0.171105f, -0.29539f, -0.162764f, 0.118768f, 0.290421f, 0.212627f, -0.12151f, 0.232145f, 0.15113f, 0.003079f, -0.049839f, -0.28976f, 0.195441f, 0.290942f, 0.059471f, 0.085621f, -0.227241f, -0.071346f, -0.029469f, -0.216783f, 0.114375f, 0.270517f, 0.024722f, 0.241525f, 0.097153f, -0.021883f, 0.009018f, 0.125561f, -0.291186f, -0.119414f, 0.086094f, 0.096219f, -0.15141f, -0.165815f, 0.18073f, 0.078485f, -0.043409f, -0.246449f, 0.01389f, 0.157073f, -0.103805f, 0.231508f, -0.207817f, -0.227029f, -0.277404f, 0.214043f, -0.144683f, 0.145591f, -0.013927f, 0.180398f, 0.003433f, -0.253846f, -0.079969f, -0.046966f, -0.117092f, 0.022421f, -0.255627f, -0.087967f, 0.278963f, 0.292485f, -0.034172f, -0.047662f, -0.006778f, -0.010179f, -0.024762f, 0.122491f, 0.15268f, -0.249838f, -0.206939f, 0.029543f, 0.089131f, -0.103073f, 0.254959f, -0.250287f, 0.116086f, -0.217581f, 0.221605f, 0.03158f, 0.03877f, 0.0463f, 0.122585f, 0.259729f, 0.145029f, -0.137359f, -0.033222f, -0.066295f, 0.096239f, -0.068837f, -0.264204f, 0.270698f, -0.04618f, 0.260193f, 0.128253f, 0.246393f, 0.184971f, 0.091944f, -0.246167f, 0.196235f, 0.119972f, 0.297918f, -0.200632f, -0.270798f, 0.003353f, -0.097914f, 0.295373f, 0.14438f, -0.017547f, -0.206124f, -0.026367f, -0.005815f, -0.316528f, -0.133826f, -0.15612f, -0.082671f, -0.061399f, -0.12727f, -0.244682f, -0.216222f, 0.130616f, 0.267072f, -0.08353f, -0.20391f, -0.159933f, -0.225267f, -0.171556f, 0.112921f, -0.067631f, -0.170382f, 0.063796f, 0.24055f, -0.309905f, 0.063882f, 0.117773f, -0.058229f, 0.261454f, -0.188267f, -0.296779f, 0.228896f, -0.075339f, 0.186207f, 0.299878f, -0.216423f, 0.194683f, 0.178084f, 0.153027f, -0.048516f, 0.054271f, -0.135394f, -0.298562f, 0.129787f, -0.236469f, -0.132858f, -0.286888f, 0.059662f, 0.209405f, -0.268204f, -0.049174f, 0.220005f, 0.16196f, -0.189921f, -0.141947f, 0.064344f, -0.171685f, -0.110529f, 0.158158f, 0.05275f, -0.231017f, -0.068027f, -0.196323f, 0.045625f, 0.26582f, -0.009243f, 0.191134f, 0.101101f, -0.030611f, 0.272047f, 0.268939f, 0.281306f, 0.220052f, 0.164424f, 0.241012f, -0.194293f, 0.230502f, -0.008794f, -0.215895f, 0.008269f, -0.270221f, 0.233939f, -0.145627f, -0.138689f, -0.048475f, -0.202411f, 0.262036f, 0.112615f, 0.089601f, 0.26435f, -0.2245f, -0.16358f, 0.111037f, 0.11079f, 0.198841f, 0.160845f, -0.280488f, 0.055788f, 0.168732f, 0.246575f, 0.209893f, -0.171199f, -0.164086f, 0.081228f, -0.037295f, -0.068533f, 0.274465f, -0.175669f, 0.225915f, 0.068581f, 0.139412f, 0.17485f, -0.003768f, 0.279516f, -0.020373f, -0.148366f, 0.245712f, -0.017006f, 0.276312f, 0.009118f, -0.16785f, -0.090444f, 0.301664f, -0.174929f, -0.084943f, -0.127127f, 0.153493f, -0.143138f, 0.215314f, 0.267497f, -0.05054f, 0.006868f, 0.175793f, -0.034601f, -0.269776f, 0.012761f, 0.002226f, -0.049792f, -0.143369f, -0.145541f, 0.041697f, -0.222312f, -0.235243f, 0.011786f, -0.071746f, 0.162848f, -0.057363f, 0.252484f, -0.222402f, 0.237415f, -0.201671f, -0.181405f, -0.174279f, 0.159698f, -0.060671f, 0.198255f, 0.085547f, -0.240623f, -0.276432f, 0.072712f, 0.246239f, -0.181802f, -0.050677f, -0.269512f, -5e-06f, 0.20219f, -0.032251f, -0.038034f, -0.167082f, 0.024076f, 0.193464f, 0.040597f, -0.111132f, 0.169679f, -0.250168f, -0.267497f, -0.171472f, 0.009812f, -0.132043f, 0.116459f, 0.194765f, -0.125015f, 0.146258f, -0.170813f, 0.194187f, 0.249607f, -0.074978f, -0.263292f, -0.063866f, -0.093565f, 0.001121f, 0.016699f, 0.248881f, 0.056503f, -0.270408f, 0.110854f, 0.172369f, -0.196054f, -0.185561f, 0.255032f, 0.268082f, -0.247123f, 0.2494f, 0.322164f, -0.004345f, 0.194523f, -0.190406f, 0.007461f, -0.219235f, 0.106865f, -0.06061f, -0.221395f, -0.158934f, -0.245908f, -0.088984f, 0.194224f, -0.008717f, 0.090257f, 0.294524f, 0.104408f, -0.169532f, -0.273348f, 0.212281f, -0.118392f, 0.077096f, 0.238495f, 0.008547f, 0.027849f, -0.059238f, -0.00476f, 0.1071f, 0.056019f, 0.211511f, 0.315467f, -0.056609f, 0.308111f, 0.117597f };
+inline constexpr float layer_1_biases[32] = { 0.142593f, -0.048404f, 0.149518f, 0.217482f, 0.050105f, -0.236349f, 0.059351f, -0.181293f, -0.070347f, -0.014309f, 0.117896f, -0.057916f, 0.003164f, -0.233241f, 0.093942f, -0.271074f, -0.118808f, 0.11865f, -0.10215f, -0.302834f, -0.051373f, 0.085573f, 0.230264f, 0.235355f, -0.139103f, 0.26112f, -0.086464f, -0.292799f, -0.109623f, -0.211728f, -0.129011f, 0.053159f };
+inline constexpr float layer_2_weights[192] = { 0.058976f, -0.295091f, -0.084945f, 0.078768f, 0.039178f, 0.045697f, 0.33487f, 0.171562f, -0.149173f, -0.033122f, -0.33329f, -0.16334f, 0.33057f, 0.136235f, 0.408093f, -0.082649f, 0.009759f, 0.389494f, 0.080481f, -0.024955f, 0.202557f, 0.10495f, 0.362436f, 0.382093f, 0.233561f, -0.214923f, 0.084852f, 0.33764f, -0.398833f, -0.296643f, -0.042171f, 0.135486f, -0.311941f, -0.136282f, -0.37943f, 0.187686f, -0.253771f, 0.284574f, 0.066408f, 0.092005f, -0.266909f, -0.242158f, -0.14409f, 0.323051f, -0.294902f, 0.002561f, -0.185683f, 0.179826f, -0.159522f, 0.369259f, 0.027074f, -0.052541f, 0.224654f, -0.041956f, 0.274591f, 0.398144f, -0.150724f, 0.295761f, 0.162726f, -0.141583f, 0.373516f, 0.332456f, -0.135454f, 0.32641f, 0.191323f, 0.039227f, -0.187278f, -0.176665f, -0.109964f, 0.321137f, 0.0545f, 0.288644f, -0.216898f, 0.226395f, -0.384632f, 0.021541f, 0.316207f, -0.184146f, -0.04386f, 0.257829f, -0.364568f, -0.319374f, 0.072477f, 0.018257f, 0.239302f, 0.063582f, -0.348758f, 0.401761f, -0.394562f, -0.012629f, -0.012515f, 0.26562f, 0.156732f, -0.304612f, -0.042065f, -0.301983f, 0.35437f, 0.005127f, 0.060908f, -0.221299f, -0.346062f, -0.137244f, 0.289859f, 0.097976f, -0.137596f, 0.053024f, 0.208379f, 0.377497f, 0.384812f, 0.144605f, 0.274407f, -0.107438f, 0.253924f, 0.098089f, -0.007483f, -0.370002f, 0.069261f, 0.320686f, 0.226574f, 0.29818f, -0.006343f, -0.159731f, 0.323172f, 0.034688f, -0.170102f, 0.336816f, -0.267466f, 0.226766f, -0.204223f, 0.231192f, 0.065738f, 0.041218f, -0.032849f, -0.341485f, -0.060206f, -0.205889f, 0.413837f, 0.177515f, 0.167656f, 0.174405f, 0.056188f, 0.182122f, -0.269992f, 0.211403f, -0.378881f, -0.056661f, 0.068582f, -0.287849f, -0.218581f, -0.352753f, -0.340615f, -0.247364f, -0.340683f, -0.277272f, 0.068585f, -0.402071f, 0.020897f, -0.343155f, 0.124038f, -0.150781f, -0.064743f, -0.385281f, 0.320836f, 0.205273f, -0.37277f, 0.268567f, -0.015435f, -0.190072f, 0.021797f, 0.38245f, -0.065878f, -0.176941f, 0.061639f, -0.243302f, -0.02664f, -0.108746f, -0.077867f, 0.160226f, -0.325011f, 0.030103f, -0.221258f, -0.135867f, 0.053934f, 0.053746f, -0.06884f, 0.358565f, -0.310066f, -0.275749f, -0.043834f, -0.120104f, -0.024005f, 0.136528f };
+inline constexpr float layer_2_biases[6] = { 0.236087f, -0.316874f, 0.369539f, 0.253873f, -0.154083f, 0.222205f };
+
+using Model = eml::Sequential<
+    eml::Dense<600, 32, EmlNetActivationRelu>,
+    eml::Dense<32, 32, EmlNetActivationRelu>,
+    eml::Dense<32, 6, EmlNetActivationSoftmax>
+>;
+inline constexpr Model model { { layer_0_weights, layer_0_biases }, { layer_1_weights, layer_1_biases }, { layer_2_weights, layer_2_biases } };
+
+} // namespace mlp_perf_cpp
@@ -4,12 +4,12 @@ static const float mlp_wt__8___1e_05_layer_0_biases[8] = {-0.035470f, 0.113161f,
 static const float mlp_wt__8___1e_05_layer_0_weights[4800] = {0.023759f, 0.067777f, 0.033295f, 0.028666f, -0.040900f, 0.008360f, 0.003907f, 0.098493f, 0.092621f, -0.039591f, 0.050730f, 0.032121f, 0.028909f, 0.065514f, -0.117132f, -0.069205f, -0.094746f, 0.080619f, 0.047195f, 0.049465f, 0.115991f, 0.076889f, -0.027493f, 0.036915f, -0.069814f, 0.056414f, -0.081903f, 0.109446f, 0.023047f, -0.038237f, -0.074192f, 0.071913f, -0.021431f, -0.008192f, -0.097565f, 0.037432f, 0.033634f, 0.008095f, 0.116802f, 0.020428f, -0.041910f, -0.042502f, 0.040520f, -0.056393f, 0.023943f, 0.046080f, -0.038597f, -0.066516f, -0.020777f, -0.000085f, 0.028179f, 0.005725f, 0.071327f, -0.092529f, -0.044632f, -0.046602f, 0.029798f, -0.064241f, -0.014460f, -0.024267f, -0.052463f, -0.096488f, -0.000791f, -0.058795f, -0.063286f, -0.011738f, 0.053874f, -0.104374f, 0.087941f, -0.061807f, 0.076516f, -0.024951f, 0.105789f, 0.050000f, 0.036929f, -0.071523f, -0.022590f, -0.097076f, -0.067417f, -0.059708f, -0.044989f, -0.037715f, -0.085817f, 0.057835f, 0.019890f, -0.062245f, 0.032824f, -0.094825f, -0.008137f, 0.055322f, -0.036583f, 0.061670f, -0.078663f, 0.052628f, -0.022195f, -0.057168f, 0.034295f, -0.067674f, 0.080200f, -0.082201f, 0.009678f, -0.052960f, 0.055526f, 0.112532f, -0.050946f, 0.001215f, 0.010224f, 0.040931f, -0.039664f, 0.070775f, -0.042213f, 0.081966f, 0.032833f, -0.027809f, 0.047726f, -0.045385f, 0.096452f, 0.035803f, 0.060412f, 0.019617f, 0.060344f, 0.029786f, 0.081586f, 0.047124f, 0.005195f, -0.000836f, -0.121926f, -0.024812f, 0.028498f, -0.061037f, 0.027770f, 0.011681f, -0.072824f, -0.056372f, 0.040464f, 0.006115f, -0.009963f, 0.000541f, 0.028080f, 0.011683f, 0.077199f, -0.018795f, 0.007469f, 0.082320f, 0.080734f, 0.068523f, -0.064375f, 0.098086f, 0.016993f, 0.095200f, -0.066605f, 0.093845f, -0.065925f, 0.010095f, -0.082362f, 0.095650f, 0.077148f, -0.005680f, -0.049954f, -0.072546f, 0.028890f, -0.002774f, 0.028926f, 0.047910f, 0.115424f, 0.091837f, -0.109085f, -0.046244f, 0.067130f, -0.035439f, 0.001426f, -0.072388f, -0.039648f, -0.117851f, 0.032421f, -0.041814f, -0.026821f, 0.068433f, 0.054850f, -0.064928f, -0.076091f, 0.006783f, 0.035107f, -0.060990f, 0.061269f, -0.007235f, 0.003659f, 0.039227f, 0.048537f, -0.031072f, 0.000416f, -0.053139f, -0.041996f, 0.116638f, 0.062612f, 0.011653f, -0.079647f, -0.050829f, -0.089711f, 0.007645f, -0.033336f, 0.028238f, -0.031343f, -0.037239f, -0.077737f, -0.105654f, 0.004358f, 0.003285f, -0.008491f, 0.075058f, 0.082076f, -0.080735f, 0.053534f, -0.024072f, -0.101506f, 0.033149f, -0.012524f, 0.006730f, 0.027676f, 0.077581f, 0.044920f, 0.054818f, -0.070385f, 0.070601f, -0.052556f, 0.080255f, 0.056220f, -0.030586f, 0.070424f, 0.026920f, -0.045217f, -0.062061f, -0.021610f, -0.124209f, -0.061773f, 0.003113f, -0.017666f, -0.000940f, -0.023195f, 0.021093f, 0.093010f, -0.047240f, 0.018093f, -0.060402f, 0.017650f, -0.022124f, 0.007534f, -0.042345f, -0.063745f, -0.009870f, -0.035229f, 0.113798f, 0.069981f, 0.029478f, 0.049169f, -0.070919f, -0.008141f, 0.003869f, 0.076329f, -0.064465f, -0.030188f, -0.054402f, -0.096890f, 0.067329f, 0.057949f, 0.086554f, -0.031686f, 0.021430f, -0.068343f, -0.017409f, 0.070095f, 0.084146f, -0.018146f, 0.100043f, -0.033953f, 0.112312f, 0.063448f, 0.038542f, 0.016291f, 0.074126f, -0.066918f, 0.039191f, 0.021455f, -0.081853f, -0.017643f, -0.061394f, 0.115844f, 0.000950f, 0.020424f, 0.056873f, -0.011875f, -0.060350f, 0.038627f, -0.061861f, -0.004068f, -0.034308f, -0.070304f, 0.070434f, 0.087871f, 0.117723f, 0.098299f, 0.034263f, -0.063887f, -0.072456f, -0.038322f, -0.070558f, -0.088576f, -0.109945f, 0.066033f, -0.070434f, 0.060076f, -0.088050f, -0.058686f, -0.051730f, 0.045928f, -0.057362f, 0.001131f, 0.004021f, 0.047591f, 0.052486f, -0.029128f, -0.047869f, -0.069385f, -0.019090f, -0.073917f, -0.031227f, 0.019550f, 0.043942f, -0.069062f, -0.054027f, -0.062528f, 0.068605f, -0.072024f, 0.050408f, 0.073827f, 0.060577f, -0.026756f, 0.004300f, 0.031305f, -0.034274f, -0.050962f, -0.058985f, -0.013397f, -0.070132f, 0.071756f, -0.076487f, -0.001876f, -0.012363f, 0.032963f, 0.070853f, -0.001464f, -0.083182f, -0.034585f, -0.012760f, -0.008568f, 0.017460f, -0.023891f, -0.054792f, -0.012430f, 0.072913f, -0.036969f, 0.109966f, 0.020242f, -0.024741f, 0.090954f, -0.008621f, 0.021348f, -0.014852f, 0.098335f, 0.066738f, 0.058145f, -0.016153f, 0.023478f, 0.006667f, -0.072343f, -0.057712f, 0.036225f, 0.061121f, -0.003177f, 0.025021f, 0.091051f, 0.005873f, 0.104786f, 0.021572f, 0.084731f, 0.110491f, 0.076380f, -0.057844f, 0.000421f, -0.017215f, -0.089871f, 0.005113f, -0.033343f, 0.086577f, -0.097741f, 0.117026f, -0.011032f, -0.049181f, -0.126148f, -0.055227f, -0.040837f, 0.071716f, -0.095537f, 0.073095f, 0.089486f, -0.000973f, -0.026686f, -0.070827f, 0.048021f, -0.063183f, -0.084940f, -0.035820f, -0.072851f, -0.043973f, -0.077548f, -0.045147f, -0.054206f, -0.067202f, -0.058371f, 0.039736f, 0.066422f, 0.080300f, -0.040822f, -0.053702f, 0.009946f, -0.031823f, 0.107331f, -0.083778f, 0.077203f, -0.025426f, -0.041879f, 0.038329f, -0.029612f, 0.061583f, 0.017097f, -0.006553f, -0.014161f, -0.037077f, 0.041889f, 0.003114f, -0.011352f, 0.089135f, 0.080128f, -0.064532f, -0.035416f, -0.051072f, 0.032809f, 0.101910f, 0.071753f, 0.068744f, -0.056673f, 0.087500f, -0.037972f, -0.077183f, 0.096953f, -0.070767f, 0.062924f, -0.058312f, 0.056861f, 0.051856f, -0.034601f, -0.014646f, -0.045506f, 0.052636f, -0.032331f, -0.035237f, 0.007534f, -0.024109f, 0.039541f, -0.066194f, -0.023367f, 0.104310f, 0.016764f, 0.043259f, 0.102342f, 0.047602f, 0.061036f, 0.109915f, 0.101447f, -0.003865f, -0.064787f, -0.014075f, -0.055413f, -0.009233f, -0.098081f, 0.028217f, -0.018497f, 0.098405f, 0.110592f, 0.036897f, -0.048233f, 0.043856f, 0.096371f, -0.039760f, -0.019187f, -0.041738f, -0.030355f, -0.029140f, -0.066473f, -0.002220f, -0.030358f, -0.028650f, 0.011783f, 0.031940f, -0.008004f, 0.113495f, 0.082587f, -0.114447f, -0.041050f, 0.001511f, -0.096199f, -0.027075f, 0.067950f, 0.065893f, 0.041581f, 0.055334f, -0.086377f, -0.042508f, 0.010437f, 0.094668f, 0.007017f, -0.072603f, -0.075185f, 0.034732f, -0.076278f, -0.007668f, 0.003463f, 0.087979f, -0.061632f, 0.005429f, -0.080861f, -0.025663f, -0.000322f, -0.033995f, -0.049183f, -0.056640f, 0.033887f, 0.068042f, 0.031547f, 0.114627f, -0.081529f, 0.007700f, -0.009446f, 0.019646f, 0.070472f, -0.102444f, 0.022252f, 0.066938f, 0.003847f, -0.039665f, 0.062602f, -0.097853f, 0.013115f, 0.032874f, 0.048727f, -0.106221f, -0.048544f, -0.003616f, 0.012500f, 0.081555f, 0.044201f, -0.042687f, 0.112537f, 0.086361f, -0.027096f, 0.075758f, -0.016989f, 0.107483f, 0.070133f, 0.064069f, 0.102574f, -0.103234f, -0.043169f, -0.006465f, 0.083425f, -0.037966f, -0.048223f, 0.095539f, 0.002932f, 0.085013f, -0.091899f, 0.044074f, -0.000373f, -0.064602f, 0.058121f, -0.020315f, -0.093310f, -0.061988f, -0.070227f, 0.059173f, 0.018311f, 0.080115f, 0.012908f, 0.003408f, -0.055960f, 0.110021f, -0.030802f, -0.014863f, -0.022001f, 0.077471f, -0.041040f, -0.005801f, 0.045514f, -0.111656f, 0.024782f, 0.011259f, -0.040045f, -0.044898f, 0.023714f, 0.003923f, 0.008344f, -0.020647f, 0.065978f, -0.078341f, -0.105773f, -0.006878f, 0.027031f, 0.003512f, -0.001387f, 0.085251f, -0.007957f, 0.057407f, 0.018735f, 0.062329f, 0.113038f, 0.092168f, 0.065958f, 0.041423f, -0.056889f, -0.056021f, -0.072901f, -0.031923f, 0.005964f, 0.034421f, 0.053069f, 0.116641f, -0.059550f, -0.100197f, -0.011550f, 0.049116f, 0.047893f, 0.088932f, 0.078618f, -0.004380f, -0.031780f, -0.080700f, 0.036435f, 0.013264f, 0.092490f, -0.052617f, 0.008742f, -0.008581f, -0.049480f, -0.048948f, 0.093982f, -0.079476f, 0.015159f, -0.046169f, 0.008452f, 0.106293f, -0.042505f, 0.067899f, -0.102071f, -0.020971f, -0.006581f, -0.046868f, 0.054646f, -0.046659f, 0.064011f, 0.039437f, -0.030147f, -0.015375f, 0.040252f, -0.077299f, 0.077220f, 0.030623f, 0.020933f, 0.022916f, -0.061545f, 0.000281f, 0.000742f, -0.005787f, -0.094140f, 0.072751f, -0.061718f, -0.001193f, 0.010976f, 0.026897f, 0.069989f, -0.072397f, 0.055252f, -0.075395f, -0.004385f, -0.030867f, 0.002476f, -0.044671f, -0.049927f, -0.069865f, 0.012295f, 0.043630f, -0.024532f, -0.037305f, -0.054562f, -0.073186f, -0.034259f, -0.049344f, -0.029678f, -0.076030f, -0.113458f, 0.069933f, -0.093495f, 0.036229f, 0.069499f, -0.034611f, -0.048584f, -0.076800f, 0.008447f, 0.016464f, -0.041224f, 0.052177f, 0.066365f, 0.082091f, -0.080764f, 0.076995f, -0.045238f, 0.092093f, 0.055225f, 0.115775f, 0.071065f, 0.002430f, -0.000302f, 0.001165f, -0.011842f, -0.069982f, -0.030187f, 0.036156f, -0.065400f, 0.015604f, -0.094010f, -0.047603f, -0.103741f, 0.080732f, -0.102974f, -0.081682f, 0.020564f, -0.060373f, 0.083932f, 0.019315f, 0.092156f, 0.020026f, -0.010057f, 0.019509f, 0.106721f, 0.034098f, -0.029189f, 0.084361f, -0.052357f, -0.097725f, -0.076824f, -0.012004f, 0.088138f, -0.033444f, 0.009190f, -0.050601f, 0.097734f, 0.098950f, 0.085462f, -0.034501f, 0.105870f, 0.043605f, 0.047135f, -0.054091f, -0.080063f, -0.048293f, 0.102559f, -0.022142f, 0.010200f, 0.027690f, 0.054871f, 0.094233f, -0.057693f, -0.037089f, 0.038729f, 0.063189f, -0.100091f, -0.054140f, -0.057157f, -0.063128f, -0.030292f, -0.091481f, 0.007382f, -0.068060f, 0.007171f, -0.060216f, 0.101883f, 0.061758f, -0.023041f, -0.032039f, -0.019901f, 0.006479f, -0.070269f, 0.057523f, -0.001070f, -0.015769f, 0.034796f, 0.044868f, 0.063268f, -0.005642f, 0.096723f, 0.028815f, -0.007999f, 0.005531f, -0.019515f, 0.084803f, -0.090048f, -0.070183f, -0.051696f, -0.041097f, 0.059496f, 0.000441f, -0.026048f, -0.080011f, 0.004839f, -0.068101f, -0.038490f, 0.114325f, -0.057015f, 0.097126f, 0.072911f, -0.090273f, -0.008367f, -0.076523f, 0.024265f, 0.044362f, 0.043420f, 0.017821f, 0.065850f, -0.103755f, -0.049283f, 0.025153f, -0.032159f, -0.058070f, -0.071505f, 0.038902f, -0.007675f, 0.095839f, 0.075912f, -0.008311f, -0.004043f, 0.030513f, 0.094592f, 0.054887f, -0.124732f, 0.043813f, 0.056072f, 0.065283f, -0.045874f, -0.027803f, -0.051006f, -0.047002f, 0.109684f, 0.094556f, -0.056379f, -0.047435f, 0.027958f, 0.066378f, -0.061983f, -0.054622f, 0.050717f, 0.018590f, 0.099836f, -0.044040f, 0.025876f, -0.006539f, -0.037247f, 0.015488f, -0.002328f, -0.050778f, 0.053088f, 0.045632f, 0.024292f, -0.022477f, -0.003342f, 0.079835f, 0.041253f, -0.045671f, 0.043577f, 0.029504f, -0.089048f, 0.067015f, -0.006134f, -0.026814f, -0.013489f, 0.033994f, 0.053449f, 0.008946f, 0.093890f, 0.052239f, -0.002167f, -0.009613f, 0.035560f, -0.023386f, -0.084729f, -0.064362f, 0.093457f, 0.058952f, -0.055028f, -0.052009f, -0.041387f, -0.065732f, 0.065980f, -0.106197f, 0.098395f, -0.107529f, 0.071540f, 0.005872f, -0.049703f, -0.010255f, 0.072453f, -0.018583f, 0.050506f, 0.030905f, -0.004192f, 0.105859f, 0.019819f, 0.042675f, 0.015443f, -0.092476f, 0.033373f, -0.035336f, 0.061158f, -0.066193f, -0.051286f, -0.094804f, -0.017115f, 0.046491f, -0.058994f, -0.086947f, -0.029228f, 0.038272f, -0.075289f, -0.033141f, -0.056536f, 0.049773f, 0.000122f, -0.011245f, 0.060977f, -0.026451f, 0.019223f, 0.070683f, -0.083264f, 0.117040f, -0.048048f, -0.064714f, -0.043496f, -0.050119f, 0.019363f, 0.014941f, 0.056506f, 0.057519f, -0.059017f, -0.003864f, -0.083863f, -0.016089f, -0.058714f, -0.014643f, 0.018542f, 0.063756f, -0.066475f, 0.102169f, 0.045001f, -0.037976f, 0.093879f, -0.020750f, 0.069881f, -0.061312f, -0.013976f, -0.019473f, -0.057995f, 0.042790f, 0.065231f, 0.044936f, 0.030288f, -0.005034f, 0.064327f, -0.027804f, 0.077836f, 0.042277f, -0.060854f, 0.075359f, -0.067975f, -0.026513f, -0.032875f, 0.027044f, 0.064723f, -0.074636f, -0.022914f, 0.096252f, -0.078059f, 0.057808f, 0.037828f, -0.118552f, 0.014660f, 0.021641f, -0.067104f, 0.086031f, -0.010178f, -0.114934f, -0.064439f, 0.061393f, 0.004954f, -0.086376f, -0.065597f, 0.013430f, -0.072667f, 0.000352f, 0.016901f, -0.024839f, 0.015490f, 0.076766f, -0.048245f, 0.002274f, -0.001740f, 0.087568f, 0.034285f, 0.092483f, -0.021100f, -0.037837f, 0.079626f, -0.089732f, -0.021825f, -0.102161f, 0.068149f, 0.062166f, 0.046369f, -0.053899f, -0.052618f, -0.024757f, -0.045244f, 0.013683f, -0.050382f, -0.011444f, 0.042952f, 0.049728f, -0.120258f, -0.003800f, 0.008967f, 0.092506f, 0.014583f, 0.074424f, -0.028034f, -0.117054f, 0.020389f, -0.037652f, 0.049578f, -0.075562f, -0.051574f, 0.029130f, 0.028655f, 0.003376f, 0.017331f, 0.000890f, -0.075361f, -0.079333f, 0.021140f, -0.057489f, -0.091794f, 0.119101f, 0.073386f, -0.090415f, -0.128723f, 0.085768f, -0.065189f, -0.038422f, 0.018822f, -0.053165f, -0.065842f, 0.078022f, 0.009791f, -0.011728f, -0.040608f, 0.023226f, -0.069242f, 0.068721f, 0.068336f, 0.045598f, -0.062074f, 0.048430f, 0.102824f, 0.029097f, -0.011102f, -0.071608f, 0.025023f, 0.087319f, -0.095649f, 0.073507f, -0.076037f, 0.077438f, 0.040168f, -0.010644f, -0.016863f, 0.096165f, -0.062285f, 0.042044f, 0.079832f, 0.027693f, -0.011843f, -0.093672f, -0.028840f, -0.008243f, -0.035756f, 0.002475f, -0.009494f, -0.042461f, -0.014738f, -0.020360f, 0.004422f, -0.113238f, 0.051161f, 0.060435f, -0.010891f, 0.094552f, 0.072688f, -0.053122f, 0.006668f, 0.082264f, 0.077320f, 0.005254f, -0.094460f, -0.015103f, -0.097225f, -0.084011f, 0.087953f, -0.011187f, 0.056204f, -0.034961f, 0.109603f, 0.068804f, -0.015916f, 0.061129f, -0.103381f, -0.009939f, -0.066881f, 0.058298f, -0.058695f, -0.031903f, -0.028579f, -0.020360f, -0.006139f, 0.051770f, -0.111123f, 0.002950f, -0.071681f, -0.074491f, 0.043164f, 0.081047f, -0.059727f, 0.062605f, -0.055009f, 0.044202f, 0.068384f, -0.045053f, -0.018436f, 0.104953f, -0.080353f, -0.116291f, -0.011558f, -0.015697f, 0.037755f, 0.109380f, -0.058888f, 0.001678f, -0.022267f, 0.000603f, 0.074990f, 0.024581f, -0.042693f, -0.078542f, 0.089690f, -0.096695f, 0.041903f, 0.107173f, 0.061470f, -0.006692f, -0.039272f, -0.003865f, 0.059064f, 0.032212f, 0.059544f, 0.084828f, 0.056265f, 0.103261f, -0.023647f, -0.031996f, -0.009901f, -0.010083f, 0.057055f, -0.032115f, -0.113567f, -0.044147f, -0.057031f, 0.061644f, 0.060130f, 0.064446f, 0.007177f, -0.036878f, 0.033676f, 0.080159f, -0.061539f, 0.081560f, -0.095622f, 0.089981f, 0.057999f, -0.109380f, -0.004304f, -0.002773f, -0.087437f, -0.044095f, 0.035640f, 0.036788f, 0.076279f, 0.078666f, 0.075379f, -0.089736f, 0.066214f, -0.082240f, -0.007185f, 0.026765f, -0.060050f, 0.035906f, -0.033657f, -0.069972f, -0.055789f, -0.006920f, -0.080449f, -0.013155f, 0.007163f, -0.007184f, -0.083157f, -0.065640f, -0.023248f, -0.067840f, 0.104881f, -0.091836f, 0.084305f, 0.027091f, -0.005441f, -0.021844f, 0.074354f, -0.052631f, 0.039932f, 0.007015f, -0.043911f, 0.082372f, 0.043758f, -0.058128f, 0.001456f, 0.075583f, 0.033416f, 0.110004f, -0.052195f, 0.031500f, -0.037601f, 0.011007f, 0.068347f, 0.121412f, 0.053674f, -0.005237f, 0.057187f, 0.010155f, -0.037649f, -0.105625f, 0.032764f, -0.030963f, 0.058008f, 0.024791f, 0.058097f, -0.016834f, 0.088516f, 0.018270f, 0.014922f, 0.054840f, -0.077163f, -0.078053f, -0.066729f, 0.108619f, -0.067076f, -0.012656f, -0.068192f, -0.032883f, -0.024386f, 0.065768f, 0.092162f, -0.013205f, -0.115178f, 0.041542f, 0.012296f, -0.094086f, 0.081216f, -0.079294f, 0.049837f, -0.050355f, 0.011626f, 0.076417f, 0.052632f, 0.103841f, 0.018448f, -0.052459f, 0.070778f, 0.034066f, 0.012397f, -0.092421f, -0.042921f, -0.039499f, 0.046455f, 0.061944f, 0.056162f, 0.074955f, 0.029768f, 0.085371f, 0.001870f, -0.123269f, -0.095099f, -0.056014f, 0.065211f, 0.095490f, 0.120303f, -0.077828f, -0.070465f, 0.100685f, -0.020861f, 0.011706f, 0.070427f, -0.006813f, 0.041973f, 0.001093f, 0.074364f, 0.007444f, -0.041807f, -0.068860f, -0.024473f, 0.016762f, 0.017080f, 0.065161f, 0.018893f, 0.031585f, -0.083176f, -0.019055f, -0.040152f, 0.026691f, -0.015878f, -0.021218f, -0.011798f, 0.075052f, 0.009523f, -0.056749f, -0.090400f, -0.044499f, 0.023198f, 0.033538f, 0.019061f, 0.080017f, -0.058860f, 0.030931f, -0.011359f, 0.029460f, 0.065011f, -0.056433f, 0.037343f, 0.000591f, 0.017738f, 0.029804f, 0.090086f, -0.069336f, -0.041313f, 0.059467f, -0.062951f, 0.019496f, -0.037833f, -0.045391f, 0.014691f, -0.080043f, 0.086627f, 0.009563f, 0.021385f, 0.010685f, 0.038350f, -0.054650f, -0.055649f, -0.025532f, -0.088972f, -0.012907f, -0.055827f, 0.067609f, 0.075022f, 0.035543f, 0.000390f, 0.085260f, 0.101762f, 0.070642f, -0.020823f, -0.017385f, -0.065257f, 0.025287f, 0.090011f, 0.063486f, -0.105696f, -0.098240f, 0.058565f, 0.034669f, -0.074762f, 0.055063f, 0.008748f, -0.093474f, -0.074320f, -0.099197f, -0.078539f, -0.104121f, -0.058596f, 0.011877f, -0.086686f, -0.056413f, -0.043919f, -0.027895f, -0.020610f, -0.035855f, 0.067559f, 0.097718f, -0.018647f, 0.101914f, -0.005613f, -0.057677f, 0.002699f, -0.037606f, 0.007395f, 0.007044f, 0.015850f, 0.097333f, 0.053721f, 0.016087f, -0.021698f, -0.095566f, -0.038141f, 0.056971f, -0.065620f, -0.090633f, 0.106032f, 0.059574f, 0.038461f, 0.063078f, 0.060943f, 0.024767f, 0.067575f, 0.064757f, -0.075492f, 0.017753f, -0.010576f, 0.035075f, 0.073930f, -0.018911f, 0.076526f, 0.061733f, -0.035447f, 0.051742f, 0.032626f, 0.004469f, -0.032790f, -0.085441f, 0.037549f, 0.090778f, -0.067335f, 0.036993f, 0.007589f, 0.086864f, -0.017764f, -0.006769f, -0.022449f, -0.057481f, 0.058983f, 0.086029f, -0.067398f, -0.039165f, -0.083897f, 0.066268f, 0.056782f, 0.103593f, -0.015776f, 0.035903f, -0.044555f, -0.050153f, -0.042069f, 0.051578f, -0.050764f, 0.066881f, 0.121172f, -0.075251f, -0.045925f, -0.076291f, -0.096360f, -0.025841f, -0.019257f, 0.049343f, -0.085664f, -0.004436f, 0.078093f, 0.060915f, 0.049463f, 0.029204f, 0.076866f, 0.000657f, -0.118128f, -0.070875f, -0.039655f, -0.010492f, 0.057653f, -0.042563f, 0.045768f, 0.080098f, -0.007501f, 0.103799f, 0.048123f, 0.076178f, 0.028686f, 0.046117f, 0.028387f, 0.095282f, -0.051480f, 0.031861f, 0.005198f, 0.085461f, -0.071480f, 0.071221f, 0.098145f, -0.072921f, -0.022772f, 0.019025f, 0.027828f, 0.061202f, 0.041525f, -0.014738f, -0.023105f, 0.026882f, -0.046494f, -0.042723f, 0.010470f, -0.043350f, 0.067083f, 0.045567f, -0.039004f, 0.052038f, 0.029937f, 0.096260f, 0.067906f, 0.010812f, -0.079339f, 0.086085f, -0.104450f, -0.043226f, 0.055100f, 0.081138f, 0.007314f, 0.007187f, -0.086741f, -0.022590f, 0.014032f, -0.009418f, -0.056844f, -0.045376f, -0.010557f, -0.020958f, 0.035391f, 0.042202f, -0.061589f, -0.019571f, -0.076420f, -0.071016f, -0.029912f, 0.048173f, 0.031464f, 0.028743f, 0.076932f, 0.083047f, 0.026367f, 0.070926f, 0.059900f, -0.000240f, -0.000686f, -0.068141f, 0.076296f, -0.086804f, 0.073270f, 0.081898f, -0.011600f, -0.066849f, -0.084075f, 0.077954f, -0.018478f, 0.025512f, 0.051733f, -0.072652f, 0.086684f, 0.010262f, -0.038803f, 0.105826f, 0.083922f, -0.065959f, 0.002496f, -0.088101f, 0.009522f, 0.035101f, 0.041293f, -0.042056f, -0.017910f, 0.000940f, 0.046770f, 0.084121f, 0.101872f, -0.103317f, -0.046492f, -0.078982f, -0.086273f, -0.015999f, 0.021175f, 0.045838f, 0.062474f, 0.076960f, 0.102193f, 0.007310f, 0.092088f, 0.067794f, -0.053620f, 0.050388f, -0.110032f, -0.114286f, -0.063332f, 0.019197f, 0.004762f, -0.093058f, 0.060057f, 0.078109f, -0.049498f, -0.026589f, 0.000340f, 0.019097f, 0.050376f, 0.075019f, 0.028471f, -0.086234f, 0.067018f, -0.058320f, -0.047773f, -0.051605f, -0.067592f, 0.007437f, 0.005206f, -0.015324f, 0.071059f, -0.081016f, 0.057214f, 0.047765f, 0.018038f, 0.013288f, 0.048154f, -0.006060f, 0.026002f, -0.035427f, -0.003817f, 0.037111f, -0.106209f, -0.051736f, 0.090331f, 0.073896f, -0.029194f, -0.025581f, 0.088752f, 0.038021f, 0.046145f, -0.042400f, -0.103626f, -0.037970f, 0.015269f, 0.052957f, 0.051583f, -0.063246f, -0.073524f, -0.046174f, -0.036061f, 0.078404f, 0.065641f, -0.009037f, 0.093051f, -0.041932f, 0.070001f, -0.092175f, -0.097955f, 0.036500f, -0.069215f, 0.040642f, -0.007314f, 0.062331f, 0.084269f, 0.058779f, 0.040379f, -0.101759f, -0.057763f, -0.025756f, -0.011575f, -0.079315f, -0.032336f, 0.110302f, -0.011741f, -0.021259f, -0.088068f, 0.047201f, -0.054016f, -0.060007f, -0.073901f, 0.090662f, -0.037190f, 0.079080f, 0.073874f, 0.083067f, -0.072944f, -0.081423f, 0.071649f, -0.047085f, -0.053170f, -0.090558f, -0.083887f, -0.013243f, -0.096101f, -0.005650f, -0.037216f, -0.108860f, 0.003620f, -0.062353f, 0.010783f, 0.050250f, 0.061118f, -0.054486f, 0.010187f, 0.050985f, -0.083108f, 0.049250f, 0.087287f, 0.088009f, -0.066419f, -0.080945f, -0.052994f, -0.038452f, -0.006126f, -0.031611f, 0.020590f, -0.057316f, -0.063475f, -0.063264f, 0.082110f, 0.112739f, -0.028838f, 0.064734f, -0.038213f, 0.054297f, -0.054353f, 0.032306f, -0.107834f, 0.106911f, 0.061446f, 0.087839f, 0.024961f, -0.007042f, 0.027128f, -0.019558f, 0.017245f, 0.065251f, -0.071716f, -0.089654f, -0.032211f, -0.042626f, -0.103164f, 0.098245f, 0.031390f, -0.005782f, 0.120926f, -0.066484f, 0.064664f, -0.062443f, -0.027527f, -0.026846f, 0.046954f, -0.085730f, 0.036650f, 0.028546f, -0.077183f, 0.088594f, 0.039702f, 0.096782f, 0.059619f, 0.020370f, 0.037665f, -0.052465f, -0.010246f, -0.068324f, 0.098173f, -0.080569f, -0.090595f, -0.013116f, 0.029920f, -0.086664f, 0.013955f, 0.053464f, 0.044685f, 0.024534f, 0.065418f, 0.098883f, 0.086399f, 0.041308f, 0.009165f, -0.100005f, 0.023762f, 0.071938f, 0.086466f, -0.017556f, -0.073651f, 0.032111f, 0.029977f, 0.088038f, 0.055917f, 0.040880f, -0.101730f, -0.017900f, -0.011522f, 0.021058f, -0.028229f, 0.054384f, 0.067671f, -0.007674f, 0.008583f, -0.028351f, 0.050768f, -0.066558f, 0.050138f, 0.119923f, -0.048754f, -0.043118f, 0.049870f, 0.064291f, -0.030972f, 0.013639f, -0.076417f, -0.031051f, -0.072079f, -0.061759f, -0.037253f, 0.010345f, 0.115019f, -0.056635f, -0.022146f, 0.002327f, 0.087130f, -0.071832f, 0.057916f, -0.083833f, 0.018506f, 0.010858f, -0.045894f, -0.035011f, -0.006475f, 0.047372f, 0.113590f, 0.018232f, 0.072963f, -0.002837f, -0.048290f, -0.063458f, -0.035778f, 0.034317f, -0.112961f, -0.085069f, 0.045081f, -0.035825f, 0.077428f, -0.053458f, -0.078640f, -0.053699f, 0.075117f, -0.089713f, -0.100811f, 0.066839f, -0.037747f, 0.059351f, 0.081230f, 0.037212f, 0.102933f, 0.050511f, -0.105846f, 0.003617f, 0.024244f, 0.034631f, -0.089325f, 0.017104f, 0.070056f, 0.070240f, 0.032131f, -0.002036f, 0.003023f, 0.020566f, 0.077189f, 0.025538f, 0.052027f, 0.031800f, -0.063098f, 0.020028f, -0.030400f, -0.048945f, -0.025921f, -0.061963f, 0.038705f, 0.051252f, -0.042450f, -0.097912f, -0.105736f, 0.014265f, -0.080810f, -0.067743f, 0.062573f, -0.007396f, -0.056225f, 0.087318f, 0.105525f, -0.030849f, -0.090364f, -0.046855f, -0.035686f, 0.063697f, -0.094172f, 0.057990f, -0.085212f, 0.015995f, 0.047165f, -0.071546f, 0.035178f, 0.097358f, -0.096159f, 0.037690f, 0.002802f, -0.086639f, -0.093531f, -0.123979f, 0.011660f, 0.109021f, 0.058482f, 0.048535f, -0.011240f, -0.002992f, -0.084729f, 0.078632f, 0.026870f, 0.088212f, -0.017224f, -0.034395f, -0.062118f, 0.083802f, 0.058726f, -0.091447f, 0.033484f, -0.002093f, -0.061206f, -0.091507f, 0.074262f, -0.037841f, 0.069371f, -0.054602f, -0.030176f, -0.088381f, -0.074385f, 0.030350f, -0.068460f, 0.019808f, 0.040404f, -0.035079f, 0.075171f, 0.032047f, -0.061008f, 0.033777f, 0.057161f, -0.006617f, -0.006341f, -0.012250f, 0.035523f, 0.088444f, -0.093301f, 0.066466f, -0.112466f, 0.009305f, -0.012681f, 0.031289f, 0.049134f, 0.016950f, 0.058547f, 0.005972f, 0.049612f, -0.022920f, -0.008192f, -0.044248f, -0.003997f, -0.051279f, 0.038562f, -0.045805f, -0.055134f, -0.027277f, -0.011365f, -0.071214f, -0.050230f, -0.076250f, -0.081980f, -0.069612f, -0.025134f, 0.047031f, -0.023197f, 0.109922f, -0.114737f, -0.078218f, -0.010780f, 0.035538f, 0.076801f, -0.055713f, -0.044586f, -0.057685f, 0.051097f, -0.034676f, -0.002706f, 0.087369f, -0.088101f, -0.043396f, 0.073644f, 0.076370f, 0.065785f, 0.015953f, 0.067112f, -0.028884f, 0.001898f, -0.107581f, -0.013877f, 0.017532f, -0.046673f, 0.108938f, 0.067217f, -0.036856f, 0.039644f, -0.099652f, 0.080066f, -0.082635f, 0.061325f, -0.061982f, 0.074642f, -0.079500f, -0.036446f, 0.036748f, 0.009803f, -0.101673f, 0.001790f, -0.009211f, 0.029265f, 0.009412f, 0.050485f, 0.002163f, -0.039498f, -0.041152f, 0.038152f, 0.027704f, 0.002425f, 0.024280f, 0.037598f, -0.094015f, -0.091959f, -0.006737f, 0.006455f, -0.012205f, 0.026223f, 0.054186f, 0.008440f, -0.045134f, 0.087543f, 0.030710f, 0.059509f, 0.048650f, 0.065346f, -0.049199f, 0.022718f, -0.045361f, -0.016987f, -0.080282f, -0.025740f, 0.109651f, -0.010982f, -0.045414f, 0.001680f, -0.063528f, -0.020495f, 0.075034f, -0.078278f, -0.027910f, 0.045522f, 0.028895f, 0.106561f, 0.021666f, 0.051169f, 0.067558f, 0.005868f, -0.013070f, -0.072450f, -0.086366f, -0.069111f, -0.060007f, 0.032780f, 0.036648f, 0.010914f, 0.049102f, -0.033925f, -0.013484f, 0.043960f, -0.049274f, -0.091096f, 0.016757f, 0.069034f, -0.026266f, -0.039668f, 0.087798f, 0.039259f, 0.001323f, -0.061568f, 0.073060f, 0.052615f, 0.091068f, -0.083481f, -0.085340f, 0.026730f, -0.074997f, -0.060830f, -0.062645f, 0.068146f, 0.028238f, -0.059889f, -0.002441f, 0.021046f, -0.006593f, -0.001433f, -0.044467f, 0.044449f, -0.001453f, 0.066075f, 0.115570f, -0.002113f, 0.060389f, -0.094340f, -0.117949f, 0.040762f, -0.021742f, -0.030043f, -0.064962f, -0.052613f, 0.048283f, -0.003745f, 0.086906f, 0.043231f, 0.053751f, 0.001598f, 0.005887f, 0.085279f, 0.003836f, -0.080508f, 0.038203f, -0.040168f, 0.090018f, -0.096965f, 0.013232f, 0.054875f, -0.013653f, 0.111191f, 0.087382f, 0.093052f, -0.089144f, -0.013051f, -0.049953f, 0.051849f, 0.013281f, 0.010944f, -0.103508f, 0.013069f, 0.046384f, 0.121028f, 0.021311f, 0.076906f, 0.078538f, 0.013623f, 0.012749f, -0.031323f, 0.063705f, -0.069899f, -0.056876f, -0.067278f, 0.034755f, -0.028383f, 0.002137f, 0.043436f, -0.006933f, 0.027869f, 0.010139f, 0.071552f, 0.017554f, 0.005776f, -0.056345f, 0.067539f, -0.008538f, 0.077488f, -0.067478f, -0.017200f, -0.076810f, -0.043214f, 0.087781f, 0.013619f, -0.017330f, -0.091627f, 0.084234f, 0.102181f, -0.027558f, -0.074520f, 0.021999f, 0.099277f, 0.086914f, -0.009764f, -0.048437f, -0.050974f, 0.069502f, 0.001249f, -0.100323f, -0.045220f, -0.024394f, -0.044231f, -0.003282f, 0.066374f, 0.021268f, -0.101472f, -0.085498f, -0.068969f, -0.041286f, 0.078930f, 0.112663f, -0.010759f, 0.020051f, 0.101607f, 0.023524f, 0.049822f, -0.068109f, -0.012021f, 0.064540f, -0.074901f, 0.071295f, 0.022714f, 0.002963f, -0.016419f, -0.005352f, 0.058702f, 0.025408f, -0.076738f, 0.025645f, -0.015517f, 0.121934f, -0.053282f, -0.050791f, -0.021755f, 0.006912f, 0.088874f, -0.035552f, -0.027649f, 0.032269f, -0.000177f, -0.006033f, 0.037452f, 0.074610f, -0.020593f, 0.031500f, 0.062337f, -0.023490f, -0.036458f, 0.047136f, 0.047599f, 0.083439f, -0.105416f, 0.069865f, -0.009902f, -0.082474f, -0.055316f, 0.030481f, 0.021734f, 0.115297f, -0.003980f, -0.052144f, 0.066983f, -0.015783f, 0.058939f, 0.076421f, 0.058206f, -0.032534f, -0.089302f, 0.020266f, 0.063395f, 0.013264f, 0.059474f, -0.012965f, 0.038183f, 0.088057f, 0.006424f, -0.110074f, 0.098572f, -0.020532f, 0.032179f, -0.000644f, 0.012167f, -0.058237f, 0.054656f, -0.048049f, 0.110959f, 0.084665f, 0.014996f, -0.011490f, -0.068389f, -0.009462f, 0.058819f, -0.046482f, 0.002298f, -0.079983f, -0.028265f, -0.042076f, 0.128268f, 0.017320f, 0.029648f, -0.090819f, -0.043472f, 0.092672f, -0.106978f, -0.080563f, 0.049039f, 0.044312f, 0.077990f, 0.068115f, -0.068278f, -0.073092f, 0.008284f, -0.083474f, -0.060965f, -0.070940f, -0.017542f, -0.043472f, 0.060276f, -0.005748f, 0.062446f, 0.080952f, 0.001645f, -0.034580f, -0.050478f, 0.026011f, -0.042146f, 0.006214f, -0.013717f, 0.015623f, 0.118503f, -0.060546f, -0.018449f, -0.018166f, -0.014701f, -0.063279f, -0.020489f, 0.079524f, -0.065660f, -0.035379f, 0.072060f, 0.047129f, 0.005221f, 0.027741f, -0.071047f, 0.012169f, -0.044947f, -0.050377f, -0.087819f, -0.037755f, -0.040504f, 0.104360f, -0.071236f, -0.019585f, 0.086070f, 0.082647f, 0.059786f, -0.060956f, 0.001610f, -0.087618f, -0.039234f, 0.002895f, 0.072027f, -0.010790f, 0.064309f, 0.074261f, -0.106031f, 0.042521f, 0.000178f, 0.078713f, -0.087340f, 0.017384f, -0.071181f, -0.117626f, 0.019628f, 0.084095f, 0.044499f, -0.090353f, 0.003902f, -0.098333f, -0.039281f, -0.032013f, -0.044608f, -0.015926f, -0.037522f, 0.093257f, -0.054699f, 0.068289f, -0.079286f, 0.057353f, -0.085541f, -0.034809f, -0.094837f, 0.080641f, 0.120500f, -0.090379f, 0.069521f, 0.044896f, -0.045120f, 0.097455f, -0.064822f, -0.032158f, -0.055847f, 0.051152f, -0.084522f, -0.022183f, 0.038633f, 0.038593f, -0.046907f, 0.066094f, 0.068457f, -0.003601f, 0.006062f, -0.069227f, 0.009639f, 0.005093f, 0.052196f, -0.049631f, 0.016843f, -0.017848f, 0.057359f, -0.077899f, -0.082679f, 0.079342f, -0.028825f, 0.022655f, -0.070163f, 0.081088f, 0.086013f, 0.053711f, -0.085247f, -0.008181f, 0.101283f, 0.036412f, -0.092517f, -0.017906f, 0.077180f, 0.014697f, -0.093131f, -0.003692f, -0.042623f, -0.060945f, 0.011806f, 0.012980f, -0.112579f, 0.003118f, -0.014912f, 0.075277f, -0.039509f, -0.003547f, 0.072429f, 0.098910f, -0.016440f, 0.000511f, 0.040387f, -0.115891f, 0.082352f, -0.008748f, 0.059041f, -0.020284f, 0.032185f, 0.060049f, -0.067701f, 0.060484f, 0.049969f, -0.064335f, 0.046249f, 0.015281f, 0.070606f, -0.076693f, -0.069307f, -0.007423f, -0.060621f, 0.057629f, 0.071338f, 0.026536f, -0.045189f, 0.101049f, 0.100184f, 0.022298f, 0.035736f, -0.000386f, -0.067961f, -0.052560f, -0.052235f, -0.051119f, 0.080901f, 0.043645f, -0.005394f, -0.007869f, 0.118431f, -0.054472f, -0.005900f, -0.096137f, -0.078517f, 0.038084f, 0.007926f, 0.001914f, 0.097829f, 0.118063f, 0.058242f, -0.027088f, 0.067557f, -0.100477f, 0.058983f, 0.019259f, -0.038450f, 0.080071f, -0.035636f, 0.041394f, 0.074075f, 0.029098f, -0.094676f, 0.052762f, -0.039972f, 0.080528f, 0.054573f, 0.041158f, -0.031338f, 0.080960f, 0.083482f, 0.013126f, 0.019963f, -0.103838f, 0.051087f, 0.100413f, -0.042247f, -0.020845f, 0.006280f, -0.086423f, -0.106301f, -0.025691f, -0.062205f, -0.006308f, -0.008249f, 0.066992f, 0.089876f, -0.053345f, 0.107314f, -0.083344f, -0.014916f, -0.073305f, -0.043818f, 0.066215f, -0.039278f, 0.046776f, 0.067918f, 0.108031f, 0.010918f, 0.039436f, -0.034451f, -0.055609f, 0.002818f, -0.002067f, -0.052996f, -0.009449f, -0.077239f, 0.098200f, -0.082234f, 0.017172f, -0.058355f, -0.076910f, 0.041594f, 0.025195f, -0.093148f, -0.002669f, 0.052961f, 0.084009f, -0.095124f, 0.045759f, 0.069345f, 0.064320f, 0.013054f, 0.021475f, 0.099182f, 0.074672f, 0.018012f, -0.035900f, 0.043998f, -0.018813f, -0.095280f, 0.005019f, 0.074549f, -0.037973f, -0.095466f, 0.040101f, 0.129918f, 0.062506f, 0.006996f, 0.077027f, 0.045134f, 0.018018f, -0.006135f, 0.031705f, 0.093304f, -0.067724f, 0.057135f, -0.031409f, 0.032259f, 0.027713f, 0.030456f, -0.052131f, 0.008046f, -0.096844f, 0.046954f, 0.112808f, 0.068380f, 0.004537f, 0.005449f, -0.042577f, -0.009435f, -0.058137f, 0.024307f, -0.076821f, 0.084530f, 0.061109f, -0.101133f, -0.087529f, 0.125829f, -0.063534f, -0.025650f, -0.028722f, 0.090852f, 0.045722f, 0.007701f, 0.008456f, -0.060612f, 0.012897f, -0.029925f, -0.044415f, 0.031658f, -0.052822f, 0.057066f, 0.000855f, 0.033143f, 0.056025f, -0.026490f, 0.088641f, 0.041081f, 0.083461f, 0.065948f, -0.036378f, 0.040410f, 0.058525f, 0.035434f, 0.068743f, -0.042112f, -0.066234f, 0.105658f, 0.075335f, -0.032763f, 0.001453f, 0.062772f, -0.006141f, 0.000378f, 0.040477f, -0.011171f, 0.055824f, -0.117734f, -0.032211f, -0.055253f, -0.007223f, 0.044864f, -0.056707f, -0.084521f, 0.043259f, 0.075003f, 0.009110f, 0.107673f, 0.029119f, -0.067383f, 0.052259f, 0.027774f, 0.014332f, -0.015178f, 0.077721f, -0.087226f, -0.068303f, -0.068220f, -0.078480f, 0.018348f, 0.039717f, -0.021546f, -0.003851f, -0.019511f, -0.011843f, 0.043228f, 0.013248f, 0.027115f, -0.080606f, 0.030865f, 0.084464f, -0.064376f, -0.028426f, 0.021293f, -0.087357f, 0.073641f, -0.067568f, 0.115112f, -0.018713f, -0.013726f, -0.055488f, 0.002346f, 0.056050f, -0.077410f, -0.023855f, 0.045574f, 0.009414f, -0.081264f, -0.096189f, 0.068510f, -0.019070f, -0.080943f, 0.110715f, -0.009866f, -0.083035f, 0.004315f, 0.016172f, 0.088745f, -0.057723f, -0.072983f, -0.084897f, 0.056170f, -0.019270f, -0.082547f, 0.036213f, 0.008014f, -0.087791f, 0.019882f, -0.014643f, -0.020324f, -0.000264f, -0.057146f, -0.056180f, 0.058425f, -0.049358f, -0.067786f, -0.037019f, -0.020455f, -0.037398f, 0.052198f, -0.055672f, -0.077647f, -0.016559f, -0.051730f, -0.011957f, 0.102609f, -0.038371f, 0.046477f, 0.021628f, -0.053111f, 0.052546f, 0.081554f, -0.061434f, 0.028144f, 0.017892f, 0.050156f, -0.107330f, -0.051906f, 0.057055f, -0.113005f, 0.058745f, 0.099420f, -0.018346f, -0.000960f, -0.014812f, -0.095332f, -0.047670f, 0.104111f, 0.068787f, -0.070415f, 0.083241f, -0.038952f, -0.021618f, -0.068338f, 0.051863f, 0.095642f, -0.017468f, 0.072155f, -0.035711f, -0.094011f, -0.020532f, -0.006684f, -0.055841f, 0.039061f, -0.014976f, -0.028260f, 0.038522f, 0.055563f, -0.056253f, 0.039112f, -0.039001f, 0.114956f, 0.070485f, -0.001543f, -0.108271f, 0.051915f, -0.044590f, -0.055862f, 0.107425f, 0.115514f, -0.026303f, -0.062454f, -0.086594f, -0.030531f, 0.044246f, 0.025912f, 0.080141f, -0.072736f, 0.058973f, 0.111596f, -0.053353f, 0.050139f, 0.009442f, -0.039718f, 0.107632f, -0.020530f, -0.081965f, -0.046062f, -0.018888f, 0.037894f, 0.108746f, 0.063820f, 0.057629f, -0.006452f, 0.060121f, -0.006124f, -0.089136f, -0.042001f, 0.041860f, -0.061565f, 0.090733f, 0.033618f, -0.075289f, -0.009131f, 0.084724f, -0.056595f, -0.055842f, -0.032332f, 0.035085f, -0.069077f, -0.067699f, 0.042632f, -0.032815f, 0.047120f, -0.034639f, 0.100750f, 0.072266f, -0.065764f, 0.075458f, 0.069588f, 0.067860f, 0.025388f, -0.102893f, 0.000449f, -0.040082f, 0.073928f, 0.057583f, 0.050574f, 0.026960f, 0.000139f, 0.003878f, 0.087782f, -0.019404f, -0.080852f, -0.023292f, 0.033839f, 0.021450f, 0.080073f, -0.058322f, 0.082810f, -0.054110f, -0.006914f, 0.002083f, -0.044312f, -0.054300f, 0.033162f, -0.090516f, -0.089318f, -0.075618f, 0.046870f, 0.008778f, -0.041142f, 0.073482f, 0.086092f, 0.063599f, 0.082388f, -0.122575f, 0.040696f, -0.031110f, 0.039916f, -0.048472f, -0.047990f, -0.002445f, 0.018378f, 0.116712f, -0.067329f, -0.020768f, 0.045918f, 0.011672f, 0.043777f, 0.004157f, 0.036629f, -0.005938f, -0.078790f, 0.077162f, 0.042160f, -0.085599f, 0.073259f, 0.120273f, -0.029868f, -0.027394f, -0.072045f, 0.029834f, 0.067407f, -0.079761f, -0.014236f, -0.059371f, -0.091319f, 0.004570f, 0.071132f, -0.016240f, 0.106641f, -0.080811f, -0.066677f, 0.085805f, -0.014607f, 0.039970f, -0.115907f, -0.088372f, -0.063880f, 0.100536f, -0.080124f, 0.046319f, -0.031129f, 0.034828f, -0.003655f, -0.028675f, -0.053614f, -0.055541f, 0.015238f, 0.068834f, 0.009891f, 0.112117f, 0.032232f, -0.075903f, -0.041046f, 0.017469f, -0.073621f, 0.012208f, -0.014442f, -0.104499f, 0.033895f, 0.028909f, -0.054028f, -0.020864f, -0.029353f, 0.104585f, -0.042316f, 0.101048f, 0.020861f, -0.036907f, 0.038565f, 0.032482f, -0.027893f, 0.046678f, 0.056808f, 0.041667f, 0.060830f, -0.050570f, 0.097327f, -0.092957f, -0.073761f, 0.032212f, -0.092508f, 0.038611f, -0.062260f, -0.028553f, -0.012421f, -0.065331f, -0.008180f, 0.068630f, 0.020529f, -0.064716f, 0.113917f, -0.004319f, 0.066261f, 0.015059f, 0.110879f, 0.085842f, -0.050732f, -0.064719f, 0.085488f, 0.098717f, -0.025925f, 0.017825f, -0.105947f, -0.082320f, -0.085062f, 0.005988f, -0.081147f, -0.069169f, -0.010171f, 0.017377f, 0.028620f, -0.004535f, 0.066830f, -0.031572f, -0.035459f, 0.011206f, -0.028004f, -0.016608f, -0.078647f, 0.022309f, -0.046235f, -0.049669f, 0.044374f, 0.102299f, 0.086562f, -0.024581f, 0.004813f, 0.058632f, -0.032596f, -0.010137f, -0.096572f, 0.032405f, 0.091457f, -0.016383f, 0.047491f, -0.001642f, 0.054641f, -0.042723f, 0.072586f, -0.000395f, -0.054785f, -0.001190f, 0.011728f, -0.047467f, 0.096962f, -0.006507f, -0.067796f, -0.005364f, -0.039904f, 0.051741f, 0.039452f, -0.085582f, 0.051905f, -0.067106f, -0.052865f, -0.064297f, -0.059010f, 0.015081f, 0.097500f, 0.027693f, 0.069145f, 0.070880f, 0.045217f, 0.095522f, 0.036425f, -0.049752f, 0.047680f, 0.059993f, -0.018145f, -0.112396f, -0.058729f, 0.074298f, -0.017796f, 0.092609f, 0.025470f, 0.006948f, -0.001061f, 0.039090f, 0.069073f, -0.081700f, -0.021139f, 0.061694f, -0.060975f, 0.050313f, -0.032455f, -0.088661f, -0.066365f, 0.036815f, 0.091400f, -0.055914f, 0.103566f, 0.051001f, -0.068214f, 0.030253f, 0.036922f, -0.041235f, -0.058108f, -0.028399f, -0.109092f, -0.094772f, -0.081923f, -0.043255f, 0.027331f, 0.088092f, -0.037224f, 0.028655f, 0.047524f, 0.106666f, 0.096149f, -0.062408f, -0.070742f, 0.061180f, -0.090649f, -0.064814f, 0.066689f, 0.109147f, -0.034111f, 0.039599f, 0.069499f, 0.035911f, 0.045374f, 0.008488f, -0.051805f, 0.036732f, -0.065265f, -0.047623f, -0.041388f, 0.026507f, 0.048085f, 0.112409f, 0.019548f, -0.094466f, -0.069654f, -0.106294f, -0.037692f, 0.037124f, 0.093736f, 0.067362f, 0.000547f, 0.009447f, 0.080277f, -0.022737f, 0.042229f, -0.047034f, -0.030191f, -0.085072f, -0.025915f, -0.044276f, -0.026467f, -0.071782f, -0.094436f, -0.019167f, -0.021686f, 0.024876f, 0.056953f, 0.045779f, -0.078023f, 0.025093f, -0.071123f, -0.093010f, -0.052700f, -0.054815f, 0.010108f, 0.107221f, 0.045767f, 0.024677f, 0.088027f, 0.041344f, 0.047760f, 0.013596f, 0.061290f, -0.007487f, 0.045394f, 0.046013f, -0.062923f, -0.110858f, -0.033842f, 0.059780f, 0.006499f, -0.067348f, -0.015895f, 0.006399f, -0.050306f, 0.003953f, 0.009639f, -0.002649f, 0.024654f, -0.029664f, 0.070986f, -0.072334f, -0.069433f, 0.001689f, 0.053071f, -0.064313f, -0.082748f, 0.063707f, -0.075221f, -0.046835f, 0.023102f, -0.021704f, -0.023289f, -0.042237f, 0.071132f, 0.110582f, -0.092019f, -0.054898f, 0.103153f, 0.021976f, -0.013021f, 0.060039f, -0.099595f, -0.074388f, 0.095073f, 0.036778f, 0.048023f, -0.053975f, 0.027708f, 0.080116f, 0.075841f, -0.081285f, 0.038129f, -0.083022f, 0.072108f, -0.030584f, 0.117709f, -0.006248f, -0.050196f, -0.058235f, 0.042366f, -0.085383f, 0.096217f, 0.035019f, 0.119474f, 0.085706f, -0.042336f, 0.085980f, -0.071356f, -0.081217f, 0.110689f, 0.109270f, -0.095981f, -0.031539f, -0.017958f, 0.054253f, 0.017673f, 0.031925f, -0.025582f, 0.055146f, 0.077337f, 0.025341f, -0.084781f, -0.050626f, -0.026248f, -0.075782f, -0.011723f, -0.017605f, 0.060461f, 0.012035f, 0.033354f, 0.099225f, -0.009212f, -0.127504f, -0.043307f, 0.076599f, 0.112226f, -0.036296f, -0.049908f, 0.101982f, -0.039758f, 0.044501f, -0.067780f, -0.093766f, 0.023645f, 0.104100f, 0.014820f, -0.078358f, 0.032171f, 0.027472f, -0.011689f, 0.028326f, 0.062065f, -0.078524f, 0.112359f, -0.015252f, 0.113981f, -0.049947f, 0.018994f, -0.049128f, -0.123381f, -0.072152f, -0.034847f, -0.024211f, 0.070098f, 0.003742f, -0.035842f, 0.122127f, 0.053490f, -0.057212f, 0.052364f, 0.027992f, 0.075866f, 0.090051f, -0.015462f, 0.017122f, -0.069352f, 0.024603f, 0.090700f, 0.088451f, -0.024172f, -0.108992f, 0.092574f, -0.007992f, -0.008622f, -0.043293f, -0.009308f, 0.109744f, 0.089080f, -0.027228f, -0.053667f, -0.011206f, -0.074603f, -0.044581f, 0.078778f, -0.112129f, -0.083827f, -0.041739f, 0.069862f, -0.029981f, -0.012704f, -0.049779f, 0.094088f, -0.060856f, 0.031005f, 0.110175f, 0.067356f, -0.015427f, 0.026587f, 0.070161f, -0.039207f, 0.038871f, -0.090162f, 0.054832f, -0.103231f, -0.000984f, 0.039427f, -0.068989f, 0.044179f, 0.039693f, 0.042129f, -0.017701f, 0.019064f, 0.066840f, 0.039205f, 0.042511f, 0.001646f, 0.056872f, -0.079616f, -0.034348f, 0.072039f, 0.035039f, 0.120225f, -0.053942f, -0.085393f, 0.045353f, -0.085341f, 0.068278f, -0.072532f, -0.005297f, 0.084574f, 0.077246f, -0.007462f, 0.078492f, -0.005331f, -0.070084f, -0.015517f, 0.063578f, 0.013321f, -0.027280f, -0.075297f, -0.045990f, 0.090154f, 0.070436f, 0.070742f, -0.077848f, -0.120148f, -0.057453f, -0.017438f, 0.085741f, -0.028291f, -0.066339f, -0.009051f, 0.105716f, 0.078644f, 0.048844f, -0.048473f, -0.045420f, 0.006135f, 0.050643f, 0.099191f, -0.021062f, -0.052662f, 0.003479f, 0.030432f, 0.035590f, 0.046864f, -0.052480f, 0.073188f, -0.049502f, -0.004054f, 0.047843f, -0.035108f, 0.054775f, -0.042063f, -0.051095f, -0.063855f, 0.064780f, 0.014452f, -0.034538f, -0.040689f, -0.111803f, 0.045768f, -0.080799f, 0.043034f, -0.079960f, 0.092018f, -0.073185f, -0.078446f, -0.047429f, 0.102100f, -0.037131f, 0.022323f, -0.001658f, -0.067065f, 0.064952f, 0.046940f, 0.061218f, 0.000230f, 0.039627f, -0.031612f, 0.015350f, 0.030209f, -0.074307f, 0.098957f, -0.018846f, -0.064699f, -0.039189f, 0.070440f, 0.056833f, -0.036205f, -0.095991f, 0.088497f, -0.050497f, 0.072455f, 0.027221f, 0.089024f, 0.067590f, -0.000987f, -0.059542f, -0.023565f, -0.036657f, 0.048026f, 0.074650f, 0.004768f, -0.072668f, -0.070289f, 0.036005f, -0.011071f, -0.069327f, -0.031352f, -0.018208f, 0.049727f, 0.008868f, 0.118133f, -0.100850f, 0.051410f, 0.073204f, -0.033797f, -0.046067f, 0.073630f, 0.013913f, 0.071522f, -0.002234f, 0.075258f, -0.084576f, -0.073193f, 0.011061f, -0.039946f, 0.087865f, 0.017500f, 0.020271f, 0.028027f, -0.046322f, 0.035844f, 0.053284f, -0.071318f, 0.013136f, -0.053765f, -0.007596f, -0.021208f, -0.055939f, -0.065223f, -0.110904f, -0.058269f, 0.083102f, -0.062009f, -0.019552f, 0.064010f, -0.056265f, -0.045594f, 0.053683f, 0.004910f, 0.006275f, -0.044371f, 0.078558f, -0.073641f, -0.079072f, 0.053397f, -0.052501f, -0.014248f, -0.031295f, -0.012284f, -0.042032f, 0.059051f, -0.059790f, -0.016198f, 0.066920f, 0.103539f, 0.038902f, -0.104728f, -0.011700f, 0.017710f, -0.022351f, 0.060787f, 0.029830f, -0.008278f, -0.050451f, 0.070959f, 0.056472f, -0.034698f, 0.120463f, 0.043750f, -0.026673f, 0.025265f, -0.041635f, -0.099941f, 0.064612f, 0.027095f, 0.045284f, -0.068302f, -0.053233f, 0.078628f, -0.053986f, -0.057420f, -0.066843f, -0.042044f, 0.080382f, 0.040992f, -0.088557f, -0.120392f, 0.015736f, 0.046428f, -0.054391f, 0.020871f, -0.055252f, -0.037831f, -0.044685f, -0.053749f, 0.103842f, 0.114070f, -0.020977f, -0.028047f, 0.083308f, 0.081659f, 0.057992f, 0.013804f, -0.001450f, 0.029319f, -0.016053f, 0.025586f, 0.029455f, 0.038015f, -0.107423f, -0.047274f, -0.047046f, -0.019355f, -0.081623f, 0.015613f, -0.066185f, 0.079913f, 0.017536f, -0.089778f, 0.028508f, -0.065400f, -0.078628f, 0.059738f, -0.037362f, -0.075644f, -0.116951f, 0.050166f, 0.043625f, -0.065326f, -0.060184f, 0.051187f, -0.044261f, 0.030522f, -0.050664f, -0.034673f, 0.088061f, -0.020362f, 0.056960f, -0.012407f, -0.080795f, -0.033383f, 0.041194f, 0.115723f, 0.079605f, -0.051668f, -0.042549f, 0.086059f, 0.003832f, 0.073227f, 0.070061f, -0.063900f, -0.015223f, -0.030019f, 0.068526f, 0.074119f, 0.002704f, -0.084219f, -0.046274f, -0.015436f, 0.098447f, -0.008705f, -0.060289f, 0.040114f, 0.030374f, -0.074516f, -0.055996f, -0.007972f, 0.042832f, 0.036934f, 0.093236f, -0.029313f, 0.001272f, -0.095994f, 0.036590f, 0.034858f, 0.066288f, 0.026486f, 0.079378f, -0.080592f, -0.050804f, -0.008279f, -0.077114f, -0.106569f, 0.031020f, -0.038827f, 0.045135f, 0.086172f, 0.067194f, -0.055974f, -0.108136f, 0.110024f, 0.108620f, -0.012145f, -0.019629f, -0.050122f, 0.035766f, 0.002685f, 0.076304f, 0.036663f, -0.074978f, -0.058154f, 0.041383f, 0.033583f, 0.045702f, 0.030574f, -0.006853f, 0.005803f, 0.041119f, 0.038772f, 0.028804f, -0.011434f, 0.024349f, -0.035074f, -0.042374f, -0.043824f, -0.102346f, -0.052110f, -0.023933f, -0.087005f, -0.032633f, -0.046682f, -0.083121f, -0.023046f, -0.057981f, 0.078289f, -0.034441f, -0.060163f, 0.044930f, -0.046635f, -0.083459f, -0.091685f, 0.001864f, 0.054542f, 0.048081f, -0.096785f, 0.064144f, -0.039071f, 0.009113f, -0.073933f, -0.011231f, -0.085666f, 0.051223f, -0.041707f, 0.029603f, -0.026293f, -0.055333f, 0.106835f, 0.034511f, 0.053029f, -0.058362f, 0.062733f, 0.108176f, -0.024283f, 0.052254f, -0.054669f, -0.018457f, 0.130689f, 0.067363f, -0.040065f, 0.096111f, -0.047827f, 0.111375f, 0.059033f, 0.066185f, -0.001749f, -0.043924f, -0.066699f, 0.030755f, 0.037252f, 0.019062f, -0.057708f, 0.019630f, 0.019642f, -0.059972f, 0.026768f, -0.017709f, 0.024380f, -0.056056f, 0.054576f, -0.014669f, 0.036288f, -0.055181f, 0.027906f, -0.036567f, 0.083800f, -0.047604f, 0.037839f, -0.046987f, 0.078924f, 0.049012f, -0.029902f, 0.077483f, -0.073691f, 0.067993f, 0.013006f, 0.081938f, -0.030439f, -0.106255f, -0.056143f, 0.119349f, -0.036020f, -0.095761f, 0.041234f, -0.074684f, -0.053849f, -0.062801f, -0.076952f, 0.127378f, 0.020667f, 0.020739f, 0.048399f, 0.018042f, -0.080185f, -0.059506f, 0.065988f, -0.007093f, -0.007083f, -0.050593f, -0.080056f, 0.053117f, 0.040299f, 0.034378f, -0.024830f, 0.008439f, -0.043392f, -0.013090f, 0.005521f, 0.105564f, 0.044858f, 0.024868f, -0.014412f, -0.067189f, -0.011927f, -0.095091f, 0.030347f, 0.055021f, 0.093403f, -0.051623f, 0.000289f, -0.066179f, 0.092383f, 0.080401f, 0.076085f, -0.073009f, -0.011107f, -0.072578f, -0.076510f, 0.077539f, -0.059850f, -0.028290f, -0.013907f, -0.041931f, 0.030827f, -0.111392f, -0.089126f, 0.104183f, -0.034779f, 0.098430f, -0.014429f, -0.027872f, -0.054672f, -0.087584f, -0.045358f, 0.046787f, 0.055719f, -0.020829f, 0.061423f, -0.055524f, 0.048855f, 0.076902f, -0.036140f, -0.029400f, 0.067177f, 0.064384f, -0.075115f, -0.016487f, 0.036622f, -0.000380f, 0.026765f, 0.012567f, 0.046554f, 0.042159f, 0.083983f, 0.031355f, 0.024667f, -0.021098f, -0.073008f, -0.042307f, -0.069871f, 0.003544f, 0.091036f, 0.033800f, 0.013760f, -0.081870f, -0.047622f, -0.043142f, 0.065821f, -0.072206f, -0.006306f, -0.056800f, -0.042353f, -0.052759f, -0.024339f, -0.005670f, 0.001591f, -0.018501f, 0.038569f, -0.095391f, -0.047830f, 0.028506f, 0.012444f, -0.050527f, -0.008358f, -0.066818f, 0.037333f, -0.061043f, 0.066161f, -0.004928f, -0.024354f, 0.073176f, -0.044090f, -0.067085f, -0.121407f, 0.088550f, 0.007020f, 0.023048f, -0.074539f, -0.063072f, -0.041113f, -0.023391f, 0.049374f, 0.009194f, 0.066805f, -0.035432f, -0.073096f, -0.016903f, -0.066343f, -0.019358f, 0.118167f, 0.085074f, -0.072211f, -0.044502f, -0.013802f, 0.076426f, -0.094856f, -0.120301f, -0.094300f, 0.039570f, 0.015309f, 0.046913f, -0.034079f, 0.025936f, 0.022341f, 0.027558f, -0.052098f, -0.082989f, -0.003895f, -0.076855f, 0.078754f, 0.032893f, -0.060774f, 0.014955f, -0.066684f, 0.066549f, 0.023736f, -0.069381f, -0.071224f, 0.121460f, -0.026864f, 0.091697f, -0.024812f, 0.017175f, -0.074702f, 0.109209f, 0.047882f, 0.019868f, -0.083738f, -0.091164f, -0.006222f, -0.017740f, 0.012016f, -0.093252f, -0.071073f, -0.000873f, -0.078530f, -0.071601f, -0.002625f, -0.073636f, -0.041252f, -0.071128f, -0.062017f, 0.005147f, -0.077448f, -0.058561f, -0.030663f, 0.079271f, 0.118214f, -0.060428f, -0.032400f, 0.041135f, -0.090953f, -0.010817f, -0.105160f, -0.037972f, -0.087688f, 0.005702f, 0.018977f, 0.119453f, -0.056595f, -0.087008f, 0.101896f, 0.085139f, 0.055207f, 0.072754f, -0.036658f, 0.097344f, 0.090968f, -0.048155f, -0.023556f, 0.101804f, 0.040030f, 0.051465f, 0.013372f, -0.028523f, 0.086642f, -0.037309f, -0.031639f, 0.055176f, 0.021539f, -0.040710f, -0.019783f, -0.060868f, -0.070273f, 0.040583f, 0.023253f, -0.041234f, -0.105515f, -0.115384f, 0.047374f, -0.037734f, -0.048058f, -0.125246f, -0.086670f, 0.087831f, -0.019102f, 0.067856f, -0.057412f, -0.021202f, 0.054213f, 0.004700f, -0.062992f, 0.024442f, -0.099353f, 0.070318f, 0.057975f, -0.060008f, 0.063489f, 0.062848f, 0.012218f, 0.026381f, 0.067735f, -0.040151f, 0.050988f, 0.017822f, -0.000792f, 0.082150f, 0.033921f, 0.102615f, 0.069313f, -0.071567f, 0.024706f, 0.057535f, 0.024443f, -0.072382f, -0.009102f, -0.081412f, -0.080419f, 0.002145f, 0.033156f, -0.065206f, 0.000619f, 0.009565f, -0.074799f, -0.066561f, 0.009048f, 0.078098f, 0.029610f, -0.051189f, 0.062469f, -0.042317f, -0.099367f, 0.033089f, -0.021973f, -0.038776f, -0.026076f, 0.056116f, -0.032344f, -0.059214f, -0.073823f, -0.013731f, 0.048140f, -0.105546f, 0.011718f, -0.054255f, 0.025014f, 0.038198f, -0.039471f, 0.012086f, 0.086312f, -0.057113f, -0.047586f, 0.103087f, 0.056644f, 0.049452f, 0.043040f, 0.024017f, -0.001957f, 0.030521f, 0.046898f, -0.000542f, -0.088517f, -0.099626f, 0.100334f, -0.078526f, 0.042863f, 0.077473f, -0.061189f, 0.035306f, -0.031876f, -0.037934f, 0.092548f, 0.079589f, -0.044383f, 0.006495f, -0.065029f, 0.081732f, 0.074761f, -0.064700f, 0.014695f, 0.088075f, -0.064294f, 0.050813f, 0.027403f, 0.010668f, -0.013729f, 0.083993f, 0.026348f, -0.013438f, -0.010933f, 0.070242f, -0.064532f, -0.058326f, 0.040054f, 0.011515f, 0.028784f, -0.034030f, -0.008847f, 0.031823f, -0.023498f, 0.022491f, -0.015395f, 0.004966f, -0.079112f, -0.043844f, 0.044806f, -0.003482f, -0.048377f, 0.093258f, -0.027251f, -0.103707f, 0.048350f, -0.032697f, 0.015156f, 0.013033f, 0.098315f, -0.074141f, -0.040178f, 0.099178f, 0.066068f, -0.015911f, 0.034642f, -0.037118f, -0.019034f, -0.044192f, 0.003834f, -0.075783f, 0.012009f, -0.006790f, 0.102214f, 0.034918f, -0.055903f, 0.045926f, 0.024798f, 0.022556f, -0.094917f, -0.012872f, -0.021115f, -0.044888f, 0.004291f, -0.012890f, -0.047745f, 0.018277f, -0.041047f, 0.074017f, 0.126637f, -0.001893f, 0.083813f, -0.043340f, 0.077024f, 0.095091f, -0.022010f, -0.032411f, -0.071309f, 0.101867f, -0.028726f, 0.022639f, -0.020613f, -0.040416f, 0.060538f, 0.097975f, 0.031070f, 0.078403f, -0.061079f, -0.003361f, 0.034517f, 0.054775f, 0.073718f, -0.041153f, 0.065835f, -0.093159f, -0.045799f, 0.015604f, 0.018112f, -0.069225f, 0.067774f, 0.003846f, -0.047490f, 0.046154f, 0.107109f, -0.002617f, -0.006210f, 0.036344f, 0.041243f, -0.082483f, 0.060845f, 0.032432f, -0.105228f, 0.035038f, -0.088704f, -0.029231f, 0.036296f, 0.040355f, 0.115969f, -0.029433f, 0.090322f, 0.013030f, 0.051107f, 0.064616f, 0.019075f, 0.074805f, 0.020742f, 0.078727f, 0.088971f, 0.104971f, -0.041360f, 0.066048f, -0.079313f, 0.035120f, 0.006640f, -0.067106f, 0.002935f, -0.104736f, 0.004137f, 0.081173f, -0.048259f, -0.044283f, 0.017651f, -0.048029f, -0.019460f, -0.010598f, -0.003298f, -0.053635f, -0.082749f, -0.046213f, -0.051697f, -0.022220f, 0.083706f, -0.053375f, 0.015114f, 0.004179f, 0.054632f, -0.040217f, 0.032591f, -0.033045f, -0.005131f, 0.076136f, 0.098320f, -0.100992f, 0.022904f, -0.059295f, -0.062472f, 0.061159f, 0.117980f, 0.041462f, -0.067007f, -0.083395f, -0.062341f, -0.007550f, -0.107286f, 0.086926f, 0.003642f, 0.124264f, 0.069441f, -0.027672f, 0.034577f, -0.024325f, -0.024094f, -0.091419f, 0.001807f, -0.103572f, -0.020696f, -0.025958f, 0.080989f, -0.034253f, 0.073007f, -0.081873f, 0.082031f, 0.039670f, -0.074986f, -0.027884f, -0.057083f, 0.063475f, 0.061954f, -0.101339f, -0.000802f, 0.104989f, -0.033922f, 0.068635f, -0.096433f, 0.060144f, -0.004943f, 0.074527f, -0.006657f, 0.074812f, 0.099532f, 0.017191f, 0.033016f, -0.012467f, -0.060569f, -0.000579f, 0.004658f, 0.086676f, -0.043807f, 0.052109f, -0.117471f, 0.092916f, 0.021506f, 0.003265f, -0.033705f, -0.036298f, 0.010787f, -0.045735f, 0.059323f, 0.093904f, -0.024812f, 0.010978f, -0.024849f, -0.112664f, 0.007753f, -0.018512f, -0.073222f, -0.017227f, -0.086391f, 0.005150f, 0.000705f, 0.020521f, 0.087678f, 0.047428f, 0.032750f, 0.029920f, -0.017381f, -0.110580f, -0.059601f, -0.007640f, -0.074669f, 0.034339f, -0.013083f, -0.034059f, 0.054834f, 0.030388f, 0.022684f, 0.021474f, -0.084613f, -0.042589f, 0.018025f, 0.003895f, -0.068667f, 0.043917f, -0.026067f, -0.068079f, 0.018607f, 0.087724f, -0.119214f, -0.080377f, 0.000865f, 0.026936f, -0.079403f, -0.052034f, 0.061693f, -0.037224f, -0.061931f, -0.054601f, 0.038037f, -0.053802f, -0.105320f, 0.004230f, -0.109636f, -0.069460f, -0.044361f, -0.083427f, 0.048137f, -0.101192f, -0.075394f, 0.009178f, -0.070228f, 0.021022f, -0.010812f, 0.090410f, -0.060078f, 0.059423f, -0.052563f, 0.112556f, -0.047518f, 0.022767f, -0.115039f, 0.034141f, -0.061286f, 0.065972f, 0.016993f, -0.022416f, -0.041035f, -0.093691f, 0.078641f, 0.002243f, -0.015114f, 0.104295f, 0.082266f, 0.039434f, 0.077995f, -0.070906f, 0.008353f, -0.018619f, 0.016233f, 0.109600f, 0.075974f, 0.040043f, 0.045213f, -0.034002f, -0.030130f, -0.077118f, 0.050277f, -0.091467f, -0.020408f, 0.009487f, 0.060146f, 0.029116f, -0.032619f, -0.018234f, 0.030993f, -0.081064f, 0.039497f, 0.071325f, 0.006140f, 0.043360f, -0.061654f, 0.022937f, 0.109797f, 0.031318f, 0.077376f, -0.027405f, 0.003157f, -0.014194f, 0.010796f, -0.006000f, 0.020932f, 0.005393f, 0.031346f, 0.079616f, -0.080200f, 0.060924f, 0.000540f, -0.050885f, 0.112268f, 0.071392f, 0.006502f, 0.042043f, -0.036517f, -0.012236f, -0.045653f, 0.066863f, -0.035742f, 0.067675f, 0.077070f, 0.004311f, -0.013533f, -0.023445f, -0.084687f, -0.045925f, 0.083188f, 0.031946f, -0.097264f, 0.002495f, -0.113404f, 0.013795f, -0.043756f, 0.056686f, 0.021784f, -0.107262f, 0.020463f, 0.096127f, 0.048497f, -0.104286f, 0.027365f, 0.037881f, 0.057340f, 0.051236f, -0.022281f, -0.001179f, -0.068606f, 0.012401f, -0.039016f, -0.091878f, -0.054831f, -0.094495f, -0.005247f, -0.042101f, -0.027426f, 0.034884f, 0.033898f, 0.018682f, 0.115866f, 0.003169f, 0.098672f, 0.037399f, -0.000957f, -0.025188f, 0.054057f, 0.029399f, -0.071382f, 0.019700f, -0.030225f, -0.024616f, -0.073326f, 0.010168f, 0.068854f, -0.019784f, -0.004404f, 0.042693f, -0.112153f, -0.058171f, -0.056840f, 0.015290f, 0.101993f, -0.105262f, 0.068297f, -0.009384f, 0.008835f, 0.108316f, -0.071412f, -0.072107f, -0.057672f, 0.010134f, 0.046934f, 0.039588f, -0.072062f, 0.012460f, 0.077163f, 0.013629f, 0.041704f, -0.084692f, -0.045211f, 0.026986f, 0.007623f, 0.008588f, 0.041156f, 0.025772f, 0.099109f, 0.003019f, 0.055055f, -0.007336f, 0.107415f, 0.017784f, 0.000043f, 0.093052f, -0.125158f, -0.016879f, 0.045964f, 0.004276f, -0.008779f, 0.044096f, -0.016428f, -0.061338f, -0.034141f, -0.021527f, 0.097869f, 0.078636f, -0.096404f, 0.021452f, 0.012356f, 0.032696f, -0.069326f, -0.059316f, 0.050113f, -0.021644f, -0.103985f, 0.022265f, 0.071922f, 0.047549f, 0.076311f, 0.022074f, 0.024362f, -0.054875f, 0.089654f, 0.085795f, 0.067612f, -0.033214f, -0.101589f, 0.033840f, 0.078653f, 0.062283f, -0.011161f, 0.047968f, -0.069135f, -0.072685f, 0.028052f, 0.090523f, 0.022570f, 0.035104f, -0.065596f, 0.113668f, 0.016287f, -0.061337f, -0.058322f, 0.019239f, -0.091810f, -0.049476f, 0.104411f, 0.100327f, -0.070490f, -0.071810f, 0.038957f, -0.032147f, -0.086315f, 0.031140f, -0.078248f, -0.060416f, -0.062178f, -0.062308f, -0.048953f, -0.085075f, 0.095102f, 0.024183f, 0.077192f, 0.030640f, -0.030432f, -0.094321f, -0.005039f, 0.015619f, 0.085857f, 0.003206f, -0.043537f, 0.086728f, -0.072028f, 0.027137f, -0.112889f, -0.029055f, 0.030590f, -0.092816f, -0.012262f, 0.027316f, 0.089626f, -0.034661f, -0.062819f, -0.055554f, -0.020388f, 0.076574f, -0.025800f, 0.042797f, -0.066008f, -0.052380f, -0.002811f, -0.063134f, 0.024440f, -0.003869f, -0.021976f, 0.100173f, 0.040768f, -0.115045f, 0.045511f, -0.044516f, 0.093312f, -0.071947f, 0.005433f, -0.074969f, 0.068449f, -0.028091f, 0.041179f, -0.088297f, -0.001104f, 0.000663f, 0.042756f, 0.027204f, 0.043899f, 0.043873f, -0.040667f, -0.014618f, -0.062936f, 0.009783f, 0.110969f, 0.066302f, 0.098168f, 0.012542f, 0.026907f, -0.067454f, -0.019712f, 0.007027f, -0.027413f, -0.074037f, -0.027646f, 0.006937f, 0.000496f, 0.004371f, 0.092629f, -0.028172f, 0.046027f, 0.089595f, 0.078729f, -0.044380f, -0.115857f, -0.027563f, -0.080874f, -0.093637f, -0.016890f, 0.029742f, 0.037774f, -0.053235f, -0.047161f, 0.028911f, 0.053333f, 0.041282f, 0.052772f, -0.070562f, -0.018904f, 0.004491f, -0.012137f, 0.022190f, -0.068994f, 0.039585f, -0.103783f, -0.006973f, 0.025072f, -0.042415f, 0.031374f, -0.074330f, 0.103250f, -0.083514f, -0.024701f, -0.031583f, -0.094451f, -0.058830f, 0.047382f, 0.058066f, 0.042154f, 0.015710f, -0.102398f, -0.020911f, -0.088752f, -0.115382f, -0.070155f, -0.045419f, -0.069888f, -0.077867f, -0.027549f, 0.080179f, -0.070510f, 0.104630f, 0.004455f, 0.089723f, 0.017129f, 0.049016f, -0.017668f, -0.022888f, 0.041988f, -0.016543f, 0.012561f, -0.049247f, -0.052968f, 0.017100f};
 static const float mlp_wt__8___1e_05_layer_1_biases[6] = {0.598813f, 0.159479f, -0.349086f, 0.007237f, 0.168213f, 0.248556f};
 static const float mlp_wt__8___1e_05_layer_1_weights[48] = {0.444117f, 0.379162f, -0.237812f, 0.457523f, -0.589733f, -0.004743f, 0.211430f, -0.236702f, -0.589150f, -0.351835f, -0.000710f, -0.233451f, -0.089875f, -0.532270f, -0.623434f, 0.471480f, -0.554283f, -0.257545f, 0.195400f, 0.483247f, -0.223084f, 0.170493f, -0.066788f, -0.611841f, -0.114841f, -0.618310f, 0.642359f, 0.308032f, -0.238658f, -0.322492f, -0.157765f, -0.241357f, -0.197881f, 0.524517f, -0.131389f, 0.340723f, -0.464479f, 0.053999f, 0.009806f, 0.087474f, 0.206482f, 0.492831f, -0.383282f, -0.131846f, -0.600281f, 0.129942f, 0.597809f, -0.138175f};
-static float mlp_wt__8___1e_05_buf1[600];
-static float mlp_wt__8___1e_05_buf2[600];
+static float mlp_wt__8___1e_05_buf1[8];
+static float mlp_wt__8___1e_05_buf2[8];
 static const EmlNetLayer mlp_wt__8___1e_05_layers[2] = {
     {8, 600, mlp_wt__8___1e_05_layer_0_weights, mlp_wt__8___1e_05_layer_0_biases, EmlNetActivationRelu},
     {6, 8, mlp_wt__8___1e_05_layer_1_weights, mlp_wt__8___1e_05_layer_1_biases, EmlNetActivationSoftmax}};
-static EmlNet mlp_wt__8___1e_05 = {2, mlp_wt__8___1e_05_layers, mlp_wt__8___1e_05_buf1, mlp_wt__8___1e_05_buf2, 600};
+static EmlNet mlp_wt__8___1e_05 = {2, mlp_wt__8___1e_05_layers, mlp_wt__8___1e_05_buf1, mlp_wt__8___1e_05_buf2, 8};
 
 int32_t
 mlp_wt__8___1e_05_predict(const float *features, int32_t n_features)
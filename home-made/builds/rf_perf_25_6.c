@@ -6,6 +6,7 @@
 
 static inline int32_t rf_perf_25_6_tree_0(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[405] < -3571)
     {
         if (features[394] < -8321)
@@ -88,6 +89,7 @@ static inline int32_t rf_perf_25_6_tree_0(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_1(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[267] < 4113)
     {
         if (features[243] < -2048)
@@ -212,6 +214,7 @@ static inline int32_t rf_perf_25_6_tree_1(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_2(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[237] < 3511)
     {
         if (features[393] < -4104)
@@ -294,6 +297,7 @@ static inline int32_t rf_perf_25_6_tree_2(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_3(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[345] < -4156)
     {
         if (features[284] < -12229)
@@ -355,6 +359,7 @@ static inline int32_t rf_perf_25_6_tree_3(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_4(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[279] < 3876)
     {
         if (features[328] < 4675)
@@ -416,6 +421,7 @@ static inline int32_t rf_perf_25_6_tree_4(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_5(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[207] < 2845)
     {
         if (features[225] < -1883)
@@ -498,6 +504,7 @@ static inline int32_t rf_perf_25_6_tree_5(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_6(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[459] < -3378)
     {
         if (features[596] < -5560)
@@ -566,6 +573,7 @@ static inline int32_t rf_perf_25_6_tree_6(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_7(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[261] < 3548)
     {
         if (features[363] < -4478)
@@ -627,6 +635,7 @@ static inline int32_t rf_perf_25_6_tree_7(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_8(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[405] < -3989)
     {
         return 1;
@@ -702,6 +711,7 @@ static inline int32_t rf_perf_25_6_tree_8(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_9(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[133] < -1238)
     {
         if (features[456] < 7821)
@@ -805,6 +815,7 @@ static inline int32_t rf_perf_25_6_tree_9(const int16_t *features, int32_t featu
 
 static inline int32_t rf_perf_25_6_tree_10(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[460] < -2948)
     {
         if (features[103] < -3288)
@@ -894,6 +905,7 @@ static inline int32_t rf_perf_25_6_tree_10(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_11(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[381] < -4696)
     {
         return 1;
@@ -948,6 +960,7 @@ static inline int32_t rf_perf_25_6_tree_11(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_12(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[357] < -4152)
     {
         if (features[0] < 5616)
@@ -1009,6 +1022,7 @@ static inline int32_t rf_perf_25_6_tree_12(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_13(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[358] < 5935)
     {
         if (features[411] < -4117)
@@ -1070,6 +1084,7 @@ static inline int32_t rf_perf_25_6_tree_13(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_14(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[387] < -4540)
     {
         return 1;
@@ -1145,6 +1160,7 @@ static inline int32_t rf_perf_25_6_tree_14(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_15(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[471] < -2940)
     {
         if (features[406] < -5368)
@@ -1248,6 +1264,7 @@ static inline int32_t rf_perf_25_6_tree_15(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_16(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[357] < -4152)
     {
         if (features[424] < 5457)
@@ -1330,6 +1347,7 @@ static inline int32_t rf_perf_25_6_tree_16(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_17(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[405] < -4487)
     {
         return 1;
@@ -1391,6 +1409,7 @@ static inline int32_t rf_perf_25_6_tree_17(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_18(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[471] < -2793)
     {
         if (features[594] < 5198)
@@ -1473,6 +1492,7 @@ static inline int32_t rf_perf_25_6_tree_18(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_19(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[417] < -4348)
     {
         return 1;
@@ -1541,6 +1561,7 @@ static inline int32_t rf_perf_25_6_tree_19(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_20(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[429] < -4295)
     {
         return 1;
@@ -1602,6 +1623,7 @@ static inline int32_t rf_perf_25_6_tree_20(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_21(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[315] < 5455)
     {
         if (features[280] < 4067)
@@ -1670,6 +1692,7 @@ static inline int32_t rf_perf_25_6_tree_21(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_22(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[249] < 3248)
     {
         if (features[256] < 3570)
@@ -1738,6 +1761,7 @@ static inline int32_t rf_perf_25_6_tree_22(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_23(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[441] < -3536)
     {
         return 1;
@@ -1806,6 +1830,7 @@ static inline int32_t rf_perf_25_6_tree_23(const int16_t *features, int32_t feat
 
 static inline int32_t rf_perf_25_6_tree_24(const int16_t *features, int32_t features_length)
 {
+    (void)features_length;
     if (features[254] < -321)
     {
         if (features[285] < 3973)
@@ -7,6 +7,7 @@
     
 
 static inline int32_t rf_wt_2_6_tree_0(const int16_t *features, int32_t features_length) {
+    (void)features_length;
           if (features[405] < -3571) {
               if (features[394] < -8321) {
                   return 2;
@@ -56,6 +57,7 @@ static inline int32_t rf_wt_2_6_tree_0(const int16_t *features, int32_t features
         
 
 static inline int32_t rf_wt_2_6_tree_1(const int16_t *features, int32_t features_length) {
+    (void)features_length;
           if (features[267] < 4113) {
               if (features[243] < -2048) {
                   if (features[186] < -3331) {
@@ -0,0 +1,1455 @@
+"""
+C code export of MLP classifiers for the EmlNet runtime in Firmware/Core/Inc/eml_net.h.
+
+Produces the same code structure as `emlearn.convert(clf, method='inline').save(name)`,
+and adds the layer layouts that the firmware runtime supports beyond stock emlearn.
+
+Works on fitted sklearn MLPClassifier objects, or on weights loaded back from an
+existing emlearn-generated C file with load_emlearn_c().
+
+Typical usage:
+
+    from eml_export import export_mlp
+    code = export_mlp(clf, name='mlp_perf', layout='blocked4')
+    Path('builds/mlp_perf.c').write_text(code)
+
+Temporal CNNs over the 100x6 windows are described with Conv1D, DepthwiseConv1D, Pool1D
+and Dense layers, and exported with export_sequential().
+
+export_mlp_cpp() writes a C++17 header for the compile-time templates in eml_net.hpp instead,
+and export_mlp_blob() a binary model blob for eml_net_blob.h, loaded at runtime.
+
+export_trees() writes random forests (load_emlearn_trees_c, trees_from_sklearn) as node tables
+for the iterative traversal in eml_trees.h, instead of emlearn's nested if/else code.
+"""
+import re
+import zlib
+from pathlib import Path
+
+import numpy as np
+
+
+LAYER_TYPES = {
+    'dense': 'EmlNetLayerDense',
+    'blocked4': 'EmlNetLayerDenseBlocked4',
+    'blocked8': 'EmlNetLayerDenseBlocked8',
+    'int8': 'EmlNetLayerDenseInt8',
+    'q15': 'EmlNetLayerDenseQ15',
+    'sparse_input': 'EmlNetLayerDenseSparseInput',
+    'float16': 'EmlNetLayerDenseFloat16',
+    'csr': 'EmlNetLayerDenseCsr',
+    'codebook': 'EmlNetLayerDenseCodebook',
+    'codebook_per_output': 'EmlNetLayerDenseCodebook',
+    'binary': 'EmlNetLayerDenseBinary',
+    'ternary': 'EmlNetLayerDenseBinary',
+}
+
+# Bytes of scratch memory needed per input, for layers that quantize their inputs
+# (or pack their signs, 1 bit each), or gather the indices of non-zero inputs
+SCRATCH_BYTES_PER_INPUT = {
+    'int8': 1,
+    'q15': 2,
+    'sparse_input': 2,
+    'binary': 1 / 8,
+    'ternary': 1 / 8,
+}
+
+ACTIVATIONS = {
+    'identity': 'EmlNetActivationIdentity',
+    'relu': 'EmlNetActivationRelu',
+    'logistic': 'EmlNetActivationLogistic',
+    'softmax': 'EmlNetActivationSoftmax',
+    'tanh': 'EmlNetActivationTanh',
+}
+
+
+class MLPWeights:
+    """
+    Minimal stand-in for a fitted MLPClassifier (coefs_, intercepts_ and activations)
+
+    layer_activations: optional activation per layer, for layers that differ from
+    the hidden activation (like the identity bottleneck of factorize_low_rank)
+    """
+
+    def __init__(self, coefs, intercepts, activation='relu', out_activation='softmax', layer_activations=None):
+        self.coefs_ = [np.asarray(w, dtype=np.float64) for w in coefs]
+        self.intercepts_ = [np.asarray(b, dtype=np.float64) for b in intercepts]
+        self.activation = activation
+        self.out_activation_ = out_activation
+        self.layer_activations_ = list(layer_activations) if layer_activations is not None else None
+
+
+def load_emlearn_c(path):
+    """Load the weights of an emlearn-generated EmlNet model from its C source"""
+    text = Path(path).read_text()
+
+    arrays = {}
+    for m in re.finditer(r'_layer_(\d+)_(weights|biases)\[\d+\]\s*=\s*\{([^}]*)\}', text):
+        values = [float(v.strip().rstrip('f')) for v in m.group(3).split(',') if v.strip()]
+        arrays[(int(m.group(1)), m.group(2))] = np.array(values)
+
+    layers = re.findall(r'\{\s*(\d+),\s*(\d+),\s*\w+,\s*\w+,\s*EmlNetActivation(\w+)(?:,\s*(\w+))?', text)
+    if not layers:
+        raise ValueError(f"No EmlNetLayer definitions found in {path}")
+    layouts = {v: k for k, v in LAYER_TYPES.items()}
+
+    coefs, intercepts, activations = [], [], []
+    for idx, (n_outputs, n_inputs, activation, layer_type) in enumerate(layers):
+        n_outputs, n_inputs = int(n_outputs), int(n_inputs)
+        layout = layouts.get(layer_type or 'EmlNetLayerDense')
+        weights = arrays[(idx, 'weights')]
+        if layout in ('dense', 'sparse_input'):
+            coefs.append(weights.reshape(n_inputs, n_outputs))
+        elif layout in ('blocked4', 'blocked8'):
+            coefs.append(unpack_blocked(weights, n_inputs, n_outputs, block=int(layout[len('blocked'):])))
+        else:
+            raise ValueError(f"Cannot load layer {idx} of type {layer_type}")
+        intercepts.append(arrays[(idx, 'biases')])
+        activations.append(activation.lower())
+
+    return MLPWeights(coefs, intercepts, activation=activations[0], out_activation=activations[-1],
+                      layer_activations=activations)
+
+
+def load_scaler_c(path):
+    """Load StandardScaler mean and scale from a C file like Firmware/Core/Src/mlp_scaler.c"""
+    text = Path(path).read_text()
+    arrays = {}
+    for m in re.finditer(r'MLP_(MEAN|SCALE)\[\w+\]\s*=\s*\{([^}]*)\}', text):
+        arrays[m.group(1)] = np.array([float(v.strip().rstrip('f')) for v in m.group(2).split(',') if v.strip()])
+    return arrays['MEAN'], arrays['SCALE']
+
+
+def load_dataset_csv(data_dir):
+    """Load home-made/data style CSVs. Returns features X and class index y (sorted file stems)"""
+    paths = sorted(Path(data_dir).glob('*.csv'))
+    if not paths:
+        raise FileNotFoundError(f"No CSV files found in {data_dir}")
+    X, y = [], []
+    for label, path in enumerate(paths):
+        values = np.loadtxt(path, delimiter=',', skiprows=1, ndmin=2)
+        X.append(values)
+        y.append(np.full(len(values), label))
+    return np.concatenate(X), np.concatenate(y)
+
+
+def mlp_forward(model, X, dtype=np.float64):
+    """Reference forward pass. Returns the outputs of the last layer, shape (n_samples, n_outputs)"""
+    functions = {
+        'identity': lambda a: a,
+        'relu': lambda a: np.maximum(a, 0),
+        'logistic': lambda a: 1.0 / (1.0 + np.exp(-a)),
+        'tanh': np.tanh,
+        'softmax': lambda a: np.exp(a - a.max(axis=1, keepdims=True))
+                              / np.exp(a - a.max(axis=1, keepdims=True)).sum(axis=1, keepdims=True),
+    }
+    a = np.asarray(X, dtype=dtype)
+    for w, b, act in zip(model.coefs_, model.intercepts_, _layer_activations(model)):
+        a = functions[act](a @ np.asarray(w, dtype=dtype) + np.asarray(b, dtype=dtype))
+    return a
+
+
+def fold_scaler(model, mean, scale):
+    """
+    Absorb a StandardScaler into the first layer.
+
+    (x - mean) / scale @ W + b  ==  x @ (W / scale[:, None]) + (b - (mean / scale) @ W)
+
+    Zero scale is treated as 1, like StandardScaler and build_mlp_features() in main.c.
+    Returns MLPWeights that take raw (unscaled) features.
+    """
+    mean = np.asarray(mean, dtype=np.float64)
+    scale = np.asarray(scale, dtype=np.float64)
+    scale = np.where(scale == 0.0, 1.0, scale)
+
+    w0 = np.asarray(model.coefs_[0], dtype=np.float64)
+    b0 = np.asarray(model.intercepts_[0], dtype=np.float64)
+    if w0.shape[0] != len(mean) or len(mean) != len(scale):
+        raise ValueError(f"Scaler has {len(mean)} features, layer 0 has {w0.shape[0]} inputs")
+
+    coefs = [w0 / scale[:, None]] + list(model.coefs_[1:])
+    intercepts = [b0 - (mean / scale) @ w0] + list(model.intercepts_[1:])
+    return MLPWeights(coefs, intercepts, activation=model.activation, out_activation=model.out_activation_,
+                      layer_activations=_layer_activations(model))
+
+
+def factorize_low_rank(model, rank, layer=0):
+    """
+    Replace one layer by its rank `rank` truncated SVD, as two layers.
+
+    x @ W + b  ~=  (x @ U_r sqrt(S_r)) @ (sqrt(S_r) V_r^T) + b
+
+    The first is an identity-activation bottleneck of `rank` outputs and no bias,
+    the second has the original bias and activation. Multiply-adds of the layer go from
+    n_inputs*n_outputs to rank*(n_inputs + n_outputs).
+
+    Factorize before fold_scaler(), so the truncation error is measured on standardized inputs.
+    Returns MLPWeights with one more layer.
+    """
+    w = np.asarray(model.coefs_[layer], dtype=np.float64)
+    if not 0 < rank <= min(w.shape):
+        raise ValueError(f"Rank must be in 1..{min(w.shape)} for layer {layer} of shape {w.shape}")
+
+    u, s, vt = np.linalg.svd(w, full_matrices=False)
+    root = np.sqrt(s[:rank])
+    first = u[:, :rank] * root
+    second = root[:, None] * vt[:rank]
+
+    activations = _layer_activations(model)
+    coefs = list(model.coefs_[:layer]) + [first, second] + list(model.coefs_[layer+1:])
+    intercepts = (list(model.intercepts_[:layer]) + [np.zeros(rank), model.intercepts_[layer]]
+                  + list(model.intercepts_[layer+1:]))
+    activations = activations[:layer] + ['identity'] + activations[layer:]
+    return MLPWeights(coefs, intercepts, activation=model.activation, out_activation=model.out_activation_,
+                      layer_activations=activations)
+
+
+def feature_groups(n_features, group='step', n_axes=6):
+    """
+    Indices of the features in each group of the flattened windows (time step major, n_axes values per step).
+    'step' gives one group of n_axes features per time step, 'axis' one group of n_features / n_axes per axis
+    """
+    if n_features % n_axes:
+        raise ValueError(f"{n_features} features are not whole steps of {n_axes} axes")
+    if group == 'step':
+        return [np.arange(s * n_axes, (s + 1) * n_axes) for s in range(n_features // n_axes)]
+    if group == 'axis':
+        return [np.arange(a, n_features, n_axes) for a in range(n_axes)]
+    raise ValueError(f"Unknown feature group '{group}'. Supported: 'step', 'axis'")
+
+
+def _standardize(X, scaler):
+    if scaler is None:
+        return np.asarray(X, dtype=np.float64)
+    mean, scale = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+    return (np.asarray(X, dtype=np.float64) - mean) / np.where(np.asarray(scale) == 0.0, 1.0, scale)
+
+
+def feature_importance(model, groups, method='weight_norm', X=None, y=None, scaler=None, seed=0):
+    """
+    Importance of each group of input features (see feature_groups), higher is more important.
+
+    'weight_norm': L2 norm of the layer 0 weights of the group. Needs no data, and is measured
+        on standardized inputs, so pass the model before fold_scaler()
+    'permutation': drop in accuracy on raw features X with labels y when the group is shuffled across rows
+    """
+    if method == 'weight_norm':
+        w = np.asarray(model.coefs_[0])
+        return np.array([np.linalg.norm(w[g]) for g in groups])
+    if method != 'permutation':
+        raise ValueError(f"Unknown importance method '{method}'. Supported: 'weight_norm', 'permutation'")
+    if X is None or y is None:
+        raise ValueError("Permutation importance needs data X and labels y")
+
+    Z = _standardize(X, scaler)
+    baseline = np.mean(mlp_forward(model, Z).argmax(axis=1) == y)
+    rng = np.random.default_rng(seed)
+    importance = np.empty(len(groups))
+    for i, g in enumerate(groups):
+        shuffled = Z.copy()
+        shuffled[:, g] = Z[rng.permutation(len(Z))][:, g]
+        importance[i] = baseline - np.mean(mlp_forward(model, shuffled).argmax(axis=1) == y)
+    return importance
+
+
+def select_features(model, n_keep, group='step', method='weight_norm', X=None, y=None, scaler=None, n_axes=6):
+    """
+    Keep the n_keep most important groups of input features (see feature_groups and feature_importance).
+
+    Layer 0 of the returned model has only the kept rows, and takes the kept features in index order.
+    The dropped features are taken as the scaler mean (0 when standardized). With data X, layer 0 is
+    instead refit by least squares, so that it reproduces the layer 0 outputs of the full model on X
+    from the kept features alone: the kept features then also stand in for the correlated dropped ones.
+
+    Select before fold_scaler(). Returns the kept feature indices, the reduced model,
+    and the scaler for the kept features (None without scaler).
+    """
+    w = np.asarray(model.coefs_[0], dtype=np.float64)
+    groups = feature_groups(w.shape[0], group, n_axes)
+    if not 0 < n_keep <= len(groups):
+        raise ValueError(f"Can keep 1..{len(groups)} {group} groups, not {n_keep}")
+
+    importance = feature_importance(model, groups, method, X=X, y=y, scaler=scaler)
+    kept = np.argsort(-importance, kind='stable')[:n_keep]
+    index = np.sort(np.concatenate([groups[g] for g in kept]))
+
+    if X is not None:
+        Z = _standardize(X, scaler)
+        w_kept = np.linalg.lstsq(Z[:, index], Z @ w, rcond=None)[0]
+    else:
+        w_kept = w[index]
+
+    reduced = MLPWeights([w_kept] + list(model.coefs_[1:]), model.intercepts_, activation=model.activation,
+                         out_activation=model.out_activation_, layer_activations=_layer_activations(model))
+    if scaler is not None:
+        mean, scale = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+        scaler = (np.asarray(mean)[index], np.asarray(scale)[index])
+    return index, reduced, scaler
+
+
+def check_folded(model, folded, mean, scale, X, atol=1e-3):
+    """
+    Check that a scaler-folded model, with float32 weights, matches scaler + original model on X.
+    Returns the largest absolute output difference. Raises ValueError above atol.
+    """
+    scale = np.where(np.asarray(scale) == 0.0, 1.0, scale)
+    expected = mlp_forward(model, (np.asarray(X) - mean) / scale)
+    folded32 = MLPWeights([np.float32(w) for w in folded.coefs_], [np.float32(b) for b in folded.intercepts_],
+                          activation=folded.activation, out_activation=folded.out_activation_,
+                          layer_activations=_layer_activations(folded))
+    actual = mlp_forward(folded32, np.float32(X), dtype=np.float32)
+
+    max_diff = float(np.max(np.abs(actual - expected)))
+    if max_diff > atol:
+        raise ValueError(f"Scaler-folded model differs from the unfolded path by {max_diff:g} > {atol:g}")
+    return max_diff
+
+
+def c_float(value):
+    """Shortest C literal that round-trips the float32 value"""
+    s = str(np.float32(value))
+    if 'inf' in s or 'nan' in s:
+        raise ValueError(f"Cannot export non-finite weight {s}")
+    if '.' not in s and 'e' not in s:
+        s += '.0'
+    return s + 'f'
+
+
+def c_array(ctype, name, values, fmt=None):
+    values = np.asarray(values).ravel()
+    if fmt is None:
+        fmt = c_float if ctype == 'float' else str
+    body = ', '.join(fmt(v) for v in values)
+    return f"static const {ctype} {name}[{len(values)}] = {{ {body} }};"
+
+
+def pack_blocked(weights, block):
+    """
+    Reorder input-major weights (n_inputs, n_outputs) into output blocks.
+
+    Matches eml_net_dense_blocked4/8: for each block of `block` outputs,
+    the weights of all its outputs for one input are adjacent.
+    Outputs are zero-padded up to a multiple of `block`.
+    """
+    n_inputs, n_outputs = weights.shape
+    n_blocks = (n_outputs + block - 1) // block
+    padded = np.zeros((n_inputs, n_blocks * block), dtype=weights.dtype)
+    padded[:, :n_outputs] = weights
+    # (n_inputs, n_blocks, block) -> (n_blocks, n_inputs, block)
+    return padded.reshape(n_inputs, n_blocks, block).transpose(1, 0, 2).ravel()
+
+
+def quantize_int8(weights):
+    """
+    Symmetric int8 quantization with one scale per output, as used by EmlNetLayerDenseInt8.
+
+    Returns the quantized weights output-major, shape (n_outputs, n_inputs), and the scales.
+    """
+    w = np.asarray(weights, dtype=np.float64)
+    scales = np.abs(w).max(axis=0) / 127.0
+    scales[scales == 0.0] = 1.0
+    q = np.clip(np.round(w / scales), -127, 127).astype(np.int8)
+    return q.T, scales
+
+
+def quantize_q15(weights):
+    """Like quantize_int8(), with 16-bit weights for EmlNetLayerDenseQ15"""
+    w = np.asarray(weights, dtype=np.float64)
+    scales = np.abs(w).max(axis=0) / 32767.0
+    scales[scales == 0.0] = 1.0
+    q = np.clip(np.round(w / scales), -32767, 32767).astype(np.int16)
+    return q.T, scales
+
+
+def prune_magnitude(weights, density):
+    """
+    Zero all but the largest-magnitude fraction `density` of the weights.
+    Ties at the threshold are kept, so slightly more than `density` may remain.
+    """
+    w = np.asarray(weights, dtype=np.float64)
+    if not 0.0 < density <= 1.0:
+        raise ValueError(f"Density must be in (0, 1], got {density}")
+    n_keep = max(1, int(round(density * w.size)))
+    threshold = np.sort(np.abs(w).ravel())[::-1][n_keep - 1]
+    return np.where(np.abs(w) >= threshold, w, 0.0)
+
+
+def pack_csr(weights):
+    """
+    Compressed sparse rows of the non-zero weights, one row per output, as used by EmlNetLayerDenseCsr.
+    Returns values, column (input) indices and row offsets.
+    """
+    rows = np.asarray(weights).T
+    nonzero = rows != 0.0
+    if nonzero.sum() > 0xFFFF:
+        raise ValueError(f"{nonzero.sum()} weights kept, csr supports up to 65535 per layer")
+    row_offsets = np.concatenate([[0], np.cumsum(nonzero.sum(axis=1))])
+    columns = np.nonzero(nonzero)[1]
+    return rows[nonzero], columns, row_offsets
+
+
+def cluster_codebook(values, n_clusters=16, iterations=100):
+    """
+    1-D k-means (Lloyd) of the values, started from evenly spaced quantiles.
+    Returns the codebook (n_clusters,) and the index of the nearest entry for each value.
+    Unused entries keep their initial value.
+    """
+    v = np.asarray(values, dtype=np.float64).ravel()
+    codebook = np.quantile(v, (np.arange(n_clusters) + 0.5) / n_clusters)
+    for _ in range(iterations):
+        assign = np.abs(v[:, None] - codebook[None, :]).argmin(axis=1)
+        updated = codebook.copy()
+        for c in range(n_clusters):
+            members = v[assign == c]
+            if len(members):
+                updated[c] = members.mean()
+        if np.array_equal(updated, codebook):
+            break
+        codebook = updated
+    return codebook, np.abs(v[:, None] - codebook[None, :]).argmin(axis=1)
+
+
+def pack_codebook(weights, per_output=False):
+    """
+    Cluster the weights into 16 entry codebooks, as used by EmlNetLayerDenseCodebook.
+    Returns the packed 4-bit indices (output-major, low nibble first) and the codebook(s).
+    """
+    rows = np.asarray(weights, dtype=np.float64).T
+    n_outputs, n_inputs = rows.shape
+    if per_output:
+        clustered = [cluster_codebook(row) for row in rows]
+        codebook = np.concatenate([c for c, _ in clustered])
+        indices = np.stack([a for _, a in clustered])
+    else:
+        codebook, assign = cluster_codebook(rows)
+        indices = assign.reshape(n_outputs, n_inputs)
+
+    if n_inputs % 2:
+        indices = np.concatenate([indices, np.zeros((n_outputs, 1), dtype=indices.dtype)], axis=1)
+    packed = (indices[:, 0::2] | (indices[:, 1::2] << 4)).astype(np.uint8)
+    return packed, codebook
+
+
+def binarize_weights(weights, ternary=False):
+    """
+    1-bit or ternary weights with a scale per output, as used by EmlNetLayerDenseBinary.
+
+    Binary: w ~= scale * sign(w), scale = mean |w| of the output (XNOR-Net).
+    Ternary: weights below 0.7 * mean |w| become 0, scale = mean |w| of the rest (Ternary Weight Networks).
+    Returns signs and masks (None for binary) as output-major bool arrays, and the scales.
+    """
+    rows = np.asarray(weights, dtype=np.float64).T
+    signs = rows >= 0.0
+    if not ternary:
+        return signs, None, np.abs(rows).mean(axis=1)
+    masks = np.abs(rows) > 0.7 * np.abs(rows).mean(axis=1, keepdims=True)
+    kept = np.maximum(masks.sum(axis=1), 1)
+    return signs & masks, masks, (np.abs(rows) * masks).sum(axis=1) / kept
+
+
+def pack_bits(rows):
+    """Pack a bool array (n_rows, n_bits) into uint32 words, n_bits rounded up to 32 per row, bit i%32 of word i/32"""
+    rows = np.asarray(rows, dtype=bool)
+    n_rows, n_bits = rows.shape
+    padded = np.zeros((n_rows, ((n_bits + 31) // 32) * 32), dtype=np.uint64)
+    padded[:, :n_bits] = rows
+    weights = np.uint64(1) << np.arange(32, dtype=np.uint64)
+    return (padded.reshape(n_rows, -1, 32) * weights).sum(axis=2).astype(np.uint32)
+
+
+def unpack_blocked(packed, n_inputs, n_outputs, block):
+    """Inverse of pack_blocked(). Returns input-major weights (n_inputs, n_outputs)"""
+    n_blocks = (n_outputs + block - 1) // block
+    padded = np.asarray(packed).reshape(n_blocks, n_inputs, block).transpose(1, 0, 2)
+    return padded.reshape(n_inputs, n_blocks * block)[:, :n_outputs]
+
+
+def _layer_activations(model):
+    if getattr(model, 'layer_activations_', None) is not None:
+        return list(model.layer_activations_)
+    n_layers = len(model.coefs_)
+    hidden = model.activation
+    return [hidden] * (n_layers - 1) + [model.out_activation_]
+
+
+def _per_layer(option, n_layers):
+    if isinstance(option, (list, tuple)):
+        if len(option) != n_layers:
+            raise ValueError(f"Expected {n_layers} per-layer options, got {len(option)}")
+        return list(option)
+    return [option] * n_layers
+
+
+def plan_buffers(n_outputs, in_place):
+    """
+    Lengths of the two activation buffers, like eml_net_plan_buffers() in eml_net.h.
+
+    n_outputs: outputs of each layer. in_place: whether each layer can write over its inputs
+    (like eml_net_layer_in_place). Layers alternate between the buffers, in-place layers stay,
+    and the last layer writes to the second.
+    """
+    switches = sum(0 if p else 1 for p in in_place[1:])
+    buffer = 1 if switches % 2 == 0 else 0
+    lengths = [0, 0]
+    for idx, (n, p) in enumerate(zip(n_outputs, in_place)):
+        if idx > 0 and not p:
+            buffer = 1 - buffer
+        lengths[buffer] = max(lengths[buffer], n)
+    return lengths
+
+
+def _emit_net(lines, name, layer_defs, n_outputs, in_place, scratch_bytes):
+    """Append the buffers, layer table, EmlNet and wrapper functions of a model"""
+    # Input layer reads the caller's features directly, only outputs need buffer space
+    length1, length2 = plan_buffers(n_outputs, in_place)
+    n_layers = len(layer_defs)
+    lines.append(f"static float {name}_buf1[{length1}];")
+    lines.append(f"static float {name}_buf2[{length2}];")
+    # Trailing EmlNet fields, left out when not needed
+    tail = ''
+    if scratch_bytes:
+        # int32_t for word alignment of the quantized inputs
+        scratch_words = (scratch_bytes + 3) // 4
+        lines.append(f"static int32_t {name}_scratch[{scratch_words}];")
+        tail = f", {name}_scratch, {scratch_words * 4}"
+    if length2 != length1:
+        tail = (tail or ", NULL, 0") + f", {length2}"
+    lines.append(f"static const EmlNetLayer {name}_layers[{n_layers}] = {{ \n"
+                 + ", \n".join(layer_defs) + " };")
+    lines.append(f"static EmlNet {name} = {{ {n_layers}, {name}_layers, "
+                 f"{name}_buf1, {name}_buf2, {length1}{tail} }};")
+
+    lines.append(f"""
+    int32_t
+    {name}_predict(const float *features, int32_t n_features)
+    {{
+        return eml_net_predict(&{name}, features, n_features);
+    }}
+
+
+    int32_t
+    {name}_regress(const float *features, int32_t n_features, float *out, int32_t out_length)
+    {{
+        return eml_net_regress(&{name}, features, n_features, out, out_length);
+    }}
+
+
+    float
+    {name}_regress1(const float *features, int32_t n_features)
+    {{
+        return eml_net_regress1(&{name}, features, n_features);
+    }}
+
+
+    int32_t
+    {name}_workspace_size(void)
+    {{
+        return eml_net_workspace_size(&{name});
+    }}
+
+
+    int32_t
+    {name}_predict_workspace(const float *features, int32_t n_features, void *workspace, int32_t workspace_length)
+    {{
+        return eml_net_predict_workspace(&{name}, features, n_features, workspace, workspace_length);
+    }}
+
+
+    int32_t
+    {name}_regress_workspace(const float *features, int32_t n_features, float *out, int32_t out_length, void *workspace, int32_t workspace_length)
+    {{
+        return eml_net_regress_workspace(&{name}, features, n_features, out, out_length, workspace, workspace_length);
+    }}
+
+
+    static EmlNetChecked {name}_checked;
+
+    int32_t
+    {name}_check(void)
+    {{
+        return eml_net_check(&{name}, &{name}_checked);
+    }}
+
+
+    int32_t
+    {name}_predict_unchecked(const float *features)
+    {{
+        return eml_net_predict_unchecked(&{name}_checked, features);
+    }}
+
+
+    void
+    {name}_regress_unchecked(const float *features, float *out)
+    {{
+        eml_net_regress_unchecked(&{name}_checked, features, out);
+    }}
+
+
+    int32_t
+    {name}_predict_logits(const float *features, float *logits, float *margin)
+    {{
+        return eml_net_predict_logits_unchecked(&{name}_checked, features, logits, margin);
+    }}
+
+
+    void
+    {name}_set_profile(EmlNetProfile *profile)
+    {{
+        {name}.profile = profile;
+    }}
+    """)
+
+
+def _prepare_mlp(model, layout, scaler, check_X, low_rank, density):
+    """
+    Factorize, prune and fold the scaler as export_mlp() documents, and check the layouts.
+    Returns the weights, biases, activations and layouts per layer, and the input thresholds of binary layers
+    """
+    if low_rank is not None:
+        model = factorize_low_rank(model, low_rank)
+
+    layouts = _per_layer(layout, len(model.coefs_))
+    if density is not None:
+        coefs = [prune_magnitude(w, density) if lay == 'csr' else w for w, lay in zip(model.coefs_, layouts)]
+        model = MLPWeights(coefs, model.intercepts_, activation=model.activation,
+                           out_activation=model.out_activation_, layer_activations=_layer_activations(model))
+    input_thresholds = None
+    if scaler is not None and layouts[0] in ('binary', 'ternary'):
+        # (x - mean) / scale >= 0 iff x >= mean, the scale does not matter for a sign
+        mean, _ = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+        input_thresholds = np.asarray(mean)
+    elif scaler is not None:
+        mean, scale = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+        folded = fold_scaler(model, mean, scale)
+        if check_X is not None:
+            check_folded(model, folded, mean, scale, check_X)
+        model = folded
+
+    coefs = [np.asarray(w) for w in model.coefs_]
+    biases = [np.asarray(b) for b in model.intercepts_]
+    activations = _layer_activations(model)
+
+    for idx, lay in enumerate(layouts):
+        if lay not in LAYER_TYPES:
+            raise ValueError(f"Unsupported layout '{lay}'. Supported: {list(LAYER_TYPES)}")
+        if lay == 'sparse_input' and (idx == 0 or activations[idx-1] != 'relu'):
+            raise ValueError(f"Layer {idx}: sparse_input needs inputs from a relu layer")
+        if lay in ('binary', 'ternary') and idx != 0:
+            raise ValueError(f"Layer {idx}: {lay} is only supported for layer 0")
+
+    return coefs, biases, activations, layouts, input_thresholds
+
+
+def export_mlp(model, name, layout='dense', header=None, scaler=None, check_X=None, low_rank=None,
+               density=None, feature_index=None):
+    """
+    Generate C code for an EmlNet model
+
+    model: fitted MLPClassifier, or MLPWeights
+    name: C identifier prefix. Defines <name>_predict, <name>_regress, <name>_regress1
+    layout: 'dense' (emlearn default), 'blocked4', 'blocked8', 'int8', 'q15', 'sparse_input', 'float16', 'csr',
+        'codebook', 'codebook_per_output', 'binary' or 'ternary'.
+        Either one for all layers, or a list per layer
+    header: optional header to include first, like "mlp_model.h"
+    scaler: fitted StandardScaler, or (mean, scale). Folded into layer 0, the model then takes raw features
+    check_X: raw features to verify the folded model against the unfolded path (see check_folded)
+    low_rank: factorize layer 0 to this rank (see factorize_low_rank). A per-layer layout then has
+        one entry per exported layer, the bottleneck included
+    density: fraction of weights kept in 'csr' layers, pruned by magnitude before the scaler is folded,
+        so relative to standardized inputs. Default keeps all non-zero weights
+
+    'binary' and 'ternary' (see binarize_weights) are only supported for layer 0, which binarizes the features.
+    With a scaler they are binarized around its mean, instead of folding it.
+
+    When layer 0 is 'dense', 'sparse_input', 'blocked4' or 'blocked8', <name>_accumulate_reset(),
+    <name>_accumulate() and <name>_predict_logits_accumulated() compute it incrementally as the features arrive.
+
+    feature_index: the window features a selected model takes (see select_features), written as the
+    non-static <name>_feature_index[] for the firmware resampler (model_resample_selected in model_registry.h)
+    """
+    coefs, biases, activations, layouts, input_thresholds = _prepare_mlp(
+        model, layout, scaler, check_X, low_rank, density)
+    n_layers = len(coefs)
+
+    lines = []
+    if header:
+        lines.append(f'#include "{header}"')
+    lines.append('#include <eml_net.h>')
+    if feature_index is not None:
+        if len(feature_index) != coefs[0].shape[0]:
+            raise ValueError(f"{len(feature_index)} feature indices for {coefs[0].shape[0]} model inputs")
+        body = ', '.join(str(int(i)) for i in feature_index)
+        lines.append(f"const uint16_t {name}_feature_index[{len(feature_index)}] = {{ {body} }};")
+
+    layer_defs = []
+    for idx, (w, b, act, lay) in enumerate(zip(coefs, biases, activations, layouts)):
+        n_inputs, n_outputs = w.shape
+        prefix = f"{name}_layer_{idx}"
+        if lay != 'float16':
+            lines.append(c_array('float', f"{prefix}_biases", b))
+
+        if lay in ('int8', 'q15'):
+            q, scales = quantize_int8(w) if lay == 'int8' else quantize_q15(w)
+            ctype, params_type = ('int8_t', 'EmlNetInt8Weights') if lay == 'int8' else ('int16_t', 'EmlNetQ15Weights')
+            lines.append(c_array(ctype, f"{prefix}_weights", q))
+            lines.append(c_array('float', f"{prefix}_scales", scales))
+            lines.append(f"static const {params_type} {prefix}_params = "
+                         f"{{ {prefix}_weights, {prefix}_scales }};")
+            layer_defs.append(f"{{ {n_outputs}, {n_inputs}, NULL, {prefix}_biases, "
+                              f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]}, &{prefix}_params }}")
+            continue
+
+        if lay == 'float16':
+            # Half precision bit patterns, weights blocked like blocked8.
+            # Power-of-two scale so that max |w| is in [0.5, 1), away from the float16 subnormals
+            w_max = np.abs(w).max()
+            scale = 2.0 ** np.ceil(np.log2(w_max)) if w_max > 0 else 1.0
+            w16 = (pack_blocked(w, block=8) / scale).astype(np.float16).view(np.uint16)
+            b16 = np.asarray(b).astype(np.float16).view(np.uint16)
+            lines.append(c_array('uint16_t', f"{prefix}_biases", b16, fmt=lambda v: f"0x{int(v):04x}"))
+            lines.append(c_array('uint16_t', f"{prefix}_weights", w16, fmt=lambda v: f"0x{int(v):04x}"))
+            lines.append(f"static const EmlNetFloat16Weights {prefix}_params = "
+                         f"{{ {prefix}_weights, {prefix}_biases, {c_float(scale)} }};")
+            layer_defs.append(f"{{ {n_outputs}, {n_inputs}, NULL, NULL, "
+                              f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]}, &{prefix}_params }}")
+            continue
+
+        if lay in ('codebook', 'codebook_per_output'):
+            per_output = lay == 'codebook_per_output'
+            packed, codebook = pack_codebook(w, per_output=per_output)
+            lines.append(c_array('uint8_t', f"{prefix}_indices", packed, fmt=lambda v: f"0x{int(v):02x}"))
+            lines.append(c_array('float', f"{prefix}_codebook", codebook))
+            lines.append(f"static const EmlNetCodebookWeights {prefix}_params = "
+                         f"{{ {prefix}_indices, {prefix}_codebook, {int(per_output)} }};")
+            layer_defs.append(f"{{ {n_outputs}, {n_inputs}, NULL, {prefix}_biases, "
+                              f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]}, &{prefix}_params }}")
+            continue
+
+        if lay in ('binary', 'ternary'):
+            signs, masks, scales = binarize_weights(w, ternary=(lay == 'ternary'))
+            hex_word = lambda v: f"0x{int(v):08x}"  # noqa: E731
+            lines.append(c_array('uint32_t', f"{prefix}_signs", pack_bits(signs), fmt=hex_word))
+            if masks is not None:
+                lines.append(c_array('uint32_t', f"{prefix}_masks", pack_bits(masks), fmt=hex_word))
+            lines.append(c_array('float', f"{prefix}_scales", scales))
+            if input_thresholds is not None:
+                lines.append(c_array('float', f"{prefix}_thresholds", input_thresholds))
+            masks_name = f"{prefix}_masks" if masks is not None else "NULL"
+            thresholds_name = f"{prefix}_thresholds" if input_thresholds is not None else "NULL"
+            lines.append(f"static const EmlNetBinaryWeights {prefix}_params = "
+                         f"{{ {prefix}_signs, {masks_name}, {prefix}_scales, {thresholds_name} }};")
+            layer_defs.append(f"{{ {n_outputs}, {n_inputs}, NULL, {prefix}_biases, "
+                              f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]}, &{prefix}_params }}")
+            continue
+
+        if lay == 'csr':
+            values, columns, row_offsets = pack_csr(w)
+            if len(values):
+                lines.append(c_array('float', f"{prefix}_values", values))
+                lines.append(c_array('uint16_t', f"{prefix}_columns", columns))
+            lines.append(c_array('uint16_t', f"{prefix}_row_offsets", row_offsets))
+            arrays = f"{prefix}_values, {prefix}_columns" if len(values) else "NULL, NULL"
+            lines.append(f"static const EmlNetCsrWeights {prefix}_params = "
+                         f"{{ {arrays}, {prefix}_row_offsets, {len(values)} }};")
+            layer_defs.append(f"{{ {n_outputs}, {n_inputs}, NULL, {prefix}_biases, "
+                              f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]}, &{prefix}_params }}")
+            continue
+
+        if lay in ('dense', 'sparse_input'):
+            packed = w.ravel()
+        else:
+            packed = pack_blocked(w, block=int(lay[len('blocked'):]))
+        lines.append(c_array('float', f"{prefix}_weights", packed))
+        layer_defs.append(f"{{ {n_outputs}, {n_inputs}, {prefix}_weights, {prefix}_biases, "
+                          f"{ACTIVATIONS[act]}, {LAYER_TYPES[lay]} }}")
+
+    scratch_bytes = max(int(np.ceil(w.shape[0] * SCRATCH_BYTES_PER_INPUT.get(lay, 0) / 4)) * 4
+                        for w, lay in zip(coefs, layouts))
+    _emit_net(lines, name, layer_defs, [w.shape[1] for w in coefs], [False] * n_layers, scratch_bytes)
+    if layouts[0] in ('dense', 'sparse_input', 'blocked4', 'blocked8') and n_layers >= 2:
+        # Incremental layer 0, for inputs that arrive over time (eml_net_dense_accumulate)
+        n_hidden = coefs[0].shape[1]
+        lines.append(f"""
+    void
+    {name}_accumulate_reset(float *acc)
+    {{
+        for (int32_t o = 0; o < {n_hidden}; o++) {{
+            acc[o] = {name}_layers[0].biases[o];
+        }}
+    }}
+
+
+    int32_t
+    {name}_accumulate(int32_t offset, const float *values, int32_t n_values, float *acc)
+    {{
+        return eml_net_dense_accumulate(&{name}_layers[0], offset, values, n_values, acc);
+    }}
+
+
+    int32_t
+    {name}_predict_logits_accumulated(float *acc, float *logits, float *margin)
+    {{
+        eml_net_layer_activate(&{name}_layers[0], acc);
+        return eml_net_predict_logits_from_unchecked(&{name}_checked, 1, acc, logits, margin);
+    }}
+    """)
+    return '\n'.join(lines)
+
+
+def export_mlp_cpp(model, name, scaler=None, check_X=None):
+    """
+    Generate a C++17 header for the templates in Firmware/Core/Inc/eml_net.hpp
+
+    The layer sizes become template parameters and the weights inline constexpr arrays,
+    so the compiler sees the exact shape. Defines namespace <name> with the model object `model`,
+    an eml::Sequential of eml::Dense layers. Only float dense layers (the emlearn layout).
+    scaler and check_X as for export_mlp()
+    """
+    if scaler is not None:
+        mean, scale = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+        folded = fold_scaler(model, mean, scale)
+        if check_X is not None:
+            check_folded(model, folded, mean, scale, check_X)
+        model = folded
+
+    lines = ['#pragma once', '#include <eml_net.hpp>', '', f"namespace {name} {{", '']
+    layer_types, layer_inits = [], []
+    for idx, (w, b, act) in enumerate(zip(model.coefs_, model.intercepts_, _layer_activations(model))):
+        w = np.asarray(w)
+        for array, values in ((f"layer_{idx}_weights", w), (f"layer_{idx}_biases", b)):
+            lines.append(c_array('float', array, values).replace('static const', 'inline constexpr'))
+        layer_types.append(f"eml::Dense<{w.shape[0]}, {w.shape[1]}, {ACTIVATIONS[act]}>")
+        layer_inits.append(f"{{ layer_{idx}_weights, layer_{idx}_biases }}")
+
+    lines.append('')
+    lines.append("using Model = eml::Sequential<\n    " + ",\n    ".join(layer_types) + "\n>;")
+    lines.append("inline constexpr Model model { " + ", ".join(layer_inits) + " };")
+    lines.append('')
+    lines.append(f"}} // namespace {name}")
+    return '\n'.join(lines) + '\n'
+
+
+# Values of EmlNetLayerType and EmlNetActivationFunction (eml_net_common.h), as stored in blobs
+BLOB_LAYER_TYPES = [
+    'EmlNetLayerDense', 'EmlNetLayerDenseBlocked4', 'EmlNetLayerDenseBlocked8', 'EmlNetLayerDenseInt8',
+    'EmlNetLayerDenseQ15', 'EmlNetLayerDenseSparseInput', 'EmlNetLayerDenseFloat16', 'EmlNetLayerDenseCsr',
+    'EmlNetLayerDenseCodebook', 'EmlNetLayerDenseBinary',
+]
+BLOB_ACTIVATIONS = ['identity', 'relu', 'logistic', 'softmax', 'tanh']
+BLOB_MAGIC = 0x4E4C4D45
+BLOB_VERSION = 1
+BLOB_ALIGN = 16
+BLOB_HEADER_SIZE = 64
+BLOB_LAYER_SIZE = 64
+
+
+class _BlobArrays:
+    """Arrays of a blob after the header and layer table, each at an offset aligned to BLOB_ALIGN"""
+
+    def __init__(self, start):
+        self.start = start
+        self.data = bytearray()
+
+    def add(self, values, dtype):
+        if values is None:
+            return 0
+        self.data += bytes(-(self.start + len(self.data)) % BLOB_ALIGN)
+        offset = self.start + len(self.data)
+        self.data += np.ascontiguousarray(values, dtype=dtype).astype(dtype.newbyteorder('<')).tobytes()
+        return offset
+
+
+def export_mlp_blob(model, layout='dense', scaler=None, fold=True, class_names=None, check_X=None,
+                    low_rank=None, density=None):
+    """
+    Serialize an EmlNet model to the blob format of Firmware/Core/Inc/eml_net_blob.h
+
+    The blob is used in place by eml_net_blob_load(), from flash or an mmap'd file, so models can be
+    replaced without rebuilding the firmware. Same weights as export_mlp() with the same arguments.
+    fold: fold the scaler into layer 0 like export_mlp(). Otherwise it is stored in the blob,
+        for eml_net_blob_scale(), and layer 0 takes standardized features
+    class_names: optional names of the outputs, see eml_net_blob_class_name()
+    Returns bytes
+    """
+    stored_scaler = None
+    if scaler is not None and not fold:
+        stored_scaler = scaler if isinstance(scaler, tuple) else (scaler.mean_, scaler.scale_)
+        scaler = None
+    coefs, biases, activations, layouts, input_thresholds = _prepare_mlp(
+        model, layout, scaler, check_X, low_rank, density)
+    n_layers = len(coefs)
+    if class_names is not None and len(class_names) != coefs[-1].shape[1]:
+        raise ValueError(f"{len(class_names)} class names for {coefs[-1].shape[1]} outputs")
+
+    f32, u16 = np.dtype(np.float32), np.dtype(np.uint16)
+    layers_offset = BLOB_HEADER_SIZE
+    arrays = _BlobArrays(layers_offset + n_layers * BLOB_LAYER_SIZE)
+    records = []
+    for w, b, act, lay in zip(coefs, biases, activations, layouts):
+        n_inputs, n_outputs = w.shape
+        weights, biases_offset, params, values = 0, 0, [0, 0, 0, 0], [0] * 6
+        if lay != 'float16':
+            biases_offset = arrays.add(b, f32)
+
+        if lay in ('int8', 'q15'):
+            q, scales = quantize_int8(w) if lay == 'int8' else quantize_q15(w)
+            params[:2] = [arrays.add(q, q.dtype), arrays.add(scales, f32)]
+        elif lay == 'float16':
+            w_max = np.abs(w).max()
+            scale = 2.0 ** np.ceil(np.log2(w_max)) if w_max > 0 else 1.0
+            w16 = (pack_blocked(w, block=8) / scale).astype(np.float16).view(np.uint16)
+            b16 = np.asarray(b).astype(np.float16).view(np.uint16)
+            params[:2] = [arrays.add(w16, u16), arrays.add(b16, u16)]
+            values[0] = int(np.array(scale, dtype=np.float32).view(np.int32))
+        elif lay in ('codebook', 'codebook_per_output'):
+            packed, codebook = pack_codebook(w, per_output=(lay == 'codebook_per_output'))
+            params[:2] = [arrays.add(packed, np.dtype(np.uint8)), arrays.add(codebook, f32)]
+            values[0] = int(lay == 'codebook_per_output')
+        elif lay in ('binary', 'ternary'):
+            signs, masks, scales = binarize_weights(w, ternary=(lay == 'ternary'))
+            u32 = np.dtype(np.uint32)
+            params = [arrays.add(pack_bits(signs), u32),
+                      arrays.add(pack_bits(masks) if masks is not None else None, u32),
+                      arrays.add(scales, f32), arrays.add(input_thresholds, f32)]
+        elif lay == 'csr':
+            csr_values, columns, row_offsets = pack_csr(w)
+            kept = len(csr_values) > 0
+            params[:3] = [arrays.add(csr_values if kept else None, f32),
+                          arrays.add(columns if kept else None, u16), arrays.add(row_offsets, u16)]
+            values[0] = len(csr_values)
+        elif lay in ('dense', 'sparse_input'):
+            weights = arrays.add(w, f32)
+        else:
+            weights = arrays.add(pack_blocked(w, block=int(lay[len('blocked'):])), f32)
+
+        layer_type = BLOB_LAYER_TYPES.index(LAYER_TYPES[lay])
+        records.append(np.array([layer_type, BLOB_ACTIVATIONS.index(act), n_inputs, n_outputs],
+                                dtype='<i4').tobytes()
+                       + np.array([weights, biases_offset] + params, dtype='<u4').tobytes()
+                       + np.array(values, dtype='<i4').tobytes())
+
+    n_inputs, n_outputs = coefs[0].shape[0], coefs[-1].shape[1]
+    mean_offset = arrays.add(stored_scaler[0] if stored_scaler else None, f32)
+    scale_offset = arrays.add(stored_scaler[1] if stored_scaler else None, f32)
+    names_offset = 0
+    if class_names is not None:
+        # Offsets first, then the strings after them
+        names_offset = arrays.add(np.zeros(n_outputs), np.dtype(np.uint32))
+        name_offsets = []
+        for class_name in class_names:
+            name_offsets.append(arrays.start + len(arrays.data))
+            arrays.data += class_name.encode('utf-8') + b'\0'
+        start = names_offset - arrays.start
+        arrays.data[start:start + 4 * n_outputs] = np.array(name_offsets, dtype='<u4').tobytes()
+
+    body = b''.join(records) + bytes(arrays.data)
+    body += bytes(-(BLOB_HEADER_SIZE + len(body)) % BLOB_ALIGN)
+    total_size = BLOB_HEADER_SIZE + len(body)
+    header = (np.array([BLOB_MAGIC], dtype='<u4').tobytes()
+              + np.array([BLOB_VERSION, BLOB_HEADER_SIZE], dtype='<u2').tobytes()
+              + np.array([total_size, zlib.crc32(body)], dtype='<u4').tobytes()
+              + np.array([n_layers, n_inputs, n_outputs], dtype='<i4').tobytes()
+              + np.array([layers_offset, mean_offset, scale_offset, names_offset], dtype='<u4').tobytes()
+              + bytes(4 * 5))
+    assert len(header) == BLOB_HEADER_SIZE
+    return header + body
+
+
+class Conv1D:
+    """
+    1D convolution over a channels-last time series (EmlNetLayerConv1D), no padding.
+    weights: (kernel_size, in_channels, out_channels), biases: (out_channels,)
+    """
+
+    def __init__(self, weights, biases, stride=1, dilation=1, activation='relu'):
+        self.weights = np.asarray(weights, dtype=np.float64)
+        self.biases = np.asarray(biases, dtype=np.float64)
+        self.stride = stride
+        self.dilation = dilation
+        self.activation = activation
+        self.kernel_size, self.in_channels, self.out_channels = self.weights.shape
+
+
+class DepthwiseConv1D(Conv1D):
+    """
+    Depthwise 1D convolution, one filter per channel (EmlNetLayerConv1DDepthwise).
+    weights: (kernel_size, channels), biases: (channels,).
+    Follow with a Conv1D of kernel_size 1 for a depthwise-separable convolution
+    """
+
+    def __init__(self, weights, biases, stride=1, dilation=1, activation='identity'):
+        self.weights = np.asarray(weights, dtype=np.float64)
+        self.biases = np.asarray(biases, dtype=np.float64)
+        self.stride = stride
+        self.dilation = dilation
+        self.activation = activation
+        self.kernel_size, self.in_channels = self.weights.shape
+        self.out_channels = self.in_channels
+
+
+class Pool1D:
+    """Max or average pooling over time, per channel (EmlNetLayerMaxPool1D, EmlNetLayerAvgPool1D)"""
+
+    def __init__(self, channels, size, stride=None, dilation=1, kind='max'):
+        if kind not in ('max', 'avg'):
+            raise ValueError(f"Unsupported pooling '{kind}'")
+        self.in_channels = self.out_channels = channels
+        self.kernel_size = size
+        self.stride = stride or size
+        self.dilation = dilation
+        self.kind = kind
+        self.activation = 'identity'
+
+
+class GRU:
+    """
+    GRU over a channels-last sequence, outputs the last hidden state (EmlNetLayerGru).
+    Keras weight layout (reset_after=True): input_weights (n_features, 3*hidden) and
+    recurrent_weights (hidden, 3*hidden) with gates z, r, n, biases (2, 3*hidden) for input and recurrent.
+    As layer 0 of export_sequential(), the model also gets streaming functions (one step per call)
+    """
+
+    def __init__(self, input_weights, recurrent_weights, biases, activation='identity'):
+        self.input_weights = np.asarray(input_weights, dtype=np.float64)
+        self.recurrent_weights = np.asarray(recurrent_weights, dtype=np.float64)
+        self.biases = np.asarray(biases, dtype=np.float64).reshape(2, -1)
+        self.activation = activation
+        self.in_channels = self.input_weights.shape[0]
+        self.hidden = self.recurrent_weights.shape[0]
+
+    def fold_scaler(self, mean, scale):
+        """Absorb a per-channel (x - mean) / scale into the input weights, like fold_scaler()"""
+        scale = np.where(np.asarray(scale) == 0.0, 1.0, scale)
+        folded = GRU(self.input_weights / scale[:, None], self.recurrent_weights, self.biases.copy(),
+                     activation=self.activation)
+        folded.biases[0] -= (np.asarray(mean) / scale) @ self.input_weights
+        return folded
+
+    def forward(self, X, dtype=np.float64):
+        """Last hidden state for X of shape (n_samples, n_steps * n_features), from a zero state"""
+        x = np.asarray(X, dtype=dtype).reshape(len(X), -1, self.in_channels)
+        wx, wh = self.input_weights.astype(dtype), self.recurrent_weights.astype(dtype)
+        bx, bh = self.biases.astype(dtype)
+        H = self.hidden
+        h = np.zeros((len(x), H), dtype=dtype)
+        for t in range(x.shape[1]):
+            gx = x[:, t] @ wx + bx
+            gh = h @ wh + bh
+            z = 1.0 / (1.0 + np.exp(-(gx[:, :H] + gh[:, :H])))
+            r = 1.0 / (1.0 + np.exp(-(gx[:, H:2*H] + gh[:, H:2*H])))
+            n = np.tanh(gx[:, 2*H:] + r * gh[:, 2*H:])
+            h = (1.0 - z) * n + z * h
+        return h
+
+
+class Dense:
+    """Fully connected layer over the flattened input. weights: (n_inputs, n_outputs)"""
+
+    def __init__(self, weights, biases, activation='relu', layout='dense'):
+        self.weights = np.asarray(weights, dtype=np.float64)
+        self.biases = np.asarray(biases, dtype=np.float64)
+        self.activation = activation
+        self.layout = layout
+
+
+def _conv_steps(layer, in_steps):
+    span = layer.dilation * (layer.kernel_size - 1) + 1
+    if in_steps < span:
+        raise ValueError(f"Input of {in_steps} steps is shorter than the kernel span {span}")
+    return (in_steps - span) // layer.stride + 1
+
+
+def sequential_forward(layers, X, dtype=np.float64):
+    """
+    Reference forward pass of Conv1D, DepthwiseConv1D, Pool1D and Dense layers.
+    X: (n_samples, steps * channels), channels-last. Returns the outputs of the last layer
+    """
+    functions = {
+        'identity': lambda a: a,
+        'relu': lambda a: np.maximum(a, 0),
+        'logistic': lambda a: 1.0 / (1.0 + np.exp(-a)),
+        'tanh': np.tanh,
+        'softmax': lambda a: np.exp(a - a.max(axis=1, keepdims=True))
+                              / np.exp(a - a.max(axis=1, keepdims=True)).sum(axis=1, keepdims=True),
+    }
+    a = np.asarray(X, dtype=dtype)
+    for layer in layers:
+        if isinstance(layer, Dense):
+            a = a @ layer.weights.astype(dtype) + layer.biases.astype(dtype)
+        elif isinstance(layer, GRU):
+            a = layer.forward(a, dtype=dtype)
+        else:
+            x = a.reshape(len(a), -1, layer.in_channels)
+            n_steps = _conv_steps(layer, x.shape[1])
+            taps = [x[:, k * layer.dilation::layer.stride, :][:, :n_steps] for k in range(layer.kernel_size)]
+            if isinstance(layer, Pool1D):
+                y = np.max(taps, axis=0) if layer.kind == 'max' else np.mean(taps, axis=0)
+            elif isinstance(layer, DepthwiseConv1D):
+                y = sum(t * layer.weights[k].astype(dtype) for k, t in enumerate(taps)) + layer.biases.astype(dtype)
+            else:
+                y = sum(t @ layer.weights[k].astype(dtype) for k, t in enumerate(taps)) + layer.biases.astype(dtype)
+            a = y.reshape(len(a), -1)
+        a = functions[layer.activation](a)
+    return a
+
+
+def export_sequential(layers, name, input_shape, header=None):
+    """
+    Generate C code for an EmlNet model of Conv1D, DepthwiseConv1D, Pool1D, GRU and Dense layers
+
+    layers: list of layer objects, applied in order. Dense layers flatten their input
+    input_shape: (steps, channels) of the channels-last input
+    Activation buffers are planned with plan_buffers(), so chains of convolution and pooling layers
+    that can run in place share one buffer.
+
+    With a GRU as layer 0 the model also defines <name>_stream_reset(), <name>_stream_push(sample)
+    to update the GRU state with one step of inputs, and <name>_stream_predict_logits(logits, margin)
+    to run the remaining layers on the state (needs <name>_check() first).
+    """
+    lines = []
+    if header:
+        lines.append(f'#include "{header}"')
+    lines.append('#include <eml_net.h>')
+
+    steps, channels = input_shape
+    n_inputs = steps * channels
+    layer_defs, n_outputs, in_place = [], [], []
+    scratch_bytes = 0
+    for idx, layer in enumerate(layers):
+        prefix = f"{name}_layer_{idx}"
+        act = ACTIVATIONS[layer.activation]
+        if isinstance(layer, Dense):
+            if layer.weights.shape[0] != n_inputs:
+                raise ValueError(f"Layer {idx}: expected {n_inputs} inputs, got {layer.weights.shape[0]}")
+            if layer.layout not in ('dense', 'blocked4', 'blocked8'):
+                raise ValueError(f"Layer {idx}: export_sequential supports float dense layouts, not {layer.layout}")
+            w = layer.weights
+            packed = w.ravel() if layer.layout == 'dense' else pack_blocked(w, block=int(layer.layout[len('blocked'):]))
+            lines.append(c_array('float', f"{prefix}_biases", layer.biases))
+            lines.append(c_array('float', f"{prefix}_weights", packed))
+            layer_defs.append(f"{{ {w.shape[1]}, {n_inputs}, {prefix}_weights, {prefix}_biases, "
+                              f"{act}, {LAYER_TYPES[layer.layout]} }}")
+            n_inputs = w.shape[1]
+            steps, channels = n_inputs, 1
+            n_outputs.append(n_inputs)
+            in_place.append(False)
+            continue
+
+        if isinstance(layer, GRU):
+            if layer.in_channels != channels:
+                raise ValueError(f"Layer {idx}: expected {channels} input channels, got {layer.in_channels}")
+            H = layer.hidden
+            lines.append(c_array('float', f"{prefix}_input_weights", layer.input_weights))
+            lines.append(c_array('float', f"{prefix}_recurrent_weights", layer.recurrent_weights))
+            lines.append(c_array('float', f"{prefix}_input_biases", layer.biases[0]))
+            lines.append(c_array('float', f"{prefix}_recurrent_biases", layer.biases[1]))
+            lines.append(f"static const EmlNetGruParams {prefix}_params = {{ {channels}, "
+                         f"{prefix}_input_weights, {prefix}_recurrent_weights, "
+                         f"{prefix}_input_biases, {prefix}_recurrent_biases }};")
+            layer_defs.append(f"{{ {H}, {n_inputs}, NULL, NULL, {act}, EmlNetLayerGru, &{prefix}_params }}")
+            # Same as eml_net_layer_scratch_size()
+            scratch_bytes = max(scratch_bytes, 6 * H * 4)
+            n_inputs = H
+            steps, channels = H, 1
+            n_outputs.append(H)
+            in_place.append(False)
+            continue
+
+        if layer.in_channels != channels:
+            raise ValueError(f"Layer {idx}: expected {channels} input channels, got {layer.in_channels}")
+        out_steps = _conv_steps(layer, steps)
+        lines.append(f"static const EmlNetConv1DParams {prefix}_params = {{ {layer.in_channels}, "
+                     f"{layer.out_channels}, {layer.kernel_size}, {layer.stride}, {layer.dilation} }};")
+        if isinstance(layer, Pool1D):
+            weights = biases = 'NULL'
+            layer_type = 'EmlNetLayerMaxPool1D' if layer.kind == 'max' else 'EmlNetLayerAvgPool1D'
+        else:
+            lines.append(c_array('float', f"{prefix}_biases", layer.biases))
+            lines.append(c_array('float', f"{prefix}_weights", layer.weights))
+            weights, biases = f"{prefix}_weights", f"{prefix}_biases"
+            layer_type = 'EmlNetLayerConv1DDepthwise' if isinstance(layer, DepthwiseConv1D) else 'EmlNetLayerConv1D'
+        out_length = out_steps * layer.out_channels
+        layer_defs.append(f"{{ {out_length}, {n_inputs}, {weights}, {biases}, {act}, {layer_type}, &{prefix}_params }}")
+
+        n_outputs.append(out_length)
+        # Same rule as eml_net_layer_in_place()
+        in_place.append(layer.out_channels <= layer.stride * layer.in_channels)
+        steps, channels, n_inputs = out_steps, layer.out_channels, out_length
+
+    _emit_net(lines, name, layer_defs, n_outputs, in_place, scratch_bytes)
+    if isinstance(layers[0], GRU):
+        if any(isinstance(layer, GRU) for layer in layers[1:]) or len(layers) < 2:
+            raise ValueError("Streaming needs one GRU as layer 0, followed by at least one layer")
+        lines.append(f"""
+    static float {name}_state[{layers[0].hidden}];
+
+    void
+    {name}_stream_reset(void)
+    {{
+        for (int i=0; i<{layers[0].hidden}; i++) {{
+            {name}_state[i] = 0.0f;
+        }}
+    }}
+
+
+    int32_t
+    {name}_stream_push(const float *sample)
+    {{
+        return eml_net_gru_step(&{name}_layers[0], sample, {name}_state, {name}_scratch, sizeof({name}_scratch));
+    }}
+
+
+    int32_t
+    {name}_stream_predict_logits(float *logits, float *margin)
+    {{
+        return eml_net_predict_logits_from_unchecked(&{name}_checked, 1, {name}_state, logits, margin);
+    }}
+    """)
+    return '\n'.join(lines)
+
+
+
+class TreeEnsemble:
+    """
+    Decision nodes of a forest in the flat layout of eml_trees.h.
+
+    Node n goes to left[n] when features[feature[n]] < threshold[n] (int16), else to right[n].
+    Children and roots >= 0 are nodes, negative ones are leaves: -1 - class.
+    Nodes are in depth-first order, each tree after the previous one
+    """
+
+    def __init__(self, feature, threshold, left, right, roots, n_classes):
+        self.feature = np.asarray(feature, dtype=np.int64)
+        self.threshold = np.asarray(threshold, dtype=np.int64)
+        self.left = np.asarray(left, dtype=np.int64)
+        self.right = np.asarray(right, dtype=np.int64)
+        self.roots = np.asarray(roots, dtype=np.int64)
+        self.n_classes = int(n_classes)
+
+    @property
+    def n_features(self):
+        return int(self.feature.max()) + 1 if len(self.feature) else 0
+
+
+class _TreeBuilder:
+    """Appends trees node by node in depth-first order"""
+
+    def __init__(self):
+        self.feature, self.threshold, self.left, self.right, self.roots = [], [], [], [], []
+
+    def add(self, walk):
+        """walk(emit_leaf, emit_node) returns the root, see load_emlearn_trees_c and trees_from_sklearn"""
+        self.roots.append(walk(self.leaf, self.node))
+
+    def leaf(self, cls):
+        return -1 - int(cls)
+
+    def node(self, feature, threshold, left, right):
+        # Reserve the node before its subtrees, so that children come after their parent
+        n = len(self.feature)
+        self.feature.append(int(feature))
+        self.threshold.append(int(threshold))
+        self.left.append(None)
+        self.right.append(None)
+        self.left[n] = left()
+        self.right[n] = right()
+        return n
+
+    def build(self, n_classes):
+        return TreeEnsemble(self.feature, self.threshold, self.left, self.right, self.roots, n_classes)
+
+
+def load_emlearn_trees_c(path):
+    """Load the trees of an emlearn-generated random forest (method='inline') from its C source"""
+    text = Path(path).read_text()
+    votes = re.search(r'int32_t votes\[(\d+)\]', text)
+    if not votes:
+        raise ValueError(f"No emlearn forest found in {path}")
+    bodies = re.split(r'static inline int32_t \w+_tree_\d+\(', text)[1:]
+    token = re.compile(r'if \(features\[(\d+)\] < (-?\d+)\)|return (-?\d+);')
+
+    builder = _TreeBuilder()
+    for body in bodies:
+        # Each function ends at the predict function, or at the next tree
+        tokens = iter(token.findall(body.split('_predict(')[0]))
+
+        def walk(leaf, node):
+            feature, threshold, cls = next(tokens)
+            if cls:
+                return leaf(cls)
+            return node(feature, threshold, lambda: walk(leaf, node), lambda: walk(leaf, node))
+        builder.add(walk)
+    return builder.build(int(votes.group(1)))
+
+
+def trees_from_sklearn(forest):
+    """
+    Flat trees of a fitted sklearn RandomForestClassifier (or one DecisionTreeClassifier), for int16 features.
+    For integers x <= t is x < floor(t) + 1, the threshold stored. Leaves take the majority class of the tree
+    """
+    estimators = getattr(forest, 'estimators_', [forest])
+    builder = _TreeBuilder()
+    for estimator in estimators:
+        tree = estimator.tree_
+
+        def walk(leaf, node, i=0, tree=tree):
+            if tree.children_left[i] < 0:
+                return leaf(np.argmax(tree.value[i][0]))
+            threshold = int(np.clip(np.floor(tree.threshold[i]) + 1, -32768, 32767))
+            return node(tree.feature[i], threshold,
+                        lambda: walk(leaf, node, tree.children_left[i]),
+                        lambda: walk(leaf, node, tree.children_right[i]))
+        builder.add(walk)
+    return builder.build(len(forest.classes_))
+
+
+def trees_votes(trees, X):
+    """Reference traversal. Returns the votes per class, shape (n_samples, n_classes)"""
+    X = np.asarray(X)
+    votes = np.zeros((len(X), trees.n_classes), dtype=np.int64)
+    rows = np.arange(len(X))
+    for root in trees.roots:
+        node = np.full(len(X), root)
+        while (node >= 0).any():
+            active = node >= 0
+            n = node[active]
+            below = X[rows[active], trees.feature[n]] < trees.threshold[n]
+            node[active] = np.where(below, trees.left[n], trees.right[n])
+        np.add.at(votes, (rows, -1 - node), 1)
+    return votes
+
+
+def export_trees(trees, name, header=None):
+    """
+    Generate C code for a forest in the table-driven layout of eml_trees.h
+
+    trees: TreeEnsemble, from load_emlearn_trees_c() or trees_from_sklearn()
+    name: C identifier prefix. Defines <name>_check, and <name>_predict and <name>_predict_proba
+        with the signatures of the emlearn-generated forests
+    header: optional header to include first, like "rf_model.h"
+    """
+    if len(trees.feature) > 32767:
+        raise ValueError(f"{len(trees.feature)} nodes do not fit the int16 node indices")
+    lines = []
+    if header:
+        lines.append(f'#include "{header}"')
+    lines.append('#include <eml_trees.h>')
+
+    n_nodes, n_trees = len(trees.feature), len(trees.roots)
+    lines.append(c_array('uint16_t', f"{name}_feature", trees.feature))
+    lines.append(c_array('int16_t', f"{name}_threshold", trees.threshold))
+    lines.append(c_array('int16_t', f"{name}_left", trees.left))
+    lines.append(c_array('int16_t', f"{name}_right", trees.right))
+    lines.append(c_array('int16_t', f"{name}_roots", trees.roots))
+    lines.append(f"static const EmlTrees {name} = {{ {n_nodes}, {n_trees}, {trees.n_classes}, {trees.n_features}, "
+                 f"{name}_feature, {name}_threshold, {name}_left, {name}_right, {name}_roots }};")
+    lines.append(f"""
+    int32_t
+    {name}_check(void)
+    {{
+        return eml_trees_check(&{name});
+    }}
+
+
+    int32_t
+    {name}_predict(const int16_t *features, int32_t features_length)
+    {{
+        return eml_trees_predict(&{name}, features, features_length);
+    }}
+
+
+    int
+    {name}_predict_proba(const int16_t *features, int32_t features_length, float *out, int out_length)
+    {{
+        return eml_trees_predict_proba(&{name}, features, features_length, out, out_length);
+    }}
+    """)
+    return '\n'.join(lines)
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(description='Re-export an emlearn-generated MLP C file')
+    parser.add_argument('source', help='emlearn generated C file, like builds/mlp_perf__32_32__1e_05.c '
+                                       '(or builds/rf_perf_25_6.c with --trees)')
+    parser.add_argument('output', help='C file to write (blob file with --blob)')
+    parser.add_argument('--name', default=None, help='C identifier prefix, required except with --blob')
+    parser.add_argument('--layout', default='dense',
+                        help=f"one of {sorted(LAYER_TYPES)}, or a comma-separated list with one per layer")
+    parser.add_argument('--header', default=None, help='header to include, like mlp_model.h')
+    parser.add_argument('--fold-scaler', default=None, metavar='SCALER_C',
+                        help='fold the scaler in this C file (like mlp_scaler.c) into layer 0')
+    parser.add_argument('--check-data', default=None, metavar='DIR',
+                        help='directory of raw CSVs to verify the folded model against the unfolded path')
+    parser.add_argument('--low-rank', default=None, type=int, metavar='R',
+                        help='factorize layer 0 into an identity bottleneck of R outputs and a second layer')
+    parser.add_argument('--cpp', action='store_true',
+                        help='write a C++ header for eml_net.hpp instead (only the dense layout)')
+    parser.add_argument('--density', default=None, type=float, metavar='D',
+                        help='prune csr layers by magnitude, keeping this fraction of the weights')
+    parser.add_argument('--blob', action='store_true',
+                        help='write a binary model blob for eml_net_blob.h instead of C code')
+    parser.add_argument('--blob-scaler', action='store_true',
+                        help='with --blob and --fold-scaler, store the scaler in the blob instead of folding it')
+    parser.add_argument('--class-names', default=None, metavar='NAMES',
+                        help='with --blob, comma-separated names of the classes')
+    parser.add_argument('--select-features', default=None, type=int, metavar='K',
+                        help='keep only the K most important time steps (or axes) of the inputs, '
+                             'and write their indices as <name>_feature_index. With --check-data, layer 0 is refit')
+    parser.add_argument('--select-group', default='step', choices=['step', 'axis'],
+                        help='with --select-features, drop whole time steps or whole axes')
+    parser.add_argument('--select-method', default='weight_norm', choices=['weight_norm', 'permutation'],
+                        help='with --select-features, rank by layer 0 weight norm, or by permutation '
+                             'importance on --check-data')
+    parser.add_argument('--trees', action='store_true',
+                        help='the source is an emlearn random forest, write it for the table-driven eml_trees.h')
+    args = parser.parse_args()
+
+    if args.name is None and not args.blob:
+        parser.error('--name is required')
+    if args.trees:
+        trees = load_emlearn_trees_c(args.source)
+        if args.check_data:
+            # The forests take the raw window rounded to int16, like model_build_int16 in model_registry.c
+            X, y = load_dataset_csv(args.check_data)
+            votes = trees_votes(trees, np.clip(np.round(X), -32768, 32767))
+            print(f"{len(trees.roots)} trees, {len(trees.feature)} nodes, "
+                  f"accuracy {np.mean(votes.argmax(axis=1) == y):.4f}")
+        Path(args.output).write_text(export_trees(trees, args.name, header=args.header))
+        return
+    model = load_emlearn_c(args.source)
+    scaler = load_scaler_c(args.fold_scaler) if args.fold_scaler else None
+    check_X, check_y = load_dataset_csv(args.check_data) if args.check_data else (None, None)
+    layout = args.layout.split(',') if ',' in args.layout else args.layout
+    feature_index = None
+    if args.select_features:
+        if args.cpp or args.blob:
+            parser.error('--select-features writes C code, not with --cpp or --blob')
+        if args.select_method == 'permutation' and check_X is None:
+            parser.error('--select-method permutation needs --check-data')
+        feature_index, model, scaler = select_features(model, args.select_features, group=args.select_group,
+                                                       method=args.select_method, X=check_X, y=check_y,
+                                                       scaler=scaler)
+        if check_X is not None:
+            check_X = check_X[:, feature_index]
+    if args.cpp:
+        if args.layout != 'dense' or args.low_rank or args.density:
+            parser.error('--cpp supports only the dense layout')
+        Path(args.output).write_text(export_mlp_cpp(model, args.name, scaler=scaler, check_X=check_X))
+        return
+    if args.blob:
+        class_names = args.class_names.split(',') if args.class_names else None
+        blob = export_mlp_blob(model, layout=layout, scaler=scaler, fold=not args.blob_scaler,
+                               class_names=class_names, check_X=check_X, low_rank=args.low_rank,
+                               density=args.density)
+        Path(args.output).write_bytes(blob)
+        return
+    code = export_mlp(model, args.name, layout=layout, header=args.header,
+                      scaler=scaler, check_X=check_X, low_rank=args.low_rank, density=args.density,
+                      feature_index=feature_index)
+    Path(args.output).write_text(code)
+
+
+if __name__ == '__main__':
+    main()
@@ -6,13 +6,13 @@ static const float mynet_layer_1_biases[32] = { 0.142593f, -0.048404f, 0.149518f
 static const float mynet_layer_1_weights[1024] = { 0.129172f, 0.229553f, 0.004580f, 0.008782f, -0.071500f, -0.137871f, -0.040739f, -0.140197f, 0.225911f, -0.282815f, -0.311771f, 0.002811f, 0.037837f, 0.273044f, -0.042018f, -0.034928f, 0.167252f, 0.144118f, 0.171648f, -0.140654f, 0.022147f, 0.011363f, 0.052384f, 0.195172f, -0.068745f, -0.172605f, -0.025148f, -0.208314f, -0.316183f, -0.315679f, -0.037041f, -0.024692f, -0.154473f, 0.077816f, -0.018552f, -0.036552f, 0.305347f, 0.292058f, 0.131239f, -0.163087f, 0.192511f, 0.088458f, 0.187821f, 0.043745f, -0.053224f, -0.058957f, 0.302807f, 0.250256f, 0.303429f, 0.135829f, 0.141896f, 0.288721f, -0.165554f, -0.028086f, -0.210638f, -0.293751f, -0.209620f, 0.042875f, 0.257027f, -0.275729f, 0.213718f, -0.234959f, -0.155345f, -0.110426f, 0.099807f, -0.027783f, -0.043129f, 0.176317f, 0.213566f, 0.253590f, 0.207320f, 0.278519f, -0.237947f, 0.315146f, 0.234882f, 0.105615f, 0.151848f, -0.133530f, 0.022636f, -0.183835f, 0.132982f, 0.201748f, -0.204489f, -0.225596f, 0.005625f, 0.108203f, 0.219621f, 0.051082f, 0.178593f, -0.153011f, -0.097312f, 0.185992f, 0.118311f, -0.199751f, 0.256956f, 0.307215f, 0.032635f, 0.165442f, 0.293469f, 0.158865f, 0.058070f, -0.153513f, 0.186917f, -0.151197f, -0.005035f, 0.012244f, 0.034825f, 0.192096f, -0.128712f, 0.232270f, 0.167007f, -0.149907f, 0.182515f, -0.152852f, 0.181524f, -0.150958f, -0.203230f, -0.061868f, 0.312588f, -0.139282f, -0.077022f, -0.277501f, 0.023490f, 0.133354f, -0.294994f, -0.170418f, -0.141524f, -0.183767f, -0.278773f, 0.062984f, -0.214583f, 0.074444f, -0.016321f, 0.306926f, 0.267059f, 0.044572f, -0.298156f, 0.251755f, 0.055373f, -0.182994f, -0.206966f, 0.029272f, 0.055830f, -0.227632f, -0.046235f, -0.154363f, -0.272219f, 0.129336f, 0.220714f, 0.163326f, 0.004711f, -0.057747f, 0.116004f, -0.237629f, -0.023613f, 0.272741f, -0.143329f, -0.312205f, -0.193744f, -0.015216f, -0.005600f, 0.127787f, -0.055740f, -0.036617f, 0.056760f, 0.082402f, 0.246091f, 0.249159f, 0.154150f, -0.138786f, -0.252969f, -0.141276f, 0.024429f, 0.221957f, -0.197024f, -0.305717f, 0.089586f, 0.003264f, 0.002863f, -0.189149f, -0.207526f, -0.011318f, -0.285644f, -0.069139f, -0.103389f, 0.001169f, 0.213724f, -0.269737f, 0.196431f, -0.052403f, 0.273246f, 0.033233f, 0.102918f, 0.107965f, 0.066925f, 0.167092f, 0.146335f, 0.092065f, -0.092152f, -0.275455f, 0.117223f, 0.037253f, -0.294550f, 0.301099f, -0.170645f, 0.263661f, 0.215763f, -0.079927f, 0.096896f, 0.012089f, -0.046831f, -0.204522f, -0.231419f, 0.137551f, -0.245230f, 0.064293f, 0.008349f, -0.182106f, 0.098231f, 0.161644f, 0.026572f, -0.124466f, -0.068155f, 0.131064f, -0.117541f, 0.104094f, -0.108997f, 0.182387f, -0.298377f, -0.175107f, -0.221994f, 0.194131f, -0.069023f, 0.065756f, 0.111214f, -0.321108f, 0.041075f, 0.115493f, 0.125813f, 0.166666f, -0.202873f, -0.107087f, -0.130234f, 0.170748f, 0.122507f, -0.220077f, 0.161132f, 0.247949f, 0.255522f, -0.289981f, 0.257286f, 0.230853f, 0.292301f, 0.028541f, -0.196994f, -0.214710f, -0.016516f, 0.035793f, -0.227346f, -0.312560f, -0.215280f, -0.026393f, -0.045295f, -0.221451f, -0.139862f, 0.095621f, -0.107160f, -0.283287f, -0.008934f, -0.057468f, 0.153716f, -0.293963f, -0.073510f, 0.271483f, -0.123187f, 0.135836f, 0.290165f, 0.308406f, 0.080451f, 0.132922f, 0.309226f, 0.271448f, 0.008025f, -0.174487f, 0.109252f, 0.222976f, 0.205328f, 0.135184f, -0.292840f, -0.021769f, -0.187255f, -0.036963f, -0.097020f, 0.198222f, 0.029138f, 0.232285f, -0.212429f, 0.252991f, -0.088401f, 0.249707f, 0.008375f, 0.227109f, -0.086960f, -0.197819f, 0.139703f, 0.196183f, -0.149270f, -0.025785f, -0.115684f, 0.065050f, 0.196127f, -0.107764f, -0.056197f, 0.175255f, -0.310083f, 0.067883f, 0.148323f, -0.219312f, -0.037665f, 0.193162f, -0.090796f, -0.256963f, -0.239555f, -0.156752f, 0.230994f, -0.275050f, -0.183628f, -0.044457f, -0.149410f, -0.000314f, 0.325670f, -0.003880f, -0.159973f, 0.264150f, -0.096074f, 0.151780f, 0.112829f, 0.069757f, 0.133336f, -0.304471f, 0.003629f, -0.165672f, -0.128387f, -0.219582f, -0.164686f, -0.128049f, -0.197999f, 0.079291f, -0.235631f, 0.013275f, -0.019349f, 0.075558f, -0.110116f, 0.207544f, -0.263157f, 0.241139f, 0.246202f, -0.043995f, -0.040024f, -0.182259f, 0.095136f, 0.227099f, -0.171583f, 0.272891f, -0.304568f, -0.133966f, 0.107142f, 0.292375f, -0.083492f, 0.272253f, 0.227578f, 0.249003f, -0.189286f, 0.142205f, -0.270659f, -0.064482f, 0.075820f, -0.269318f, 0.287282f, -0.297795f, -0.269015f, -0.233389f, 0.141521f, -0.069211f, 0.033698f, 0.056510f, 0.137272f, 0.216780f, -0.184757f, 0.051613f, -0.002950f, -0.125078f, 0.053092f, -0.014366f, 0.040608f, -0.024137f, -0.001998f, -0.249613f, 0.194896f, -0.271393f, 0.056642f, -0.048308f, -0.168523f, -0.029107f, -0.054892f, 0.022634f, -0.156102f, 0.127615f, 0.226763f, 0.102525f, 0.220760f, -0.013384f, -0.307156f, 0.040639f, 0.307507f, -0.089307f, 0.293610f, -0.198887f, -0.265227f, -0.087031f, -0.090536f, -0.059068f, 0.007961f, -0.102173f, 0.204820f, -0.136729f, 0.038026f, 0.101018f, -0.057272f, -0.160548f, 0.167068f, -0.104184f, -0.166091f, 0.176337f, -0.024124f, 0.170349f, 0.127858f, -0.283964f, 0.157640f, -0.194274f, 0.108621f, -0.107597f, 0.021049f, 0.010181f, 0.229695f, -0.043698f, -0.303408f, 0.167613f, 0.050517f, 0.179884f, -0.054885f, 0.206904f, 0.299580f, -0.219252f, 0.282648f, -0.034390f, 0.140367f, -0.285063f, 0.155716f, -0.130014f, 0.115599f, -0.225038f, 0.184878f, -0.166837f, -0.019582f, -0.286024f, 0.130808f, -0.248106f, 0.112639f, -0.055965f, -0.037273f, -0.191085f, 0.122598f, -0.279941f, 0.291179f, 0.045058f, -0.216914f, 0.066938f, -0.016170f, 0.166372f, 0.083545f, -0.286186f, 0.243419f, 0.299503f, 0.141669f, -0.298367f, -0.055081f, 0.137152f, 0.251039f, 0.123639f, -0.087259f, -0.114684f, -0.294177f, 0.076689f, -0.067076f, 0.071901f, 0.264234f, -0.098969f, -0.085778f, -0.199018f, -0.278695f, -0.092355f, 0.202456f, 0.276745f, -0.053655f, 0.184576f, 0.279852f, 0.182203f, 0.288769f, -0.306141f, -0.238409f, 0.127049f, -0.037269f, -0.016477f, 0.012438f, 0.311375f, -0.011539f, 0.269675f, -0.255314f, 0.236198f, -0.087652f, 0.173267f, -0.107019f, 0.062939f, -0.243888f, -0.229652f, -0.234447f, 0.088698f, 0.062844f, -0.226004f, 0.061677f, -0.082081f, 0.051983f, 0.147593f, 0.219066f, -0.105865f, 0.002050f, -0.073437f, 0.282029f, 0.026362f, -0.238376f, 0.154946f, 0.119247f, -0.137849f, -0.188671f, 0.157236f, 0.263382f, 0.093344f, 0.176218f, 0.107387f, 0.287804f, -0.212008f, -0.131669f, -0.151950f, 0.285687f, 0.218777f, 0.161483f, -0.040678f, -0.138120f, 0.101817f, 0.290881f, 0.153536f, -0.050669f, 0.059477f, -0.295678f, 0.166303f, -0.205467f, -0.145426f, 0.090843f, -0.068791f, 0.123047f, -0.175602f, -0.227720f, -0.039042f, -0.178574f, -0.205423f, 0.230234f, 0.108729f, 0.172553f, 0.256737f, -0.299784f, -0.159726f, 0.272547f, -0.046657f, 0.255724f, 0.130773f, 0.115136f, -0.086206f, -0.048780f, 0.111863f, 0.152937f, -0.216281f, 0.233828f, 0.130015f, 0.246066f, -0.068279f, -0.237001f, -0.070252f, -0.228103f, -0.003946f, -0.255297f, 0.150429f, -0.099403f, -0.182798f, 0.154885f, -0.298248f, -0.278022f, 0.027589f, -0.267976f, 0.007088f, 0.305887f, -0.051284f, 0.109064f, -0.095868f, 0.200492f, 0.313525f, 0.162047f, 0.052721f, 0.280387f, 0.256751f, 0.174420f, 0.124757f, -0.275722f, 0.246114f, -0.286086f, 0.272222f, -0.002983f, 0.303536f, -0.271551f, -0.046402f, 0.233947f, -0.073478f, 0.272606f, -0.302506f, -0.096256f, -0.298998f, 0.106279f, -0.075176f, -0.234498f, -0.005387f, 0.042588f, 0.179350f, -0.072784f, 0.194843f, 0.170639f, 0.242530f, 0.114905f, -0.147760f, 0.282714f, 0.271060f, -0.265696f, -0.001059f, -0.274766f, 0.116409f, 0.085611f, -0.293388f, 0.205963f, -0.191952f, -0.251915f, -0.169658f, 0.190717f, -0.131229f, 0.243589f, -0.098578f, 0.087669f, 0.125726f, 0.286785f, 0.195673f, 0.214713f, -0.206828f, -0.253542f, -0.042230f, 0.028484f, -0.134934f, 0.052566f, 0.063444f, -0.086017f, 0.076209f, -0.071815f, -0.112480f, -0.165228f, -0.171105f, -0.295390f, -0.162764f, 0.118768f, 0.290421f, 0.212627f, -0.121510f, 0.232145f, 0.151130f, 0.003079f, -0.049839f, -0.289760f, 0.195441f, 0.290942f, 0.059471f, 0.085621f, -0.227241f, -0.071346f, -0.029469f, -0.216783f, 0.114375f, 0.270517f, 0.024722f, 0.241525f, 0.097153f, -0.021883f, 0.009018f, 0.125561f, -0.291186f, -0.119414f, 0.086094f, 0.096219f, -0.151410f, -0.165815f, 0.180730f, 0.078485f, -0.043409f, -0.246449f, 0.013890f, 0.157073f, -0.103805f, 0.231508f, -0.207817f, -0.227029f, -0.277404f, 0.214043f, -0.144683f, 0.145591f, -0.013927f, 0.180398f, 0.003433f, -0.253846f, -0.079969f, -0.046966f, -0.117092f, 0.022421f, -0.255627f, -0.087967f, 0.278963f, 0.292485f, -0.034172f, -0.047662f, -0.006778f, -0.010179f, -0.024762f, 0.122491f, 0.152680f, -0.249838f, -0.206939f, 0.029543f, 0.089131f, -0.103073f, 0.254959f, -0.250287f, 0.116086f, -0.217581f, 0.221605f, 0.031580f, 0.038770f, 0.046300f, 0.122585f, 0.259729f, 0.145029f, -0.137359f, -0.033222f, -0.066295f, 0.096239f, -0.068837f, -0.264204f, 0.270698f, -0.046180f, 0.260193f, 0.128253f, 0.246393f, 0.184971f, 0.091944f, -0.246167f, 0.196235f, 0.119972f, 0.297918f, -0.200632f, -0.270798f, 0.003353f, -0.097914f, 0.295373f, 0.144380f, -0.017547f, -0.206124f, -0.026367f, -0.005815f, -0.316528f, -0.133826f, -0.156120f, -0.082671f, -0.061399f, -0.127270f, -0.244682f, -0.216222f, 0.130616f, 0.267072f, -0.083530f, -0.203910f, -0.159933f, -0.225267f, -0.171556f, 0.112921f, -0.067631f, -0.170382f, 0.063796f, 0.240550f, -0.309905f, 0.063882f, 0.117773f, -0.058229f, 0.261454f, -0.188267f, -0.296779f, 0.228896f, -0.075339f, 0.186207f, 0.299878f, -0.216423f, 0.194683f, 0.178084f, 0.153027f, -0.048516f, 0.054271f, -0.135394f, -0.298562f, 0.129787f, -0.236469f, -0.132858f, -0.286888f, 0.059662f, 0.209405f, -0.268204f, -0.049174f, 0.220005f, 0.161960f, -0.189921f, -0.141947f, 0.064344f, -0.171685f, -0.110529f, 0.158158f, 0.052750f, -0.231017f, -0.068027f, -0.196323f, 0.045625f, 0.265820f, -0.009243f, 0.191134f, 0.101101f, -0.030611f, 0.272047f, 0.268939f, 0.281306f, 0.220052f, 0.164424f, 0.241012f, -0.194293f, 0.230502f, -0.008794f, -0.215895f, 0.008269f, -0.270221f, 0.233939f, -0.145627f, -0.138689f, -0.048475f, -0.202411f, 0.262036f, 0.112615f, 0.089601f, 0.264350f, -0.224500f, -0.163580f, 0.111037f, 0.110790f, 0.198841f, 0.160845f, -0.280488f, 0.055788f, 0.168732f, 0.246575f, 0.209893f, -0.171199f, -0.164086f, 0.081228f, -0.037295f, -0.068533f, 0.274465f, -0.175669f, 0.225915f, 0.068581f, 0.139412f, 0.174850f, -0.003768f, 0.279516f, -0.020373f, -0.148366f, 0.245712f, -0.017006f, 0.276312f, 0.009118f, -0.167850f, -0.090444f, 0.301664f, -0.174929f, -0.084943f, -0.127127f, 0.153493f, -0.143138f, 0.215314f, 0.267497f, -0.050540f, 0.006868f, 0.175793f, -0.034601f, -0.269776f, 0.012761f, 0.002226f, -0.049792f, -0.143369f, -0.145541f, 0.041697f, -0.222312f, -0.235243f, 0.011786f, -0.071746f, 0.162848f, -0.057363f, 0.252484f, -0.222402f, 0.237415f, -0.201671f, -0.181405f, -0.174279f, 0.159698f, -0.060671f, 0.198255f, 0.085547f, -0.240623f, -0.276432f, 0.072712f, 0.246239f, -0.181802f, -0.050677f, -0.269512f, -0.000005f, 0.202190f, -0.032251f, -0.038034f, -0.167082f, 0.024076f, 0.193464f, 0.040597f, -0.111132f, 0.169679f, -0.250168f, -0.267497f, -0.171472f, 0.009812f, -0.132043f, 0.116459f, 0.194765f, -0.125015f, 0.146258f, -0.170813f, 0.194187f, 0.249607f, -0.074978f, -0.263292f, -0.063866f, -0.093565f, 0.001121f, 0.016699f, 0.248881f, 0.056503f, -0.270408f, 0.110854f, 0.172369f, -0.196054f, -0.185561f, 0.255032f, 0.268082f, -0.247123f, 0.249400f, 0.322164f, -0.004345f, 0.194523f, -0.190406f, 0.007461f, -0.219235f, 0.106865f, -0.060610f, -0.221395f, -0.158934f, -0.245908f, -0.088984f, 0.194224f, -0.008717f, 0.090257f, 0.294524f, 0.104408f, -0.169532f, -0.273348f, 0.212281f, -0.118392f, 0.077096f, 0.238495f, 0.008547f, 0.027849f, -0.059238f, -0.004760f, 0.107100f, 0.056019f, 0.211511f, 0.315467f, -0.056609f, 0.308111f, 0.117597f };
 static const float mynet_layer_2_biases[6] = { 0.236087f, -0.316874f, 0.369539f, 0.253873f, -0.154083f, 0.222205f };
 static const float mynet_layer_2_weights[192] = { 0.058976f, -0.295091f, -0.084945f, 0.078768f, 0.039178f, 0.045697f, 0.334870f, 0.171562f, -0.149173f, -0.033122f, -0.333290f, -0.163340f, 0.330570f, 0.136235f, 0.408093f, -0.082649f, 0.009759f, 0.389494f, 0.080481f, -0.024955f, 0.202557f, 0.104950f, 0.362436f, 0.382093f, 0.233561f, -0.214923f, 0.084852f, 0.337640f, -0.398833f, -0.296643f, -0.042171f, 0.135486f, -0.311941f, -0.136282f, -0.379430f, 0.187686f, -0.253771f, 0.284574f, 0.066408f, 0.092005f, -0.266909f, -0.242158f, -0.144090f, 0.323051f, -0.294902f, 0.002561f, -0.185683f, 0.179826f, -0.159522f, 0.369259f, 0.027074f, -0.052541f, 0.224654f, -0.041956f, 0.274591f, 0.398144f, -0.150724f, 0.295761f, 0.162726f, -0.141583f, 0.373516f, 0.332456f, -0.135454f, 0.326410f, 0.191323f, 0.039227f, -0.187278f, -0.176665f, -0.109964f, 0.321137f, 0.054500f, 0.288644f, -0.216898f, 0.226395f, -0.384632f, 0.021541f, 0.316207f, -0.184146f, -0.043860f, 0.257829f, -0.364568f, -0.319374f, 0.072477f, 0.018257f, 0.239302f, 0.063582f, -0.348758f, 0.401761f, -0.394562f, -0.012629f, -0.012515f, 0.265620f, 0.156732f, -0.304612f, -0.042065f, -0.301983f, 0.354370f, 0.005127f, 0.060908f, -0.221299f, -0.346062f, -0.137244f, 0.289859f, 0.097976f, -0.137596f, 0.053024f, 0.208379f, 0.377497f, 0.384812f, 0.144605f, 0.274407f, -0.107438f, 0.253924f, 0.098089f, -0.007483f, -0.370002f, 0.069261f, 0.320686f, 0.226574f, 0.298180f, -0.006343f, -0.159731f, 0.323172f, 0.034688f, -0.170102f, 0.336816f, -0.267466f, 0.226766f, -0.204223f, 0.231192f, 0.065738f, 0.041218f, -0.032849f, -0.341485f, -0.060206f, -0.205889f, 0.413837f, 0.177515f, 0.167656f, 0.174405f, 0.056188f, 0.182122f, -0.269992f, 0.211403f, -0.378881f, -0.056661f, 0.068582f, -0.287849f, -0.218581f, -0.352753f, -0.340615f, -0.247364f, -0.340683f, -0.277272f, 0.068585f, -0.402071f, 0.020897f, -0.343155f, 0.124038f, -0.150781f, -0.064743f, -0.385281f, 0.320836f, 0.205273f, -0.372770f, 0.268567f, -0.015435f, -0.190072f, 0.021797f, 0.382450f, -0.065878f, -0.176941f, 0.061639f, -0.243302f, -0.026640f, -0.108746f, -0.077867f, 0.160226f, -0.325011f, 0.030103f, -0.221258f, -0.135867f, 0.053934f, 0.053746f, -0.068840f, 0.358565f, -0.310066f, -0.275749f, -0.043834f, -0.120104f, -0.024005f, 0.136528f };
-static float mynet_buf1[600];
-static float mynet_buf2[600];
+static float mynet_buf1[32];
+static float mynet_buf2[32];
 static const EmlNetLayer mynet_layers[3] = { 
 { 32, 600, mynet_layer_0_weights, mynet_layer_0_biases, EmlNetActivationRelu }, 
 { 32, 32, mynet_layer_1_weights, mynet_layer_1_biases, EmlNetActivationRelu }, 
 { 6, 32, mynet_layer_2_weights, mynet_layer_2_biases, EmlNetActivationSoftmax } };
-static EmlNet mynet = { 3, mynet_layers, mynet_buf1, mynet_buf2, 600 };
+static EmlNet mynet = { 3, mynet_layers, mynet_buf1, mynet_buf2, 32 };
 
     int32_t
     mynet_predict(const float *features, int32_t n_features)
@@ -0,0 +1,201 @@
+"""
+Train the streaming GRU gesture model (Firmware/Core/Src/gru_model.c) on the recorded gestures.
+
+The firmware (main.c with MLP_STREAMING=1) averages every MLP_STREAM_DECIMATION IMU samples into one
+GRU step while the button is held, at the fixed poll rate, and ignores the gesture after GRU_MAX_STEPS steps.
+The model is trained on the same sequences: the recordings in home-made/data are stored resampled to
+100 samples, so each one is stretched back to a gesture length drawn from --min-seconds..--max-seconds
+at --rate, decimated the same way (a partial last step is dropped) and cut at --max-steps.
+After the last step of a shorter gesture the state is held, as in the firmware.
+
+GRU and dense head are trained together with backpropagation through time, in numpy (Adam).
+The per-axis StandardScaler is folded into the GRU input weights, so the firmware pushes raw IMU values.
+
+Usage, from home-made/:
+
+    python train_gru.py data ../Firmware/Core/Src/gru_model.c
+"""
+import argparse
+from pathlib import Path
+
+import numpy as np
+from sklearn.metrics import balanced_accuracy_score
+from sklearn.model_selection import train_test_split
+
+from eml_export import GRU, Dense, export_sequential, load_dataset_csv
+
+N_WINDOW = 100
+N_AXES = 6
+
+
+def stream_sequences(X, n_raw, decimation, max_steps):
+    """
+    Decimated fixed-rate sequences as the firmware front end makes them, for windows X (n, 100 * 6)
+    stretched to n_raw[i] samples. Returns steps (n, max_steps, 6), zero after the last step, and the step counts
+    """
+    windows = np.asarray(X, dtype=np.float64).reshape(len(X), N_WINDOW, N_AXES)
+    steps = np.zeros((len(X), max_steps, N_AXES))
+    lengths = np.minimum(np.asarray(n_raw) // decimation, max_steps)
+    for i, window in enumerate(windows):
+        # Inverse of model_resample_window(): sample k of the recording is at k * 99 / (n_raw - 1) in the window
+        pos = np.linspace(0.0, N_WINDOW - 1, n_raw[i])
+        raw = np.stack([np.interp(pos, np.arange(N_WINDOW), window[:, axis]) for axis in range(N_AXES)], axis=1)
+        n = lengths[i]
+        steps[i, :n] = raw[:n * decimation].reshape(n, decimation, N_AXES).mean(axis=1)
+    return steps, lengths
+
+
+def _sigmoid(a):
+    return 1.0 / (1.0 + np.exp(-a))
+
+
+def _init_params(hidden, head, n_classes, rng):
+    def glorot(n_in, n_out):
+        limit = np.sqrt(6.0 / (n_in + n_out))
+        return rng.uniform(-limit, limit, size=(n_in, n_out))
+    return {
+        'wx': glorot(N_AXES, 3 * hidden), 'wh': glorot(hidden, 3 * hidden),
+        'bx': np.zeros(3 * hidden), 'bh': np.zeros(3 * hidden),
+        'w1': glorot(hidden, head), 'b1': np.zeros(head),
+        'w2': glorot(head, n_classes), 'b2': np.zeros(n_classes),
+    }
+
+
+def _forward(p, steps, lengths):
+    """Logits, and what the backward pass needs. Like GRU.forward(), holding the state after lengths[i] steps"""
+    B, T, _ = steps.shape
+    H = p['wh'].shape[0]
+    gx = steps @ p['wx'] + p['bx']
+    h = np.zeros((B, H))
+    cache = []
+    for t in range(T):
+        gh = h @ p['wh'] + p['bh']
+        z = _sigmoid(gx[:, t, :H] + gh[:, :H])
+        r = _sigmoid(gx[:, t, H:2*H] + gh[:, H:2*H])
+        n = np.tanh(gx[:, t, 2*H:] + r * gh[:, 2*H:])
+        m = (t < lengths)[:, None].astype(np.float64)
+        cache.append((h, z, r, n, gh[:, 2*H:], m))
+        h = m * ((1.0 - z) * n + z * h) + (1.0 - m) * h
+    a1 = h @ p['w1'] + p['b1']
+    r1 = np.maximum(a1, 0.0)
+    return r1 @ p['w2'] + p['b2'], (h, a1, r1, cache)
+
+
+def _backward(p, steps, dlogits, saved):
+    h, a1, r1, cache = saved
+    H = p['wh'].shape[0]
+    g = {'w2': r1.T @ dlogits, 'b2': dlogits.sum(axis=0)}
+    da1 = (dlogits @ p['w2'].T) * (a1 > 0.0)
+    g['w1'], g['b1'] = h.T @ da1, da1.sum(axis=0)
+    dh = da1 @ p['w1'].T
+
+    dgx = np.zeros(steps.shape[:2] + (3 * H,))
+    g['wh'], g['bh'] = np.zeros_like(p['wh']), np.zeros_like(p['bh'])
+    for t in reversed(range(len(cache))):
+        h_prev, z, r, n, gh_n, m = cache[t]
+        dh_new = dh * m
+        dn = dh_new * (1.0 - z)
+        dan = dn * (1.0 - n * n)
+        daz = dh_new * (h_prev - n) * z * (1.0 - z)
+        dar = dan * gh_n * r * (1.0 - r)
+        dgx[:, t] = np.concatenate([daz, dar, dan], axis=1)
+        dgh = np.concatenate([daz, dar, dan * r], axis=1)
+        g['wh'] += h_prev.T @ dgh
+        g['bh'] += dgh.sum(axis=0)
+        dh = dh * (1.0 - m) + dh_new * z + dgh @ p['wh'].T
+    g['wx'] = steps.reshape(-1, N_AXES).T @ dgx.reshape(-1, 3 * H)
+    g['bx'] = dgx.sum(axis=(0, 1))
+    return g
+
+
+def train(steps, lengths, y, n_classes, hidden, head, epochs, learning_rate=0.005, batch_size=32, seed=0):
+    """GRU and head on standardized steps, cross-entropy with Adam. Returns the parameters"""
+    rng = np.random.default_rng(seed)
+    p = _init_params(hidden, head, n_classes, rng)
+    m = {k: np.zeros_like(v) for k, v in p.items()}
+    v = {k: np.zeros_like(v) for k, v in p.items()}
+    beta1, beta2, t = 0.9, 0.999, 0
+    for epoch in range(epochs):
+        order = rng.permutation(len(steps))
+        loss = 0.0
+        for start in range(0, len(order), batch_size):
+            batch = order[start:start + batch_size]
+            # Padding past the longest sequence of the batch changes nothing
+            T = int(lengths[batch].max())
+            logits, saved = _forward(p, steps[batch, :T], lengths[batch])
+            prob = np.exp(logits - logits.max(axis=1, keepdims=True))
+            prob /= prob.sum(axis=1, keepdims=True)
+            loss -= np.log(prob[np.arange(len(batch)), y[batch]] + 1e-12).sum()
+            prob[np.arange(len(batch)), y[batch]] -= 1.0
+            grads = _backward(p, steps[batch, :T], prob / len(batch), saved)
+
+            norm = np.sqrt(sum((gr * gr).sum() for gr in grads.values()))
+            clip = min(1.0, 5.0 / (norm + 1e-12))
+            t += 1
+            for k in p:
+                gr = grads[k] * clip
+                m[k] = beta1 * m[k] + (1 - beta1) * gr
+                v[k] = beta2 * v[k] + (1 - beta2) * gr * gr
+                p[k] -= learning_rate * (m[k] / (1 - beta1 ** t)) / (np.sqrt(v[k] / (1 - beta2 ** t)) + 1e-8)
+        if (epoch + 1) % 10 == 0:
+            print(f"epoch {epoch + 1}: loss {loss / len(steps):.2e}")
+    return p
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Train and export the streaming GRU gesture model')
+    parser.add_argument('data', help='directory of gesture CSVs, like home-made/data')
+    parser.add_argument('output', help='C file to write')
+    parser.add_argument('--name', default='gru', help='C identifier prefix')
+    parser.add_argument('--header', default='gru_model.h', help='header to include')
+    parser.add_argument('--hidden', default=32, type=int, help='GRU state size')
+    parser.add_argument('--head', default=32, type=int, help='hidden units of the dense head')
+    parser.add_argument('--decimation', default=4, type=int, help='IMU samples per step, MLP_STREAM_DECIMATION')
+    parser.add_argument('--max-steps', default=100, type=int, help='steps kept per gesture, GRU_MAX_STEPS')
+    parser.add_argument('--rate', default=166.0, type=float, help='IMU samples per second of the poll loop')
+    parser.add_argument('--min-seconds', default=0.8, type=float, help='shortest gesture length to train on')
+    parser.add_argument('--max-seconds', default=3.2, type=float, help='longest gesture length to train on')
+    parser.add_argument('--lengths', default=4, type=int, help='random gesture lengths per training recording')
+    parser.add_argument('--epochs', default=20, type=int)
+    parser.add_argument('--seed', default=0, type=int)
+    args = parser.parse_args()
+
+    X, y = load_dataset_csv(args.data)
+    n_classes = int(y.max()) + 1
+    X_train, X_test, y_train, y_test = train_test_split(X, y, test_size=0.3, stratify=y, random_state=args.seed)
+
+    rng = np.random.default_rng(args.seed)
+    lo, hi = int(args.min_seconds * args.rate), int(args.max_seconds * args.rate)
+    X_rep, y_rep = np.repeat(X_train, args.lengths, axis=0), np.repeat(y_train, args.lengths)
+    steps, lengths = stream_sequences(X_rep, rng.integers(lo, hi + 1, size=len(X_rep)), args.decimation, args.max_steps)
+
+    # One scaler per axis (not per feature), over the steps the firmware pushes
+    pushed = steps[np.arange(args.max_steps)[None, :] < lengths[:, None]]
+    mean, scale = pushed.mean(axis=0), pushed.std(axis=0)
+    scale = np.where(scale == 0.0, 1.0, scale)
+    p = train((steps - mean) / scale, lengths, y_rep, n_classes, args.hidden, args.head, args.epochs, seed=args.seed)
+
+    gru = GRU(p['wx'], p['wh'], np.stack([p['bx'], p['bh']])).fold_scaler(mean, scale)
+    layers = [
+        gru,
+        Dense(p['w1'], p['b1'], activation='relu'),
+        Dense(p['w2'], p['b2'], activation='softmax'),
+    ]
+    raw = {'wx': gru.input_weights, 'wh': gru.recurrent_weights, 'bx': gru.biases[0], 'bh': gru.biases[1],
+           'w1': p['w1'], 'b1': p['b1'], 'w2': p['w2'], 'b2': p['b2']}
+
+    # Held-out recordings, as the firmware streams them at several gesture lengths
+    print(f"held-out, {len(y_test)} recordings")
+    for seconds in [1.0, 1.5, 2.0, 2.5, 3.0]:
+        n_raw = np.full(len(X_test), int(seconds * args.rate))
+        test_steps, test_lengths = stream_sequences(X_test, n_raw, args.decimation, args.max_steps)
+        predicted = _forward(raw, test_steps, test_lengths)[0].argmax(axis=1)
+        print(f"  {seconds:.1f} s gestures ({test_lengths[0]} steps): accuracy {np.mean(predicted == y_test):.4f}, "
+              f"balanced accuracy {balanced_accuracy_score(y_test, predicted):.4f}")
+
+    code = export_sequential(layers, args.name, (args.max_steps, N_AXES), header=args.header)
+    Path(args.output).write_text(code)
+
+
+if __name__ == '__main__':
+    main()